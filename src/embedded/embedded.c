@@ -93,10 +93,30 @@ void monetdb_disconnect(monetdb_connection conn) {
 #define NULLFILE "/dev/null"
 #endif
 
-#define EMBEDDED_SCRIPT_SIZE_MAX 10485760 // 10 MB
+// inflate one of the inlined scripts into a buffer of exactly its recorded size
+static char* embedded_inflate_script(unsigned char* arr, size_t arrlen, unsigned long len) {
+	mz_ulong decompress_len = (mz_ulong) len;
+	char* script = GDKmalloc(len + 1);
+	if (!script) {
+		return NULL;
+	}
+	if (mz_uncompress((unsigned char*) script, &decompress_len, arr, (mz_ulong) arrlen) != 0 ||
+		decompress_len != len) {
+		GDKfree(script);
+		return NULL;
+	}
+	script[len] = '\0';
+	return script;
+}
+
+// the createdb script is only needed when a new catalog is created, so it is
+// inflated on demand instead of on every startup; the caller frees it
+char* embedded_createdb_script(void) {
+	return embedded_inflate_script(createdb_inline_arr, sizeof(createdb_inline_arr), createdb_inline_len);
+}
 
 char* monetdb_startup(char* dbdir, char silent, char sequential) {
-	str retval = MAL_SUCCEED;
+	str volatile retval = MAL_SUCCEED;
 	char* sqres = NULL;
 	monetdb_result* res = NULL;
 	void* c;
@@ -113,21 +133,11 @@ char* monetdb_startup(char* dbdir, char silent, char sequential) {
 
 	if (monetdb_embedded_initialized) goto cleanup;
 
-	// decompress scripts
-	{
-		mz_ulong decompress_len_mal = EMBEDDED_SCRIPT_SIZE_MAX;
-		mz_ulong decompress_len_sql = EMBEDDED_SCRIPT_SIZE_MAX;
-		mal_init_inline = GDKzalloc(decompress_len_mal);
-		createdb_inline = GDKzalloc(decompress_len_sql);
-		if (!mal_init_inline || !createdb_inline) {
-			retval = GDKstrdup("Memory allocation failed");
-			goto cleanup;
-		}
-		if (mz_uncompress(mal_init_inline, &decompress_len_mal, mal_init_inline_arr, sizeof(mal_init_inline_arr)) != 0 ||
-			mz_uncompress(createdb_inline, &decompress_len_sql, createdb_inline_arr, sizeof(createdb_inline_arr)) != 0) {
-			retval = GDKstrdup("Script decompression failed");
-			goto cleanup;
-		}
+	// decompress the MAL bootstrap script
+	mal_init_inline = (unsigned char*) embedded_inflate_script(mal_init_inline_arr, sizeof(mal_init_inline_arr), mal_init_inline_len);
+	if (!mal_init_inline) {
+		retval = GDKstrdup("Script decompression failed");
+		goto cleanup;
 	}
 
 	embedded_stdout = fopen(NULLFILE, "w");
@@ -181,7 +191,7 @@ char* monetdb_startup(char* dbdir, char silent, char sequential) {
 
 cleanup:
 	GDKfree(mal_init_inline);
-	GDKfree(createdb_inline);
+	mal_init_inline = NULL;
 	MT_lock_unset(&embedded_lock);
 	return retval;
 }
@@ -132,6 +132,9 @@ embedded_export void monetdb_unregister_progress(monetdb_connection conn);
 
 embedded_export void  monetdb_shutdown(void);
 
+// inflate the inlined createdb script for a new catalog; the caller frees it
+char* embedded_createdb_script(void);
+
 #ifdef __cplusplus
 }
 #endif
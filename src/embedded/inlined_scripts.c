@@ -1,77 +1,79 @@
 unsigned char mal_init_inline_arr[] = 
-{120,218,236,189,123,119,228,182,149,47,250,183,244,41,24,223,63,186,52,41,41,45,121,206,201,57,86,218,235,246,43,142,102,250,149,238,182,103,238,117,188,180,88,85,148,196,152,69,150,73,150,30,254,244,7,27,224,3,36,1,18,0,241,170,123,147,149,213,86,85,17,192,15,27,251,13,96,243,248,120,244,127,219,108,179,79,162,96,187,13,203,187,203,227,227,117,134,254,74,55,65,184,206,138,197,227,119,55,73,121,2,255,4,199,225,102,147,71,69,17,188,127,249,245,111,251,52,204,159,174,95,190,254,248,5,253,116,217,111,179,89,37,39,240,15,175,13,250,9,55,137,210,50,248,230,235,93,84,181,59,9,110,246,233,186,140,179,52,88,135,201,122,159,132,101,84,4,37,252,158,175,3,244,72,156,70,65,118,19,60,46,209,151,97,25,196,228,199,227,163,251,48,217,71,193,195,93,86,68,245,99,232,183,199,179,0,250,38,63,162,207,121,84,238,243,52,218,4,113,26,228,225,38,14,211,34,0,208,232,167,227,35,152,124,132,254,137,209,200,201,83,176,137,110,98,120,180,204,130,85,132,254,95,62,68,81,26,60,199,207,127,186,10,22,113,186,78,246,69,124,31,157,156,125,67,211,12,141,93,209,44,8,184,84,251,114,245,161,75,53,210,10,168,134,90,241,232,134,90,13,233,134,91,142,211,141,67,53,66,150,227,35,66,53,5,154,245,40,118,124,196,166,217,233,167,171,63,93,16,194,225,63,249,180,43,195,150,118,193,8,249,190,190,236,145,143,52,36,228,11,70,40,136,26,14,41,136,27,143,83,16,61,114,11,13,166,136,88,63,103,142,142,21,255,77,80,241,130,144,113,249,196,17,222,85,220,208,227,98,64,201,11,66,74,212,152,45,197,116,99,38,53,81,7,203,39,97,130,194,87,229,67,22,28,7,213,255,238,195,60,14,87,9,122,250,17,207,246,233,44,8,174,48,77,139,120,27,39,97,14,116,169,251,140,211,219,186,211,227,35,170,215,167,224,79,176,84,209,227,58,218,149,100,197,224,177,34,190,69,116,71,191,175,178,242,14,53,186,221,3,116,180,18,121,212,2,216,23,132,246,155,168,140,242,45,200,5,52,253,109,31,110,242,176,197,140,232,177,79,74,132,173,179,204,199,71,226,11,205,94,230,6,198,196,122,55,107,214,106,105,212,232,136,47,54,125,85,221,106,234,170,29,71,106,88,234,186,175,173,201,164,201,250,118,212,244,195,93,132,72,251,8,179,191,69,208,83,160,74,51,195,138,60,68,82,72,23,45,37,27,182,63,199,52,56,239,48,57,173,101,199,230,220,87,180,180,158,29,155,51,75,213,246,53,173,237,57,119,180,227,200,156,251,218,177,163,28,71,230,204,82,142,125,221,72,207,185,163,20,155,249,177,38,95,205,153,158,204,58,43,5,153,246,107,143,105,75,65,166,253,202,96,218,146,59,153,215,217,204,233,20,119,34,166,11,201,210,223,250,66,120,39,98,186,160,33,75,10,239,22,212,132,58,51,186,123,218,69,249,42,75,226,117,159,59,227,245,29,81,85,181,2,234,233,165,176,8,22,209,227,14,104,245,199,0,254,56,125,60,57,65,250,244,162,47,130,66,83,70,162,244,183,190,12,10,77,25,26,178,132,144,61,101,60,103,122,210,131,41,55,107,138,230,62,61,243,83,254,204,17,167,8,205,28,9,212,223,250,146,40,52,115,104,200,18,197,206,204,57,107,221,117,85,132,22,155,44,8,204,147,112,99,215,159,168,184,93,100,194,159,95,190,185,122,249,161,107,101,218,230,147,211,174,154,15,102,94,119,65,187,20,89,122,31,229,37,44,228,109,30,33,87,33,78,145,21,109,4,51,104,225,87,15,136,192,127,243,246,135,207,111,223,118,225,183,205,39,225,87,205,7,240,235,46,88,240,107,7,1,195,175,30,236,192,199,220,40,160,39,223,254,247,167,14,110,210,110,90,79,162,118,3,192,149,4,48,57,141,152,42,196,92,81,176,128,207,171,176,192,31,27,225,74,67,244,112,152,4,73,118,139,252,184,242,110,91,156,160,89,198,149,75,5,77,118,217,67,148,99,254,236,240,25,106,32,52,211,119,31,127,232,204,148,180,155,158,41,106,55,152,41,110,203,153,233,96,34,76,200,231,207,41,206,26,129,124,254,188,15,26,183,172,153,106,4,244,249,115,22,108,104,205,1,14,75,114,122,254,156,5,188,25,31,173,65,39,68,96,97,175,252,252,79,31,
-255,171,3,157,52,109,3,4,22,248,182,233,0,59,110,222,9,15,216,252,245,200,227,154,167,174,21,250,45,47,23,245,28,198,28,193,191,127,238,58,18,85,67,50,131,49,79,16,53,28,90,33,104,204,101,156,44,61,77,163,91,164,97,239,145,238,202,178,114,200,56,235,149,24,234,215,175,122,168,171,134,147,168,161,225,208,93,88,141,160,94,239,87,125,180,237,168,81,156,52,112,199,188,155,183,87,239,186,112,73,195,105,239,6,53,28,194,133,198,29,184,217,62,221,64,84,184,223,61,132,57,250,171,98,141,52,66,225,91,81,130,18,141,110,163,188,67,233,155,112,85,136,32,248,235,203,87,67,205,141,27,63,242,189,13,244,115,150,236,75,138,107,113,54,170,86,133,55,73,134,3,212,211,93,134,160,5,233,126,187,66,44,220,229,4,244,76,150,83,180,229,145,246,175,239,62,126,252,220,161,109,221,114,74,133,224,150,195,169,225,214,76,234,110,178,135,116,146,190,187,176,68,193,113,26,220,108,179,13,129,191,172,244,96,119,6,175,223,191,65,241,252,251,143,111,32,242,14,147,203,126,67,208,35,149,26,236,78,160,215,176,135,30,26,247,146,12,217,118,183,175,83,12,57,114,112,226,116,67,20,198,38,190,143,55,144,39,120,12,86,79,72,125,28,31,177,66,175,71,228,241,165,193,191,5,79,117,252,150,214,41,158,223,246,89,25,215,46,21,114,146,158,150,40,200,7,98,97,229,68,40,245,123,148,103,64,174,48,101,114,33,126,188,81,184,232,9,158,28,85,138,243,243,199,31,63,188,233,186,81,85,15,68,239,182,61,240,84,47,238,97,232,73,225,94,210,101,176,61,105,88,185,90,121,162,105,183,193,46,9,215,81,179,244,121,124,123,87,182,28,93,113,248,38,90,199,91,100,26,49,95,95,6,241,13,106,135,136,149,109,99,180,182,155,37,52,126,94,117,116,134,126,90,35,170,172,32,73,214,104,69,240,213,96,80,212,33,172,207,109,140,92,161,36,186,41,153,3,156,181,227,111,131,237,30,49,34,234,140,67,232,184,72,81,196,186,169,24,106,21,51,101,233,234,203,135,151,31,186,132,33,237,152,186,49,7,254,184,33,33,224,179,52,43,79,195,83,34,201,207,90,92,139,15,225,135,147,101,64,20,78,2,30,17,154,69,254,128,236,23,160,107,193,197,233,77,3,14,84,2,19,220,213,135,191,246,193,65,59,22,184,211,115,2,45,143,118,168,27,156,201,106,104,220,134,59,41,114,252,227,18,49,246,240,233,29,138,12,241,211,237,67,128,244,57,123,2,248,145,104,138,188,127,189,250,112,245,245,109,79,96,73,203,73,2,167,81,12,3,215,112,168,89,164,89,30,132,253,5,192,116,39,50,204,165,254,241,241,62,45,194,27,136,150,235,136,4,253,179,96,173,0,252,130,190,108,161,87,74,34,196,109,178,109,165,194,161,83,102,159,247,68,48,185,29,135,249,173,72,223,141,139,2,191,44,138,40,218,84,253,222,103,241,166,219,113,49,128,12,100,139,195,36,254,157,100,45,113,23,20,213,31,98,200,123,6,208,105,215,141,74,250,131,13,38,81,61,163,56,26,94,30,8,57,171,135,232,209,119,241,2,231,153,59,195,237,226,33,173,144,208,111,119,89,94,66,26,150,142,99,9,11,224,197,238,110,105,173,194,146,26,103,27,231,57,178,122,171,239,208,215,63,127,23,166,79,215,23,191,0,31,195,39,68,218,95,218,249,190,250,207,215,228,225,22,195,103,58,222,142,194,205,41,121,0,33,10,111,177,237,15,131,87,47,191,162,168,232,33,195,191,35,222,72,246,219,180,232,101,107,55,81,18,33,73,32,24,2,12,226,252,151,101,112,7,0,42,44,245,183,52,26,210,172,69,243,6,127,14,94,253,248,1,201,202,6,209,0,41,94,48,111,120,228,74,32,162,199,245,93,152,222,130,233,195,11,145,132,72,119,162,22,52,233,57,112,54,213,103,160,202,36,170,235,237,62,41,227,1,54,252,237,46,193,32,151,65,113,23,223,224,108,61,250,84,32,15,110,18,68,189,48,220,81,17,47,13,198,4,254,66,159,243,24,89,158,142,1,142,176,57,98,147,29,25,44,242,5,127,200,213,62,189,142,83,220,7,205,17,248,139,42,25,26,39,173,27,152,165,100,105,240,190,195,29,164,88,178,109,68,173,141,2,182,101,112,147,229,235,8,148,174,16,204,107,252,184,53,176,121,188,105,229,104,
-9,13,105,140,35,136,195,114,72,216,79,81,142,208,111,235,193,96,230,120,101,49,235,84,46,66,17,173,51,132,7,68,14,39,79,74,108,101,242,162,212,0,87,140,214,45,242,62,173,231,227,111,55,228,118,187,8,169,203,32,238,226,219,211,31,3,62,72,210,252,250,33,15,119,45,60,242,101,181,111,129,156,40,226,218,238,193,43,139,59,59,137,2,99,83,164,154,134,129,31,53,10,166,160,148,249,36,28,228,151,138,146,6,235,79,120,62,222,32,77,27,36,49,210,164,197,124,140,82,212,195,112,101,72,40,5,122,128,121,160,117,38,224,33,25,154,66,71,84,78,187,182,212,182,115,25,174,239,22,101,9,94,199,18,116,207,238,38,78,162,239,138,50,31,33,11,110,52,52,208,33,242,34,31,176,96,97,2,108,162,180,168,212,25,201,193,35,221,87,201,32,217,209,41,159,118,17,254,105,95,68,69,227,111,182,191,3,18,12,185,235,235,64,71,100,23,15,63,240,16,35,1,71,129,9,10,158,137,37,70,207,52,157,21,81,126,223,139,84,48,44,52,179,69,241,251,119,73,122,75,187,33,93,91,71,30,107,167,249,58,143,240,86,58,153,230,207,224,19,46,239,49,195,195,148,209,204,10,64,248,172,248,253,89,55,50,74,111,178,96,17,172,186,106,121,65,62,34,58,163,53,111,255,62,161,33,64,75,74,183,229,200,179,66,58,45,68,4,88,37,132,227,80,172,13,150,29,30,204,193,35,67,158,95,184,202,246,101,229,18,197,105,240,51,90,172,60,94,161,0,125,137,153,224,151,128,60,74,197,118,87,101,221,87,129,149,229,46,207,118,81,142,34,239,70,101,66,95,57,82,155,249,230,44,160,167,118,27,149,95,96,206,131,217,1,97,233,153,84,15,82,180,172,79,38,144,51,4,235,114,143,124,73,76,63,106,200,77,84,172,243,120,87,102,57,225,204,98,9,86,242,46,170,182,245,183,187,28,92,101,236,133,225,141,8,180,248,37,197,72,116,120,13,93,110,163,109,150,63,5,59,240,26,241,80,224,116,7,171,213,238,12,193,251,132,190,5,136,139,147,238,38,12,250,9,201,89,184,70,17,218,162,59,73,152,99,208,155,100,253,40,219,121,93,239,243,28,190,68,68,206,214,100,181,8,14,4,125,27,62,214,121,42,200,241,39,17,62,30,113,210,184,183,3,80,216,199,253,138,36,168,71,124,80,103,136,147,6,200,154,231,3,54,56,44,140,245,169,16,16,85,226,69,55,0,150,176,97,213,6,255,228,121,130,184,143,237,115,150,96,158,168,77,253,40,48,120,152,141,40,71,191,164,225,182,65,69,249,246,108,178,20,81,249,159,209,83,143,30,203,0,69,36,12,143,162,131,3,181,252,53,162,86,237,75,84,18,12,207,208,215,207,106,137,120,98,209,7,49,215,51,24,225,217,89,112,149,86,207,195,231,101,71,161,253,26,229,105,148,16,93,85,32,173,149,150,201,83,176,66,108,240,43,34,104,1,210,150,225,89,35,71,112,29,34,117,136,102,183,217,239,18,28,94,52,29,129,127,253,4,124,222,163,70,47,17,19,14,137,208,207,25,16,210,255,103,52,96,84,72,193,225,60,0,177,105,100,134,141,211,74,142,235,236,211,248,55,100,77,22,104,170,39,125,250,191,92,35,81,44,216,75,48,106,83,154,182,84,250,2,77,22,14,28,65,40,69,244,196,126,135,237,105,136,31,68,171,18,223,199,73,124,27,193,38,43,150,241,184,192,60,17,188,135,225,142,143,130,252,103,8,23,179,52,121,250,165,58,217,131,101,239,33,128,175,144,70,3,203,132,251,58,67,15,135,63,19,131,217,60,95,63,12,207,17,149,67,198,135,135,31,126,206,227,50,2,61,220,235,25,20,40,48,11,22,111,220,47,66,84,209,13,90,99,213,189,194,71,144,66,124,138,233,35,200,254,175,160,197,195,74,207,86,144,151,149,134,134,30,139,253,170,136,16,209,17,89,8,134,34,184,129,85,33,97,126,26,68,56,32,222,162,153,32,53,6,131,210,114,132,45,65,89,68,201,77,95,80,153,171,117,194,146,210,254,218,84,220,66,148,55,94,13,88,226,202,157,168,85,46,89,14,172,55,96,21,115,164,230,135,202,226,11,158,215,58,122,21,22,209,0,73,39,237,82,217,17,234,249,22,207,15,81,117,204,172,250,149,108,143,130,251,143,221,31,232,103,76,115,196,197,151,44,71,129,252,98,74,106,234,7,25,26,171,
-202,166,193,140,41,97,65,54,51,202,163,77,55,27,73,250,248,28,33,215,164,136,132,199,172,158,23,30,58,39,207,35,78,167,64,136,121,159,34,46,167,176,179,73,169,135,15,160,206,251,6,11,28,115,162,27,96,157,122,74,1,90,80,203,12,25,211,16,54,88,113,242,9,91,7,72,254,19,177,239,113,22,107,48,182,13,122,245,234,83,58,24,167,64,60,132,212,115,73,182,125,219,241,120,166,135,88,216,129,234,43,249,115,35,45,38,103,199,179,200,221,120,53,46,190,230,97,90,192,126,201,180,242,167,30,190,164,231,48,210,5,3,127,243,116,59,133,247,225,175,81,163,116,202,250,247,179,160,81,72,199,71,171,12,217,245,48,173,79,200,84,57,180,2,24,24,60,119,172,49,54,91,228,216,34,186,17,39,9,82,35,176,169,132,244,10,49,6,155,158,240,162,176,191,64,143,11,78,189,125,186,51,247,177,78,24,147,111,31,231,204,126,215,60,208,229,148,240,62,90,164,219,104,106,4,244,216,5,171,89,101,69,123,179,130,159,41,247,37,196,140,132,215,32,11,10,228,64,35,179,176,4,10,163,102,15,136,154,73,22,110,170,204,240,38,70,142,13,90,160,198,203,168,87,170,246,4,174,62,226,38,105,4,106,62,204,225,217,79,104,1,11,80,48,117,80,134,220,150,227,35,200,49,147,83,193,72,241,55,153,232,251,56,163,78,32,151,217,22,31,139,219,110,17,18,228,86,149,25,98,234,63,252,161,195,201,136,184,127,67,110,126,223,221,30,76,153,60,214,143,207,208,188,33,72,64,179,206,247,40,172,0,21,156,82,222,76,79,104,175,72,16,81,8,12,86,63,58,28,48,173,99,145,66,100,84,164,206,159,144,133,218,4,139,213,121,87,85,172,46,250,249,241,161,37,192,77,41,31,41,42,202,118,169,32,3,222,184,27,5,25,5,153,192,52,43,187,202,49,143,246,125,187,179,220,68,73,27,8,115,245,63,110,137,134,160,120,237,110,127,115,147,68,173,230,135,209,241,22,35,236,53,70,192,124,216,155,197,201,128,102,3,140,8,54,28,7,223,167,253,132,49,26,225,125,184,19,128,215,15,217,107,112,91,218,48,189,137,114,188,241,137,224,129,23,128,126,219,1,147,130,107,128,159,199,82,2,222,194,6,150,12,167,106,192,203,207,78,87,209,41,201,119,119,246,107,182,81,126,27,65,106,103,17,82,217,164,21,133,141,147,79,104,26,82,234,2,190,194,139,214,205,21,85,167,210,178,52,234,230,17,74,48,231,235,82,101,244,78,227,22,193,85,253,245,36,138,234,127,245,33,2,52,200,89,26,61,64,226,104,44,129,255,250,253,27,68,94,244,224,37,183,229,18,199,192,213,214,215,188,62,80,64,190,172,213,238,72,10,89,10,148,222,14,169,124,19,175,15,94,190,41,218,238,80,0,218,152,84,18,146,99,255,31,124,131,83,8,199,139,128,24,74,178,41,213,57,45,2,120,10,196,247,73,180,128,148,251,136,147,71,128,144,103,25,186,181,201,238,133,1,121,166,202,85,68,101,127,184,93,136,162,90,16,243,129,110,109,63,156,157,157,245,6,110,90,49,198,70,113,114,140,253,175,34,193,25,159,236,190,10,84,177,207,80,93,41,33,153,65,156,240,7,45,184,1,55,2,231,191,54,1,242,135,81,92,117,38,8,20,173,124,12,54,143,112,65,138,57,116,132,98,77,47,23,3,228,248,40,207,41,162,25,198,221,133,189,202,179,95,241,225,118,48,212,224,176,195,225,11,60,110,71,43,2,206,184,103,171,86,101,52,240,28,8,150,250,201,203,209,246,197,93,57,171,61,250,123,86,123,36,12,179,218,223,36,243,198,223,172,146,137,246,212,74,222,69,40,22,0,163,17,61,98,167,14,214,49,15,214,125,15,0,251,169,143,181,241,239,71,9,52,10,200,53,210,11,217,73,153,118,97,160,71,47,167,250,192,139,57,179,15,188,160,51,251,192,139,58,179,15,188,176,51,251,192,139,59,222,7,51,155,81,57,203,157,92,116,227,221,145,197,109,124,188,51,250,220,67,125,240,33,76,110,163,85,30,210,161,40,114,135,118,171,167,197,109,188,233,236,64,173,81,151,29,73,24,90,238,151,239,126,168,90,15,246,1,6,219,45,248,65,132,17,121,90,101,124,19,55,123,33,157,76,97,117,249,9,46,208,181,73,127,28,92,150,241,54,106,207,88,212,39,25,226,136,14,63,235,231,219,62,240,160,
-152,88,93,125,117,131,72,181,24,68,194,149,217,161,5,14,205,16,158,101,103,128,9,189,201,81,169,172,10,124,201,206,120,16,92,221,32,191,54,40,246,40,134,132,61,116,44,150,245,101,207,224,227,213,155,211,52,78,206,190,9,104,76,81,185,190,235,131,122,172,142,127,224,207,29,84,240,52,32,101,34,235,156,59,133,241,81,4,244,8,42,190,1,139,215,228,121,240,151,23,193,99,240,151,96,117,182,70,62,113,199,70,162,232,231,159,200,243,234,1,186,199,127,124,75,123,9,223,118,248,161,106,6,43,210,66,251,43,228,149,155,133,170,236,51,90,175,2,14,236,116,14,252,144,214,96,236,240,185,63,154,31,241,145,67,122,216,96,18,69,199,78,127,34,223,145,243,132,113,186,219,35,79,26,95,14,193,71,25,241,23,253,251,147,59,86,162,154,97,98,209,136,240,240,112,45,118,119,79,5,78,150,192,207,236,212,12,230,140,254,178,211,78,80,92,210,227,224,199,135,3,213,33,214,51,212,242,89,144,173,215,251,156,108,57,157,245,98,215,100,184,166,40,220,126,168,221,192,59,68,140,250,239,36,134,193,225,59,242,95,180,86,49,237,102,246,85,1,233,252,156,222,166,128,47,112,134,184,21,218,2,155,41,146,93,233,157,57,137,11,114,139,46,197,73,226,43,188,68,113,81,71,103,167,208,71,180,33,158,101,182,47,185,191,18,6,139,211,227,163,166,255,174,222,104,20,39,30,1,90,240,32,29,31,81,151,47,169,16,18,167,210,17,61,129,92,212,5,92,72,97,36,49,40,159,29,112,223,125,148,60,29,31,221,197,248,138,114,84,158,84,119,130,43,236,56,239,13,135,106,32,121,90,155,228,118,104,162,67,208,64,199,71,8,28,30,8,206,65,198,201,146,92,230,128,24,54,132,253,150,2,2,104,44,77,49,78,163,6,139,232,230,166,30,30,18,255,72,125,29,253,177,57,200,121,66,58,134,197,172,112,45,105,141,25,215,247,86,183,59,178,201,135,30,255,128,100,249,168,154,121,76,225,4,7,54,5,167,16,206,220,65,94,125,25,236,211,4,184,1,193,126,129,161,2,110,252,215,241,81,18,191,192,12,6,255,194,232,47,158,163,174,95,34,222,192,247,34,186,123,56,237,93,233,155,166,47,160,100,213,25,166,125,18,67,111,4,4,34,0,190,184,141,186,134,35,53,208,251,57,98,161,15,89,25,181,119,188,91,158,41,246,49,217,233,128,67,77,228,188,13,225,133,58,35,143,15,138,162,57,67,108,69,52,123,39,107,212,203,173,178,100,170,99,74,181,10,216,197,164,128,85,236,141,79,13,137,50,121,45,120,228,180,108,231,73,90,112,26,197,210,116,65,6,59,62,234,208,17,148,28,57,78,79,131,224,200,50,117,234,169,125,14,238,37,178,196,186,18,23,24,122,92,11,28,31,85,106,32,80,211,2,80,53,128,214,76,178,90,0,46,252,183,106,32,144,214,2,149,196,53,106,32,144,211,2,199,71,67,53,16,72,106,129,227,163,190,26,8,100,180,0,18,249,129,26,8,36,180,0,93,50,225,134,161,82,12,107,129,24,77,128,41,240,168,151,50,100,75,125,99,183,17,130,29,189,163,220,23,101,170,143,25,6,51,91,69,79,181,191,155,224,156,101,93,241,230,227,167,224,167,151,239,92,90,81,88,61,130,169,184,139,119,193,93,150,108,10,57,3,40,72,243,162,127,96,83,118,1,12,40,212,225,194,4,244,186,8,42,89,138,244,221,195,161,180,146,61,240,5,238,153,81,36,171,72,205,244,78,226,211,31,134,246,144,52,97,174,33,92,10,105,117,74,199,104,35,76,125,70,170,54,164,137,45,46,176,106,24,201,170,194,248,168,147,243,115,214,65,195,218,221,175,211,104,20,9,218,211,42,103,237,81,176,175,13,153,1,92,69,62,208,105,139,234,94,211,9,117,92,49,218,244,90,226,253,115,82,189,160,88,71,41,190,211,22,215,197,104,240,156,2,216,170,33,122,30,177,204,17,106,5,38,31,144,146,121,98,128,117,155,234,43,170,9,117,58,64,138,112,139,238,115,212,62,192,128,140,23,202,100,196,36,171,118,19,145,146,111,73,3,214,23,50,13,5,226,205,7,138,147,97,187,48,143,234,67,7,255,255,93,132,241,5,249,86,121,65,150,212,106,180,139,208,82,107,100,53,150,212,98,182,89,35,250,0,233,255,103,214,43,235,228,54,84,84,207,197,191,84,143,32,21,197,
-245,208,197,191,244,144,219,21,25,95,157,127,41,37,139,139,119,59,91,67,125,251,47,13,165,66,82,113,117,245,237,191,212,149,71,203,51,190,84,255,210,93,243,87,178,89,74,114,200,127,36,21,192,139,251,73,67,118,200,95,221,28,168,179,46,121,182,237,167,57,233,20,192,84,236,173,63,173,121,124,68,133,237,226,105,77,204,54,136,43,32,71,11,115,69,43,39,185,17,241,149,149,224,37,248,234,19,105,205,225,172,130,150,56,214,50,141,175,204,185,234,202,8,173,201,100,62,228,248,72,133,178,65,67,88,146,244,150,201,127,208,27,142,121,86,20,59,188,127,94,210,251,159,237,229,228,206,14,232,5,82,50,71,71,11,234,224,225,50,231,40,32,186,103,134,201,184,168,107,18,84,123,179,213,149,228,37,201,39,23,248,122,62,117,203,233,20,245,143,184,41,32,11,241,12,128,62,195,42,227,25,70,248,172,155,39,130,243,149,121,117,228,9,17,151,60,14,173,233,22,120,220,232,55,184,102,7,4,234,228,106,254,153,197,233,162,123,15,59,239,124,42,104,18,20,20,13,150,105,156,92,147,172,116,129,245,120,132,230,130,62,87,39,221,22,212,147,28,194,193,216,45,189,254,3,125,234,212,121,67,83,113,137,174,30,191,69,248,14,54,183,225,43,214,37,223,14,85,17,143,70,185,75,240,13,128,30,122,252,189,216,28,138,104,27,187,156,66,61,62,173,179,182,177,24,118,156,128,158,1,62,219,225,147,127,179,231,208,224,232,20,230,41,195,241,89,52,231,231,97,151,197,246,18,92,34,237,241,127,5,255,241,241,234,195,245,135,183,193,139,23,193,233,183,199,71,139,252,124,153,95,32,227,242,130,38,237,50,71,131,163,33,151,167,223,246,201,213,140,5,253,85,7,115,170,78,46,143,225,178,80,61,181,206,9,185,116,51,99,182,235,243,106,115,98,125,81,253,81,109,1,87,59,192,210,139,87,227,105,215,238,85,173,49,191,163,246,234,18,172,107,171,13,58,112,176,242,224,52,88,159,7,127,249,249,197,47,232,71,252,159,60,248,99,176,190,232,22,120,77,111,35,214,108,187,247,2,242,11,193,217,207,156,107,3,135,178,95,120,199,154,51,219,243,63,229,23,212,140,123,179,237,204,116,19,223,220,32,59,149,174,35,35,108,204,246,119,218,65,169,219,0,205,119,96,111,235,101,155,82,37,205,233,121,139,232,155,49,25,167,245,171,35,19,99,240,131,69,124,134,60,203,187,48,185,193,39,166,145,218,60,133,117,196,229,159,218,90,128,224,109,211,231,158,127,129,147,206,248,28,125,88,172,73,100,182,193,254,201,186,28,59,56,65,250,97,93,239,39,254,252,7,106,163,239,213,55,151,163,227,119,182,27,141,131,97,214,234,248,34,3,241,214,127,188,227,168,4,84,131,163,245,213,141,204,234,98,91,3,63,118,173,235,132,151,61,196,207,210,129,10,41,58,80,70,80,230,13,14,188,224,216,234,38,120,202,246,48,230,89,240,177,46,237,183,60,62,170,10,88,68,65,148,102,251,219,187,230,208,52,92,197,93,227,247,126,84,199,92,224,64,102,122,28,28,53,55,226,131,5,28,34,137,211,251,44,185,175,223,32,2,165,61,78,186,91,213,112,79,130,121,82,119,25,60,81,245,218,88,89,81,104,122,205,56,183,75,210,5,248,2,70,115,219,11,135,158,112,43,236,49,40,225,4,237,19,20,161,103,190,219,133,131,8,175,255,211,200,181,158,26,209,8,26,114,135,167,185,179,82,182,71,136,107,84,34,72,240,37,149,167,145,107,84,13,109,58,101,4,13,161,17,166,203,53,156,208,215,135,102,191,18,6,52,56,251,87,181,229,34,130,152,188,57,38,34,131,142,190,28,112,123,155,119,94,94,177,239,222,54,198,71,174,233,75,11,248,224,51,122,232,186,83,137,136,66,85,215,148,105,10,201,176,138,200,196,105,123,46,186,51,118,231,122,60,34,84,124,155,102,121,116,141,252,149,162,46,141,197,68,147,210,231,65,40,52,195,193,107,128,201,83,131,162,26,165,56,62,58,194,132,195,100,76,225,14,27,100,110,144,131,70,195,120,241,226,235,231,31,223,14,128,95,167,25,252,220,189,222,127,241,11,23,111,166,4,25,39,171,40,204,77,21,197,14,228,222,153,246,254,146,194,69,143,77,183,58,26,11,227,235,15,111,44,45,114,7,142,240,154,3,62,95,151,189,55,167,177,25,24,103,132,78,190,
-49,204,55,113,26,38,80,60,170,139,152,69,101,244,48,123,245,219,94,232,157,12,122,47,111,48,242,54,78,251,103,188,240,127,233,1,209,51,232,59,230,144,73,246,0,117,199,233,147,144,121,128,47,212,208,87,161,195,199,233,49,194,71,222,24,112,204,148,63,72,237,145,133,247,183,193,98,64,58,186,100,237,235,247,111,224,157,100,232,193,126,253,14,92,113,224,30,103,86,33,227,74,17,172,159,24,46,202,77,116,63,40,79,75,143,2,22,2,30,98,141,1,183,108,54,104,145,2,244,123,220,220,108,31,14,217,25,109,39,52,220,78,199,120,248,189,110,105,215,44,178,70,172,159,99,141,89,255,38,54,210,78,116,168,157,252,88,189,91,232,120,87,44,222,32,86,188,239,58,190,157,123,157,31,175,222,252,55,185,172,217,9,167,235,171,116,48,42,122,164,186,112,22,230,56,21,178,173,234,57,86,59,125,20,2,129,241,233,219,195,238,177,36,189,75,215,12,68,184,62,1,21,138,100,105,145,37,100,195,137,15,169,15,224,46,44,184,235,65,223,179,130,1,169,103,135,250,161,170,104,84,109,121,226,97,201,13,191,254,136,183,81,201,31,113,224,231,193,184,84,11,182,159,71,141,73,42,166,180,35,55,197,147,200,37,79,62,193,169,237,108,166,255,11,64,134,40,218,130,34,20,136,206,37,211,218,145,196,187,204,253,59,166,253,109,192,5,185,18,74,25,251,232,17,234,209,208,223,220,161,169,101,212,45,212,6,225,15,159,63,225,230,231,151,99,131,44,59,59,194,90,6,188,184,156,61,171,97,167,223,234,157,197,112,128,127,191,164,163,16,214,24,183,58,41,85,143,113,49,57,44,221,163,17,8,223,202,204,124,25,209,189,211,183,159,117,193,249,119,85,138,152,135,246,63,180,243,8,115,152,255,105,148,39,152,67,254,217,26,15,48,135,255,95,78,214,156,9,229,127,247,149,242,38,75,35,43,138,121,56,144,5,229,172,56,187,105,5,173,97,54,66,74,154,49,142,45,69,61,62,69,107,202,122,156,2,78,20,182,56,101,156,40,109,13,60,35,170,184,53,243,136,168,242,54,200,19,162,10,220,18,15,112,149,248,160,174,75,55,117,91,236,183,116,249,30,22,158,74,31,30,31,29,181,37,105,218,24,248,135,31,62,163,62,190,189,238,188,42,236,7,24,189,58,166,8,67,192,38,5,234,254,155,121,3,195,115,195,129,87,116,252,41,52,240,74,120,236,101,241,107,188,107,82,138,203,112,149,229,229,117,150,94,227,58,197,244,94,40,3,26,140,194,6,7,184,96,25,224,69,91,51,160,209,187,244,243,96,226,23,67,76,67,237,237,220,21,120,235,174,87,149,101,51,123,81,161,147,177,85,173,78,39,178,87,86,28,193,44,154,193,48,108,136,53,58,222,250,202,0,212,180,192,48,36,127,133,7,128,39,87,89,65,114,161,170,215,80,114,209,183,238,37,151,1,13,75,46,19,156,59,201,229,192,196,235,58,13,213,136,228,14,32,17,201,229,175,170,109,201,101,209,12,75,46,19,162,99,201,229,129,229,175,176,21,201,133,90,122,67,201,237,236,189,187,146,92,6,52,44,185,76,112,238,36,151,3,19,175,235,52,84,35,146,59,128,68,36,151,191,170,182,37,151,69,51,44,185,76,136,142,37,151,7,150,191,194,86,36,23,66,135,161,228,118,78,133,184,146,92,6,52,44,185,76,112,238,36,151,3,19,175,235,52,84,35,146,59,128,68,36,151,191,170,182,37,151,69,51,44,185,76,136,142,37,151,7,150,191,194,179,36,23,76,188,193,0,27,117,63,115,96,69,55,125,48,240,74,120,108,167,110,250,20,52,191,221,116,229,69,149,112,211,135,43,43,142,192,3,55,221,210,2,27,116,211,69,23,89,209,77,183,33,185,38,220,116,3,11,107,209,77,87,94,84,9,55,221,138,228,154,115,211,45,45,176,65,55,93,116,145,21,221,116,27,146,107,194,77,55,176,176,22,221,116,229,69,149,112,211,173,72,174,57,55,221,210,2,27,116,211,65,81,24,116,211,227,116,238,192,138,198,126,48,240,74,120,108,167,198,126,10,154,223,198,94,121,81,37,140,253,112,101,197,17,120,96,236,45,45,176,65,99,47,186,200,138,198,222,134,228,154,48,246,6,22,214,162,177,87,94,84,9,99,111,69,114,205,25,123,75,11,108,208,216,195,112,6,141,61,234,126,230,192,138,42,99,48,240,74,120,108,167,42,
-99,10,154,223,42,67,121,81,37,84,198,112,101,197,17,120,160,50,44,45,176,65,149,1,175,117,19,89,100,120,110,40,185,232,219,113,201,69,15,240,197,99,124,108,97,138,49,160,97,201,101,130,19,148,220,41,104,10,11,203,129,137,215,117,26,170,148,228,42,47,42,145,92,254,170,82,146,59,92,89,113,4,179,104,134,37,151,9,81,70,114,45,45,112,35,185,98,128,77,72,174,162,177,183,33,185,12,104,88,114,153,224,220,73,46,7,38,94,215,105,168,70,36,119,0,137,72,46,127,85,109,75,46,139,102,88,114,153,16,29,75,46,15,44,127,133,103,73,46,12,103,80,114,209,3,124,241,24,31,219,169,228,78,65,243,91,114,149,23,85,66,114,135,43,43,142,192,3,201,181,180,192,186,37,55,188,191,237,28,219,233,214,27,139,24,215,219,7,168,80,23,231,99,107,28,194,59,198,111,35,198,193,38,153,193,235,234,102,152,206,172,27,84,21,148,11,113,40,203,32,76,138,172,122,51,101,17,52,239,203,165,86,184,143,208,12,7,2,5,217,168,107,192,60,14,148,192,167,137,1,1,43,159,1,7,120,5,76,135,86,34,139,112,9,25,242,66,112,6,122,185,68,106,21,36,38,51,119,73,38,103,73,215,171,81,213,20,184,147,81,35,63,172,51,179,40,66,120,97,229,159,224,101,146,171,24,234,232,157,112,14,191,14,16,26,242,4,96,28,142,129,21,131,207,117,23,100,102,160,203,97,128,49,71,92,6,201,25,77,139,123,167,18,209,44,70,218,201,114,210,46,219,237,201,235,13,255,52,205,73,59,91,172,180,19,167,60,99,2,163,188,180,115,193,76,59,57,110,26,155,211,36,55,245,235,76,169,242,83,221,207,24,71,53,53,162,132,53,18,19,157,25,78,170,135,98,227,31,133,206,227,32,89,244,154,120,168,30,150,207,69,98,179,17,230,157,157,46,230,217,137,113,143,168,22,98,227,51,203,62,187,41,138,75,104,32,105,252,154,25,104,39,194,65,179,180,15,229,246,225,179,84,102,99,167,222,105,51,153,193,117,199,78,104,64,57,175,88,211,89,56,99,177,147,129,163,112,246,99,167,217,68,118,29,59,105,93,5,95,99,39,85,77,161,49,118,98,156,72,30,32,60,232,216,201,146,56,187,141,157,102,49,146,166,216,137,195,73,59,91,172,100,35,118,178,201,76,46,99,39,85,126,210,17,59,13,249,136,137,238,96,99,39,75,60,228,46,118,154,203,60,179,98,39,62,247,236,44,178,143,209,216,201,50,3,89,141,157,240,209,84,179,177,83,239,240,174,204,224,186,99,39,252,218,20,25,175,88,211,209,98,99,177,147,129,147,197,246,99,167,217,68,118,29,59,105,93,5,95,99,39,85,77,161,49,118,98,92,240,24,32,60,232,216,201,146,56,187,141,157,102,49,146,166,216,137,195,73,59,91,172,100,35,118,178,201,76,46,99,39,85,126,210,17,59,13,249,136,137,238,96,99,39,75,60,228,46,118,154,203,60,179,98,39,62,247,236,44,178,143,209,216,201,50,3,89,141,157,240,29,29,179,177,83,239,22,147,204,224,186,99,39,242,242,83,9,175,88,211,29,43,99,177,147,129,43,86,246,99,167,217,68,118,29,59,105,93,5,95,99,39,85,77,161,49,118,98,220,116,29,32,60,232,216,201,146,56,187,141,157,102,49,146,166,216,137,195,73,59,91,172,100,35,118,178,201,76,46,99,39,85,126,210,17,59,13,249,136,137,238,96,99,39,75,60,228,46,118,154,203,60,179,98,39,62,247,236,44,178,143,209,216,201,50,3,89,141,157,240,93,75,179,177,83,239,54,170,204,224,186,99,39,52,160,156,87,108,240,174,172,150,216,201,210,85,89,179,177,211,108,34,187,142,157,180,174,130,175,177,147,170,166,208,24,59,49,42,22,12,16,30,116,236,100,171,180,129,211,216,105,22,35,105,138,157,56,156,180,179,197,74,54,98,39,155,204,228,50,118,82,229,39,29,177,211,144,143,152,232,14,54,118,178,196,67,238,98,167,185,204,51,43,118,226,115,207,206,34,251,24,141,157,44,51,144,213,216,9,187,104,102,99,167,94,61,16,153,193,117,199,78,232,33,57,175,216,96,181,18,45,177,147,165,98,37,102,99,167,217,68,118,29,59,105,93,5,95,99,39,85,77,161,49,118,98,212,140,26,32,60,232,216,201,86,113,41,167,177,211,44,70,210,20,59,113,56,105,103,139,149,108,196,78,54,
-153,201,101,236,164,202,79,58,98,167,33,31,49,209,29,108,236,100,137,135,220,197,78,115,153,103,86,236,196,231,158,157,69,246,49,26,59,89,102,32,243,177,211,54,78,235,185,85,115,224,204,238,162,230,29,242,88,7,49,234,228,91,186,207,240,177,215,39,151,35,47,168,34,141,172,142,195,199,111,187,43,34,129,183,187,2,53,185,225,185,62,185,81,167,67,2,163,47,227,237,72,17,77,41,36,60,190,152,64,5,11,39,128,76,36,64,25,46,138,14,194,133,143,12,120,225,227,56,225,100,144,40,17,46,124,228,16,174,143,76,136,112,115,57,142,193,215,164,219,235,251,48,113,204,119,92,108,88,241,136,225,179,194,125,28,160,225,35,7,164,77,30,228,98,27,33,162,52,39,226,104,86,92,173,46,145,90,141,111,211,44,143,250,104,7,239,58,192,61,127,171,62,20,210,224,163,61,3,128,33,5,6,209,57,254,226,58,205,128,188,194,38,105,106,232,12,6,239,46,61,107,118,146,204,200,122,93,4,238,150,51,77,46,27,74,98,153,98,68,46,46,182,58,236,97,227,178,96,107,216,163,13,242,57,132,23,135,47,30,164,163,111,25,114,129,127,232,210,43,78,147,56,141,130,155,125,186,198,225,22,11,5,26,11,255,113,121,124,180,74,131,239,94,96,25,175,158,91,6,101,190,143,78,208,79,36,51,20,132,201,109,180,202,195,179,155,168,92,223,45,86,233,50,120,254,127,63,71,191,71,144,206,69,35,159,145,150,61,141,193,154,187,168,58,32,141,219,233,190,103,76,115,106,44,61,10,179,7,100,140,238,51,0,41,106,76,60,10,199,116,247,0,246,152,117,200,171,191,237,195,180,140,147,72,24,244,111,173,59,62,2,179,238,150,193,187,245,79,227,220,203,193,213,29,125,192,203,109,171,101,240,155,60,67,215,205,187,171,58,13,69,120,245,234,174,90,170,252,157,73,13,185,209,181,176,252,16,218,248,130,105,131,168,38,4,245,152,163,98,208,32,231,73,65,245,191,109,182,217,163,167,182,191,70,79,212,204,242,172,68,15,47,238,191,195,247,150,82,4,169,128,203,104,8,23,188,234,168,198,243,254,63,223,254,63,228,201,22,70,18,221,148,167,228,203,32,196,151,244,130,213,19,233,1,134,221,133,101,25,33,126,188,11,139,59,212,61,154,224,201,160,75,248,173,237,112,29,38,107,8,94,81,119,184,21,10,107,147,125,196,232,11,232,166,218,87,191,171,50,210,213,85,113,167,13,21,44,128,166,174,110,18,109,93,33,30,215,213,21,234,69,27,217,203,124,62,99,173,246,201,175,215,132,151,175,31,179,252,26,247,125,215,147,137,101,64,216,152,39,26,77,203,118,228,93,86,148,223,5,63,127,135,126,121,241,203,226,231,239,200,131,232,207,187,170,223,147,101,240,51,52,249,101,177,58,57,161,53,142,32,162,85,239,29,23,12,223,15,0,174,179,180,40,89,93,82,80,243,232,187,32,184,11,240,224,65,113,151,237,19,244,71,20,20,79,233,26,41,27,100,173,238,162,112,115,28,212,255,147,159,218,4,177,169,179,242,3,146,115,39,6,125,225,201,185,156,216,196,154,177,39,38,184,114,174,23,173,178,26,8,92,207,112,224,201,245,253,110,206,28,194,82,84,32,251,214,106,149,100,43,244,117,88,102,219,250,239,26,64,137,230,146,47,78,208,172,234,177,94,189,251,248,10,127,123,217,60,116,147,103,91,242,24,253,80,245,109,251,216,122,187,195,61,117,251,66,223,94,118,231,123,210,127,4,190,109,159,73,247,73,50,124,6,190,109,159,201,209,130,12,159,129,111,219,103,30,242,24,217,228,254,212,240,183,237,67,187,125,201,192,140,190,109,31,217,68,9,227,17,244,109,251,72,18,165,183,37,158,24,253,8,249,150,154,124,20,238,24,147,71,223,210,236,143,214,103,129,188,26,244,159,19,252,239,49,253,48,124,113,141,191,109,216,224,67,150,237,144,3,178,47,145,83,124,246,205,176,39,172,218,217,29,53,43,120,124,220,227,136,56,189,5,187,14,32,2,232,225,184,191,240,93,12,183,81,25,148,119,136,209,158,32,202,133,223,241,232,65,88,32,222,36,221,33,23,59,78,146,227,35,120,236,38,206,139,50,120,142,31,15,178,28,55,5,207,58,187,33,189,160,166,223,92,242,0,45,145,147,180,137,30,65,254,3,14,184,120,243,40,135,237,248,8,118,33,115,68,194,219,32,44,9,174,103,
-120,152,103,24,118,208,160,62,62,26,133,125,214,193,141,87,128,24,215,96,184,4,228,247,22,104,81,102,121,212,96,34,248,250,125,166,136,121,183,5,104,12,204,31,240,214,236,142,144,224,159,219,46,131,122,242,233,126,187,138,114,64,74,200,16,167,232,235,184,104,250,39,186,161,248,45,129,47,190,155,212,17,95,254,254,78,72,77,84,207,181,124,214,132,2,100,36,96,79,242,215,73,253,135,50,187,83,93,2,199,179,186,171,190,163,248,190,171,32,219,23,98,69,201,126,3,186,227,187,123,20,109,116,250,168,126,67,79,99,218,53,143,182,157,129,94,238,139,225,138,18,232,128,57,195,75,174,220,6,124,185,237,207,125,53,32,231,212,96,108,170,5,227,84,235,90,151,222,202,34,6,168,59,163,68,243,203,215,207,152,91,248,11,73,117,0,194,142,251,88,102,55,55,69,84,86,177,84,175,191,175,97,76,229,129,63,147,192,29,152,157,28,245,248,153,180,61,59,75,127,65,226,141,56,191,145,172,226,231,231,240,173,192,160,75,156,208,35,145,68,111,244,47,251,213,23,220,104,0,1,31,121,168,6,170,49,144,255,254,17,119,247,11,11,12,133,229,143,139,32,193,56,130,188,82,29,189,161,95,103,233,58,164,50,163,228,115,148,130,43,80,62,100,85,207,69,71,58,42,11,21,224,25,130,222,164,85,7,234,243,29,254,157,73,78,210,148,6,221,233,57,197,26,133,223,243,43,248,153,217,113,69,129,170,127,164,146,112,79,157,206,247,105,188,206,54,209,203,178,90,154,86,247,15,7,250,175,215,119,249,203,178,171,248,195,186,135,96,125,23,230,225,26,185,206,199,71,11,80,173,56,214,62,33,246,160,89,12,228,217,197,144,83,162,89,163,234,96,241,0,61,176,57,241,175,168,19,24,157,242,205,178,244,62,202,233,241,203,12,125,104,64,116,53,23,152,158,226,191,98,180,62,100,150,72,169,220,196,143,149,6,136,59,147,252,132,127,106,7,34,159,81,199,209,250,87,26,53,178,75,164,199,160,34,92,177,191,169,250,132,53,234,245,250,5,255,216,246,74,62,183,189,82,166,224,93,246,16,229,212,106,247,72,129,127,238,176,102,69,135,138,194,136,12,9,60,130,180,100,17,117,173,229,143,187,221,88,207,248,231,241,158,247,240,72,211,115,75,223,40,204,215,45,37,214,28,70,69,223,126,193,79,82,116,192,159,131,27,100,236,195,86,174,207,2,194,196,5,210,43,53,199,44,131,211,243,32,190,9,210,172,68,143,239,211,13,61,183,252,90,16,194,231,8,205,169,136,190,12,145,84,191,84,115,81,70,212,210,100,151,196,229,14,241,93,131,41,141,162,77,18,145,191,111,226,40,217,176,60,44,32,83,221,146,34,19,124,85,175,3,28,91,137,146,120,27,3,155,83,184,110,227,251,40,37,61,7,11,172,8,225,105,44,127,25,178,0,157,24,16,245,180,229,115,2,232,221,29,53,58,124,12,30,238,208,128,197,46,92,35,239,38,204,97,190,29,117,213,232,193,241,174,223,193,207,99,93,99,188,88,96,251,10,177,89,236,241,17,62,11,141,80,185,149,76,133,75,245,143,196,250,98,140,72,23,52,3,109,179,251,136,40,244,44,189,141,138,102,193,144,174,66,22,51,37,107,151,60,181,74,170,194,130,85,117,132,158,218,52,174,41,161,111,235,202,143,211,121,4,37,166,183,33,148,237,215,245,114,141,1,206,197,0,127,182,1,152,10,42,250,112,91,2,239,80,4,92,195,69,38,148,35,173,239,208,99,45,218,191,66,44,179,223,117,148,38,140,66,100,179,50,196,200,250,236,16,2,252,51,250,173,229,205,174,249,106,8,39,6,228,179,60,144,112,39,130,99,148,34,99,172,135,30,191,24,34,234,19,125,138,68,212,178,86,75,214,89,212,41,74,141,177,218,12,128,45,233,4,240,117,79,8,199,229,190,140,42,71,164,200,177,165,90,110,138,18,255,23,77,187,218,111,25,122,195,85,75,218,137,168,191,171,240,102,235,245,62,207,35,56,98,135,160,60,67,157,63,67,46,223,241,209,51,212,253,179,179,32,184,186,185,9,128,176,200,143,221,4,47,240,150,28,137,82,227,2,54,230,170,31,16,31,160,160,131,180,94,35,55,110,21,17,243,70,98,218,8,158,44,246,73,35,51,193,85,138,98,245,13,242,11,16,157,208,186,33,34,149,240,12,130,82,192,238,33,201,38,81,45,48,157,246,41,177,
-96,155,227,163,34,254,61,90,86,184,128,160,8,15,150,231,13,178,90,200,190,222,4,8,9,70,8,134,150,178,201,208,13,154,88,135,192,97,177,142,227,58,60,234,217,126,252,219,192,79,174,221,71,212,25,36,33,225,191,164,251,193,186,81,1,12,209,120,204,176,165,121,180,27,61,189,125,44,129,75,218,240,137,50,62,98,35,53,28,205,31,114,56,28,77,174,202,178,230,157,76,12,254,123,137,221,157,138,179,209,127,186,239,174,6,255,183,66,147,48,199,223,245,92,102,122,174,228,55,50,91,90,128,232,208,16,251,194,163,35,20,61,247,153,30,129,252,198,28,161,23,125,194,86,160,192,68,250,65,107,30,223,222,149,2,240,104,77,153,65,188,184,40,206,137,144,95,48,249,145,60,212,78,234,29,254,76,25,212,218,209,228,241,10,107,148,37,197,153,204,241,46,102,12,24,167,5,138,8,106,213,213,48,38,38,74,51,203,30,109,72,155,118,208,43,252,185,181,75,168,41,10,220,144,104,223,69,57,61,22,210,7,9,50,69,117,192,22,150,29,82,246,6,169,30,86,26,5,105,157,69,69,187,53,115,117,201,51,29,215,30,128,113,88,1,126,163,158,37,92,197,76,118,161,150,159,154,92,23,245,124,180,139,147,236,118,207,108,240,182,250,13,181,64,159,206,232,222,47,143,142,5,255,135,83,145,120,243,29,166,64,229,225,49,55,125,7,255,57,193,255,182,219,35,95,175,222,191,133,111,174,55,29,150,229,230,10,155,76,101,211,5,110,61,200,171,85,153,207,238,83,85,214,179,221,138,123,241,2,246,117,225,82,224,67,133,142,14,175,95,191,127,115,31,230,111,255,78,169,135,223,246,33,10,152,158,176,65,126,200,112,175,5,181,39,251,7,129,254,62,188,21,239,239,47,211,221,189,251,42,209,157,0,188,119,18,240,190,159,238,238,7,9,120,223,11,192,251,65,2,94,92,192,241,201,123,110,95,87,95,62,92,189,163,120,14,25,207,18,194,0,176,89,152,139,155,109,185,250,236,72,25,111,163,182,127,72,23,159,233,102,33,220,169,110,62,194,157,106,102,38,210,167,102,142,194,157,106,102,43,210,167,38,222,226,42,189,39,224,141,158,222,99,41,43,252,220,117,249,187,136,202,170,158,229,104,45,252,43,158,14,254,75,158,241,112,51,134,250,18,232,120,156,249,6,29,255,69,180,223,113,6,28,246,43,12,248,157,28,224,239,69,251,253,65,14,240,247,194,128,127,144,3,220,234,58,110,143,227,234,142,240,175,132,198,211,207,126,180,234,211,207,131,148,14,212,207,136,180,50,212,207,141,148,86,212,207,146,180,122,212,199,151,19,78,34,126,172,12,183,59,124,152,108,76,99,54,79,94,15,247,162,251,26,179,125,182,214,153,251,180,8,111,162,128,218,17,122,188,142,118,217,250,110,113,242,93,243,116,215,27,109,159,105,39,250,21,69,50,63,162,239,3,252,61,30,39,88,60,127,254,29,254,127,240,227,215,215,144,59,255,143,48,221,135,249,83,112,190,12,206,255,247,159,159,67,90,188,55,252,196,200,36,199,82,94,183,63,55,0,0,212,41,25,22,119,114,130,162,211,221,46,67,113,82,149,20,66,78,124,12,233,153,178,131,148,246,156,201,224,101,59,120,55,142,195,8,240,51,23,49,125,121,67,120,100,238,128,56,154,225,76,153,49,213,122,3,142,209,123,21,109,181,235,76,111,155,85,163,225,163,149,83,163,37,116,74,163,30,112,27,39,73,44,58,108,207,26,55,63,33,225,161,8,44,167,18,155,134,3,155,44,220,253,152,78,100,118,255,23,153,222,199,148,34,187,119,41,240,239,100,193,127,47,211,251,15,178,224,191,151,2,255,131,44,248,218,98,143,246,58,102,179,91,29,42,108,181,205,177,105,107,187,205,241,106,99,193,205,49,108,107,199,205,113,109,99,205,205,177,110,107,211,245,243,175,244,255,26,131,255,59,228,221,39,237,61,60,53,29,28,145,199,122,199,216,224,145,223,191,171,135,234,166,208,136,1,96,181,106,102,87,167,247,167,172,7,3,93,219,69,180,46,100,45,222,143,101,140,169,221,220,139,66,214,102,157,71,228,124,112,43,229,213,129,151,246,64,224,148,229,199,132,255,61,7,141,48,21,151,194,67,211,68,199,79,245,168,183,137,110,226,52,90,108,113,170,22,159,60,64,156,6,255,222,225,127,183,113,181,181,128,113,116,73,1,223,188,137,110,158,211,217,213,
-50,71,42,108,141,15,83,62,165,217,246,137,226,28,120,156,222,148,235,141,12,121,86,201,145,207,117,143,44,48,230,133,228,152,157,35,232,68,175,119,181,60,157,100,189,46,246,171,107,196,22,215,8,68,148,35,179,128,28,34,156,244,168,120,146,147,123,237,183,186,126,200,195,93,103,59,144,236,138,212,12,87,113,226,134,220,18,27,0,216,178,16,108,11,226,154,141,64,232,180,187,70,79,99,28,148,71,137,159,68,109,21,166,216,111,213,155,226,203,205,166,153,29,246,245,88,115,131,62,84,230,54,104,199,154,91,171,93,88,36,108,213,120,61,214,164,146,26,163,232,112,80,214,220,20,6,69,95,243,231,148,165,229,29,187,127,65,149,201,232,134,199,170,248,169,134,83,59,158,187,2,58,9,138,119,209,213,36,159,139,16,47,207,124,250,13,187,97,200,65,5,108,24,242,40,192,18,230,154,105,194,201,65,235,6,186,83,8,46,154,191,122,125,113,244,25,201,147,180,98,143,63,15,251,102,200,160,152,102,133,198,223,116,197,148,163,125,68,145,12,117,208,132,2,172,32,180,26,48,190,185,89,160,118,231,205,160,16,118,92,52,169,162,222,173,64,162,252,72,2,27,154,182,35,213,37,41,187,151,27,0,91,176,138,202,135,40,74,131,103,48,206,51,124,192,3,254,188,120,214,217,2,108,117,106,159,243,196,236,0,97,34,62,99,109,122,151,159,91,251,164,48,30,92,229,239,141,199,209,0,245,176,199,157,59,61,120,235,116,116,231,244,162,187,115,122,27,165,81,94,239,190,163,8,147,101,201,22,120,251,151,213,33,106,32,216,95,231,176,64,114,93,251,45,139,147,33,31,116,159,24,222,239,193,191,183,158,79,156,214,156,216,151,108,236,189,227,167,43,241,38,110,126,103,47,155,242,243,139,168,36,79,83,55,117,152,67,94,194,209,36,200,243,20,193,190,136,54,56,186,222,229,49,57,231,218,9,126,56,104,16,247,55,211,99,0,185,29,2,185,157,9,100,192,35,85,236,194,97,195,202,181,31,38,189,168,211,252,68,236,159,118,81,111,243,179,51,204,83,78,142,12,109,51,242,95,36,227,163,252,79,226,24,106,92,252,185,168,248,157,240,254,226,41,10,243,37,150,134,37,234,239,164,39,237,88,137,180,243,99,104,184,90,209,8,207,178,179,221,209,241,236,171,209,218,12,248,216,128,23,213,127,25,237,249,234,24,34,196,182,225,160,101,21,188,144,147,47,85,80,129,41,12,181,225,70,103,207,39,53,158,43,33,245,93,182,207,11,136,83,246,232,167,229,241,81,37,105,75,156,252,172,62,156,4,187,48,15,183,17,28,61,60,251,134,21,229,110,136,234,219,180,22,136,146,199,96,218,224,143,67,165,194,221,5,30,39,104,70,105,198,144,70,40,14,235,26,133,119,225,62,41,133,224,161,17,104,48,193,34,78,25,114,125,50,6,82,2,25,12,218,59,41,51,134,173,222,161,16,69,216,158,94,66,241,101,45,113,156,80,150,33,108,117,202,2,103,28,42,171,198,58,76,11,63,47,42,5,82,101,12,126,173,244,72,205,236,1,119,88,54,235,160,145,222,124,249,74,78,155,253,41,170,148,85,27,67,247,213,54,157,233,225,41,237,193,252,94,243,84,102,213,201,25,195,62,44,40,207,156,55,80,127,70,244,56,112,34,91,100,144,198,207,30,31,228,186,179,241,33,63,16,89,29,164,151,240,234,44,35,248,151,252,45,52,250,166,40,25,11,215,24,126,114,185,11,52,20,246,54,35,124,224,248,248,8,115,210,15,239,191,98,127,16,175,243,89,227,39,213,8,193,130,180,226,52,216,215,194,166,40,34,103,59,175,225,217,22,70,245,109,129,187,32,92,139,121,103,145,102,233,239,81,158,29,31,97,35,209,248,166,167,255,227,127,253,207,63,255,251,249,57,70,243,199,234,67,71,190,235,68,205,89,5,138,20,200,65,125,214,85,67,225,101,231,19,248,174,161,238,193,101,167,130,83,142,164,87,116,138,213,227,140,89,86,191,180,19,101,1,111,71,147,197,94,181,236,195,199,182,93,20,60,126,152,1,29,127,63,14,188,30,71,22,54,241,236,123,160,145,74,18,133,140,30,101,0,70,223,82,12,197,194,75,134,144,69,139,90,245,177,98,179,142,124,135,214,216,49,0,19,55,161,238,5,55,97,160,198,242,87,193,126,234,5,162,13,112,50,94,3,29,63,55,134,158,49,244,128,71,136,79,130,73,
-46,60,137,170,17,139,91,200,47,147,51,105,135,85,155,75,213,190,63,155,202,149,146,155,77,213,136,49,155,78,126,96,100,54,237,176,106,179,169,218,15,102,243,91,114,173,54,163,182,225,200,172,22,184,116,215,13,124,25,103,41,242,74,186,222,232,228,164,59,232,20,39,222,246,49,100,204,22,140,44,119,182,45,153,44,218,254,44,192,167,29,20,170,204,218,118,194,80,119,56,0,161,19,103,1,63,163,68,252,82,74,37,145,84,79,223,117,166,149,97,27,134,180,254,238,17,211,27,101,133,100,116,98,49,184,167,195,13,57,140,114,216,194,160,216,69,235,248,38,94,119,192,117,131,226,62,201,74,1,44,229,56,177,74,37,74,117,177,44,123,84,18,131,37,6,7,178,52,33,10,31,71,137,83,68,229,215,218,117,76,81,252,49,234,116,15,210,67,95,225,160,67,213,13,185,222,196,28,3,92,126,240,44,23,157,16,148,17,62,16,87,180,17,248,178,115,17,186,250,154,4,39,229,93,88,6,27,8,151,144,118,71,214,229,168,185,135,10,65,70,67,136,62,253,35,168,79,47,13,36,162,107,27,142,195,168,110,151,142,130,168,237,89,7,196,64,83,117,33,240,172,40,157,159,173,204,41,96,58,62,194,210,66,146,117,112,233,14,42,100,4,15,136,66,200,75,239,44,14,241,199,202,42,68,96,224,192,33,221,184,227,71,251,125,131,141,88,228,63,137,246,206,242,209,90,23,173,223,51,242,245,127,149,233,189,122,126,56,66,245,3,123,148,118,177,4,41,196,91,168,142,183,211,110,29,247,162,36,212,49,4,23,197,2,135,52,36,67,130,227,158,186,230,37,63,105,142,159,98,39,241,177,118,8,111,32,170,168,79,39,28,31,33,150,193,77,224,149,12,69,17,175,146,167,32,133,178,162,241,125,55,25,210,228,227,59,152,200,87,147,160,250,153,245,9,84,136,83,143,143,170,164,251,52,44,180,104,93,80,240,197,36,36,120,72,142,76,208,98,10,14,189,249,82,182,59,47,35,145,137,200,158,11,198,122,36,186,233,242,148,221,200,68,217,77,131,254,197,216,34,248,16,60,220,161,224,62,216,128,246,0,72,31,144,124,131,240,28,85,247,156,113,40,190,248,103,125,158,182,121,139,217,249,73,79,66,229,32,181,45,134,152,240,61,117,244,123,77,158,202,216,194,195,125,181,96,113,56,76,68,153,49,155,6,236,33,171,19,198,88,237,85,180,198,15,31,145,5,57,127,129,164,3,253,182,12,206,206,150,193,159,95,20,123,248,212,185,6,189,217,116,14,149,225,125,59,146,126,10,132,246,121,217,60,217,186,21,216,230,161,103,144,46,123,134,251,126,118,124,196,16,142,74,144,158,97,249,124,198,22,21,218,93,4,121,161,125,180,193,30,85,11,82,104,183,146,118,236,69,37,168,241,12,24,206,25,125,30,175,135,39,78,139,120,211,203,157,85,181,174,209,170,193,189,83,236,16,220,101,201,166,104,110,210,183,57,53,184,171,186,142,114,40,104,17,236,50,72,243,193,194,67,68,209,125,225,192,118,7,197,3,242,42,179,135,57,145,171,236,170,167,175,73,30,56,203,187,60,94,253,218,42,189,42,21,140,125,26,236,82,147,219,212,208,138,88,169,142,187,128,168,188,192,127,84,37,180,6,12,79,146,53,56,21,222,201,207,214,140,78,252,133,106,177,126,62,63,61,191,248,165,91,44,10,138,138,229,120,47,51,70,74,48,67,172,6,5,0,182,97,185,134,74,162,79,29,3,141,17,33,215,181,130,52,44,34,69,65,42,179,81,64,225,54,234,158,225,107,57,135,160,92,226,3,140,8,215,73,128,239,19,63,196,69,223,219,1,226,64,170,156,67,26,200,12,241,9,211,209,252,48,230,159,107,194,128,135,75,42,31,8,210,5,160,0,85,234,237,63,6,77,0,11,143,34,48,254,4,61,254,204,37,71,239,128,198,83,154,165,79,219,98,17,38,73,246,128,107,92,244,246,219,170,7,168,13,127,120,50,168,191,39,103,169,161,162,64,8,101,154,208,39,52,99,236,42,0,243,254,169,17,196,94,212,145,195,228,218,157,215,101,213,176,90,153,161,204,80,45,24,57,112,42,194,106,118,23,150,193,190,168,75,168,84,113,22,217,18,6,124,139,34,138,208,210,164,240,236,14,231,35,6,71,22,8,241,235,157,176,46,62,198,106,53,45,24,240,250,101,110,72,143,130,240,110,6,240,42,90,180,251,186,3,234,
-177,246,77,219,70,156,77,4,141,4,172,46,94,54,4,172,78,188,140,211,144,106,36,64,67,210,163,14,26,82,135,151,123,16,57,22,185,223,150,67,79,106,51,81,27,81,235,235,89,21,101,41,27,61,77,91,186,173,57,2,211,246,8,28,144,197,134,62,84,76,239,203,23,140,66,245,216,26,64,179,225,33,4,44,227,96,28,145,93,78,75,124,216,136,246,35,190,225,29,6,24,63,131,64,157,97,174,242,73,68,22,112,74,21,54,176,162,13,53,40,35,175,70,77,108,226,180,131,198,145,218,83,83,252,241,190,149,29,175,245,102,250,23,233,36,238,220,93,14,122,193,74,158,117,192,133,126,224,146,57,248,130,51,67,250,153,203,222,46,230,248,13,189,86,14,224,225,203,193,6,161,104,235,234,249,203,65,170,70,172,57,126,186,159,135,17,107,138,158,189,236,237,91,137,54,197,79,243,82,93,2,160,201,243,151,131,77,26,209,14,170,231,47,153,251,34,194,157,180,109,46,217,123,12,226,243,105,27,245,185,136,202,160,12,187,0,8,93,246,33,171,63,217,136,177,236,109,0,56,84,132,208,132,177,220,84,19,230,40,156,101,158,106,198,93,222,169,134,45,9,123,247,117,161,225,130,163,224,123,71,249,64,49,85,142,53,10,113,240,105,86,114,45,7,121,246,167,112,29,248,108,120,182,147,87,191,7,143,177,27,84,240,225,150,239,169,174,238,54,5,124,200,134,209,116,125,235,254,185,193,128,123,110,176,183,199,176,161,14,164,6,236,82,62,151,83,59,36,129,196,14,9,243,128,119,255,178,86,32,127,89,139,125,70,60,152,62,35,46,114,148,43,16,60,202,37,120,139,140,211,29,171,53,197,239,147,104,240,109,188,137,195,150,193,216,97,203,161,153,223,12,14,79,6,114,135,39,187,135,217,131,145,211,147,66,123,151,129,220,222,101,231,165,31,44,137,41,201,110,107,211,81,243,226,15,124,132,67,102,231,175,191,5,75,179,19,117,40,36,232,15,40,122,74,176,234,159,195,95,205,158,177,248,0,188,254,182,109,135,240,246,19,241,14,225,154,7,103,31,154,209,95,189,223,205,63,80,219,67,216,242,5,119,201,88,61,78,242,72,141,121,240,186,150,176,68,3,131,137,60,58,62,106,75,71,198,233,226,145,126,167,29,245,182,235,224,248,136,186,135,91,172,99,56,243,118,141,126,134,55,93,95,67,211,75,118,79,55,73,217,246,4,31,248,61,161,95,235,158,168,190,214,89,161,138,10,53,189,100,247,36,139,138,244,68,245,85,134,202,180,42,195,14,173,168,158,100,81,145,158,218,190,212,73,213,165,148,58,161,250,116,82,103,169,46,71,169,51,84,159,159,212,23,174,187,110,234,203,198,88,181,59,245,101,187,187,100,247,36,191,112,119,253,149,187,83,95,186,187,75,118,79,242,139,119,215,95,189,59,245,229,187,187,100,247,36,191,128,93,84,121,8,111,120,84,149,189,170,245,37,183,63,73,120,109,127,109,143,155,232,54,143,34,85,132,85,235,75,110,127,146,8,219,254,218,30,163,199,157,34,58,212,242,146,217,143,36,42,210,79,219,19,10,83,20,17,161,150,151,204,126,36,17,145,126,58,61,157,63,87,199,116,254,252,146,211,151,60,46,220,23,37,227,191,229,165,170,182,64,77,47,217,61,201,106,11,210,19,165,15,87,202,168,160,233,37,187,39,89,205,186,234,163,138,226,68,21,21,106,122,201,238,73,22,21,233,169,237,235,38,92,169,170,7,104,122,201,238,73,18,85,213,19,213,87,146,101,185,42,44,104,123,201,233,75,22,24,233,235,248,168,174,92,115,131,60,105,26,215,242,137,188,119,149,131,13,125,253,254,227,155,34,190,77,67,32,59,171,23,0,129,122,193,47,130,229,160,234,245,210,117,34,47,36,224,208,211,91,23,196,147,188,0,162,93,114,250,20,0,199,238,243,38,41,153,72,209,88,168,191,118,89,167,144,66,143,208,243,24,82,52,86,221,39,94,222,41,164,221,62,251,72,119,217,195,12,138,162,214,61,148,84,127,10,212,132,254,216,8,85,41,201,67,168,74,197,6,33,51,220,172,18,20,109,57,183,213,57,149,58,88,174,46,24,137,132,85,76,157,19,39,236,79,23,202,170,222,95,240,234,60,248,75,240,234,162,83,43,110,164,115,250,29,223,74,3,245,222,223,93,212,47,240,166,70,167,135,187,175,19,110,50,35,161,129,126,154,234,114,198,68,160,251,233,
-105,84,195,172,148,87,230,39,160,215,84,151,234,211,192,221,243,166,193,100,6,146,67,161,248,161,186,150,160,145,223,56,67,216,228,186,106,196,123,234,6,136,30,222,235,119,108,133,3,201,72,171,57,43,198,230,67,102,199,246,184,177,205,241,53,204,50,76,251,205,231,200,209,97,236,113,37,53,230,125,39,247,173,131,51,217,157,91,224,206,118,172,213,188,21,100,113,232,72,231,198,185,244,133,170,121,126,203,228,148,23,61,238,124,161,195,64,243,135,154,92,186,23,178,38,250,45,139,71,94,116,185,241,197,28,35,205,27,64,96,42,146,102,250,45,139,39,94,116,185,239,197,28,67,205,27,64,142,235,20,76,181,60,239,205,52,214,122,56,80,198,92,75,242,161,170,193,158,201,141,210,38,91,156,39,103,25,109,29,156,169,108,182,101,185,83,139,225,214,193,161,242,166,91,138,75,231,25,239,89,156,170,104,190,69,185,85,131,1,87,230,216,239,21,13,248,15,76,87,239,251,46,151,126,175,193,124,243,7,154,90,186,239,37,141,55,107,36,52,208,79,83,93,206,152,8,116,63,61,13,57,195,253,3,203,153,251,190,195,117,223,207,48,219,188,238,165,56,77,222,104,75,243,219,60,147,173,133,235,36,12,182,28,239,41,154,235,121,28,40,107,172,133,249,112,142,169,214,192,141,170,134,90,146,35,117,152,105,13,92,41,109,164,101,56,115,150,137,158,195,157,106,6,90,144,67,231,155,103,117,46,85,141,175,127,96,58,116,223,247,188,200,239,117,196,215,35,67,77,46,157,108,124,205,26,11,134,250,105,178,211,25,147,193,3,8,76,69,210,76,179,92,182,239,187,222,225,247,115,226,107,238,0,114,92,167,96,170,229,121,111,166,177,214,195,129,50,230,90,146,15,85,13,246,76,110,148,54,217,226,60,57,203,104,235,224,76,101,179,45,203,157,90,12,183,14,14,149,55,221,82,92,58,207,120,207,226,84,69,243,45,202,173,26,12,184,50,199,190,80,181,224,244,11,171,90,150,121,209,227,211,23,58,44,248,200,80,83,203,247,66,214,130,179,198,130,161,126,154,236,116,198,100,240,0,2,83,145,179,224,140,145,126,194,84,155,236,84,125,42,100,0,57,174,147,183,224,10,188,55,207,130,107,226,64,9,11,46,203,135,138,22,124,46,55,202,90,112,9,158,156,99,193,181,112,166,170,5,151,230,78,29,22,92,11,135,74,91,112,57,46,157,101,193,231,113,170,154,5,23,230,214,249,22,92,157,99,255,160,106,193,63,48,157,190,63,244,248,244,15,58,44,248,200,80,83,203,247,7,89,11,206,26,11,134,250,105,178,211,25,147,193,3,8,76,69,206,130,127,96,185,117,127,232,242,223,31,230,88,112,238,0,114,92,39,111,193,21,120,111,158,5,215,196,129,18,22,92,150,15,21,45,248,92,110,148,181,224,18,60,57,199,130,107,225,76,85,11,46,205,157,58,44,184,22,14,149,182,224,114,92,58,203,130,207,227,84,53,11,46,204,173,243,45,184,60,199,14,222,51,218,173,169,40,96,213,57,239,45,128,230,248,198,116,139,232,77,243,126,143,250,29,195,69,84,22,164,130,70,217,171,176,77,15,46,36,66,112,101,124,172,186,163,48,150,110,237,183,225,225,123,92,254,128,46,213,142,190,56,75,162,244,182,188,91,4,213,50,161,175,126,9,152,4,250,242,245,51,156,69,192,143,15,214,10,87,250,198,63,1,144,144,122,141,78,127,188,116,245,4,213,81,68,199,123,245,212,41,32,76,13,87,213,207,170,70,141,211,0,119,204,26,178,204,222,101,15,81,206,30,19,62,244,231,8,79,15,223,59,19,82,175,209,73,224,17,196,149,221,138,135,205,120,63,238,118,18,227,225,167,199,199,219,195,35,205,120,131,1,243,120,43,60,218,23,244,52,253,78,71,248,8,239,113,67,196,219,133,107,120,53,83,158,237,241,171,107,134,239,66,170,121,70,106,192,119,240,244,216,128,184,4,90,83,179,124,100,220,92,106,220,207,66,227,86,69,202,199,88,118,48,234,50,40,46,224,143,73,50,95,92,175,179,148,174,132,74,64,172,239,66,40,211,0,175,183,170,42,233,146,154,62,245,130,87,43,0,63,220,196,121,81,86,223,23,66,75,33,2,14,47,137,34,184,238,106,137,96,204,149,48,126,158,139,177,90,89,38,66,177,37,22,151,167,11,184,251,36,137,178,208,176,206,226,2,168,134,80,219,98,139,75,236,12,
-160,50,43,158,236,194,77,15,38,126,25,250,40,33,81,155,62,67,126,202,163,29,140,75,43,22,164,176,91,11,133,63,230,81,184,190,195,95,146,98,194,196,106,157,5,95,243,125,186,174,95,87,90,63,159,145,25,230,241,237,93,9,181,109,209,135,56,175,154,20,80,132,60,9,243,219,8,170,192,134,233,176,79,198,146,40,76,245,51,99,170,47,119,222,205,84,104,85,27,223,98,114,109,59,156,55,103,101,11,19,19,46,68,215,86,104,194,159,7,19,158,177,190,230,230,43,42,183,66,102,15,181,173,44,10,79,140,135,182,164,34,65,71,161,8,51,122,183,149,45,193,22,50,175,124,90,84,124,224,55,41,228,36,95,156,59,240,77,107,51,188,81,152,163,136,188,106,16,231,17,6,69,52,113,136,105,130,72,233,14,49,87,138,146,26,166,177,96,184,38,135,170,64,196,92,54,30,65,120,44,82,28,186,22,145,224,19,144,28,51,92,226,159,42,145,224,150,1,89,116,241,138,109,125,130,3,163,226,191,226,242,110,65,211,102,151,71,55,241,99,251,197,9,35,235,73,232,241,9,63,217,225,15,244,25,69,59,209,250,87,198,50,140,143,135,107,160,142,143,180,238,153,181,206,96,253,209,208,146,144,177,122,193,220,254,166,51,187,128,153,213,173,98,99,252,44,21,204,225,207,220,249,141,143,72,27,43,238,88,157,25,246,135,27,208,51,10,243,117,127,180,181,88,98,18,253,254,5,55,167,134,195,159,241,11,58,66,4,122,85,101,148,130,250,53,34,187,172,136,225,141,161,203,224,244,28,24,16,94,87,114,3,25,0,214,82,179,161,209,52,24,3,213,37,195,28,92,3,85,112,61,135,106,159,25,100,251,28,221,71,240,42,147,66,35,249,184,40,39,8,248,153,77,65,45,16,135,210,12,141,235,205,33,12,144,188,155,112,88,234,150,161,74,191,134,113,194,204,139,151,232,135,160,248,153,116,117,118,150,254,66,167,55,209,15,207,225,59,166,114,225,193,33,111,204,25,3,210,35,150,60,150,1,152,154,182,125,85,0,26,144,182,60,240,158,209,77,244,40,68,178,166,83,90,67,84,95,5,85,233,92,180,120,213,59,56,126,198,99,45,241,191,127,36,70,224,23,105,164,216,151,34,8,129,138,199,71,211,224,122,26,108,46,190,125,26,175,179,77,244,178,236,152,140,128,67,53,134,72,252,215,235,187,252,101,217,173,31,31,6,85,183,109,98,46,88,132,69,128,12,39,102,150,206,251,171,26,169,96,48,221,40,58,138,239,184,184,58,212,154,7,141,185,178,113,185,47,163,14,184,34,199,90,100,185,41,240,219,95,150,200,165,195,175,113,226,39,136,155,126,134,75,139,191,174,252,148,108,77,222,179,65,54,246,158,161,113,158,5,171,167,227,163,103,104,164,103,103,65,112,117,115,19,128,255,136,188,155,77,240,34,40,243,61,120,57,49,184,46,199,71,205,15,15,119,113,18,85,173,215,104,210,171,136,104,160,230,93,107,8,25,188,155,164,86,93,87,105,144,229,27,112,123,50,168,240,143,60,158,18,158,65,80,10,224,53,92,135,148,110,129,119,26,247,105,18,111,99,52,220,241,81,17,255,30,45,43,92,64,81,120,195,106,154,60,5,27,252,186,85,4,25,33,193,8,65,23,82,74,19,111,158,22,101,103,171,242,56,44,209,226,236,214,57,85,43,29,179,194,98,23,150,223,193,247,72,174,24,47,19,251,244,250,243,91,252,92,75,221,234,53,96,65,181,77,189,172,94,202,72,94,15,22,109,154,133,15,22,72,151,63,135,87,211,165,173,182,238,188,6,8,183,168,95,87,180,171,94,249,211,121,3,30,12,143,159,162,124,171,40,79,130,215,217,22,61,31,175,208,122,124,142,110,247,200,189,12,222,62,238,160,9,12,92,111,160,227,150,120,215,231,54,140,211,162,221,247,163,65,196,98,40,226,30,140,215,97,17,37,248,71,205,120,160,159,102,97,48,38,222,186,212,79,182,160,222,101,200,65,135,17,59,169,250,79,31,191,92,253,183,28,8,196,116,73,184,142,208,10,198,183,113,138,97,212,112,224,39,252,199,77,18,222,86,175,7,160,95,210,4,200,170,230,215,15,121,184,163,173,23,254,54,184,14,147,228,186,98,23,204,243,255,248,166,2,247,143,111,64,150,254,241,13,25,22,222,238,132,190,193,167,20,254,241,77,213,39,116,245,143,111,206,142,143,130,79,72,7,109,225,157,200,232,71,
-140,5,61,27,174,215,209,14,191,35,26,94,224,134,1,6,207,226,103,203,224,217,22,254,41,208,63,248,165,140,143,207,160,135,32,120,22,61,251,14,188,9,88,170,8,12,10,18,235,104,187,43,159,106,45,134,100,14,34,240,24,137,49,98,109,36,200,43,120,193,212,125,152,196,21,251,146,110,226,94,55,64,124,34,39,217,46,202,241,225,10,52,49,216,100,62,69,52,143,82,144,144,123,244,8,82,166,8,200,209,199,250,173,118,203,230,177,193,67,48,204,86,104,152,45,82,41,241,105,18,167,157,182,133,80,219,127,124,179,201,202,83,180,64,255,248,6,55,251,218,190,46,139,176,86,209,240,22,80,119,160,7,255,241,13,188,70,11,244,73,184,139,169,62,224,105,20,239,149,120,159,105,27,62,65,163,90,177,18,128,31,50,242,114,191,230,41,28,44,162,5,90,118,87,176,94,192,32,204,209,82,192,11,252,162,106,228,138,9,72,119,244,203,78,43,214,217,52,47,46,67,138,9,187,144,13,19,98,252,132,38,132,247,194,132,181,107,93,243,53,150,43,67,194,209,200,237,117,189,60,255,18,144,127,9,200,129,8,8,204,235,250,183,125,214,190,78,168,207,253,248,199,65,68,19,226,223,26,27,85,167,188,225,21,192,53,2,24,58,204,111,247,184,93,244,136,220,207,228,169,251,38,206,223,146,11,24,191,49,156,81,177,102,99,168,159,100,29,12,250,242,247,119,65,18,255,26,53,88,176,116,181,57,43,212,105,184,163,61,96,100,149,179,30,254,46,73,56,239,118,194,164,138,211,152,242,91,175,208,167,24,73,206,239,17,254,21,31,30,69,255,237,188,192,137,122,235,227,153,70,43,77,191,217,57,185,141,86,121,120,6,84,232,185,69,203,160,161,41,242,143,2,186,51,120,250,219,75,145,78,216,109,47,134,109,145,211,120,45,7,2,181,224,224,224,244,197,237,130,1,39,150,195,18,115,144,196,66,48,226,17,154,196,210,68,137,71,168,18,139,146,165,134,68,29,123,36,241,4,29,221,97,126,165,249,146,78,166,178,120,147,202,173,118,2,60,154,65,33,171,93,49,105,59,118,53,135,238,240,61,182,163,226,94,6,157,234,108,103,51,209,87,47,191,214,236,120,41,213,235,68,103,23,204,222,40,150,84,195,89,177,170,124,231,211,125,178,17,199,179,224,198,92,176,177,10,210,120,156,178,241,92,210,198,163,180,141,21,137,219,8,17,75,81,66,68,185,46,59,121,194,128,58,227,61,156,193,18,187,66,241,109,154,229,17,140,8,238,89,25,227,156,73,208,182,59,238,235,90,50,206,5,157,198,134,47,192,89,8,238,162,112,3,238,219,62,42,186,81,100,156,238,246,37,204,4,231,104,31,238,98,178,75,116,124,132,51,145,184,5,56,131,255,248,6,70,64,158,102,107,50,23,200,166,158,22,229,83,18,157,52,86,21,191,46,32,203,143,143,154,142,168,145,73,190,166,57,143,134,7,168,176,84,155,88,24,204,241,17,66,131,156,153,43,140,12,141,29,6,27,228,20,70,167,208,19,114,102,208,175,200,147,217,151,220,95,137,109,143,83,52,135,122,152,62,16,50,42,119,238,200,48,19,167,239,46,222,5,119,89,178,41,206,136,59,87,13,11,77,208,208,69,150,67,2,41,163,230,131,251,239,56,10,83,156,0,7,245,199,153,65,98,241,191,101,12,28,91,25,249,92,199,148,37,198,251,31,90,102,42,49,224,191,115,38,248,207,44,78,23,9,53,90,78,253,93,83,178,72,168,225,139,156,250,144,198,201,117,229,11,99,81,143,138,18,114,82,17,126,69,98,176,160,158,164,110,133,52,16,223,93,253,231,91,0,208,202,252,127,100,113,231,180,63,106,20,188,107,189,221,90,80,225,235,207,199,248,235,108,7,172,142,28,255,230,202,8,190,49,82,4,95,222,97,121,254,242,185,202,159,215,109,43,95,185,26,224,237,151,215,199,248,26,71,134,179,79,88,117,5,84,20,7,115,59,59,254,138,195,17,156,21,69,130,3,119,48,144,67,124,155,70,36,119,76,240,161,169,97,229,212,164,178,242,236,161,96,202,82,236,156,240,87,190,82,190,19,102,155,160,253,36,233,77,243,250,185,18,67,24,103,132,243,225,13,162,45,188,109,134,186,117,5,31,143,219,132,109,114,134,51,22,187,36,122,92,160,167,136,239,188,38,1,95,248,93,152,62,157,157,157,157,84,255,109,175,59,189,252,112,245,215,143,239,
-222,228,209,54,220,189,175,219,83,253,146,129,140,116,141,251,13,211,248,6,89,196,65,183,65,219,47,38,19,250,240,203,160,235,8,236,35,126,39,238,144,86,37,53,82,26,61,212,26,28,245,115,125,241,75,167,95,244,153,234,249,235,46,92,211,183,189,162,27,200,0,133,193,251,40,191,141,130,151,69,145,173,99,146,62,255,26,66,38,127,129,154,156,156,5,127,5,183,104,133,154,214,71,102,160,155,42,39,132,30,62,198,27,28,213,110,17,188,88,57,65,242,66,223,251,132,199,23,4,205,20,184,159,176,223,213,66,124,143,40,144,87,25,1,24,25,61,22,44,144,240,17,255,236,164,206,61,32,47,99,48,160,34,81,88,35,242,71,185,74,81,184,7,13,187,195,45,119,113,180,142,170,247,22,143,12,219,52,239,30,227,130,188,85,92,255,132,148,30,90,113,60,154,232,232,107,250,147,110,0,61,110,76,194,244,118,31,222,70,20,52,96,129,58,251,213,201,248,188,126,255,6,126,251,210,219,40,127,91,177,58,112,226,203,119,205,246,105,158,221,230,225,246,140,186,15,138,59,222,18,89,226,119,255,215,125,138,247,178,47,251,128,168,67,83,172,118,104,121,153,152,42,32,8,87,150,147,68,34,102,5,26,88,145,237,115,20,238,115,64,129,40,255,53,78,168,108,27,17,56,226,88,163,38,251,53,201,155,182,35,144,168,3,145,183,49,138,100,255,182,164,201,210,127,71,123,30,198,69,180,216,22,183,213,118,25,156,71,161,113,224,223,169,204,35,124,196,233,236,71,72,137,131,216,39,225,42,2,233,69,81,9,140,27,54,137,221,96,139,250,64,171,12,195,246,70,13,139,34,202,203,197,61,182,8,136,26,91,6,17,208,178,146,199,94,197,37,191,131,226,110,186,131,47,119,35,29,192,137,136,169,14,174,210,145,14,144,29,155,236,224,29,188,38,156,59,5,196,154,147,83,128,171,178,188,14,80,139,201,14,62,198,155,166,131,38,156,172,59,0,57,63,95,238,210,112,27,97,52,160,166,241,31,136,9,137,18,224,117,251,53,7,43,70,157,156,196,223,2,91,148,81,181,153,94,143,134,28,176,240,38,201,30,22,221,109,98,212,21,62,50,242,166,250,185,237,235,43,197,193,72,93,228,16,127,174,146,12,153,17,100,50,162,199,104,189,135,240,144,184,112,117,231,176,173,82,230,89,114,214,49,38,232,145,95,201,52,177,78,239,79,229,54,204,87,136,79,225,169,118,244,159,66,164,209,145,65,43,170,237,153,206,126,205,109,132,247,20,136,17,203,227,219,219,8,171,159,170,35,244,108,2,49,13,156,227,56,254,177,104,165,179,65,137,167,129,123,14,1,76,16,133,121,242,132,188,200,36,2,39,179,177,85,103,93,229,93,20,245,90,157,208,240,225,7,42,41,143,2,241,29,173,34,96,148,77,92,32,108,27,172,44,0,32,57,148,145,71,40,168,78,201,158,1,5,110,131,207,4,71,233,250,137,30,30,67,174,228,229,161,33,37,189,187,190,137,240,51,155,193,66,190,194,139,6,135,55,238,81,16,31,174,144,59,89,62,225,147,87,9,132,244,53,157,31,200,46,90,9,68,133,57,65,139,123,26,66,30,221,34,255,61,202,105,117,190,132,163,53,248,143,187,40,217,177,117,105,221,174,86,242,53,178,111,224,0,2,16,2,235,74,56,162,211,222,26,0,163,66,54,47,73,219,0,82,187,144,14,185,169,58,233,30,20,233,25,184,34,220,34,177,160,55,30,246,171,61,120,118,249,150,50,187,80,139,0,188,96,70,112,252,229,229,251,79,239,222,86,77,250,27,63,100,91,167,142,41,240,1,35,120,172,26,21,190,131,67,48,65,241,205,52,128,29,245,246,64,62,0,120,33,159,34,136,23,193,98,23,60,34,234,238,193,227,56,57,89,130,208,32,79,225,57,188,48,96,7,255,156,159,61,103,184,8,16,188,109,81,7,57,254,169,230,128,230,219,51,228,108,33,81,41,22,221,13,154,143,159,190,66,202,123,7,205,248,109,106,223,58,168,156,107,94,31,148,90,131,150,136,23,182,25,18,204,182,199,111,56,224,214,89,148,175,193,58,75,193,107,91,201,3,252,27,90,99,224,187,24,19,191,124,130,205,182,186,59,62,202,237,54,75,191,34,195,33,139,179,109,7,72,137,245,192,88,43,91,49,133,246,53,238,1,120,242,52,106,15,252,180,100,101,195,109,74,110,200,161,109,155,49,201,26,140,34,
-125,31,230,191,246,242,7,173,198,194,132,29,142,120,159,37,168,69,38,133,178,110,163,0,241,75,140,130,81,0,87,245,17,224,164,113,101,32,17,93,57,40,241,21,153,48,45,101,215,190,110,165,128,244,205,126,151,196,248,50,68,221,13,71,164,134,227,34,15,22,92,219,92,10,108,211,72,1,235,107,98,194,193,117,222,129,71,131,119,243,115,18,201,86,221,242,229,170,40,223,35,107,146,72,82,182,110,37,47,253,111,171,156,74,101,200,138,170,110,69,157,103,71,244,109,197,140,135,154,114,207,196,65,55,141,228,49,191,105,124,161,28,5,137,81,73,12,112,156,254,147,56,78,92,152,81,184,129,39,229,96,214,141,20,96,194,182,6,134,54,169,245,241,9,159,85,156,110,164,176,181,173,20,214,189,14,56,171,195,69,81,73,45,116,113,198,3,250,207,184,148,130,8,207,203,131,251,132,36,39,188,197,210,222,203,191,34,111,248,159,251,162,60,141,211,83,40,17,84,143,20,142,173,123,157,218,146,163,109,221,104,6,105,27,85,69,81,22,121,166,235,136,75,222,42,10,168,52,72,38,167,179,6,141,229,161,255,208,141,66,144,214,154,210,174,183,81,10,121,57,89,168,77,43,121,140,95,162,223,246,248,100,121,211,201,36,72,212,32,127,74,178,91,41,140,77,35,121,136,181,5,128,179,77,184,27,184,66,81,34,6,142,215,5,85,239,139,114,84,155,72,173,62,121,212,244,223,60,116,93,253,198,60,190,132,29,106,154,10,253,249,12,103,209,140,240,247,143,95,235,167,218,190,63,86,223,208,73,153,38,5,203,99,223,56,133,51,126,82,84,174,154,40,72,217,227,142,156,169,199,199,10,235,208,170,224,59,1,149,117,64,191,221,201,186,2,116,83,121,164,120,251,9,218,18,133,0,177,117,214,89,163,122,175,164,55,82,210,6,91,156,228,253,203,119,63,116,219,80,145,86,134,60,56,68,24,20,143,222,17,7,255,159,53,140,122,203,28,187,250,33,50,241,79,5,201,165,163,197,133,212,4,10,100,215,191,62,113,117,212,54,92,231,217,162,132,11,166,101,77,12,242,169,161,72,39,138,70,36,193,77,104,190,197,107,214,132,206,213,166,63,233,164,19,37,243,70,239,111,113,104,64,19,246,199,15,246,69,157,126,109,36,160,19,193,15,193,101,249,58,220,202,145,6,55,161,193,144,219,121,24,35,184,139,107,244,28,210,112,224,64,214,9,173,26,4,147,62,4,194,44,250,140,65,66,108,31,147,59,19,205,169,146,234,208,88,80,165,112,27,242,65,142,155,207,68,144,145,46,33,20,146,146,69,170,153,188,28,126,142,138,44,185,39,124,71,78,36,227,158,130,13,236,75,197,229,88,188,187,141,203,12,9,137,28,214,170,141,60,80,228,203,199,55,79,36,96,72,66,156,133,67,30,68,146,197,176,43,146,195,134,87,82,179,6,190,125,84,29,176,134,240,125,157,229,220,224,178,221,120,28,174,57,43,206,134,252,22,225,188,166,37,22,136,118,7,129,35,6,220,29,78,173,227,50,149,67,137,247,226,164,150,169,106,35,191,76,63,166,57,178,243,245,177,245,179,238,46,37,7,225,63,139,44,149,115,160,161,129,9,108,140,177,242,104,179,95,203,9,100,213,68,69,24,161,97,117,42,3,208,225,42,77,193,58,9,227,109,193,7,184,13,119,146,248,160,133,10,60,212,110,135,235,239,209,250,140,228,221,171,114,11,13,119,146,180,78,90,142,192,206,202,232,239,200,17,140,37,51,80,221,150,86,85,94,30,225,187,148,146,112,73,27,21,160,228,230,230,234,137,177,153,16,87,42,141,233,216,237,139,187,234,96,153,148,83,215,54,83,8,79,81,227,128,180,46,130,77,246,0,110,123,237,133,113,233,153,37,165,28,235,226,6,242,224,174,112,26,4,175,248,199,119,95,63,5,176,129,66,246,183,225,154,107,124,31,241,131,251,135,100,45,133,16,158,159,5,240,33,203,127,77,50,200,146,132,187,114,159,71,167,216,151,120,18,193,186,203,138,242,38,126,148,91,244,170,141,194,138,147,150,141,73,94,70,103,183,103,1,48,81,117,116,128,94,125,58,116,104,239,145,244,119,41,226,146,4,175,212,70,203,224,108,205,18,111,132,212,199,157,96,183,184,115,210,162,61,234,244,245,51,106,251,250,110,79,239,66,190,206,35,124,160,32,109,134,34,46,26,154,7,50,167,183,121,152,226,237,38,52,0,190,159,212,
-61,139,22,6,247,113,244,208,57,102,150,70,143,229,20,188,96,4,223,99,217,3,248,41,207,26,27,0,63,7,107,248,29,27,254,214,187,233,184,24,3,2,161,113,239,240,30,118,80,86,27,8,244,152,171,125,122,85,77,189,51,42,116,141,71,69,15,64,66,38,2,181,3,255,169,10,19,32,242,84,87,235,241,14,43,86,153,61,28,125,82,76,2,249,128,154,140,76,29,61,193,154,120,135,246,69,25,237,240,24,73,88,148,240,199,201,119,180,55,85,17,249,26,125,119,25,48,90,194,113,7,220,18,253,113,2,255,12,90,162,239,152,45,97,223,22,183,196,231,139,232,125,219,186,37,250,142,217,18,120,2,183,196,123,149,232,159,65,75,244,29,179,229,77,82,141,137,254,56,129,127,6,45,209,119,204,150,155,85,66,90,226,237,73,216,126,236,183,68,223,5,212,6,221,230,62,76,215,213,133,183,174,168,132,149,176,224,45,245,225,166,109,123,128,16,249,6,107,138,63,226,2,73,127,86,115,200,106,252,221,30,87,95,254,223,183,159,63,210,174,91,152,63,145,66,63,152,37,160,171,32,187,143,242,193,217,124,212,152,138,1,135,131,10,214,171,159,5,96,242,45,12,93,88,136,197,236,211,2,6,245,144,22,116,177,18,107,180,192,165,102,252,163,5,188,56,192,58,45,96,80,15,105,129,20,155,125,90,192,160,30,210,2,169,106,251,180,128,65,157,210,130,194,149,198,9,125,234,102,20,202,135,171,119,124,36,41,12,45,66,137,222,136,194,132,80,30,93,128,37,210,172,148,34,196,199,175,227,104,112,119,130,228,24,12,45,78,145,121,48,166,217,3,117,208,216,251,120,84,105,32,40,204,170,102,175,178,44,137,112,61,41,156,228,165,102,222,235,91,244,221,55,98,227,76,46,57,61,58,237,62,161,191,199,70,36,20,70,184,160,116,5,46,130,36,176,198,189,177,152,51,213,54,174,204,204,105,103,9,254,54,57,115,158,143,164,111,92,153,153,115,235,184,25,152,57,207,35,210,55,174,204,204,105,71,168,243,54,37,3,51,231,249,63,250,198,157,86,97,69,124,155,10,74,250,151,171,31,62,244,65,64,243,96,113,122,190,124,190,60,63,17,153,126,127,60,65,105,87,31,123,114,241,105,68,157,240,200,2,5,184,145,145,51,10,116,130,34,11,20,224,198,67,206,40,208,9,133,44,80,128,27,5,57,163,64,39,0,178,64,1,110,236,227,140,2,157,176,199,2,5,184,17,143,21,10,180,7,97,86,133,160,45,120,249,234,75,31,4,106,44,50,237,222,24,130,179,150,28,111,114,177,41,20,19,94,158,150,153,74,120,119,6,103,58,225,213,105,153,169,132,55,103,112,166,19,94,156,150,153,74,120,111,6,103,74,235,106,248,219,196,76,121,250,121,254,120,50,51,165,117,50,252,109,98,166,60,61,60,127,188,105,229,123,42,26,112,191,253,161,63,112,26,221,138,76,244,84,37,204,150,27,109,114,65,79,69,131,235,249,179,148,9,169,77,205,114,42,144,158,63,75,153,240,217,212,44,167,130,230,249,179,148,9,149,77,205,114,66,213,106,152,165,132,162,53,54,203,9,53,171,97,150,18,74,86,215,44,27,16,127,252,163,160,150,189,250,240,250,115,127,232,166,68,134,200,116,187,35,9,106,91,181,81,39,23,183,197,50,161,117,53,206,90,66,251,26,159,245,132,22,214,56,107,9,109,108,124,214,19,90,89,227,172,37,180,179,241,89,79,104,105,141,179,150,208,214,198,103,61,161,181,53,206,90,66,123,107,158,117,107,73,68,93,229,55,111,135,0,54,145,196,180,79,85,92,102,181,81,167,45,180,168,235,172,113,214,18,74,220,248,172,39,148,184,198,89,75,40,113,227,179,158,80,226,26,103,45,161,196,141,207,122,66,137,107,156,181,132,18,55,62,235,9,37,174,113,214,18,74,92,243,172,219,146,137,113,186,88,157,183,103,120,207,127,89,174,46,232,143,39,1,253,169,135,234,253,213,135,193,57,135,102,88,212,117,188,221,111,219,146,198,248,13,159,187,48,206,225,3,174,109,92,80,100,153,68,194,162,148,29,84,29,20,117,1,41,231,8,156,209,163,30,127,229,140,79,152,8,172,210,131,134,115,157,102,215,248,112,212,28,57,170,58,153,7,108,25,224,162,236,112,27,35,173,139,125,247,104,39,4,86,134,148,214,129,171,72,163,23,32,125,166,170,146,76,123,1,210,27,170,82,101,136,
-31,231,232,130,151,255,61,130,47,124,148,210,149,83,72,196,137,167,27,149,188,20,219,64,224,140,30,10,242,103,3,129,85,122,208,112,52,216,212,151,255,61,45,238,2,192,38,245,147,32,88,25,82,90,7,174,34,141,94,128,244,153,170,74,50,237,5,72,111,168,74,37,89,27,233,194,57,192,90,182,232,212,35,235,120,192,155,55,81,154,64,161,151,1,190,87,231,193,31,131,87,23,75,92,25,57,76,203,8,206,240,226,72,154,20,213,123,170,94,48,12,152,112,15,57,46,21,68,103,99,249,144,68,79,47,76,194,99,70,240,243,48,83,40,239,225,63,138,248,16,188,159,244,2,209,64,52,0,165,159,100,4,221,106,46,199,253,4,43,170,23,200,124,146,97,80,186,72,38,35,173,172,99,75,30,73,171,18,60,139,210,42,137,207,142,180,42,128,178,40,173,114,232,44,73,171,2,40,23,210,202,58,78,233,145,180,42,193,179,40,173,146,248,236,72,171,2,40,139,210,42,135,206,146,180,42,128,114,33,173,172,99,222,30,73,171,18,60,139,210,42,137,207,142,180,42,128,178,40,173,114,232,44,73,171,2,40,23,210,202,186,126,226,145,180,42,193,179,40,173,146,248,236,72,171,2,40,139,210,42,135,206,146,180,42,128,114,33,173,172,107,113,111,222,192,221,191,48,225,11,43,249,61,136,242,28,10,181,167,13,42,117,177,84,193,193,161,151,0,56,52,208,117,154,225,39,84,73,196,39,78,179,68,235,112,95,32,84,31,174,222,53,197,198,164,0,136,211,73,146,66,34,8,71,84,148,220,90,17,13,37,198,49,34,186,72,126,116,77,124,34,71,14,30,33,164,185,67,157,38,82,212,16,227,9,174,14,150,90,149,74,5,11,241,132,144,178,149,31,93,15,79,72,146,131,71,8,89,158,152,65,19,41,106,140,225,154,82,244,244,121,98,79,182,50,120,7,143,189,220,202,128,130,158,94,108,101,64,137,209,131,216,202,80,231,56,205,46,161,30,62,179,234,18,210,180,243,100,43,131,71,69,47,183,50,40,105,117,187,149,193,145,86,255,182,50,212,57,206,146,180,122,188,149,65,211,206,147,173,12,30,21,189,220,202,160,164,213,237,86,6,71,90,253,219,202,80,231,56,75,210,234,241,86,6,77,59,79,182,50,120,84,244,114,43,131,146,86,183,91,25,28,105,245,111,43,67,157,227,44,73,171,199,91,25,83,149,187,76,38,71,101,42,122,57,76,142,78,147,200,112,114,84,142,78,22,146,163,148,138,146,91,43,229,228,40,71,23,201,143,110,34,57,58,73,14,51,201,81,41,154,152,78,142,42,235,17,229,228,168,22,237,97,42,57,170,160,51,116,36,71,103,106,10,83,201,81,186,236,128,39,201,81,94,125,2,47,147,163,240,206,34,47,146,163,240,22,165,131,72,142,170,115,156,102,151,80,15,159,89,117,9,105,218,121,146,28,229,81,209,203,228,40,37,173,110,147,163,28,105,245,47,57,170,206,113,150,164,213,227,228,40,77,59,79,146,163,60,42,122,153,28,165,164,213,109,114,148,35,173,254,37,71,213,57,206,146,180,122,156,28,157,42,31,110,50,221,34,83,86,220,97,186,101,154,68,134,211,45,114,116,178,144,110,161,84,148,220,90,41,167,91,56,186,72,126,116,19,233,150,73,114,152,73,183,72,209,196,116,186,69,89,143,40,167,91,180,104,15,83,233,22,5,157,161,35,221,50,83,83,152,74,183,208,245,14,61,73,183,240,10,35,122,153,110,193,47,3,247,33,221,2,175,158,62,136,116,139,58,199,105,118,9,245,240,153,85,151,144,166,157,39,233,22,30,21,189,76,183,80,210,234,54,221,194,145,86,255,210,45,234,28,103,73,90,61,78,183,76,189,21,201,100,0,39,243,182,36,135,1,220,52,137,12,7,112,114,116,178,16,192,81,42,74,110,173,148,3,56,142,46,146,31,221,68,0,55,73,14,51,1,156,20,77,76,7,112,202,122,68,57,128,211,162,61,76,5,112,10,58,67,71,0,55,83,83,152,10,224,232,210,237,158,4,112,188,26,239,94,6,112,8,172,31,1,28,2,114,24,1,156,58,199,105,118,9,245,240,153,85,151,112,234,245,145,38,93,66,153,215,74,58,116,9,167,73,100,216,37,148,163,147,5,151,144,82,81,114,107,165,236,18,114,116,145,252,232,38,92,194,73,114,152,113,9,165,104,98,218,37,84,214,35,202,46,161,22,237,97,202,37,84,208,25,
-58,92,194,153,154,194,148,75,56,245,230,94,147,70,70,230,141,190,14,141,204,52,137,12,27,25,57,58,89,48,50,104,96,181,181,82,54,50,104,152,249,156,98,202,200,76,146,195,140,145,145,162,137,105,35,163,172,71,148,141,140,22,237,97,202,200,40,232,12,29,70,102,166,166,208,104,100,240,141,1,191,234,177,15,32,249,159,119,192,144,125,168,199,222,2,241,56,239,0,23,151,188,168,199,222,3,226,127,222,129,43,173,238,54,142,133,164,213,175,141,227,161,180,58,218,56,30,151,86,79,54,142,57,210,106,127,227,88,64,90,253,218,56,230,74,171,187,115,250,66,210,234,215,57,253,161,180,58,58,167,63,46,173,158,156,211,231,72,171,253,115,250,2,210,234,215,57,125,174,180,186,43,98,34,36,173,126,21,49,25,74,171,163,34,38,227,210,234,73,17,19,142,180,218,47,98,34,32,173,126,21,49,225,74,171,133,34,38,66,98,233,190,136,137,36,137,244,39,71,103,208,201,100,114,116,168,162,76,23,49,25,215,69,142,139,152,136,146,67,115,114,84,133,38,70,146,163,28,29,108,176,136,137,128,178,117,87,196,68,138,28,250,146,163,202,52,177,150,28,245,163,194,243,0,210,193,36,71,221,87,120,110,129,28,70,114,212,109,133,231,30,144,3,75,142,250,81,225,89,72,90,189,76,142,186,175,240,60,46,173,254,37,71,221,86,120,22,144,86,143,147,163,126,84,120,22,146,86,47,147,163,238,43,60,143,75,171,127,201,81,183,21,158,5,164,213,227,228,168,31,21,158,133,164,213,203,228,168,251,10,207,227,210,234,95,114,212,109,133,103,1,105,245,56,57,106,185,194,179,144,88,122,150,28,117,81,225,121,6,157,44,36,71,45,86,120,30,215,69,126,36,71,109,87,120,86,161,137,233,228,168,165,10,207,2,202,214,139,228,168,205,10,207,202,52,177,150,28,245,163,194,243,0,210,193,36,71,221,87,120,110,129,28,70,114,212,109,133,231,30,144,3,75,142,250,81,225,89,72,90,189,76,142,186,175,240,60,46,173,254,37,71,221,86,120,22,144,86,143,147,163,126,84,120,22,146,86,47,147,163,238,43,60,143,75,171,127,201,81,183,21,158,5,164,213,227,228,168,229,10,207,66,98,233,190,194,179,36,137,12,167,91,252,169,240,60,84,81,166,43,60,143,235,34,199,21,158,69,201,97,38,221,226,190,194,51,71,7,27,172,240,44,160,108,221,85,120,150,34,135,145,116,139,63,21,158,59,10,204,143,10,207,3,72,7,147,110,113,95,225,185,5,114,24,233,22,183,21,158,123,64,14,44,221,226,71,133,103,33,105,245,50,221,226,190,194,243,184,180,250,151,110,113,91,225,89,64,90,61,78,183,88,174,240,44,36,150,238,43,60,75,146,200,112,0,231,79,133,231,161,138,50,93,225,121,92,23,57,174,240,44,74,14,51,1,156,251,10,207,28,29,108,176,194,179,128,178,117,87,225,89,138,28,70,2,56,127,42,60,119,20,152,31,21,158,7,144,14,38,128,115,95,225,185,5,114,24,1,156,219,10,207,61,32,7,22,192,89,174,240,44,36,150,238,43,60,75,146,200,176,75,232,79,133,231,161,138,50,93,225,121,92,23,57,174,240,44,74,14,51,46,161,251,10,207,28,29,108,176,194,179,128,178,117,87,225,89,138,28,70,92,66,127,42,60,119,20,152,229,10,207,131,177,253,172,240,44,73,34,195,70,198,159,10,207,149,122,179,88,225,185,29,209,195,10,207,162,228,48,99,100,220,87,120,166,212,155,165,10,207,189,17,253,170,240,44,69,14,35,70,198,159,10,207,120,11,219,175,10,207,3,72,254,231,29,48,100,31,42,60,183,64,60,206,59,192,73,26,47,42,60,247,128,248,159,119,224,74,171,187,141,99,33,105,245,107,227,120,40,173,142,54,142,199,165,213,147,141,99,142,180,218,223,56,22,144,86,191,54,142,185,210,234,238,156,190,144,180,250,117,78,127,40,173,142,206,233,143,75,171,39,231,244,57,210,106,255,156,190,128,180,250,117,78,159,43,173,22,206,233,11,137,165,251,115,250,146,36,210,159,110,153,65,39,147,233,150,161,138,50,125,78,127,92,23,57,62,167,47,74,14,205,233,22,21,154,24,73,183,112,116,176,193,115,250,2,202,214,221,57,125,41,114,232,75,183,40,211,196,90,186,197,143,154,177,3,72,7,147,110,113,95,51,182,5,114,24,233,22,183,53,99,123,64,
-14,44,221,226,71,205,88,33,105,245,50,221,226,190,102,236,184,180,250,151,110,113,91,51,86,64,90,61,78,183,248,81,51,86,72,90,189,76,183,184,175,25,59,46,173,254,165,91,220,214,140,21,144,86,143,211,45,211,21,60,205,165,91,228,138,118,58,75,183,76,147,200,112,186,69,142,78,22,210,45,147,133,114,181,167,91,164,42,226,218,78,183,76,146,195,76,186,69,138,38,166,211,45,202,122,68,57,221,162,69,123,152,74,183,40,232,12,29,233,150,153,154,194,84,186,197,143,42,148,3,72,7,147,110,113,95,133,178,5,114,24,233,22,183,85,40,123,64,14,44,221,226,71,21,74,33,105,245,50,221,226,190,10,229,184,180,250,151,110,113,91,133,82,64,90,61,78,183,248,81,133,82,72,90,189,76,183,184,175,66,57,46,173,254,165,91,220,86,161,20,144,86,143,211,45,150,171,80,10,137,165,103,233,22,23,85,40,103,208,201,66,186,197,98,21,202,113,93,228,71,186,197,118,21,74,21,154,152,78,183,88,170,66,41,160,108,189,72,183,216,172,66,169,76,19,107,233,22,63,170,80,14,32,29,76,186,197,125,21,202,22,200,97,164,91,220,86,161,236,1,57,176,116,139,31,85,40,133,164,213,203,116,139,251,42,148,227,210,234,95,186,197,109,21,74,1,105,245,56,221,98,185,10,165,144,88,186,175,66,41,73,34,195,1,156,63,85,40,135,42,202,116,21,202,113,93,228,184,10,165,40,57,204,4,112,238,171,80,114,116,176,193,42,148,2,202,214,93,21,74,41,114,24,9,224,252,169,66,217,81,96,126,84,161,28,64,58,152,0,206,125,21,202,22,200,97,4,112,110,171,80,246,128,28,88,0,103,185,10,165,144,88,186,175,66,41,73,34,195,46,161,63,85,40,135,42,202,116,21,202,113,93,228,184,10,165,40,57,204,184,132,238,171,80,114,116,176,193,42,148,2,202,214,93,21,74,41,114,24,113,9,253,169,66,217,81,96,150,171,80,14,198,246,179,10,165,36,137,12,27,25,127,170,80,86,234,205,98,21,202,118,68,15,171,80,138,146,195,140,145,113,95,133,146,82,111,150,170,80,246,70,244,171,10,165,20,57,140,24,25,127,170,80,226,12,136,95,85,40,7,144,252,207,59,96,200,62,84,161,108,129,120,156,119,128,68,172,23,85,40,123,64,252,207,59,112,165,213,221,198,177,144,180,250,181,113,60,148,86,71,27,199,227,210,234,201,198,49,71,90,237,111,28,11,72,171,95,27,199,92,105,181,176,113,44,36,150,238,55,142,37,73,164,63,128,155,65,39,147,1,220,80,69,153,222,56,30,215,69,142,55,142,69,201,161,57,128,83,161,137,145,0,142,163,131,13,110,28,11,40,91,119,27,199,82,228,208,23,192,41,211,196,90,0,231,71,93,187,1,164,131,9,224,220,215,181,107,129,28,70,0,231,182,174,93,15,200,129,5,112,126,212,181,19,146,86,47,3,56,247,117,237,198,165,213,191,0,206,109,93,59,1,105,245,56,128,155,174,50,102,46,128,147,43,44,230,44,128,155,38,145,225,0,78,142,78,22,2,184,201,98,126,218,3,56,169,170,125,182,3,184,73,114,152,9,224,164,104,98,58,128,83,214,35,202,1,156,22,237,97,42,128,83,208,25,58,2,184,153,154,194,84,0,231,71,165,172,1,164,131,9,224,220,87,202,106,129,28,70,0,231,182,82,86,15,200,129,5,112,126,84,202,18,146,86,47,3,56,247,149,178,198,165,213,191,0,206,109,165,44,1,105,245,56,128,155,174,91,100,46,128,147,43,85,228,44,128,155,38,145,225,0,78,142,78,22,2,184,201,242,96,218,3,56,169,58,96,182,3,184,73,114,152,9,224,164,104,98,58,128,83,214,35,202,1,156,22,237,97,42,128,83,208,25,58,2,184,153,154,194,84,0,231,71,237,157,1,164,131,9,224,220,215,222,105,129,28,70,0,231,182,246,78,15,200,129,5,112,126,212,222,17,146,86,47,3,56,247,181,119,198,165,213,191,0,206,109,237,29,1,105,245,56,128,179,92,123,71,72,44,61,11,224,92,212,222,153,65,39,11,1,156,197,218,59,227,186,200,143,0,206,118,237,29,21,154,152,14,224,44,213,222,17,80,182,94,4,112,54,107,239,40,211,196,90,0,231,71,237,157,1,164,131,9,224,220,215,222,105,129,28,70,0,231,182,246,78,15,200,129,5,112,150,107,239,8,137,165,251,218,59,146,36,50,
-236,18,250,83,123,103,168,162,76,215,222,25,215,69,142,107,239,136,146,195,140,75,232,190,246,14,71,7,27,172,189,35,160,108,221,213,222,145,34,135,17,151,208,159,218,59,29,5,102,185,246,206,96,108,63,107,239,72,146,200,176,145,241,167,246,78,165,222,44,214,222,105,71,244,176,246,142,40,57,204,24,25,247,181,119,40,245,102,169,246,78,111,68,191,106,239,72,145,195,136,145,241,167,246,14,54,119,126,213,222,25,64,242,63,239,128,33,251,80,123,167,5,226,113,222,1,188,110,47,106,239,244,128,248,159,119,224,74,171,133,188,131,144,88,186,207,59,72,146,72,191,75,56,131,78,38,93,194,161,138,50,157,119,24,215,69,142,243,14,162,228,208,236,18,170,208,196,136,75,200,209,193,6,243,14,2,202,214,93,222,65,138,28,250,92,66,101,154,88,115,9,253,168,230,49,128,116,48,46,161,251,106,30,45,144,195,112,9,221,86,243,232,1,57,48,151,112,186,182,130,57,151,80,174,156,130,51,151,112,154,68,134,93,66,57,58,89,112,9,39,75,152,104,119,9,165,106,149,216,118,9,39,201,97,198,37,148,162,137,105,151,80,89,143,40,187,132,90,180,135,41,151,80,65,103,232,112,9,103,106,10,83,46,161,31,245,1,6,144,14,198,37,116,95,31,160,5,114,24,46,161,219,250,0,61,32,7,230,18,78,223,214,54,231,18,202,93,208,118,230,18,78,147,200,176,75,40,71,39,11,46,225,100,81,4,237,46,161,84,245,3,219,46,225,36,57,204,184,132,82,52,49,237,18,42,235,17,101,151,80,139,246,48,229,18,42,232,12,29,46,225,76,77,97,202,37,244,227,198,241,0,210,193,184,132,238,111,28,183,64,14,195,37,116,123,227,184,7,228,192,92,194,233,251,159,230,92,66,185,43,159,206,92,194,105,18,25,118,9,229,232,100,193,37,156,188,102,173,221,37,148,186,79,109,219,37,156,36,135,25,151,80,138,38,166,93,66,101,61,162,236,18,106,209,30,166,92,66,5,157,161,195,37,156,169,41,76,185,132,126,220,97,28,64,58,24,151,208,253,29,198,22,200,97,184,132,110,239,48,246,128,28,152,75,104,249,14,163,144,88,122,230,18,186,184,195,56,131,78,22,92,66,139,119,24,199,117,145,31,46,161,237,59,140,42,52,49,237,18,90,186,195,40,160,108,189,112,9,109,222,97,84,166,137,53,151,208,242,29,198,193,216,126,222,97,148,36,145,97,35,227,207,29,198,74,189,89,188,195,216,142,232,225,29,70,81,114,152,49,50,238,239,48,82,234,205,210,29,198,222,136,126,221,97,148,34,135,17,35,227,207,29,70,140,68,252,14,163,86,35,51,24,219,79,35,35,73,34,253,70,102,6,157,76,26,25,12,75,224,226,166,62,35,211,142,232,161,145,17,37,135,102,35,163,66,19,35,70,6,204,220,106,166,30,145,51,50,189,17,253,50,50,82,228,208,103,100,148,105,98,205,200,76,223,81,49,103,100,228,174,165,56,51,50,211,36,50,108,100,228,232,100,193,200,76,94,5,211,110,100,164,238,124,217,54,50,147,228,48,99,100,164,104,98,218,200,40,235,17,101,35,163,69,123,152,50,50,10,58,67,135,145,153,169,41,76,25,153,233,83,239,230,140,140,220,65,119,103,70,102,154,68,134,141,140,28,157,44,24,153,201,203,37,218,141,140,212,45,18,219,70,102,146,28,102,140,140,20,77,76,27,25,101,61,162,108,100,180,104,15,83,70,70,65,103,232,48,50,51,53,133,41,35,51,125,142,214,156,145,145,59,58,235,204,200,76,147,200,176,145,145,163,147,5,35,51,121,92,93,187,145,145,58,151,110,219,200,76,146,195,140,145,145,162,137,105,35,163,172,71,148,141,140,22,237,97,202,200,40,232,12,29,70,102,166,166,48,101,100,166,79,230,153,51,50,114,135,241,156,25,153,105,18,25,54,50,114,116,178,96,100,38,15,192,106,55,50,82,39,93,109,27,153,73,114,152,49,50,82,52,49,109,100,148,245,136,178,145,209,162,61,76,25,25,5,157,161,195,200,204,212,20,166,140,140,229,211,101,131,177,15,192,200,184,56,93,54,131,78,22,140,140,197,211,101,237,136,254,26,25,219,167,203,84,104,98,218,200,88,58,93,214,27,209,91,35,99,243,116,153,50,77,244,27,153,211,70,129,225,35,8,130,71,167,190,252,248,106,228,218,216,233,188,91,109,35,144,4,41,53,13,79,247,21,
-173,211,5,125,144,99,234,100,209,24,62,4,239,39,189,64,52,16,13,64,233,39,25,65,183,154,203,113,63,193,138,234,5,50,159,100,24,148,246,91,109,2,210,202,184,251,224,147,180,42,193,179,40,173,146,248,236,72,171,2,40,139,210,42,135,206,146,180,42,128,114,33,173,140,23,240,250,36,173,74,240,44,74,171,36,62,59,210,170,0,202,162,180,202,161,179,36,173,10,160,92,72,43,236,109,123,44,173,74,240,44,74,171,36,62,59,210,170,0,202,162,180,202,161,179,36,173,10,160,92,72,43,28,119,244,88,90,149,224,89,148,86,73,124,118,164,85,1,148,69,105,149,67,103,73,90,21,64,185,144,86,248,123,8,147,191,133,112,42,186,149,33,41,150,42,56,212,211,145,197,126,53,216,73,144,36,17,159,56,34,137,73,33,0,226,116,146,164,144,8,194,17,21,37,183,86,68,67,137,113,140,136,46,146,31,93,19,159,200,145,131,71,8,105,238,80,167,137,20,53,196,120,130,171,131,165,86,165,82,193,66,60,33,164,108,229,71,215,195,19,146,228,224,17,66,150,39,102,208,68,138,26,115,182,50,38,46,219,184,112,9,37,46,226,184,119,9,199,239,175,89,116,9,197,111,180,57,118,9,213,57,78,179,75,168,135,207,172,186,132,19,175,32,242,73,90,189,220,202,24,127,171,151,123,105,245,111,43,67,157,227,44,73,171,199,91,25,52,237,60,217,202,224,81,209,203,173,12,74,90,221,110,101,112,164,213,191,173,12,117,142,179,36,173,30,111,101,208,180,243,100,43,131,71,69,47,183,50,40,105,117,187,149,193,145,86,255,182,50,212,57,206,146,180,122,188,149,65,211,142,157,195,53,151,28,229,145,75,5,135,193,228,232,52,137,12,39,71,229,232,100,33,57,74,169,40,185,181,82,78,142,114,116,145,252,232,38,146,163,147,228,48,147,28,149,162,137,233,228,168,178,30,81,78,142,106,209,30,166,146,163,10,58,67,71,114,116,166,166,48,149,28,157,40,18,225,194,37,148,40,32,225,222,37,28,175,187,98,209,37,20,175,196,226,216,37,84,231,56,205,46,161,30,62,179,234,18,78,188,140,211,39,105,245,50,57,58,254,126,91,247,210,234,95,114,84,157,227,44,73,171,199,201,81,154,118,158,36,71,121,84,244,50,57,74,73,171,219,228,40,71,90,253,75,142,170,115,156,37,105,245,56,57,74,211,142,157,21,50,151,110,225,145,75,5,135,193,116,203,52,137,12,167,91,228,232,100,33,221,66,169,40,185,181,82,78,183,112,116,145,252,232,38,210,45,147,228,48,147,110,145,162,137,233,116,139,178,30,81,78,183,104,209,30,166,210,45,10,58,67,71,186,101,166,166,48,149,110,153,40,151,230,194,37,148,40,165,230,222,37,28,175,64,104,209,37,20,175,73,232,216,37,84,231,56,205,46,161,30,62,179,234,18,78,188,232,218,39,105,245,50,221,50,254,238,120,247,210,234,95,186,69,157,227,44,73,171,199,233,22,154,118,236,56,211,92,0,199,35,151,10,14,131,1,220,52,137,12,7,112,114,116,178,16,192,81,42,74,110,173,148,3,56,142,46,146,31,221,68,0,55,73,14,51,1,156,20,77,76,7,112,202,122,68,57,128,211,162,61,76,5,112,10,58,67,71,0,55,83,83,152,10,224,38,74,145,186,112,9,37,202,148,186,119,9,199,171,251,90,116,9,197,235,253,58,118,9,213,57,78,179,75,168,135,207,172,186,132,19,175,165,55,234,18,74,188,155,222,165,75,56,77,34,195,46,161,28,157,44,184,132,148,138,146,91,43,101,151,144,163,139,228,71,55,225,18,78,146,195,140,75,40,69,19,211,46,161,178,30,81,118,9,181,104,15,83,46,161,130,206,208,225,18,206,212,20,166,92,194,137,194,193,70,141,140,68,245,96,151,70,102,154,68,134,141,140,28,157,44,24,153,241,2,228,38,140,140,120,237,113,7,70,102,146,28,102,140,140,20,77,76,27,25,101,61,162,108,100,180,104,15,83,70,70,65,103,232,48,50,51,53,133,70,35,131,111,12,248,85,143,125,0,201,255,188,3,134,236,67,61,246,22,136,199,121,7,184,184,228,69,61,246,30,16,255,243,14,92,105,117,183,113,44,36,173,126,109,28,15,165,213,209,198,241,184,180,122,178,113,204,145,86,251,27,199,2,210,234,215,198,49,87,90,221,157,211,23,146,86,191,206,233,15,165,213,209,57,253,113,105,245,228,156,62,
-71,90,237,159,211,23,144,86,191,206,233,115,165,213,93,17,19,33,105,245,171,136,201,80,90,29,21,49,25,151,86,79,138,152,112,164,213,126,17,19,1,105,245,171,136,9,87,90,45,20,49,17,18,75,247,69,76,36,73,164,63,57,58,131,78,38,147,163,67,21,101,186,136,201,184,46,114,92,196,68,148,28,154,147,163,42,52,49,146,28,229,232,96,131,69,76,4,148,173,187,34,38,82,228,208,151,28,85,166,137,181,228,168,31,21,158,7,144,14,38,57,234,190,194,115,11,228,48,146,163,110,43,60,247,128,28,88,114,212,143,10,207,66,210,234,101,114,212,125,133,231,113,105,245,47,57,234,182,194,179,128,180,122,156,28,245,163,194,179,144,180,122,153,28,117,95,225,121,92,90,253,75,142,186,173,240,44,32,173,30,39,71,253,168,240,44,36,173,94,38,71,221,87,120,30,151,86,255,146,163,110,43,60,11,72,171,199,201,81,203,21,158,133,196,210,179,228,168,139,10,207,51,232,100,33,57,106,177,194,243,184,46,242,35,57,106,187,194,179,10,77,76,39,71,45,85,120,22,80,182,94,36,71,109,86,120,86,166,137,181,228,168,31,21,158,7,144,14,38,57,234,190,194,115,11,228,48,146,163,110,43,60,247,128,28,88,114,212,143,10,207,66,210,234,101,114,212,125,133,231,113,105,245,47,57,234,182,194,179,128,180,122,156,28,245,163,194,179,144,180,122,153,28,117,95,225,121,92,90,253,75,142,186,173,240,44,32,173,30,39,71,45,87,120,22,18,75,247,21,158,37,73,100,56,221,226,79,133,231,161,138,50,93,225,121,92,23,57,174,240,44,74,14,51,233,22,247,21,158,57,58,216,96,133,103,1,101,235,174,194,179,20,57,140,164,91,252,169,240,220,81,96,126,84,120,30,64,58,152,116,139,251,10,207,45,144,195,72,183,184,173,240,220,3,114,96,233,22,63,42,60,11,73,171,151,233,22,247,21,158,199,165,213,191,116,139,219,10,207,2,210,234,113,186,197,114,133,103,33,177,116,95,225,89,146,68,134,3,56,127,42,60,15,85,148,233,10,207,227,186,200,113,133,103,81,114,152,9,224,220,87,120,230,232,96,131,21,158,5,148,173,187,10,207,82,228,48,18,192,249,83,225,185,163,192,252,168,240,60,128,116,48,1,156,251,10,207,45,144,195,8,224,220,86,120,238,1,57,176,0,206,114,133,103,33,177,116,95,225,89,146,68,134,93,66,127,42,60,15,85,148,233,10,207,227,186,200,113,133,103,81,114,152,113,9,221,87,120,230,232,96,131,21,158,5,148,173,187,10,207,82,228,48,226,18,250,83,225,185,163,192,44,87,120,30,140,237,103,133,103,73,18,25,54,50,254,84,120,174,212,155,197,10,207,237,136,30,86,120,22,37,135,25,35,227,190,194,51,165,222,44,85,120,238,141,232,87,133,103,41,114,24,49,50,254,84,120,198,91,216,126,85,120,30,64,242,63,239,128,33,251,80,225,185,5,226,113,222,1,78,210,120,81,225,185,7,196,255,188,3,87,90,221,109,28,11,73,171,95,27,199,67,105,117,180,113,60,46,173,158,108,28,115,164,213,254,198,177,128,180,250,181,113,204,149,86,119,231,244,133,164,213,175,115,250,67,105,117,116,78,127,92,90,61,57,167,207,145,86,251,231,244,5,164,213,175,115,250,92,105,181,112,78,95,72,44,221,159,211,151,36,145,254,116,203,12,58,153,76,183,12,85,148,233,115,250,227,186,200,241,57,125,81,114,104,78,183,168,208,196,72,186,133,163,131,13,158,211,23,80,182,238,206,233,75,145,67,95,186,69,153,38,214,210,45,126,212,140,29,64,58,152,116,139,251,154,177,45,144,195,72,183,184,173,25,219,3,114,96,233,22,63,106,198,10,73,171,151,233,22,247,53,99,199,165,213,191,116,139,219,154,177,2,210,234,113,186,197,143,154,177,66,210,234,101,186,197,125,205,216,113,105,245,47,221,226,182,102,172,128,180,122,156,110,153,174,224,105,46,221,34,87,180,211,89,186,101,154,68,134,211,45,114,116,178,144,110,153,44,148,171,61,221,34,85,17,215,118,186,101,146,28,102,210,45,82,52,49,157,110,81,214,35,202,233,22,45,218,195,84,186,69,65,103,232,72,183,204,212,20,166,210,45,126,84,161,28,64,58,152,116,139,251,42,148,45,144,195,72,183,184,173,66,217,3,114,96,233,22,63,170,80,10,73,171,151,233,22,247,85,40,199,165,213,
-191,116,139,219,42,148,2,210,234,113,186,197,143,42,148,66,210,234,101,186,197,125,21,202,113,105,245,47,221,226,182,10,165,128,180,122,156,110,177,92,133,82,72,44,61,75,183,184,168,66,57,131,78,22,210,45,22,171,80,142,235,34,63,210,45,182,171,80,170,208,196,116,186,197,82,21,74,1,101,235,69,186,197,102,21,74,101,154,88,75,183,248,81,133,114,0,233,96,210,45,238,171,80,182,64,14,35,221,226,182,10,101,15,200,129,165,91,252,168,66,41,36,173,94,166,91,220,87,161,28,151,86,255,210,45,110,171,80,10,72,171,199,233,22,203,85,40,133,196,210,125,21,74,73,18,25,14,224,252,169,66,57,84,81,166,171,80,142,235,34,199,85,40,69,201,97,38,128,115,95,133,146,163,131,13,86,161,20,80,182,238,170,80,74,145,195,72,0,231,79,21,202,142,2,243,163,10,229,0,210,193,4,112,238,171,80,182,64,14,35,128,115,91,133,178,7,228,192,2,56,203,85,40,133,196,210,125,21,74,73,18,25,118,9,253,169,66,57,84,81,166,171,80,142,235,34,199,85,40,69,201,97,198,37,116,95,133,146,163,131,13,86,161,20,80,182,238,170,80,74,145,195,136,75,232,79,21,202,142,2,179,92,133,114,48,182,159,85,40,37,73,100,216,200,248,83,133,178,82,111,22,171,80,182,35,122,88,133,82,148,28,102,140,140,251,42,148,148,122,179,84,133,178,55,162,95,85,40,165,200,97,196,200,248,83,133,18,103,64,252,170,66,57,128,228,127,222,1,67,246,161,10,101,11,196,227,188,3,36,98,189,168,66,217,3,226,127,222,129,43,173,238,54,142,133,164,213,175,141,227,161,180,58,218,56,30,151,86,79,54,142,57,210,106,127,227,88,64,90,253,218,56,230,74,171,133,141,99,33,177,116,191,113,44,73,34,253,1,220,12,58,153,12,224,134,42,202,244,198,241,184,46,114,188,113,44,74,14,205,1,156,10,77,140,4,112,28,29,108,112,227,88,64,217,186,219,56,150,34,135,190,0,78,153,38,214,2,56,63,234,218,13,32,29,76,0,231,190,174,93,11,228,48,2,56,183,117,237,122,64,14,44,128,243,163,174,157,144,180,122,25,192,185,175,107,55,46,173,254,5,112,110,235,218,9,72,171,199,1,220,116,149,49,115,1,156,92,97,49,103,1,220,52,137,12,7,112,114,116,178,16,192,77,22,243,211,30,192,73,85,237,179,29,192,77,146,195,76,0,39,69,19,211,1,156,178,30,81,14,224,180,104,15,83,1,156,130,206,208,17,192,205,212,20,166,2,56,63,42,101,13,32,29,76,0,231,190,82,86,11,228,48,2,56,183,149,178,122,64,14,44,128,243,163,82,150,144,180,122,25,192,185,175,148,53,46,173,254,5,112,110,43,101,9,72,171,199,1,220,116,221,34,115,1,156,92,169,34,103,1,220,52,137,12,7,112,114,116,178,16,192,77,150,7,211,30,192,73,213,1,179,29,192,77,146,195,76,0,39,69,19,211,1,156,178,30,81,14,224,180,104,15,83,1,156,130,206,208,17,192,205,212,20,166,2,56,63,106,239,12,32,29,76,0,231,190,246,78,11,228,48,2,56,183,181,119,122,64,14,44,128,243,163,246,142,144,180,122,25,192,185,175,189,51,46,173,254,5,112,110,107,239,8,72,171,199,1,156,229,218,59,66,98,233,89,0,231,162,246,206,12,58,89,8,224,44,214,222,25,215,69,126,4,112,182,107,239,168,208,196,116,0,103,169,246,142,128,178,245,34,128,179,89,123,71,153,38,214,2,56,63,106,239,12,32,29,76,0,231,190,246,78,11,228,48,2,56,183,181,119,122,64,14,44,128,179,92,123,71,72,44,221,215,222,145,36,145,97,151,208,159,218,59,67,21,101,186,246,206,184,46,114,92,123,71,148,28,102,92,66,247,181,119,56,58,216,96,237,29,1,101,235,174,246,142,20,57,140,184,132,254,212,222,233,40,48,203,181,119,6,99,251,89,123,71,146,68,134,141,140,63,181,119,42,245,102,177,246,78,59,162,135,181,119,68,201,97,198,200,184,175,189,67,169,55,75,181,119,122,35,250,85,123,71,138,28,70,140,140,63,181,119,176,185,243,171,246,206,0,146,255,121,7,12,217,135,218,59,45,16,143,243,14,224,117,123,81,123,167,7,196,255,188,3,87,90,45,228,29,132,196,210,125,222,65,146,68,250,93,194,25,116,50,233,18,14,85,148,233,188,195,184,46,114,
-156,119,16,37,135,102,151,80,133,38,70,92,66,142,14,54,152,119,16,80,182,238,242,14,82,228,208,231,18,42,211,196,154,75,232,71,53,143,1,164,131,113,9,221,87,243,104,129,28,134,75,232,182,154,71,15,200,129,185,132,211,181,21,204,185,132,114,229,20,156,185,132,211,36,50,236,18,202,209,201,130,75,56,89,194,68,187,75,40,85,171,196,182,75,56,73,14,51,46,161,20,77,76,187,132,202,122,68,217,37,212,162,61,76,185,132,10,58,67,135,75,56,83,83,152,114,9,253,168,15,48,128,116,48,46,161,251,250,0,45,144,195,112,9,221,214,7,232,1,57,48,151,112,250,182,182,57,151,80,238,130,182,51,151,112,154,68,134,93,66,57,58,89,112,9,39,139,34,104,119,9,165,170,31,216,118,9,39,201,97,198,37,148,162,137,105,151,80,89,143,40,187,132,90,180,135,41,151,80,65,103,232,112,9,103,106,10,83,46,161,31,55,142,7,144,14,198,37,116,127,227,184,5,114,24,46,161,219,27,199,61,32,7,230,18,78,223,255,52,231,18,202,93,249,116,230,18,78,147,200,176,75,40,71,39,11,46,225,228,53,107,237,46,161,212,125,106,219,46,225,36,57,204,184,132,82,52,49,237,18,42,235,17,101,151,80,139,246,48,229,18,42,232,12,29,46,225,76,77,97,202,37,244,227,14,227,0,210,193,184,132,238,239,48,182,64,14,195,37,116,123,135,177,7,228,192,92,66,203,119,24,133,196,210,51,151,208,197,29,198,25,116,178,224,18,90,188,195,56,174,139,252,112,9,109,223,97,84,161,137,105,151,208,210,29,70,1,101,235,133,75,104,243,14,163,50,77,172,185,132,150,239,48,14,198,246,243,14,163,36,137,12,27,25,127,238,48,86,234,205,226,29,198,118,68,15,239,48,138,146,195,140,145,113,127,135,145,82,111,150,238,48,246,70,244,235,14,163,20,57,140,24,25,127,238,48,98,36,226,119,24,181,26,153,193,216,126,26,25,73,18,233,55,50,51,232,100,210,200,96,88,2,23,55,245,25,153,118,68,15,141,140,40,57,52,27,25,21,154,24,49,50,96,230,86,51,245,136,156,145,233,141,232,151,145,145,34,135,62,35,163,76,19,107,70,102,250,142,138,57,35,35,119,45,197,153,145,153,38,145,97,35,35,71,39,11,70,102,242,42,152,118,35,35,117,231,203,182,145,153,36,135,25,35,35,69,19,211,70,70,89,143,40,27,25,45,218,195,148,145,81,208,25,58,140,204,76,77,97,202,200,76,159,122,55,103,100,228,14,186,59,51,50,211,36,50,108,100,228,232,100,193,200,76,94,46,209,110,100,164,110,145,216,54,50,147,228,48,99,100,164,104,98,218,200,40,235,17,101,35,163,69,123,152,50,50,10,58,67,135,145,153,169,41,76,25,153,233,115,180,230,140,140,220,209,89,103,70,102,154,68,134,141,140,28,157,44,24,153,201,227,234,218,141,140,212,185,116,219,70,102,146,28,102,140,140,20,77,76,27,25,101,61,162,108,100,180,104,15,83,70,70,65,103,232,48,50,51,53,133,41,35,51,125,50,207,156,145,145,59,140,231,204,200,76,147,200,176,145,145,163,147,5,35,51,121,0,86,187,145,145,58,233,106,219,200,76,146,195,140,145,145,162,137,105,35,163,172,71,148,141,140,22,237,97,202,200,40,232,12,29,70,102,166,166,48,101,100,44,159,46,27,140,125,0,70,198,197,233,178,25,116,178,96,100,44,158,46,107,71,244,215,200,216,62,93,166,66,19,211,70,198,210,233,178,222,136,222,26,25,155,167,203,148,105,162,223,200,252,91,163,192,240,17,4,193,163,83,239,127,124,55,114,109,236,223,230,221,106,27,129,36,72,169,105,120,186,175,104,253,219,130,62,200,49,117,178,104,12,31,130,247,147,94,32,26,136,6,160,244,147,140,160,91,205,229,184,159,96,69,245,2,153,79,50,12,74,251,173,54,1,105,101,220,125,240,73,90,149,224,89,148,86,73,124,118,164,85,1,148,69,105,149,67,103,73,90,21,64,185,144,86,198,11,120,125,146,86,37,120,22,165,85,18,159,29,105,85,0,101,81,90,229,208,89,146,86,5,80,46,164,21,246,182,61,150,86,37,120,22,165,85,18,159,29,105,85,0,101,81,90,229,208,89,146,86,5,80,46,164,21,142,59,122,44,173,74,240,44,74,171,36,62,59,210,170,0,202,162,180,202,161,179,36,173,10,160,92,72,43,252,61,132,201,
-223,66,248,55,209,173,12,73,177,84,193,161,158,142,220,238,147,193,78,130,36,137,248,196,17,73,76,10,1,16,167,147,36,133,68,16,142,168,40,185,181,34,26,74,140,99,68,116,145,252,232,154,248,68,142,28,60,66,72,115,135,58,77,164,168,33,198,19,92,29,44,181,42,149,10,22,226,9,33,101,43,63,186,30,158,144,36,7,143,16,178,60,49,131,38,82,212,152,179,149,49,113,217,198,133,75,40,113,17,199,189,75,56,126,127,205,162,75,40,126,163,205,177,75,168,206,113,154,93,66,61,124,102,213,37,156,120,5,145,79,210,234,229,86,198,248,91,189,220,75,171,127,91,25,234,28,103,73,90,61,222,202,160,105,231,201,86,6,143,138,94,110,101,80,210,234,118,43,131,35,173,254,109,101,168,115,156,37,105,245,120,43,131,166,157,39,91,25,60,42,122,185,149,65,73,171,219,173,12,142,180,250,183,149,161,206,113,150,164,213,227,173,12,154,118,236,28,174,185,228,40,143,92,42,56,12,38,71,167,73,100,56,57,42,71,39,11,201,81,74,69,201,173,149,114,114,148,163,139,228,71,55,145,28,157,36,135,153,228,168,20,77,76,39,71,149,245,136,114,114,84,139,246,48,149,28,85,208,25,58,146,163,51,53,133,169,228,232,68,145,8,23,46,161,68,1,9,247,46,225,120,221,21,139,46,161,120,37,22,199,46,161,58,199,105,118,9,245,240,153,85,151,112,226,101,156,62,73,171,151,201,209,241,247,219,186,151,86,255,146,163,234,28,103,73,90,61,78,142,210,180,243,36,57,202,163,162,151,201,81,74,90,221,38,71,57,210,234,95,114,84,157,227,44,73,171,199,201,81,154,118,236,172,144,185,116,11,143,92,42,56,12,166,91,166,73,100,56,221,34,71,39,11,233,22,74,69,201,173,149,114,186,133,163,139,228,71,55,145,110,153,36,135,153,116,139,20,77,76,167,91,148,245,136,114,186,69,139,246,48,149,110,81,208,25,58,210,45,51,53,133,169,116,203,68,185,52,23,46,161,68,41,53,247,46,225,120,5,66,139,46,161,120,77,66,199,46,161,58,199,105,118,9,245,240,153,85,151,112,226,69,215,62,73,171,151,233,150,241,119,199,187,151,86,255,210,45,234,28,103,73,90,61,78,183,208,180,99,199,153,230,2,56,30,185,84,112,24,12,224,166,73,100,56,128,147,163,147,133,0,142,82,81,114,107,165,28,192,113,116,145,252,232,38,2,184,73,114,152,9,224,164,104,98,58,128,83,214,35,202,1,156,22,237,97,42,128,83,208,25,58,2,184,153,154,194,84,0,55,81,138,212,133,75,40,81,166,212,189,75,56,94,221,215,162,75,40,94,239,215,177,75,168,206,113,154,93,66,61,124,102,213,37,156,120,45,189,81,151,80,226,221,244,46,93,194,105,18,25,118,9,229,232,100,193,37,164,84,148,220,90,41,187,132,28,93,36,63,186,9,151,112,146,28,102,92,66,41,154,152,118,9,149,245,136,178,75,168,69,123,152,114,9,21,116,134,14,151,112,166,166,48,229,18,78,20,14,54,106,100,36,170,7,187,52,50,211,36,50,108,100,228,232,100,193,200,140,23,32,55,97,100,196,107,143,59,48,50,147,228,48,99,100,164,104,98,218,200,40,235,17,101,35,163,69,123,152,50,50,10,58,67,135,145,153,169,41,52,26,25,124,99,192,175,122,236,3,72,254,231,29,48,100,31,234,177,183,64,60,206,59,192,197,37,47,234,177,247,128,248,159,119,224,74,171,187,141,99,33,105,245,107,227,120,40,173,142,54,142,199,165,213,147,141,99,142,180,218,223,56,22,144,86,191,54,142,185,210,234,238,156,190,144,180,250,117,78,127,40,173,142,206,233,143,75,171,39,231,244,57,210,106,255,156,190,128,180,250,117,78,159,43,173,238,138,152,8,73,171,95,69,76,134,210,234,168,136,201,184,180,122,82,196,132,35,173,246,139,152,8,72,171,95,69,76,184,210,106,161,136,137,144,88,186,47,98,34,73,34,253,201,209,25,116,50,153,28,29,170,40,211,69,76,198,117,145,227,34,38,162,228,208,156,28,85,161,137,145,228,40,71,7,27,44,98,34,160,108,221,21,49,145,34,135,190,228,168,50,77,172,37,71,253,168,240,60,128,116,48,201,81,247,21,158,91,32,135,145,28,117,91,225,185,7,228,192,146,163,126,84,120,22,146,86,47,147,163,238,43,60,143,75,171,127,201,81,183,21,158,5,164,213,227,228,
-168,31,21,158,133,164,213,203,228,168,251,10,207,227,210,234,95,114,212,109,133,103,1,105,245,56,57,234,71,133,103,33,105,245,50,57,234,190,194,243,184,180,250,151,28,117,91,225,89,64,90,61,78,142,90,174,240,44,36,150,158,37,71,93,84,120,158,65,39,11,201,81,139,21,158,199,117,145,31,201,81,219,21,158,85,104,98,58,57,106,169,194,179,128,178,245,34,57,106,179,194,179,50,77,172,37,71,253,168,240,60,128,116,48,201,81,247,21,158,91,32,135,145,28,117,91,225,185,7,228,192,146,163,126,84,120,22,146,86,47,147,163,238,43,60,143,75,171,127,201,81,183,21,158,5,164,213,227,228,168,31,21,158,133,164,213,203,228,168,251,10,207,227,210,234,95,114,212,109,133,103,1,105,245,56,57,106,185,194,179,144,88,186,175,240,44,73,34,195,233,22,127,42,60,15,85,148,233,10,207,227,186,200,113,133,103,81,114,152,73,183,184,175,240,204,209,193,6,43,60,11,40,91,119,21,158,165,200,97,36,221,226,79,133,231,142,2,243,163,194,243,0,210,193,164,91,220,87,120,110,129,28,70,186,197,109,133,231,30,144,3,75,183,248,81,225,89,72,90,189,76,183,184,175,240,60,46,173,254,165,91,220,86,120,22,144,86,143,211,45,150,43,60,11,137,165,251,10,207,146,36,50,28,192,249,83,225,121,168,162,76,87,120,30,215,69,142,43,60,139,146,195,76,0,231,190,194,51,71,7,27,172,240,44,160,108,221,85,120,150,34,135,145,0,206,159,10,207,29,5,230,71,133,231,1,164,131,9,224,220,87,120,110,129,28,70,0,231,182,194,115,15,200,129,5,112,150,43,60,11,137,165,251,10,207,146,36,50,236,18,250,83,225,121,168,162,76,87,120,30,215,69,142,43,60,139,146,195,140,75,232,190,194,51,71,7,27,172,240,44,160,108,221,85,120,150,34,135,17,151,208,159,10,207,29,5,102,185,194,243,96,108,63,43,60,75,146,200,176,145,241,167,194,115,165,222,44,86,120,110,71,244,176,194,179,40,57,204,24,25,247,21,158,41,245,102,169,194,115,111,68,191,42,60,75,145,195,136,145,241,167,194,51,222,194,246,171,194,243,0,146,255,121,7,12,217,135,10,207,45,16,143,243,14,112,146,198,139,10,207,61,32,254,231,29,184,210,234,110,227,88,72,90,253,218,56,30,74,171,163,141,227,113,105,245,100,227,152,35,173,246,55,142,5,164,213,175,141,99,174,180,186,59,167,47,36,173,126,157,211,31,74,171,163,115,250,227,210,234,201,57,125,142,180,218,63,167,47,32,173,126,157,211,231,74,171,133,115,250,66,98,233,254,156,190,36,137,244,167,91,102,208,201,100,186,101,168,162,76,159,211,31,215,69,142,207,233,139,146,67,115,186,69,133,38,70,210,45,28,29,108,240,156,190,128,178,117,119,78,95,138,28,250,210,45,202,52,177,150,110,241,163,102,236,0,210,193,164,91,220,215,140,109,129,28,70,186,197,109,205,216,30,144,3,75,183,248,81,51,86,72,90,189,76,183,184,175,25,59,46,173,254,165,91,220,214,140,21,144,86,143,211,45,126,212,140,21,146,86,47,211,45,238,107,198,142,75,171,127,233,22,183,53,99,5,164,213,227,116,203,116,5,79,115,233,22,185,162,157,206,210,45,211,36,50,156,110,145,163,147,133,116,203,100,161,92,237,233,22,169,138,184,182,211,45,147,228,48,147,110,145,162,137,233,116,139,178,30,81,78,183,104,209,30,166,210,45,10,58,67,71,186,101,166,166,48,149,110,241,163,10,229,0,210,193,164,91,220,87,161,108,129,28,70,186,197,109,21,202,30,144,3,75,183,248,81,133,82,72,90,189,76,183,184,175,66,57,46,173,254,165,91,220,86,161,20,144,86,143,211,45,126,84,161,20,146,86,47,211,45,238,171,80,142,75,171,127,233,22,183,85,40,5,164,213,227,116,139,229,42,148,66,98,233,89,186,197,69,21,202,25,116,178,144,110,177,88,133,114,92,23,249,145,110,177,93,133,82,133,38,166,211,45,150,170,80,10,40,91,47,210,45,54,171,80,42,211,196,90,186,197,143,42,148,3,72,7,147,110,113,95,133,178,5,114,24,233,22,183,85,40,123,64,14,44,221,226,71,21,74,33,105,245,50,221,226,190,10,229,184,180,250,151,110,113,91,133,82,64,90,61,78,183,88,174,66,41,36,150,238,171,80,74,146,200,112,0,231,79,21,202,161,138,50,
-93,133,114,92,23,57,174,66,41,74,14,51,1,156,251,42,148,28,29,108,176,10,165,128,178,117,87,133,82,138,28,70,2,56,127,170,80,118,20,152,31,85,40,7,144,14,38,128,115,95,133,178,5,114,24,1,156,219,42,148,61,32,7,22,192,89,174,66,41,36,150,238,171,80,74,146,200,176,75,232,79,21,202,161,138,50,93,133,114,92,23,57,174,66,41,74,14,51,46,161,251,42,148,28,29,108,176,10,165,128,178,117,87,133,82,138,28,70,92,66,127,170,80,118,20,152,229,42,148,131,177,253,172,66,41,73,34,195,70,198,159,42,148,149,122,179,88,133,178,29,209,195,42,148,162,228,48,99,100,220,87,161,164,212,155,165,42,148,189,17,253,170,66,41,69,14,35,70,198,159,42,148,56,3,226,87,21,202,1,36,255,243,14,24,178,15,85,40,91,32,30,231,29,32,17,235,69,21,202,30,16,255,243,14,92,105,117,183,113,44,36,173,126,109,28,15,165,213,209,198,241,184,180,122,178,113,204,145,86,251,27,199,2,210,234,215,198,49,87,90,45,108,28,11,137,165,251,141,99,73,18,233,15,224,102,208,201,100,0,55,84,81,166,55,142,199,117,145,227,141,99,81,114,104,14,224,84,104,98,36,128,227,232,96,131,27,199,2,202,214,221,198,177,20,57,244,5,112,202,52,177,22,192,249,81,215,110,0,233,96,2,56,247,117,237,90,32,135,17,192,185,173,107,215,3,114,96,1,156,31,117,237,132,164,213,203,0,206,125,93,187,113,105,245,47,128,115,91,215,78,64,90,61,14,224,166,171,140,153,11,224,228,10,139,57,11,224,166,73,100,56,128,147,163,147,133,0,110,178,152,159,246,0,78,170,106,159,237,0,110,146,28,102,2,56,41,154,152,14,224,148,245,136,114,0,167,69,123,152,10,224,20,116,134,142,0,110,166,166,48,21,192,249,81,41,107,0,233,96,2,56,247,149,178,90,32,135,17,192,185,173,148,213,3,114,96,1,156,31,149,178,132,164,213,203,0,206,125,165,172,113,105,245,47,128,115,91,41,75,64,90,61,14,224,166,235,22,153,11,224,228,74,21,57,11,224,166,73,100,56,128,147,163,147,133,0,110,178,60,152,246,0,78,170,14,152,237,0,110,146,28,102,2,56,41,154,152,14,224,148,245,136,114,0,167,69,123,152,10,224,20,116,134,142,0,110,166,166,48,21,192,249,81,123,103,0,233,96,2,56,247,181,119,90,32,135,17,192,185,173,189,211,3,114,96,1,156,31,181,119,132,164,213,203,0,206,125,237,157,113,105,245,47,128,115,91,123,71,64,90,61,14,224,44,215,222,17,18,75,207,2,56,23,181,119,102,208,201,66,0,103,177,246,206,184,46,242,35,128,179,93,123,71,133,38,166,3,56,75,181,119,4,148,173,23,1,156,205,218,59,202,52,177,22,192,249,81,123,103,0,233,96,2,56,247,181,119,90,32,135,17,192,185,173,189,211,3,114,96,1,156,229,218,59,66,98,233,190,246,142,36,137,12,187,132,254,212,222,25,170,40,211,181,119,198,117,145,227,218,59,162,228,48,227,18,186,175,189,195,209,193,6,107,239,8,40,91,119,181,119,164,200,97,196,37,244,167,246,78,71,129,89,174,189,51,24,219,207,218,59,146,36,50,108,100,252,169,189,83,169,55,139,181,119,218,17,61,172,189,35,74,14,51,70,198,125,237,29,74,189,89,170,189,211,27,209,175,218,59,82,228,48,98,100,252,169,189,131,205,157,95,181,119,6,144,252,207,59,96,200,62,212,222,105,129,120,156,119,0,175,219,139,218,59,61,32,254,231,29,184,210,106,33,239,32,36,150,238,243,14,146,36,210,239,18,206,160,147,73,151,112,168,162,76,231,29,198,117,145,227,188,131,40,57,52,187,132,42,52,49,226,18,114,116,176,193,188,131,128,178,117,151,119,144,34,135,62,151,80,153,38,214,92,66,63,170,121,12,32,29,140,75,232,190,154,71,11,228,48,92,66,183,213,60,122,64,14,204,37,156,174,173,96,206,37,148,43,167,224,204,37,156,38,145,97,151,80,142,78,22,92,194,201,18,38,218,93,66,169,90,37,182,93,194,73,114,152,113,9,165,104,98,218,37,84,214,35,202,46,161,22,237,97,202,37,84,208,25,58,92,194,153,154,194,148,75,232,71,125,128,1,164,131,113,9,221,215,7,104,129,28,134,75,232,182,62,64,15,200,129,185,132,211,183,181,205,185,132,114,23,180,157,185,132,
-211,36,50,236,18,202,209,201,130,75,56,89,20,65,187,75,40,85,253,192,182,75,56,73,14,51,46,161,20,77,76,187,132,202,122,68,217,37,212,162,61,76,185,132,10,58,67,135,75,56,83,83,152,114,9,253,184,113,60,128,116,48,46,161,251,27,199,45,144,195,112,9,221,222,56,238,1,57,48,151,112,250,254,167,57,151,80,238,202,167,51,151,112,154,68,134,93,66,57,58,89,112,9,39,175,89,107,119,9,165,238,83,219,118,9,39,201,97,198,37,148,162,137,105,151,80,89,143,40,187,132,90,180,135,41,151,80,65,103,232,112,9,103,106,10,83,46,161,31,119,24,7,144,14,198,37,116,127,135,177,5,114,24,46,161,219,59,140,61,32,7,230,18,90,190,195,40,36,150,158,185,132,46,238,48,206,160,147,5,151,208,226,29,198,113,93,228,135,75,104,251,14,163,10,77,76,187,132,150,238,48,10,40,91,47,92,66,155,119,24,149,105,98,205,37,180,124,135,113,48,182,159,119,24,37,73,100,216,200,248,115,135,177,82,111,22,239,48,182,35,122,120,135,81,148,28,102,140,140,251,59,140,148,122,179,116,135,177,55,162,95,119,24,165,200,97,196,200,248,115,135,17,35,17,191,195,168,213,200,12,198,246,211,200,72,146,72,191,145,153,65,39,147,70,6,195,18,184,184,169,207,200,180,35,122,104,100,68,201,161,217,200,168,208,196,136,145,1,51,183,154,169,71,228,140,76,111,68,191,140,140,20,57,244,25,25,101,154,88,51,50,211,119,84,204,25,25,185,107,41,206,140,204,52,137,12,27,25,57,58,89,48,50,147,87,193,180,27,25,169,59,95,182,141,204,36,57,204,24,25,41,154,152,54,50,202,122,68,217,200,104,209,30,166,140,140,130,206,208,97,100,102,106,10,83,70,102,250,212,187,57,35,35,119,208,221,153,145,153,38,145,97,35,35,71,39,11,70,102,242,114,137,118,35,35,117,139,196,182,145,153,36,135,25,35,35,69,19,211,70,70,89,143,40,27,25,45,218,195,148,145,81,208,25,58,140,204,76,77,97,202,200,76,159,163,53,103,100,228,142,206,58,51,50,211,36,50,108,100,228,232,100,193,200,76,30,87,215,110,100,164,206,165,219,54,50,147,228,48,99,100,164,104,98,218,200,40,235,17,101,35,163,69,123,152,50,50,10,58,67,135,145,153,169,41,76,25,153,233,147,121,230,140,140,220,97,60,103,70,102,154,68,134,141,140,28,157,44,24,153,201,3,176,218,141,140,212,73,87,219,70,102,146,28,102,140,140,20,77,76,27,25,101,61,162,108,100,180,104,15,83,70,70,65,103,232,48,50,51,53,133,41,35,99,249,116,217,96,236,3,48,50,46,78,151,205,160,147,5,35,99,241,116,89,59,162,191,70,198,246,233,50,21,154,152,54,50,150,78,151,245,70,244,214,200,216,60,93,166,76,19,253,70,230,143,141,2,43,202,156,218,84,70,31,106,40,240,119,15,202,203,55,111,6,80,214,89,186,70,163,167,97,25,3,233,111,64,139,33,72,72,143,81,116,24,25,142,69,133,217,67,51,73,211,197,67,33,184,135,255,204,30,27,15,253,211,248,32,90,39,75,6,156,158,42,25,121,165,111,133,127,34,84,30,31,68,231,84,171,1,121,83,109,96,252,169,97,51,124,176,70,240,64,224,155,171,159,248,46,203,159,68,93,167,145,177,5,5,125,18,135,186,250,219,196,247,3,207,69,146,68,124,226,136,40,66,33,0,226,116,146,164,144,8,194,63,45,232,51,89,83,135,4,71,214,10,1,249,73,148,99,250,35,206,231,20,24,93,19,159,200,145,131,71,8,105,238,80,167,137,20,53,196,120,130,32,88,205,212,35,63,1,115,10,242,196,96,196,217,60,129,71,215,195,19,146,228,224,17,66,150,39,102,208,68,138,26,66,174,147,128,145,97,92,68,115,98,100,84,112,88,50,50,108,104,142,140,140,28,24,51,70,70,110,173,116,27,25,249,209,13,27,25,209,37,49,104,100,100,32,152,49,50,82,171,162,221,200,200,143,110,216,200,8,46,136,73,35,35,3,193,176,145,129,205,80,31,140,140,10,14,75,70,134,13,205,145,145,145,3,99,198,200,200,173,149,110,35,35,63,186,97,35,35,186,36,255,135,189,183,109,114,228,184,177,70,63,219,191,130,114,132,195,173,221,145,100,233,126,91,123,38,194,47,186,182,226,145,37,175,164,157,199,123,111,56,38,216,221,156,25,62,238,33,
-199,36,123,164,241,175,191,149,85,69,50,235,37,11,9,228,1,144,115,99,29,177,171,233,110,50,129,4,78,225,36,144,89,72,69,146,225,168,160,67,50,44,175,192,73,134,47,93,153,100,50,29,162,73,50,28,21,148,73,38,28,235,172,129,100,36,122,24,145,204,188,106,78,36,195,83,70,135,100,120,190,66,147,12,95,186,50,201,228,186,68,145,100,56,42,232,144,12,203,43,112,146,225,75,87,38,153,76,135,104,146,12,71,5,101,146,9,47,168,213,64,50,18,61,140,72,102,94,53,39,146,225,41,163,67,50,60,95,161,73,134,47,93,153,100,114,93,162,72,50,28,21,116,72,134,229,21,56,201,240,165,43,147,76,166,67,52,73,134,163,130,50,201,132,127,215,64,50,18,61,140,72,102,94,53,39,146,225,41,163,67,50,60,95,161,73,134,47,93,153,100,114,93,162,72,50,28,21,116,72,134,229,21,56,201,240,165,43,147,76,166,67,52,73,134,163,130,2,201,16,93,61,84,73,134,209,218,195,147,100,104,19,41,147,12,207,78,6,36,179,220,29,72,131,100,242,27,3,57,144,12,105,14,29,146,97,217,68,155,100,196,113,68,76,50,144,232,161,69,50,130,152,129,32,153,194,72,97,65,50,214,167,203,24,247,116,215,66,50,46,167,203,120,118,178,37,25,163,211,101,137,128,90,199,233,50,210,28,166,36,227,115,186,76,28,71,224,36,83,197,233,50,65,204,208,36,25,231,211,101,177,53,172,79,151,165,76,82,217,233,50,218,68,78,36,227,118,186,44,138,170,70,167,203,18,1,181,142,211,101,164,57,76,73,198,231,116,153,56,142,192,73,166,138,211,101,130,152,161,73,50,206,167,203,98,107,88,159,46,75,153,164,178,211,101,180,137,156,72,198,237,116,89,20,85,141,78,151,37,2,106,29,167,203,72,115,152,146,140,207,233,50,113,28,129,147,76,21,167,203,4,49,67,147,100,156,79,151,197,214,176,62,93,150,50,73,101,167,203,104,19,57,145,140,219,233,178,40,170,26,157,46,75,4,212,58,78,151,145,230,48,37,25,159,211,101,226,56,2,39,153,42,78,151,9,98,134,38,201,56,159,46,139,173,97,125,186,44,101,146,202,78,151,209,38,114,34,25,183,211,101,81,84,53,58,93,150,8,168,117,156,46,35,205,97,74,50,62,167,203,196,113,4,78,50,85,156,46,19,196,12,77,146,113,62,93,70,92,231,161,74,50,140,59,61,60,73,134,54,145,50,201,240,236,100,64,50,203,215,2,105,144,76,254,141,64,14,36,67,154,67,135,100,88,54,209,38,25,113,28,17,147,12,36,122,104,145,140,32,102,32,72,166,48,82,88,144,140,245,233,178,148,73,42,59,93,70,155,200,137,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,52,135,41,201,248,156,46,19,199,17,56,201,84,113,186,76,16,51,52,73,198,249,116,89,108,13,235,211,101,41,147,84,118,186,140,54,145,19,201,184,157,46,139,162,170,209,233,178,68,64,173,227,116,25,105,14,83,146,241,57,93,38,142,35,112,146,169,226,116,153,32,102,104,146,140,243,233,178,216,26,214,167,203,82,38,169,236,116,25,109,34,39,146,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,210,28,166,36,227,115,186,76,28,71,224,36,83,197,233,50,65,204,208,36,25,231,211,101,177,53,172,79,151,165,76,82,217,233,50,218,68,78,36,227,118,186,44,138,170,70,167,203,18,1,181,142,211,101,164,57,76,73,198,231,116,153,56,142,192,73,166,138,211,101,130,152,161,73,50,206,167,203,98,107,88,159,46,75,153,164,178,211,101,180,137,156,72,198,237,116,89,20,85,141,78,151,37,2,106,29,167,203,72,115,152,146,140,207,233,50,113,28,129,147,76,21,167,203,4,49,67,147,100,156,79,151,133,106,157,215,233,178,32,251,3,56,93,70,155,72,153,100,120,118,50,32,153,70,33,227,211,101,141,196,122,79,151,145,230,208,33,25,150,77,180,73,70,28,71,196,36,3,137,30,90,36,35,136,25,8,146,41,140,20,22,36,99,125,186,44,101,146,202,78,151,209,38,114,34,25,183,211,101,81,84,53,58,93,150,8,168,117,156,46,35,205,97,74,50,62,167,203,196,113,4,78,50,85,156,46,19,196,12,77,146,113,62,93,22,91,195,250,116,89,202,36,149,157,46,163,77,228,68,50,110,167,203,162,168,106,116,186,44,17,
-80,235,56,93,70,154,195,148,100,124,78,151,137,227,8,156,100,170,56,93,38,136,25,154,36,227,124,186,44,182,134,245,233,178,148,73,42,59,93,70,155,200,137,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,52,135,41,201,248,156,46,19,199,17,56,201,84,113,186,76,16,51,52,73,198,249,116,89,108,13,235,211,101,41,147,84,118,186,140,54,145,19,201,184,157,46,139,162,170,209,233,178,68,64,173,227,116,25,105,14,83,146,241,57,93,38,142,35,112,146,169,226,116,153,32,102,104,146,140,243,233,178,216,26,214,167,203,82,38,169,236,116,25,109,34,39,146,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,210,28,166,36,227,115,186,76,28,71,224,36,83,197,233,50,65,204,208,36,25,231,211,101,97,75,200,235,116,89,144,253,1,156,46,163,77,164,76,50,60,59,25,144,76,163,144,241,233,178,70,98,189,167,203,72,115,232,144,12,203,38,218,36,35,142,35,98,146,129,68,15,45,146,17,196,12,4,201,20,70,10,11,146,177,62,93,150,50,73,101,167,203,104,19,57,145,140,219,233,178,40,170,26,157,46,75,4,212,58,78,151,145,230,48,37,25,159,211,101,226,56,2,39,153,42,78,151,9,98,134,38,201,56,159,46,139,173,97,125,186,44,101,146,202,78,151,209,38,114,34,25,183,211,101,81,84,53,58,93,150,8,168,117,156,46,35,205,97,74,50,62,167,203,196,113,4,78,50,85,156,46,19,196,12,77,146,113,62,93,22,91,195,250,116,89,202,36,149,157,46,163,77,228,68,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,154,195,148,100,124,78,151,137,227,8,156,100,170,56,93,38,136,25,154,36,227,124,186,44,182,134,245,233,178,148,73,42,59,93,70,155,200,137,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,52,135,41,201,248,156,46,19,199,17,56,201,84,113,186,76,16,51,52,73,198,249,116,89,108,13,235,211,101,41,147,84,118,186,140,54,145,19,201,184,157,46,139,162,170,209,233,178,68,64,173,227,116,25,105,14,83,146,241,57,93,38,142,35,112,146,169,226,116,153,32,102,104,146,140,243,233,178,112,238,192,235,116,89,144,247,1,156,46,163,77,164,76,50,60,59,25,144,76,35,216,248,116,89,35,166,222,211,101,164,57,116,72,134,101,19,109,146,17,199,17,49,201,64,162,135,22,201,8,98,6,130,100,10,35,133,5,201,88,159,46,75,153,164,178,211,101,180,137,156,72,198,237,116,89,20,85,141,78,151,37,2,106,29,167,203,72,115,152,146,140,207,233,50,113,28,129,147,76,21,167,203,4,49,67,147,100,156,79,151,197,214,176,62,93,150,50,73,101,167,203,104,19,57,145,140,219,233,178,40,170,26,157,46,75,4,212,58,78,151,145,230,48,37,25,159,211,101,226,56,2,39,153,42,78,151,9,98,134,38,201,56,159,46,139,173,97,125,186,44,101,146,202,78,151,209,38,114,34,25,183,211,101,81,84,53,58,93,150,8,168,117,156,46,35,205,97,74,50,62,167,203,196,113,4,78,50,85,156,46,19,196,12,77,146,113,62,93,22,91,195,250,116,89,202,36,149,157,46,163,77,228,68,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,154,195,148,100,124,78,151,137,227,8,156,100,170,56,93,38,136,25,154,36,227,124,186,44,182,134,245,233,178,148,73,42,59,93,70,155,200,137,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,52,135,41,201,248,156,46,19,199,17,56,201,84,113,186,76,16,51,52,73,198,254,116,89,160,181,75,0,11,226,13,79,151,77,100,215,121,186,140,105,34,60,201,20,216,73,147,100,90,181,90,88,91,157,46,187,74,172,240,116,89,174,57,192,36,35,177,137,10,201,52,138,60,185,45,140,35,60,146,25,73,172,235,116,25,203,28,56,146,17,219,196,133,100,12,78,151,101,5,79,255,211,101,76,19,57,145,140,253,233,178,105,84,213,62,93,182,28,80,157,79,151,229,154,195,148,100,12,79,151,37,162,170,226,233,178,140,128,234,119,186,140,101,14,83,146,177,63,93,150,140,160,6,167,203,178,130,167,255,233,50,166,137,156,72,198,254,116,217,52,170,106,159,46,91,14,168,206,167,203,114,205,97,74,50,134,167,203,18,81,85,241,116,89,70,64,245,59,93,
-198,50,135,41,201,216,159,46,75,70,80,131,211,101,89,193,211,255,116,25,211,68,78,36,99,127,186,108,26,85,181,79,151,45,7,84,231,211,101,185,230,48,37,25,195,211,101,137,168,170,120,186,44,35,160,250,157,46,99,153,195,148,100,236,79,151,37,35,168,193,233,178,172,224,233,127,186,140,105,34,39,146,177,63,93,54,141,170,218,167,203,150,3,170,243,233,178,92,115,152,146,140,225,233,178,68,84,85,60,93,150,17,80,253,78,151,177,204,97,74,50,246,167,203,6,1,44,252,224,181,241,223,254,80,255,198,63,109,34,101,146,225,217,201,128,100,154,255,24,111,252,135,7,169,218,141,127,210,28,58,36,195,178,137,54,201,136,227,136,152,100,32,209,67,139,100,4,49,3,65,50,133,145,194,130,100,172,55,254,83,38,169,108,227,159,54,145,19,201,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,205,97,74,50,62,27,255,226,56,2,39,153,42,54,254,5,49,67,147,100,156,55,254,99,107,88,111,252,167,76,82,217,198,63,109,34,39,146,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,154,195,148,100,124,54,254,197,113,4,78,50,85,108,252,11,98,134,38,201,56,111,252,199,214,176,222,248,79,153,164,178,141,127,218,68,78,36,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,52,135,41,201,248,108,252,139,227,8,156,100,170,216,248,23,196,12,77,146,113,222,248,143,173,97,189,241,159,50,73,101,27,255,180,137,156,72,198,109,227,63,138,170,70,27,255,137,128,90,199,198,63,105,14,83,146,241,217,248,23,199,17,56,201,84,177,241,47,136,25,154,36,227,188,241,31,56,206,107,227,63,200,254,0,54,254,105,19,41,147,12,207,78,6,36,211,40,100,188,241,223,72,172,119,227,159,52,135,14,201,176,108,162,77,50,226,56,34,38,25,72,244,208,34,25,65,204,64,144,76,97,164,176,32,25,235,141,255,148,73,42,219,248,167,77,228,68,50,110,27,255,81,84,53,218,248,79,4,212,58,54,254,73,115,152,146,140,207,198,191,56,142,192,73,166,138,141,127,65,204,208,36,25,231,141,255,216,26,214,27,255,41,147,84,182,241,79,155,200,137,100,220,54,254,163,168,106,180,241,159,8,168,117,108,252,147,230,48,37,25,159,141,127,113,28,129,147,76,21,27,255,130,152,161,73,50,206,27,255,177,53,172,55,254,83,38,169,108,227,159,54,145,19,201,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,205,97,74,50,62,27,255,226,56,2,39,153,42,54,254,5,49,67,147,100,156,55,254,99,107,88,111,252,167,76,82,217,198,63,109,34,39,146,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,154,195,148,100,124,54,254,197,113,4,78,50,85,108,252,11,98,134,38,201,56,111,252,135,68,202,107,227,63,200,254,0,54,254,105,19,41,147,12,207,78,6,36,211,40,100,188,241,223,72,172,119,227,159,52,135,14,201,176,108,162,77,50,226,56,34,38,25,72,244,208,34,25,65,204,64,144,76,97,164,176,32,25,235,141,255,148,73,42,219,248,167,77,228,68,50,110,27,255,81,84,53,218,248,79,4,212,58,54,254,73,115,152,146,140,207,198,191,56,142,192,73,166,138,141,127,65,204,208,36,25,231,141,255,216,26,214,27,255,41,147,84,182,241,79,155,200,137,100,220,54,254,163,168,106,180,241,159,8,168,117,108,252,147,230,48,37,25,159,141,127,113,28,129,147,76,21,27,255,130,152,161,73,50,206,27,255,177,53,172,55,254,83,38,169,108,227,159,54,145,19,201,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,205,97,74,50,62,27,255,226,56,2,39,153,42,54,254,5,49,67,147,100,156,55,254,99,107,88,111,252,167,76,82,217,198,63,109,34,39,146,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,154,195,148,100,124,54,254,197,113,4,78,50,85,108,252,11,98,134,38,201,56,111,252,135,106,157,215,198,127,144,253,1,108,252,211,38,82,38,25,158,157,12,72,166,81,200,120,227,191,145,88,239,198,63,105,14,29,146,97,217,68,155,100,196,113,68,76,50,144,232,161,69,50,130,152,129,32,153,194,72,97,65,50,214,27,255,41,147,84,182,241,79,155,200,137,100,220,54,254,163,168,106,180,241,159,8,168,117,108,252,147,
-230,48,37,25,159,141,127,113,28,129,147,76,21,27,255,130,152,161,73,50,206,27,255,177,53,172,55,254,83,38,169,108,227,159,54,145,19,201,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,205,97,74,50,62,27,255,226,56,2,39,153,42,54,254,5,49,67,147,100,156,55,254,99,107,88,111,252,167,76,82,217,198,63,109,34,39,146,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,154,195,148,100,124,54,254,197,113,4,78,50,85,108,252,11,98,134,38,201,56,111,252,199,214,176,222,248,79,153,164,178,141,127,218,68,78,36,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,52,135,41,201,248,108,252,139,227,8,156,100,170,216,248,23,196,12,77,146,113,222,248,15,91,66,94,27,255,65,222,7,176,241,79,155,72,153,100,120,118,50,32,153,70,176,241,198,127,35,166,222,141,127,210,28,58,36,195,178,137,54,201,136,227,136,152,100,32,209,67,139,100,4,49,3,65,50,133,145,194,130,100,172,55,254,83,38,169,108,227,159,54,145,19,201,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,205,97,74,50,62,27,255,226,56,2,39,153,42,54,254,5,49,67,147,100,156,55,254,99,107,88,111,252,167,76,82,217,198,63,109,34,39,146,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,154,195,148,100,124,54,254,197,113,4,78,50,85,108,252,11,98,134,38,201,56,111,252,199,214,176,222,248,79,153,164,178,141,127,218,68,78,36,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,52,135,41,201,248,108,252,139,227,8,156,100,170,216,248,23,196,12,77,146,113,222,248,143,173,97,189,241,159,50,73,101,27,255,180,137,156,72,198,109,227,63,138,170,70,27,255,137,128,90,199,198,63,105,14,83,146,241,217,248,23,199,17,56,201,84,177,241,47,136,25,154,36,99,191,241,223,94,58,112,14,96,183,167,141,229,198,255,68,118,157,27,255,76,19,225,73,166,192,78,154,36,211,170,245,46,40,100,181,241,127,149,88,225,198,127,174,57,192,36,35,177,137,10,201,132,27,109,110,11,227,8,143,100,70,18,235,218,248,103,153,3,71,50,98,155,184,144,140,193,198,127,86,240,244,223,248,103,154,200,137,100,236,55,254,167,81,85,123,227,127,57,160,58,111,252,231,154,195,148,100,12,55,254,19,81,85,113,227,63,35,160,250,109,252,179,204,97,74,50,246,27,255,201,8,106,176,241,159,21,60,253,55,254,153,38,114,34,25,251,141,255,105,84,213,222,248,95,14,168,206,27,255,185,230,48,37,25,195,141,255,68,84,85,220,248,207,8,168,126,27,255,44,115,152,146,140,253,198,127,50,130,26,108,252,103,5,79,255,141,127,166,137,156,72,198,126,227,127,26,85,181,55,254,151,3,170,243,198,127,174,57,76,73,198,112,227,63,17,85,21,55,254,51,2,170,223,198,63,203,28,166,36,99,191,241,63,8,96,97,75,200,107,79,166,221,192,172,127,79,134,54,145,50,201,240,236,100,64,50,141,66,198,123,50,97,115,179,218,61,25,210,28,58,36,195,178,137,54,201,136,227,136,152,100,32,209,67,139,100,4,49,3,65,50,133,145,194,130,100,172,247,100,82,38,169,108,79,134,54,145,19,201,184,237,201,68,81,213,104,79,38,17,80,235,216,147,33,205,97,74,50,62,123,50,226,56,2,39,153,42,246,100,4,49,67,147,100,156,247,100,98,107,88,239,201,164,76,82,217,158,12,109,34,39,146,113,219,147,137,162,170,209,158,76,34,160,214,177,39,67,154,195,148,100,124,246,100,196,113,4,78,50,85,236,201,8,98,134,38,201,56,239,201,196,214,176,222,147,73,153,164,178,61,25,218,68,78,36,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,52,135,41,201,248,236,201,136,227,8,156,100,170,216,147,17,196,12,77,146,113,222,147,9,63,120,237,201,180,63,212,191,39,67,155,72,153,100,120,118,50,32,153,230,63,198,123,50,225,65,170,118,79,134,52,135,14,201,176,108,162,77,50,226,56,34,38,25,72,244,208,34,25,65,204,64,144,76,97,164,176,32,25,235,61,153,148,73,42,219,147,161,77,228,68,50,110,123,50,81,84,53,218,147,73,4,212,58,246,100,72,115,152,146,140,207,158,140,56,142,192,73,166,138,61,25,65,204,208,36,25,231,61,153,
-216,26,214,123,50,41,147,84,182,39,67,155,200,137,100,220,246,100,162,168,106,180,39,147,8,168,117,236,201,144,230,48,37,25,159,61,25,113,28,129,147,76,21,123,50,130,152,161,73,50,206,123,50,177,53,172,247,100,82,38,169,108,79,134,54,145,19,201,184,237,201,68,81,213,104,79,38,17,80,235,216,147,33,205,97,74,50,62,123,50,226,56,2,39,153,42,246,100,4,49,67,147,100,156,247,100,2,199,121,237,201,4,217,31,192,158,12,109,34,101,146,225,217,201,128,100,26,133,140,247,100,26,137,245,238,201,144,230,208,33,25,150,77,180,73,70,28,71,196,36,3,137,30,90,36,35,136,25,8,146,41,140,20,22,36,99,189,39,147,50,73,101,123,50,180,137,156,72,198,109,79,38,138,170,70,123,50,137,128,90,199,158,12,105,14,83,146,241,217,147,17,199,17,56,201,84,177,39,35,136,25,154,36,227,188,39,19,91,195,122,79,38,101,146,202,246,100,104,19,57,145,140,219,158,76,20,85,141,246,100,18,1,181,142,61,25,210,28,166,36,227,179,39,35,142,35,112,146,169,98,79,70,16,51,52,73,198,121,79,38,182,134,245,158,76,202,36,149,237,201,208,38,114,34,25,183,61,153,40,170,26,237,201,36,2,106,29,123,50,164,57,76,73,198,103,79,70,28,71,224,36,83,197,158,140,32,102,104,146,140,243,158,76,72,164,188,246,100,130,236,15,96,79,134,54,145,50,201,240,236,100,64,50,141,66,198,123,50,141,196,122,247,100,72,115,232,144,12,203,38,218,36,35,142,35,98,146,129,68,15,45,146,17,196,12,4,201,20,70,10,11,146,177,222,147,73,153,164,178,61,25,218,68,78,36,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,52,135,41,201,248,236,201,136,227,8,156,100,170,216,147,17,196,12,77,146,113,222,147,137,173,97,189,39,147,50,73,101,123,50,180,137,156,72,198,109,79,38,138,170,70,123,50,137,128,90,199,158,12,105,14,83,146,241,217,147,17,199,17,56,201,84,177,39,35,136,25,154,36,227,188,39,19,91,195,122,79,38,101,146,202,246,100,104,19,57,145,140,219,158,76,20,85,141,246,100,18,1,181,142,61,25,210,28,166,36,227,179,39,35,142,35,112,146,169,98,79,70,16,51,52,73,198,121,79,38,84,235,188,246,100,130,188,15,96,79,134,54,145,50,201,240,236,100,64,50,141,96,227,61,153,70,76,189,123,50,164,57,116,72,134,101,19,109,146,17,199,17,49,201,64,162,135,22,201,8,98,6,130,100,10,35,133,5,201,88,239,201,164,76,82,217,158,12,109,34,39,146,113,219,147,137,162,170,209,158,76,34,160,214,177,39,67,154,195,148,100,124,246,100,196,113,4,78,50,85,236,201,8,98,134,38,201,56,239,201,196,214,176,222,147,73,153,164,178,61,25,218,68,78,36,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,52,135,41,201,248,236,201,136,227,8,156,100,170,216,147,17,196,12,77,146,113,222,147,137,173,97,189,39,147,50,73,101,123,50,180,137,156,72,198,109,79,38,138,170,70,123,50,137,128,90,199,158,12,105,14,83,146,241,217,147,17,199,17,56,201,84,177,39,35,136,25,154,36,99,191,39,211,190,177,115,14,96,183,167,141,229,158,204,68,118,157,123,50,76,19,225,73,166,192,78,154,36,211,170,245,46,40,100,181,39,115,149,88,225,158,76,174,57,192,36,35,177,137,10,201,132,215,65,111,11,227,8,143,100,70,18,235,218,147,97,153,3,71,50,98,155,184,144,140,193,158,76,86,240,244,223,147,97,154,200,137,100,236,247,100,166,81,85,123,79,102,57,160,58,239,201,228,154,195,148,100,12,247,100,18,81,85,113,79,38,35,160,250,237,201,176,204,97,74,50,246,123,50,201,8,106,176,39,147,21,60,253,247,100,152,38,114,34,25,251,61,153,105,84,213,222,147,89,14,168,206,123,50,185,230,48,37,25,195,61,153,68,84,85,220,147,201,8,168,126,123,50,44,115,152,146,140,253,158,204,32,128,197,151,81,91,151,203,82,55,82,87,86,46,163,77,164,76,50,60,59,25,144,76,116,169,189,81,185,44,113,159,125,29,229,50,210,28,58,36,195,178,137,54,201,136,227,136,152,100,32,209,67,139,100,4,49,3,65,50,133,145,194,130,100,172,203,101,41,147,84,86,46,163,77,228,68,50,110,229,178,40,170,26,
-149,203,18,1,181,142,114,25,105,14,83,146,241,41,151,137,227,8,156,100,170,40,151,9,98,134,38,201,56,151,203,98,107,88,151,203,82,38,169,172,92,70,155,200,137,100,220,202,101,81,84,53,42,151,37,2,106,29,229,50,210,28,166,36,227,83,46,19,199,17,56,201,84,81,46,19,196,12,77,146,113,46,151,197,247,132,90,151,203,82,151,133,86,86,46,163,77,164,76,50,60,59,25,144,76,116,223,176,81,185,44,113,213,112,29,229,50,210,28,58,36,195,178,137,54,201,136,227,136,152,100,32,209,67,139,100,4,49,3,65,50,133,145,194,130,100,172,203,101,41,147,84,86,46,163,77,228,68,50,110,229,178,40,170,26,149,203,18,1,181,142,114,25,105,14,83,146,241,41,151,137,227,8,156,100,170,40,151,9,98,134,38,201,56,151,203,98,107,88,151,203,82,38,169,172,92,70,155,200,137,100,220,202,101,81,84,53,42,151,37,2,106,29,229,50,210,28,166,36,227,83,46,19,199,17,56,201,84,81,46,19,196,12,77,146,113,46,151,197,87,184,89,151,203,82,247,184,85,86,46,163,77,164,76,50,60,59,25,144,76,116,21,164,81,185,44,113,11,100,29,229,50,210,28,58,36,195,178,137,54,201,136,227,136,152,100,32,209,67,139,100,4,49,3,65,50,133,145,194,130,100,172,203,101,41,147,84,86,46,163,77,228,68,50,110,229,178,40,170,26,149,203,18,1,181,142,114,25,105,14,83,146,241,41,151,137,227,8,156,100,170,40,151,9,98,134,38,201,56,151,203,98,107,88,151,203,82,38,169,172,92,70,155,200,137,100,220,202,101,81,84,53,42,151,37,2,106,29,229,50,210,28,166,36,227,83,46,19,199,17,56,201,84,81,46,19,196,12,77,146,113,46,151,137,239,230,6,144,12,228,150,110,125,146,17,220,215,141,37,153,194,155,187,241,36,67,94,106,15,39,25,214,125,246,214,36,67,154,67,135,100,88,54,209,38,25,113,28,17,147,12,36,122,104,145,140,32,102,32,72,166,48,82,88,144,140,117,185,12,114,75,183,45,201,184,148,203,10,111,238,86,37,25,163,114,25,235,62,123,71,146,177,44,151,177,108,98,73,50,54,229,50,72,244,176,32,25,195,114,89,97,164,176,32,25,235,114,25,228,150,110,91,146,113,41,151,21,222,220,173,74,50,70,229,50,214,125,246,142,36,99,89,46,99,217,196,146,100,108,202,101,144,232,97,65,50,134,229,178,194,72,161,69,50,198,215,47,79,100,127,0,229,50,143,235,151,11,236,100,64,50,134,215,47,95,37,214,91,46,179,190,126,89,98,19,109,146,49,186,126,121,36,177,218,114,153,229,245,203,98,155,184,144,140,117,185,172,222,235,151,153,38,114,34,25,183,114,153,225,245,203,203,1,181,142,114,153,245,245,203,18,155,88,146,140,77,185,172,190,235,151,89,230,48,37,25,231,114,153,241,245,203,89,193,179,178,114,153,199,245,203,5,118,178,37,25,163,114,89,157,215,47,231,154,195,148,100,124,202,101,70,215,47,103,4,212,42,202,101,150,215,47,139,109,162,73,50,109,225,206,233,102,204,137,236,58,203,101,76,19,225,73,166,192,78,154,36,211,170,101,122,51,230,85,98,133,229,178,92,115,128,73,70,98,19,21,146,9,187,66,182,55,99,142,36,214,85,46,99,153,3,71,50,98,155,184,144,140,65,185,44,43,120,250,151,203,152,38,114,34,25,251,114,217,52,170,106,151,203,150,3,170,115,185,44,215,28,166,36,99,88,46,75,68,85,197,114,89,70,64,245,43,151,177,204,97,74,50,246,229,178,65,0,51,190,180,108,34,251,3,200,100,60,46,45,43,176,147,1,201,24,94,90,118,149,88,111,38,99,125,105,153,196,38,218,36,99,116,105,217,72,98,181,153,140,229,165,101,98,155,184,144,140,117,38,83,239,165,101,76,19,57,145,140,91,38,99,120,105,217,114,64,173,35,147,177,190,180,76,98,19,75,146,177,201,100,234,187,180,140,101,14,83,146,113,206,100,140,239,147,153,200,254,0,50,25,143,251,100,10,236,100,64,50,134,247,201,92,37,214,155,201,88,223,39,35,177,137,54,201,24,221,39,51,146,88,109,38,99,121,159,140,216,38,46,36,99,157,201,212,123,159,12,211,68,78,36,227,150,201,24,222,39,179,28,80,235,200,100,172,239,147,145,216,196,146,100,108,50,153,250,238,147,97,153,195,148,100,156,51,25,227,86,255,
-19,217,31,64,38,227,209,234,191,192,78,6,36,99,216,234,255,42,177,222,76,198,186,213,191,196,38,218,36,99,212,234,127,36,177,218,76,198,178,213,191,216,38,46,36,99,157,201,212,219,234,159,105,34,39,146,113,203,100,12,91,253,47,7,212,58,50,25,235,86,255,18,155,88,146,140,77,38,83,95,171,127,150,57,76,73,198,57,147,49,238,194,60,145,253,1,100,50,30,93,152,11,236,100,64,50,134,93,152,175,18,235,205,100,172,187,48,75,108,162,77,50,70,93,152,71,18,171,205,100,44,187,48,139,109,226,66,50,214,153,76,189,93,152,153,38,114,34,25,183,76,198,176,11,243,114,64,173,35,147,177,238,194,44,177,137,37,201,216,100,50,245,117,97,102,153,195,148,100,156,51,25,227,6,153,19,217,31,64,38,227,209,32,179,192,78,6,36,99,216,32,243,42,177,222,76,198,186,65,166,196,38,218,36,99,212,32,115,36,177,218,76,198,178,65,166,216,38,46,36,99,157,201,212,219,32,147,105,34,39,146,113,203,100,12,27,100,46,7,212,58,50,25,235,6,153,18,155,88,146,140,77,38,83,95,131,76,150,57,76,73,198,62,147,105,53,113,234,93,54,145,93,103,38,195,52,17,158,100,10,236,164,73,50,173,90,166,189,203,174,18,43,204,100,114,205,1,38,25,137,77,84,72,38,208,156,109,239,178,145,196,186,50,25,150,57,112,36,35,182,137,25,201,24,183,149,153,200,254,0,72,198,163,173,76,129,157,12,72,198,176,173,204,85,98,189,36,99,221,86,70,98,19,109,146,49,106,43,51,146,88,45,201,88,182,149,17,219,196,140,100,140,223,248,159,200,254,0,72,198,227,141,255,2,59,25,144,140,225,27,255,87,137,245,146,140,245,27,255,18,155,104,147,140,209,27,255,35,137,213,146,140,229,27,255,98,155,152,145,140,241,203,152,19,217,31,0,201,120,188,140,89,96,39,3,146,49,124,25,243,42,177,94,146,177,126,25,83,98,19,109,146,49,122,25,115,36,177,90,146,177,124,25,83,108,19,51,146,49,126,79,102,34,251,3,32,25,143,247,100,10,236,100,64,50,134,239,201,92,37,214,75,50,214,239,201,72,108,162,77,50,70,239,201,140,36,86,75,50,150,239,201,136,109,98,70,50,198,71,152,39,178,63,0,146,241,56,194,92,96,39,3,146,49,60,194,124,149,88,47,201,88,31,97,150,216,68,155,100,140,142,48,143,36,86,75,50,150,71,152,197,54,193,145,204,69,179,95,94,34,88,123,6,97,238,236,212,204,45,157,127,249,246,143,233,232,254,203,89,150,105,76,176,189,223,172,110,223,175,254,181,57,236,35,219,44,104,144,121,103,40,169,77,38,94,146,42,190,217,223,79,2,62,211,92,105,67,13,165,46,161,40,75,141,124,155,49,173,149,175,231,47,111,226,99,45,131,115,86,60,239,53,234,60,231,33,105,44,183,28,65,65,7,40,126,120,166,73,25,69,136,26,185,125,88,150,225,96,165,211,227,182,48,238,60,15,208,101,97,101,34,183,24,43,173,14,72,172,48,77,147,50,138,12,43,5,246,97,89,134,214,142,67,86,97,255,169,30,178,146,104,99,74,86,243,10,186,146,21,79,37,77,178,226,121,79,135,172,248,58,152,144,85,174,147,212,201,138,163,136,38,89,177,252,164,68,86,124,29,76,200,42,211,69,250,100,197,81,196,132,172,194,137,188,122,200,74,162,141,41,89,205,43,232,74,86,60,149,52,201,138,231,61,29,178,226,235,96,66,86,185,78,82,39,43,142,34,154,100,197,242,147,18,89,241,117,48,33,171,76,23,233,147,21,71,17,19,178,10,255,174,135,172,36,218,152,146,213,188,130,174,100,197,83,73,147,172,120,222,211,33,43,190,14,38,100,149,235,36,117,178,226,40,162,73,86,44,63,41,145,21,95,7,19,178,202,116,145,62,89,113,20,81,35,171,248,181,42,159,61,171,212,27,86,85,238,89,209,230,50,33,43,158,205,204,200,42,122,109,211,116,207,42,241,222,102,77,123,86,164,105,52,201,138,101,31,27,178,18,199,157,66,178,130,68,27,93,178,18,196,24,28,89,21,70,22,59,178,242,217,179,74,153,167,202,61,43,218,92,174,100,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,52,141,3,89,121,238,89,137,227,142,18,89,85,180,103,37,136,49,250,100,85,197,158,85,108,25,159,61,171,148,121,170,220,179,162,205,229,74,
-86,206,123,86,81,68,54,221,179,74,4,227,154,246,172,72,211,56,144,149,231,158,149,56,238,40,145,85,69,123,86,130,24,163,79,86,85,236,89,197,150,241,217,179,74,153,167,202,61,43,218,92,174,100,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,52,141,3,89,121,238,89,137,227,142,18,89,85,180,103,37,136,49,250,100,85,197,158,85,220,165,201,103,207,42,213,176,169,202,61,43,218,92,38,100,197,179,153,25,89,69,93,224,76,247,172,18,109,224,106,218,179,34,77,163,73,86,44,251,216,144,149,56,238,20,146,21,36,218,232,146,149,32,198,224,200,170,48,178,216,145,149,207,158,85,202,60,85,238,89,209,230,114,37,43,231,61,171,40,34,155,238,89,37,130,113,77,123,86,164,105,28,200,202,115,207,74,28,119,148,200,170,162,61,43,65,140,209,39,171,42,246,172,98,203,248,236,89,165,204,83,229,158,21,109,46,87,178,114,222,179,138,34,178,233,158,85,34,24,215,180,103,69,154,198,129,172,60,247,172,196,113,71,137,172,42,218,179,18,196,24,125,178,170,98,207,42,182,140,207,158,85,202,60,85,238,89,209,230,114,37,43,231,61,171,40,34,155,238,89,37,130,113,77,123,86,164,105,28,200,202,115,207,74,28,119,148,200,170,162,61,43,65,140,209,39,171,42,246,172,226,166,239,62,123,86,169,254,239,85,238,89,209,230,50,33,43,158,205,204,200,42,186,84,194,116,207,42,113,171,68,77,123,86,164,105,52,201,138,101,31,27,178,18,199,157,66,178,130,68,27,93,178,18,196,24,28,89,21,70,22,59,178,242,217,179,74,153,167,202,61,43,218,92,174,100,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,52,141,3,89,121,238,89,137,227,142,18,89,85,180,103,37,136,49,250,100,85,197,158,85,108,25,159,61,171,148,121,170,220,179,162,205,229,74,86,206,123,86,81,68,54,221,179,74,4,227,154,246,172,72,211,56,144,149,231,158,149,56,238,40,145,85,69,123,86,130,24,163,79,86,85,236,89,197,150,241,217,179,74,153,167,202,61,43,218,92,174,100,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,52,141,3,89,121,238,89,137,227,142,18,89,85,180,103,37,136,49,250,100,85,197,158,85,124,135,100,248,183,61,89,165,174,147,148,104,163,78,86,180,185,76,200,138,103,51,51,178,138,238,168,229,121,175,144,172,18,151,212,242,117,208,35,43,210,52,154,100,197,178,143,13,89,137,227,78,33,89,65,162,141,46,89,9,98,12,142,172,10,35,139,46,89,17,119,81,26,144,21,227,90,74,127,178,162,205,101,66,86,60,155,153,145,213,242,93,183,122,100,149,127,217,173,27,89,145,166,209,36,43,150,125,108,200,74,28,119,10,201,10,18,109,116,201,74,16,99,112,100,85,24,89,224,100,213,118,212,112,189,41,120,162,65,205,167,1,153,230,210,34,171,2,155,233,147,85,171,156,195,77,193,87,185,213,158,6,204,53,141,10,89,73,236,163,72,86,161,237,147,199,77,193,35,185,53,158,6,100,153,6,77,86,98,251,56,146,149,217,105,192,172,192,91,203,105,64,166,185,92,201,202,235,52,224,52,34,219,156,6,92,14,198,85,156,6,204,53,141,3,89,153,159,6,76,68,100,245,211,128,25,193,216,251,52,32,203,52,14,100,229,117,26,48,25,125,205,78,3,102,5,222,90,78,3,50,205,229,74,86,94,167,1,167,17,217,230,52,224,114,48,174,226,52,96,174,105,28,200,202,252,52,96,34,34,171,159,6,204,8,198,222,167,1,89,166,113,32,43,175,211,128,201,232,107,118,26,48,43,240,214,114,26,144,105,46,87,178,242,58,13,56,141,200,54,167,1,151,131,113,21,167,1,115,77,227,64,86,230,167,1,19,17,89,253,52,96,70,48,246,62,13,200,50,141,3,89,121,157,6,28,132,61,151,155,130,39,26,124,48,123,86,126,55,5,23,216,204,140,172,204,111,10,190,202,173,125,207,202,231,166,96,137,125,108,200,202,244,166,224,145,220,202,247,172,236,111,10,22,219,199,145,172,124,246,172,106,191,41,152,105,46,87,178,114,222,179,50,191,41,120,57,24,215,180,103,229,115,83,176,196,62,246,100,101,185,103,85,235,77,193,44,211,56,144,85,21,123,86,46,55,5,103,5,222,42,247,172,252,110,10,46,176,153,7,89,153,238,89,213,124,83,112,
-174,105,28,200,202,115,207,202,244,166,224,140,96,92,209,158,149,253,77,193,98,251,24,147,149,203,229,139,19,13,62,152,50,160,223,229,139,5,54,51,35,43,243,203,23,175,114,107,47,3,250,92,190,40,177,143,13,89,153,94,190,56,146,91,121,25,208,254,242,69,177,125,28,201,202,167,12,88,251,229,139,76,115,185,146,149,115,25,208,252,242,197,229,96,92,83,25,208,231,242,69,137,125,236,201,202,178,12,88,235,229,139,44,211,56,144,85,21,101,64,151,203,23,179,2,111,149,101,64,191,203,23,11,108,230,65,86,166,101,192,154,47,95,204,53,141,3,89,121,150,1,77,47,95,204,8,198,21,149,1,237,47,95,20,219,199,152,172,92,238,179,154,104,240,193,148,1,253,238,179,42,176,153,25,89,153,223,103,117,149,91,123,25,208,231,62,43,137,125,108,200,202,244,62,171,145,220,202,203,128,246,247,89,137,237,227,72,86,62,101,192,218,239,179,98,154,203,149,172,156,203,128,230,247,89,45,7,227,154,202,128,62,247,89,73,236,99,79,86,150,101,192,90,239,179,98,153,198,129,172,170,40,3,186,220,103,149,21,120,171,44,3,250,221,103,85,96,51,15,178,50,45,3,214,124,159,85,174,105,28,200,202,179,12,104,122,159,85,70,48,174,168,12,104,127,159,149,216,62,198,100,229,114,69,200,68,131,154,175,8,97,154,203,132,172,106,187,34,164,15,138,230,87,132,92,229,86,123,69,72,174,105,52,201,170,150,43,66,162,160,104,122,69,200,72,110,141,87,132,176,76,163,72,86,181,93,17,50,8,123,46,87,132,76,52,168,249,138,16,166,185,76,200,170,182,43,66,250,160,104,126,69,200,85,110,181,87,132,228,154,70,147,172,106,185,34,36,10,138,166,87,132,140,228,214,120,69,8,203,52,138,100,85,219,21,33,237,129,15,215,43,66,38,26,212,124,192,130,105,46,45,178,42,176,153,62,89,181,202,57,92,17,114,149,91,237,1,139,92,211,168,144,149,196,62,138,100,21,78,37,122,92,17,50,146,91,227,1,11,150,105,208,100,37,182,143,35,89,153,29,176,200,10,188,181,28,176,96,154,203,149,172,188,14,88,76,35,178,205,1,139,229,96,92,197,1,139,92,211,56,144,149,249,1,139,68,68,86,63,96,145,17,140,189,15,88,176,76,227,64,86,94,7,44,146,209,215,236,128,69,86,224,173,229,128,5,211,92,174,100,229,117,192,98,26,145,109,14,88,44,7,227,42,14,88,228,154,198,129,172,204,15,88,36,34,178,250,1,139,140,96,236,125,192,130,101,26,7,178,242,58,96,145,140,190,102,87,132,100,5,222,90,174,8,97,154,203,149,172,188,174,8,153,70,100,155,43,66,150,131,113,21,87,132,228,154,198,129,172,204,175,8,73,68,100,245,43,66,50,130,177,247,21,33,44,211,56,144,149,215,21,33,131,176,231,114,69,200,68,131,15,102,207,202,239,138,144,2,155,153,145,149,249,21,33,87,185,181,239,89,249,92,17,34,177,143,13,89,153,94,17,50,146,91,249,158,149,253,21,33,98,251,56,146,149,207,158,85,237,87,132,48,205,229,74,86,206,123,86,230,87,132,44,7,227,154,246,172,124,174,8,145,216,199,158,172,44,247,172,106,189,34,132,101,26,7,178,170,98,207,202,229,138,144,172,192,91,229,158,149,223,21,33,5,54,243,32,43,211,61,171,154,175,8,201,53,141,3,89,121,238,89,153,94,17,146,17,140,43,218,179,178,191,34,68,108,31,99,178,114,185,34,100,162,193,7,83,6,244,187,34,164,192,102,102,100,101,126,69,200,85,110,237,101,64,159,43,66,36,246,177,33,43,211,43,66,70,114,43,47,3,218,95,17,34,182,143,35,89,249,148,1,107,191,34,132,105,46,87,178,114,46,3,154,95,17,178,28,140,107,42,3,250,92,17,34,177,143,61,89,89,150,1,107,189,34,132,101,26,7,178,170,162,12,232,210,117,125,162,193,7,147,89,249,117,93,47,176,153,25,89,153,119,93,191,202,173,61,179,242,233,186,46,177,143,13,89,153,118,93,31,201,173,60,179,178,239,186,46,182,143,35,89,249,100,86,181,119,93,103,154,203,149,172,156,51,43,243,174,235,203,193,184,166,204,202,167,235,186,196,62,246,100,101,153,89,213,218,117,157,101,26,7,178,170,34,179,114,105,100,59,209,160,230,70,182,76,115,153,144,85,109,141,108,251,160,104,222,200,246,42,183,218,70,
-182,185,166,209,36,171,90,26,217,70,65,209,180,145,237,72,110,141,141,108,89,166,81,36,171,218,26,217,14,194,158,75,35,219,137,6,53,55,178,101,154,203,132,172,106,107,100,219,7,69,243,70,182,87,185,213,54,178,205,53,141,38,89,213,210,200,54,10,138,166,141,108,71,114,107,108,100,203,50,141,34,89,213,214,200,182,205,244,92,27,217,78,52,168,121,207,138,105,46,45,178,42,176,153,62,89,181,202,57,52,178,189,202,173,118,207,42,215,52,42,100,37,177,143,34,89,133,114,164,71,35,219,145,220,26,247,172,88,166,65,147,149,216,62,142,100,101,182,103,149,21,120,107,217,179,98,154,203,149,172,188,246,172,166,17,217,102,207,106,57,24,87,177,103,149,107,26,7,178,50,223,179,74,68,100,245,61,171,140,96,236,189,103,197,50,141,3,89,121,237,89,37,163,175,217,75,193,89,129,183,150,151,130,153,230,114,37,43,175,151,130,167,17,217,230,165,224,229,96,92,197,75,193,185,166,113,32,43,243,151,130,19,17,89,253,165,224,140,96,236,253,82,48,203,52,14,100,229,245,82,112,50,250,154,53,178,205,10,188,181,52,178,101,154,203,149,172,188,26,217,78,35,178,77,35,219,229,96,92,69,35,219,92,211,56,144,149,121,35,219,68,68,86,111,100,155,17,140,189,27,217,178,76,227,64,86,94,141,108,7,97,207,165,145,237,68,131,15,102,207,202,175,145,109,129,205,204,200,202,188,145,237,85,110,237,123,86,62,141,108,37,246,177,33,43,211,70,182,35,185,149,239,89,217,55,178,21,219,199,145,172,124,246,172,106,111,100,203,52,151,43,89,57,239,89,153,55,178,93,14,198,53,237,89,249,52,178,149,216,199,158,172,44,247,172,106,109,100,203,50,141,3,89,85,177,103,229,210,200,54,43,240,86,185,103,229,215,200,182,192,102,30,100,101,186,103,85,115,35,219,92,211,56,144,149,231,158,149,105,35,219,140,96,92,209,158,149,125,35,91,177,125,140,201,202,165,145,237,68,131,15,166,12,232,215,200,182,192,102,102,100,101,222,200,246,42,183,246,50,160,79,35,91,137,125,108,200,202,180,145,237,72,110,229,101,64,251,70,182,98,251,56,146,149,79,25,176,246,70,182,76,115,185,146,149,115,25,208,188,145,237,114,48,174,169,12,232,211,200,86,98,31,123,178,178,44,3,214,218,200,150,101,26,7,178,170,162,12,232,210,200,118,162,193,7,147,89,249,53,178,45,176,153,25,89,153,55,178,189,202,173,61,179,242,105,100,43,177,143,13,89,153,54,178,29,201,173,60,179,178,111,100,43,182,143,49,89,185,244,6,156,104,80,115,111,64,166,185,76,200,170,182,222,128,125,80,52,239,13,120,149,91,109,111,192,92,211,104,146,85,45,189,1,163,160,104,218,27,112,36,183,198,222,128,44,211,40,146,85,109,189,1,7,97,207,165,55,224,68,131,154,123,3,50,205,101,66,86,181,245,6,236,131,162,121,111,192,171,220,106,123,3,230,154,70,147,172,106,233,13,24,5,69,211,222,128,35,185,53,246,6,100,153,70,145,172,106,235,13,216,146,231,220,91,174,102,153,213,68,131,154,51,43,166,185,180,200,170,192,102,250,100,213,42,55,120,243,213,38,179,186,202,173,54,179,202,53,141,10,89,73,236,163,72,86,33,195,187,45,140,59,18,178,26,201,173,49,179,98,153,6,77,86,98,251,24,147,85,124,78,210,135,172,82,135,37,171,36,43,218,92,38,100,197,179,153,25,89,69,231,179,77,201,42,113,52,187,38,178,34,77,163,73,86,44,251,216,144,149,56,238,20,146,21,36,218,232,146,149,32,198,224,200,170,48,178,232,146,85,124,244,196,135,172,82,231,79,170,36,43,218,92,38,100,197,179,153,25,89,69,71,222,76,201,42,113,218,173,38,178,34,77,163,73,86,44,251,216,144,149,56,238,20,146,21,36,218,232,146,149,32,198,224,200,170,48,178,232,146,85,124,244,196,135,172,82,231,79,170,36,43,218,92,38,100,197,179,153,25,89,69,71,222,76,201,42,113,218,173,38,178,34,77,163,73,86,44,251,216,144,149,56,238,20,146,21,36,218,232,146,149,32,198,224,200,170,48,178,232,146,149,203,105,192,137,6,31,12,89,249,157,6,44,176,153,25,89,153,159,6,188,202,173,157,172,124,78,3,74,236,99,67,86,166,167,1,71,114,43,39,43,251,211,128,98,251,24,147,149,203,105,192,137,6,
-53,159,6,100,154,203,132,172,106,59,13,216,7,69,243,211,128,87,185,213,158,6,204,53,141,38,89,213,114,26,48,10,138,166,167,1,71,114,107,60,13,200,50,141,34,89,213,118,26,176,213,103,238,120,155,25,89,77,52,168,153,172,152,230,210,34,171,2,155,233,147,85,171,220,224,200,155,13,89,93,229,86,75,86,185,166,81,33,43,137,125,20,201,42,144,230,109,97,220,145,144,213,72,110,141,100,197,50,13,154,172,196,246,49,38,171,248,232,137,15,89,165,206,159,84,73,86,180,185,76,200,138,103,51,51,178,138,142,188,153,146,85,226,180,91,77,100,69,154,70,147,172,88,246,177,33,43,113,220,41,36,43,72,180,209,37,43,65,140,193,145,85,97,100,209,37,171,248,232,137,15,89,165,206,159,84,73,86,180,185,76,200,138,103,51,51,178,138,142,188,153,146,85,226,180,91,77,100,69,154,70,147,172,88,246,177,33,43,113,220,41,36,43,72,180,209,37,43,65,140,193,145,85,97,100,209,37,171,248,232,137,15,89,165,206,159,84,73,86,180,185,76,200,138,103,51,51,178,138,142,188,153,146,85,226,180,91,77,100,69,154,70,147,172,88,246,177,33,43,113,220,41,36,43,72,180,209,37,43,65,140,193,145,85,97,100,209,37,171,248,232,137,15,89,165,206,159,84,73,86,180,185,76,200,138,103,51,51,178,138,142,188,153,146,85,226,180,91,77,100,69,154,70,147,172,88,246,177,33,43,113,220,41,36,43,72,180,209,37,43,65,140,193,145,85,97,100,209,37,43,151,211,128,19,13,62,24,178,242,59,13,88,96,51,51,178,50,63,13,120,149,91,59,89,249,156,6,148,216,199,134,172,76,79,3,142,228,86,78,86,246,167,1,197,246,65,147,213,69,191,230,187,151,200,119,187,141,27,205,109,175,76,30,254,61,210,233,119,223,204,70,187,230,215,77,188,139,230,191,56,254,220,252,185,178,102,109,48,86,32,18,249,46,252,135,43,172,149,245,156,26,181,100,58,157,132,156,201,116,162,110,197,94,122,222,25,142,26,181,96,50,189,132,212,100,230,177,17,206,27,205,157,174,12,255,70,96,111,60,254,236,252,152,178,56,216,11,34,7,199,255,114,133,45,98,239,50,106,201,116,88,216,107,68,221,138,189,148,196,222,112,212,130,201,72,176,215,30,31,200,188,245,91,130,189,201,248,153,151,238,162,176,215,138,164,174,165,102,99,239,58,106,201,116,56,216,11,162,110,197,94,74,97,111,52,106,193,100,36,216,107,119,3,51,239,69,148,96,111,50,126,230,181,100,40,236,181,34,169,139,251,216,216,187,142,90,50,29,14,246,130,168,91,177,151,82,216,27,141,90,48,25,9,246,56,215,156,73,176,39,189,191,12,133,189,172,123,184,216,216,99,95,176,85,140,189,252,139,162,56,216,147,221,0,37,193,222,69,112,84,101,225,228,26,223,126,55,7,135,111,191,27,34,111,105,240,204,197,236,130,32,202,83,215,82,64,86,150,49,39,41,8,122,78,12,89,48,145,118,248,140,105,112,242,139,25,57,207,91,123,17,67,202,167,209,13,79,134,185,24,12,140,204,130,143,52,97,90,129,65,90,78,78,193,68,26,55,161,40,68,90,118,54,145,143,52,81,42,1,65,26,39,143,96,35,77,154,68,64,144,150,149,65,240,144,198,78,31,202,144,150,159,59,100,35,77,150,56,64,144,198,201,26,216,72,147,166,12,16,164,101,229,11,60,164,177,147,133,50,164,229,103,10,217,72,147,165,9,16,164,113,114,4,54,210,164,9,2,4,105,89,217,1,15,105,236,212,160,12,105,249,121,65,54,210,100,73,1,31,105,23,169,63,9,115,130,191,205,99,224,111,99,180,253,4,72,11,22,101,81,158,250,137,153,25,204,10,107,101,61,167,70,45,153,78,39,33,103,50,156,252,224,111,179,200,248,219,8,121,63,21,164,8,11,18,200,48,247,147,48,75,16,97,79,152,40,192,176,151,147,43,240,177,199,77,23,202,177,151,157,49,176,176,39,74,26,80,216,227,228,13,18,236,73,83,7,20,246,178,178,7,54,246,216,9,68,49,246,242,115,8,14,246,100,105,4,10,123,156,76,66,130,61,105,50,129,194,94,86,62,193,198,30,59,165,40,198,94,126,86,193,193,158,44,177,64,97,143,147,91,72,176,39,77,47,80,216,203,202,48,216,216,99,39,25,197,216,203,207,51,56,216,147,165,26,18,236,93,4,255,246,183,162,245,
-222,215,223,255,57,125,26,246,183,191,109,207,156,30,214,219,227,230,122,24,109,255,120,90,237,95,54,191,221,189,218,172,142,155,187,253,238,126,181,127,187,105,126,190,143,12,177,164,79,230,26,132,214,45,113,72,76,164,240,195,241,245,228,188,44,211,146,11,54,92,208,97,233,136,93,150,82,249,230,228,26,82,168,117,240,61,99,105,190,224,231,160,221,243,2,4,10,151,242,148,70,106,184,227,89,45,105,47,4,218,228,166,227,25,77,142,49,78,198,148,246,232,243,246,9,144,99,76,154,97,81,26,105,97,140,105,181,164,189,0,24,43,48,29,207,104,76,93,73,18,139,83,164,26,72,53,149,92,213,79,170,180,37,29,72,149,103,78,47,82,141,106,14,142,164,154,168,81,84,75,170,164,213,236,72,149,101,58,23,82,21,199,57,40,169,66,162,155,33,169,10,98,154,22,169,22,70,50,83,82,141,107,63,53,144,106,170,106,84,63,169,210,150,116,32,85,158,57,189,72,53,42,166,58,146,106,162,248,90,45,169,146,86,179,35,85,150,233,92,72,85,28,231,160,164,10,137,110,134,164,42,136,105,90,164,90,24,201,76,73,53,46,106,215,64,170,169,114,120,253,164,74,91,210,129,84,121,230,244,34,213,104,151,200,145,84,19,187,74,213,146,42,105,53,59,82,101,153,206,133,84,197,113,14,74,170,144,232,102,72,170,130,152,166,69,170,133,145,76,155,84,7,231,140,226,170,249,204,249,21,11,82,157,232,147,121,182,198,159,84,153,150,180,33,213,2,115,154,147,106,127,56,44,218,29,228,249,25,67,170,87,45,202,145,103,65,170,185,86,51,32,85,137,233,236,72,53,58,179,39,142,115,229,164,58,210,162,24,99,218,164,202,178,154,46,169,138,77,231,75,170,196,177,83,115,82,101,28,88,173,140,84,105,75,58,144,42,207,156,94,164,186,124,142,219,138,84,243,207,125,215,65,170,164,213,236,72,149,101,58,23,82,21,199,57,40,169,66,162,155,33,169,10,98,154,22,169,22,70,50,83,82,141,171,230,53,144,106,170,116,94,63,169,210,150,116,32,85,158,57,189,72,53,218,29,116,36,213,196,198,96,181,164,74,90,205,142,84,89,166,115,33,85,113,156,131,146,42,36,186,25,146,170,32,166,105,145,106,97,36,51,37,213,184,106,94,3,169,166,74,231,245,147,42,109,73,7,82,229,153,211,139,84,163,221,65,71,82,77,108,12,86,75,170,164,213,236,72,149,101,58,23,82,21,199,57,40,169,66,162,155,33,169,10,98,154,22,169,22,70,50,109,82,29,188,63,31,87,205,103,222,203,182,32,213,137,62,153,239,140,251,147,42,211,146,54,164,90,96,78,115,82,237,155,30,68,187,131,60,63,99,72,245,170,69,57,242,44,72,53,215,106,6,164,42,49,157,29,169,70,189,40,196,113,174,156,84,71,90,20,99,76,155,84,89,86,211,37,85,177,233,124,73,53,174,154,215,64,170,169,210,121,253,164,74,91,210,129,84,121,230,244,34,213,104,119,208,145,84,19,27,131,213,146,42,105,53,59,82,101,153,206,133,84,197,113,14,74,170,144,232,102,72,170,130,152,166,69,170,133,145,204,148,84,137,30,101,230,164,202,232,110,86,25,169,210,150,116,32,85,158,57,189,72,117,185,233,159,21,169,230,55,9,172,131,84,73,171,217,145,42,203,116,46,164,42,142,115,80,82,133,68,55,67,82,21,196,52,45,82,45,140,100,166,164,26,87,205,107,32,213,84,233,188,126,82,165,45,233,64,170,60,115,122,145,106,180,59,232,72,170,137,141,193,106,73,149,180,154,29,169,178,76,231,66,170,226,56,7,37,85,72,116,51,36,85,65,76,211,34,213,194,72,166,77,170,131,190,208,113,213,124,166,223,176,5,169,78,244,201,236,133,236,79,170,76,75,218,144,106,129,57,205,73,181,111,230,29,237,14,242,252,140,33,213,171,22,229,200,179,32,213,92,171,25,144,170,196,116,118,164,26,245,88,23,199,185,114,82,29,105,81,140,49,109,82,101,89,77,151,84,197,166,243,37,213,184,106,94,3,169,166,74,231,245,147,42,109,73,7,82,229,153,211,139,84,163,221,65,71,82,77,108,12,86,75,170,164,213,236,72,149,101,58,23,82,21,199,57,40,169,66,162,155,33,169,10,98,154,22,169,22,70,50,83,82,141,171,230,53,144,106,170,116,94,63,169,210,150,116,32,85,158,57,189,72,53,218,29,116,36,213,196,198,
-96,181,164,74,90,205,142,84,89,166,115,33,85,113,156,131,146,42,36,186,25,146,170,32,166,105,145,106,97,36,51,37,85,226,66,59,115,82,101,92,133,87,25,169,210,150,116,32,85,158,57,189,72,117,249,134,72,43,82,205,191,81,178,14,82,37,173,102,71,170,44,211,185,144,170,56,206,65,73,21,18,221,12,73,85,16,211,180,72,181,48,146,65,73,245,162,237,179,103,162,107,64,191,91,98,174,103,207,228,172,186,164,79,102,227,100,90,55,36,242,14,133,23,170,126,55,79,90,189,13,133,24,60,0,47,84,93,82,16,27,241,130,239,25,87,131,46,248,57,104,247,188,0,129,194,91,65,41,141,212,112,199,179,90,210,94,8,180,201,77,199,51,154,28,99,156,171,65,191,91,224,176,240,4,200,49,38,189,21,148,210,72,11,99,76,171,37,237,5,192,88,129,233,120,70,147,166,170,41,18,35,174,204,51,39,85,198,189,121,149,145,42,109,73,7,82,229,153,211,139,84,151,175,6,181,34,213,252,91,65,235,32,85,210,106,118,164,202,50,157,11,169,138,227,28,148,84,33,209,205,144,84,5,49,77,139,84,11,35,153,41,169,18,87,230,153,147,42,227,222,188,202,72,149,182,164,3,169,242,204,233,69,170,203,87,131,90,145,106,254,173,160,117,144,42,105,53,59,82,101,153,206,133,84,197,113,14,74,170,144,232,102,72,170,130,152,166,69,170,133,145,204,148,84,137,43,243,204,73,149,113,111,94,101,164,74,91,210,129,84,121,230,244,34,213,229,171,65,173,72,53,255,86,208,58,72,149,180,154,29,169,178,76,231,66,170,226,56,7,37,85,72,116,51,36,85,65,76,211,34,213,194,72,166,77,170,156,107,64,45,72,85,122,3,168,63,169,50,45,105,67,170,5,230,52,39,213,172,171,65,213,73,149,125,43,168,51,169,230,90,205,128,84,37,166,179,35,213,252,171,65,53,73,85,118,43,168,31,169,178,172,166,75,170,98,211,249,146,42,113,101,158,57,169,50,238,205,171,140,84,105,75,58,144,42,207,156,94,164,186,124,53,168,21,169,230,223,10,90,7,169,146,86,179,35,85,150,233,92,72,85,28,231,160,164,10,137,110,134,164,42,136,105,90,164,90,24,201,76,73,149,184,50,207,156,84,25,247,230,85,70,170,180,37,29,72,149,103,78,47,82,93,190,26,212,138,84,243,111,5,173,131,84,73,171,217,145,42,203,116,46,164,42,142,115,80,82,133,68,55,67,82,21,196,52,45,82,45,140,100,166,164,74,92,153,103,78,170,140,123,243,42,35,85,218,146,14,164,202,51,167,23,169,46,95,13,106,69,170,249,183,130,214,65,170,164,213,236,72,149,101,58,23,82,21,199,57,40,169,66,162,155,33,169,10,98,154,22,169,22,70,50,109,82,229,92,3,106,65,170,210,27,64,253,73,149,105,73,27,82,45,48,167,57,169,102,93,13,170,78,170,236,91,65,157,73,53,215,106,6,164,42,49,157,29,169,230,95,13,170,73,170,178,91,65,253,72,149,101,53,93,82,21,155,206,151,84,137,43,243,204,73,149,113,111,94,101,164,74,91,210,129,84,121,230,244,34,213,229,171,65,173,72,53,255,86,208,58,72,149,180,154,29,169,178,76,231,66,170,226,56,7,37,85,72,116,51,36,85,65,76,211,34,213,194,72,102,74,170,196,149,121,230,164,202,184,55,175,50,82,165,45,233,64,170,60,115,122,145,234,242,213,160,86,164,154,127,43,104,29,164,74,90,205,142,84,89,166,115,33,85,113,156,131,146,42,36,186,25,146,170,32,166,105,145,106,97,36,51,37,85,226,202,60,115,82,101,220,155,87,25,169,210,150,116,32,85,158,57,189,72,117,249,106,80,43,82,205,191,21,180,14,82,37,173,102,71,170,44,211,185,144,170,56,206,65,73,21,18,221,12,73,85,16,211,180,72,181,48,146,105,147,42,231,26,80,11,82,149,222,0,234,79,170,76,75,218,144,106,129,57,205,73,53,235,106,80,117,82,101,223,10,234,76,170,185,86,51,32,85,137,233,236,72,53,255,106,80,77,82,149,221,10,234,71,170,44,171,233,146,170,216,116,190,164,74,92,153,103,78,170,140,123,243,42,35,85,218,146,14,164,202,51,167,23,169,46,95,13,106,69,170,249,183,130,214,65,170,164,213,236,72,149,101,58,23,82,21,199,57,40,169,66,162,155,33,169,10,98,154,22,169,22,70,50,83,82,37,174,204,51,39,85,198,
-189,121,149,145,42,109,73,7,82,229,153,211,139,84,151,175,6,181,34,213,252,91,65,235,32,85,210,106,118,164,202,50,157,11,169,138,227,28,148,84,33,209,205,144,84,5,49,77,139,84,11,35,153,41,169,18,87,230,153,147,42,227,222,188,202,72,149,182,164,3,169,242,204,233,69,170,203,87,131,90,145,106,254,173,160,117,144,42,105,53,59,82,101,153,206,133,84,197,113,14,74,170,144,232,102,72,170,130,152,166,69,170,133,145,12,74,170,215,11,115,175,29,215,183,241,139,140,219,232,30,130,237,100,207,247,235,31,102,111,174,110,226,108,124,23,111,122,232,217,22,200,28,49,179,102,24,202,142,164,189,11,255,97,202,105,196,60,95,30,176,96,18,171,212,245,203,3,137,157,148,91,169,71,158,7,75,45,15,40,159,66,59,120,106,10,51,16,56,158,14,81,245,185,249,1,135,174,201,208,118,232,106,165,189,11,255,1,161,235,58,160,1,186,130,148,91,169,71,230,208,53,26,208,14,93,65,194,5,2,98,183,207,162,107,50,180,29,186,90,105,239,194,127,64,232,186,14,104,128,174,32,229,182,8,0,203,3,218,161,43,125,63,118,57,51,102,221,114,173,195,140,211,235,151,11,153,113,249,18,101,48,51,38,110,247,149,51,99,198,29,189,250,232,26,92,170,136,69,87,242,146,68,77,116,197,247,144,66,208,149,186,77,84,13,93,124,143,16,232,42,243,67,17,186,6,183,139,97,209,149,188,45,76,19,93,241,133,124,16,116,165,174,213,83,67,23,223,35,4,186,202,252,80,132,174,193,53,59,88,116,37,175,205,209,68,87,124,51,21,4,93,169,251,165,212,208,197,247,8,129,174,50,63,20,161,235,229,131,90,236,10,67,155,163,171,17,138,69,87,51,160,45,186,248,30,33,208,85,230,135,34,116,221,223,62,104,161,43,12,109,142,174,70,40,22,93,205,128,182,232,226,123,132,64,87,153,31,216,245,174,212,253,95,128,122,87,206,45,94,74,245,174,201,245,82,165,245,174,197,75,162,208,245,174,249,219,139,10,234,93,244,29,68,6,232,194,230,140,89,215,217,168,162,11,151,51,46,223,150,162,135,46,76,206,152,113,25,135,1,186,176,57,99,214,189,14,170,232,194,229,140,203,215,6,232,161,11,147,51,102,116,165,55,64,23,54,103,204,106,112,174,138,46,92,206,184,220,63,91,15,93,152,156,49,163,61,179,1,186,176,57,227,100,104,115,116,225,114,198,235,128,182,232,194,228,140,163,1,157,208,133,205,25,39,67,155,163,11,151,51,94,7,180,69,23,38,103,28,13,104,135,174,100,127,243,114,116,101,117,41,215,65,215,180,125,118,33,186,150,155,96,131,209,149,232,206,44,71,87,70,143,101,3,116,97,115,198,172,118,189,170,232,194,229,140,203,221,96,245,208,133,201,25,51,154,141,26,160,11,155,51,102,245,173,84,69,23,46,103,92,110,139,168,135,46,76,206,152,209,117,207,0,93,216,156,49,171,129,155,42,186,112,57,227,114,127,48,61,116,97,114,198,140,246,83,6,232,194,230,140,147,161,205,209,133,203,25,175,3,218,162,11,147,51,142,6,116,66,23,54,103,156,12,109,142,46,92,206,120,29,208,22,93,152,156,113,52,160,29,186,146,253,219,202,209,149,213,133,77,7,93,211,246,96,133,232,90,110,242,5,70,87,162,251,148,28,93,25,61,164,12,208,133,205,25,179,218,17,169,162,11,151,51,46,119,187,209,67,23,38,103,204,104,166,98,128,46,108,206,152,213,151,67,21,93,184,156,113,185,237,131,30,186,48,57,99,70,87,1,3,116,97,115,198,172,23,212,85,209,133,203,25,151,223,127,214,67,23,38,103,204,120,189,214,0,93,216,156,113,50,180,57,186,112,57,227,117,64,91,116,97,114,198,209,128,78,232,194,230,140,147,161,205,209,133,203,25,175,3,218,162,11,147,51,142,6,180,67,87,139,101,157,156,113,50,180,29,186,90,209,200,156,241,58,160,1,186,66,132,132,230,140,163,1,157,208,133,205,25,39,67,155,163,11,151,51,94,7,180,69,23,38,103,28,13,232,132,46,108,206,56,25,218,28,93,184,156,241,58,160,45,186,48,57,227,104,64,39,116,97,115,198,201,208,230,232,194,229,140,215,1,109,209,133,201,25,71,3,58,161,11,155,51,78,134,54,71,23,46,103,188,14,104,139,46,76,206,56,26,208,9,93,216,156,113,50,180,57,186,112,57,227,117,64,
-91,116,97,114,198,209,128,118,232,106,165,233,228,140,147,161,237,208,213,138,70,230,140,215,1,13,208,21,48,12,205,25,71,3,58,161,11,155,51,78,134,54,71,23,46,103,188,14,104,139,46,76,206,56,26,208,9,93,216,156,113,50,180,57,186,112,57,227,117,64,91,116,97,114,198,209,128,78,232,194,230,140,147,161,205,209,133,203,25,175,3,218,162,11,147,51,142,6,116,66,23,54,103,156,12,109,142,46,92,206,120,29,208,22,93,152,156,113,52,160,19,186,176,57,227,100,104,115,116,225,114,198,235,128,182,232,194,228,140,163,1,181,208,117,149,249,84,214,83,252,203,89,199,63,29,1,236,105,121,87,241,180,32,210,63,79,121,125,197,191,156,131,193,211,33,200,158,202,59,139,167,134,207,152,6,171,183,248,151,115,80,120,58,4,218,83,121,119,241,212,240,116,32,123,42,235,47,206,69,154,184,195,56,2,105,121,61,198,89,72,227,119,25,47,66,26,163,207,120,46,210,132,157,198,17,72,99,245,26,231,34,77,220,109,28,129,180,188,126,227,44,164,241,59,142,23,33,141,209,115,60,23,105,194,174,227,8,164,177,250,142,179,217,83,218,121,28,194,158,89,189,199,121,236,201,238,62,94,198,158,249,253,199,179,217,83,214,129,28,142,52,170,218,87,132,52,78,229,15,136,52,162,6,43,65,26,163,10,139,66,26,223,51,36,210,202,252,81,136,52,170,242,87,132,52,78,21,16,136,52,162,30,43,65,26,163,34,139,66,26,223,51,36,210,202,252,81,136,52,170,10,88,132,52,78,69,16,136,52,162,54,43,65,26,163,58,139,66,26,223,51,36,210,202,252,81,136,52,170,34,88,132,52,78,117,16,136,52,162,78,43,65,26,163,82,139,66,26,223,51,36,210,202,252,81,136,52,170,58,88,132,52,78,165,16,136,52,162,102,43,65,26,163,106,139,66,26,223,51,36,210,202,252,33,168,167,113,250,151,179,235,105,210,14,230,144,122,90,86,15,115,94,61,141,221,197,188,172,158,150,223,199,60,187,158,38,235,100,14,71,26,58,247,20,119,51,7,34,13,153,123,242,59,154,163,144,134,202,61,133,93,205,225,72,67,231,158,226,206,230,64,164,33,115,79,126,119,115,20,210,80,185,167,176,195,57,28,105,232,220,83,220,229,28,136,52,100,238,201,239,116,142,66,26,42,247,20,118,59,135,35,13,157,123,138,59,158,3,145,134,204,61,249,93,207,81,72,67,229,158,194,206,231,112,164,161,115,79,113,247,115,32,210,144,185,39,191,3,58,10,105,168,220,83,216,5,29,129,52,86,31,116,46,210,196,157,208,17,72,203,235,133,206,66,26,191,27,122,17,210,24,253,208,115,145,38,236,136,14,71,26,58,247,20,119,69,7,34,13,153,123,242,59,163,163,144,134,202,61,133,221,209,225,72,67,231,158,226,14,233,64,164,33,115,79,126,151,116,20,210,80,185,167,176,83,58,28,105,232,220,83,220,45,29,136,52,100,238,201,239,152,142,66,26,42,247,20,118,77,135,35,13,157,123,138,59,167,3,145,134,204,61,249,221,211,81,72,67,229,158,194,14,234,112,164,161,115,79,113,23,117,32,210,144,185,39,191,147,58,10,105,168,220,83,216,77,29,129,52,86,63,117,46,210,196,29,213,17,72,203,235,169,206,66,26,191,171,122,17,210,24,125,213,115,145,38,236,172,14,71,26,58,247,20,119,87,7,34,13,153,123,242,59,172,163,144,134,202,61,133,93,214,225,72,67,231,158,226,78,235,64,164,33,115,79,126,183,117,20,210,80,185,167,176,227,58,28,105,232,220,83,220,117,29,136,52,100,238,201,239,188,142,66,26,42,247,20,118,95,135,35,13,157,123,138,59,176,3,145,134,204,61,249,93,216,81,72,67,229,158,194,78,236,112,164,161,115,79,113,55,118,32,210,144,185,39,191,35,59,10,105,168,220,83,216,149,29,129,52,86,95,118,46,210,196,157,217,17,72,203,235,205,206,66,26,191,59,123,17,210,24,253,217,115,145,38,236,208,14,71,26,58,247,20,119,105,7,34,13,153,123,242,59,181,163,144,134,202,61,133,221,218,225,72,67,231,158,226,142,237,64,164,33,115,79,126,215,118,20,210,80,185,167,176,115,59,28,105,232,220,83,220,189,29,136,52,100,238,201,239,224,142,66,26,42,247,20,118,113,135,35,13,157,123,138,59,185,3,145,134,204,61,249,221,220,81,72,67,229,158,194,142,238,112,
-164,161,115,79,113,87,119,32,210,144,185,39,191,179,59,10,105,168,220,83,216,221,29,129,52,86,127,119,46,210,196,29,222,17,72,203,235,241,206,66,26,191,203,123,17,210,24,125,222,115,145,38,236,244,14,71,26,58,247,20,119,123,7,34,13,153,123,242,59,190,163,144,134,202,61,133,93,223,225,72,67,231,158,226,206,239,64,164,33,115,79,126,247,119,20,210,80,185,167,176,3,60,28,105,232,220,83,220,5,30,136,52,100,238,201,239,4,143,66,26,42,247,20,118,131,135,35,13,157,123,138,59,194,3,145,134,204,61,249,93,225,81,72,67,229,158,194,206,240,112,164,161,115,79,113,119,120,32,210,144,185,39,191,67,60,10,105,168,220,83,216,37,158,141,180,139,212,103,162,46,241,127,154,189,30,224,217,16,104,207,138,123,196,167,197,80,254,121,198,234,16,63,39,167,17,243,124,121,192,130,73,132,193,233,41,112,186,195,255,105,238,162,128,103,3,128,61,19,247,134,79,13,78,6,178,103,162,206,240,76,116,73,251,194,3,208,149,213,21,158,131,46,118,79,248,18,116,229,119,132,207,68,151,172,31,60,0,93,156,110,240,76,116,73,123,193,3,208,149,213,9,158,131,46,118,31,248,18,116,229,119,129,207,68,151,172,7,60,0,93,156,14,240,92,102,20,246,127,71,48,99,78,247,119,22,51,114,123,191,23,49,99,118,231,247,92,102,20,245,125,71,163,139,168,247,149,160,139,81,247,195,161,107,185,10,43,64,87,126,13,22,132,46,190,71,8,116,149,249,161,8,93,68,141,175,4,93,140,90,31,14,93,203,149,87,1,186,242,235,174,32,116,241,61,66,160,171,204,15,69,232,34,234,122,37,232,98,212,247,112,232,90,174,182,10,208,149,95,107,5,161,139,239,17,2,93,101,126,40,66,23,81,203,43,65,23,163,166,135,67,215,114,133,85,128,174,252,250,42,8,93,124,143,16,232,42,243,67,17,186,136,250,93,9,186,24,117,60,28,186,150,171,170,2,116,229,215,84,65,232,226,123,132,64,87,153,31,216,245,46,70,231,118,110,189,75,216,183,29,81,239,202,233,218,206,170,119,113,123,182,23,213,187,178,59,182,231,214,187,68,253,218,209,232,194,230,140,210,94,237,56,116,225,114,70,118,159,118,16,186,48,57,163,172,71,59,26,93,216,156,81,218,159,29,135,46,92,206,200,238,205,14,66,23,38,103,148,245,101,71,163,11,155,51,74,123,178,227,208,133,203,25,217,253,216,65,232,194,228,140,178,94,236,104,116,97,115,70,105,31,118,28,186,112,57,35,187,7,59,8,93,152,156,81,214,127,29,141,46,108,206,40,237,189,142,67,23,46,103,100,247,93,7,161,11,147,51,202,122,174,3,208,197,233,184,206,68,151,180,223,58,0,93,89,221,214,57,232,98,247,90,47,65,87,126,167,245,76,116,201,250,172,163,209,133,205,25,165,61,214,113,232,194,229,140,236,254,234,32,116,97,114,70,89,111,117,52,186,176,57,163,180,175,58,14,93,184,156,145,221,83,29,132,46,76,206,40,235,167,142,70,23,54,103,148,246,82,199,161,11,151,51,178,251,168,131,208,133,201,25,101,61,212,209,232,194,230,140,210,254,233,56,116,225,114,70,118,239,116,16,186,48,57,163,172,111,58,26,93,216,156,81,218,51,29,135,46,92,206,200,238,151,14,66,23,38,103,148,245,74,7,160,139,211,41,157,137,46,105,159,116,0,186,178,186,164,115,208,197,238,145,94,130,174,252,14,233,153,232,146,245,71,71,163,11,155,51,74,123,163,227,208,133,203,25,217,125,209,65,232,194,228,140,178,158,232,104,116,97,115,70,105,63,116,28,186,112,57,35,187,23,58,8,93,152,156,81,214,7,29,141,46,108,206,40,237,129,142,67,23,46,103,100,247,63,7,161,11,147,51,202,122,159,163,209,133,205,25,165,125,207,113,232,194,229,140,236,158,231,32,116,97,114,70,89,191,115,52,186,176,57,163,180,215,57,14,93,184,156,145,221,231,28,132,46,76,206,40,235,113,14,64,23,167,195,57,19,93,210,254,230,0,116,101,117,55,231,160,139,221,219,188,4,93,249,157,205,51,209,37,235,107,142,70,23,54,103,148,246,52,199,161,11,151,51,178,251,153,131,208,133,201,25,101,189,204,209,232,194,230,140,210,62,230,56,116,225,114,70,118,15,115,16,186,48,57,163,172,127,57,26,93,216,156,81,218,187,28,135,46,92,206,200,238,
-91,14,66,23,38,103,148,245,44,71,163,11,155,51,74,251,149,227,208,133,203,25,217,189,202,65,232,194,228,140,178,62,229,104,116,97,115,70,105,143,114,28,186,112,57,35,187,63,57,8,93,152,156,81,214,155,28,128,46,78,103,114,38,186,164,125,201,1,232,202,234,74,206,65,23,187,39,121,9,186,242,59,146,103,162,75,214,143,28,141,46,108,206,40,237,69,142,67,23,46,103,100,247,33,7,161,11,147,51,202,122,144,163,209,133,205,25,165,253,199,113,232,194,229,140,236,222,227,32,116,97,114,70,89,223,113,52,186,176,57,163,180,231,56,14,93,184,156,145,221,111,28,132,46,76,206,40,235,53,142,70,23,54,103,148,246,25,199,161,11,151,51,178,123,140,131,208,133,201,25,101,253,197,209,232,194,230,140,210,222,226,56,116,225,114,70,118,95,113,16,186,48,57,163,172,167,56,27,93,87,153,79,101,61,197,103,155,202,63,27,117,175,95,26,60,119,102,105,65,164,127,158,242,250,138,207,181,151,127,54,236,94,63,55,100,193,68,218,225,51,166,193,234,45,62,215,94,254,217,176,123,253,220,144,242,105,116,195,211,129,236,169,172,191,56,23,105,226,14,227,8,164,229,245,24,103,33,141,223,101,188,8,105,140,62,227,185,72,19,118,26,71,32,141,213,107,156,139,52,113,183,113,4,210,242,250,141,179,144,198,239,56,94,132,52,70,207,241,92,164,9,187,142,35,144,198,234,59,206,102,79,105,231,113,8,123,102,245,30,231,177,39,187,251,120,25,123,230,247,31,207,102,79,89,7,114,56,210,168,106,95,17,210,56,149,63,32,210,136,26,172,4,105,140,42,44,10,105,124,207,144,72,43,243,71,33,210,168,202,95,17,210,56,85,64,32,210,136,122,172,4,105,140,138,44,10,105,124,207,144,72,43,243,71,33,210,168,42,96,17,210,56,21,65,32,210,136,218,172,4,105,140,234,44,10,105,124,207,144,72,43,243,71,33,210,168,138,96,17,210,56,213,65,32,210,136,58,173,4,105,140,74,45,10,105,124,207,144,72,43,243,71,33,210,168,234,96,17,210,56,149,66,32,210,136,154,173,4,105,140,170,45,10,105,124,207,144,72,43,243,135,160,158,198,233,95,206,174,167,73,59,152,67,234,105,89,61,204,121,245,52,118,23,243,178,122,90,126,31,243,236,122,154,172,147,57,28,105,232,220,83,220,205,28,136,52,100,238,201,239,104,142,66,26,42,247,20,118,53,135,35,13,157,123,138,59,155,3,145,134,204,61,249,221,205,81,72,67,229,158,194,14,231,112,164,161,115,79,113,151,115,32,210,144,185,39,191,211,57,10,105,168,220,83,216,237,28,142,52,116,238,41,238,120,14,68,26,50,247,228,119,61,71,33,13,149,123,10,59,159,195,145,134,206,61,197,221,207,129,72,67,230,158,252,14,232,40,164,161,114,79,97,23,116,4,210,88,125,208,185,72,19,119,66,71,32,45,175,23,58,11,105,252,110,232,69,72,99,244,67,207,69,154,176,35,58,28,105,232,220,83,220,21,29,136,52,100,238,201,239,140,142,66,26,42,247,20,118,71,135,35,13,157,123,138,59,164,3,145,134,204,61,249,93,210,81,72,67,229,158,194,78,233,112,164,161,115,79,113,183,116,32,210,144,185,39,191,99,58,10,105,168,220,83,216,53,29,142,52,116,238,41,238,156,14,68,26,50,247,228,119,79,71,33,13,149,123,10,59,168,195,145,134,206,61,197,93,212,129,72,67,230,158,252,78,234,40,164,161,114,79,97,55,117,4,210,88,253,212,185,72,19,119,84,71,32,45,175,167,58,11,105,252,174,234,69,72,99,244,85,207,69,154,176,179,58,28,105,232,220,83,220,93,29,136,52,100,238,201,239,176,142,66,26,42,247,20,118,89,135,35,13,157,123,138,59,173,3,145,134,204,61,249,221,214,81,72,67,229,158,194,142,235,112,164,161,115,79,113,215,117,32,210,144,185,39,191,243,58,10,105,168,220,83,216,125,29,142,52,116,238,41,238,192,14,68,26,50,247,228,119,97,71,33,13,149,123,10,59,177,195,145,134,206,61,197,221,216,129,72,67,230,158,252,142,236,40,164,161,114,79,97,87,118,4,210,88,125,217,185,72,19,119,102,71,32,45,175,55,59,11,105,252,238,236,69,72,99,244,103,207,69,154,176,67,59,28,105,232,220,83,220,165,29,136,52,100,238,201,239,212,142,66,26,42,247,20,118,107,135,35,13,157,123,
-138,59,182,3,145,134,204,61,249,93,219,81,72,67,229,158,194,206,237,112,164,161,115,79,113,247,118,32,210,144,185,39,191,131,59,10,105,168,220,83,216,197,29,142,52,116,238,41,238,228,14,68,26,50,247,228,119,115,71,33,13,149,123,10,59,186,195,145,134,206,61,197,93,221,129,72,67,230,158,252,206,238,40,164,161,114,79,97,119,119,4,210,88,253,221,185,72,19,119,120,71,32,45,175,199,59,11,105,252,46,239,69,72,99,244,121,207,69,154,176,211,59,28,105,232,220,83,220,237,29,136,52,100,238,201,239,248,142,66,26,42,247,20,118,125,135,35,13,157,123,138,59,191,3,145,134,204,61,249,221,223,81,72,67,229,158,194,14,240,112,164,161,115,79,113,23,120,32,210,144,185,39,191,19,60,10,105,168,220,83,216,13,30,142,52,116,238,41,238,8,15,68,26,50,247,228,119,133,71,33,13,149,123,10,59,195,195,145,134,206,61,197,221,225,129,72,67,230,158,252,14,241,40,164,161,114,79,97,151,120,54,210,46,82,159,202,218,196,127,249,159,115,8,120,58,130,218,211,242,54,241,11,130,40,31,61,229,181,137,159,147,20,4,61,39,134,44,152,72,59,124,198,52,56,109,226,103,228,60,111,237,69,12,41,159,70,55,60,25,212,158,202,218,196,179,145,38,109,19,15,65,90,86,155,120,30,210,216,109,226,203,144,150,223,38,62,27,105,178,54,241,16,164,113,218,196,179,145,38,109,19,15,65,90,86,155,120,30,210,216,109,226,203,144,150,223,38,62,27,105,178,54,241,16,164,113,218,196,243,217,83,216,38,30,195,158,57,109,226,153,236,201,109,19,95,200,158,217,109,226,243,217,83,212,38,30,143,52,162,64,88,134,52,70,169,16,137,180,229,210,173,8,105,249,165,91,24,210,248,158,33,145,86,230,143,66,164,17,5,194,50,164,49,74,133,72,164,45,151,110,69,72,203,47,221,194,144,198,247,12,137,180,50,127,20,34,141,40,16,150,33,141,81,42,68,34,109,185,116,43,66,90,126,233,22,134,52,190,103,72,164,149,249,163,16,105,68,129,176,12,105,140,82,33,18,105,203,165,91,17,210,242,75,183,48,164,241,61,67,34,173,204,31,133,72,35,10,132,101,72,99,148,10,145,72,91,46,221,138,144,150,95,186,133,33,141,239,25,18,105,101,254,16,212,211,24,109,226,249,245,52,97,155,120,76,61,45,167,77,60,179,158,198,109,19,95,88,79,203,110,19,159,95,79,19,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,15,65,26,167,77,60,27,105,210,54,241,16,164,101,181,137,231,33,141,221,38,190,12,105,249,109,226,179,145,38,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,130,52,78,155,120,54,210,164,109,226,33,72,203,106,19,207,67,26,187,77,124,25,210,242,219,196,103,35,77,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,150,213,38,158,135,52,118,155,248,50,164,229,183,137,207,70,
-154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,171,77,60,15,105,236,54,241,101,72,203,111,19,159,141,52,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,124,164,93,164,126,36,107,19,255,205,236,69,1,31,141,160,246,81,121,155,248,5,65,148,143,62,226,181,137,159,147,20,4,61,39,134,44,152,72,59,124,198,52,56,109,226,191,153,187,50,224,163,33,212,62,146,183,137,79,14,79,6,181,143,100,109,226,217,72,147,182,137,135,32,45,171,77,60,15,105,236,54,241,101,72,203,111,19,159,141,52,89,155,120,8,210,56,109,226,217,72,147,182,137,135,32,45,171,77,60,15,105,236,54,241,101,72,203,111,19,159,141,52,89,155,120,8,210,56,109,226,249,236,41,108,19,143,97,207,156,54,241,76,246,228,182,137,47,100,207,236,54,241,249,236,41,106,19,143,71,26,81,32,44,67,26,163,84,136,68,218,114,233,86,132,180,252,210,45,12,105,124,207,144,72,43,243,71,33,210,136,2,97,25,210,24,165,66,36,210,150,75,183,34,164,229,151,110,97,72,227,123,134,68,90,153,63,10,145,70,20,8,203,144,198,40,21,34,145,182,92,186,21,33,45,191,116,11,67,26,223,51,36,210,202,252,81,136,52,162,64,88,134,52,70,169,16,137,180,229,210,173,8,105,249,165,91,24,210,248,158,33,145,86,230,143,66,164,17,5,194,50,164,49,74,133,72,164,45,151,110,69,72,203,47,221,194,144,198,247,12,137,180,50,127,8,234,105,140,54,241,252,122,154,176,77,60,166,158,150,211,38,158,89,79,227,182,137,47,172,167,101,183,137,207,175,167,137,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,135,32,141,211,38,158,141,52,105,155,120,8,210,178,218,196,243,144,198,110,19,95,134,180,252,54,241,217,72,147,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,15,65,26,167,77,60,27,105,210,54,241,16,164,101,181,137,231,33,141,221,38,190,12,105,249,109,226,179,145,38,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,
-105,168,220,83,214,38,30,130,52,78,155,120,54,210,164,109,226,33,72,203,106,19,207,67,26,187,77,124,25,210,242,219,196,103,35,77,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,60,210,208,185,167,180,77,60,18,105,200,220,147,221,38,30,134,52,84,238,41,107,19,143,71,26,58,247,148,182,137,71,34,13,153,123,178,219,196,195,144,134,202,61,101,109,226,241,72,67,231,158,210,54,241,72,164,33,115,79,118,155,120,24,210,80,185,167,172,77,60,4,105,156,54,241,108,164,73,219,196,67,144,150,213,38,158,135,52,118,155,248,50,164,229,183,137,207,70,154,172,77,60,30,105,232,220,83,218,38,30,137,52,100,238,201,110,19,15,67,26,42,247,148,181,137,199,35,13,157,123,74,219,196,35,145,134,204,61,217,109,226,97,72,67,229,158,178,54,241,120,164,161,115,79,105,155,120,36,210,144,185,39,187,77,60,12,105,168,220,83,214,38,30,143,52,116,238,41,109,19,143,68,26,50,247,100,183,137,135,33,13,149,123,202,218,196,227,145,134,206,61,165,109,226,145,72,67,230,158,236,54,241,48,164,161,114,79,89,155,120,62,210,46,82,239,222,188,205,232,19,223,36,39,35,145,127,248,203,95,39,50,63,249,252,179,95,127,246,249,106,251,50,160,225,183,159,61,125,250,217,179,33,244,22,133,205,206,181,68,48,229,195,86,155,100,31,121,182,228,179,224,231,35,17,233,30,239,92,17,207,47,115,163,102,129,177,229,101,70,57,150,204,235,59,47,159,50,25,52,99,112,165,251,208,43,32,57,175,47,189,17,146,103,250,212,3,145,156,234,33,143,70,50,209,26,95,27,201,57,125,237,141,144,156,238,115,175,128,228,188,190,247,70,72,158,233,131,15,68,114,170,71,61,26,201,68,235,125,109,36,231,244,205,55,66,114,186,143,190,198,234,34,171,175,190,213,234,98,218,103,31,185,186,72,244,192,135,175,46,150,91,251,171,175,46,50,250,242,123,32,121,80,161,213,70,114,178,118,107,139,228,184,182,174,131,228,34,171,102,34,57,85,206,55,68,50,204,159,8,36,15,42,192,218,72,78,214,134,109,145,28,215,238,117,144,92,100,213,76,36,167,182,11,12,145,12,243,39,2,201,131,10,179,54,146,147,181,103,91,36,199,123,3,58,72,46,178,106,38,146,83,219,17,134,72,134,249,19,129,228,65,5,91,27,201,201,218,182,45,146,227,189,7,29,36,23,89,53,19,201,169,237,14,67,36,195,252,137,64,242,160,66,174,141,228,100,237,220,22,201,241,222,134,14,146,139,172,154,137,228,212,118,138,33,146,97,254,148,214,147,147,247,48,104,212,147,179,238,101,176,170,39,79,239,105,64,214,147,19,119,40,192,235,201,203,87,67,168,215,147,51,238,117,240,64,178,118,237,34,239,222,7,91,36,43,213,46,82,119,52,40,33,217,171,118,145,115,111,132,7,146,181,107,23,121,247,74,216,34,89,169,118,145,186,3,66,9,201,94,181,139,156,123,41,60,144,172,93,187,200,187,183,194,22,201,74,181,139,212,29,19,74,72,246,170,93,228,220,123,225,129,100,237,218,69,222,189,24,182,72,86,170,93,164,238,176,80,66,178,87,237,34,231,94,13,15,36,107,215,46,242,238,221,176,69,178,82,237,34,117,71,134,18,146,189,106,23,57,247,118,24,33,57,125,143,135,2,146,243,238,245,48,66,242,204,61,31,64,36,167,238,224,64,35,153,184,90,68,27,201,57,247,130,120,32,89,187,118,145,119,111,136,45,146,149,106,23,169,59,62,148,144,236,85,187,200,185,119,196,3,201,218,181,139,188,123,73,108,145,172,84,187,72,221,33,162,132,100,175,218,69,206,189,38,30,72,214,174,93,228,221,123,98,139,100,165,218,69,234,142,18,37,36,123,213,46,114,238,77,241,64,178,118,237,34,239,94,21,91,36,43,213,46,82,119,160,40,33,217,171,118,145,115,47,139,7,146,181,107,23,121,247,182,216,34,89,169,118,145,186,99,69,9,201,94,181,139,156,123,95,140,144,156,190,7,70,1,201,121,247,194,24,33,121,230,158,24,32,146,83,119,184,160,145,76,92,77,163,141,228,156,123,101,60,144,172,93,187,200,187,119,198,22,201,74,181,139,212,29,49,74,72,246,170,93,228,220,
-91,227,129,100,237,218,69,222,189,54,182,72,86,170,93,164,238,160,81,66,178,87,237,34,231,94,28,15,36,107,215,46,242,238,205,177,69,178,82,237,34,117,199,141,18,146,189,106,23,57,247,238,120,32,89,187,118,145,119,47,143,45,146,149,106,23,169,59,116,148,144,236,85,187,200,185,215,199,3,201,218,181,139,188,123,127,108,145,172,84,187,72,221,209,163,132,100,175,218,69,206,189,65,70,72,78,223,35,164,128,228,188,123,133,140,144,60,115,207,16,16,201,169,59,128,208,72,38,174,54,210,70,114,206,189,68,30,72,214,174,93,228,221,91,100,139,100,165,218,69,234,142,33,37,36,123,213,46,114,238,61,242,64,178,118,237,34,239,94,36,91,36,43,213,46,82,119,24,41,33,217,171,118,145,115,175,146,7,146,181,107,23,121,247,46,217,34,89,169,118,145,186,35,73,9,201,94,181,139,156,123,155,60,144,172,93,187,200,187,215,201,22,201,74,181,139,212,29,76,74,72,246,170,93,228,220,11,229,129,100,237,218,69,222,189,81,182,72,86,170,93,164,238,120,82,66,178,87,237,34,231,222,41,35,36,167,239,161,82,64,114,222,189,84,70,72,158,185,167,10,136,228,212,29,82,104,36,19,87,99,105,35,57,231,94,43,15,36,107,215,46,242,238,189,178,69,178,82,237,34,117,71,149,18,146,189,106,23,57,247,102,121,32,89,187,118,145,119,175,150,45,146,149,106,23,169,59,176,148,144,236,85,187,200,185,151,203,3,201,218,181,139,188,123,187,108,145,172,84,187,72,221,177,165,132,100,175,218,69,206,189,95,30,72,214,174,93,228,221,11,102,139,100,165,218,69,234,14,47,37,36,123,213,46,114,238,21,243,64,178,118,237,34,239,222,49,91,36,43,213,46,82,119,132,41,33,217,171,118,145,115,111,153,2,146,47,90,220,110,78,63,110,54,187,179,53,214,187,247,47,62,255,251,147,135,253,224,199,215,219,248,199,133,251,212,126,255,229,15,255,251,203,47,191,185,234,246,251,179,128,213,215,223,174,26,53,86,127,254,106,181,221,221,61,60,30,183,239,54,145,49,4,106,100,94,241,198,83,137,114,90,174,158,237,191,60,13,213,254,171,46,19,117,42,57,98,105,78,129,74,77,100,143,159,161,104,83,179,140,149,123,113,124,223,12,119,58,108,239,70,106,190,251,124,248,227,23,60,40,93,134,157,211,247,249,231,173,190,207,191,88,221,236,15,171,119,219,187,205,234,221,230,112,92,127,188,100,70,153,166,60,227,150,106,157,9,70,198,84,50,193,233,106,110,1,138,43,48,116,167,117,221,184,158,211,241,195,53,116,149,88,30,106,87,135,113,175,81,122,253,238,213,205,112,47,166,89,185,198,202,220,173,31,238,154,15,93,21,88,55,66,214,175,54,171,253,203,213,110,191,251,100,183,125,88,189,91,63,60,54,131,239,95,166,23,169,9,121,35,115,148,201,78,139,249,120,117,211,46,206,87,109,209,41,75,68,48,237,238,241,205,237,230,192,150,54,156,20,94,50,73,189,145,62,253,182,132,153,83,103,246,7,52,156,218,77,203,202,169,211,73,249,58,181,175,208,155,57,117,166,84,174,225,212,110,90,86,78,157,78,202,215,169,125,177,218,204,169,51,85,99,13,167,118,211,178,114,234,116,82,190,78,237,235,182,102,78,157,41,160,106,56,181,155,150,149,83,167,147,242,117,106,95,194,52,115,234,76,45,81,195,169,221,180,172,156,58,157,148,131,83,155,149,247,101,225,182,61,37,23,228,119,251,93,35,242,116,220,190,218,173,31,94,52,127,189,234,114,183,62,158,86,47,15,251,55,97,172,213,105,31,254,243,100,213,125,114,181,57,28,154,149,249,126,183,218,55,95,127,249,176,255,49,206,28,134,162,115,242,2,166,26,179,179,207,213,237,197,110,223,126,130,97,30,90,35,90,4,195,12,66,3,164,220,31,31,68,19,217,253,180,145,186,63,117,56,172,76,13,172,251,105,243,208,26,209,34,16,238,95,54,64,194,253,131,211,91,18,187,55,3,8,221,159,60,81,85,166,6,212,253,25,230,161,53,162,69,0,220,79,24,32,225,254,193,145,39,137,221,155,1,132,238,79,30,67,42,83,3,234,254,12,243,208,26,209,34,0,238,39,12,144,112,255,224,156,144,196,238,205,0,66,247,39,207,238,148,169,1,117,127,134,121,104,141,104,17,0,247,19,6,72,184,127,112,184,70,98,247,102,0,161,251,147,
-7,94,202,212,128,186,63,195,60,180,70,180,8,128,251,9,3,36,220,63,56,145,34,177,123,51,128,208,253,201,83,34,101,106,64,221,159,97,30,90,35,90,4,192,253,132,1,18,238,47,182,123,51,128,208,253,65,52,204,253,87,53,160,238,47,240,199,85,35,90,4,192,253,132,1,82,43,255,211,161,112,201,125,58,72,87,254,141,104,220,202,255,162,6,118,229,79,155,135,214,136,22,129,88,249,47,27,96,224,254,211,102,182,174,49,58,155,55,178,251,105,179,84,110,56,109,242,76,60,20,157,115,68,144,169,70,129,251,79,155,197,178,207,188,94,180,70,180,8,134,25,132,6,72,185,127,225,253,195,60,187,247,229,6,129,251,51,223,9,100,170,129,117,63,109,30,90,35,90,4,194,253,203,6,72,184,127,233,165,189,44,187,159,203,13,124,247,231,190,72,199,84,3,234,254,12,243,208,26,209,34,0,238,39,12,144,112,255,210,155,110,89,118,63,151,27,248,238,207,125,251,140,169,6,212,253,25,230,161,53,162,69,0,220,79,24,32,225,254,165,215,195,178,236,126,46,55,240,221,159,251,202,22,83,13,168,251,51,204,67,107,68,139,0,184,159,48,64,194,253,75,239,84,101,217,253,92,110,224,187,63,247,61,39,166,26,80,247,103,152,135,214,136,22,1,112,63,97,128,132,251,151,94,68,202,178,251,185,220,192,119,127,238,203,65,76,53,160,238,207,48,15,173,17,45,2,224,126,194,0,9,247,23,219,253,92,110,224,187,63,89,239,40,83,3,234,254,2,127,92,53,162,69,0,220,79,24,32,181,242,143,235,26,162,37,119,95,110,16,172,252,83,245,142,50,53,176,43,127,218,60,180,70,180,8,196,202,127,217,0,177,251,155,36,97,174,174,17,82,144,180,221,155,191,46,148,27,66,71,150,28,19,143,68,207,205,187,80,13,185,251,155,47,47,149,125,18,122,209,26,209,34,24,102,16,26,32,229,254,168,174,33,179,123,87,110,144,184,63,81,239,40,84,3,235,126,218,60,180,70,180,8,132,251,151,13,144,112,127,92,215,16,217,189,47,55,8,220,159,170,119,20,170,1,117,127,134,121,104,141,104,17,0,247,19,6,72,184,63,174,107,136,236,222,151,27,4,238,79,213,59,10,213,128,186,63,195,60,180,70,180,8,128,251,9,3,36,220,31,215,53,68,118,239,203,13,2,247,167,234,29,133,106,64,221,159,97,30,90,35,90,4,192,253,132,1,18,238,143,235,26,34,187,247,229,6,129,251,83,245,142,66,53,160,238,207,48,15,173,17,45,2,224,126,194,0,9,247,199,117,13,145,221,251,114,131,192,253,169,122,71,161,26,80,247,103,152,135,214,136,22,1,112,63,97,128,132,251,139,237,222,151,27,4,238,79,213,59,10,213,128,186,191,192,31,87,141,104,17,0,247,19,6,72,173,252,163,186,134,108,201,221,149,27,36,43,255,68,189,163,80,13,236,202,159,54,15,173,17,45,2,177,242,95,54,64,236,254,102,149,56,87,215,8,107,208,180,221,155,191,46,148,27,66,251,210,28,19,143,68,207,205,187,80,13,185,251,155,47,47,149,125,18,122,209,26,209,34,24,102,16,26,32,229,254,168,174,33,179,123,87,110,144,184,63,81,239,40,84,3,235,126,218,60,180,70,180,8,132,251,151,13,144,112,127,92,215,16,217,189,47,55,8,220,159,170,119,20,170,1,117,127,134,121,104,141,104,17,0,247,19,6,72,184,63,174,107,136,236,222,151,27,4,238,79,213,59,10,213,128,186,63,195,60,180,70,180,8,128,251,9,3,36,220,31,215,53,68,118,239,203,13,2,247,167,234,29,133,106,64,221,159,97,30,90,35,90,4,192,253,132,1,18,238,143,235,26,34,187,247,229,6,129,251,83,245,142,66,53,160,238,207,48,15,173,17,45,2,224,126,194,0,9,247,199,117,13,145,221,251,114,131,192,253,169,122,71,161,26,80,247,103,152,135,214,136,22,1,112,63,97,128,132,251,139,237,222,151,27,4,238,79,213,59,10,213,128,186,191,192,31,87,141,104,17,0,247,19,6,72,173,252,163,186,134,108,201,221,149,27,36,43,255,68,189,163,80,13,236,202,159,54,15,173,17,45,2,177,242,95,54,64,236,254,102,153,48,87,215,8,139,144,180,221,155,191,46,148,27,194,93,31,57,38,30,137,158,155,119,161,26,114,247,55,95,94,42,251,36,244,162,53,162,69,48,204,32,52,64,202,253,81,93,67,
-102,247,174,220,32,113,127,162,222,81,168,6,214,253,180,121,104,141,104,17,8,247,47,27,32,225,254,184,174,33,178,123,95,110,16,184,63,85,239,40,84,3,234,254,12,243,208,26,209,34,0,238,39,12,144,112,127,92,215,16,217,189,47,55,8,220,159,170,119,20,170,1,117,127,134,121,104,141,104,17,0,247,19,6,72,184,63,174,107,136,236,222,151,27,4,238,79,213,59,10,213,128,186,63,195,60,180,70,180,8,128,251,9,3,36,220,31,215,53,68,118,239,203,13,2,247,167,234,29,133,106,64,221,159,97,30,90,35,90,4,192,253,132,1,18,238,143,235,26,34,187,247,229,6,129,251,83,245,142,66,53,160,238,207,48,15,173,17,45,2,224,126,194,0,9,247,23,219,189,47,55,8,220,159,170,119,20,170,1,117,127,129,63,174,26,209,34,0,238,39,12,144,90,249,71,117,13,217,146,187,43,55,72,86,254,137,122,71,161,26,216,149,63,109,30,90,35,90,4,98,229,191,108,128,216,253,13,79,204,213,53,2,11,165,237,222,252,117,161,220,16,46,198,204,49,241,72,244,220,188,11,213,144,187,191,249,242,82,217,39,161,23,173,17,45,130,97,6,161,1,82,238,143,234,26,50,187,119,229,6,137,251,19,245,142,66,53,176,238,167,205,67,107,68,139,64,184,127,217,0,9,247,199,117,13,145,221,251,114,131,192,253,169,122,71,161,26,80,247,103,152,135,214,136,22,1,112,63,97,128,132,251,227,186,134,200,238,125,185,65,224,254,84,189,163,80,13,168,251,51,204,67,107,68,139,0,184,159,48,64,194,253,113,93,67,100,247,190,220,32,112,127,170,222,81,168,6,212,253,25,230,161,53,162,69,0,220,79,24,32,225,254,184,174,33,178,123,95,110,16,184,63,85,239,40,84,3,234,254,12,243,208,26,209,34,0,238,39,12,144,112,127,92,215,16,217,189,47,55,8,220,159,170,119,20,170,1,117,127,134,121,104,141,104,17,0,247,19,6,72,184,191,216,238,125,185,65,224,254,84,189,163,80,13,168,251,11,252,113,213,136,22,1,112,63,97,128,212,202,63,170,107,200,150,220,93,185,65,178,242,79,212,59,10,213,192,174,252,105,243,208,26,209,34,16,43,255,101,3,196,238,111,2,197,92,93,35,132,161,180,221,195,45,106,233,114,67,123,27,89,134,137,71,162,231,230,93,168,134,220,253,205,151,151,202,62,9,189,104,141,104,17,12,51,8,13,144,114,127,84,215,144,217,189,43,55,72,220,159,168,119,20,170,129,117,63,109,30,90,35,90,4,194,253,203,6,72,184,63,174,107,136,236,222,151,27,4,238,79,213,59,10,213,128,186,63,195,60,180,70,180,8,128,251,9,3,36,220,31,215,53,68,118,239,203,13,2,247,167,234,29,133,106,64,221,159,97,30,90,35,90,4,192,253,132,1,18,238,143,235,26,34,187,247,229,6,129,251,83,245,142,66,53,160,238,207,48,15,173,17,45,2,224,126,194,0,9,247,199,117,13,145,221,251,114,131,192,253,169,122,71,161,26,80,247,103,152,135,214,136,22,1,112,63,97,128,132,251,227,186,134,200,238,125,185,65,224,254,84,189,163,80,13,168,251,51,204,67,107,68,139,0,184,159,48,64,194,253,197,118,239,203,13,2,247,167,234,29,133,106,64,221,95,224,143,171,70,180,8,128,251,9,3,164,86,254,81,93,67,182,228,238,202,13,146,149,127,162,222,81,168,6,118,229,79,155,135,214,136,22,129,88,249,47,27,32,118,127,35,101,174,174,17,132,167,237,222,252,117,161,220,208,252,53,203,196,35,209,115,243,46,84,67,238,254,230,203,75,101,159,132,94,180,70,180,8,134,25,132,6,72,185,63,170,107,200,236,222,149,27,36,238,79,212,59,10,213,192,186,159,54,15,173,17,45,2,225,254,101,3,36,220,31,215,53,68,118,239,203,13,2,247,167,234,29,133,106,64,221,159,97,30,90,35,90,4,192,253,132,1,18,238,143,235,26,34,187,247,229,6,129,251,83,245,142,66,53,160,238,207,48,15,173,17,45,2,224,126,194,0,9,247,199,117,13,145,221,251,114,131,192,253,169,122,71,161,26,80,247,103,152,135,214,136,22,1,112,63,97,128,132,251,227,186,134,200,238,125,185,65,224,254,84,189,163,80,13,168,251,51,204,67,107,68,139,0,184,159,48,64,194,253,113,93,67,100,247,190,220,32,112,127,170,222,81,168,6,212,253,25,230,161,53,162,
-69,0,220,79,24,32,225,254,98,187,247,229,6,129,251,83,245,142,66,53,160,238,47,240,199,85,35,90,4,192,253,132,1,82,43,255,168,174,33,91,114,119,229,6,201,202,63,81,239,40,84,3,187,242,167,205,67,107,68,139,64,172,252,151,13,48,232,232,125,186,8,95,239,222,95,123,72,55,138,44,180,210,62,29,230,196,54,3,180,157,164,79,135,188,174,217,67,209,179,173,172,203,212,40,232,232,125,58,140,125,147,97,30,90,35,90,4,195,12,66,3,12,58,123,189,60,189,222,236,54,15,199,205,205,187,80,117,122,178,186,253,252,162,203,139,207,255,222,252,252,69,252,243,89,163,238,167,88,167,110,164,171,58,95,189,252,36,252,226,147,48,246,106,255,118,115,88,159,182,141,173,27,189,214,199,227,230,205,237,195,102,181,94,53,19,185,223,134,223,55,238,104,6,122,124,32,148,123,247,121,39,185,50,181,198,54,123,247,69,247,79,47,181,226,42,98,100,179,170,212,250,64,108,86,7,206,22,45,231,160,226,229,127,111,246,247,143,205,231,238,214,15,119,177,230,199,127,109,14,251,240,116,156,54,65,159,237,41,214,227,221,250,240,213,247,255,207,151,223,125,123,85,229,191,118,235,195,251,213,221,235,205,221,63,86,47,155,160,28,190,190,218,191,92,61,255,197,220,168,199,215,39,133,81,183,59,141,81,155,52,92,97,212,38,187,83,24,181,73,26,202,71,141,134,221,109,31,154,81,27,32,38,70,253,230,171,175,211,131,54,95,158,29,115,127,34,135,253,246,135,229,145,219,33,166,131,55,191,239,2,250,236,184,205,168,215,33,191,219,156,30,155,111,52,143,207,234,247,251,253,195,102,29,58,53,54,148,124,220,196,134,237,7,236,158,129,211,102,105,192,78,199,70,234,143,219,230,97,108,190,56,241,82,55,88,7,253,112,147,7,96,176,14,241,161,63,36,96,176,14,232,161,235,128,104,176,235,178,168,89,156,45,88,237,251,175,254,244,205,120,188,240,149,213,205,39,159,63,249,245,147,134,62,198,234,245,3,246,65,3,55,96,31,47,112,3,246,161,2,55,96,31,37,112,3,246,1,162,96,192,203,136,235,219,227,130,151,127,247,251,239,199,227,53,95,216,63,60,158,54,171,119,235,135,199,205,68,195,110,188,212,227,33,29,47,245,132,72,199,75,61,36,210,241,58,15,135,119,62,48,227,117,14,14,135,9,164,227,93,6,252,100,41,244,125,249,167,241,112,187,205,171,110,249,49,86,236,147,165,168,199,28,39,25,240,152,227,36,99,29,115,156,148,251,184,227,164,220,150,51,206,101,160,127,255,247,5,143,125,245,205,31,190,235,210,230,241,128,207,87,255,190,250,60,86,168,29,39,229,49,238,56,41,143,113,199,73,121,140,59,78,202,99,220,113,82,30,203,24,231,234,249,165,71,236,143,95,166,7,250,100,168,208,39,75,143,24,119,156,148,195,184,227,164,28,198,29,39,229,48,238,56,41,135,101,140,115,245,252,77,147,87,54,174,122,210,228,186,157,223,102,34,237,31,255,56,30,174,95,108,62,255,188,65,192,243,47,158,172,94,61,174,15,235,221,105,19,22,80,151,218,213,234,246,125,147,159,133,15,110,119,175,86,15,235,195,171,205,97,117,122,255,118,176,32,157,42,48,67,29,182,10,204,112,161,173,2,51,228,110,171,192,204,106,197,86,129,153,229,23,173,64,70,13,181,25,243,82,224,204,146,153,150,118,153,97,87,130,56,54,217,214,170,201,241,186,181,71,106,118,93,72,115,124,196,58,5,28,31,177,78,1,199,71,172,83,192,241,17,75,38,4,138,8,95,144,9,70,120,71,182,142,8,239,20,112,68,120,167,128,35,194,147,25,162,34,192,22,100,130,1,214,173,194,28,1,214,41,224,8,176,100,198,174,232,223,5,153,96,255,118,171,99,71,255,38,11,24,138,230,93,144,9,54,111,178,156,162,56,187,5,153,168,217,133,43,187,93,83,152,129,2,30,193,97,160,128,7,251,12,20,240,88,95,13,20,48,90,95,209,50,193,8,247,203,32,6,10,56,34,220,47,131,24,40,224,136,112,211,12,130,150,9,70,184,95,6,49,80,192,17,225,126,25,196,64,1,163,12,130,150,9,6,152,95,6,49,80,192,17,96,166,25,4,45,19,236,95,191,12,98,160,128,81,6,65,203,4,155,215,52,131,160,101,162,102,23,110,127,117,205,32,6,10,120,4,135,129,2,30,236,51,80,192,
-136,125,104,153,96,128,249,45,224,7,10,56,2,204,111,1,63,80,192,22,96,11,50,193,0,243,91,63,15,20,112,4,152,223,250,121,160,128,45,192,12,214,207,189,36,191,245,243,64,1,71,128,153,174,159,105,153,96,255,250,173,159,7,10,24,173,159,105,153,96,243,154,174,159,105,153,168,217,133,107,244,92,215,207,3,5,60,130,195,64,1,163,224,64,203,4,251,215,111,249,58,80,192,209,191,5,203,87,177,127,23,100,130,253,235,183,122,28,40,224,232,223,130,213,163,216,191,11,50,193,254,245,91,188,13,20,112,244,175,233,226,141,150,9,246,175,223,226,109,160,128,209,226,141,150,9,54,175,233,226,141,150,137,154,93,184,12,199,117,241,54,80,192,8,60,180,76,176,121,253,214,78,3,5,108,205,187,32,19,108,94,191,165,203,64,1,91,243,46,200,4,155,215,111,229,48,80,192,214,188,11,50,193,230,245,35,238,129,2,182,230,53,32,238,94,146,41,113,211,50,81,179,11,237,204,203,136,155,63,59,90,38,120,118,5,188,41,158,221,130,76,240,236,10,104,75,60,187,5,153,224,217,21,176,134,120,118,11,50,193,179,43,8,218,226,217,45,200,4,207,206,52,102,210,50,1,179,251,36,227,117,215,239,255,235,247,233,217,125,82,72,184,159,100,188,238,106,172,192,180,42,97,172,192,116,207,210,88,129,233,169,86,99,5,102,218,151,208,10,228,180,12,124,188,101,188,238,218,200,76,75,19,61,98,41,18,53,51,111,42,249,52,86,192,241,17,75,157,59,49,86,64,244,136,137,17,190,32,19,140,240,212,66,202,204,188,169,252,223,88,1,71,132,167,14,190,104,2,108,65,38,24,96,169,181,172,153,121,83,21,16,99,5,68,0,19,251,119,65,38,216,191,169,213,188,153,121,83,37,24,77,243,46,200,4,155,55,149,78,104,206,110,65,38,106,118,196,235,174,250,224,33,94,119,53,86,192,131,125,136,215,93,141,21,48,90,95,209,50,193,8,247,203,32,136,215,93,141,21,112,68,184,95,6,65,188,122,170,137,112,131,12,130,120,221,213,204,188,126,25,4,241,186,171,177,2,70,25,4,45,19,12,48,191,12,130,120,221,213,88,1,163,12,130,150,9,246,175,95,6,65,188,122,170,105,94,131,12,130,120,245,84,115,118,6,25,4,241,186,171,62,120,136,215,93,141,21,240,96,31,226,213,83,21,128,209,50,193,0,243,91,192,19,175,187,26,43,224,8,176,130,5,188,24,96,11,50,193,0,243,91,63,19,175,187,26,43,224,8,48,211,245,51,45,19,12,48,191,245,51,241,186,171,177,2,70,235,103,90,38,216,191,126,235,103,226,213,83,77,243,26,172,159,137,87,79,53,103,103,176,126,38,94,119,213,7,15,241,186,171,177,2,70,193,129,150,9,246,175,223,242,149,120,221,213,88,1,91,255,46,200,4,251,215,111,245,72,188,238,106,172,128,173,127,23,100,130,253,235,183,120,35,94,119,53,86,192,214,191,6,139,55,226,117,87,51,243,154,46,222,104,153,96,243,154,46,222,104,153,168,217,17,175,187,234,131,135,120,245,84,197,188,180,76,176,121,253,214,78,196,171,167,154,230,93,144,9,54,175,223,210,133,120,245,84,211,188,11,50,193,230,245,91,57,16,175,158,106,154,119,65,38,216,188,126,196,77,188,122,170,105,94,3,226,38,94,61,213,156,157,1,113,19,175,158,170,204,142,150,9,158,93,1,111,138,103,183,32,19,60,187,2,218,18,207,110,65,38,120,118,5,172,33,158,221,130,76,240,236,10,130,182,120,118,11,50,193,179,51,141,153,180,76,192,236,254,45,227,117,215,191,252,215,215,233,217,253,91,33,225,254,91,198,235,174,198,10,76,171,18,198,10,76,247,44,141,21,152,158,106,53,86,96,250,234,105,134,2,25,143,216,155,199,7,198,235,174,141,204,180,52,209,35,150,34,81,51,243,166,146,79,99,5,28,31,177,212,185,19,99,5,68,143,152,24,225,11,50,193,8,79,45,164,204,204,155,202,255,141,21,112,68,120,234,224,139,38,192,22,100,130,1,150,90,203,154,153,55,85,1,49,86,64,4,48,177,127,23,100,130,253,155,90,205,155,153,55,85,130,209,52,239,130,76,176,121,83,233,132,230,236,22,100,162,102,71,188,238,170,15,30,226,117,87,99,5,60,216,135,120,221,213,88,1,163,245,21,45,19,140,112,191,12,130,120,221,213,88,1,71,132,251,101,16,
-196,171,167,154,8,55,200,32,136,215,93,205,204,235,151,65,16,175,187,26,43,96,148,65,208,50,193,0,243,203,32,136,215,93,141,21,48,202,32,104,153,96,255,250,101,16,196,171,167,154,230,53,200,32,136,87,79,53,103,103,144,65,16,175,187,234,131,135,120,221,213,88,1,15,246,33,94,61,85,1,24,45,19,12,48,191,5,60,241,186,171,177,2,142,0,43,88,192,139,1,182,32,19,12,48,191,245,51,241,186,171,177,2,142,0,51,93,63,211,50,193,0,243,91,63,19,175,187,26,43,96,180,126,166,101,130,253,235,183,126,38,94,61,213,52,175,193,250,153,120,245,84,115,118,6,235,103,226,117,87,125,240,16,175,187,26,43,96,20,28,104,153,96,255,250,45,95,137,215,93,141,21,176,245,239,130,76,176,127,253,86,143,196,235,174,198,10,216,250,119,65,38,216,191,126,139,55,226,117,87,99,5,108,253,107,176,120,35,94,119,53,51,175,233,226,141,150,9,54,175,233,226,141,150,137,154,29,241,186,171,62,120,136,87,79,85,204,75,203,4,155,215,111,237,68,188,122,170,105,222,5,153,96,243,250,45,93,136,87,79,53,205,187,32,19,108,94,191,149,3,241,234,169,166,121,23,100,130,205,235,71,220,196,171,167,154,230,53,32,110,226,213,83,205,217,25,16,55,241,234,169,202,236,104,153,224,217,21,240,166,120,118,11,50,193,179,43,160,45,241,236,22,100,130,103,87,192,26,226,217,45,200,4,207,174,32,104,139,103,183,32,19,60,59,211,152,73,203,44,152,93,248,230,122,119,223,221,93,123,60,29,218,39,252,116,8,39,26,79,135,153,187,107,155,95,94,132,253,97,191,187,91,159,54,187,230,255,86,95,127,249,127,255,176,10,3,125,247,213,159,254,252,67,51,242,100,224,109,255,108,165,198,13,27,116,203,67,183,31,122,213,76,229,109,243,229,230,99,235,211,54,24,240,229,69,230,197,130,159,101,188,188,251,199,175,158,167,125,245,217,172,175,238,183,239,182,247,155,176,126,248,215,230,176,143,60,214,252,33,249,246,228,172,228,180,204,161,12,18,149,159,101,188,37,108,53,211,89,201,138,51,157,86,141,172,102,58,43,89,113,166,211,205,107,171,153,206,74,86,156,233,244,28,181,213,76,103,37,43,206,116,250,86,181,213,76,103,37,171,204,52,181,86,212,159,233,130,100,197,153,122,196,222,5,201,138,51,245,136,189,11,146,21,103,234,17,123,23,36,43,206,212,35,246,46,72,86,156,169,71,236,93,144,172,50,211,84,38,171,63,211,5,201,138,51,245,136,189,11,146,21,103,234,17,123,23,36,43,206,212,35,246,46,72,86,156,169,71,236,93,144,172,56,83,143,216,187,32,89,101,166,169,58,155,254,76,23,36,43,206,212,35,246,46,72,86,156,169,71,236,93,144,172,56,83,143,216,187,32,89,113,166,30,177,119,65,178,226,76,61,98,239,130,100,149,153,166,118,1,244,103,186,32,89,113,166,30,177,119,65,178,226,76,61,98,239,130,100,197,153,122,196,222,5,201,138,51,245,136,189,11,146,21,103,234,17,123,23,36,171,204,52,181,71,169,63,211,5,201,138,51,245,136,189,11,146,21,103,234,17,123,23,36,43,206,212,35,246,46,72,86,156,169,71,236,93,144,172,56,83,143,216,187,32,25,59,83,162,195,159,226,76,105,201,138,51,53,141,189,180,100,197,153,154,198,94,90,178,226,76,77,99,47,45,89,113,166,166,177,151,150,172,50,83,135,221,127,90,178,226,76,61,34,146,217,238,63,209,99,210,106,166,118,17,201,97,247,159,150,172,56,83,143,136,100,182,251,79,116,208,212,159,169,217,158,56,209,170,211,106,166,118,17,201,97,79,156,150,172,56,83,143,136,100,182,39,62,144,231,17,145,204,246,196,137,150,171,250,51,53,219,41,38,122,187,90,205,212,46,34,57,236,20,211,146,21,103,234,17,145,204,118,138,7,242,60,34,146,217,78,49,209,36,88,127,166,102,251,167,68,103,96,171,153,218,69,36,135,253,83,90,178,226,76,61,34,146,217,254,233,64,158,71,68,50,219,63,37,122,92,235,207,212,108,87,113,32,207,35,34,153,237,42,14,228,121,68,36,179,93,197,129,60,143,136,100,182,171,56,144,231,17,145,204,118,21,137,94,248,138,51,165,37,43,206,212,52,34,209,146,21,103,106,26,145,104,201,138,51,53,141,72,180,100,149,153,58,236,64,209,146,21,103,234,
-241,156,154,237,64,17,151,36,88,205,212,238,57,117,216,129,162,37,171,204,212,97,95,134,150,172,56,83,143,231,212,108,95,134,184,107,194,106,166,118,207,169,195,190,12,45,89,101,166,14,187,21,180,100,197,153,122,60,167,102,187,21,196,245,25,86,51,181,123,78,29,118,43,104,201,42,51,117,168,225,211,146,21,103,234,241,156,154,213,240,7,242,60,158,83,179,26,254,64,158,199,115,106,86,195,39,110,159,209,159,169,89,101,123,32,207,227,57,53,171,108,15,228,121,60,167,102,149,237,129,60,143,231,212,172,178,77,220,221,164,56,83,90,178,226,76,77,159,83,90,178,226,76,77,159,83,90,178,202,76,29,170,160,180,100,197,153,122,160,215,172,10,74,220,123,101,53,83,59,244,58,212,6,105,201,138,51,245,64,175,89,109,144,184,213,203,106,166,118,232,117,168,152,209,146,21,103,234,129,94,179,138,25,113,103,153,213,76,237,208,235,80,71,162,37,43,206,212,3,189,102,117,164,129,60,15,244,154,213,145,136,235,225,244,103,106,86,93,25,200,243,64,175,89,117,101,32,207,3,189,102,213,21,226,202,65,197,153,210,146,21,103,106,138,94,90,178,202,76,29,50,113,90,178,226,76,61,124,106,150,137,19,151,43,234,207,212,44,63,37,110,84,180,154,169,157,79,29,178,54,90,178,226,76,61,124,106,150,181,17,215,72,234,207,212,44,151,33,238,142,180,154,169,157,79,29,86,248,180,100,197,153,122,248,212,108,133,79,220,158,169,56,83,90,178,202,76,29,86,131,180,100,149,153,58,172,145,104,201,42,51,117,88,57,208,146,85,102,234,192,167,180,100,149,153,58,176,12,45,185,120,166,23,209,191,204,184,222,240,47,223,254,49,61,213,95,242,166,250,102,127,207,184,88,177,145,156,150,201,116,234,47,51,174,55,180,154,233,172,100,197,153,78,95,142,180,154,233,172,100,197,153,78,91,174,90,205,116,86,178,202,76,83,155,240,250,51,93,144,172,56,83,143,231,116,65,178,226,76,61,158,211,5,201,138,51,245,120,78,23,36,171,204,52,117,220,64,127,166,11,146,21,103,234,241,156,46,72,86,156,169,199,115,186,32,89,113,166,30,207,233,130,100,149,153,166,14,86,232,207,116,65,178,226,76,61,158,211,5,201,138,51,245,120,78,23,36,43,206,212,227,57,93,144,172,50,211,84,129,89,127,166,11,146,85,102,154,74,253,245,103,186,32,25,59,83,226,170,1,197,153,210,146,21,103,106,26,123,105,201,138,51,53,141,189,180,100,197,153,154,198,94,90,178,202,76,29,106,14,180,100,197,153,122,60,167,102,53,7,162,1,191,213,76,237,158,83,135,76,156,150,172,56,83,15,244,154,101,226,68,179,118,171,153,218,161,215,33,63,165,37,43,206,212,3,189,102,249,41,209,216,219,106,166,118,232,117,200,218,104,201,42,51,117,200,218,104,201,216,153,18,77,43,21,103,74,75,86,156,169,105,68,162,37,43,206,212,52,34,209,146,21,103,106,154,181,209,146,85,102,234,144,181,209,146,21,103,234,241,156,154,101,109,3,121,30,207,169,89,214,70,180,114,212,159,169,89,214,70,180,114,180,154,169,29,122,29,114,25,90,178,226,76,61,124,106,150,203,16,205,240,244,103,106,182,194,39,26,167,233,207,212,108,133,79,180,41,82,156,41,45,89,113,166,166,207,41,45,89,113,166,166,43,7,90,178,226,76,77,87,248,180,100,149,153,58,172,240,105,201,138,51,245,120,78,205,86,248,3,121,30,207,169,217,10,159,104,200,164,63,83,179,21,254,64,158,7,122,205,86,248,68,155,34,253,153,154,173,240,137,230,61,250,51,53,91,247,18,45,109,244,103,106,182,238,37,154,130,40,206,148,150,172,50,211,84,171,12,253,153,46,72,86,153,105,170,129,132,254,76,23,36,171,204,52,213,86,65,127,166,11,146,85,102,234,16,123,105,201,42,51,117,136,189,180,100,236,76,137,87,240,21,103,74,75,86,153,105,234,21,124,253,153,46,72,86,153,105,234,21,124,253,153,46,72,86,153,105,234,21,124,253,153,46,72,86,153,105,234,21,124,253,153,46,72,86,153,169,67,236,165,37,23,207,244,34,122,189,187,111,143,254,111,187,5,232,182,125,237,106,59,38,182,223,125,51,43,178,249,117,35,52,182,220,121,184,229,183,162,185,195,17,71,70,185,195,17,251,94,220,225,136,212,147,28,238,50,94,255,22,198,178,43,190,
-253,110,110,180,111,191,27,233,150,245,118,58,107,44,194,9,172,177,8,15,176,198,34,204,79,140,117,25,236,167,44,235,255,109,126,184,191,77,116,251,41,203,1,220,225,8,31,112,135,35,220,192,29,142,240,4,57,220,101,188,223,254,54,195,118,95,127,255,231,116,0,254,237,111,219,104,120,88,111,143,155,107,0,222,63,158,86,251,151,205,111,119,175,54,171,227,230,110,191,187,95,237,223,110,154,159,239,163,104,252,112,124,205,232,240,208,168,177,160,192,130,68,146,133,6,86,72,189,184,110,108,133,5,53,44,172,144,122,45,216,216,10,11,106,88,88,33,245,210,165,177,21,22,212,80,181,2,241,162,151,149,21,104,53,44,172,144,162,2,99,43,44,168,97,97,133,212,235,24,198,86,88,80,195,194,10,169,99,253,198,86,88,80,67,213,10,196,161,105,43,43,208,106,88,88,33,181,97,109,108,133,5,53,44,172,144,90,217,26,91,97,65,13,11,43,164,14,3,26,91,97,65,13,85,43,16,135,202,172,172,64,171,97,97,133,212,145,29,99,43,44,168,97,97,133,212,209,15,99,43,44,168,97,97,133,84,162,110,108,133,5,53,192,86,184,40,242,236,89,70,102,255,221,146,25,158,61,147,155,225,192,42,48,124,55,111,134,94,129,18,48,12,172,144,202,236,141,173,176,160,134,133,21,82,153,189,177,21,22,212,176,176,66,42,179,55,182,194,130,26,170,86,32,50,123,43,43,208,106,88,88,33,149,217,27,91,97,65,13,11,43,164,50,123,99,43,44,168,97,97,133,84,102,111,108,133,5,53,84,173,64,100,246,86,86,160,213,176,176,66,42,179,55,182,194,130,26,22,86,72,101,246,198,86,88,80,195,194,10,169,204,222,216,10,11,106,168,90,129,200,236,173,172,64,171,97,97,133,84,102,111,108,133,5,53,44,172,144,202,236,141,173,176,160,134,133,21,82,153,189,177,21,22,212,0,91,225,90,103,201,56,75,242,245,15,179,229,141,209,217,138,110,131,231,116,104,65,125,58,148,142,180,223,222,135,145,154,255,148,142,52,44,91,0,70,234,83,127,192,72,125,250,12,24,169,79,65,1,35,117,231,22,17,35,117,231,2,203,240,52,232,32,10,24,9,224,187,65,138,131,24,9,224,187,65,23,49,196,72,0,223,13,251,8,1,70,2,248,110,176,12,69,140,4,240,221,160,63,4,98,36,128,239,134,111,136,3,70,2,248,110,176,84,64,140,4,240,221,224,29,71,196,72,0,223,13,222,209,67,140,4,240,221,224,29,51,196,72,0,223,13,222,145,66,140,4,240,221,224,29,31,196,72,0,223,13,222,81,65,140,4,240,221,224,29,11,196,72,50,223,93,135,122,154,179,142,254,114,118,172,167,99,181,158,230,172,164,57,99,81,107,105,206,88,212,106,90,48,86,18,163,130,177,146,40,21,140,149,196,169,96,172,36,82,5,99,37,177,202,194,23,177,178,22,140,5,241,35,181,186,22,140,5,241,35,181,194,22,140,5,241,35,181,202,22,140,5,241,35,181,210,22,140,5,241,35,181,218,22,140,5,241,35,181,226,22,140,5,241,35,181,234,22,140,5,241,35,181,242,22,140,5,241,35,181,250,22,140,5,241,35,181,2,23,140,5,241,35,181,10,23,140,5,241,35,181,18,23,140,5,241,35,181,26,23,140,5,241,35,181,34,23,140,37,244,227,181,196,159,177,38,255,211,236,250,254,217,72,173,103,25,43,114,198,72,196,122,156,49,18,177,26,231,143,148,194,40,127,164,20,66,249,35,165,240,201,31,41,133,78,254,72,41,108,114,240,180,188,2,231,143,4,240,29,177,250,230,143,4,240,29,177,242,230,143,4,240,29,177,234,230,143,4,240,29,177,226,230,143,4,240,29,177,218,230,143,4,240,29,177,210,230,143,4,240,29,177,202,230,143,4,240,29,177,194,230,143,4,240,29,177,186,230,143,4,240,29,177,178,230,143,4,240,29,177,170,230,143,4,240,29,177,162,230,143,4,240,29,177,154,230,143,4,240,29,177,146,230,143,36,243,221,117,168,156,218,246,159,102,215,228,207,198,235,251,103,57,181,109,214,88,212,90,154,51,22,181,154,22,140,149,196,168,96,172,36,74,5,99,37,113,42,24,43,137,84,193,88,73,172,178,240,69,172,172,5,99,65,252,72,173,174,5,99,65,252,72,173,176,5,99,65,252,72,173,178,5,99,65,252,72,173,180,5,99,65,252,72,173,182,5,99,65,252,
-72,173,184,5,99,65,252,72,173,186,5,99,65,252,72,173,188,5,99,65,252,72,173,190,5,99,65,252,72,173,192,5,99,65,252,72,173,194,5,99,65,252,72,173,196,5,99,65,252,72,173,198,5,99,65,252,72,173,200,5,99,9,253,120,25,236,105,206,162,252,203,255,156,27,236,233,88,177,167,57,139,114,214,88,196,162,156,53,22,177,40,151,140,149,2,171,100,172,20,88,37,99,165,192,42,25,43,5,86,201,88,41,176,242,240,181,188,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,5,241,35,177,40,151,140,37,244,227,101,176,143,114,22,229,223,204,174,240,63,26,43,246,81,206,162,156,53,22,177,40,103,141,69,44,202,37,99,165,192,42,25,43,5,86,201,88,41,176,74,198,74,129,85,50,86,10,172,60,124,45,47,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,65,252,72,44,202,37,99,9,253,120,25,236,238,205,219,233,170,124,210,170,241,15,127,249,235,100,184,79,62,255,236,215,159,125,190,218,190,108,143,151,127,246,244,233,103,227,83,54,253,216,195,85,58,118,236,225,170,29,59,54,209,208,21,49,118,170,77,42,98,236,84,243,81,196,216,169,150,158,136,177,251,167,67,101,236,254,105,1,227,123,144,37,168,140,173,130,147,97,22,161,50,182,10,78,134,89,134,202,216,42,56,25,102,33,42,99,171,224,100,152,165,168,140,173,130,147,97,22,163,50,182,10,78,134,89,142,202,216,42,56,25,102,65,42,99,171,224,100,152,37,169,140,173,130,147,97,22,165,50,182,10,78,134,89,150,202,216,42,56,25,102,97,42,99,171,224,100,152,165,169,140,173,130,147,97,22,167,50,182,10,78,134,89,158,202,216,24,156,92,6,191,221,156,126,220,108,118,55,183,255,177,222,189,127,241,249,147,135,125,255,143,215,219,238,31,179,41,230,239,191,252,225,127,127,249,229,55,87,129,191,63,15,180,250,250,219,112,171,238,234,207,95,173,182,187,187,135,199,227,246,221,160,187,104,255,177,23,199,247,205,55,79,135,237,221,69,114,51,197,254,31,95,208,146,47,95,159,83,161,153,108,80,225,249,23,171,155,253,97,245,110,123,183,89,189,219,28,142,235,143,231,85,122,215,164,144,55,239,254,227,93,151,73,134,255,140,77,251,237,55,207,191,252,46,122,39,228,15,235,227,105,245,252,119,95,255,215,151,171,211,190,253,254,204,120,93,66,141,27,174,125,134,97,195,117,143,45,108,184,238,73,133,13,215,61,156,176,225,186,231,17,54,92,247,8,194,134,3,227,174,43,182,200,135,187,62,170,219,211,245,177,152,62,137,196,112,205,23,6,207,125,59,88,106,235,87,52,86,162,244,40,25,43,85,122,148,140,149,42,61,74,198,74,149,30,37,99,165,74,143,146,177,82,165,71,201,88,72,124,165,142,3,228,141,117,29,236,180,137,144,63,165,90,98,180,211,144,241,218,193,146,229,85,201,88,169,229,156,96,172,228,242,77,48,86,114,185,38,24,43,185,60,19,140,149,92,142,9,198,74,46,191,4,99,33,241,149,44,177,103,141,117,25,172,129,195,21,249,211,251,89,136,209,154,47,196,154,117,131,117,200,7,141,149,184,73,73,50,86,234,62,34,201,88,169,91,125,36,99,165,238,198,145,140,213,33,31,51,86,135,124,204,88,72,124,117,200,151,142,117,25,172,113,225,21,249,211,27,72,136,209,154,47,196,154,117,131,117,200,7,141,149,184,43,72,50,86,234,198,29,201,88,169,123,107,36,99,165,110,127,145,140,213,33,31,51,86,135,124,204,88,72,124,117,200,151,142,117,189,211,115,247,234,138,252,233,29,27,196,104,205,23,98,205,186,193,58,228,131,198,74,220,134,35,25,43,
-117,167,140,100,172,212,205,44,146,177,82,247,155,72,198,234,144,143,25,171,67,62,102,44,36,190,58,228,75,199,186,12,214,152,234,138,252,230,7,222,104,205,23,98,205,186,193,58,228,131,198,106,145,143,25,171,67,62,102,172,14,249,152,177,58,228,99,198,234,144,143,25,171,67,62,102,44,36,190,58,228,75,199,186,12,214,76,239,138,252,230,7,222,104,205,23,98,205,186,193,58,228,131,198,106,145,143,25,171,67,62,102,172,14,249,152,177,58,228,99,198,234,144,143,25,171,67,62,102,44,36,190,58,228,75,199,186,12,54,40,246,179,139,164,163,146,107,92,233,7,141,213,34,31,51,86,135,124,204,88,29,242,49,99,117,200,199,140,213,33,31,51,86,135,124,204,88,72,124,117,200,151,142,117,77,151,79,135,102,176,245,238,125,72,151,79,7,102,186,124,58,12,6,123,179,221,221,92,118,236,86,209,150,93,251,223,235,216,191,251,250,15,205,71,39,59,147,205,239,194,213,124,151,157,186,120,210,205,223,94,236,246,47,118,219,7,134,132,254,27,164,160,39,171,237,171,221,254,176,221,189,90,53,31,239,238,253,59,14,164,175,127,202,22,187,254,105,42,111,253,83,122,98,235,159,184,19,187,124,131,20,148,156,88,248,98,248,200,219,214,253,111,91,44,189,77,185,63,252,33,129,128,183,29,2,46,41,232,203,211,235,205,110,243,112,220,220,220,182,103,136,79,253,140,94,246,243,153,153,206,241,199,237,233,238,117,40,207,95,100,124,245,178,151,176,61,174,78,135,199,205,234,208,77,239,47,95,253,241,143,95,127,185,10,227,175,190,251,234,79,127,254,33,158,202,195,102,247,234,244,250,230,56,159,1,55,191,236,62,112,149,242,117,251,115,176,215,247,63,124,247,213,55,127,10,131,189,217,223,63,62,108,86,235,87,175,14,113,77,233,241,77,152,207,250,244,255,134,80,252,247,105,77,245,247,191,251,161,249,76,108,164,135,187,199,135,245,169,27,105,243,42,252,171,249,64,144,245,251,79,163,139,45,71,3,63,105,156,244,98,251,242,197,230,205,219,211,251,249,221,1,148,164,99,247,239,38,28,20,78,103,213,184,239,245,234,174,241,192,246,62,252,254,97,123,60,101,10,6,79,55,165,201,130,27,71,5,66,69,55,42,73,26,186,177,64,8,216,141,10,154,44,184,113,244,172,43,186,81,73,210,208,141,5,66,192,110,84,208,100,193,141,163,210,141,162,27,149,36,13,221,88,32,4,236,70,5,77,22,220,56,202,198,20,221,168,36,105,232,198,2,33,96,55,42,104,50,167,74,19,187,117,184,49,12,108,195,141,173,36,15,110,28,11,118,228,198,222,141,120,198,74,185,81,73,146,7,55,230,184,209,136,27,123,55,226,25,43,229,70,37,73,30,220,152,227,70,35,110,236,221,136,103,172,148,27,149,36,121,112,99,142,27,141,184,177,121,232,117,130,106,24,216,38,168,182,146,60,130,234,88,176,99,80,237,221,136,15,117,41,55,42,73,242,8,170,57,110,52,10,170,189,27,241,161,46,229,70,37,73,30,65,53,199,141,70,65,181,65,139,206,211,24,6,182,121,26,91,73,30,79,227,88,176,227,211,216,187,17,255,140,164,220,168,36,201,227,105,204,113,163,209,211,248,242,161,13,170,163,211,36,0,227,134,129,231,230,165,36,105,232,198,2,33,12,55,142,5,131,167,43,112,35,254,25,73,185,81,73,146,199,211,152,227,70,163,167,177,17,163,227,198,48,176,141,27,91,73,30,110,28,11,182,118,227,219,195,254,158,220,55,14,31,90,150,23,62,241,120,119,154,152,120,60,124,222,118,42,80,30,181,135,204,19,69,57,118,73,188,198,212,37,238,157,150,118,117,221,171,42,143,170,159,251,186,87,75,159,37,247,78,171,19,186,238,85,149,71,149,128,124,221,171,165,207,146,123,167,121,146,174,123,85,229,81,201,168,175,123,181,244,89,114,239,148,234,117,221,171,42,143,90,79,249,186,87,75,159,89,133,146,251,213,24,115,231,239,90,3,229,249,113,175,108,7,91,223,189,90,92,152,191,155,173,230,94,75,238,149,237,108,235,187,87,139,11,243,119,185,213,220,107,201,189,178,29,111,125,247,106,113,97,254,238,183,154,123,45,185,87,182,19,174,232,222,228,126,56,198,220,249,187,226,64,121,126,193,89,182,67,174,239,94,173,96,153,191,91,174,230,94,203,224,44,219,57,215,119,175,86,176,204,223,69,
-87,115,175,101,112,150,237,168,43,186,55,185,175,142,49,119,254,238,58,80,158,223,211,43,219,105,215,119,175,214,211,148,191,235,174,230,94,203,167,87,182,3,175,232,222,228,62,60,198,220,249,187,241,64,121,212,158,188,158,123,101,59,243,250,238,213,122,154,242,119,233,213,220,107,249,244,202,118,236,21,221,155,220,183,199,152,59,127,247,30,40,207,207,189,178,157,124,144,123,135,255,235,223,16,111,84,57,254,243,225,55,231,31,219,127,71,77,21,214,135,211,205,199,109,67,145,213,69,169,239,255,243,235,99,243,223,237,62,234,124,240,125,251,242,123,251,38,253,97,127,23,254,186,123,21,62,24,134,56,109,194,103,6,125,8,218,129,191,232,71,158,25,248,11,98,228,183,135,77,243,129,183,219,135,205,125,80,57,33,101,187,219,158,102,100,132,95,127,185,123,183,61,236,119,225,43,209,235,250,205,31,182,235,135,237,191,54,171,211,235,205,106,115,253,204,234,229,254,176,250,203,239,190,30,52,60,120,119,215,12,30,167,177,205,216,205,47,175,227,253,105,115,106,7,122,243,248,112,218,134,38,237,205,204,26,199,156,214,15,251,87,171,187,253,238,180,249,233,244,233,234,231,223,108,54,247,205,60,130,136,187,253,161,153,217,233,58,159,213,253,230,237,102,119,191,217,221,109,55,199,159,223,108,91,15,125,250,248,54,120,246,201,234,248,122,255,248,112,191,186,109,160,240,178,209,169,253,219,237,118,119,223,204,60,140,127,247,216,140,214,140,177,249,105,115,247,120,106,132,127,28,244,127,220,29,215,47,27,200,244,211,56,29,214,205,47,238,194,159,111,62,142,167,18,253,33,118,71,240,220,106,189,91,173,31,79,251,240,219,237,41,30,98,208,218,191,253,235,112,208,238,119,215,225,126,56,108,95,189,106,52,15,102,234,71,219,191,221,28,214,97,172,214,34,235,96,246,213,237,195,254,238,31,241,216,235,219,253,97,52,116,251,171,249,145,219,63,45,15,124,25,121,243,110,253,112,115,247,230,190,109,191,48,131,252,179,103,162,7,178,67,98,219,170,162,51,117,243,239,85,192,105,247,64,93,189,25,69,133,88,204,147,213,254,241,244,246,241,212,6,0,176,200,213,77,248,204,254,109,152,247,250,225,253,234,184,9,63,182,226,86,141,37,130,117,250,159,26,69,54,235,55,31,15,31,160,187,135,199,251,205,205,203,221,250,205,38,97,144,254,51,164,110,131,167,244,44,250,101,243,193,88,96,176,202,239,30,94,109,110,15,235,200,56,141,242,111,154,135,242,106,158,139,252,239,126,199,53,206,175,14,155,135,117,103,140,213,186,147,244,171,129,131,46,186,52,161,181,137,156,155,195,77,19,26,59,69,46,102,120,210,252,241,225,197,241,244,230,212,253,116,220,190,234,172,19,71,131,72,183,47,166,202,133,217,71,170,68,254,106,135,126,211,48,65,208,255,172,196,170,121,48,214,199,213,155,230,163,47,31,119,237,163,246,100,213,40,246,105,171,211,77,163,192,110,125,122,60,108,62,142,59,137,188,124,120,60,190,126,209,4,155,155,213,184,105,126,227,184,203,95,175,202,181,191,106,85,11,17,106,183,255,113,240,200,29,143,155,230,153,235,250,161,188,57,190,186,226,97,240,20,182,159,138,99,224,46,60,117,193,27,141,51,238,54,45,16,87,63,190,222,236,86,183,79,159,134,166,40,209,67,113,17,17,174,161,34,68,124,181,203,148,242,209,211,95,207,137,8,55,24,17,34,190,222,189,226,136,184,178,219,230,244,124,125,216,174,111,31,54,55,13,33,180,179,89,189,91,31,174,240,105,27,216,116,61,100,86,67,212,68,223,141,130,110,79,36,237,215,2,201,55,112,238,136,50,12,219,126,56,150,255,138,144,191,26,183,175,121,53,39,244,79,121,66,71,116,210,0,39,60,212,55,225,255,165,162,70,163,211,139,254,115,87,113,95,238,194,136,159,221,111,143,225,191,171,227,250,93,32,250,160,192,48,158,53,100,115,55,108,106,180,107,104,244,69,171,229,205,234,120,181,241,113,243,207,199,134,55,207,51,142,75,26,65,129,235,183,174,58,244,237,121,130,208,240,231,235,212,91,53,250,241,6,237,201,219,213,211,167,83,13,186,93,142,211,225,239,99,61,86,215,44,125,160,78,243,91,140,74,141,47,249,198,184,124,105,86,240,121,29,145,148,61,194,64,51,108,187,112,76,41,240,164,91,255,5,45,102,116,233,191,253,162,
-249,70,172,77,251,203,129,228,110,161,219,41,213,254,117,192,36,97,69,29,214,66,219,251,159,174,15,193,241,238,245,230,205,186,211,225,20,112,214,253,179,249,216,230,167,238,159,235,187,176,198,108,59,194,117,158,106,159,148,145,175,154,207,191,104,198,13,62,251,241,176,126,251,155,232,162,134,203,95,180,133,70,119,3,133,21,95,48,204,175,58,73,159,182,66,62,109,199,255,213,170,201,31,58,67,117,66,86,255,104,126,255,31,63,255,217,175,87,159,52,232,61,110,58,141,126,254,179,207,155,159,183,187,16,245,142,63,255,217,23,205,15,221,26,243,8,182,233,205,227,246,62,74,127,30,27,239,197,51,254,216,204,206,69,138,124,144,182,127,210,60,159,205,99,181,59,116,63,236,14,47,194,207,126,80,135,232,243,255,59,79,212,242,128,168,233,232,233,49,210,20,119,251,135,199,55,187,177,45,86,4,30,167,166,87,20,68,218,175,27,186,50,3,242,33,3,52,170,76,248,135,104,232,133,167,214,12,196,133,58,176,204,30,70,222,118,137,216,7,224,0,199,135,64,65,47,203,231,227,92,209,184,223,60,156,214,55,97,142,87,5,255,175,38,199,26,78,96,53,156,65,248,64,51,112,252,139,213,199,63,255,217,207,6,191,184,204,241,143,95,126,253,195,239,154,191,76,122,210,118,211,9,41,95,55,155,86,151,95,29,87,235,183,111,31,182,155,251,79,7,237,104,15,251,255,179,185,59,245,234,30,55,15,205,15,177,130,128,9,172,22,212,239,197,23,77,225,248,120,59,182,118,175,123,243,215,129,174,41,213,187,159,47,138,135,31,47,106,135,31,134,58,55,242,38,250,94,170,118,65,227,38,239,236,12,185,233,113,240,41,0,25,139,102,108,254,242,69,85,48,200,113,250,23,21,120,125,209,203,95,148,184,185,159,228,68,189,193,15,7,66,147,38,32,61,108,94,158,38,79,201,215,161,37,244,241,180,121,219,85,187,194,103,66,113,124,115,88,253,159,253,118,215,64,121,115,150,223,70,187,237,110,215,255,105,117,243,240,228,240,241,106,255,174,223,111,104,191,185,221,181,85,245,237,253,102,117,211,104,251,241,47,174,179,8,245,182,110,59,232,230,174,113,193,238,212,24,179,77,123,102,234,50,253,7,39,70,11,114,154,248,184,110,67,232,121,115,169,17,214,12,246,114,219,232,209,237,113,116,195,15,118,119,27,183,111,6,60,114,45,210,156,174,255,188,187,254,51,60,193,161,177,250,160,78,25,180,235,70,26,145,193,239,218,95,134,253,186,110,79,167,197,94,59,240,167,237,152,171,155,183,251,227,113,123,251,240,254,82,216,111,63,125,216,188,125,88,223,109,122,203,6,26,56,195,33,250,242,167,171,110,246,199,107,17,104,247,248,230,182,159,238,254,112,223,252,235,178,99,182,25,76,187,99,19,198,180,15,219,251,118,222,79,194,87,231,13,208,141,57,50,192,127,181,191,188,150,78,143,231,138,217,212,22,188,233,204,237,222,221,61,108,214,135,23,45,131,222,204,205,104,116,150,43,40,29,125,101,164,249,31,194,95,90,85,79,93,13,182,213,177,211,55,54,101,3,215,155,213,162,33,63,142,66,254,96,79,113,123,63,243,244,247,134,105,131,83,111,182,109,131,137,199,183,141,14,87,68,31,67,237,126,127,183,93,135,200,112,249,236,172,166,249,138,102,44,86,179,38,113,81,229,24,132,246,51,250,116,198,97,77,72,219,208,48,188,157,199,91,247,229,145,215,254,216,254,178,49,227,97,255,227,234,229,97,255,166,249,103,183,0,203,71,87,255,172,76,235,184,143,15,167,239,55,167,155,211,237,67,191,162,60,157,14,189,182,111,123,93,31,54,187,243,130,116,221,44,66,219,127,110,238,30,214,231,133,103,96,134,238,94,134,96,212,193,124,194,55,26,44,182,143,201,104,86,127,109,226,193,250,176,57,207,165,215,37,108,143,180,218,183,207,83,27,219,194,148,119,167,79,154,89,208,83,136,170,242,237,68,162,159,195,116,162,31,195,164,162,195,176,237,204,174,63,7,255,182,177,225,211,79,63,157,155,87,227,137,23,157,228,242,89,25,79,234,188,190,248,123,98,106,93,220,40,156,220,54,60,7,47,215,225,175,127,248,254,121,248,235,155,245,105,102,162,155,159,222,238,155,167,179,11,111,209,238,235,203,243,198,107,80,121,243,246,188,37,123,119,249,247,63,27,218,238,254,181,123,124,120,56,156,127,109,137,
-129,94,247,0,5,182,153,254,240,237,95,255,123,245,213,55,63,124,219,111,202,55,166,249,224,44,67,1,41,158,1,196,66,171,121,27,125,123,62,245,113,51,222,3,143,180,184,28,13,25,105,242,101,251,231,179,2,97,105,218,38,184,159,69,39,94,86,77,104,61,108,67,154,186,154,224,119,253,242,101,187,144,253,110,255,227,241,26,242,27,178,153,94,6,218,174,167,250,143,7,208,28,71,154,116,138,118,251,128,93,16,15,107,212,254,11,33,244,31,87,183,239,7,187,117,65,175,247,115,75,134,253,219,247,47,2,79,220,172,78,225,174,148,39,171,159,255,236,10,149,203,191,142,151,127,237,142,147,227,15,221,20,158,52,58,188,108,188,210,253,59,156,164,217,220,119,83,188,221,28,79,221,191,94,254,248,178,91,135,220,12,17,49,152,248,246,77,18,11,95,181,127,186,64,161,229,183,219,206,231,171,227,117,25,240,243,159,189,218,190,219,236,250,69,67,155,201,108,90,159,238,155,117,195,77,243,239,207,194,204,194,10,234,103,19,39,117,235,225,48,137,22,170,75,138,246,43,222,176,237,59,210,243,135,215,219,99,184,230,37,172,89,239,246,143,187,211,225,253,71,231,67,119,151,115,1,109,150,115,243,83,155,191,125,17,213,194,190,248,251,184,119,79,251,201,169,239,58,67,253,208,62,245,137,165,195,197,75,141,242,171,143,151,38,115,187,221,113,45,127,62,179,211,216,180,149,51,56,110,242,175,205,97,255,98,127,120,177,223,109,70,137,248,231,127,159,92,0,20,125,248,42,114,251,50,124,175,61,26,183,110,114,128,230,9,110,158,177,144,40,236,206,199,16,46,187,210,219,227,167,171,175,118,119,33,249,105,30,132,55,251,38,92,28,214,219,227,232,120,70,123,195,78,255,157,221,182,189,43,109,187,123,216,54,195,157,79,209,180,103,230,154,172,116,160,252,109,172,250,147,213,171,183,113,118,249,234,28,11,187,31,187,27,140,206,189,122,174,95,107,144,118,243,234,201,230,201,235,230,215,79,87,175,14,251,199,183,159,182,255,255,230,213,219,143,155,63,190,9,191,14,39,56,63,13,151,50,189,14,191,186,251,117,248,93,19,77,239,62,221,30,195,69,74,111,186,223,126,126,249,245,110,127,186,185,251,117,251,219,235,47,159,221,188,121,242,121,27,82,218,223,95,255,208,56,165,249,244,231,79,238,62,15,127,9,19,237,79,191,52,31,122,178,250,197,23,159,255,250,215,191,254,40,154,248,127,52,95,59,220,111,119,205,242,251,244,126,245,110,187,239,142,39,117,43,187,38,51,104,98,208,161,63,1,210,252,179,141,60,191,8,35,247,6,142,70,10,42,220,254,230,231,33,17,156,218,55,130,204,250,225,129,134,74,56,143,243,240,96,139,146,89,152,180,218,254,15,54,114,177,177,138,193,209,216,110,4,138,230,55,17,18,26,237,95,60,238,182,255,124,188,62,126,231,250,205,54,90,57,92,63,182,186,2,162,225,228,187,127,172,182,47,251,44,108,251,176,58,54,145,171,81,32,4,227,219,213,253,126,115,220,253,234,180,122,189,126,183,89,245,95,110,63,213,95,35,182,138,212,56,151,36,14,199,155,115,236,108,151,60,179,255,252,56,62,64,245,215,237,219,205,31,186,179,189,241,29,119,231,241,250,90,193,113,120,102,245,42,174,171,26,196,101,154,195,171,239,54,119,77,150,118,243,241,224,66,187,240,52,156,255,20,29,214,10,176,63,237,27,61,94,159,79,211,54,246,13,39,168,162,115,58,211,161,215,231,5,44,74,196,149,235,254,249,240,226,124,76,172,153,244,213,104,215,147,110,241,39,102,207,29,117,196,211,114,252,248,228,217,96,211,230,254,241,205,219,23,119,235,6,6,141,211,218,101,79,228,174,150,140,163,215,68,47,242,175,223,186,10,15,191,235,107,53,187,83,248,77,95,186,105,7,93,181,31,158,8,110,124,248,34,28,79,11,136,57,108,126,60,108,79,155,108,241,151,239,206,168,112,193,198,170,31,181,61,4,183,61,158,182,119,211,217,183,167,226,26,5,126,254,179,77,179,12,138,4,62,105,30,251,135,127,68,10,253,252,103,111,239,6,63,158,94,55,139,169,251,193,55,26,17,255,56,70,175,147,53,79,241,241,248,151,223,15,126,243,238,205,232,23,97,148,225,151,90,173,135,191,122,179,221,189,124,56,13,127,181,254,63,227,95,237,222,221,29,127,28,252,166,61,107,59,243,224,
-93,39,63,99,193,246,247,9,171,173,195,105,232,127,109,110,26,133,154,24,219,23,48,214,111,154,213,99,27,45,135,153,66,128,106,255,133,223,100,142,208,238,207,205,28,46,45,25,170,75,211,148,198,236,118,35,22,7,159,173,113,94,106,208,87,59,119,15,238,240,125,143,253,97,253,170,3,104,191,111,57,128,96,187,125,25,255,166,223,197,28,124,232,253,219,225,103,222,236,239,135,191,104,50,144,150,148,70,35,93,30,192,30,75,77,82,240,230,199,237,253,233,245,240,41,105,37,30,219,115,230,209,135,95,111,214,111,135,191,88,31,95,143,64,253,54,252,174,111,42,181,109,7,107,150,213,135,102,220,225,199,58,82,26,124,238,176,121,55,243,219,127,108,222,15,126,110,75,117,219,251,159,162,215,101,7,238,233,173,59,137,161,235,65,4,237,62,180,106,30,192,182,220,18,162,233,156,139,46,89,197,255,248,170,42,95,117,251,57,237,129,135,240,250,215,161,47,69,44,251,48,46,201,255,143,59,171,118,103,50,102,18,27,85,255,227,215,186,253,218,25,97,240,94,92,179,82,58,109,58,13,194,89,199,155,51,21,159,153,248,76,196,3,141,198,223,138,95,91,108,168,119,119,218,158,25,185,219,217,105,63,20,222,179,90,207,168,112,127,216,191,229,42,48,252,78,180,255,212,252,158,146,123,78,175,186,252,181,221,210,59,189,191,233,235,96,237,237,223,195,119,202,250,79,140,183,217,142,205,160,125,2,23,54,187,250,143,133,205,193,193,33,129,198,167,67,65,183,113,169,45,62,18,176,138,207,4,44,10,14,19,156,23,125,252,116,244,70,200,130,236,102,217,213,78,246,227,240,154,215,241,54,126,17,184,253,195,213,226,127,45,85,232,231,131,122,239,97,19,142,45,52,41,74,35,120,255,227,249,236,70,251,20,173,94,62,220,111,227,245,255,42,188,22,21,85,251,183,187,183,115,75,239,80,130,239,135,253,205,172,176,110,167,249,102,246,27,221,223,226,135,34,24,45,60,244,55,171,119,161,53,231,170,219,185,94,157,191,251,151,255,245,229,127,135,63,255,102,53,113,115,247,173,168,171,231,224,45,155,193,8,205,111,219,65,230,197,30,95,159,164,98,67,67,51,169,216,118,175,89,38,54,248,75,42,182,125,251,70,38,182,149,36,20,219,193,95,36,118,112,130,236,195,152,109,147,217,74,197,134,86,16,82,177,247,183,15,82,177,161,69,129,84,108,19,228,164,98,187,194,40,87,240,97,31,222,11,124,241,211,254,240,162,29,237,117,151,219,238,26,150,63,159,62,232,70,158,209,106,244,221,223,76,244,155,14,30,5,205,72,196,237,168,122,125,125,50,7,19,120,124,248,199,139,137,204,235,193,187,127,62,124,122,191,9,71,7,30,119,247,125,12,108,79,178,117,161,48,252,231,18,71,155,31,94,92,62,59,218,181,105,127,23,246,229,162,119,55,223,133,243,85,187,38,222,110,142,167,99,215,141,32,236,146,237,95,174,14,191,24,76,123,170,196,165,81,114,164,202,37,204,14,20,10,239,119,224,148,26,216,101,104,147,126,139,177,55,126,171,214,232,150,132,160,14,173,70,163,236,54,188,79,253,238,230,254,201,241,227,246,8,218,234,126,251,170,113,235,234,118,243,250,124,164,249,126,127,90,221,108,27,165,86,191,93,253,58,108,108,190,12,155,8,253,95,62,158,154,111,206,116,9,141,207,31,152,152,209,76,247,225,186,236,184,185,219,135,119,117,118,205,243,21,186,19,52,25,230,249,25,106,13,191,249,71,63,143,127,68,148,53,6,229,23,163,81,162,42,125,56,93,25,48,116,86,190,209,58,188,82,60,248,248,47,150,30,137,134,100,131,249,122,154,14,255,185,46,80,95,159,44,31,137,182,127,233,85,149,235,18,96,160,144,197,35,209,218,100,30,96,113,119,235,160,78,29,143,68,103,186,133,71,34,124,96,98,198,250,30,137,214,240,203,143,68,15,74,226,145,8,24,18,63,18,189,249,122,225,131,67,54,205,15,150,143,68,151,58,92,84,185,146,224,64,33,139,71,162,181,201,60,192,226,19,55,65,157,58,30,137,206,116,11,143,68,248,192,196,140,245,61,18,221,209,207,197,71,162,7,37,241,72,108,119,5,143,68,187,2,60,196,11,254,139,244,230,7,203,71,162,91,41,94,84,185,46,108,7,10,89,60,18,173,77,230,1,22,123,39,168,83,199,35,209,153,110,225,145,24,52,208,56,155,177,
-190,71,162,53,252,242,35,209,131,146,120,36,2,134,196,143,68,147,74,6,243,245,201,104,248,207,69,122,243,131,6,250,146,207,68,219,224,240,170,203,53,211,29,104,100,241,76,244,70,233,48,21,183,204,12,10,208,130,95,62,236,215,167,182,23,221,62,56,245,93,57,150,102,31,132,179,189,34,232,135,95,77,172,229,161,112,208,246,205,241,197,233,240,184,187,139,44,26,222,100,154,90,180,253,212,72,193,246,119,231,178,181,142,126,3,4,222,223,62,4,5,251,234,72,248,207,245,32,193,237,131,233,115,208,118,130,188,234,114,45,189,12,52,178,120,14,122,163,116,0,139,155,79,6,5,170,121,14,206,246,138,158,131,240,171,137,181,106,120,14,122,139,118,207,193,216,162,78,207,193,250,225,237,235,245,77,131,165,78,187,230,99,167,117,248,231,72,195,208,162,241,120,122,209,126,250,69,243,175,193,113,224,135,182,3,87,183,207,21,78,159,31,79,135,253,110,255,230,253,170,253,248,229,172,228,127,132,19,128,141,220,110,143,226,176,190,223,62,30,59,129,253,235,70,97,114,125,3,192,70,161,135,237,110,125,110,29,57,130,192,85,233,8,3,177,234,83,28,52,19,8,48,152,153,64,120,13,125,155,61,137,69,109,34,19,198,77,114,103,181,185,154,115,240,82,185,92,155,118,201,209,60,6,1,105,225,164,206,147,30,27,151,204,43,46,21,134,254,178,95,236,30,223,188,8,245,177,225,138,162,129,213,237,169,59,43,223,29,160,108,223,10,123,183,57,52,0,252,49,90,159,45,201,139,94,250,154,23,29,130,215,172,232,230,15,55,237,179,76,202,63,151,99,123,21,162,227,181,163,121,207,212,37,215,39,128,1,114,20,24,27,34,173,75,129,69,102,93,210,158,6,88,64,64,243,119,36,2,70,226,150,0,208,74,86,2,64,183,51,153,3,0,192,252,115,20,200,2,64,169,69,70,105,199,235,83,42,6,12,106,163,151,71,32,20,4,39,82,195,71,243,16,144,144,55,154,249,84,116,152,240,172,232,48,225,230,15,12,8,244,42,44,199,128,97,33,54,142,1,114,3,228,40,48,7,129,121,93,10,44,50,235,146,153,24,48,172,142,159,159,1,12,2,150,99,192,84,178,18,0,146,49,96,98,116,192,252,115,20,200,2,64,169,69,70,103,105,118,201,24,48,40,6,95,30,129,237,110,70,106,248,104,30,2,18,242,70,51,159,138,14,19,158,21,29,38,220,46,148,179,61,208,171,176,28,3,134,149,231,56,6,200,13,144,163,192,28,4,230,117,41,176,200,172,75,102,98,192,192,13,151,103,0,131,128,229,24,48,149,172,4,128,100,12,152,24,29,48,255,28,5,178,0,80,106,145,161,71,30,118,175,82,49,96,80,253,190,60,2,15,113,95,235,179,212,246,120,68,22,2,18,242,70,51,159,138,14,19,158,21,29,38,220,190,17,157,237,129,94,133,229,24,48,44,181,199,49,64,110,128,28,5,230,32,48,175,75,129,69,102,93,50,19,3,6,110,184,60,3,24,4,44,199,128,169,100,37,0,36,99,192,196,232,128,249,231,40,144,5,128,82,139,12,61,114,218,190,9,29,178,223,188,61,63,153,65,240,229,151,163,7,241,197,229,15,241,173,50,157,224,203,159,198,62,159,72,24,155,60,37,45,252,126,78,226,221,88,98,198,92,207,214,31,40,51,61,27,120,249,243,204,51,199,157,252,178,200,89,220,45,137,71,90,99,170,87,223,98,126,198,21,45,220,202,29,63,19,97,82,194,0,51,205,214,227,201,234,245,250,248,226,244,47,158,78,167,127,129,181,186,252,144,97,163,203,175,40,75,93,190,10,123,86,66,188,162,192,42,194,203,178,72,206,179,130,70,80,190,102,99,40,49,181,44,196,84,90,207,171,10,28,59,170,163,172,213,246,126,253,62,124,39,230,158,254,87,99,230,233,127,61,133,83,255,135,241,227,53,26,121,60,245,121,41,237,76,39,146,238,134,146,24,79,80,164,196,148,107,250,63,206,49,13,99,178,75,162,102,253,157,22,139,154,253,88,159,158,91,38,38,239,34,69,129,99,103,56,101,94,72,225,204,50,229,143,3,0,173,203,220,51,47,214,166,255,39,105,145,254,23,139,86,57,127,9,130,250,1,107,204,194,143,141,132,37,81,249,168,71,98,35,87,163,89,150,200,211,174,8,45,41,253,206,162,243,173,6,199,207,229,197,140,174,255,88,75,53,55,87,228,14,246,68,251,
-143,76,164,158,239,156,234,250,4,30,47,189,204,174,208,153,21,211,49,101,188,206,154,147,54,195,125,41,121,241,226,102,252,164,158,70,60,119,154,33,185,217,237,157,230,183,179,158,60,37,153,229,148,160,149,133,225,231,181,189,196,238,211,76,224,150,42,59,10,8,167,68,52,200,24,190,171,172,159,14,93,252,235,94,51,9,42,199,94,108,59,237,126,241,34,244,169,25,131,244,212,34,180,249,203,116,127,228,159,15,183,15,251,219,200,4,253,111,198,86,232,127,61,179,57,208,253,97,110,39,224,58,246,212,28,253,31,231,44,194,16,21,219,229,172,248,140,105,250,63,205,90,231,252,181,171,129,6,47,80,181,131,199,221,90,239,63,239,43,24,159,143,195,220,229,93,170,201,86,211,88,157,102,154,65,246,204,12,79,135,237,82,145,101,242,22,45,83,189,65,103,174,185,141,161,224,162,209,81,145,2,109,135,110,122,188,237,190,112,211,181,75,236,91,35,182,109,189,7,205,149,126,248,238,242,209,31,214,219,135,223,228,14,211,183,18,90,28,112,172,212,155,253,238,244,58,58,152,218,47,118,166,7,82,7,173,40,7,95,154,195,84,227,240,246,12,234,240,147,217,150,26,31,151,77,106,53,120,153,98,248,173,37,181,70,31,205,225,172,121,99,37,94,123,74,27,107,230,109,39,158,161,134,15,231,212,80,25,47,98,209,47,96,97,141,148,120,17,38,219,72,97,251,21,107,164,156,87,115,200,87,114,176,70,74,188,26,145,109,164,240,121,172,145,50,94,214,160,95,210,192,26,41,113,88,62,219,72,161,128,143,53,82,198,241,125,250,216,126,137,145,218,102,13,55,23,226,157,189,243,167,107,160,49,232,213,209,126,45,125,137,104,251,231,65,175,153,215,13,123,252,227,102,210,103,108,64,235,237,103,226,155,140,119,199,253,195,246,218,8,44,244,161,15,231,24,187,14,41,237,101,24,161,235,99,223,5,102,245,216,222,220,222,141,210,252,107,120,213,242,227,113,179,44,189,253,136,92,120,248,250,182,125,133,34,52,203,191,95,29,31,246,195,187,226,223,173,239,30,31,223,44,235,208,125,38,82,226,245,126,223,245,18,93,191,125,123,216,175,187,107,234,239,18,170,29,199,13,88,186,183,202,23,37,94,62,54,106,183,18,126,21,58,173,108,239,54,199,75,79,236,190,3,242,185,143,208,245,202,148,77,123,137,247,96,224,254,151,209,199,54,111,183,15,251,87,143,163,207,157,127,155,193,225,151,194,5,143,199,201,204,147,243,236,164,138,42,215,247,159,102,18,210,177,70,95,36,116,26,171,209,234,38,175,167,197,155,5,9,205,162,234,109,170,182,17,215,109,217,218,12,170,204,1,176,87,85,166,153,116,159,128,165,42,200,231,52,108,205,47,31,119,77,136,250,85,224,227,185,93,110,156,170,54,107,220,246,67,195,131,147,209,221,27,221,50,57,92,17,18,30,199,174,7,209,109,119,167,192,244,244,70,39,45,170,235,60,198,45,122,135,167,54,67,27,30,128,240,244,60,7,199,229,46,162,6,135,195,116,230,57,60,153,22,207,179,64,120,122,158,131,35,65,23,81,131,3,48,58,243,28,158,190,137,231,89,32,252,156,157,54,156,114,236,102,58,73,132,155,180,172,251,251,172,140,254,111,115,19,186,14,123,237,186,52,155,192,118,115,201,148,50,188,7,169,235,248,30,26,243,14,175,102,255,254,191,191,31,124,32,190,148,97,127,183,185,127,12,175,152,28,182,175,94,109,14,13,139,238,207,195,93,46,5,127,127,252,244,197,249,30,156,113,67,187,126,224,110,13,179,36,186,255,132,64,118,255,205,171,236,243,255,38,71,217,251,183,213,102,15,109,140,218,137,132,183,215,118,143,111,18,7,183,251,219,24,186,51,27,225,245,204,220,51,220,241,169,242,193,203,126,73,157,166,13,67,214,39,37,229,34,205,218,151,93,114,236,20,222,110,178,177,83,247,34,16,203,78,74,202,93,206,4,19,120,138,123,113,196,46,155,30,2,158,170,146,121,30,56,62,161,156,143,167,65,183,141,17,158,128,202,69,154,45,226,41,182,83,236,50,93,59,101,224,105,108,39,37,229,46,231,75,9,60,197,57,113,236,178,233,129,210,169,42,153,103,75,227,211,174,249,120,26,180,170,24,225,9,168,92,164,217,34,158,98,59,197,46,211,181,83,6,158,198,118,82,82,238,114,86,145,192,83,156,161,197,46,155,30,78,156,170,146,121,
-78,49,62,57,153,143,167,65,159,135,17,158,128,202,69,154,45,226,41,182,83,236,50,93,59,101,224,105,108,39,37,229,98,38,62,109,242,214,5,161,51,152,205,186,160,111,183,198,89,23,40,41,119,209,236,188,81,245,46,209,167,46,116,254,152,17,60,16,199,126,79,115,32,180,49,200,23,189,49,190,72,120,39,40,49,111,128,177,30,5,62,138,148,58,59,98,201,41,72,195,16,106,204,89,104,73,45,21,83,69,88,238,122,186,101,60,89,161,193,152,205,147,213,119,109,227,60,89,74,202,205,56,178,93,91,77,12,67,0,168,253,82,193,147,213,57,105,233,201,58,43,177,12,151,179,30,184,39,43,248,106,201,41,72,195,16,106,228,62,89,170,166,138,176,220,157,33,200,120,178,66,159,50,155,39,171,111,254,198,121,178,148,148,155,113,228,188,97,8,0,181,95,42,120,178,58,39,45,61,89,103,37,150,225,114,214,3,247,100,181,55,56,45,56,5,105,24,66,141,220,39,75,213,84,17,150,187,29,150,140,39,43,180,59,179,121,178,250,30,114,156,39,75,73,185,25,71,118,55,192,142,13,67,0,168,253,82,193,147,213,57,105,233,201,58,43,177,12,151,179,30,184,39,171,189,129,99,193,41,72,195,16,106,228,62,89,170,166,138,43,84,75,121,86,92,47,139,83,25,221,122,89,70,158,53,174,151,41,41,119,209,108,156,103,141,13,211,2,104,42,120,188,104,231,245,194,160,242,172,57,37,230,13,144,74,30,4,62,90,200,179,230,156,130,52,12,161,70,234,201,74,169,165,98,170,8,203,139,121,214,184,123,182,205,147,149,145,103,141,173,165,164,220,140,35,187,60,107,108,24,2,64,231,69,187,244,201,154,207,179,230,148,88,134,203,56,121,40,127,178,226,60,107,206,41,72,195,16,106,228,62,89,170,166,138,176,188,152,103,197,190,139,83,25,221,39,43,35,207,26,91,75,73,185,25,71,206,27,134,0,208,121,209,46,125,178,230,243,172,57,37,150,225,50,78,30,202,159,172,56,207,154,115,10,210,48,132,26,185,79,150,170,169,34,44,47,230,89,177,239,226,84,70,247,201,202,200,179,198,214,82,82,110,198,145,93,158,53,54,12,1,160,243,162,93,250,100,205,231,89,115,74,44,195,101,156,60,148,63,89,113,158,53,231,20,164,97,8,53,114,159,44,85,83,197,59,183,75,121,86,188,143,28,167,50,186,251,200,25,121,214,120,31,89,73,185,139,102,227,60,107,108,152,22,64,83,193,227,69,59,175,223,24,149,103,205,41,49,111,128,84,242,32,240,209,66,158,53,231,20,164,97,8,53,82,79,86,74,45,21,83,69,88,94,204,179,98,223,197,169,140,238,147,149,145,103,141,173,165,164,220,140,35,187,60,107,108,24,2,64,231,69,187,244,201,154,207,179,230,148,88,134,203,56,121,40,127,178,226,60,107,206,41,72,195,16,106,228,62,89,170,166,138,176,188,152,103,141,47,59,178,121,178,50,242,172,177,181,148,148,155,113,228,188,97,8,0,157,23,237,210,39,107,62,207,154,83,98,25,46,227,228,161,252,201,138,243,172,57,167,32,13,67,168,145,251,100,253,127,237,93,223,143,211,56,16,126,62,254,138,28,188,116,79,133,99,203,219,34,14,33,14,157,144,16,119,39,120,61,173,210,196,237,230,72,147,146,164,1,254,251,243,143,216,153,216,19,219,77,227,93,237,117,23,137,166,201,216,243,249,155,25,143,39,77,235,160,84,1,95,182,214,89,208,118,176,148,9,27,89,30,117,150,206,86,32,112,136,33,69,157,165,19,227,112,32,185,104,159,26,89,120,157,133,129,176,187,139,94,60,156,30,89,176,206,194,140,50,39,49,14,24,190,145,21,148,42,248,68,163,173,206,210,119,20,189,157,231,43,61,234,44,253,249,202,64,224,20,50,189,206,194,182,90,69,20,235,139,246,227,126,211,213,85,103,97,32,112,2,198,138,135,9,54,178,212,89,152,81,230,36,198,1,99,44,178,198,96,5,161,10,248,178,181,206,210,55,38,189,157,200,242,168,179,116,182,2,129,67,12,41,234,44,108,199,86,139,153,228,162,125,106,100,225,117,22,6,194,238,46,122,241,112,122,100,193,58,11,51,202,156,196,56,96,248,70,86,80,170,128,47,91,235,44,125,127,211,219,137,44,143,58,75,103,43,16,56,196,144,56,49,14,7,146,139,246,169,145,133,215,89,24,8,187,187,232,197,195,233,145,5,235,44,204,
-40,115,18,227,128,225,27,89,65,169,2,190,108,173,179,244,109,82,111,39,178,60,234,44,157,173,64,224,16,67,138,58,11,219,63,214,98,38,185,104,159,26,89,120,157,133,129,176,187,139,94,60,156,30,89,176,206,194,140,50,39,49,14,24,190,145,21,148,42,14,112,147,59,63,207,130,187,179,194,82,134,157,119,57,47,149,57,198,106,29,26,207,58,107,176,185,173,86,103,205,8,78,33,211,235,44,157,24,238,64,166,98,125,209,206,182,51,246,139,44,67,41,226,55,24,8,156,128,177,226,97,130,141,44,117,22,102,148,57,137,113,192,24,139,172,49,88,65,168,2,190,108,173,179,160,237,96,41,19,54,178,60,234,44,157,173,64,224,16,67,138,58,75,39,198,225,64,114,209,62,53,178,240,58,11,3,97,119,23,189,120,56,61,178,96,157,133,25,101,78,98,28,48,124,35,43,40,85,192,151,173,117,22,180,29,44,101,194,70,150,71,157,165,179,21,8,28,98,72,156,24,135,3,201,69,251,212,200,194,235,44,12,132,221,93,244,226,225,244,200,130,117,22,102,148,57,137,113,192,240,141,172,160,84,1,95,182,214,89,208,118,176,148,9,27,89,30,117,150,206,86,32,112,136,33,69,157,165,19,227,112,32,185,104,159,26,89,120,157,133,129,176,187,139,94,60,156,30,89,176,206,194,140,50,39,49,14,24,190,145,21,148,42,241,99,142,235,220,85,103,81,17,180,206,98,231,93,206,203,183,184,63,98,191,14,129,198,179,206,26,108,83,175,213,89,51,130,83,200,244,58,75,39,134,59,144,169,216,88,180,175,115,223,45,85,116,165,136,223,96,32,112,2,198,138,135,9,54,178,212,89,152,81,230,36,198,1,99,44,178,198,96,5,161,10,248,178,181,206,130,182,131,165,76,216,200,242,168,179,116,182,2,129,67,12,41,234,44,157,24,135,3,169,69,251,196,200,194,235,44,12,132,221,93,244,226,225,244,200,130,117,22,102,148,57,137,113,192,240,141,172,160,84,1,95,182,214,89,208,118,176,148,9,27,89,30,117,150,206,86,32,112,136,33,113,98,28,14,164,22,237,19,35,11,175,179,48,16,118,119,209,139,135,211,35,11,214,89,152,81,230,36,198,1,195,55,178,130,82,5,124,217,90,103,65,219,193,82,38,108,100,121,212,89,58,91,129,192,33,134,20,117,150,78,140,195,129,212,162,125,98,100,225,117,22,6,194,238,46,122,241,112,122,100,193,58,11,51,202,156,196,56,96,248,70,86,16,170,228,223,174,76,15,57,97,123,90,192,221,42,190,230,207,210,108,179,89,172,197,190,24,12,89,214,12,246,77,160,87,205,237,47,170,3,137,178,13,219,228,45,250,249,21,219,23,161,101,59,97,104,251,78,129,206,193,118,82,234,71,64,50,80,100,158,160,72,105,217,179,46,151,81,208,145,236,123,236,76,83,128,97,13,198,69,207,93,139,41,66,26,104,25,117,195,44,209,31,131,255,251,67,223,4,221,180,164,187,76,170,167,36,141,182,85,121,216,215,200,88,7,122,7,91,129,237,249,209,138,233,103,7,47,240,159,134,63,25,7,7,17,23,95,252,135,29,195,13,85,160,34,122,193,58,84,161,101,226,32,143,214,202,61,137,20,53,185,62,106,120,125,19,84,29,191,156,255,112,14,118,160,121,218,144,167,34,145,83,101,188,221,86,207,200,247,172,110,32,132,21,133,112,211,5,46,163,160,87,249,230,195,31,92,218,163,139,11,61,226,101,67,201,2,104,40,246,1,90,225,77,174,219,56,7,51,231,230,80,36,124,71,28,222,62,41,219,184,90,144,75,88,236,147,21,184,3,193,166,245,151,143,126,34,207,193,230,16,87,175,84,142,248,133,182,93,146,213,5,21,169,159,51,89,118,145,247,28,183,219,5,121,206,46,60,137,178,109,81,86,36,122,188,59,52,135,56,127,28,125,124,255,161,190,162,157,94,22,17,151,207,183,100,93,197,207,40,215,36,105,88,143,17,253,43,178,156,223,158,145,175,155,56,175,7,255,179,190,201,229,170,192,187,160,157,47,189,186,160,41,174,195,45,7,197,161,179,30,86,5,23,88,161,2,171,94,224,133,20,232,56,169,47,151,53,231,164,29,92,120,186,168,159,47,235,23,236,66,231,100,237,203,71,68,250,0,55,197,75,211,64,149,143,125,146,86,17,47,77,42,205,146,94,170,75,117,147,146,150,94,18,231,87,250,249,78,30,14,36,165,35,73,187,243,133,186,
-240,234,21,189,178,228,246,22,151,106,117,41,219,208,192,41,72,206,246,109,74,133,5,216,15,39,215,169,24,117,47,248,235,34,105,233,233,26,176,65,47,15,248,168,76,58,234,195,218,229,178,203,104,11,247,200,38,195,184,220,240,57,169,95,177,120,251,182,106,209,179,118,88,11,39,95,110,151,212,159,150,44,15,90,253,189,81,131,47,202,102,177,17,254,123,76,8,52,244,223,68,215,31,52,173,47,45,195,185,228,195,97,189,131,49,213,43,75,139,21,218,226,197,176,69,207,42,136,14,84,194,30,38,210,3,112,215,168,252,61,195,237,24,32,168,128,223,45,187,241,110,140,232,98,187,109,210,64,218,75,14,1,25,48,216,122,177,149,33,166,49,101,132,159,188,134,71,160,250,198,143,71,16,74,89,103,28,118,188,190,244,202,32,226,166,150,36,157,223,105,211,50,8,207,193,183,151,65,216,109,72,249,58,49,131,56,187,184,71,25,100,220,62,103,155,65,76,74,38,103,16,187,111,223,85,6,129,254,123,100,6,25,109,122,22,25,196,229,25,15,25,36,64,6,17,55,111,37,233,252,142,178,150,65,216,77,168,91,204,32,236,86,151,124,157,152,65,156,93,220,163,12,50,110,159,179,205,32,38,37,147,51,136,221,183,239,42,131,64,255,61,50,131,140,54,61,139,12,226,242,140,135,12,18,32,131,136,15,41,36,233,252,147,147,110,134,122,18,125,254,243,247,63,175,216,65,69,246,121,156,16,254,13,159,245,143,232,102,75,162,140,237,173,93,147,232,27,137,110,226,150,240,115,108,227,90,190,29,165,252,16,226,206,210,16,251,108,74,190,78,76,67,206,46,238,81,26,26,55,242,217,166,33,147,146,249,211,16,245,224,215,60,102,158,254,198,227,227,245,157,230,37,232,208,71,230,165,209,166,103,145,151,92,174,242,144,151,2,228,37,177,171,161,36,157,189,211,43,27,211,31,130,166,20,182,243,163,124,157,152,82,156,93,220,163,148,50,110,159,179,77,41,38,37,147,83,138,221,183,239,42,131,64,255,61,50,131,140,54,61,139,12,226,242,140,135,12,18,32,131,136,253,94,9,240,150,59,206,32,108,220,242,117,98,6,113,118,113,143,50,200,184,125,206,54,131,152,148,252,207,50,8,244,223,35,51,200,104,211,179,200,32,46,207,120,200,32,19,51,136,122,180,172,254,154,95,147,162,205,170,178,96,143,182,45,46,162,69,17,239,58,94,235,166,250,103,217,198,249,1,188,191,80,15,143,189,255,248,233,175,119,111,63,111,73,243,174,239,160,127,70,238,109,153,51,103,230,15,201,1,13,17,181,64,22,175,115,82,63,227,79,127,178,167,244,246,21,201,15,41,89,92,160,79,239,38,113,19,231,229,22,60,214,150,84,36,110,200,117,77,190,46,162,154,195,165,200,150,17,125,63,120,115,181,103,7,49,247,47,254,20,50,124,238,173,239,35,2,152,133,170,168,220,147,42,230,110,217,139,193,167,11,227,156,190,120,234,167,252,137,39,213,161,118,213,129,85,185,146,130,186,211,170,220,27,170,11,121,0,70,59,124,138,177,107,101,213,39,133,30,35,92,39,55,100,23,47,128,202,248,208,220,136,163,108,67,231,66,254,28,97,247,29,1,7,229,188,43,47,214,185,164,57,120,129,101,64,189,68,226,1,3,244,225,193,134,1,161,195,214,48,31,134,124,52,224,112,157,11,219,55,100,183,55,109,1,123,240,161,129,11,34,16,218,140,124,131,8,218,99,17,176,14,124,0,48,57,195,10,130,128,129,19,198,166,23,14,109,98,218,193,77,66,47,102,64,224,4,156,138,192,73,130,146,50,244,39,101,65,149,197,236,199,147,79,69,209,119,229,198,210,203,154,115,146,105,21,204,47,199,102,9,208,135,199,196,52,230,151,205,143,61,193,103,167,108,183,207,217,17,30,15,180,153,87,56,80,57,211,27,71,117,90,103,68,167,78,37,5,53,110,171,184,104,174,171,146,38,177,129,206,126,74,228,18,101,213,205,67,233,46,67,0,128,94,172,16,128,28,4,81,145,182,252,66,78,70,1,187,177,194,128,130,6,25,67,143,91,231,64,63,233,206,238,171,172,237,38,230,164,151,221,118,232,0,84,132,37,55,63,38,51,209,84,76,92,194,129,170,83,225,230,203,116,27,185,226,29,192,219,36,69,150,2,157,8,64,31,88,67,13,30,94,37,69,17,199,10,137,83,83,225,227,119,24,210,110,66,56,212,164,26,160,220,
-199,117,253,173,74,197,27,82,36,242,155,139,44,149,119,227,56,228,185,148,71,39,35,214,167,207,100,196,228,140,201,136,3,170,177,52,128,76,65,78,77,74,202,173,71,69,254,140,26,181,4,51,129,236,50,79,129,16,150,113,156,136,122,177,161,167,50,24,38,164,130,124,115,78,255,160,173,195,253,148,28,226,122,108,54,4,22,96,111,229,28,130,58,62,104,230,227,93,76,206,176,58,215,9,108,173,148,218,173,238,212,169,164,168,70,68,97,8,53,67,61,89,145,146,239,3,67,102,158,49,196,91,186,181,114,49,67,45,62,209,129,67,57,227,177,101,128,187,178,240,154,212,6,146,136,95,57,49,37,5,91,201,161,206,229,5,64,147,197,86,113,85,182,221,106,129,5,215,146,226,50,56,145,237,58,118,202,42,163,90,227,126,233,75,90,34,83,2,157,11,84,140,138,3,186,154,237,78,125,173,126,140,47,14,133,58,175,245,161,16,53,151,136,221,128,208,133,169,189,72,241,80,14,5,205,101,57,237,17,89,154,239,26,5,96,95,247,135,141,115,242,210,58,245,152,58,149,172,137,45,37,249,252,216,84,167,30,216,148,44,118,139,165,65,75,154,30,68,66,213,142,129,80,173,189,238,178,52,72,65,35,90,93,211,64,44,215,255,202,121,160,162,153,173,250,194,93,117,224,169,74,216,234,164,74,10,124,87,29,253,170,58,45,241,138,90,176,124,93,145,156,196,53,89,36,55,177,88,196,47,213,234,229,138,61,123,6,113,32,237,122,64,111,96,183,81,77,163,148,240,11,11,94,9,37,113,17,173,9,199,152,53,203,174,49,203,106,249,58,78,190,208,192,102,45,170,230,226,241,8,76,209,240,104,148,162,217,109,129,148,146,199,147,217,53,188,45,160,107,178,205,138,163,81,242,86,33,32,30,104,47,27,18,33,72,23,23,35,96,86,61,142,79,172,159,136,170,163,11,151,82,232,131,93,244,193,240,31,178,190,169,170,
+{120,218,236,189,123,119,228,182,149,47,250,183,244,41,152,190,127,180,52,169,86,90,242,156,147,115,172,180,215,237,151,157,158,233,135,211,221,241,204,189,142,151,22,171,138,146,24,87,145,101,146,165,135,63,253,221,27,224,3,36,1,18,0,137,71,157,155,172,172,182,170,138,0,126,216,216,111,0,155,199,199,131,255,219,166,235,253,38,10,182,219,176,184,189,60,62,94,165,240,87,178,14,194,85,154,159,60,124,123,189,41,78,241,159,224,56,92,175,179,40,207,131,15,47,191,254,117,159,132,217,227,213,203,215,159,190,192,79,151,221,54,235,229,230,20,255,17,181,129,159,72,147,40,41,130,39,95,111,163,178,221,105,112,189,79,86,69,156,38,193,42,220,172,246,155,176,136,242,160,192,223,179,85,0,143,196,73,20,164,215,193,195,2,190,12,139,32,166,63,30,31,221,133,155,125,20,220,223,166,121,84,61,6,191,61,156,5,216,55,253,17,62,103,81,177,207,146,104,29,196,73,144,133,235,56,76,242,0,65,195,79,199,71,56,249,8,254,137,97,228,205,99,176,142,174,99,124,180,72,131,101,4,255,47,238,163,40,9,158,147,231,127,124,23,156,196,201,106,179,207,227,187,232,244,236,9,75,51,24,187,164,89,16,8,169,246,229,221,199,54,213,104,43,164,26,180,18,209,13,90,245,233,70,90,14,211,77,64,53,74,150,227,35,74,53,13,154,117,40,118,124,196,167,217,179,31,223,253,233,130,18,142,252,41,166,93,17,54,180,11,6,200,247,245,101,135,124,180,33,37,95,48,64,65,104,216,167,32,105,60,76,65,120,228,6,27,140,17,177,122,206,28,29,75,254,27,161,226,5,37,227,226,81,32,188,203,184,166,199,69,143,146,23,148,148,208,152,47,197,108,99,46,53,161,131,197,163,52,65,241,171,226,62,13,142,131,242,127,119,97,22,135,203,13,60,253,64,102,251,120,22,4,239,8,77,243,120,27,111,194,12,233,82,245,25,39,55,85,167,199,71,76,175,143,193,159,112,169,162,135,85,180,43,232,138,225,99,121,124,3,116,135,223,151,105,113,11,141,110,246,8,29,86,34,139,26,0,251,156,210,126,29,21,81,182,69,185,192,166,191,237,195,117,22,54,152,129,30,251,77,1,216,90,203,124,124,36,191,208,252,101,174,97,140,172,119,189,102,141,150,134,70,71,98,177,233,170,234,70,83,151,237,4,82,195,83,215,93,109,77,39,77,215,183,165,166,239,111,35,32,237,3,206,254,6,160,39,72,149,122,134,37,121,168,164,208,46,26,74,214,108,127,78,104,112,222,98,114,86,203,14,205,185,171,104,89,61,59,52,103,158,170,237,106,90,219,115,110,105,199,129,57,119,181,99,75,57,14,204,153,167,28,187,186,145,157,115,75,41,214,243,227,77,190,156,51,59,153,85,90,72,50,237,215,14,211,22,146,76,251,149,195,180,133,112,50,175,211,137,211,201,111,101,76,23,200,210,95,187,66,120,43,99,186,176,33,79,10,111,79,152,9,181,102,116,251,184,139,178,101,186,137,87,93,238,140,87,183,84,85,85,10,168,163,151,194,60,56,137,30,118,72,171,63,6,248,199,179,135,211,83,208,167,23,93,17,148,154,50,136,210,95,187,50,40,53,101,108,200,19,66,254,148,201,156,217,73,247,166,92,175,41,204,125,124,230,207,196,51,7,78,145,154,57,8,212,95,187,146,40,53,115,108,200,19,197,214,204,5,107,221,118,85,164,22,155,46,8,206,147,114,99,219,159,40,185,93,102,194,159,95,190,121,247,242,99,219,202,52,205,71,167,93,54,239,205,188,234,130,117,41,210,228,46,202,10,92,200,155,44,2,87,33,78,192,138,214,130,25,52,240,203,7,100,224,191,121,251,195,231,183,111,219,240,155,230,163,240,203,230,61,248,85,23,60,248,149,131,64,224,151,15,182,224,19,110,148,208,147,111,255,251,199,22,110,218,110,92,79,66,187,30,224,82,2,184,156,70,77,21,48,87,20,156,224,231,101,152,147,143,181,112,37,33,60,28,110,130,77,122,3,126,92,113,187,205,79,97,150,113,233,82,97,147,93,122,31,101,132,63,91,124,6,13,164,102,250,254,211,15,173,153,210,118,227,51,133,118,189,153,146,182,130,153,246,38,194,133,124,254,156,225,172,1,200,231,207,187,160,73,203,138,169,6,64,159,63,231,193,198,214,2,224,184,36,207,206,159,243,128,215,227,195,26,180,66,4,30,246,210,207,255,241,211,
+127,181,160,211,166,77,128,192,3,223,52,237,97,39,205,91,225,1,159,191,30,68,92,243,216,182,66,191,101,197,73,53,135,33,71,240,111,159,219,142,68,217,144,206,96,200,19,132,134,125,43,132,141,133,140,147,38,207,146,232,6,52,236,29,232,174,52,45,250,140,179,90,202,161,126,253,170,131,186,108,56,138,26,27,246,221,133,229,0,234,213,126,217,69,219,140,26,197,155,26,238,144,119,243,246,221,251,54,92,218,112,220,187,129,134,125,184,216,184,5,55,221,39,107,140,10,247,187,251,48,131,191,74,214,72,34,8,223,242,2,149,104,116,19,101,45,74,95,135,203,92,6,193,247,47,95,245,53,55,105,252,32,246,54,224,231,116,179,47,24,174,37,217,168,74,21,94,111,82,18,160,62,219,165,0,45,72,246,219,37,176,112,155,19,224,153,52,99,104,43,34,237,247,239,63,125,250,220,162,109,213,114,76,133,144,150,253,169,145,214,92,234,174,211,251,100,148,190,187,176,128,224,56,9,174,183,233,154,194,95,148,122,176,61,131,215,31,222,64,60,255,225,211,27,140,188,195,205,101,183,33,234,145,82,13,182,39,208,105,216,65,143,141,59,73,134,116,187,219,87,41,134,12,28,156,56,89,83,133,177,142,239,226,53,230,9,30,130,229,35,168,143,227,35,94,232,245,0,30,95,18,252,91,240,88,197,111,73,149,226,249,109,159,22,113,229,82,129,147,244,184,128,32,31,137,69,148,19,165,212,239,81,150,34,185,194,132,203,133,228,241,90,225,194,19,34,57,42,21,231,231,79,127,255,248,166,237,70,149,61,80,189,219,244,32,82,189,164,135,190,39,69,122,73,22,193,246,180,102,229,114,229,169,166,221,6,187,77,184,138,234,165,207,226,155,219,162,225,232,146,195,215,209,42,222,130,105,36,124,125,25,196,215,208,14,136,149,110,99,88,219,245,2,27,63,47,59,58,131,159,86,64,149,37,38,201,106,173,136,190,26,14,10,29,226,250,220,196,224,10,109,162,235,130,59,192,89,51,254,54,216,238,129,17,161,51,1,161,227,60,129,136,117,93,50,212,50,230,202,210,187,47,31,95,126,108,19,134,182,227,234,198,12,249,227,154,134,128,79,147,180,120,22,62,163,146,252,180,193,117,242,49,252,120,186,8,168,194,217,160,71,4,179,200,238,193,126,33,186,6,92,156,92,215,224,80,37,112,193,189,251,248,125,23,28,182,227,129,123,118,78,161,101,209,14,186,33,153,172,154,198,77,184,147,128,227,31,23,192,216,253,167,119,16,25,146,167,155,135,16,233,115,254,4,200,35,209,24,121,191,127,247,241,221,215,183,29,129,165,45,71,9,156,68,49,14,92,193,97,102,145,164,89,16,118,23,128,208,157,202,176,144,250,199,199,251,36,15,175,49,90,174,34,18,248,231,132,183,2,248,11,124,217,64,47,149,68,72,218,164,219,82,133,99,167,220,62,239,168,96,10,59,14,179,27,153,190,107,23,5,127,57,201,163,104,93,246,123,151,198,235,118,199,121,15,50,146,45,14,55,241,239,52,107,73,186,96,168,126,31,99,222,51,192,78,219,110,212,166,59,88,111,18,229,51,154,163,145,229,193,144,179,124,136,29,125,23,159,144,60,115,107,184,93,220,167,21,8,253,118,151,102,5,166,97,217,56,150,178,0,89,236,246,150,214,50,44,152,113,182,113,150,129,213,91,126,11,95,255,252,109,152,60,94,93,252,130,124,140,159,128,180,191,52,243,125,245,159,175,233,195,13,134,207,108,188,29,133,235,103,244,1,64,20,222,16,219,31,6,175,94,126,133,168,232,62,37,191,3,111,108,246,219,36,239,100,107,215,209,38,2,73,160,24,2,2,226,252,151,69,112,139,0,74,44,213,183,44,26,218,172,65,243,134,124,14,94,253,253,35,200,202,26,104,0,138,23,205,27,25,185,20,136,232,97,117,27,38,55,104,250,200,66,108,66,208,157,208,130,37,189,0,206,186,252,140,84,25,69,117,181,221,111,138,184,135,141,124,187,219,16,144,139,32,191,141,175,73,182,30,62,229,224,193,141,130,168,22,70,56,42,240,82,111,76,228,47,248,156,197,96,121,90,6,56,34,230,136,79,118,48,88,244,11,241,144,203,125,114,21,39,164,15,150,35,200,23,101,50,52,222,52,110,96,154,208,165,33,251,14,183,152,98,73,183,17,179,54,26,216,22,193,117,154,173,34,84,186,82,48,175,200,227,214,192,102,241,186,145,163,5,54,100,49,
+14,32,14,139,62,97,127,140,50,64,191,173,6,195,153,147,149,37,172,83,186,8,121,180,74,1,15,138,28,73,158,20,196,202,100,121,49,3,92,57,90,55,200,187,180,158,142,191,217,144,219,237,34,80,151,65,220,198,183,103,63,6,98,144,180,249,213,125,22,238,26,120,244,203,114,223,2,156,40,234,218,238,209,43,139,91,59,137,18,99,51,164,26,135,65,30,53,10,38,103,148,249,40,28,240,75,101,73,67,244,39,62,31,175,65,211,6,155,24,52,105,62,29,163,18,245,8,92,21,18,42,129,238,97,238,105,157,17,120,32,67,99,232,168,202,105,214,150,217,118,46,194,213,237,73,81,160,215,177,64,221,179,187,142,55,209,183,121,145,13,144,133,52,234,27,232,16,188,200,123,34,88,132,0,235,40,201,75,117,70,115,240,160,251,74,25,164,59,58,197,227,46,34,63,237,243,40,175,253,205,230,119,68,66,32,183,125,29,236,136,238,226,145,7,238,99,16,112,8,76,32,120,166,150,24,158,169,59,203,163,236,174,19,169,16,88,48,179,147,252,247,111,55,201,13,235,134,180,109,29,125,172,153,230,235,44,34,91,233,116,154,63,163,79,184,184,35,12,143,83,134,153,229,136,240,105,254,251,211,118,100,148,92,167,193,73,176,108,171,229,19,250,17,232,12,107,222,252,125,202,66,192,150,140,110,203,192,179,2,157,22,2,1,150,27,202,113,16,107,163,101,199,7,51,244,200,192,243,11,151,233,190,40,93,162,56,9,126,134,197,202,226,37,4,232,11,194,4,191,4,244,81,38,182,123,87,84,125,229,68,89,238,178,116,23,101,16,121,215,42,19,251,202,64,109,102,235,179,128,157,218,77,84,124,193,57,247,102,135,132,101,103,82,62,200,208,178,58,153,64,207,16,172,138,61,248,146,132,126,204,144,235,40,95,101,241,174,72,51,202,153,249,2,173,228,109,84,110,235,111,119,25,186,202,196,11,35,27,17,176,248,5,195,72,108,120,141,93,110,163,109,154,61,6,59,244,26,201,80,232,116,7,203,229,238,12,224,253,8,223,34,196,147,211,246,38,12,252,4,114,22,174,32,66,59,105,79,18,231,24,116,38,89,61,202,119,94,87,251,44,195,47,129,200,233,138,174,22,197,1,208,183,225,67,149,167,194,28,255,38,34,199,35,78,107,247,182,7,138,248,184,95,65,130,58,196,71,117,6,156,212,67,86,63,31,240,193,17,97,172,78,133,160,168,82,47,186,6,176,192,13,171,38,248,167,207,83,196,93,108,159,211,13,225,137,202,212,15,2,195,135,249,136,50,248,37,9,183,53,42,198,183,231,147,37,143,138,255,140,30,59,244,88,4,16,145,112,60,138,22,14,104,249,107,196,172,218,151,168,160,24,158,194,215,79,43,137,120,228,209,7,152,235,41,142,240,244,44,120,151,148,207,227,231,69,75,161,253,26,101,73,180,161,186,42,7,173,149,20,155,199,96,9,108,240,43,16,52,71,105,75,201,172,193,17,92,133,160,14,97,118,235,253,110,67,194,139,186,35,244,175,31,145,207,59,212,232,36,98,194,62,17,186,57,3,74,250,255,140,122,140,138,41,56,146,7,160,54,141,206,176,118,90,233,113,157,125,18,255,6,214,228,4,166,122,218,165,255,203,21,136,98,206,95,130,65,155,82,183,101,210,23,48,89,60,112,132,161,20,213,19,251,29,177,167,33,121,16,86,37,190,139,55,241,77,132,155,172,68,198,227,156,240,68,240,1,135,59,62,10,178,159,49,92,76,147,205,227,47,229,201,30,34,123,247,1,126,5,26,13,45,19,233,235,12,30,14,127,166,6,179,126,190,122,24,159,163,42,135,142,143,15,223,255,156,197,69,132,122,184,211,51,42,80,100,22,34,222,164,95,64,84,210,13,91,19,213,189,36,71,144,66,114,138,233,19,202,254,175,168,197,195,82,207,150,144,23,165,134,198,30,243,253,50,143,128,232,64,22,138,33,15,174,113,85,104,152,159,4,17,9,136,183,48,19,80,99,56,40,43,71,196,18,20,121,180,185,238,10,42,119,181,78,121,82,218,93,155,146,91,168,242,38,171,129,75,92,186,19,149,202,165,203,65,244,6,174,98,6,106,190,175,44,190,144,121,173,162,87,97,30,245,144,180,210,46,165,29,97,158,111,240,252,16,149,199,204,202,95,233,246,40,186,255,196,253,193,126,134,52,71,156,127,73,51,8,228,79,198,164,166,122,144,163,177,202,108,26,206,152,17,22,176,153,
+81,22,173,219,217,72,218,199,231,8,92,147,60,146,30,179,124,94,122,232,140,62,15,156,206,128,144,243,62,101,92,78,105,103,147,81,15,31,81,157,119,13,22,58,230,84,55,224,58,117,148,2,182,96,150,25,51,166,33,110,176,146,228,19,177,14,152,252,167,98,223,225,44,222,96,124,27,244,234,213,143,73,111,156,28,120,8,212,115,65,183,125,155,241,68,166,135,90,216,158,234,43,196,115,163,45,70,103,39,178,200,237,120,53,206,191,102,97,146,227,126,201,184,242,103,30,190,100,231,48,208,5,7,127,253,116,51,133,15,225,175,81,173,116,138,234,247,179,160,86,72,199,71,203,20,236,122,152,84,39,100,202,28,90,142,12,140,158,59,209,24,235,45,56,182,64,55,234,36,97,106,4,55,149,64,175,80,99,176,238,8,47,132,253,57,60,46,57,245,230,233,214,220,135,58,225,76,190,121,92,48,251,93,253,64,155,83,194,187,232,36,217,70,99,35,192,99,23,188,102,165,21,237,204,10,127,102,220,151,144,48,18,89,131,52,200,193,129,6,179,176,64,10,67,179,123,160,230,38,13,215,101,102,120,29,131,99,3,11,84,123,25,213,74,85,158,192,187,79,164,73,18,161,154,15,51,124,246,71,88,192,28,21,76,21,148,129,219,114,124,132,57,102,122,42,24,20,127,157,137,190,139,83,230,4,114,145,110,201,177,184,237,22,144,128,91,85,164,192,212,127,248,67,139,147,129,184,127,5,55,191,235,110,247,166,76,31,235,198,103,48,111,12,18,96,214,217,30,194,10,84,193,9,227,205,116,132,246,29,13,34,114,137,193,170,71,251,3,38,85,44,146,203,140,10,234,252,17,44,212,58,56,89,158,183,85,197,242,162,155,31,239,91,2,210,148,241,145,162,188,104,150,10,51,224,181,187,145,211,81,192,4,38,105,209,86,142,89,180,239,218,157,197,58,218,52,129,176,80,255,147,150,48,4,195,107,183,251,235,235,77,212,104,126,28,157,108,49,226,94,99,132,204,71,188,89,146,12,168,55,192,168,96,227,113,240,125,210,77,24,195,8,31,194,157,4,188,110,200,94,129,219,178,134,233,77,148,145,141,79,128,135,94,0,252,182,67,38,69,215,128,60,79,164,4,189,133,53,46,25,73,213,160,151,159,62,91,70,207,104,190,187,181,95,179,141,178,155,8,83,59,39,33,147,77,90,50,216,4,249,132,186,33,163,46,240,43,178,104,237,92,81,121,42,45,77,162,118,30,161,64,115,190,42,116,70,111,53,110,16,188,171,190,30,69,81,254,175,58,68,0,131,156,37,209,61,38,142,134,18,248,175,63,188,1,242,194,131,151,194,150,11,18,3,151,91,95,211,250,128,128,124,81,169,221,129,20,178,18,168,121,59,100,242,77,162,62,68,249,166,104,187,131,0,180,54,169,52,36,39,254,63,250,6,207,48,28,207,3,106,40,233,166,84,235,180,8,226,201,129,239,55,209,9,166,220,7,156,60,10,132,62,203,209,173,117,118,47,12,232,51,101,174,34,42,186,195,237,66,136,106,81,204,123,186,181,249,112,118,118,214,25,184,110,197,25,27,226,228,152,248,95,249,134,100,124,210,187,50,80,37,62,67,121,165,132,102,6,73,194,31,181,224,26,221,8,146,255,90,7,224,15,67,92,117,38,9,20,86,62,70,155,71,185,32,33,28,58,64,177,186,151,139,30,114,114,148,231,25,208,140,224,110,195,94,102,233,175,228,112,59,26,106,116,216,241,240,5,25,183,165,21,17,103,220,177,85,203,34,234,121,14,20,75,245,228,229,96,251,252,182,152,212,30,254,158,212,30,132,97,82,251,235,205,180,241,215,203,205,72,123,102,37,111,35,136,5,208,104,68,15,196,169,195,117,204,130,85,215,3,32,126,234,67,101,252,187,81,2,139,2,115,141,236,66,182,82,166,109,24,240,232,229,88,31,100,49,39,246,65,22,116,98,31,100,81,39,246,65,22,118,98,31,100,113,135,251,224,102,51,74,103,185,149,139,174,189,59,186,184,181,143,119,198,158,123,168,14,62,132,155,155,104,153,133,108,40,10,238,208,110,249,120,114,19,175,91,59,80,43,232,178,37,9,125,203,253,242,253,15,101,235,222,62,64,111,187,133,60,8,24,193,211,42,226,235,184,222,11,105,101,10,203,203,79,120,129,174,73,250,147,224,178,136,183,81,115,198,162,58,201,16,71,108,248,89,61,223,244,65,6,37,196,106,235,171,107,32,213,73,47,18,46,205,
+14,43,112,48,67,124,150,159,1,166,244,166,71,165,210,50,240,165,59,227,65,240,238,26,252,218,32,223,67,12,137,123,232,68,44,171,203,158,193,167,119,111,158,37,241,230,236,73,192,98,138,138,213,109,23,212,67,121,252,131,124,110,161,194,167,17,41,23,89,235,220,41,142,15,17,208,3,170,248,26,44,89,147,231,193,95,94,4,15,193,95,130,229,217,10,124,226,150,141,132,232,231,159,224,121,117,0,221,145,63,190,97,189,132,111,90,252,80,54,195,21,105,160,125,143,121,229,122,161,74,251,12,235,149,227,129,157,214,129,31,218,26,141,29,57,247,199,242,35,57,114,200,14,27,140,162,104,217,233,31,233,119,244,60,97,156,236,246,224,73,147,203,33,228,40,35,249,162,123,127,114,199,75,84,115,76,44,140,136,15,247,215,98,119,251,152,147,100,9,254,204,79,205,16,206,232,46,59,235,4,197,5,59,14,121,188,63,80,21,98,61,133,150,79,131,116,181,218,103,116,203,233,172,19,187,110,250,107,10,225,246,125,229,6,222,2,49,170,191,55,49,14,142,223,209,255,194,90,197,172,155,217,85,5,180,243,115,118,155,2,191,32,25,226,70,104,115,98,166,104,118,165,115,230,36,206,233,45,186,132,36,137,223,145,37,138,243,42,58,123,134,125,68,107,234,89,166,251,66,248,43,101,176,56,57,62,170,251,111,235,141,90,113,146,17,176,133,8,210,241,17,115,249,146,9,33,73,42,29,232,137,228,98,46,224,98,10,99,19,163,242,217,33,247,221,69,155,199,227,163,219,152,92,81,142,138,211,242,78,112,137,157,228,189,241,80,13,38,79,43,147,220,12,77,117,8,12,116,124,4,224,200,64,120,14,50,222,44,232,101,14,140,97,67,220,111,201,49,128,38,210,20,147,52,106,112,18,93,95,87,195,99,226,31,212,215,209,31,235,131,156,167,180,99,92,204,18,215,130,213,152,113,117,111,117,187,163,155,124,240,248,71,144,229,163,114,230,49,131,19,29,216,4,157,66,60,115,135,121,245,69,176,79,54,200,13,0,251,5,129,138,184,201,95,199,71,155,248,5,97,48,252,23,71,127,241,28,186,126,9,188,65,238,69,180,247,112,154,187,210,215,117,95,72,201,178,51,66,251,77,140,189,81,16,64,0,114,113,27,186,198,35,53,216,251,57,176,208,199,180,136,154,59,222,13,207,228,251,152,238,116,224,161,38,122,222,134,242,66,149,145,39,7,69,97,206,24,91,81,205,222,202,26,117,114,171,60,153,106,153,210,89,5,236,98,84,192,74,246,38,167,134,100,153,188,18,60,122,90,182,245,36,43,56,181,98,169,187,160,131,29,31,181,232,136,74,142,30,167,103,65,8,100,153,57,245,212,60,135,247,18,121,98,93,138,11,14,61,172,5,142,143,74,53,16,232,105,1,172,26,192,106,38,85,45,128,23,254,27,53,16,40,107,129,82,226,106,53,16,168,105,129,227,163,190,26,8,20,181,192,241,81,87,13,4,42,90,0,68,190,167,6,2,5,45,192,150,76,184,230,168,20,195,90,32,134,9,112,5,30,122,41,66,190,212,215,118,27,16,236,216,29,229,174,40,51,125,76,48,152,233,50,122,172,252,221,13,201,89,86,21,111,62,253,24,252,244,242,189,75,43,138,171,71,49,229,183,241,46,184,77,55,235,92,205,0,74,210,60,239,30,216,84,93,0,3,10,181,191,48,1,187,46,146,74,150,33,125,251,112,40,171,100,255,15,89,224,229,38,77,183,3,75,91,173,35,198,162,236,58,146,118,205,2,190,218,199,155,53,122,217,248,53,30,192,43,240,196,82,149,209,170,116,12,123,100,4,147,252,205,196,40,49,70,45,94,53,209,114,0,188,227,132,71,54,182,17,40,29,114,216,99,25,209,106,49,16,227,150,17,247,25,65,74,57,174,63,115,9,214,190,30,15,198,153,174,116,121,186,170,87,84,235,152,109,8,62,44,94,172,218,166,101,73,157,178,131,124,15,248,51,8,173,235,72,190,69,244,235,54,147,43,16,246,39,218,63,209,216,149,94,167,143,129,151,209,12,10,54,11,193,5,187,48,39,153,229,251,104,179,25,231,63,214,172,243,98,35,48,22,96,231,58,87,65,216,15,125,135,140,54,225,18,28,111,37,53,70,173,229,53,2,168,238,114,151,39,34,168,51,152,19,219,52,144,214,199,241,161,147,243,115,222,73,215,42,222,172,242,184,12,13,26,222,63,107,206,34,126,173,229,28,193,149,
+244,67,226,159,148,23,235,78,153,243,178,209,186,211,146,28,224,160,229,51,242,85,148,144,75,149,113,85,13,137,204,41,192,189,66,234,104,128,206,58,130,86,232,115,34,82,58,79,2,176,106,83,126,197,52,97,142,167,40,17,238,164,253,28,163,78,122,100,188,208,38,35,33,89,185,157,13,60,219,144,6,221,63,76,117,229,160,28,239,25,85,138,251,213,89,84,157,122,249,255,239,34,12,47,200,55,218,11,178,96,86,163,89,132,134,90,3,171,177,96,22,179,73,91,178,39,152,255,143,89,175,180,149,92,211,81,61,23,255,82,61,146,84,148,215,67,23,255,210,67,110,87,100,120,117,254,165,148,44,46,222,205,100,13,245,205,191,52,148,14,73,229,213,213,55,255,82,87,30,45,207,240,82,253,75,119,77,95,201,122,41,233,45,19,137,132,69,55,70,167,13,249,57,167,242,234,74,149,246,203,32,154,238,102,128,152,120,125,44,249,51,127,94,253,248,136,201,27,201,231,213,9,219,0,87,224,38,1,206,21,86,78,113,39,236,43,111,135,129,226,171,142,68,214,167,3,115,86,226,120,203,52,188,50,231,186,43,35,181,38,163,9,185,227,35,29,202,6,53,97,233,174,139,66,2,238,152,221,241,206,210,60,223,145,3,28,5,187,1,223,220,142,111,109,193,95,128,146,57,58,58,97,78,190,46,50,129,2,98,123,230,152,140,139,170,40,70,121,56,160,188,19,191,160,27,26,57,169,15,193,92,179,123,6,253,3,55,5,116,33,158,34,208,167,68,101,60,37,8,159,182,19,149,120,192,55,43,207,220,1,113,233,227,216,154,109,65,198,141,126,195,123,158,72,160,86,174,230,159,105,156,156,180,11,1,100,173,79,57,75,130,156,161,193,34,137,55,87,116,91,36,39,122,60,130,185,192,231,242,168,229,9,243,164,128,112,56,118,67,175,255,128,79,173,66,131,48,21,151,232,170,241,27,132,239,241,116,5,126,197,187,101,222,162,42,240,104,148,185,4,95,3,232,160,39,223,203,205,33,143,182,177,203,41,84,227,179,58,107,27,203,97,39,59,32,19,192,167,59,114,244,116,242,28,106,28,173,202,80,69,56,60,139,250,2,7,110,243,217,94,130,75,208,30,255,87,240,31,159,222,125,188,250,248,54,120,241,34,120,246,205,241,209,73,118,190,200,46,192,184,188,96,73,187,200,96,112,24,114,241,236,155,46,185,234,177,176,191,242,100,88,217,201,229,49,222,86,171,166,214,58,162,153,172,39,204,118,117,94,238,142,173,46,202,63,202,51,8,229,17,4,229,197,171,240,48,59,48,149,198,252,150,217,44,222,16,93,91,238,16,163,131,149,5,207,130,213,121,240,151,159,95,252,2,63,146,255,100,193,31,131,213,69,187,194,112,114,19,241,102,219,190,152,146,93,72,206,126,226,92,107,56,140,253,34,71,38,4,179,61,255,83,118,193,204,184,51,219,214,76,215,241,245,53,216,169,100,21,25,97,99,190,191,211,12,202,92,71,169,191,67,123,91,45,219,152,42,169,175,111,88,68,95,143,201,185,46,82,158,217,25,130,31,156,196,103,224,89,222,134,155,107,178,239,4,106,243,25,174,35,169,63,214,20,163,68,111,155,61,120,255,11,30,181,39,23,57,194,124,69,35,179,53,241,79,86,197,208,201,29,218,15,175,190,4,245,231,63,50,187,114,175,158,92,14,142,223,218,20,52,14,134,91,44,230,139,10,196,27,255,241,14,163,146,80,13,142,214,119,110,100,86,23,219,26,248,161,123,133,167,162,236,33,121,150,13,84,104,213,139,34,194,58,131,120,226,138,196,86,215,193,99,186,199,49,207,130,79,85,109,201,197,241,81,89,65,37,10,162,36,221,223,220,214,167,246,241,46,248,138,188,120,166,60,103,133,39,130,147,227,224,168,46,201,16,156,208,221,238,187,116,115,87,189,194,6,107,203,156,182,183,170,241,162,14,247,168,248,34,120,100,10,6,242,178,162,216,244,138,115,112,156,166,11,200,13,160,250,186,33,9,61,241,90,226,67,80,224,17,238,71,124,11,2,247,229,66,2,68,100,253,31,7,238,149,85,136,6,208,208,75,100,245,165,169,162,57,195,94,161,146,65,66,110,73,61,14,220,227,171,105,211,170,99,105,8,141,52,93,174,240,138,200,124,104,246,75,105,64,189,195,167,101,91,33,34,140,201,235,115,74,42,232,216,219,41,55,55,89,235,237,41,251,246,117,119,114,230,159,189,53,67,78,222,
+195,67,87,173,82,88,12,170,170,168,81,93,201,136,87,197,40,78,154,131,249,173,177,91,245,25,128,80,241,77,146,102,209,21,248,43,121,85,155,141,139,38,97,207,131,48,104,250,131,87,0,55,143,53,138,114,148,252,248,232,136,16,142,144,49,193,75,148,152,185,1,7,141,133,241,226,197,215,207,127,127,219,3,126,149,164,248,115,187,190,196,197,47,66,188,169,22,100,146,172,98,48,215,101,60,91,144,59,151,42,186,75,138,55,141,214,237,242,124,60,140,175,63,190,177,180,200,45,56,210,107,142,248,124,93,246,206,156,134,102,96,156,17,90,249,198,48,91,199,73,184,193,234,101,109,196,60,42,195,195,252,213,111,122,97,119,50,216,189,188,222,200,219,56,233,158,241,34,255,101,7,132,103,224,59,238,144,155,244,30,11,223,179,71,113,179,128,220,232,98,239,226,135,15,227,99,132,15,162,49,240,156,179,120,144,202,35,11,239,110,130,147,30,233,216,154,201,175,63,188,193,151,226,193,131,221,2,50,164,228,197,29,201,172,98,198,149,33,88,55,49,156,23,235,232,174,87,31,153,29,5,45,4,62,196,27,3,175,121,173,97,145,2,248,61,174,75,43,244,135,108,141,182,147,26,110,55,199,120,228,197,130,73,219,44,242,70,172,158,227,141,89,253,38,55,210,78,118,168,157,250,88,157,50,8,100,87,44,94,3,43,222,181,29,223,214,197,226,79,239,222,252,55,189,45,220,10,167,171,187,156,56,42,60,82,222,120,12,51,146,10,217,150,5,69,203,157,62,6,129,196,248,236,245,117,247,88,54,157,91,255,28,68,164,64,6,19,138,164,73,158,110,232,134,147,24,82,23,192,109,152,11,215,131,189,232,135,3,50,207,246,245,67,89,82,171,220,242,36,195,210,43,166,221,17,111,162,66,60,98,207,207,195,113,153,22,124,63,143,25,147,150,236,105,70,174,171,119,149,103,158,133,4,103,182,179,185,254,47,2,233,163,104,42,218,48,32,90,183,156,43,71,146,236,50,119,47,57,119,183,1,79,232,157,100,198,216,71,15,88,16,137,253,230,22,166,150,50,39,175,107,132,63,124,254,145,52,63,191,28,26,100,209,218,17,158,101,192,139,203,201,179,234,119,250,205,188,179,232,15,240,239,151,108,20,194,27,227,102,78,74,85,99,92,140,14,203,246,104,4,194,55,42,51,95,68,108,239,236,137,255,185,224,252,187,46,69,204,67,251,31,179,243,8,119,152,255,105,148,39,184,67,254,217,26,15,112,135,255,95,78,214,156,11,229,127,119,149,242,58,77,34,43,138,185,63,144,5,229,172,57,187,113,5,61,195,108,164,148,52,103,28,91,138,122,120,138,214,148,245,48,5,156,40,108,121,202,56,81,218,51,240,140,172,226,158,153,71,100,149,183,65,158,144,85,224,150,120,64,168,196,123,133,133,218,169,219,124,191,101,235,71,241,240,148,250,240,248,232,168,169,137,212,196,192,63,252,240,25,250,248,230,170,245,174,186,31,112,244,242,152,34,14,129,155,20,208,253,147,105,3,227,115,253,129,151,108,252,41,53,240,82,122,236,69,254,107,188,171,83,138,139,112,153,102,197,85,154,92,145,66,217,236,94,40,7,26,142,194,7,135,184,112,25,240,77,111,19,160,177,187,244,211,96,146,55,147,140,67,237,236,220,229,100,235,174,83,22,104,61,121,81,177,147,161,85,45,79,39,242,87,86,30,193,36,154,225,48,124,136,21,58,209,250,170,0,156,105,129,113,72,241,10,247,0,143,174,178,134,228,98,89,185,190,228,194,183,238,37,151,3,141,72,46,23,156,59,201,21,192,36,235,58,14,213,136,228,246,32,81,201,21,175,170,109,201,229,209,140,72,46,23,162,99,201,21,129,21,175,176,21,201,197,98,142,125,201,109,237,189,187,146,92,14,52,34,185,92,112,238,36,87,0,147,172,235,56,84,35,146,219,131,68,37,87,188,170,182,37,151,71,51,34,185,92,136,142,37,87,4,86,188,194,86,36,183,93,129,165,146,220,214,169,16,87,146,203,129,70,36,151,11,206,157,228,10,96,146,117,29,135,106,68,114,123,144,168,228,138,87,213,182,228,242,104,70,36,151,11,209,177,228,138,192,138,87,120,146,228,162,137,55,24,96,67,247,19,7,214,116,211,123,3,47,165,199,118,234,166,143,65,243,219,77,215,94,84,5,55,189,191,178,242,8,60,112,211,45,45,176,65,55,93,118,145,53,221,116,27,146,107,194,77,55,
+176,176,22,221,116,237,69,85,112,211,173,72,174,57,55,221,210,2,27,116,211,101,23,89,211,77,183,33,185,38,220,116,3,11,107,209,77,215,94,84,5,55,221,138,228,154,115,211,45,45,176,65,55,29,21,133,65,55,61,78,166,14,172,105,236,123,3,47,165,199,118,106,236,199,160,249,109,236,181,23,85,193,216,247,87,86,30,129,7,198,222,210,2,27,52,246,178,139,172,105,236,109,72,174,9,99,111,96,97,45,26,123,237,69,85,48,246,86,36,215,156,177,183,180,192,6,141,61,14,103,208,216,67,247,19,7,214,84,25,189,129,151,210,99,59,85,25,99,208,252,86,25,218,139,170,160,50,250,43,43,143,192,3,149,97,105,129,13,170,12,124,175,160,204,34,227,115,125,201,133,111,135,37,23,30,16,139,199,240,216,210,20,227,64,35,146,203,5,39,41,185,99,208,52,22,86,0,147,172,235,56,84,37,201,213,94,84,42,185,226,85,101,36,183,191,178,242,8,38,209,140,72,46,23,162,138,228,90,90,224,90,114,229,0,155,144,92,77,99,111,67,114,57,208,136,228,114,193,185,147,92,1,76,178,174,227,80,141,72,110,15,18,149,92,241,170,218,150,92,30,205,136,228,114,33,58,150,92,17,88,241,10,79,146,92,28,206,160,228,194,3,98,241,24,30,219,169,228,142,65,243,91,114,181,23,85,65,114,251,43,43,143,192,3,201,181,180,192,115,75,110,120,119,211,58,182,211,174,55,22,113,174,183,247,80,65,23,231,67,107,28,226,75,238,111,34,206,193,38,149,193,171,234,102,132,206,188,27,84,37,148,11,121,40,139,32,220,228,105,249,106,212,60,168,95,216,204,172,112,23,161,25,14,68,10,242,81,87,128,69,28,168,128,111,38,6,68,172,98,6,236,225,149,48,29,179,18,89,134,75,232,144,23,146,51,152,151,75,148,86,65,97,50,83,151,100,116,150,108,189,26,93,77,65,58,25,52,242,253,58,51,39,121,136,111,76,253,19,190,105,112,25,99,29,189,83,193,225,215,30,66,67,158,0,142,35,48,176,114,240,133,238,130,202,12,230,114,24,112,204,1,151,65,113,70,227,226,222,170,68,52,137,145,118,170,156,180,75,119,123,250,126,205,63,141,115,210,206,22,43,237,228,41,207,153,192,32,47,237,92,48,211,78,141,155,134,230,52,202,77,221,58,83,186,252,84,245,51,196,81,117,141,40,105,141,196,69,103,134,147,170,161,248,248,7,161,139,56,72,21,253,76,60,84,13,43,230,34,185,217,72,243,206,110,46,230,217,201,113,143,172,22,226,227,51,203,62,187,49,138,43,104,32,101,252,51,51,208,78,134,131,38,105,31,198,237,35,103,169,204,198,78,157,211,102,42,131,207,29,59,193,128,106,94,241,76,103,225,140,197,78,6,142,194,217,143,157,38,19,217,117,236,52,235,42,248,26,59,233,106,138,25,99,39,206,137,228,30,194,131,142,157,44,137,179,219,216,105,18,35,205,20,59,9,56,105,103,139,149,108,196,78,54,153,201,101,236,164,203,79,115,196,78,125,62,226,162,59,216,216,201,18,15,185,139,157,166,50,207,164,216,73,204,61,59,139,236,99,52,118,178,204,64,86,99,39,114,52,213,108,236,212,57,188,171,50,248,220,177,19,121,109,138,138,87,60,211,209,98,99,177,147,129,147,197,246,99,167,201,68,118,29,59,205,186,10,190,198,78,186,154,98,198,216,137,115,193,163,135,240,160,99,39,75,226,236,54,118,154,196,72,51,197,78,2,78,218,217,98,37,27,177,147,77,102,114,25,59,233,242,211,28,177,83,159,143,184,232,14,54,118,178,196,67,238,98,167,169,204,51,41,118,18,115,207,206,34,251,24,141,157,44,51,144,213,216,137,220,209,49,27,59,117,110,49,169,12,62,119,236,68,95,126,170,224,21,207,116,199,202,88,236,100,224,138,149,253,216,105,50,145,93,199,78,179,174,130,175,177,147,174,166,152,49,118,226,220,116,237,33,60,232,216,201,146,56,187,141,157,38,49,210,76,177,147,128,147,118,182,88,201,70,236,100,147,153,92,198,78,186,252,52,71,236,212,231,35,46,186,131,141,157,44,241,144,187,216,105,42,243,76,138,157,196,220,179,179,200,62,70,99,39,203,12,100,53,118,34,119,45,205,198,78,157,219,168,42,131,207,29,59,193,128,106,94,177,193,187,178,179,196,78,150,174,202,154,141,157,38,19,217,117,236,52,235,42,248,26,59,233,106,138,25,99,
+39,78,197,130,30,194,131,142,157,108,149,54,112,26,59,77,98,164,153,98,39,1,39,237,108,177,146,141,216,201,38,51,185,140,157,116,249,105,142,216,169,207,71,92,116,7,27,59,89,226,33,119,177,211,84,230,153,20,59,137,185,103,103,145,125,140,198,78,150,25,200,106,236,68,92,52,179,177,83,167,30,136,202,224,115,199,78,240,144,154,87,108,176,90,201,44,177,147,165,98,37,102,99,167,201,68,118,29,59,205,186,10,62,197,78,251,237,50,78,114,86,15,14,20,128,36,207,54,80,190,236,183,120,40,33,13,240,235,69,80,220,70,193,46,204,138,56,220,192,128,249,126,83,4,233,117,16,6,249,110,19,23,193,126,71,235,66,101,21,242,126,1,166,46,18,115,213,84,219,243,96,139,46,205,53,159,214,100,112,165,253,32,235,76,218,206,17,89,177,131,118,85,91,0,132,21,13,89,40,244,161,118,161,67,36,41,12,130,67,227,207,253,1,59,84,235,15,100,168,136,36,15,44,75,55,105,208,92,210,160,226,224,144,166,165,79,188,32,13,207,34,241,192,234,146,166,115,130,128,79,26,120,168,25,233,101,229,82,8,71,225,203,91,127,48,115,228,105,1,238,218,5,53,224,108,122,71,215,97,156,49,133,198,41,29,216,67,120,208,41,52,91,53,6,157,166,208,38,49,210,76,41,52,1,39,237,108,177,146,141,20,154,77,102,114,153,66,211,229,167,57,82,104,125,62,226,162,59,216,20,154,37,30,114,151,66,155,202,60,147,82,104,98,238,217,89,100,31,163,41,52,203,12,100,62,133,182,141,147,106,110,229,28,4,179,187,168,120,135,62,214,66,12,157,124,195,246,25,62,116,250,20,114,228,5,83,171,151,215,113,248,240,77,123,69,20,240,182,87,160,34,55,62,215,37,55,116,218,39,48,124,25,111,7,106,41,43,33,17,241,197,8,42,92,56,9,100,50,121,170,254,162,204,65,184,240,129,3,47,124,24,38,156,10,18,45,194,133,15,2,194,117,145,73,17,110,42,199,113,248,154,118,123,117,23,110,28,243,157,16,27,81,60,114,248,172,112,159,0,104,248,32,0,105,147,7,133,216,6,136,168,204,137,36,169,41,175,86,23,160,86,227,155,36,205,162,46,218,94,86,139,244,252,141,254,80,160,193,7,123,70,0,125,10,244,146,180,228,139,171,36,69,242,74,155,164,177,161,83,28,188,189,244,188,217,41,50,35,47,49,72,186,21,76,83,200,134,138,88,198,24,81,136,139,175,14,59,216,132,44,216,24,246,104,13,62,135,244,226,136,197,131,118,244,13,71,46,200,15,109,122,197,201,38,78,162,224,122,159,172,72,184,197,67,1,99,145,63,46,143,143,150,73,240,237,11,34,227,229,115,139,160,200,246,209,41,252,68,55,8,130,112,115,19,45,179,240,236,58,42,86,183,39,203,100,17,60,255,191,159,195,239,17,238,234,193,200,103,180,101,71,99,240,230,46,171,14,104,227,102,186,31,56,211,28,27,107,30,133,217,1,50,68,247,9,128,52,53,38,25,69,96,186,59,0,59,204,218,231,213,223,246,97,82,196,155,72,26,244,111,253,93,12,14,204,170,91,14,239,86,63,13,115,175,0,87,123,244,30,47,55,173,22,193,111,234,12,93,53,111,175,234,56,20,233,213,171,186,106,168,242,55,46,53,212,70,159,133,229,251,208,134,23,108,54,136,122,66,80,141,57,40,6,53,114,145,20,148,255,219,166,235,61,60,181,253,53,122,100,102,150,165,5,60,124,114,247,45,185,190,154,0,164,28,239,36,3,46,124,227,93,133,231,195,127,190,253,127,232,147,13,140,77,116,93,60,163,95,6,33,185,171,29,44,31,105,15,56,236,46,44,138,8,248,241,54,204,111,161,123,152,224,105,175,75,252,173,233,112,21,110,86,24,188,66,119,164,21,132,181,155,125,196,233,11,233,166,219,87,183,171,34,154,171,171,252,118,54,84,184,0,51,117,117,189,153,173,43,224,241,185,186,130,94,102,35,123,145,77,103,172,229,126,243,235,21,229,229,171,135,52,187,34,125,223,118,100,98,17,80,54,22,137,70,221,178,25,121,151,230,197,183,193,207,223,194,47,47,126,57,249,249,91,250,32,252,121,91,246,123,186,8,126,198,38,191,156,44,79,79,91,91,120,114,136,150,157,87,29,113,124,63,4,184,74,147,188,224,117,201,64,205,162,111,131,224,54,32,131,7,249,109,186,223,192,31,81,144,63,38,43,80,54,96,
+173,110,163,112,125,28,84,255,83,159,218,8,177,153,43,83,61,146,11,39,134,125,145,201,185,156,216,200,154,241,39,38,185,114,174,23,173,180,26,0,174,99,56,200,228,186,126,183,96,14,97,33,43,144,93,107,181,220,164,75,248,58,44,210,109,245,119,5,160,128,185,100,39,167,48,171,106,172,87,239,63,189,34,223,94,214,15,93,103,233,150,62,198,62,84,126,219,60,182,218,238,72,79,237,190,224,219,203,246,124,79,187,143,224,183,205,51,201,126,179,233,63,131,223,54,207,100,176,32,253,103,240,219,230,153,251,44,6,155,220,157,26,249,182,121,104,183,47,56,152,225,219,230,145,117,180,225,60,2,223,54,143,108,162,228,166,32,19,99,31,161,223,50,147,143,194,29,103,242,240,45,203,254,176,62,39,224,213,192,127,78,201,191,199,236,195,248,197,21,249,182,102,131,143,105,186,3,7,100,95,128,83,124,246,164,223,19,81,237,252,142,234,21,60,62,238,112,68,156,220,160,93,71,16,1,246,112,220,93,248,54,134,155,168,160,167,6,30,49,202,197,223,201,232,65,152,227,1,2,210,29,184,216,241,102,115,124,132,143,93,199,89,94,4,207,201,227,120,100,7,191,67,207,186,58,123,0,77,159,92,138,0,45,192,73,90,71,15,40,255,129,0,92,188,126,80,195,118,124,132,187,144,25,144,240,38,8,11,138,235,41,25,230,41,129,29,212,168,143,143,6,97,159,181,112,147,21,160,198,53,232,47,1,253,189,1,154,23,105,22,213,152,40,190,110,159,9,48,239,150,156,202,34,252,1,52,104,117,73,127,110,186,12,170,201,39,251,237,50,202,16,41,37,67,156,192,215,113,94,247,79,117,67,254,219,6,191,248,118,84,71,124,249,219,123,41,53,81,62,215,240,89,29,10,208,145,144,61,233,95,167,213,31,218,236,206,116,137,28,207,235,174,252,142,225,251,182,130,108,222,139,24,109,246,107,212,29,223,222,65,180,209,234,163,252,13,158,38,180,171,31,109,58,67,189,220,21,195,37,35,208,1,119,134,151,66,185,13,196,114,219,157,251,178,71,206,177,193,248,84,11,134,169,214,182,46,157,149,5,6,168,58,99,68,243,203,215,207,132,91,196,11,201,116,128,194,78,250,88,164,215,215,121,84,148,177,84,167,191,175,97,204,228,129,63,211,192,29,153,157,30,245,248,153,182,61,59,75,126,1,241,166,71,153,168,100,229,63,63,199,111,37,6,93,144,132,30,141,36,58,163,127,217,47,191,144,70,61,8,228,200,67,57,80,133,129,254,247,143,164,187,95,120,96,24,44,127,60,9,54,4,71,144,149,170,163,51,244,235,52,89,133,76,102,148,126,142,18,116,5,138,251,180,236,57,111,73,71,105,161,2,50,67,212,155,172,234,128,62,223,147,223,185,228,164,77,89,208,173,158,19,162,81,196,61,191,194,159,185,29,151,20,40,251,7,149,68,122,106,117,190,79,226,85,186,142,94,22,229,210,52,186,191,63,208,127,189,190,205,94,22,109,197,31,86,61,4,171,219,48,11,87,224,58,31,31,157,160,106,37,177,246,41,181,7,245,98,128,103,23,99,78,137,101,141,178,131,147,123,236,129,207,137,223,67,39,56,58,227,155,165,201,93,148,177,227,23,41,124,168,65,180,53,23,154,158,252,191,98,88,31,58,75,80,42,215,241,67,169,1,226,214,36,127,36,63,53,3,209,207,208,113,180,250,149,69,13,118,137,246,24,148,132,203,247,215,101,159,184,70,157,94,191,144,31,217,195,157,215,173,94,25,83,240,62,189,143,50,102,181,59,164,32,63,183,88,179,164,67,73,97,32,195,6,31,1,45,153,71,109,107,249,247,221,110,168,103,242,243,112,207,123,124,164,238,185,161,111,20,102,171,134,18,43,1,163,194,183,95,200,147,12,29,200,231,224,26,143,21,55,114,125,22,80,38,206,65,175,84,28,179,8,158,157,7,241,117,144,164,5,60,190,79,214,236,220,178,43,73,8,159,35,152,83,30,125,233,35,41,127,41,231,162,141,168,161,9,158,234,196,227,212,53,166,36,138,214,155,136,254,125,29,71,155,53,207,195,66,50,85,45,25,50,145,35,162,229,58,224,177,149,104,19,111,99,100,115,6,215,77,124,23,37,180,231,224,132,40,66,124,154,200,95,10,22,160,21,3,66,79,91,49,39,160,222,221,49,163,227,199,224,254,22,6,204,119,225,10,188,155,48,195,249,182,212,85,173,7,135,187,126,143,63,15,
+117,77,240,18,129,237,42,196,122,177,135,71,248,44,53,66,233,86,114,21,46,211,63,136,245,197,16,145,46,88,6,218,166,119,17,85,232,105,114,19,229,245,130,129,174,2,139,153,208,181,219,60,54,74,170,196,66,84,117,4,79,173,107,215,148,210,183,113,229,135,233,60,128,146,208,219,16,202,230,235,106,185,134,0,103,114,128,63,219,0,204,4,21,93,184,13,129,119,16,1,87,112,193,132,10,164,245,61,60,214,160,253,30,99,25,60,202,205,40,77,28,133,202,102,105,136,193,250,236,0,1,249,25,126,107,120,179,109,190,106,194,201,1,249,172,14,36,220,201,224,24,164,200,16,235,193,227,23,125,68,93,162,143,145,136,89,214,114,201,90,139,58,70,169,33,86,155,0,176,33,157,4,190,246,9,225,184,216,23,81,233,136,228,25,177,84,139,117,94,144,255,194,180,203,253,150,190,55,92,182,100,157,136,234,187,18,111,186,90,237,179,44,194,35,118,0,229,41,116,254,20,92,190,227,163,167,208,253,211,179,32,120,119,125,29,32,97,193,143,93,7,47,200,150,28,141,82,227,28,55,230,202,31,128,15,32,232,160,173,87,224,198,45,35,106,222,104,76,27,225,147,228,114,80,101,25,223,37,16,171,175,193,47,0,58,193,186,1,145,10,124,6,160,228,184,123,72,179,73,76,11,66,167,125,66,45,216,250,248,40,143,127,143,22,37,46,36,40,224,33,242,188,6,171,5,246,245,58,0,36,4,33,26,90,198,38,99,55,48,177,22,129,195,124,21,199,85,120,212,177,253,228,183,158,159,92,185,143,208,25,38,33,241,191,180,251,222,186,49,1,12,213,120,220,176,165,126,180,29,61,189,125,40,144,75,154,240,137,49,62,114,35,213,28,45,30,178,63,28,75,174,210,178,102,173,76,12,249,123,65,220,157,146,179,225,63,79,218,161,58,120,170,37,154,13,119,252,93,199,101,102,231,74,127,163,179,101,5,136,13,13,137,47,60,56,66,222,113,159,217,17,232,111,220,17,58,209,39,110,5,74,76,164,27,180,102,241,205,109,33,1,143,213,148,41,198,139,39,249,57,21,242,11,46,63,210,135,154,73,189,39,159,25,131,90,57,154,34,94,225,141,178,96,56,147,59,222,197,132,1,227,36,135,136,160,82,93,53,99,18,162,212,179,236,208,134,182,105,6,125,71,62,55,118,137,92,64,12,65,180,111,163,140,29,11,244,193,6,76,81,21,176,133,69,139,148,157,65,202,135,181,70,1,173,115,82,210,110,197,93,93,250,76,203,181,71,96,2,86,192,223,152,103,41,87,113,147,93,208,242,199,58,215,197,60,31,237,226,77,122,179,231,54,120,91,254,6,45,224,211,25,219,251,229,209,177,228,255,72,42,146,108,190,227,20,152,60,60,225,166,111,241,63,167,228,223,102,123,228,235,187,15,111,241,155,171,117,139,101,133,185,194,58,83,89,119,65,90,247,242,106,101,230,179,253,84,153,245,108,182,226,94,188,192,125,93,188,27,126,95,162,99,195,235,215,31,222,220,133,217,219,191,49,234,225,183,125,8,1,211,35,49,200,247,41,233,53,103,246,100,255,32,209,223,199,183,242,253,253,101,188,187,247,95,21,186,147,128,247,94,1,222,119,227,221,253,160,0,239,59,9,120,63,40,192,139,115,60,62,121,39,236,235,221,151,143,239,222,51,60,7,198,179,192,48,0,109,22,225,226,122,91,174,58,59,82,196,219,168,233,31,211,197,103,115,179,16,233,116,110,62,34,157,206,204,76,180,207,153,57,138,116,58,51,91,209,62,103,226,45,161,210,123,68,222,232,232,61,158,178,34,207,93,21,191,203,168,172,242,89,129,214,34,191,146,233,144,191,212,25,143,52,227,168,47,137,142,135,153,175,215,241,95,100,251,29,102,192,126,191,210,128,223,171,1,254,78,182,223,31,212,0,127,39,13,248,7,53,192,141,174,19,246,56,172,238,40,255,42,104,188,249,217,143,85,125,243,243,32,163,3,231,103,68,86,25,206,207,141,140,86,156,159,37,89,245,56,31,95,142,56,137,228,177,34,220,238,200,97,178,33,141,89,63,121,213,223,139,238,106,204,230,217,74,103,238,147,60,188,142,2,102,71,232,225,42,218,165,171,219,147,211,111,235,167,219,222,104,243,76,51,209,175,16,201,252,29,190,15,200,247,100,156,224,228,249,243,111,201,255,131,191,127,125,141,185,243,255,8,147,125,152,61,6,231,139,224,252,127,255,249,57,166,197,
+59,195,143,140,76,115,44,197,85,243,115,13,0,65,61,163,195,146,78,78,33,58,221,237,82,136,147,202,164,16,56,241,49,166,103,138,22,82,214,115,166,131,23,205,224,237,56,142,32,32,207,92,196,236,229,13,233,145,133,3,146,104,70,48,101,206,84,171,13,56,78,239,101,180,213,172,51,187,109,86,142,70,142,86,142,141,182,97,83,26,213,128,219,120,179,137,101,135,237,88,227,250,39,16,30,134,192,106,42,177,110,216,179,201,210,221,15,233,68,110,247,127,81,233,125,72,41,242,123,87,2,255,94,21,252,119,42,189,255,160,10,254,59,37,240,63,168,130,175,44,246,96,175,67,54,187,209,161,210,86,219,28,155,54,182,219,28,175,214,22,220,28,195,54,118,220,28,215,214,214,220,28,235,54,54,125,126,254,85,254,95,109,240,127,199,188,251,168,189,199,167,198,131,35,250,88,231,24,27,62,242,251,183,213,80,237,20,26,53,0,188,86,245,236,170,244,254,152,245,224,160,107,186,136,86,185,170,197,251,123,17,19,106,215,247,162,192,218,172,178,136,158,15,110,164,188,60,240,210,28,8,28,179,252,132,240,191,103,168,17,198,226,82,124,104,156,232,228,169,14,245,214,209,117,156,68,39,91,146,170,37,39,15,128,211,240,223,91,242,239,54,46,183,22,8,142,54,41,240,155,55,209,245,115,54,187,90,100,160,194,86,228,48,229,99,146,110,31,25,206,193,199,217,77,185,206,200,152,103,85,28,249,124,238,145,37,198,188,80,28,179,117,4,157,234,245,182,150,103,147,172,87,249,126,121,5,108,113,5,32,162,12,204,2,56,68,36,233,81,242,164,32,247,218,109,117,117,159,133,187,214,118,32,221,21,169,24,174,228,196,53,189,37,214,3,176,229,33,216,230,212,53,27,128,208,106,119,5,79,19,28,140,71,73,158,132,182,26,83,236,182,234,76,241,229,122,93,207,142,248,122,188,185,97,31,58,115,235,181,227,205,173,209,46,60,18,54,106,188,26,107,84,73,13,81,180,63,40,111,110,26,131,194,215,226,57,165,73,113,203,239,95,82,101,114,186,17,177,42,121,170,230,212,150,231,174,129,78,129,226,109,116,21,201,167,34,36,203,51,157,126,253,110,56,114,80,2,235,135,60,26,176,164,185,102,156,112,106,208,218,129,238,24,130,139,250,175,78,95,2,125,70,243,36,141,216,147,207,253,190,57,50,40,167,89,177,241,147,182,152,10,180,143,44,146,190,14,26,81,128,37,132,70,3,198,215,215,39,208,238,188,30,20,195,142,139,58,85,212,185,21,72,149,31,77,96,99,211,102,164,170,50,113,251,114,3,98,11,150,81,113,31,69,73,240,20,199,121,74,14,120,224,159,23,79,91,91,128,141,78,237,114,158,156,29,160,76,36,102,172,117,231,242,115,99,159,52,198,195,171,252,157,241,4,26,160,26,246,184,117,167,135,108,157,14,238,156,94,180,119,78,111,162,36,202,170,221,119,136,48,121,150,236,132,108,255,242,58,132,6,146,253,181,14,11,108,174,42,191,229,228,180,207,7,237,39,250,247,123,200,239,141,231,19,39,21,39,118,37,155,120,239,228,233,82,188,169,155,223,218,203,102,252,252,60,42,232,211,204,77,29,238,144,151,120,52,9,243,60,121,176,207,163,53,137,174,119,89,76,207,185,182,130,31,1,26,224,254,122,122,28,32,55,125,32,55,19,129,244,120,164,140,93,4,108,88,186,246,253,164,23,115,154,159,138,253,227,46,234,108,126,182,134,121,204,232,145,161,109,74,255,11,50,62,200,255,52,142,97,198,37,159,243,146,223,41,239,159,60,70,97,182,32,210,176,128,254,78,59,210,78,148,72,51,63,142,134,171,20,141,244,44,91,219,29,45,207,190,28,173,201,128,15,13,120,81,254,151,211,94,172,142,49,66,108,26,246,90,150,193,11,61,249,82,6,21,132,194,88,27,110,112,246,98,82,147,185,82,82,223,166,251,44,199,56,101,15,63,45,142,143,74,73,91,144,228,103,249,225,20,171,117,135,219,8,143,30,158,61,225,69,185,107,170,250,214,141,5,98,228,49,24,55,248,195,80,153,112,247,132,140,19,212,163,212,99,40,35,148,135,117,5,225,93,184,103,235,115,15,192,131,17,88,48,193,73,156,112,228,250,116,8,164,2,50,28,180,115,82,102,8,91,181,67,33,139,176,57,189,4,241,101,37,113,130,80,150,35,108,85,202,130,100,28,74,171,198,59,76,139,63,159,148,10,
+164,204,24,252,90,234,145,138,217,3,225,176,124,214,129,145,222,124,249,74,79,155,253,41,42,149,85,19,67,119,213,54,155,233,17,41,237,222,252,94,139,84,102,217,201,25,199,62,156,48,158,185,104,160,238,140,216,113,240,68,182,204,32,181,159,61,60,200,85,107,227,67,125,32,186,58,160,151,200,234,44,34,252,151,254,45,53,250,58,47,56,11,87,27,126,122,185,11,53,20,241,54,35,114,224,248,248,136,112,210,15,31,190,18,127,144,172,243,89,237,39,85,8,209,130,52,226,212,219,215,34,166,40,162,103,59,175,240,217,6,70,249,109,78,186,160,92,75,120,231,36,73,147,223,163,44,61,62,34,70,162,246,77,159,253,143,255,245,63,255,252,239,231,231,4,205,31,203,15,45,249,174,18,53,103,37,40,90,32,7,250,172,170,134,2,188,95,70,240,93,97,221,131,203,86,5,167,12,164,87,118,138,229,227,156,89,150,191,52,19,229,1,111,70,83,197,94,182,236,194,39,182,93,22,60,121,152,3,157,124,63,12,188,26,71,21,54,245,236,59,160,65,37,201,66,134,71,57,128,225,91,134,161,120,120,233,16,170,104,161,85,23,43,49,235,224,59,52,198,142,3,152,186,9,85,47,164,9,7,53,145,191,18,246,99,39,16,173,129,211,241,106,232,228,185,33,244,156,161,123,60,66,125,18,66,114,233,73,148,141,120,220,66,127,25,157,73,51,172,222,92,202,246,221,217,148,174,148,218,108,202,70,156,217,180,242,3,3,179,105,134,213,155,77,217,190,55,155,223,54,87,122,51,106,26,14,204,234,132,148,238,186,198,47,227,52,1,175,164,237,141,142,78,186,133,78,115,226,77,31,125,198,108,192,168,114,103,211,146,203,162,205,207,18,124,218,66,161,203,172,77,39,28,117,71,2,16,54,113,22,136,51,74,212,47,101,84,18,77,245,116,93,103,86,25,54,97,72,227,239,30,113,189,81,94,72,198,38,22,131,59,54,220,80,195,168,134,13,223,162,18,173,226,235,120,213,2,215,14,138,187,36,43,36,176,20,195,196,42,180,40,213,198,178,232,80,73,14,150,28,28,204,210,132,16,62,14,18,39,143,138,175,149,235,152,64,252,49,232,116,247,210,67,95,241,160,67,217,13,189,222,196,29,3,93,126,244,44,79,90,33,40,39,124,160,174,104,45,240,69,235,34,116,249,53,13,78,138,219,176,8,214,24,46,129,118,7,235,114,84,223,67,197,32,163,38,68,151,254,17,214,167,87,6,18,177,181,13,135,97,148,183,75,7,65,84,246,172,5,162,167,169,218,16,68,86,148,205,207,150,230,20,49,29,31,17,105,161,201,58,188,116,135,21,50,130,123,160,16,120,233,173,197,161,254,88,81,134,8,28,28,36,164,27,118,252,88,191,175,183,17,11,254,147,108,239,60,31,173,113,209,186,61,131,175,255,171,74,239,229,243,253,17,202,31,248,163,52,139,37,73,33,209,66,181,188,157,102,235,184,19,37,65,199,24,92,228,39,36,164,161,25,18,18,247,84,53,47,197,73,115,242,20,63,137,79,180,67,120,141,81,69,117,58,225,248,8,88,134,52,193,87,50,228,121,188,220,60,6,9,150,21,141,239,218,201,144,58,31,223,194,68,191,26,5,213,205,172,143,160,2,78,61,62,42,147,238,227,176,96,209,218,160,240,139,81,72,248,144,26,153,176,197,24,28,118,243,165,104,118,94,6,34,19,153,61,23,130,245,72,118,211,229,49,189,86,137,178,235,6,221,139,177,121,240,49,184,191,133,224,62,88,163,246,64,72,31,65,190,81,120,142,202,123,206,36,20,63,249,103,117,158,182,126,153,229,249,105,71,66,213,32,53,45,250,152,200,61,117,248,189,34,79,105,108,241,225,174,90,176,56,28,33,162,202,152,117,3,254,144,229,9,99,162,246,74,90,147,135,143,232,130,156,191,0,233,128,223,22,193,217,217,34,248,243,139,124,143,159,90,215,160,215,235,214,161,50,178,111,71,211,79,129,212,62,47,159,39,27,183,130,216,60,120,6,116,217,83,210,247,211,227,35,142,112,148,130,244,148,200,231,83,190,168,176,238,34,202,11,235,163,245,246,168,26,144,82,187,149,172,99,47,43,65,181,103,192,113,206,216,243,120,29,60,113,146,199,235,78,238,172,172,117,13,171,134,247,78,137,67,112,155,110,214,121,125,147,190,201,169,225,93,213,85,148,97,65,139,96,151,98,154,15,23,30,35,138,246,11,7,182,59,44,30,
+144,149,153,61,194,137,66,101,87,62,125,69,243,192,105,214,230,241,242,215,70,233,149,169,96,226,211,16,151,154,222,166,198,86,212,74,181,220,5,160,242,9,249,163,44,161,213,99,120,154,172,33,169,240,86,126,182,98,116,234,47,148,139,245,243,249,179,243,139,95,218,197,162,176,168,88,70,246,50,99,80,130,41,176,26,22,0,216,134,197,10,43,137,62,182,12,52,65,4,174,107,9,169,95,68,138,129,84,164,131,128,194,109,212,62,195,215,112,14,69,185,32,7,24,1,215,105,64,238,19,223,199,121,215,219,65,226,96,170,92,64,26,204,12,137,9,211,210,252,56,230,159,43,194,160,135,75,43,31,72,210,5,161,32,85,170,237,63,14,77,16,139,136,34,56,254,8,61,254,44,36,71,231,128,198,99,146,38,143,219,252,36,220,108,210,123,82,227,162,179,223,86,62,192,108,248,227,147,65,245,61,61,75,77,95,81,155,99,69,138,12,102,76,92,5,100,222,63,213,130,216,137,58,50,156,92,179,243,186,40,27,150,43,211,151,25,166,5,39,7,206,68,88,245,238,194,34,216,231,85,9,149,50,206,162,91,194,136,239,36,143,34,88,154,4,159,221,145,124,68,239,200,2,37,126,181,19,214,198,199,89,173,186,5,7,94,183,204,13,237,81,18,222,117,15,94,73,139,102,95,183,71,61,222,190,105,211,72,176,137,48,35,1,203,139,151,53,1,203,19,47,195,52,100,26,73,208,144,246,56,7,13,153,195,203,29,136,2,139,220,109,43,160,39,179,153,56,27,81,171,235,89,37,101,25,27,61,78,91,182,173,57,2,179,246,8,29,144,147,53,123,168,152,221,151,207,57,133,234,137,53,192,102,253,67,8,68,198,209,56,130,93,78,10,114,216,136,245,35,158,136,14,3,12,159,65,96,206,48,151,249,36,42,11,36,165,138,27,88,209,154,25,148,147,87,99,38,54,114,218,97,198,145,154,83,83,226,241,190,81,29,175,241,102,186,23,233,20,238,220,93,246,122,33,74,158,119,192,133,125,224,146,59,248,137,96,134,236,51,151,157,93,204,225,27,122,141,28,224,195,162,77,199,130,38,132,235,135,197,25,226,118,127,101,78,184,187,235,40,11,169,124,126,96,71,81,7,88,123,79,177,155,90,146,67,70,158,22,110,24,234,160,98,183,12,219,233,40,57,68,240,172,96,67,80,7,77,179,37,216,222,17,148,69,67,158,22,37,17,37,200,75,159,191,236,109,127,201,118,80,62,127,201,221,113,146,238,164,105,115,201,223,189,145,159,79,211,168,43,159,76,110,170,223,5,66,104,11,38,229,176,209,70,29,6,69,62,104,66,235,190,137,193,38,45,14,162,203,205,52,225,142,34,88,230,177,102,194,229,29,107,216,144,176,115,19,26,27,158,8,76,103,231,144,36,170,252,50,100,129,224,145,156,19,166,23,158,32,102,122,134,23,173,207,250,167,102,69,149,145,200,24,187,94,109,36,97,97,164,242,82,116,93,26,137,10,233,120,229,240,238,137,204,64,120,34,179,179,123,179,102,142,250,6,252,34,73,151,99,123,79,129,194,222,19,247,232,124,247,26,92,160,126,13,142,127,250,62,24,63,125,47,115,72,46,144,60,36,39,121,63,79,208,29,175,53,195,239,163,104,200,61,199,145,99,172,193,208,49,214,190,3,181,238,29,75,13,212,142,165,182,175,9,4,3,231,82,165,118,133,3,181,93,225,214,235,84,120,18,211,183,124,1,115,56,70,101,79,181,187,185,205,178,19,115,220,38,232,14,40,123,254,178,99,108,59,252,85,155,107,249,1,68,253,109,155,14,241,189,50,242,29,226,5,26,193,14,63,167,191,234,36,129,248,168,114,223,213,41,249,66,184,100,188,30,71,121,164,194,220,123,17,14,120,72,16,179,129,137,60,58,62,106,138,114,198,201,201,3,251,182,64,230,61,226,193,241,17,115,195,57,95,197,120,154,240,10,126,198,119,136,95,97,211,75,126,79,215,155,162,233,9,63,136,123,130,95,171,158,152,190,86,105,174,139,10,154,94,242,123,82,69,69,123,98,250,42,66,109,90,21,97,139,86,76,79,170,168,104,79,77,95,250,164,106,83,74,159,80,93,58,233,179,84,155,163,244,25,170,203,79,250,11,215,94,55,253,101,227,172,218,173,254,178,221,94,242,123,82,95,184,219,238,202,221,234,47,221,237,37,191,39,245,197,187,237,174,222,173,254,242,221,94,242,123,82,95,192,54,170,44,196,119,103,
+234,202,94,217,250,82,216,159,34,188,166,191,166,199,117,116,147,69,145,46,194,178,245,165,176,63,69,132,77,127,77,143,209,195,78,19,29,180,188,228,246,163,136,138,246,211,244,4,97,138,38,34,104,121,201,237,71,17,17,237,167,213,211,249,115,125,76,231,207,47,5,125,169,227,34,125,49,50,254,91,86,232,106,11,104,122,201,239,73,85,91,208,158,24,125,184,212,70,133,77,47,249,61,169,106,214,101,23,85,20,111,116,81,65,211,75,126,79,170,168,104,79,77,95,215,225,82,87,61,96,211,75,126,79,138,168,202,158,152,190,54,105,154,233,194,194,182,151,130,190,84,129,209,190,142,143,170,154,64,215,224,73,179,184,22,143,244,141,182,2,108,240,245,135,79,111,242,248,38,9,145,236,188,94,16,4,244,66,94,177,43,64,213,233,165,237,68,94,40,192,97,167,183,202,169,39,121,129,68,187,20,244,41,1,142,223,231,245,166,224,34,133,177,160,191,102,89,199,144,98,143,216,243,16,82,24,171,234,147,44,239,24,210,118,159,93,164,187,244,126,2,69,161,117,7,37,211,159,6,53,177,63,62,66,93,74,138,16,234,82,177,70,200,13,55,203,4,69,83,40,111,121,206,164,14,22,203,11,78,34,97,25,51,41,122,202,254,108,9,178,242,205,16,175,206,131,191,4,175,46,90,85,248,6,58,103,223,158,174,53,80,231,205,232,121,245,106,116,102,116,118,184,187,42,225,166,50,18,12,244,211,88,151,19,38,130,221,143,79,163,28,102,169,189,50,63,33,189,198,186,212,159,6,233,94,52,13,46,51,208,28,10,195,15,229,133,143,25,249,77,48,132,77,174,43,71,188,99,238,214,204,195,123,221,142,173,112,32,29,105,57,101,197,248,124,200,237,216,30,55,54,57,190,154,89,250,105,191,233,28,57,56,140,61,174,100,198,188,107,229,190,231,224,76,126,231,22,184,179,25,107,57,109,5,121,28,58,208,185,113,46,125,161,107,158,223,114,57,229,69,135,59,95,204,97,160,197,67,141,46,221,11,85,19,253,150,199,35,47,218,220,248,98,138,145,22,13,32,49,21,69,51,253,150,199,19,47,218,220,247,98,138,161,22,13,160,198,117,26,166,90,157,247,38,26,235,121,56,80,197,92,43,242,161,174,193,158,200,141,202,38,91,158,39,39,25,237,57,56,83,219,108,171,114,231,44,134,123,14,14,85,55,221,74,92,58,205,120,79,226,84,77,243,45,203,173,51,24,112,109,142,253,78,211,128,255,192,117,245,190,107,115,233,119,51,152,111,241,64,99,75,247,157,162,241,230,141,4,3,253,52,214,229,132,137,96,247,227,211,80,51,220,63,240,156,185,239,90,92,247,221,4,179,45,234,94,137,211,212,141,182,50,191,77,51,217,179,112,157,130,193,86,227,61,77,115,61,141,3,85,141,181,52,31,78,49,213,51,112,163,174,161,86,228,200,57,204,244,12,92,169,108,164,85,56,115,146,137,158,194,157,122,6,90,146,67,167,155,103,125,46,213,141,175,127,224,58,116,223,117,188,200,239,230,136,175,7,134,26,93,58,213,248,154,55,22,14,245,211,104,167,19,38,67,6,144,152,138,162,153,230,185,108,223,181,189,195,239,166,196,215,194,1,212,184,78,195,84,171,243,222,68,99,61,15,7,170,152,107,69,62,212,53,216,19,185,81,217,100,203,243,228,36,163,61,7,103,106,155,109,85,238,156,197,112,207,193,161,234,166,91,137,75,167,25,239,73,156,170,105,190,101,185,117,6,3,174,205,177,47,116,45,56,251,42,176,134,101,94,116,248,244,197,28,22,124,96,168,177,229,123,161,106,193,121,99,225,80,63,141,118,58,97,50,100,0,137,169,168,89,112,206,72,63,17,170,141,118,170,63,21,58,128,26,215,169,91,112,13,222,155,102,193,103,226,64,5,11,174,202,135,154,22,124,42,55,170,90,112,5,158,156,98,193,103,225,76,93,11,174,204,157,115,88,240,89,56,84,217,130,171,113,233,36,11,62,141,83,245,44,184,52,183,78,183,224,250,28,251,7,93,11,254,145,235,244,253,161,195,167,127,152,195,130,15,12,53,182,124,127,80,181,224,188,177,112,168,159,70,59,157,48,25,50,128,196,84,212,44,248,71,158,91,247,135,54,255,253,97,138,5,23,14,160,198,117,234,22,92,131,247,166,89,240,153,56,80,193,130,171,242,161,166,5,159,202,141,170,22,92,129,39,167,88,240,89,56,83,215,130,43,115,231,28,
+22,124,22,14,85,182,224,106,92,58,201,130,79,227,84,61,11,46,205,173,211,45,184,58,199,246,222,224,218,174,86,41,97,213,5,111,132,192,230,228,198,116,131,232,77,253,230,148,234,237,205,121,84,228,180,130,70,209,169,93,206,14,46,37,66,120,101,124,168,110,166,52,150,118,85,189,254,225,123,82,254,128,45,143,3,95,156,109,162,228,166,184,61,9,202,101,130,175,126,9,184,4,250,242,245,51,158,69,32,143,247,214,138,212,80,39,63,33,144,144,121,65,81,119,188,100,249,136,213,81,100,199,123,245,216,42,205,204,12,87,86,38,43,71,141,147,128,116,204,27,178,72,223,167,247,81,198,31,19,63,116,231,136,79,247,223,232,19,50,47,40,218,224,35,192,149,237,90,146,245,120,127,223,237,20,198,35,79,15,143,183,199,71,234,241,122,3,102,241,86,122,180,47,240,52,251,182,76,252,136,111,200,3,226,237,194,21,190,244,42,75,247,228,165,64,253,183,76,85,60,163,52,224,123,124,122,104,64,82,92,174,174,6,63,48,110,166,52,238,103,169,113,203,242,239,67,44,219,27,117,17,228,23,248,199,40,153,47,174,86,105,194,214,152,165,32,86,183,33,150,105,192,23,135,149,53,138,105,77,159,106,193,203,21,192,31,174,227,44,47,202,239,115,169,165,144,1,71,150,68,19,92,123,181,100,48,102,90,24,63,79,197,88,174,44,23,161,220,18,203,203,211,5,222,125,82,68,153,207,176,206,242,2,168,135,112,182,197,150,151,216,9,64,85,86,124,179,11,215,29,152,228,53,243,131,132,132,54,93,134,252,49,139,118,56,46,171,88,64,97,55,22,138,124,204,162,112,117,75,190,164,101,154,169,213,58,11,190,102,251,100,85,189,8,182,122,62,165,51,204,226,155,219,2,171,6,195,135,56,43,155,228,88,222,125,19,102,55,17,214,215,13,147,126,159,156,37,209,152,234,103,206,84,95,238,188,155,169,212,170,214,190,197,232,218,182,56,111,202,202,230,38,38,156,203,174,173,212,132,63,247,38,60,97,125,205,205,87,86,110,165,204,30,180,45,45,138,72,140,251,182,164,36,65,75,161,72,51,122,187,149,45,193,150,50,175,98,90,148,124,224,55,41,212,36,95,158,59,200,77,107,51,188,145,155,163,136,186,106,144,231,17,14,69,102,226,16,211,4,81,210,29,114,174,20,35,53,92,99,193,113,77,14,85,129,200,185,108,34,130,136,88,36,63,116,45,162,192,39,40,57,102,184,196,63,85,162,192,45,61,178,204,197,43,182,245,9,9,140,242,255,138,139,219,19,150,54,187,44,186,142,31,154,47,78,57,89,79,74,143,31,201,147,45,254,128,207,16,237,68,171,95,57,203,48,60,30,169,129,58,60,210,170,99,214,90,131,117,71,131,37,161,99,117,130,185,253,117,107,118,1,55,171,91,198,198,228,89,38,152,35,159,133,243,27,30,145,53,86,194,177,90,51,236,14,215,163,103,20,102,171,238,104,43,185,196,36,252,254,133,52,103,134,35,159,201,171,79,66,0,189,44,51,74,65,245,130,150,93,154,199,248,46,214,69,240,236,28,25,16,95,4,115,141,25,0,222,82,243,161,177,52,24,2,213,38,195,20,92,61,85,112,53,133,106,159,57,100,251,28,221,69,248,146,152,124,70,242,9,81,142,16,240,51,159,130,179,64,236,75,51,54,174,54,135,8,64,250,214,199,126,169,91,142,42,253,26,198,27,110,94,188,128,31,130,252,103,218,213,217,89,242,11,155,222,132,31,158,227,119,92,229,34,130,67,223,69,52,4,164,67,44,117,44,61,48,21,109,187,170,0,53,32,107,121,240,13,174,235,232,65,138,100,117,167,172,134,40,191,10,202,210,185,176,120,229,219,77,126,38,99,45,200,191,127,164,70,224,23,101,164,196,151,162,8,145,138,199,71,227,224,58,26,108,42,190,125,18,175,210,117,244,178,104,153,140,64,64,53,142,72,252,215,235,219,236,101,209,174,31,31,6,101,183,77,98,46,56,9,243,0,12,39,97,150,214,155,193,106,169,224,48,221,32,58,134,239,132,184,90,212,154,6,141,187,178,113,177,47,162,22,184,60,35,90,100,177,206,201,123,117,22,224,210,145,23,100,137,19,196,117,63,253,165,37,95,151,126,74,186,162,111,48,161,27,123,79,97,156,167,193,242,241,248,232,41,140,244,244,44,8,222,93,95,7,232,63,130,119,179,14,94,4,69,182,71,47,39,70,215,229,248,168,254,
+225,254,54,222,68,101,235,21,76,122,25,81,13,84,191,197,14,144,225,91,95,42,213,245,46,9,210,108,141,110,79,138,21,254,193,227,41,240,25,128,146,35,175,145,58,164,108,11,178,211,184,79,54,241,54,134,225,142,143,242,248,247,104,81,226,66,138,226,187,107,147,205,99,176,38,47,178,5,200,128,132,32,68,93,200,40,77,178,121,154,23,173,173,202,227,176,128,197,217,173,50,166,86,58,97,133,147,93,88,124,139,223,131,92,113,94,211,246,227,235,207,111,201,115,13,117,203,23,172,5,229,54,245,162,124,221,37,125,241,90,180,174,23,62,56,1,93,254,28,95,250,151,52,218,186,245,130,37,210,162,122,17,212,174,124,153,82,235,221,130,56,60,121,138,241,173,162,108,19,188,78,183,240,124,188,132,245,248,28,221,236,193,189,12,222,62,236,176,9,14,92,109,160,147,150,100,215,231,38,140,147,188,217,247,99,65,196,114,40,226,14,140,215,97,30,109,200,143,51,227,193,126,234,133,33,152,68,235,82,61,217,128,122,159,130,131,142,35,182,82,245,63,126,250,242,238,191,213,64,0,211,109,194,85,4,43,24,223,196,9,129,81,193,193,159,200,31,215,155,240,166,124,61,0,251,250,43,68,86,54,191,186,207,194,29,107,189,200,183,193,85,184,217,92,149,236,66,120,254,31,79,74,112,255,120,130,178,244,143,39,116,88,124,111,22,124,67,78,41,252,227,73,217,39,118,245,143,39,103,199,71,193,143,160,131,182,248,182,105,248,145,96,129,103,195,213,42,218,145,183,111,227,171,241,8,192,224,105,252,116,17,60,221,226,63,57,252,67,94,119,249,240,20,123,8,130,167,209,211,111,209,155,192,165,138,208,160,128,88,71,219,93,241,88,105,49,144,57,140,192,99,16,99,96,109,16,228,37,190,186,235,46,220,196,37,251,210,110,226,78,55,72,124,42,39,233,46,202,200,225,10,152,24,110,50,63,3,154,71,9,74,200,29,60,2,202,20,128,28,125,170,222,23,184,168,31,235,61,132,195,108,165,134,217,130,74,137,159,109,226,164,213,54,151,106,251,143,39,235,180,120,6,11,244,143,39,164,217,215,230,69,100,148,181,242,154,183,144,186,61,61,248,143,39,248,130,50,212,39,225,46,102,250,192,167,33,222,43,200,62,211,54,124,196,70,149,98,165,0,63,166,244,181,137,245,83,36,88,132,5,90,180,87,176,90,192,32,204,96,41,240,213,136,81,57,114,201,4,180,59,246,53,178,37,235,172,235,87,194,129,98,34,46,100,205,132,4,63,165,9,229,189,112,195,219,181,174,248,154,200,149,33,225,168,229,246,170,90,158,127,9,200,191,4,228,64,4,4,231,117,245,219,62,109,94,39,212,229,126,242,99,47,162,9,201,111,181,141,170,82,222,248,114,229,10,1,14,29,102,55,123,210,46,122,0,247,115,243,216,126,199,233,111,155,11,28,191,54,156,81,190,226,99,168,158,228,29,12,250,242,183,247,193,38,254,53,170,177,16,233,106,114,86,208,105,184,99,61,96,176,202,105,7,127,155,36,130,119,59,17,82,197,73,204,248,173,239,224,83,12,146,243,123,68,126,37,135,71,225,191,173,23,56,49,239,211,60,155,209,74,179,239,204,222,220,68,203,44,60,67,42,116,220,162,69,80,211,20,252,163,128,237,12,159,254,230,82,166,19,126,219,139,126,91,112,26,175,212,64,64,11,1,14,65,95,194,46,56,112,98,53,44,177,0,73,44,5,35,30,160,73,172,76,148,120,128,42,177,44,89,42,72,204,177,71,26,79,176,209,29,225,87,150,47,217,100,42,143,55,153,220,106,43,192,99,25,20,179,218,37,147,54,99,151,115,104,15,223,97,59,38,238,229,208,169,202,118,214,19,125,245,242,107,197,142,151,74,189,142,116,118,193,237,141,97,73,61,156,37,171,170,119,62,222,39,31,113,60,9,110,44,4,27,235,32,141,135,41,27,79,37,109,60,72,219,88,147,184,181,16,241,20,37,70,148,171,162,149,39,12,152,51,222,253,25,44,136,43,20,223,36,105,22,225,136,232,158,21,49,201,153,4,77,187,227,174,174,165,227,92,176,105,108,252,2,157,133,224,54,10,215,232,190,237,163,188,29,69,198,201,110,95,224,76,72,142,246,254,54,166,187,68,199,71,36,19,73,90,160,51,248,143,39,56,2,120,154,141,201,60,1,155,250,44,47,30,55,209,105,109,85,201,235,2,210,236,248,168,238,136,25,153,230,107,
+234,243,104,100,128,18,75,185,137,69,192,28,31,1,26,112,102,222,17,100,48,118,24,172,193,41,140,158,97,79,224,204,192,175,224,201,236,11,225,175,212,182,199,9,204,161,26,166,11,132,142,42,156,59,24,102,234,244,221,198,187,224,54,221,172,243,51,234,206,149,195,98,19,24,58,79,51,76,32,165,204,124,72,255,45,71,97,140,19,240,160,254,48,51,40,44,254,55,156,129,99,43,35,159,207,49,101,133,241,254,199,44,51,85,24,240,223,5,19,252,103,26,39,39,27,102,180,140,249,187,162,100,190,97,134,207,51,230,67,18,111,174,74,95,152,136,122,148,23,152,147,138,200,43,18,131,19,230,73,230,86,72,13,241,253,187,255,124,139,0,26,153,255,143,52,110,157,246,135,70,193,251,198,219,173,4,21,191,254,124,76,190,78,119,200,234,224,248,215,87,70,200,141,145,60,248,242,158,200,243,151,207,101,254,188,106,91,250,202,229,0,111,191,188,62,38,215,56,82,146,125,34,170,43,96,162,56,156,219,217,241,87,18,142,144,172,40,8,14,222,193,0,135,248,38,137,104,238,152,226,131,169,17,229,84,167,178,178,244,62,231,202,82,236,156,240,239,124,165,124,43,204,54,65,251,81,210,155,230,245,115,45,134,48,206,8,231,253,27,68,91,124,219,12,115,235,10,63,30,55,9,219,205,25,201,88,236,54,209,195,9,60,69,125,231,21,13,248,194,111,195,228,241,236,236,236,180,252,111,115,221,233,229,199,119,223,127,122,255,38,139,182,225,238,67,213,158,233,151,14,100,164,107,210,111,152,196,215,96,17,123,221,6,77,191,132,76,240,225,151,94,215,17,218,71,242,78,220,62,173,10,102,164,36,186,175,52,56,244,115,117,241,75,171,95,248,204,244,252,117,23,174,216,219,94,209,53,102,128,194,224,67,148,221,68,193,203,60,79,87,49,77,159,127,13,49,147,127,2,77,78,207,130,239,209,45,90,66,211,234,200,12,118,83,230,132,224,225,99,178,193,81,238,22,225,139,149,55,32,47,236,189,79,124,252,132,162,25,3,247,19,241,187,26,136,31,128,2,89,153,17,192,145,225,177,224,4,132,143,250,103,167,85,238,1,188,140,222,128,154,68,225,141,40,30,229,93,2,225,30,54,108,15,183,216,197,209,42,42,223,91,60,48,108,221,188,125,140,11,243,86,113,245,19,40,61,88,113,50,154,236,232,43,246,211,220,0,58,220,184,9,147,155,125,120,19,49,208,144,5,170,236,87,43,227,243,250,195,27,252,237,75,103,163,252,109,201,234,200,137,47,223,215,219,167,89,122,147,133,219,51,230,62,40,233,120,75,101,73,220,253,247,251,132,236,101,95,118,1,49,135,166,120,237,96,121,185,152,74,32,128,43,205,104,34,145,176,2,11,44,79,247,25,132,251,2,80,40,202,223,199,27,38,219,70,5,142,58,214,208,100,191,162,121,211,102,4,26,117,0,121,107,163,72,247,111,11,150,44,221,119,180,103,97,156,71,39,219,252,166,220,46,195,243,40,44,14,242,59,147,121,196,143,36,157,253,128,41,113,20,251,77,184,140,80,122,33,42,193,113,195,58,177,27,108,161,15,88,101,28,182,51,106,152,231,81,86,156,220,17,139,0,212,216,114,136,0,203,74,31,123,21,23,226,14,242,219,241,14,190,220,14,116,128,39,34,198,58,120,151,12,116,0,118,108,180,131,247,248,154,112,225,20,128,53,71,167,128,87,101,69,29,64,139,209,14,62,197,235,186,131,58,156,172,58,64,57,63,95,236,146,112,27,17,52,168,166,201,31,192,132,84,9,136,186,253,154,161,21,99,78,78,146,111,145,45,138,168,220,76,175,70,3,7,44,188,222,164,247,39,237,109,98,232,138,28,25,121,83,254,220,244,245,149,225,96,80,23,25,198,159,203,77,10,102,4,76,70,244,16,173,246,24,30,82,23,174,234,28,183,85,138,44,221,156,181,140,9,60,242,43,157,38,209,233,221,169,220,132,217,18,248,20,159,106,70,255,41,4,141,14,6,45,47,183,103,90,251,53,55,17,217,83,160,70,44,139,111,110,34,162,126,202,142,224,217,13,198,52,120,142,227,248,239,121,35,157,53,74,50,13,210,115,136,96,130,40,204,54,143,224,69,110,34,116,50,107,91,117,214,86,222,121,94,173,213,41,11,31,127,96,146,242,16,136,239,88,21,129,163,172,227,28,176,173,137,178,64,128,244,80,70,22,65,80,157,208,61,3,6,220,154,156,9,
+142,146,213,35,59,60,129,92,202,203,125,77,74,118,119,125,29,145,103,214,189,133,124,69,22,13,15,111,220,65,16,31,46,193,157,44,30,201,201,171,13,134,244,21,157,239,233,46,90,129,68,197,57,97,139,59,22,66,22,221,128,255,30,101,172,58,95,224,209,26,242,199,109,180,217,241,117,105,213,174,82,242,21,178,39,120,0,1,9,65,116,37,30,209,105,110,13,160,81,161,155,151,180,109,128,169,93,76,135,92,151,157,180,15,138,116,12,92,30,110,65,44,216,141,135,253,114,143,158,93,182,101,204,46,214,34,64,47,152,19,28,127,121,249,225,199,247,111,203,38,221,141,31,186,173,83,197,20,228,128,17,62,86,142,138,223,225,33,152,32,127,50,14,96,199,188,61,80,12,0,95,200,167,9,226,69,112,178,11,30,128,186,123,244,56,78,79,23,40,52,224,41,60,199,23,6,236,240,159,243,179,231,28,23,1,131,183,45,116,144,145,159,42,14,168,191,61,3,103,11,68,37,63,105,111,208,124,250,241,43,166,188,119,216,76,220,166,242,173,131,210,185,22,245,193,168,53,108,9,188,176,77,65,48,155,30,159,8,192,173,210,40,91,161,117,86,130,215,180,82,7,248,87,88,99,228,187,152,16,191,120,196,205,182,170,59,49,202,237,54,77,190,130,225,80,197,217,180,67,164,212,122,16,172,165,173,24,67,251,154,244,128,60,249,44,106,14,252,52,100,229,195,173,75,110,168,161,109,154,113,201,26,12,34,253,16,102,191,118,242,7,141,198,34,132,237,143,120,151,110,160,69,170,132,178,106,163,1,241,75,12,193,40,130,43,251,8,72,210,184,52,144,64,87,1,74,114,69,38,76,10,213,181,175,90,105,32,125,179,223,109,98,114,25,162,234,70,32,82,253,113,193,131,69,215,54,83,2,91,55,210,192,250,154,154,112,116,157,119,232,209,144,221,252,140,70,178,101,183,98,185,202,139,15,96,77,54,138,148,173,90,169,75,255,219,50,167,82,26,178,188,172,91,81,229,217,129,190,141,152,137,80,51,238,153,60,232,186,145,58,230,55,181,47,148,65,144,24,21,212,0,199,201,63,169,227,36,132,25,133,107,124,82,13,102,213,72,3,38,110,107,16,104,163,90,159,156,240,89,198,201,90,9,91,211,74,99,221,171,128,179,60,92,20,21,204,66,231,103,34,160,255,140,11,37,136,248,188,58,184,31,65,114,194,27,34,237,157,252,43,120,195,255,220,231,197,179,56,121,134,37,130,170,145,194,161,117,175,82,91,106,180,173,26,77,32,109,173,170,24,202,130,103,186,138,132,228,45,163,128,82,131,164,106,58,171,215,88,29,250,15,237,40,4,180,214,152,118,189,222,231,106,132,37,13,212,145,125,15,205,240,16,80,76,207,123,149,239,95,14,192,158,22,183,219,168,136,87,85,214,12,99,58,176,97,119,4,62,140,184,238,42,48,14,225,162,4,115,139,170,228,174,91,169,207,230,75,244,219,158,156,142,175,59,25,37,52,52,200,30,55,233,141,18,198,186,145,58,196,202,138,225,249,44,210,13,94,3,41,64,8,227,85,206,212,44,99,156,237,58,218,172,78,79,213,253,215,15,93,149,191,113,143,96,145,160,128,165,66,119,62,253,89,212,35,252,237,211,215,234,169,166,239,79,229,55,108,98,169,78,35,139,68,48,78,240,156,162,18,149,203,38,26,154,226,97,71,239,5,144,163,145,85,120,152,139,29,153,210,194,193,111,183,170,238,12,219,84,29,41,217,66,195,182,84,169,97,126,32,109,173,81,181,223,211,25,105,211,4,140,130,13,136,151,239,127,104,183,97,162,197,20,188,80,32,12,200,245,45,13,82,254,89,193,168,182,253,73,184,18,130,155,242,152,211,253,0,88,92,76,175,64,48,190,250,245,81,168,103,183,225,42,75,79,10,188,36,91,84,196,160,159,106,138,180,50,1,64,18,210,132,229,91,178,102,117,248,95,30,92,160,157,180,34,125,209,232,221,109,154,25,208,132,221,241,131,125,94,165,144,107,9,104,101,33,250,224,210,108,21,110,213,72,67,154,176,96,232,13,67,130,17,93,222,21,60,7,26,14,157,224,42,41,87,129,224,210,135,66,152,68,159,33,72,192,246,49,189,247,81,159,140,41,15,190,5,101,26,186,38,31,230,233,197,76,132,89,245,2,195,57,37,89,100,154,169,203,225,231,40,79,55,119,148,239,232,169,106,210,83,176,198,189,181,184,24,138,217,183,113,145,130,144,168,
+97,45,219,168,3,133,120,36,190,126,164,65,207,38,36,153,68,176,195,155,52,198,157,157,12,55,237,54,21,107,144,27,84,229,33,113,76,65,172,210,76,24,32,55,155,167,253,53,231,229,10,48,71,71,57,175,110,73,4,162,217,5,17,136,129,112,151,118,214,113,185,202,161,32,251,137,74,203,84,182,81,95,166,191,39,25,216,249,234,232,253,89,123,167,85,128,240,159,121,154,168,5,1,216,192,4,54,206,88,89,180,222,175,212,4,178,108,162,35,140,216,176,60,89,130,232,72,165,169,96,181,9,227,109,46,6,184,13,119,138,248,176,133,14,60,104,183,35,53,4,89,125,70,247,14,202,146,17,53,119,210,212,84,82,12,192,78,139,232,111,224,8,198,138,89,180,118,75,171,42,47,139,200,125,80,69,184,180,141,14,80,122,251,116,249,200,217,16,137,75,149,198,117,236,246,249,109,121,56,78,201,169,107,154,105,132,216,208,56,160,173,243,96,157,222,163,219,94,121,97,66,122,166,155,66,141,117,73,3,117,112,239,72,42,135,172,248,167,247,95,127,12,112,19,136,238,209,227,85,221,248,46,18,39,40,238,55,43,37,132,248,252,36,128,247,105,246,235,38,197,76,79,184,43,246,89,244,140,248,18,143,50,88,119,105,94,92,199,15,106,139,94,182,209,88,113,218,178,54,201,139,232,236,230,44,64,38,42,143,63,176,171,207,134,14,205,93,152,238,78,75,92,208,224,149,217,44,234,157,15,90,144,205,156,234,200,22,238,120,183,78,139,52,199,181,190,126,134,182,175,111,247,236,78,234,235,44,34,135,34,146,122,40,234,162,193,60,192,156,222,100,97,66,182,204,96,0,114,199,170,125,158,46,12,238,226,232,190,117,84,46,137,30,138,49,120,193,0,190,135,162,3,240,199,44,173,109,0,254,28,172,240,119,98,248,27,239,166,229,98,244,8,4,227,222,146,125,248,160,40,55,65,216,49,151,251,228,93,57,245,214,168,216,53,25,21,30,192,164,82,132,106,7,255,83,22,87,0,242,148,229,1,200,46,49,81,153,29,28,93,82,140,2,249,8,77,6,166,14,79,240,38,222,162,125,94,68,59,50,198,38,204,11,252,227,244,91,214,155,42,137,124,5,223,93,6,156,150,120,100,131,180,132,63,78,241,159,94,75,248,142,219,18,247,158,73,75,114,70,138,221,123,174,90,194,119,220,150,200,19,164,37,217,111,133,127,122,45,225,59,110,203,235,77,57,38,252,113,138,255,244,90,194,119,220,150,235,229,134,182,36,91,172,184,133,218,109,9,223,5,204,38,227,250,46,76,86,229,165,189,182,168,132,165,176,144,99,1,253,141,231,230,16,36,230,211,24,254,136,115,144,254,180,226,144,229,240,251,73,222,125,249,127,223,126,254,196,186,110,97,246,72,139,21,17,150,192,174,130,244,46,202,122,247,11,160,49,19,3,246,7,149,172,185,63,9,192,232,155,36,218,176,128,197,236,211,2,7,245,144,22,108,193,21,107,180,32,229,114,252,163,5,190,252,192,58,45,112,80,15,105,1,138,205,62,45,112,80,15,105,1,170,218,62,45,112,80,167,180,96,112,37,241,134,61,57,52,8,229,227,187,247,98,36,9,14,45,67,137,206,136,210,132,208,30,93,130,37,146,180,80,34,196,167,175,195,104,72,119,146,228,232,13,45,79,145,105,48,198,217,3,58,168,237,125,60,168,52,0,10,183,50,219,171,52,221,68,164,38,22,73,242,50,51,239,244,45,251,254,30,185,113,70,151,156,29,157,117,159,224,239,161,17,41,133,1,23,150,223,32,133,156,36,214,184,51,22,119,166,179,141,171,50,115,214,89,194,191,77,206,92,228,35,205,55,174,202,204,133,181,232,12,204,92,228,17,205,55,174,202,204,89,71,168,245,70,40,3,51,23,249,63,243,141,59,174,194,242,248,38,145,148,244,47,239,126,248,216,5,129,205,131,147,103,231,139,231,139,243,83,153,233,119,199,147,148,118,253,177,71,23,159,69,212,10,143,44,80,64,24,25,57,163,64,43,40,178,64,1,97,60,228,140,2,173,80,200,2,5,132,81,144,51,10,180,2,32,11,20,16,198,62,206,40,208,10,123,44,80,64,24,241,88,161,64,115,16,102,153,75,218,130,151,175,190,116,65,64,99,153,105,119,198,144,156,181,226,120,163,139,205,160,24,241,242,102,153,169,130,119,103,112,166,35,94,221,44,51,85,240,230,12,206,116,196,139,155,101,166,10,222,155,193,153,
+178,186,26,255,54,49,83,145,126,158,62,158,202,76,89,157,140,127,155,152,169,72,15,79,31,111,92,249,62,147,13,184,223,254,208,29,56,137,110,100,38,250,76,39,204,86,27,109,116,65,159,201,6,215,211,103,169,18,82,155,154,229,88,32,61,125,150,42,225,179,169,89,142,5,205,211,103,169,18,42,155,154,229,136,170,157,97,150,10,138,214,216,44,71,212,236,12,179,84,80,178,115,205,178,6,241,199,63,74,106,217,119,31,95,127,238,14,93,151,249,144,153,110,123,36,73,109,171,55,234,232,226,54,88,70,180,238,140,179,86,208,190,198,103,61,162,133,103,156,181,130,54,54,62,235,17,173,60,227,172,21,180,179,241,89,143,104,233,25,103,173,160,173,141,207,122,68,107,207,56,107,5,237,61,243,172,27,75,34,235,42,191,121,219,7,176,142,20,166,253,76,199,101,214,27,117,220,66,203,186,206,51,206,90,65,137,27,159,245,136,18,159,113,214,10,74,220,248,172,71,148,248,140,179,86,80,226,198,103,61,162,196,103,156,181,130,18,55,62,235,17,37,62,227,172,21,148,248,204,179,110,202,62,198,201,201,242,188,57,195,123,254,203,98,121,193,126,60,13,216,79,29,84,31,222,125,236,157,115,168,135,133,174,227,237,126,219,148,101,38,111,41,221,133,113,134,31,72,125,230,156,33,203,40,18,30,165,236,160,106,161,168,138,96,57,71,224,140,30,213,248,75,103,124,194,69,96,149,30,44,156,171,36,189,34,135,163,166,200,81,217,201,52,96,139,128,20,150,199,219,24,73,85,176,188,67,59,41,176,42,164,180,14,92,71,26,189,0,233,51,85,181,100,218,11,144,222,80,149,41,165,252,48,69,23,188,252,239,1,124,225,131,146,174,28,67,34,79,188,185,81,169,75,177,13,4,206,232,161,33,127,54,16,88,165,7,11,103,6,155,250,242,191,199,197,93,2,216,168,126,146,4,171,66,74,235,192,117,164,209,11,144,62,83,85,75,166,189,0,233,13,85,153,36,107,45,93,36,7,88,201,22,155,122,228,29,15,120,243,38,74,54,88,232,165,135,239,213,121,240,199,224,213,197,130,84,119,14,147,34,194,51,188,36,146,166,133,1,31,203,151,36,35,38,210,67,70,74,5,177,217,88,49,36,217,211,11,163,240,184,17,252,52,204,12,202,59,252,143,38,62,128,247,211,188,64,102,32,26,130,154,159,100,20,221,114,42,199,253,132,43,58,47,144,233,36,35,160,230,34,153,138,180,242,142,45,121,36,173,90,240,44,74,171,34,62,59,210,170,1,202,162,180,170,161,179,36,173,26,160,92,72,43,239,56,165,71,210,170,5,207,162,180,42,226,179,35,173,26,160,44,74,171,26,58,75,210,170,1,202,133,180,242,142,121,123,36,173,90,240,44,74,171,34,62,59,210,170,1,202,162,180,170,161,179,36,173,26,160,92,72,43,239,250,137,71,210,170,5,207,162,180,42,226,179,35,173,26,160,44,74,171,26,58,75,210,170,1,202,133,180,242,174,197,189,121,131,119,255,194,141,88,88,233,239,65,148,101,88,168,61,169,81,233,139,165,14,14,1,189,36,192,193,64,87,73,74,158,208,37,145,152,56,245,18,173,194,125,14,168,62,190,123,95,23,27,83,2,32,79,39,69,10,201,32,28,80,81,106,107,69,53,148,28,199,200,232,34,245,209,103,226,19,53,114,136,8,161,204,29,250,52,81,162,134,28,79,8,117,176,210,170,148,42,88,138,39,164,148,173,250,232,243,240,132,34,57,68,132,80,229,137,9,52,81,162,198,16,174,49,69,207,158,39,246,100,43,67,116,240,216,203,173,12,44,232,233,197,86,6,150,24,61,136,173,12,125,142,155,217,37,156,135,207,172,186,132,44,237,60,217,202,16,81,209,203,173,12,70,90,221,110,101,8,164,213,191,173,12,125,142,179,36,173,30,111,101,176,180,243,100,43,67,68,69,47,183,50,24,105,117,187,149,33,144,86,255,182,50,244,57,206,146,180,122,188,149,193,210,206,147,173,12,17,21,189,220,202,96,164,213,237,86,134,64,90,253,219,202,208,231,56,75,210,234,241,86,198,88,229,46,147,201,81,149,138,94,14,147,163,227,36,50,156,28,85,163,147,133,228,40,163,162,212,214,74,59,57,42,208,69,234,163,155,72,142,142,146,195,76,114,84,137,38,166,147,163,218,122,68,59,57,58,139,246,48,149,28,213,208,25,115,36,71,39,106,10,83,201,81,182,236,128,39,
+201,81,81,125,2,47,147,163,248,206,34,47,146,163,248,22,165,131,72,142,234,115,220,204,46,225,60,124,102,213,37,100,105,231,73,114,84,68,69,47,147,163,140,180,186,77,142,10,164,213,191,228,168,62,199,89,146,86,143,147,163,44,237,60,73,142,138,168,232,101,114,148,145,86,183,201,81,129,180,250,151,28,213,231,56,75,210,234,113,114,116,172,124,184,201,116,139,74,89,113,135,233,150,113,18,25,78,183,168,209,201,66,186,133,81,81,106,107,165,157,110,17,232,34,245,209,77,164,91,70,201,97,38,221,162,68,19,211,233,22,109,61,162,157,110,153,69,123,152,74,183,104,232,140,57,210,45,19,53,133,169,116,11,91,239,208,147,116,139,168,48,162,151,233,22,242,50,112,31,210,45,248,234,233,131,72,183,232,115,220,204,46,225,60,124,102,213,37,100,105,231,73,186,69,68,69,47,211,45,140,180,186,77,183,8,164,213,191,116,139,62,199,89,146,86,143,211,45,99,111,69,50,25,192,169,188,45,201,97,0,55,78,34,195,1,156,26,157,44,4,112,140,138,82,91,43,237,0,78,160,139,212,71,55,17,192,141,146,195,76,0,167,68,19,211,1,156,182,30,209,14,224,102,209,30,166,2,56,13,157,49,71,0,55,81,83,152,10,224,216,210,237,158,4,112,162,26,239,94,6,112,0,214,143,0,14,128,28,70,0,167,207,113,51,187,132,243,240,153,85,151,112,236,245,145,38,93,66,149,215,74,58,116,9,199,73,100,216,37,84,163,147,5,151,144,81,81,106,107,165,237,18,10,116,145,250,232,38,92,194,81,114,152,113,9,149,104,98,218,37,212,214,35,218,46,225,44,218,195,148,75,168,161,51,230,112,9,39,106,10,83,46,225,216,155,123,77,26,25,149,55,250,58,52,50,227,36,50,108,100,212,232,100,193,200,192,192,122,107,165,109,100,96,152,233,156,98,202,200,140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,98,70,35,67,110,12,248,85,143,189,7,201,255,188,3,129,236,67,61,246,6,136,199,121,7,188,184,228,69,61,246,14,16,255,243,14,66,105,117,183,113,44,37,173,126,109,28,247,165,213,209,198,241,176,180,122,178,113,44,144,86,251,27,199,18,210,234,215,198,177,80,90,221,157,211,151,146,86,191,206,233,247,165,213,209,57,253,97,105,245,228,156,190,64,90,237,159,211,151,144,86,191,206,233,11,165,213,93,17,19,41,105,245,171,136,73,95,90,29,21,49,25,150,86,79,138,152,8,164,213,126,17,19,9,105,245,171,136,137,80,90,45,20,49,145,18,75,247,69,76,20,73,52,127,114,116,2,157,76,38,71,251,42,202,116,17,147,97,93,228,184,136,137,44,57,102,78,142,234,208,196,72,114,84,160,131,13,22,49,145,80,182,238,138,152,40,145,99,190,228,168,54,77,172,37,71,253,168,240,220,131,116,48,201,81,247,21,158,27,32,135,145,28,117,91,225,185,3,228,192,146,163,126,84,120,150,146,86,47,147,163,238,43,60,15,75,171,127,201,81,183,21,158,37,164,213,227,228,168,31,21,158,165,164,213,203,228,168,251,10,207,195,210,234,95,114,212,109,133,103,9,105,245,56,57,234,71,133,103,41,105,245,50,57,234,190,194,243,176,180,250,151,28,117,91,225,89,66,90,61,78,142,90,174,240,44,37,150,158,37,71,93,84,120,158,64,39,11,201,81,139,21,158,135,117,145,31,201,81,219,21,158,117,104,98,58,57,106,169,194,179,132,178,245,34,57,106,179,194,179,54,77,172,37,71,253,168,240,220,131,116,48,201,81,247,21,158,27,32,135,145,28,117,91,225,185,3,228,192,146,163,126,84,120,150,146,86,47,147,163,238,43,60,15,75,171,127,201,81,183,21,158,37,164,213,227,228,168,31,21,158,165,164,213,203,228,168,251,10,207,195,210,234,95,114,212,109,133,103,9,105,245,56,57,106,185,194,179,148,88,186,175,240,172,72,34,195,233,22,127,42,60,247,85,148,233,10,207,195,186,200,113,133,103,89,114,152,73,183,184,175,240,44,208,193,6,43,60,75,40,91,119,21,158,149,200,97,36,221,226,79,133,231,150,2,243,163,194,115,15,210,193,164,91,220,87,120,110,128,28,70,186,197,109,133,231,14,144,3,75,183,248,81,225,89,74,90,189,76,183,184,175,240,60,44,173,254,165,91,220,86,120,150,144,86,143,
+211,45,150,43,60,75,137,165,251,10,207,138,36,50,28,192,249,83,225,185,175,162,76,87,120,30,214,69,142,43,60,203,146,195,76,0,231,190,194,179,64,7,27,172,240,44,161,108,221,85,120,86,34,135,145,0,206,159,10,207,45,5,230,71,133,231,30,164,131,9,224,220,87,120,110,128,28,70,0,231,182,194,115,7,200,129,5,112,150,43,60,75,137,165,251,10,207,138,36,50,236,18,250,83,225,185,175,162,76,87,120,30,214,69,142,43,60,203,146,195,140,75,232,190,194,179,64,7,27,172,240,44,161,108,221,85,120,86,34,135,17,151,208,159,10,207,45,5,102,185,194,115,111,108,63,43,60,43,146,200,176,145,241,167,194,115,169,222,44,86,120,110,70,244,176,194,179,44,57,204,24,25,247,21,158,25,245,102,169,194,115,103,68,191,42,60,43,145,195,136,145,241,167,194,51,217,194,246,171,194,115,15,146,255,121,7,2,217,135,10,207,13,16,143,243,14,120,146,198,139,10,207,29,32,254,231,29,132,210,234,110,227,88,74,90,253,218,56,238,75,171,163,141,227,97,105,245,100,227,88,32,173,246,55,142,37,164,213,175,141,99,161,180,186,59,167,47,37,173,126,157,211,239,75,171,163,115,250,195,210,234,201,57,125,129,180,218,63,167,47,33,173,126,157,211,23,74,171,133,115,250,82,98,233,254,156,190,34,137,230,79,183,76,160,147,201,116,75,95,69,153,62,167,63,172,139,28,159,211,151,37,199,204,233,22,29,154,24,73,183,8,116,176,193,115,250,18,202,214,221,57,125,37,114,204,151,110,209,166,137,181,116,139,31,53,99,123,144,14,38,221,226,190,102,108,3,228,48,210,45,110,107,198,118,128,28,88,186,197,143,154,177,82,210,234,101,186,197,125,205,216,97,105,245,47,221,226,182,102,172,132,180,122,156,110,241,163,102,172,148,180,122,153,110,113,95,51,118,88,90,253,75,183,184,173,25,43,33,173,30,167,91,198,43,120,154,75,183,168,21,237,116,150,110,25,39,145,225,116,139,26,157,44,164,91,70,11,229,206,158,110,81,170,136,107,59,221,50,74,14,51,233,22,37,154,152,78,183,104,235,17,237,116,203,44,218,195,84,186,69,67,103,204,145,110,153,168,41,76,165,91,252,168,66,217,131,116,48,233,22,247,85,40,27,32,135,145,110,113,91,133,178,3,228,192,210,45,126,84,161,148,146,86,47,211,45,238,171,80,14,75,171,127,233,22,183,85,40,37,164,213,227,116,139,31,85,40,165,164,213,203,116,139,251,42,148,195,210,234,95,186,197,109,21,74,9,105,245,56,221,98,185,10,165,148,88,122,150,110,113,81,133,114,2,157,44,164,91,44,86,161,28,214,69,126,164,91,108,87,161,212,161,137,233,116,139,165,42,148,18,202,214,139,116,139,205,42,148,218,52,177,150,110,241,163,10,101,15,210,193,164,91,220,87,161,108,128,28,70,186,197,109,21,202,14,144,3,75,183,248,81,133,82,74,90,189,76,183,184,175,66,57,44,173,254,165,91,220,86,161,148,144,86,143,211,45,150,171,80,74,137,165,251,42,148,138,36,50,28,192,249,83,133,178,175,162,76,87,161,28,214,69,142,171,80,202,146,195,76,0,231,190,10,165,64,7,27,172,66,41,161,108,221,85,161,84,34,135,145,0,206,159,42,148,45,5,230,71,21,202,30,164,131,9,224,220,87,161,108,128,28,70,0,231,182,10,101,7,200,129,5,112,150,171,80,74,137,165,251,42,148,138,36,50,236,18,250,83,133,178,175,162,76,87,161,28,214,69,142,171,80,202,146,195,140,75,232,190,10,165,64,7,27,172,66,41,161,108,221,85,161,84,34,135,17,151,208,159,42,148,45,5,102,185,10,101,111,108,63,171,80,42,146,200,176,145,241,167,10,101,169,222,44,86,161,108,70,244,176,10,165,44,57,204,24,25,247,85,40,25,245,102,169,10,101,103,68,191,170,80,42,145,195,136,145,241,167,10,37,201,128,248,85,133,178,7,201,255,188,3,129,236,67,21,202,6,136,199,121,7,76,196,122,81,133,178,3,196,255,188,131,80,90,221,109,28,75,73,171,95,27,199,125,105,117,180,113,60,44,173,158,108,28,11,164,213,254,198,177,132,180,250,181,113,44,148,86,11,27,199,82,98,233,126,227,88,145,68,243,7,112,19,232,100,50,128,235,171,40,211,27,199,195,186,200,241,198,177,44,57,102,14,224,116,104,98,36,128,19,232,96,131,27,199,
+18,202,214,221,198,177,18,57,230,11,224,180,105,98,45,128,243,163,174,93,15,210,193,4,112,238,235,218,53,64,14,35,128,115,91,215,174,3,228,192,2,56,63,234,218,73,73,171,151,1,156,251,186,118,195,210,234,95,0,231,182,174,157,132,180,122,28,192,141,87,25,51,23,192,169,21,22,115,22,192,141,147,200,112,0,167,70,39,11,1,220,104,49,191,217,3,56,165,170,125,182,3,184,81,114,152,9,224,148,104,98,58,128,211,214,35,218,1,220,44,218,195,84,0,167,161,51,230,8,224,38,106,10,83,1,156,31,149,178,122,144,14,38,128,115,95,41,171,1,114,24,1,156,219,74,89,29,32,7,22,192,249,81,41,75,74,90,189,12,224,220,87,202,26,150,86,255,2,56,183,149,178,36,164,213,227,0,110,188,110,145,185,0,78,173,84,145,179,0,110,156,68,134,3,56,53,58,89,8,224,70,203,131,205,30,192,41,213,1,179,29,192,141,146,195,76,0,167,68,19,211,1,156,182,30,209,14,224,102,209,30,166,2,56,13,157,49,71,0,55,81,83,152,10,224,252,168,189,211,131,116,48,1,156,251,218,59,13,144,195,8,224,220,214,222,233,0,57,176,0,206,143,218,59,82,210,234,101,0,231,190,246,206,176,180,250,23,192,185,173,189,35,33,173,30,7,112,150,107,239,72,137,165,103,1,156,139,218,59,19,232,100,33,128,179,88,123,103,88,23,249,17,192,217,174,189,163,67,19,211,1,156,165,218,59,18,202,214,139,0,206,102,237,29,109,154,88,11,224,252,168,189,211,131,116,48,1,156,251,218,59,13,144,195,8,224,220,214,222,233,0,57,176,0,206,114,237,29,41,177,116,95,123,71,145,68,134,93,66,127,106,239,244,85,148,233,218,59,195,186,200,113,237,29,89,114,152,113,9,221,215,222,17,232,96,131,181,119,36,148,173,187,218,59,74,228,48,226,18,250,83,123,167,165,192,44,215,222,233,141,237,103,237,29,69,18,25,54,50,254,212,222,41,213,155,197,218,59,205,136,30,214,222,145,37,135,25,35,227,190,246,14,163,222,44,213,222,233,140,232,87,237,29,37,114,24,49,50,254,212,222,33,230,206,175,218,59,61,72,254,231,29,8,100,31,106,239,52,64,60,206,59,160,215,237,69,237,157,14,16,255,243,14,66,105,181,144,119,144,18,75,247,121,7,69,18,205,239,18,78,160,147,73,151,176,175,162,76,231,29,134,117,145,227,188,131,44,57,102,118,9,117,104,98,196,37,20,232,96,131,121,7,9,101,235,46,239,160,68,142,249,92,66,109,154,88,115,9,253,168,230,209,131,116,48,46,161,251,106,30,13,144,195,112,9,221,86,243,232,0,57,48,151,112,188,182,130,57,151,80,173,156,130,51,151,112,156,68,134,93,66,53,58,89,112,9,71,75,152,204,238,18,42,213,42,177,237,18,142,146,195,140,75,168,68,19,211,46,161,182,30,209,118,9,103,209,30,166,92,66,13,157,49,135,75,56,81,83,152,114,9,253,168,15,208,131,116,48,46,161,251,250,0,13,144,195,112,9,221,214,7,232,0,57,48,151,112,252,182,182,57,151,80,237,130,182,51,151,112,156,68,134,93,66,53,58,89,112,9,71,139,34,204,238,18,42,85,63,176,237,18,142,146,195,140,75,168,68,19,211,46,161,182,30,209,118,9,103,209,30,166,92,66,13,157,49,135,75,56,81,83,152,114,9,253,184,113,220,131,116,48,46,161,251,27,199,13,144,195,112,9,221,222,56,238,0,57,48,151,112,252,254,167,57,151,80,237,202,167,51,151,112,156,68,134,93,66,53,58,89,112,9,71,175,89,207,238,18,42,221,167,182,237,18,142,146,195,140,75,168,68,19,211,46,161,182,30,209,118,9,103,209,30,166,92,66,13,157,49,135,75,56,81,83,152,114,9,253,184,195,216,131,116,48,46,161,251,59,140,13,144,195,112,9,221,222,97,236,0,57,48,151,208,242,29,70,41,177,244,204,37,116,113,135,113,2,157,44,184,132,22,239,48,14,235,34,63,92,66,219,119,24,117,104,98,218,37,180,116,135,81,66,217,122,225,18,218,188,195,168,77,19,107,46,161,229,59,140,189,177,253,188,195,168,72,34,195,70,198,159,59,140,165,122,179,120,135,177,25,209,195,59,140,178,228,48,99,100,220,223,97,100,212,155,165,59,140,157,17,253,186,195,168,68,14,35,70,198,159,59,140,4,137,252,29,198,89,141,76,111,108,63,141,140,
+34,137,230,55,50,19,232,100,210,200,16,88,18,23,55,231,51,50,205,136,30,26,25,89,114,204,108,100,116,104,98,196,200,160,153,91,78,212,35,106,70,166,51,162,95,70,70,137,28,243,25,25,109,154,88,51,50,227,119,84,204,25,25,181,107,41,206,140,204,56,137,12,27,25,53,58,89,48,50,163,87,193,102,55,50,74,119,190,108,27,153,81,114,152,49,50,74,52,49,109,100,180,245,136,182,145,153,69,123,152,50,50,26,58,99,14,35,51,81,83,152,50,50,227,167,222,205,25,25,181,131,238,206,140,204,56,137,12,27,25,53,58,89,48,50,163,151,75,102,55,50,74,183,72,108,27,153,81,114,152,49,50,74,52,49,109,100,180,245,136,182,145,153,69,123,152,50,50,26,58,99,14,35,51,81,83,152,50,50,227,231,104,205,25,25,181,163,179,206,140,204,56,137,12,27,25,53,58,89,48,50,163,199,213,103,55,50,74,231,210,109,27,153,81,114,152,49,50,74,52,49,109,100,180,245,136,182,145,153,69,123,152,50,50,26,58,99,14,35,51,81,83,152,50,50,227,39,243,204,25,25,181,195,120,206,140,204,56,137,12,27,25,53,58,89,48,50,163,7,96,103,55,50,74,39,93,109,27,153,81,114,152,49,50,74,52,49,109,100,180,245,136,182,145,153,69,123,152,50,50,26,58,99,14,35,51,81,83,152,50,50,150,79,151,245,198,62,0,35,227,226,116,217,4,58,89,48,50,22,79,151,53,35,250,107,100,108,159,46,211,161,137,105,35,99,233,116,89,103,68,111,141,140,205,211,101,218,52,153,223,200,60,171,21,24,57,130,32,121,116,234,203,223,95,13,92,27,123,54,237,86,219,0,36,73,74,141,195,155,251,138,214,179,19,246,32,199,216,201,162,33,124,0,239,167,121,129,204,64,52,4,53,63,201,40,186,229,84,142,251,9,87,116,94,32,211,73,70,64,205,126,171,77,66,90,57,119,31,124,146,86,45,120,22,165,85,17,159,29,105,213,0,101,81,90,213,208,89,146,86,13,80,46,164,149,243,2,94,159,164,85,11,158,69,105,85,196,103,71,90,53,64,89,148,86,53,116,150,164,85,3,148,11,105,197,189,109,143,165,85,11,158,69,105,85,196,103,71,90,53,64,89,148,86,53,116,150,164,85,3,148,11,105,197,227,142,30,75,171,22,60,139,210,170,136,207,142,180,106,128,178,40,173,106,232,44,73,171,6,40,23,210,138,127,247,97,138,183,16,158,201,110,101,40,138,165,14,14,253,116,100,190,95,246,118,18,20,73,36,38,142,76,98,82,10,128,60,157,20,41,36,131,112,64,69,169,173,21,213,80,114,28,35,163,139,212,71,159,137,79,212,200,33,34,132,50,119,232,211,68,137,26,114,60,33,212,193,74,171,82,170,96,41,158,144,82,182,234,163,207,195,19,138,228,16,17,66,149,39,38,208,68,137,26,83,182,50,70,46,219,184,112,9,21,46,226,184,119,9,135,239,175,89,116,9,229,111,180,57,118,9,245,57,110,102,151,112,30,62,179,234,18,142,188,130,200,39,105,245,114,43,99,248,173,94,238,165,213,191,173,12,125,142,179,36,173,30,111,101,176,180,243,100,43,67,68,69,47,183,50,24,105,117,187,149,33,144,86,255,182,50,244,57,206,146,180,122,188,149,193,210,206,147,173,12,17,21,189,220,202,96,164,213,237,86,134,64,90,253,219,202,208,231,56,75,210,234,241,86,6,75,59,126,14,215,92,114,84,68,46,29,28,6,147,163,227,36,50,156,28,85,163,147,133,228,40,163,162,212,214,74,59,57,42,208,69,234,163,155,72,142,142,146,195,76,114,84,137,38,166,147,163,218,122,68,59,57,58,139,246,48,149,28,213,208,25,115,36,71,39,106,10,83,201,209,145,34,17,46,92,66,133,2,18,238,93,194,225,186,43,22,93,66,249,74,44,142,93,66,125,142,155,217,37,156,135,207,172,186,132,35,47,227,244,73,90,189,76,142,14,191,223,214,189,180,250,151,28,213,231,56,75,210,234,113,114,148,165,157,39,201,81,17,21,189,76,142,50,210,234,54,57,42,144,86,255,146,163,250,28,103,73,90,61,78,142,178,180,227,103,133,204,165,91,68,228,210,193,97,48,221,50,78,34,195,233,22,53,58,89,72,183,48,42,74,109,173,180,211,45,2,93,164,62,186,137,116,203,40,57,204,164,91,148,104,98,58,221,162,173,71,180,211,45,179,104,15,83,233,22,13,157,49,71,
+186,101,162,166,48,149,110,25,41,151,230,194,37,84,40,165,230,222,37,28,174,64,104,209,37,148,175,73,232,216,37,212,231,184,153,93,194,121,248,204,170,75,56,242,162,107,159,164,213,203,116,203,240,187,227,221,75,171,127,233,22,125,142,179,36,173,30,167,91,88,218,241,227,76,115,1,156,136,92,58,56,12,6,112,227,36,50,28,192,169,209,201,66,0,199,168,40,181,181,210,14,224,4,186,72,125,116,19,1,220,40,57,204,4,112,74,52,49,29,192,105,235,17,237,0,110,22,237,97,42,128,211,208,25,115,4,112,19,53,133,169,0,110,164,20,169,11,151,80,161,76,169,123,151,112,184,186,175,69,151,80,190,222,175,99,151,80,159,227,102,118,9,231,225,51,171,46,225,200,107,233,141,186,132,10,239,166,119,233,18,142,147,200,176,75,168,70,39,11,46,33,163,162,212,214,74,219,37,20,232,34,245,209,77,184,132,163,228,48,227,18,42,209,196,180,75,168,173,71,180,93,194,89,180,135,41,151,80,67,103,204,225,18,78,212,20,166,92,194,145,194,193,70,141,140,66,245,96,151,70,102,156,68,134,141,140,26,157,44,24,153,225,2,228,38,140,140,124,237,113,7,70,102,148,28,102,140,140,18,77,76,27,25,109,61,162,109,100,102,209,30,166,140,140,134,206,152,195,200,76,212,20,51,26,25,114,99,192,175,122,236,61,72,254,231,29,8,100,31,234,177,55,64,60,206,59,224,197,37,47,234,177,119,128,248,159,119,16,74,171,187,141,99,41,105,245,107,227,184,47,173,142,54,142,135,165,213,147,141,99,129,180,218,223,56,150,144,86,191,54,142,133,210,234,238,156,190,148,180,250,117,78,191,47,173,142,206,233,15,75,171,39,231,244,5,210,106,255,156,190,132,180,250,117,78,95,40,173,238,138,152,72,73,171,95,69,76,250,210,234,168,136,201,176,180,122,82,196,68,32,173,246,139,152,72,72,171,95,69,76,132,210,106,161,136,137,148,88,186,47,98,162,72,162,249,147,163,19,232,100,50,57,218,87,81,166,139,152,12,235,34,199,69,76,100,201,49,115,114,84,135,38,70,146,163,2,29,108,176,136,137,132,178,117,87,196,68,137,28,243,37,71,181,105,98,45,57,234,71,133,231,30,164,131,73,142,186,175,240,220,0,57,140,228,168,219,10,207,29,32,7,150,28,245,163,194,179,148,180,122,153,28,117,95,225,121,88,90,253,75,142,186,173,240,44,33,173,30,39,71,253,168,240,44,37,173,94,38,71,221,87,120,30,150,86,255,146,163,110,43,60,75,72,171,199,201,81,63,42,60,75,73,171,151,201,81,247,21,158,135,165,213,191,228,168,219,10,207,18,210,234,113,114,212,114,133,103,41,177,244,44,57,234,162,194,243,4,58,89,72,142,90,172,240,60,172,139,252,72,142,218,174,240,172,67,19,211,201,81,75,21,158,37,148,173,23,201,81,155,21,158,181,105,98,45,57,234,71,133,231,30,164,131,73,142,186,175,240,220,0,57,140,228,168,219,10,207,29,32,7,150,28,245,163,194,179,148,180,122,153,28,117,95,225,121,88,90,253,75,142,186,173,240,44,33,173,30,39,71,253,168,240,44,37,173,94,38,71,221,87,120,30,150,86,255,146,163,110,43,60,75,72,171,199,201,81,203,21,158,165,196,210,125,133,103,69,18,25,78,183,248,83,225,185,175,162,76,87,120,30,214,69,142,43,60,203,146,195,76,186,197,125,133,103,129,14,54,88,225,89,66,217,186,171,240,172,68,14,35,233,22,127,42,60,183,20,152,31,21,158,123,144,14,38,221,226,190,194,115,3,228,48,210,45,110,43,60,119,128,28,88,186,197,143,10,207,82,210,234,101,186,197,125,133,231,97,105,245,47,221,226,182,194,179,132,180,122,156,110,177,92,225,89,74,44,221,87,120,86,36,145,225,0,206,159,10,207,125,21,101,186,194,243,176,46,114,92,225,89,150,28,102,2,56,247,21,158,5,58,216,96,133,103,9,101,235,174,194,179,18,57,140,4,112,254,84,120,110,41,48,63,42,60,247,32,29,76,0,231,190,194,115,3,228,48,2,56,183,21,158,59,64,14,44,128,179,92,225,89,74,44,221,87,120,86,36,145,97,151,208,159,10,207,125,21,101,186,194,243,176,46,114,92,225,89,150,28,102,92,66,247,21,158,5,58,216,96,133,103,9,101,235,174,194,179,18,57,140,184,132,254,84,120,110,41,48,203,21,158,123,99,251,89,225,
+89,145,68,134,141,140,63,21,158,75,245,102,177,194,115,51,162,135,21,158,101,201,97,198,200,184,175,240,204,168,55,75,21,158,59,35,250,85,225,89,137,28,70,140,140,63,21,158,201,22,182,95,21,158,123,144,252,207,59,16,200,62,84,120,110,128,120,156,119,192,147,52,94,84,120,238,0,241,63,239,32,148,86,119,27,199,82,210,234,215,198,113,95,90,29,109,28,15,75,171,39,27,199,2,105,181,191,113,44,33,173,126,109,28,11,165,213,221,57,125,41,105,245,235,156,126,95,90,29,157,211,31,150,86,79,206,233,11,164,213,254,57,125,9,105,245,235,156,190,80,90,45,156,211,151,18,75,247,231,244,21,73,52,127,186,101,2,157,76,166,91,250,42,202,244,57,253,97,93,228,248,156,190,44,57,102,78,183,232,208,196,72,186,69,160,131,13,158,211,151,80,182,238,206,233,43,145,99,190,116,139,54,77,172,165,91,252,168,25,219,131,116,48,233,22,247,53,99,27,32,135,145,110,113,91,51,182,3,228,192,210,45,126,212,140,149,146,86,47,211,45,238,107,198,14,75,171,127,233,22,183,53,99,37,164,213,227,116,139,31,53,99,165,164,213,203,116,139,251,154,177,195,210,234,95,186,197,109,205,88,9,105,245,56,221,50,94,193,211,92,186,69,173,104,167,179,116,203,56,137,12,167,91,212,232,100,33,221,50,90,40,119,246,116,139,82,69,92,219,233,150,81,114,152,73,183,40,209,196,116,186,69,91,143,104,167,91,102,209,30,166,210,45,26,58,99,142,116,203,68,77,97,42,221,226,71,21,202,30,164,131,73,183,184,175,66,217,0,57,140,116,139,219,42,148,29,32,7,150,110,241,163,10,165,148,180,122,153,110,113,95,133,114,88,90,253,75,183,184,173,66,41,33,173,30,167,91,252,168,66,41,37,173,94,166,91,220,87,161,28,150,86,255,210,45,110,171,80,74,72,171,199,233,22,203,85,40,165,196,210,179,116,139,139,42,148,19,232,100,33,221,98,177,10,229,176,46,242,35,221,98,187,10,165,14,77,76,167,91,44,85,161,148,80,182,94,164,91,108,86,161,212,166,137,181,116,139,31,85,40,123,144,14,38,221,226,190,10,101,3,228,48,210,45,110,171,80,118,128,28,88,186,197,143,42,148,82,210,234,101,186,197,125,21,202,97,105,245,47,221,226,182,10,165,132,180,122,156,110,177,92,133,82,74,44,221,87,161,84,36,145,225,0,206,159,42,148,125,21,101,186,10,229,176,46,114,92,133,82,150,28,102,2,56,247,85,40,5,58,216,96,21,74,9,101,235,174,10,165,18,57,140,4,112,254,84,161,108,41,48,63,170,80,246,32,29,76,0,231,190,10,101,3,228,48,2,56,183,85,40,59,64,14,44,128,179,92,133,82,74,44,221,87,161,84,36,145,97,151,208,159,42,148,125,21,101,186,10,229,176,46,114,92,133,82,150,28,102,92,66,247,85,40,5,58,216,96,21,74,9,101,235,174,10,165,18,57,140,184,132,254,84,161,108,41,48,203,85,40,123,99,251,89,133,82,145,68,134,141,140,63,85,40,75,245,102,177,10,101,51,162,135,85,40,101,201,97,198,200,184,175,66,201,168,55,75,85,40,59,35,250,85,133,82,137,28,70,140,140,63,85,40,73,6,196,175,42,148,61,72,254,231,29,8,100,31,170,80,54,64,60,206,59,96,34,214,139,42,148,29,32,254,231,29,132,210,234,110,227,88,74,90,253,218,56,238,75,171,163,141,227,97,105,245,100,227,88,32,173,246,55,142,37,164,213,175,141,99,161,180,90,216,56,150,18,75,247,27,199,138,36,154,63,128,155,64,39,147,1,92,95,69,153,222,56,30,214,69,142,55,142,101,201,49,115,0,167,67,19,35,1,156,64,7,27,220,56,150,80,182,238,54,142,149,200,49,95,0,167,77,19,107,1,156,31,117,237,122,144,14,38,128,115,95,215,174,1,114,24,1,156,219,186,118,29,32,7,22,192,249,81,215,78,74,90,189,12,224,220,215,181,27,150,86,255,2,56,183,117,237,36,164,213,227,0,110,188,202,152,185,0,78,173,176,152,179,0,110,156,68,134,3,56,53,58,89,8,224,70,139,249,205,30,192,41,85,237,179,29,192,141,146,195,76,0,167,68,19,211,1,156,182,30,209,14,224,102,209,30,166,2,56,13,157,49,71,0,55,81,83,152,10,224,252,168,148,213,131,116,48,1,156,251,74,89,13,144,195,8,224,220,86,202,234,
+0,57,176,0,206,143,74,89,82,210,234,101,0,231,190,82,214,176,180,250,23,192,185,173,148,37,33,173,30,7,112,227,117,139,204,5,112,106,165,138,156,5,112,227,36,50,28,192,169,209,201,66,0,55,90,30,108,246,0,78,169,14,152,237,0,110,148,28,102,2,56,37,154,152,14,224,180,245,136,118,0,55,139,246,48,21,192,105,232,140,57,2,184,137,154,194,84,0,231,71,237,157,30,164,131,9,224,220,215,222,105,128,28,70,0,231,182,246,78,7,200,129,5,112,126,212,222,145,146,86,47,3,56,247,181,119,134,165,213,191,0,206,109,237,29,9,105,245,56,128,179,92,123,71,74,44,61,11,224,92,212,222,153,64,39,11,1,156,197,218,59,195,186,200,143,0,206,118,237,29,29,154,152,14,224,44,213,222,145,80,182,94,4,112,54,107,239,104,211,196,90,0,231,71,237,157,30,164,131,9,224,220,215,222,105,128,28,70,0,231,182,246,78,7,200,129,5,112,150,107,239,72,137,165,251,218,59,138,36,50,236,18,250,83,123,167,175,162,76,215,222,25,214,69,142,107,239,200,146,195,140,75,232,190,246,142,64,7,27,172,189,35,161,108,221,213,222,81,34,135,17,151,208,159,218,59,45,5,102,185,246,78,111,108,63,107,239,40,146,200,176,145,241,167,246,78,169,222,44,214,222,105,70,244,176,246,142,44,57,204,24,25,247,181,119,24,245,102,169,246,78,103,68,191,106,239,40,145,195,136,145,241,167,246,14,49,119,126,213,222,233,65,242,63,239,64,32,251,80,123,167,1,226,113,222,1,189,110,47,106,239,116,128,248,159,119,16,74,171,133,188,131,148,88,186,207,59,40,146,104,126,151,112,2,157,76,186,132,125,21,101,58,239,48,172,139,28,231,29,100,201,49,179,75,168,67,19,35,46,161,64,7,27,204,59,72,40,91,119,121,7,37,114,204,231,18,106,211,196,154,75,232,71,53,143,30,164,131,113,9,221,87,243,104,128,28,134,75,232,182,154,71,7,200,129,185,132,227,181,21,204,185,132,106,229,20,156,185,132,227,36,50,236,18,170,209,201,130,75,56,90,194,100,118,151,80,169,86,137,109,151,112,148,28,102,92,66,37,154,152,118,9,181,245,136,182,75,56,139,246,48,229,18,106,232,140,57,92,194,137,154,194,148,75,232,71,125,128,30,164,131,113,9,221,215,7,104,128,28,134,75,232,182,62,64,7,200,129,185,132,227,183,181,205,185,132,106,23,180,157,185,132,227,36,50,236,18,170,209,201,130,75,56,90,20,97,118,151,80,169,250,129,109,151,112,148,28,102,92,66,37,154,152,118,9,181,245,136,182,75,56,139,246,48,229,18,106,232,140,57,92,194,137,154,194,148,75,232,199,141,227,30,164,131,113,9,221,223,56,110,128,28,134,75,232,246,198,113,7,200,129,185,132,227,247,63,205,185,132,106,87,62,157,185,132,227,36,50,236,18,170,209,201,130,75,56,122,205,122,118,151,80,233,62,181,109,151,112,148,28,102,92,66,37,154,152,118,9,181,245,136,182,75,56,139,246,48,229,18,106,232,140,57,92,194,137,154,194,148,75,232,199,29,198,30,164,131,113,9,221,223,97,108,128,28,134,75,232,246,14,99,7,200,129,185,132,150,239,48,74,137,165,103,46,161,139,59,140,19,232,100,193,37,180,120,135,113,88,23,249,225,18,218,190,195,168,67,19,211,46,161,165,59,140,18,202,214,11,151,208,230,29,70,109,154,88,115,9,45,223,97,236,141,237,231,29,70,69,18,25,54,50,254,220,97,44,213,155,197,59,140,205,136,30,222,97,148,37,135,25,35,227,254,14,35,163,222,44,221,97,236,140,232,215,29,70,37,114,24,49,50,254,220,97,36,72,228,239,48,206,106,100,122,99,251,105,100,20,73,52,191,145,153,64,39,147,70,134,192,146,184,184,57,159,145,105,70,244,208,200,200,146,99,102,35,163,67,19,35,70,6,205,220,114,162,30,81,51,50,157,17,253,50,50,74,228,152,207,200,104,211,196,154,145,25,191,163,98,206,200,168,93,75,113,102,100,198,73,100,216,200,168,209,201,130,145,25,189,10,54,187,145,81,186,243,101,219,200,140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,194,148,145,25,63,245,110,206,200,168,29,116,119,102,100,198,73,100,216,200,168,209,201,130,145,25,189,92,50,187,145,81,186,69,98,219,200,
+140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,194,148,145,25,63,71,107,206,200,168,29,157,117,102,100,198,73,100,216,200,168,209,201,130,145,25,61,174,62,187,145,81,58,151,110,219,200,140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,194,148,145,25,63,153,103,206,200,168,29,198,115,102,100,198,73,100,216,200,168,209,201,130,145,25,61,0,59,187,145,81,58,233,106,219,200,140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,194,148,145,177,124,186,172,55,246,1,24,25,23,167,203,38,208,201,130,145,177,120,186,172,25,209,95,35,99,251,116,153,14,77,76,27,25,75,167,203,58,35,122,107,100,108,158,46,211,166,201,252,70,230,223,106,5,70,142,32,72,30,157,250,240,247,247,3,215,198,254,109,218,173,182,1,72,146,148,26,135,55,247,21,173,127,59,97,15,114,140,157,44,26,194,7,240,126,154,23,200,12,68,67,80,243,147,140,162,91,78,229,184,159,112,69,231,5,50,157,100,4,212,236,183,218,36,164,149,115,247,193,39,105,213,130,103,81,90,21,241,217,145,86,13,80,22,165,85,13,157,37,105,213,0,229,66,90,57,47,224,245,73,90,181,224,89,148,86,69,124,118,164,85,3,148,69,105,85,67,103,73,90,53,64,185,144,86,220,219,246,88,90,181,224,89,148,86,69,124,118,164,85,3,148,69,105,85,67,103,73,90,53,64,185,144,86,60,238,232,177,180,106,193,179,40,173,138,248,236,72,171,6,40,139,210,170,134,206,146,180,106,128,114,33,173,248,119,31,166,120,11,225,223,100,183,50,20,197,82,7,135,126,58,114,187,223,244,118,18,20,73,36,38,142,76,98,82,10,128,60,157,20,41,36,131,112,64,69,169,173,21,213,80,114,28,35,163,139,212,71,159,137,79,212,200,33,34,132,50,119,232,211,68,137,26,114,60,33,212,193,74,171,82,170,96,41,158,144,82,182,234,163,207,195,19,138,228,16,17,66,149,39,38,208,68,137,26,83,182,50,70,46,219,184,112,9,21,46,226,184,119,9,135,239,175,89,116,9,229,111,180,57,118,9,245,57,110,102,151,112,30,62,179,234,18,142,188,130,200,39,105,245,114,43,99,248,173,94,238,165,213,191,173,12,125,142,179,36,173,30,111,101,176,180,243,100,43,67,68,69,47,183,50,24,105,117,187,149,33,144,86,255,182,50,244,57,206,146,180,122,188,149,193,210,206,147,173,12,17,21,189,220,202,96,164,213,237,86,134,64,90,253,219,202,208,231,56,75,210,234,241,86,6,75,59,126,14,215,92,114,84,68,46,29,28,6,147,163,227,36,50,156,28,85,163,147,133,228,40,163,162,212,214,74,59,57,42,208,69,234,163,155,72,142,142,146,195,76,114,84,137,38,166,147,163,218,122,68,59,57,58,139,246,48,149,28,213,208,25,115,36,71,39,106,10,83,201,209,145,34,17,46,92,66,133,2,18,238,93,194,225,186,43,22,93,66,249,74,44,142,93,66,125,142,155,217,37,156,135,207,172,186,132,35,47,227,244,73,90,189,76,142,14,191,223,214,189,180,250,151,28,213,231,56,75,210,234,113,114,148,165,157,39,201,81,17,21,189,76,142,50,210,234,54,57,42,144,86,255,146,163,250,28,103,73,90,61,78,142,178,180,227,103,133,204,165,91,68,228,210,193,97,48,221,50,78,34,195,233,22,53,58,89,72,183,48,42,74,109,173,180,211,45,2,93,164,62,186,137,116,203,40,57,204,164,91,148,104,98,58,221,162,173,71,180,211,45,179,104,15,83,233,22,13,157,49,71,186,101,162,166,48,149,110,25,41,151,230,194,37,84,40,165,230,222,37,28,174,64,104,209,37,148,175,73,232,216,37,212,231,184,153,93,194,121,248,204,170,75,56,242,162,107,159,164,213,203,116,203,240,187,227,221,75,171,127,233,22,125,142,179,36,173,30,167,91,88,218,241,227,76,115,1,156,136,92,58,56,12,6,112,227,36,50,28,192,169,209,201,66,0,199,168,40,181,181,210,14,224,4,186,72,125,116,19,1,220,40,57,204,4,112,74,52,49,29,192,105,235,17,237,0,110,22,237,97,42,128,211,208,25,115,4,112,19,53,133,169,0,110,164,20,169,11,151,80,161,76,169,123,151,112,
+184,186,175,69,151,80,190,222,175,99,151,80,159,227,102,118,9,231,225,51,171,46,225,200,107,233,141,186,132,10,239,166,119,233,18,142,147,200,176,75,168,70,39,11,46,33,163,162,212,214,74,219,37,20,232,34,245,209,77,184,132,163,228,48,227,18,42,209,196,180,75,168,173,71,180,93,194,89,180,135,41,151,80,67,103,204,225,18,78,212,20,166,92,194,145,194,193,70,141,140,66,245,96,151,70,102,156,68,134,141,140,26,157,44,24,153,225,2,228,38,140,140,124,237,113,7,70,102,148,28,102,140,140,18,77,76,27,25,109,61,162,109,100,102,209,30,166,140,140,134,206,152,195,200,76,212,20,51,26,25,114,99,192,175,122,236,61,72,254,231,29,8,100,31,234,177,55,64,60,206,59,224,197,37,47,234,177,119,128,248,159,119,16,74,171,187,141,99,41,105,245,107,227,184,47,173,142,54,142,135,165,213,147,141,99,129,180,218,223,56,150,144,86,191,54,142,133,210,234,238,156,190,148,180,250,117,78,191,47,173,142,206,233,15,75,171,39,231,244,5,210,106,255,156,190,132,180,250,117,78,95,40,173,238,138,152,72,73,171,95,69,76,250,210,234,168,136,201,176,180,122,82,196,68,32,173,246,139,152,72,72,171,95,69,76,132,210,106,161,136,137,148,88,186,47,98,162,72,162,249,147,163,19,232,100,50,57,218,87,81,166,139,152,12,235,34,199,69,76,100,201,49,115,114,84,135,38,70,146,163,2,29,108,176,136,137,132,178,117,87,196,68,137,28,243,37,71,181,105,98,45,57,234,71,133,231,30,164,131,73,142,186,175,240,220,0,57,140,228,168,219,10,207,29,32,7,150,28,245,163,194,179,148,180,122,153,28,117,95,225,121,88,90,253,75,142,186,173,240,44,33,173,30,39,71,253,168,240,44,37,173,94,38,71,221,87,120,30,150,86,255,146,163,110,43,60,75,72,171,199,201,81,63,42,60,75,73,171,151,201,81,247,21,158,135,165,213,191,228,168,219,10,207,18,210,234,113,114,212,114,133,103,41,177,244,44,57,234,162,194,243,4,58,89,72,142,90,172,240,60,172,139,252,72,142,218,174,240,172,67,19,211,201,81,75,21,158,37,148,173,23,201,81,155,21,158,181,105,98,45,57,234,71,133,231,30,164,131,73,142,186,175,240,220,0,57,140,228,168,219,10,207,29,32,7,150,28,245,163,194,179,148,180,122,153,28,117,95,225,121,88,90,253,75,142,186,173,240,44,33,173,30,39,71,253,168,240,44,37,173,94,38,71,221,87,120,30,150,86,255,146,163,110,43,60,75,72,171,199,201,81,203,21,158,165,196,210,125,133,103,69,18,25,78,183,248,83,225,185,175,162,76,87,120,30,214,69,142,43,60,203,146,195,76,186,197,125,133,103,129,14,54,88,225,89,66,217,186,171,240,172,68,14,35,233,22,127,42,60,183,20,152,31,21,158,123,144,14,38,221,226,190,194,115,3,228,48,210,45,110,43,60,119,128,28,88,186,197,143,10,207,82,210,234,101,186,197,125,133,231,97,105,245,47,221,226,182,194,179,132,180,122,156,110,177,92,225,89,74,44,221,87,120,86,36,145,225,0,206,159,10,207,125,21,101,186,194,243,176,46,114,92,225,89,150,28,102,2,56,247,21,158,5,58,216,96,133,103,9,101,235,174,194,179,18,57,140,4,112,254,84,120,110,41,48,63,42,60,247,32,29,76,0,231,190,194,115,3,228,48,2,56,183,21,158,59,64,14,44,128,179,92,225,89,74,44,221,87,120,86,36,145,97,151,208,159,10,207,125,21,101,186,194,243,176,46,114,92,225,89,150,28,102,92,66,247,21,158,5,58,216,96,133,103,9,101,235,174,194,179,18,57,140,184,132,254,84,120,110,41,48,203,21,158,123,99,251,89,225,89,145,68,134,141,140,63,21,158,75,245,102,177,194,115,51,162,135,21,158,101,201,97,198,200,184,175,240,204,168,55,75,21,158,59,35,250,85,225,89,137,28,70,140,140,63,21,158,201,22,182,95,21,158,123,144,252,207,59,16,200,62,84,120,110,128,120,156,119,192,147,52,94,84,120,238,0,241,63,239,32,148,86,119,27,199,82,210,234,215,198,113,95,90,29,109,28,15,75,171,39,27,199,2,105,181,191,113,44,33,173,126,109,28,11,165,213,221,57,125,41,105,245,235,156,126,95,90,29,157,211,31,150,86,79,206,233,11,164,213,254,57,125,9,105,245,235,156,190,80,90,45,156,211,151,
+18,75,247,231,244,21,73,52,127,186,101,2,157,76,166,91,250,42,202,244,57,253,97,93,228,248,156,190,44,57,102,78,183,232,208,196,72,186,69,160,131,13,158,211,151,80,182,238,206,233,43,145,99,190,116,139,54,77,172,165,91,252,168,25,219,131,116,48,233,22,247,53,99,27,32,135,145,110,113,91,51,182,3,228,192,210,45,126,212,140,149,146,86,47,211,45,238,107,198,14,75,171,127,233,22,183,53,99,37,164,213,227,116,139,31,53,99,165,164,213,203,116,139,251,154,177,195,210,234,95,186,197,109,205,88,9,105,245,56,221,50,94,193,211,92,186,69,173,104,167,179,116,203,56,137,12,167,91,212,232,100,33,221,50,90,40,119,246,116,139,82,69,92,219,233,150,81,114,152,73,183,40,209,196,116,186,69,91,143,104,167,91,102,209,30,166,210,45,26,58,99,142,116,203,68,77,97,42,221,226,71,21,202,30,164,131,73,183,184,175,66,217,0,57,140,116,139,219,42,148,29,32,7,150,110,241,163,10,165,148,180,122,153,110,113,95,133,114,88,90,253,75,183,184,173,66,41,33,173,30,167,91,252,168,66,41,37,173,94,166,91,220,87,161,28,150,86,255,210,45,110,171,80,74,72,171,199,233,22,203,85,40,165,196,210,179,116,139,139,42,148,19,232,100,33,221,98,177,10,229,176,46,242,35,221,98,187,10,165,14,77,76,167,91,44,85,161,148,80,182,94,164,91,108,86,161,212,166,137,181,116,139,31,85,40,123,144,14,38,221,226,190,10,101,3,228,48,210,45,110,171,80,118,128,28,88,186,197,143,42,148,82,210,234,101,186,197,125,21,202,97,105,245,47,221,226,182,10,165,132,180,122,156,110,177,92,133,82,74,44,221,87,161,84,36,145,225,0,206,159,42,148,125,21,101,186,10,229,176,46,114,92,133,82,150,28,102,2,56,247,85,40,5,58,216,96,21,74,9,101,235,174,10,165,18,57,140,4,112,254,84,161,108,41,48,63,170,80,246,32,29,76,0,231,190,10,101,3,228,48,2,56,183,85,40,59,64,14,44,128,179,92,133,82,74,44,221,87,161,84,36,145,97,151,208,159,42,148,125,21,101,186,10,229,176,46,114,92,133,82,150,28,102,92,66,247,85,40,5,58,216,96,21,74,9,101,235,174,10,165,18,57,140,184,132,254,84,161,108,41,48,203,85,40,123,99,251,89,133,82,145,68,134,141,140,63,85,40,75,245,102,177,10,101,51,162,135,85,40,101,201,97,198,200,184,175,66,201,168,55,75,85,40,59,35,250,85,133,82,137,28,70,140,140,63,85,40,73,6,196,175,42,148,61,72,254,231,29,8,100,31,170,80,54,64,60,206,59,96,34,214,139,42,148,29,32,254,231,29,132,210,234,110,227,88,74,90,253,218,56,238,75,171,163,141,227,97,105,245,100,227,88,32,173,246,55,142,37,164,213,175,141,99,161,180,90,216,56,150,18,75,247,27,199,138,36,154,63,128,155,64,39,147,1,92,95,69,153,222,56,30,214,69,142,55,142,101,201,49,115,0,167,67,19,35,1,156,64,7,27,220,56,150,80,182,238,54,142,149,200,49,95,0,167,77,19,107,1,156,31,117,237,122,144,14,38,128,115,95,215,174,1,114,24,1,156,219,186,118,29,32,7,22,192,249,81,215,78,74,90,189,12,224,220,215,181,27,150,86,255,2,56,183,117,237,36,164,213,227,0,110,188,202,152,185,0,78,173,176,152,179,0,110,156,68,134,3,56,53,58,89,8,224,70,139,249,205,30,192,41,85,237,179,29,192,141,146,195,76,0,167,68,19,211,1,156,182,30,209,14,224,102,209,30,166,2,56,13,157,49,71,0,55,81,83,152,10,224,252,168,148,213,131,116,48,1,156,251,74,89,13,144,195,8,224,220,86,202,234,0,57,176,0,206,143,74,89,82,210,234,101,0,231,190,82,214,176,180,250,23,192,185,173,148,37,33,173,30,7,112,227,117,139,204,5,112,106,165,138,156,5,112,227,36,50,28,192,169,209,201,66,0,55,90,30,108,246,0,78,169,14,152,237,0,110,148,28,102,2,56,37,154,152,14,224,180,245,136,118,0,55,139,246,48,21,192,105,232,140,57,2,184,137,154,194,84,0,231,71,237,157,30,164,131,9,224,220,215,222,105,128,28,70,0,231,182,246,78,7,200,129,5,112,126,212,222,145,146,86,47,3,56,247,181,119,134,165,213,191,0,206,109,237,29,9,105,245,56,128,179,92,123,71,74,
+44,61,11,224,92,212,222,153,64,39,11,1,156,197,218,59,195,186,200,143,0,206,118,237,29,29,154,152,14,224,44,213,222,145,80,182,94,4,112,54,107,239,104,211,196,90,0,231,71,237,157,30,164,131,9,224,220,215,222,105,128,28,70,0,231,182,246,78,7,200,129,5,112,150,107,239,72,137,165,251,218,59,138,36,50,236,18,250,83,123,167,175,162,76,215,222,25,214,69,142,107,239,200,146,195,140,75,232,190,246,142,64,7,27,172,189,35,161,108,221,213,222,81,34,135,17,151,208,159,218,59,45,5,102,185,246,78,111,108,63,107,239,40,146,200,176,145,241,167,246,78,169,222,44,214,222,105,70,244,176,246,142,44,57,204,24,25,247,181,119,24,245,102,169,246,78,103,68,191,106,239,40,145,195,136,145,241,167,246,14,49,119,126,213,222,233,65,242,63,239,64,32,251,80,123,167,1,226,113,222,1,189,110,47,106,239,116,128,248,159,119,16,74,171,133,188,131,148,88,186,207,59,40,146,104,126,151,112,2,157,76,186,132,125,21,101,58,239,48,172,139,28,231,29,100,201,49,179,75,168,67,19,35,46,161,64,7,27,204,59,72,40,91,119,121,7,37,114,204,231,18,106,211,196,154,75,232,71,53,143,30,164,131,113,9,221,87,243,104,128,28,134,75,232,182,154,71,7,200,129,185,132,227,181,21,204,185,132,106,229,20,156,185,132,227,36,50,236,18,170,209,201,130,75,56,90,194,100,118,151,80,169,86,137,109,151,112,148,28,102,92,66,37,154,152,118,9,181,245,136,182,75,56,139,246,48,229,18,106,232,140,57,92,194,137,154,194,148,75,232,71,125,128,30,164,131,113,9,221,215,7,104,128,28,134,75,232,182,62,64,7,200,129,185,132,227,183,181,205,185,132,106,23,180,157,185,132,227,36,50,236,18,170,209,201,130,75,56,90,20,97,118,151,80,169,250,129,109,151,112,148,28,102,92,66,37,154,152,118,9,181,245,136,182,75,56,139,246,48,229,18,106,232,140,57,92,194,137,154,194,148,75,232,199,141,227,30,164,131,113,9,221,223,56,110,128,28,134,75,232,246,198,113,7,200,129,185,132,227,247,63,205,185,132,106,87,62,157,185,132,227,36,50,236,18,170,209,201,130,75,56,122,205,122,118,151,80,233,62,181,109,151,112,148,28,102,92,66,37,154,152,118,9,181,245,136,182,75,56,139,246,48,229,18,106,232,140,57,92,194,137,154,194,148,75,232,199,29,198,30,164,131,113,9,221,223,97,108,128,28,134,75,232,246,14,99,7,200,129,185,132,150,239,48,74,137,165,103,46,161,139,59,140,19,232,100,193,37,180,120,135,113,88,23,249,225,18,218,190,195,168,67,19,211,46,161,165,59,140,18,202,214,11,151,208,230,29,70,109,154,88,115,9,45,223,97,236,141,237,231,29,70,69,18,25,54,50,254,220,97,44,213,155,197,59,140,205,136,30,222,97,148,37,135,25,35,227,254,14,35,163,222,44,221,97,236,140,232,215,29,70,37,114,24,49,50,254,220,97,36,72,228,239,48,206,106,100,122,99,251,105,100,20,73,52,191,145,153,64,39,147,70,134,192,146,184,184,57,159,145,105,70,244,208,200,200,146,99,102,35,163,67,19,35,70,6,205,220,114,162,30,81,51,50,157,17,253,50,50,74,228,152,207,200,104,211,196,154,145,25,191,163,98,206,200,168,93,75,113,102,100,198,73,100,216,200,168,209,201,130,145,25,189,10,54,187,145,81,186,243,101,219,200,140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,194,148,145,25,63,245,110,206,200,168,29,116,119,102,100,198,73,100,216,200,168,209,201,130,145,25,189,92,50,187,145,81,186,69,98,219,200,140,146,195,140,145,81,162,137,105,35,163,173,71,180,141,204,44,218,195,148,145,209,208,25,115,24,153,137,154,194,148,145,25,63,71,107,206,200,168,29,157,117,102,100,198,73,100,216,200,168,209,201,130,145,25,61,174,254,255,177,247,182,77,146,220,198,213,232,103,233,87,52,29,225,240,208,94,46,69,222,111,150,150,17,148,184,143,196,184,20,105,147,212,62,126,238,13,197,70,207,76,239,110,91,51,221,163,238,158,37,169,95,127,11,85,53,221,168,23,84,34,19,39,51,177,55,172,8,155,59,111,72,224,228,233,60,149,9,84,2,46,50,172,115,233,214,34,67,194,161,35,50,44,76,180,
+69,70,28,71,196,34,3,137,30,90,34,35,136,25,8,145,41,140,20,90,34,67,159,204,211,19,25,222,97,60,55,145,161,33,82,22,25,30,78,6,34,67,30,128,133,139,12,235,164,171,181,200,144,112,232,136,12,11,19,109,145,17,199,17,177,200,64,162,135,150,200,8,98,6,66,100,10,35,133,150,200,24,159,46,155,216,254,0,68,198,227,116,89,1,78,6,34,99,120,186,236,98,177,94,145,177,62,93,38,193,68,91,100,140,78,151,141,44,86,43,50,150,167,203,196,152,224,69,230,223,206,1,236,120,58,68,155,202,205,23,79,83,9,255,30,77,229,203,175,190,154,76,229,102,191,187,105,172,239,214,167,109,128,254,77,136,98,205,148,154,56,22,225,176,96,110,14,133,98,211,179,208,12,231,19,205,224,125,248,79,177,237,214,244,171,101,35,208,197,118,6,233,165,118,150,175,113,30,126,213,161,188,108,4,185,212,222,96,106,169,231,105,124,122,166,89,123,176,38,243,64,224,87,95,191,74,63,178,124,154,251,232,180,96,59,243,131,78,206,67,30,254,110,183,239,39,79,46,76,136,210,224,228,4,194,172,9,228,227,196,68,40,103,134,159,94,197,103,178,168,67,130,11,190,106,38,242,42,151,49,99,139,229,76,9,214,65,60,225,193,145,2,130,205,14,57,38,44,52,242,56,209,205,224,186,48,142,188,10,228,204,228,196,196,98,49,39,90,235,24,78,48,225,72,1,193,229,68,1,38,44,52,178,30,157,50,68,102,230,69,52,23,145,145,204,195,72,100,230,167,230,36,50,188,201,232,136,12,207,87,104,145,225,91,87,22,153,92,151,40,138,12,103,10,58,34,195,242,10,92,100,248,214,149,69,38,211,33,154,34,195,153,130,178,200,132,205,208,26,68,70,50,15,35,145,153,159,154,147,200,240,38,163,35,50,60,95,161,69,134,111,93,89,100,114,93,162,40,50,156,41,232,136,12,203,43,112,145,225,91,87,22,153,76,135,104,138,12,103,10,202,34,19,142,117,214,32,50,146,121,24,137,204,252,212,156,68,134,55,25,29,145,225,249,10,45,50,124,235,202,34,147,235,18,69,145,225,76,65,71,100,88,94,129,139,12,223,186,178,200,100,58,68,83,100,56,83,80,22,153,240,130,90,13,34,35,153,135,145,200,204,79,205,73,100,120,147,209,17,25,158,175,208,34,195,183,174,44,50,185,46,81,20,25,206,20,116,68,134,229,21,184,200,240,173,43,139,76,166,67,52,69,134,51,5,101,145,9,255,174,65,100,36,243,48,18,153,249,169,57,137,12,111,50,58,34,195,243,21,90,100,248,214,149,69,38,215,37,138,34,195,153,130,142,200,176,188,2,23,25,190,117,101,145,201,116,136,166,200,112,166,160,32,50,68,87,15,85,145,97,180,246,240,20,25,26,34,101,145,225,225,100,32,50,203,221,129,52,68,38,191,49,144,131,200,144,112,232,136,12,11,19,109,145,17,199,17,177,200,64,162,135,150,200,8,98,6,66,100,10,35,133,133,200,88,159,46,99,220,211,93,139,200,184,156,46,227,225,100,43,50,70,167,203,18,1,181,142,211,101,36,28,166,34,227,115,186,76,28,71,224,34,83,197,233,50,65,204,208,20,25,231,211,101,49,26,214,167,203,82,144,84,118,186,140,134,200,73,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,132,195,84,100,124,78,151,137,227,8,92,100,170,56,93,38,136,25,154,34,227,124,186,44,70,195,250,116,89,10,146,202,78,151,209,16,57,137,140,219,233,178,40,170,26,157,46,75,4,212,58,78,151,145,112,152,138,140,207,233,50,113,28,129,139,76,21,167,203,4,49,67,83,100,156,79,151,197,104,88,159,46,75,65,82,217,233,50,26,34,39,145,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,18,14,83,145,241,57,93,38,142,35,112,145,169,226,116,153,32,102,104,138,140,243,233,178,24,13,235,211,101,41,72,42,59,93,70,67,228,36,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,194,97,42,50,62,167,203,196,113,4,46,50,85,156,46,19,196,12,77,145,113,62,93,70,92,231,161,42,50,140,59,61,60,69,134,134,72,89,100,120,56,25,136,204,242,181,64,26,34,147,127,35,144,131,200,144,112,232,136,12,11,19,109,145,17,199,17,177,200,64,162,135,150,200,8,98,6,66,100,10,35,133,133,200,88,159,46,75,65,
+82,217,233,50,26,34,39,145,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,18,14,83,145,241,57,93,38,142,35,112,145,169,226,116,153,32,102,104,138,140,243,233,178,24,13,235,211,101,41,72,42,59,93,70,67,228,36,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,194,97,42,50,62,167,203,196,113,4,46,50,85,156,46,19,196,12,77,145,113,62,93,22,163,97,125,186,44,5,73,101,167,203,104,136,156,68,198,237,116,89,20,85,141,78,151,37,2,106,29,167,203,72,56,76,69,198,231,116,153,56,142,192,69,166,138,211,101,130,152,161,41,50,206,167,203,98,52,172,79,151,165,32,169,236,116,25,13,145,147,200,184,157,46,139,162,170,209,233,178,68,64,173,227,116,25,9,135,169,200,248,156,46,19,199,17,184,200,84,113,186,76,16,51,52,69,198,249,116,89,140,134,245,233,178,20,36,149,157,46,163,33,114,18,25,183,211,101,81,84,53,58,93,150,8,168,117,156,46,35,225,48,21,25,159,211,101,226,56,2,23,153,42,78,151,9,98,134,166,200,56,159,46,11,213,58,175,211,101,193,246,7,112,186,140,134,72,89,100,120,56,25,136,76,51,33,227,211,101,141,197,122,79,151,145,112,232,136,12,11,19,109,145,17,199,17,177,200,64,162,135,150,200,8,98,6,66,100,10,35,133,133,200,88,159,46,75,65,82,217,233,50,26,34,39,145,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,18,14,83,145,241,57,93,38,142,35,112,145,169,226,116,153,32,102,104,138,140,243,233,178,24,13,235,211,101,41,72,42,59,93,70,67,228,36,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,194,97,42,50,62,167,203,196,113,4,46,50,85,156,46,19,196,12,77,145,113,62,93,22,163,97,125,186,44,5,73,101,167,203,104,136,156,68,198,237,116,89,20,85,141,78,151,37,2,106,29,167,203,72,56,76,69,198,231,116,153,56,142,192,69,166,138,211,101,130,152,161,41,50,206,167,203,98,52,172,79,151,165,32,169,236,116,25,13,145,147,200,184,157,46,139,162,170,209,233,178,68,64,173,227,116,25,9,135,169,200,248,156,46,19,199,17,184,200,84,113,186,76,16,51,52,69,198,249,116,89,140,134,245,233,178,20,36,149,157,46,163,33,114,18,25,183,211,101,81,84,53,58,93,150,8,168,117,156,46,35,225,48,21,25,159,211,101,226,56,2,23,153,42,78,151,9,98,134,166,200,56,159,46,11,91,66,94,167,203,130,237,15,224,116,25,13,145,178,200,240,112,50,16,153,102,66,198,167,203,26,139,245,158,46,35,225,208,17,25,22,38,218,34,35,142,35,98,145,129,68,15,45,145,17,196,12,132,200,20,70,10,11,145,177,62,93,150,130,164,178,211,101,52,68,78,34,227,118,186,44,138,170,70,167,203,18,1,181,142,211,101,36,28,166,34,227,115,186,76,28,71,224,34,83,197,233,50,65,204,208,20,25,231,211,101,49,26,214,167,203,82,144,84,118,186,140,134,200,73,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,132,195,84,100,124,78,151,137,227,8,92,100,170,56,93,38,136,25,154,34,227,124,186,44,70,195,250,116,89,10,146,202,78,151,209,16,57,137,140,219,233,178,40,170,26,157,46,75,4,212,58,78,151,145,112,152,138,140,207,233,50,113,28,129,139,76,21,167,203,4,49,67,83,100,156,79,151,197,104,88,159,46,75,65,82,217,233,50,26,34,39,145,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,18,14,83,145,241,57,93,38,142,35,112,145,169,226,116,153,32,102,104,138,140,243,233,178,24,13,235,211,101,41,72,42,59,93,70,67,228,36,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,194,97,42,50,62,167,203,196,113,4,46,50,85,156,46,19,196,12,77,145,113,62,93,22,206,29,120,157,46,11,246,62,128,211,101,52,68,202,34,195,195,201,64,100,26,195,198,167,203,26,51,245,158,46,35,225,208,17,25,22,38,218,34,35,142,35,98,145,129,68,15,45,145,17,196,12,132,200,20,70,10,11,145,177,62,93,150,130,164,178,211,101,52,68,78,34,227,118,186,44,138,170,70,167,203,18,1,181,142,211,101,36,28,166,34,227,115,186,76,28,71,224,34,83,197,233,50,65,204,208,20,25,231,211,
+101,49,26,214,167,203,82,144,84,118,186,140,134,200,73,100,220,78,151,69,81,213,232,116,89,34,160,214,113,186,140,132,195,84,100,124,78,151,137,227,8,92,100,170,56,93,38,136,25,154,34,227,124,186,44,70,195,250,116,89,10,146,202,78,151,209,16,57,137,140,219,233,178,40,170,26,157,46,75,4,212,58,78,151,145,112,152,138,140,207,233,50,113,28,129,139,76,21,167,203,4,49,67,83,100,156,79,151,197,104,88,159,46,75,65,82,217,233,50,26,34,39,145,113,59,93,22,69,85,163,211,101,137,128,90,199,233,50,18,14,83,145,241,57,93,38,142,35,112,145,169,226,116,153,32,102,104,138,140,243,233,178,24,13,235,211,101,41,72,42,59,93,70,67,228,36,50,110,167,203,162,168,106,116,186,44,17,80,235,56,93,70,194,97,42,50,62,167,203,196,113,4,46,50,85,156,46,19,196,12,77,145,177,63,93,22,100,237,28,192,130,121,195,211,101,19,219,117,158,46,99,66,132,23,153,2,156,52,69,166,157,86,75,107,171,211,101,23,139,21,158,46,203,133,3,44,50,18,76,84,68,166,153,200,179,235,194,56,194,19,153,145,197,186,78,151,177,224,192,137,140,24,19,23,145,49,56,93,150,21,60,253,79,151,49,33,114,18,25,251,211,101,211,168,170,125,186,108,57,160,58,159,46,203,133,195,84,100,12,79,151,37,162,170,226,233,178,140,128,234,119,186,140,5,135,169,200,216,159,46,75,70,80,131,211,101,89,193,211,255,116,25,19,34,39,145,177,63,93,54,141,170,218,167,203,150,3,170,243,233,178,92,56,76,69,198,240,116,89,34,170,42,158,46,203,8,168,126,167,203,88,112,152,138,140,253,233,178,100,4,53,56,93,150,21,60,253,79,151,49,33,114,18,25,251,211,101,211,168,170,125,186,108,57,160,58,159,46,203,133,195,84,100,12,79,151,37,162,170,226,233,178,140,128,234,119,186,140,5,135,169,200,216,159,46,75,70,80,131,211,101,89,193,211,255,116,25,19,34,39,145,177,63,93,54,141,170,218,167,203,150,3,170,243,233,178,92,56,76,69,198,240,116,89,34,170,42,158,46,203,8,168,126,167,203,88,112,152,138,140,253,233,178,65,0,11,95,120,109,252,183,95,212,191,241,79,67,164,44,50,60,156,12,68,166,249,143,241,198,127,248,32,85,187,241,79,194,161,35,50,44,76,180,69,70,28,71,196,34,3,137,30,90,34,35,136,25,8,145,41,140,20,22,34,99,189,241,159,130,164,178,141,127,26,34,39,145,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,194,97,42,50,62,27,255,226,56,2,23,153,42,54,254,5,49,67,83,100,156,55,254,99,52,172,55,254,83,144,84,182,241,79,67,228,36,50,110,27,255,81,84,53,218,248,79,4,212,58,54,254,73,56,76,69,198,103,227,95,28,71,224,34,83,197,198,191,32,102,104,138,140,243,198,127,140,134,245,198,127,10,146,202,54,254,105,136,156,68,198,109,227,63,138,170,70,27,255,137,128,90,199,198,63,9,135,169,200,248,108,252,139,227,8,92,100,170,216,248,23,196,12,77,145,113,222,248,143,209,176,222,248,79,65,82,217,198,63,13,145,147,200,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,225,48,21,25,159,141,127,113,28,129,139,76,21,27,255,130,152,161,41,50,206,27,255,65,227,188,54,254,131,237,15,96,227,159,134,72,89,100,120,56,25,136,76,51,33,227,141,255,198,98,189,27,255,36,28,58,34,195,194,68,91,100,196,113,68,44,50,144,232,161,37,50,130,152,129,16,153,194,72,97,33,50,214,27,255,41,72,42,219,248,167,33,114,18,25,183,141,255,40,170,26,109,252,39,2,106,29,27,255,36,28,166,34,227,179,241,47,142,35,112,145,169,98,227,95,16,51,52,69,198,121,227,63,70,195,122,227,63,5,73,101,27,255,52,68,78,34,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,132,195,84,100,124,54,254,197,113,4,46,50,85,108,252,11,98,134,166,200,56,111,252,199,104,88,111,252,167,32,169,108,227,159,134,200,73,100,220,54,254,163,168,106,180,241,159,8,168,117,108,252,147,112,152,138,140,207,198,191,56,142,192,69,166,138,141,127,65,204,208,20,25,231,141,255,24,13,235,141,255,20,36,149,109,252,211,16,57,137,140,219,198,127,20,85,141,54,254,19,1,181,
+142,141,127,18,14,83,145,241,217,248,23,199,17,184,200,84,177,241,47,136,25,154,34,227,188,241,31,18,41,175,141,255,96,251,3,216,248,167,33,82,22,25,30,78,6,34,211,76,200,120,227,191,177,88,239,198,63,9,135,142,200,176,48,209,22,25,113,28,17,139,12,36,122,104,137,140,32,102,32,68,166,48,82,88,136,140,245,198,127,10,146,202,54,254,105,136,156,68,198,109,227,63,138,170,70,27,255,137,128,90,199,198,63,9,135,169,200,248,108,252,139,227,8,92,100,170,216,248,23,196,12,77,145,113,222,248,143,209,176,222,248,79,65,82,217,198,63,13,145,147,200,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,225,48,21,25,159,141,127,113,28,129,139,76,21,27,255,130,152,161,41,50,206,27,255,49,26,214,27,255,41,72,42,219,248,167,33,114,18,25,183,141,255,40,170,26,109,252,39,2,106,29,27,255,36,28,166,34,227,179,241,47,142,35,112,145,169,98,227,95,16,51,52,69,198,121,227,63,70,195,122,227,63,5,73,101,27,255,52,68,78,34,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,132,195,84,100,124,54,254,197,113,4,46,50,85,108,252,11,98,134,166,200,56,111,252,135,106,157,215,198,127,176,253,1,108,252,211,16,41,139,12,15,39,3,145,105,38,100,188,241,223,88,172,119,227,159,132,67,71,100,88,152,104,139,140,56,142,136,69,6,18,61,180,68,70,16,51,16,34,83,24,41,44,68,198,122,227,63,5,73,101,27,255,52,68,78,34,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,132,195,84,100,124,54,254,197,113,4,46,50,85,108,252,11,98,134,166,200,56,111,252,199,104,88,111,252,167,32,169,108,227,159,134,200,73,100,220,54,254,163,168,106,180,241,159,8,168,117,108,252,147,112,152,138,140,207,198,191,56,142,192,69,166,138,141,127,65,204,208,20,25,231,141,255,24,13,235,141,255,20,36,149,109,252,211,16,57,137,140,219,198,127,20,85,141,54,254,19,1,181,142,141,127,18,14,83,145,241,217,248,23,199,17,184,200,84,177,241,47,136,25,154,34,227,188,241,31,163,97,189,241,159,130,164,178,141,127,26,34,39,145,113,219,248,143,162,170,209,198,127,34,160,214,177,241,79,194,97,42,50,62,27,255,226,56,2,23,153,42,54,254,5,49,67,83,100,156,55,254,195,150,144,215,198,127,176,247,1,108,252,211,16,41,139,12,15,39,3,145,105,12,27,111,252,55,102,234,221,248,39,225,208,17,25,22,38,218,34,35,142,35,98,145,129,68,15,45,145,17,196,12,132,200,20,70,10,11,145,177,222,248,79,65,82,217,198,63,13,145,147,200,184,109,252,71,81,213,104,227,63,17,80,235,216,248,39,225,48,21,25,159,141,127,113,28,129,139,76,21,27,255,130,152,161,41,50,206,27,255,49,26,214,27,255,41,72,42,219,248,167,33,114,18,25,183,141,255,40,170,26,109,252,39,2,106,29,27,255,36,28,166,34,227,179,241,47,142,35,112,145,169,98,227,95,16,51,52,69,198,121,227,63,70,195,122,227,63,5,73,101,27,255,52,68,78,34,227,182,241,31,69,85,163,141,255,68,64,173,99,227,159,132,195,84,100,124,54,254,197,113,4,46,50,85,108,252,11,98,134,166,200,56,111,252,199,104,88,111,252,167,32,169,108,227,159,134,200,73,100,220,54,254,163,168,106,180,241,159,8,168,117,108,252,147,112,152,138,140,207,198,191,56,142,192,69,166,138,141,127,65,204,208,20,25,251,141,255,246,210,129,167,0,118,125,218,88,110,252,79,108,215,185,241,207,132,8,47,50,5,56,105,138,76,59,173,247,97,66,86,27,255,23,139,21,110,252,231,194,1,22,25,9,38,42,34,19,110,180,185,46,140,35,60,145,25,89,172,107,227,159,5,7,78,100,196,152,184,136,140,193,198,127,86,240,244,223,248,103,66,228,36,50,246,27,255,211,168,170,189,241,191,28,80,157,55,254,115,225,48,21,25,195,141,255,68,84,85,220,248,207,8,168,126,27,255,44,56,76,69,198,126,227,63,25,65,13,54,254,179,130,167,255,198,63,19,34,39,145,177,223,248,159,70,85,237,141,255,229,128,234,188,241,159,11,135,169,200,24,110,252,39,162,170,226,198,127,70,64,245,219,248,103,193,97,42,50,246,27,255,201,8,106,176,241,159,21,60,253,55,254,153,
+16,57,137,140,253,198,255,52,170,106,111,252,47,7,84,231,141,255,92,56,76,69,198,112,227,63,17,85,21,55,254,51,2,170,223,198,63,11,14,83,145,177,223,248,31,4,176,176,37,228,181,39,211,110,96,214,191,39,67,67,164,44,50,60,156,12,68,166,153,144,241,158,76,216,220,172,118,79,134,132,67,71,100,88,152,104,139,140,56,142,136,69,6,18,61,180,68,70,16,51,16,34,83,24,41,44,68,198,122,79,38,5,73,101,123,50,52,68,78,34,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,132,195,84,100,124,246,100,196,113,4,46,50,85,236,201,8,98,134,166,200,56,239,201,196,104,88,239,201,164,32,169,108,79,134,134,200,73,100,220,246,100,162,168,106,180,39,147,8,168,117,236,201,144,112,152,138,140,207,158,140,56,142,192,69,166,138,61,25,65,204,208,20,25,231,61,153,24,13,235,61,153,20,36,149,237,201,208,16,57,137,140,219,158,76,20,85,141,246,100,18,1,181,142,61,25,18,14,83,145,241,217,147,17,199,17,184,200,84,177,39,35,136,25,154,34,227,188,39,19,190,240,218,147,105,191,168,127,79,134,134,72,89,100,120,56,25,136,76,243,31,227,61,153,240,65,170,118,79,134,132,67,71,100,88,152,104,139,140,56,142,136,69,6,18,61,180,68,70,16,51,16,34,83,24,41,44,68,198,122,79,38,5,73,101,123,50,52,68,78,34,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,132,195,84,100,124,246,100,196,113,4,46,50,85,236,201,8,98,134,166,200,56,239,201,196,104,88,239,201,164,32,169,108,79,134,134,200,73,100,220,246,100,162,168,106,180,39,147,8,168,117,236,201,144,112,152,138,140,207,158,140,56,142,192,69,166,138,61,25,65,204,208,20,25,231,61,153,24,13,235,61,153,20,36,149,237,201,208,16,57,137,140,219,158,76,20,85,141,246,100,18,1,181,142,61,25,18,14,83,145,241,217,147,17,199,17,184,200,84,177,39,35,136,25,154,34,227,188,39,19,52,206,107,79,38,216,254,0,246,100,104,136,148,69,134,135,147,129,200,52,19,50,222,147,105,44,214,187,39,67,194,161,35,50,44,76,180,69,70,28,71,196,34,3,137,30,90,34,35,136,25,8,145,41,140,20,22,34,99,189,39,147,130,164,178,61,25,26,34,39,145,113,219,147,137,162,170,209,158,76,34,160,214,177,39,67,194,97,42,50,62,123,50,226,56,2,23,153,42,246,100,4,49,67,83,100,156,247,100,98,52,172,247,100,82,144,84,182,39,67,67,228,36,50,110,123,50,81,84,53,218,147,73,4,212,58,246,100,72,56,76,69,198,103,79,70,28,71,224,34,83,197,158,140,32,102,104,138,140,243,158,76,140,134,245,158,76,10,146,202,246,100,104,136,156,68,198,109,79,38,138,170,70,123,50,137,128,90,199,158,12,9,135,169,200,248,236,201,136,227,8,92,100,170,216,147,17,196,12,77,145,113,222,147,9,137,148,215,158,76,176,253,1,236,201,208,16,41,139,12,15,39,3,145,105,38,100,188,39,211,88,172,119,79,134,132,67,71,100,88,152,104,139,140,56,142,136,69,6,18,61,180,68,70,16,51,16,34,83,24,41,44,68,198,122,79,38,5,73,101,123,50,52,68,78,34,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,132,195,84,100,124,246,100,196,113,4,46,50,85,236,201,8,98,134,166,200,56,239,201,196,104,88,239,201,164,32,169,108,79,134,134,200,73,100,220,246,100,162,168,106,180,39,147,8,168,117,236,201,144,112,152,138,140,207,158,140,56,142,192,69,166,138,61,25,65,204,208,20,25,231,61,153,24,13,235,61,153,20,36,149,237,201,208,16,57,137,140,219,158,76,20,85,141,246,100,18,1,181,142,61,25,18,14,83,145,241,217,147,17,199,17,184,200,84,177,39,35,136,25,154,34,227,188,39,19,170,117,94,123,50,193,222,7,176,39,67,67,164,44,50,60,156,12,68,166,49,108,188,39,211,152,169,119,79,134,132,67,71,100,88,152,104,139,140,56,142,136,69,6,18,61,180,68,70,16,51,16,34,83,24,41,44,68,198,122,79,38,5,73,101,123,50,52,68,78,34,227,182,39,19,69,85,163,61,153,68,64,173,99,79,134,132,195,84,100,124,246,100,196,113,4,46,50,85,236,201,8,98,134,166,200,56,239,201,196,104,88,239,201,164,
+32,169,108,79,134,134,200,73,100,220,246,100,162,168,106,180,39,147,8,168,117,236,201,144,112,152,138,140,207,158,140,56,142,192,69,166,138,61,25,65,204,208,20,25,231,61,153,24,13,235,61,153,20,36,149,237,201,208,16,57,137,140,219,158,76,20,85,141,246,100,18,1,181,142,61,25,18,14,83,145,241,217,147,17,199,17,184,200,84,177,39,35,136,25,154,34,99,191,39,211,190,177,243,20,192,174,79,27,203,61,153,137,237,58,247,100,152,16,225,69,166,0,39,77,145,105,167,245,62,76,200,106,79,230,98,177,194,61,153,92,56,192,34,35,193,68,69,100,194,235,160,215,133,113,132,39,50,35,139,117,237,201,176,224,192,137,140,24,19,23,145,49,216,147,201,10,158,254,123,50,76,136,156,68,198,126,79,102,26,85,181,247,100,150,3,170,243,158,76,46,28,166,34,99,184,39,147,136,170,138,123,50,25,1,213,111,79,134,5,135,169,200,216,239,201,36,35,168,193,158,76,86,240,244,223,147,97,66,228,36,50,246,123,50,211,168,170,189,39,179,28,80,157,247,100,114,225,48,21,25,195,61,153,68,84,85,220,147,201,8,168,126,123,50,44,56,76,69,198,126,79,102,16,192,226,203,168,173,203,101,169,27,169,43,43,151,209,16,41,139,12,15,39,3,145,137,46,181,55,42,151,37,238,179,175,163,92,70,194,161,35,50,44,76,180,69,70,28,71,196,34,3,137,30,90,34,35,136,25,8,145,41,140,20,22,34,99,93,46,75,65,82,89,185,140,134,200,73,100,220,202,101,81,84,53,42,151,37,2,106,29,229,50,18,14,83,145,241,41,151,137,227,8,92,100,170,40,151,9,98,134,166,200,56,151,203,98,52,172,203,101,41,72,42,43,151,209,16,57,137,140,91,185,44,138,170,70,229,178,68,64,173,163,92,70,194,97,42,50,62,229,50,113,28,129,139,76,21,229,50,65,204,208,20,25,231,114,89,124,79,168,117,185,44,117,89,104,101,229,50,26,34,101,145,225,225,100,32,50,209,125,195,70,229,178,196,85,195,117,148,203,72,56,116,68,134,133,137,182,200,136,227,136,88,100,32,209,67,75,100,4,49,3,33,50,133,145,194,66,100,172,203,101,41,72,42,43,151,209,16,57,137,140,91,185,44,138,170,70,229,178,68,64,173,163,92,70,194,97,42,50,62,229,50,113,28,129,139,76,21,229,50,65,204,208,20,25,231,114,89,140,134,117,185,44,5,73,101,229,50,26,34,39,145,113,43,151,69,81,213,168,92,150,8,168,117,148,203,72,56,76,69,198,167,92,38,142,35,112,145,169,162,92,38,136,25,154,34,227,92,46,139,175,112,179,46,151,165,238,113,171,172,92,70,67,164,44,50,60,156,12,68,38,186,10,210,168,92,150,184,5,178,142,114,25,9,135,142,200,176,48,209,22,25,113,28,17,139,12,36,122,104,137,140,32,102,32,68,166,48,82,88,136,140,117,185,44,5,73,101,229,50,26,34,39,145,113,43,151,69,81,213,168,92,150,8,168,117,148,203,72,56,76,69,198,167,92,38,142,35,112,145,169,162,92,38,136,25,154,34,227,92,46,139,209,176,46,151,165,32,169,172,92,70,67,228,36,50,110,229,178,40,170,26,149,203,18,1,181,142,114,25,9,135,169,200,248,148,203,196,113,4,46,50,85,148,203,4,49,67,83,100,156,203,101,226,187,185,1,34,3,185,165,91,95,100,4,247,117,99,69,166,240,230,110,188,200,144,151,218,195,69,134,117,159,189,181,200,144,112,232,136,12,11,19,109,145,17,199,17,177,200,64,162,135,150,200,8,98,6,66,100,10,35,133,133,200,88,151,203,32,183,116,219,138,140,75,185,172,240,230,110,85,145,49,42,151,177,238,179,119,20,25,203,114,25,11,19,75,145,177,41,151,65,162,135,133,200,24,150,203,10,35,133,133,200,88,151,203,32,183,116,219,138,140,75,185,172,240,230,110,85,145,49,42,151,177,238,179,119,20,25,203,114,25,11,19,75,145,177,41,151,65,162,135,133,200,24,150,203,10,35,133,150,200,24,95,191,60,177,253,1,148,203,60,174,95,46,192,201,64,100,12,175,95,190,88,172,183,92,102,125,253,178,4,19,109,145,49,186,126,121,100,177,218,114,153,229,245,203,98,76,92,68,198,186,92,86,239,245,203,76,136,156,68,198,173,92,102,120,253,242,114,64,173,163,92,102,125,253,178,4,19,75,145,177,41,151,213,119,253,50,11,14,
+83,145,113,46,151,25,95,191,156,21,60,43,43,151,121,92,191,92,128,147,173,200,24,149,203,234,188,126,57,23,14,83,145,241,41,151,25,93,191,156,17,80,171,40,151,89,94,191,44,198,68,83,100,218,194,157,211,205,152,19,219,117,150,203,152,16,225,69,166,0,39,77,145,105,167,101,122,51,230,197,98,133,229,178,92,56,192,34,35,193,68,69,100,194,174,144,237,205,152,35,139,117,149,203,88,112,224,68,70,140,137,139,200,24,148,203,178,130,167,127,185,140,9,145,147,200,216,151,203,166,81,85,187,92,182,28,80,157,203,101,185,112,152,138,140,97,185,44,17,85,21,203,101,25,1,213,175,92,198,130,195,84,100,236,203,101,131,0,102,124,105,217,196,246,7,144,201,120,92,90,86,128,147,129,200,24,94,90,118,177,88,111,38,99,125,105,153,4,19,109,145,49,186,180,108,100,177,218,76,198,242,210,50,49,38,46,34,99,157,201,212,123,105,25,19,34,39,145,113,203,100,12,47,45,91,14,168,117,100,50,214,151,150,73,48,177,20,25,155,76,166,190,75,203,88,112,152,138,140,115,38,99,124,159,204,196,246,7,144,201,120,220,39,83,128,147,129,200,24,222,39,115,177,88,111,38,99,125,159,140,4,19,109,145,49,186,79,102,100,177,218,76,198,242,62,25,49,38,46,34,99,157,201,212,123,159,12,19,34,39,145,113,203,100,12,239,147,89,14,168,117,100,50,214,247,201,72,48,177,20,25,155,76,166,190,251,100,88,112,152,138,140,115,38,99,220,234,127,98,251,3,200,100,60,90,253,23,224,100,32,50,134,173,254,47,22,235,205,100,172,91,253,75,48,209,22,25,163,86,255,35,139,213,102,50,150,173,254,197,152,184,136,140,117,38,83,111,171,127,38,68,78,34,227,150,201,24,182,250,95,14,168,117,100,50,214,173,254,37,152,88,138,140,77,38,83,95,171,127,22,28,166,34,227,156,201,24,119,97,158,216,254,0,50,25,143,46,204,5,56,25,136,140,97,23,230,139,197,122,51,25,235,46,204,18,76,180,69,198,168,11,243,200,98,181,153,140,101,23,102,49,38,46,34,99,157,201,212,219,133,153,9,145,147,200,184,101,50,134,93,152,151,3,106,29,153,140,117,23,102,9,38,150,34,99,147,201,212,215,133,153,5,135,169,200,56,103,50,198,13,50,39,182,63,128,76,198,163,65,102,1,78,6,34,99,216,32,243,98,177,222,76,198,186,65,166,4,19,109,145,49,106,144,57,178,88,109,38,99,217,32,83,140,137,139,200,88,103,50,245,54,200,100,66,228,36,50,110,153,140,97,131,204,229,128,90,71,38,99,221,32,83,130,137,165,200,216,100,50,245,53,200,100,193,97,42,50,246,153,76,59,19,167,222,101,19,219,117,102,50,76,136,240,34,83,128,147,166,200,180,211,50,237,93,118,177,88,97,38,147,11,7,88,100,36,152,168,136,76,144,57,219,222,101,35,139,117,101,50,44,56,112,34,35,198,196,76,100,140,219,202,76,108,127,0,34,227,209,86,166,0,39,3,145,49,108,43,115,177,88,175,200,88,183,149,145,96,162,45,50,70,109,101,70,22,171,21,25,203,182,50,98,76,204,68,198,248,141,255,137,237,15,64,100,60,222,248,47,192,201,64,100,12,223,248,191,88,172,87,100,172,223,248,151,96,162,45,50,70,111,252,143,44,86,43,50,150,111,252,139,49,49,19,25,227,151,49,39,182,63,0,145,241,120,25,179,0,39,3,145,49,124,25,243,98,177,94,145,177,126,25,83,130,137,182,200,24,189,140,57,178,88,173,200,88,190,140,41,198,196,76,100,140,223,147,153,216,254,0,68,198,227,61,153,2,156,12,68,198,240,61,153,139,197,122,69,198,250,61,25,9,38,218,34,99,244,158,204,200,98,181,34,99,249,158,140,24,19,51,145,49,62,194,60,177,253,1,136,140,199,17,230,2,156,12,68,198,240,8,243,197,98,189,34,99,125,132,89,130,137,182,200,24,29,97,30,89,172,86,100,44,143,48,139,49,193,137,204,121,102,255,124,142,96,237,25,132,185,179,83,51,183,116,254,249,187,175,210,209,253,159,103,85,166,129,96,123,187,89,93,255,178,250,199,230,176,143,176,89,152,65,230,157,161,228,108,50,249,146,156,226,253,254,118,18,240,153,112,165,129,26,90,93,98,81,214,52,242,49,99,162,149,63,207,127,190,138,143,181,12,206,89,241,188,215,76,231,21,143,73,99,187,229,12,
+10,115,128,242,135,7,77,10,20,33,107,228,248,176,144,225,112,165,155,199,117,97,220,121,21,168,203,226,202,196,110,49,87,218,57,32,185,194,132,38,5,138,140,43,5,248,176,144,161,103,199,17,171,176,255,84,143,88,73,102,99,42,86,243,19,116,21,43,222,148,52,197,138,231,61,29,177,226,207,193,68,172,114,157,164,46,86,156,137,104,138,21,203,79,74,98,197,159,131,137,88,101,186,72,95,172,56,19,49,17,171,112,34,175,30,177,146,204,198,84,172,230,39,232,42,86,188,41,105,138,21,207,123,58,98,197,159,131,137,88,229,58,73,93,172,56,19,209,20,43,150,159,148,196,138,63,7,19,177,202,116,145,190,88,113,38,98,34,86,225,223,245,136,149,100,54,166,98,53,63,65,87,177,226,77,73,83,172,120,222,211,17,43,254,28,76,196,42,215,73,234,98,197,153,136,166,88,177,252,164,36,86,252,57,152,136,85,166,139,244,197,138,51,17,53,177,138,95,171,242,217,179,74,189,97,85,229,158,21,13,151,137,88,241,48,51,19,171,232,181,77,211,61,171,196,123,155,53,237,89,145,208,104,138,21,11,31,27,177,18,199,157,66,177,130,68,27,93,177,18,196,24,156,88,21,70,22,59,177,242,217,179,74,193,83,229,158,21,13,151,171,88,57,239,89,69,17,217,116,207,42,17,140,107,218,179,34,161,113,16,43,207,61,43,113,220,81,18,171,138,246,172,4,49,70,95,172,170,216,179,138,145,241,217,179,74,193,83,229,158,21,13,151,171,88,57,239,89,69,17,217,116,207,42,17,140,107,218,179,34,161,113,16,43,207,61,43,113,220,81,18,171,138,246,172,4,49,70,95,172,170,216,179,138,145,241,217,179,74,193,83,229,158,21,13,151,171,88,57,239,89,69,17,217,116,207,42,17,140,107,218,179,34,161,113,16,43,207,61,43,113,220,81,18,171,138,246,172,4,49,70,95,172,170,216,179,138,187,52,249,236,89,165,26,54,85,185,103,69,195,101,34,86,60,204,204,196,42,234,2,103,186,103,149,104,3,87,211,158,21,9,141,166,88,177,240,177,17,43,113,220,41,20,43,72,180,209,21,43,65,140,193,137,85,97,100,177,19,43,159,61,171,20,60,85,238,89,209,112,185,138,149,243,158,85,20,145,77,247,172,18,193,184,166,61,43,18,26,7,177,242,220,179,18,199,29,37,177,170,104,207,74,16,99,244,197,170,138,61,171,24,25,159,61,171,20,60,85,238,89,209,112,185,138,149,243,158,85,20,145,77,247,172,18,193,184,166,61,43,18,26,7,177,242,220,179,18,199,29,37,177,170,104,207,74,16,99,244,197,170,138,61,171,24,25,159,61,171,20,60,85,238,89,209,112,185,138,149,243,158,85,20,145,77,247,172,18,193,184,166,61,43,18,26,7,177,242,220,179,18,199,29,37,177,170,104,207,74,16,99,244,197,170,138,61,171,184,233,187,207,158,85,170,255,123,149,123,86,52,92,38,98,197,195,204,76,172,162,75,37,76,247,172,18,183,74,212,180,103,69,66,163,41,86,44,124,108,196,74,28,119,10,197,10,18,109,116,197,74,16,99,112,98,85,24,89,236,196,202,103,207,42,5,79,149,123,86,52,92,174,98,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,132,198,65,172,60,247,172,196,113,71,73,172,42,218,179,18,196,24,125,177,170,98,207,42,70,198,103,207,42,5,79,149,123,86,52,92,174,98,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,132,198,65,172,60,247,172,196,113,71,73,172,42,218,179,18,196,24,125,177,170,98,207,42,70,198,103,207,42,5,79,149,123,86,52,92,174,98,229,188,103,21,69,100,211,61,171,68,48,174,105,207,138,132,198,65,172,60,247,172,196,113,71,73,172,42,218,179,18,196,24,125,177,170,98,207,42,190,67,50,252,219,94,172,82,215,73,74,102,163,46,86,52,92,38,98,197,195,204,76,172,162,59,106,121,222,43,20,171,196,37,181,252,57,232,137,21,9,141,166,88,177,240,177,17,43,113,220,41,20,43,72,180,209,21,43,65,140,193,137,85,97,100,209,21,43,226,46,74,3,177,98,92,75,233,47,86,52,92,38,98,197,195,204,76,172,150,239,186,213,19,171,252,203,110,221,196,138,132,70,83,172,88,248,216,136,149,56,238,20,138,21,36,218,232,138,149,32,198,224,196,170,48,178,192,197,170,237,168,225,122,83,240,100,6,
+53,159,6,100,194,165,37,86,5,152,233,139,85,59,57,135,155,130,47,118,171,61,13,152,11,141,138,88,73,240,81,20,171,208,246,201,227,166,224,145,221,26,79,3,178,160,65,139,149,24,31,71,177,50,59,13,152,21,120,107,57,13,200,132,203,85,172,188,78,3,78,35,178,205,105,192,229,96,92,197,105,192,92,104,28,196,202,252,52,96,34,34,171,159,6,204,8,198,222,167,1,89,208,56,136,149,215,105,192,100,244,53,59,13,152,21,120,107,57,13,200,132,203,85,172,188,78,3,78,35,178,205,105,192,229,96,92,197,105,192,92,104,28,196,202,252,52,96,34,34,171,159,6,204,8,198,222,167,1,89,208,56,136,149,215,105,192,100,244,53,59,13,152,21,120,107,57,13,200,132,203,85,172,188,78,3,78,35,178,205,105,192,229,96,92,197,105,192,92,104,28,196,202,252,52,96,34,34,171,159,6,204,8,198,222,167,1,89,208,56,136,149,215,105,192,65,216,115,185,41,120,50,131,15,102,207,202,239,166,224,2,204,204,196,202,252,166,224,139,221,218,247,172,124,110,10,150,224,99,35,86,166,55,5,143,236,86,190,103,101,127,83,176,24,31,71,177,242,217,179,170,253,166,96,38,92,174,98,229,188,103,101,126,83,240,114,48,174,105,207,202,231,166,96,9,62,246,98,101,185,103,85,235,77,193,44,104,28,196,170,138,61,43,151,155,130,179,2,111,149,123,86,126,55,5,23,96,230,33,86,166,123,86,53,223,20,156,11,141,131,88,121,238,89,153,222,20,156,17,140,43,218,179,178,191,41,88,140,143,177,88,185,92,190,56,153,193,7,83,6,244,187,124,177,0,51,51,177,50,191,124,241,98,183,246,50,160,207,229,139,18,124,108,196,202,244,242,197,145,221,202,203,128,246,151,47,138,241,113,20,43,159,50,96,237,151,47,50,225,114,21,43,231,50,160,249,229,139,203,193,184,166,50,160,207,229,139,18,124,236,197,202,178,12,88,235,229,139,44,104,28,196,170,138,50,160,203,229,139,89,129,183,202,50,160,223,229,139,5,152,121,136,149,105,25,176,230,203,23,115,161,113,16,43,207,50,160,233,229,139,25,193,184,162,50,160,253,229,139,98,124,140,197,202,229,62,171,201,12,62,152,50,160,223,125,86,5,152,153,137,149,249,125,86,23,187,181,151,1,125,238,179,146,224,99,35,86,166,247,89,141,236,86,94,6,180,191,207,74,140,143,163,88,249,148,1,107,191,207,138,9,151,171,88,57,151,1,205,239,179,90,14,198,53,149,1,125,238,179,146,224,99,47,86,150,101,192,90,239,179,98,65,227,32,86,85,148,1,93,238,179,202,10,188,85,150,1,253,238,179,42,192,204,67,172,76,203,128,53,223,103,149,11,141,131,88,121,150,1,77,239,179,202,8,198,21,149,1,237,239,179,18,227,99,44,86,46,87,132,76,102,80,243,21,33,76,184,76,196,170,182,43,66,250,160,104,126,69,200,197,110,181,87,132,228,66,163,41,86,181,92,17,18,5,69,211,43,66,70,118,107,188,34,132,5,141,162,88,213,118,69,200,32,236,185,92,17,50,153,65,205,87,132,48,225,50,17,171,218,174,8,233,131,162,249,21,33,23,187,213,94,17,146,11,141,166,88,213,114,69,72,20,20,77,175,8,25,217,173,241,138,16,22,52,138,98,85,219,21,33,237,129,15,215,43,66,38,51,168,249,128,5,19,46,45,177,42,192,76,95,172,218,201,57,92,17,114,177,91,237,1,139,92,104,84,196,74,130,143,162,88,133,83,137,30,87,132,140,236,214,120,192,130,5,13,90,172,196,248,56,138,149,217,1,139,172,192,91,203,1,11,38,92,174,98,229,117,192,98,26,145,109,14,88,44,7,227,42,14,88,228,66,227,32,86,230,7,44,18,17,89,253,128,69,70,48,246,62,96,193,130,198,65,172,188,14,88,36,163,175,217,1,139,172,192,91,203,1,11,38,92,174,98,229,117,192,98,26,145,109,14,88,44,7,227,42,14,88,228,66,227,32,86,230,7,44,18,17,89,253,128,69,70,48,246,62,96,193,130,198,65,172,188,14,88,36,163,175,217,21,33,89,129,183,150,43,66,152,112,185,138,149,215,21,33,211,136,108,115,69,200,114,48,174,226,138,144,92,104,28,196,202,252,138,144,68,68,86,191,34,36,35,24,123,95,17,194,130,198,65,172,188,174,8,25,132,61,151,43,66,38,51,248,96,246,172,252,174,8,41,192,204,76,172,
+204,175,8,185,216,173,125,207,202,231,138,16,9,62,54,98,101,122,69,200,200,110,229,123,86,246,87,132,136,241,113,20,43,159,61,171,218,175,8,97,194,229,42,86,206,123,86,230,87,132,44,7,227,154,246,172,124,174,8,145,224,99,47,86,150,123,86,181,94,17,194,130,198,65,172,170,216,179,114,185,34,36,43,240,86,185,103,229,119,69,72,1,102,30,98,101,186,103,85,243,21,33,185,208,56,136,149,231,158,149,233,21,33,25,193,184,162,61,43,251,43,66,196,248,24,139,149,203,21,33,147,25,124,48,101,64,191,43,66,10,48,51,19,43,243,43,66,46,118,107,47,3,250,92,17,34,193,199,70,172,76,175,8,25,217,173,188,12,104,127,69,136,24,31,71,177,242,41,3,214,126,69,8,19,46,87,177,114,46,3,154,95,17,178,28,140,107,42,3,250,92,17,34,193,199,94,172,44,203,128,181,94,17,194,130,198,65,172,170,40,3,186,116,93,159,204,224,131,201,172,252,186,174,23,96,102,38,86,230,93,215,47,118,107,207,172,124,186,174,75,240,177,17,43,211,174,235,35,187,149,103,86,246,93,215,197,248,56,138,149,79,102,85,123,215,117,38,92,174,98,229,156,89,153,119,93,95,14,198,53,101,86,62,93,215,37,248,216,139,149,101,102,85,107,215,117,22,52,14,98,85,69,102,229,210,200,118,50,131,154,27,217,50,225,50,17,171,218,26,217,246,65,209,188,145,237,197,110,181,141,108,115,161,209,20,171,90,26,217,70,65,209,180,145,237,200,110,141,141,108,89,208,40,138,85,109,141,108,7,97,207,165,145,237,100,6,53,55,178,101,194,101,34,86,181,53,178,237,131,162,121,35,219,139,221,106,27,217,230,66,163,41,86,181,52,178,141,130,162,105,35,219,145,221,26,27,217,178,160,81,20,171,218,26,217,182,153,158,107,35,219,201,12,106,222,179,98,194,165,37,86,5,152,233,139,85,59,57,135,70,182,23,187,213,238,89,229,66,163,34,86,18,124,20,197,42,148,35,61,26,217,142,236,214,184,103,197,130,6,45,86,98,124,28,197,202,108,207,42,43,240,214,178,103,197,132,203,85,172,188,246,172,166,17,217,102,207,106,57,24,87,177,103,149,11,141,131,88,153,239,89,37,34,178,250,158,85,70,48,246,222,179,98,65,227,32,86,94,123,86,201,232,107,246,82,112,86,224,173,229,165,96,38,92,174,98,229,245,82,240,52,34,219,188,20,188,28,140,171,120,41,56,23,26,7,177,50,127,41,56,17,145,213,95,10,206,8,198,222,47,5,179,160,113,16,43,175,151,130,147,209,215,172,145,109,86,224,173,165,145,45,19,46,87,177,242,106,100,59,141,200,54,141,108,151,131,113,21,141,108,115,161,113,16,43,243,70,182,137,136,172,222,200,54,35,24,123,55,178,101,65,227,32,86,94,141,108,7,97,207,165,145,237,100,6,31,204,158,149,95,35,219,2,204,204,196,202,188,145,237,197,110,237,123,86,62,141,108,37,248,216,136,149,105,35,219,145,221,202,247,172,236,27,217,138,241,113,20,43,159,61,171,218,27,217,50,225,114,21,43,231,61,43,243,70,182,203,193,184,166,61,43,159,70,182,18,124,236,197,202,114,207,170,214,70,182,44,104,28,196,170,138,61,43,151,70,182,89,129,183,202,61,43,191,70,182,5,152,121,136,149,233,158,85,205,141,108,115,161,113,16,43,207,61,43,211,70,182,25,193,184,162,61,43,251,70,182,98,124,140,197,202,165,145,237,100,6,31,76,25,208,175,145,109,1,102,102,98,101,222,200,246,98,183,246,50,160,79,35,91,9,62,54,98,101,218,200,118,100,183,242,50,160,125,35,91,49,62,142,98,229,83,6,172,189,145,45,19,46,87,177,114,46,3,154,55,178,93,14,198,53,149,1,125,26,217,74,240,177,23,43,203,50,96,173,141,108,89,208,56,136,85,21,101,64,151,70,182,147,25,124,48,153,149,95,35,219,2,204,204,196,202,188,145,237,197,110,237,153,149,79,35,91,9,62,54,98,101,218,200,118,100,183,242,204,202,190,145,173,24,31,99,177,114,233,13,56,153,65,205,189,1,153,112,153,136,85,109,189,1,251,160,104,222,27,240,98,183,218,222,128,185,208,104,138,85,45,189,1,163,160,104,218,27,112,100,183,198,222,128,44,104,20,197,170,182,222,128,131,176,231,210,27,112,50,131,154,123,3,50,225,50,17,171,218,122,3,246,65,209,188,55,224,197,
+110,181,189,1,115,161,209,20,171,90,122,3,70,65,209,180,55,224,200,110,141,189,1,89,208,40,138,85,109,189,1,91,241,156,123,203,213,44,179,154,204,160,230,204,138,9,151,150,88,21,96,166,47,86,237,228,6,111,190,218,100,86,23,187,213,102,86,185,208,168,136,149,4,31,69,177,10,25,222,117,97,220,145,136,213,200,110,141,153,21,11,26,180,88,137,241,49,22,171,248,156,164,143,88,165,14,75,86,41,86,52,92,38,98,197,195,204,76,172,162,243,217,166,98,149,56,154,93,147,88,145,208,104,138,21,11,31,27,177,18,199,157,66,177,130,68,27,93,177,18,196,24,156,88,21,70,22,93,177,138,143,158,248,136,85,234,252,73,149,98,69,195,101,34,86,60,204,204,196,42,58,242,102,42,86,137,211,110,53,137,21,9,141,166,88,177,240,177,17,43,113,220,41,20,43,72,180,209,21,43,65,140,193,137,85,97,100,209,21,171,248,232,137,143,88,165,206,159,84,41,86,52,92,38,98,197,195,204,76,172,162,35,111,166,98,149,56,237,86,147,88,145,208,104,138,21,11,31,27,177,18,199,157,66,177,130,68,27,93,177,18,196,24,156,88,21,70,22,93,177,114,57,13,56,153,193,7,35,86,126,167,1,11,48,51,19,43,243,211,128,23,187,181,139,149,207,105,64,9,62,54,98,101,122,26,112,100,183,114,177,178,63,13,40,198,199,88,172,92,78,3,78,102,80,243,105,64,38,92,38,98,85,219,105,192,62,40,154,159,6,188,216,173,246,52,96,46,52,154,98,85,203,105,192,40,40,154,158,6,28,217,173,241,52,32,11,26,69,177,170,237,52,96,59,159,185,227,109,102,98,53,153,65,205,98,197,132,75,75,172,10,48,211,23,171,118,114,131,35,111,54,98,117,177,91,173,88,229,66,163,34,86,18,124,20,197,42,136,230,117,97,220,145,136,213,200,110,141,98,197,130,6,45,86,98,124,140,197,42,62,122,226,35,86,169,243,39,85,138,21,13,151,137,88,241,48,51,19,171,232,200,155,169,88,37,78,187,213,36,86,36,52,154,98,197,194,199,70,172,196,113,167,80,172,32,209,70,87,172,4,49,6,39,86,133,145,69,87,172,226,163,39,62,98,149,58,127,82,165,88,209,112,153,136,21,15,51,51,177,138,142,188,153,138,85,226,180,91,77,98,69,66,163,41,86,44,124,108,196,74,28,119,10,197,10,18,109,116,197,74,16,99,112,98,85,24,89,116,197,42,62,122,226,35,86,169,243,39,85,138,21,13,151,137,88,241,48,51,19,171,232,200,155,169,88,37,78,187,213,36,86,36,52,154,98,197,194,199,70,172,196,113,167,80,172,32,209,70,87,172,4,49,6,39,86,133,145,69,87,172,226,163,39,62,98,149,58,127,82,165,88,209,112,153,136,21,15,51,51,177,138,142,188,153,138,85,226,180,91,77,98,69,66,163,41,86,44,124,108,196,74,28,119,10,197,10,18,109,116,197,74,16,99,112,98,85,24,89,116,197,202,229,52,224,100,6,31,140,88,249,157,6,44,192,204,76,172,204,79,3,94,236,214,46,86,62,167,1,37,248,216,136,149,233,105,192,145,221,202,197,202,254,52,160,24,31,180,88,157,231,215,252,237,57,242,93,111,227,70,115,219,139,146,135,127,143,230,244,229,183,179,209,174,249,118,19,239,162,245,47,142,63,183,126,174,173,89,12,198,19,136,76,190,15,255,225,26,107,109,189,162,70,45,89,78,103,33,103,49,157,169,107,177,151,94,117,192,81,163,22,44,166,183,144,90,204,60,55,194,121,163,185,211,149,225,223,8,238,141,199,159,93,31,211,22,135,123,193,228,224,248,95,174,177,69,238,157,71,45,89,14,139,123,141,169,107,177,151,146,220,27,142,90,176,24,9,247,218,227,3,153,183,126,75,184,55,25,63,243,210,93,20,247,90,147,212,181,212,108,238,93,70,45,89,14,135,123,193,212,181,216,75,41,238,141,70,45,88,140,132,123,237,110,96,230,189,136,18,238,77,198,207,188,150,12,197,189,214,36,117,113,31,155,123,151,81,75,150,195,225,94,48,117,45,246,82,138,123,163,81,11,22,35,225,30,231,154,51,9,247,164,247,151,161,184,151,117,15,23,155,123,236,11,182,138,185,151,127,81,20,135,123,178,27,160,36,220,59,27,142,170,44,156,92,227,187,239,231,232,240,221,247,67,230,45,13,158,249,48,187,96,136,242,212,165,20,144,149,101,204,89,10,134,94,
+17,67,22,44,164,29,62,99,25,156,252,98,198,206,171,22,47,98,72,249,50,186,225,201,48,23,147,129,145,89,240,153,38,76,43,48,76,203,201,41,152,76,227,38,20,133,76,203,206,38,242,153,38,74,37,32,76,227,228,17,108,166,73,147,8,8,211,178,50,8,30,211,216,233,67,25,211,242,115,135,108,166,201,18,7,8,211,56,89,3,155,105,210,148,1,194,180,172,124,129,199,52,118,178,80,198,180,252,76,33,155,105,178,52,1,194,52,78,142,192,102,154,52,65,128,48,45,43,59,224,49,141,157,26,148,49,45,63,47,200,102,154,44,41,224,51,237,108,245,103,97,78,240,95,243,28,248,175,49,219,126,6,164,5,139,182,40,79,253,204,204,12,102,141,181,182,94,81,163,150,44,167,179,144,179,24,78,126,240,95,179,204,248,175,17,243,126,46,72,17,22,44,144,97,238,103,97,150,32,226,158,48,81,128,113,47,39,87,224,115,143,155,46,148,115,47,59,99,96,113,79,148,52,160,184,199,201,27,36,220,147,166,14,40,238,101,101,15,108,238,177,19,136,98,238,229,231,16,28,238,201,210,8,20,247,56,153,132,132,123,210,100,2,197,189,172,124,130,205,61,118,74,81,204,189,252,172,130,195,61,89,98,129,226,30,39,183,144,112,79,154,94,160,184,151,149,97,176,185,199,78,50,138,185,151,159,103,112,184,39,75,53,36,220,59,27,254,221,239,68,207,123,223,252,240,167,244,105,216,223,253,174,61,115,122,88,111,143,155,203,97,180,253,227,105,181,127,211,124,119,247,118,179,58,110,110,246,187,219,213,254,97,211,124,125,27,1,177,52,159,204,103,16,122,110,137,67,98,162,9,223,29,223,77,206,203,50,145,92,192,112,97,14,75,71,236,178,38,149,15,39,23,72,225,172,131,239,25,143,230,11,126,14,179,123,85,192,64,225,163,60,53,35,53,222,241,80,75,226,133,96,155,28,58,30,104,114,142,113,50,166,180,71,95,181,159,0,57,199,164,25,22,53,35,45,142,49,81,75,226,5,224,88,1,116,60,208,152,115,37,69,44,78,145,106,16,213,84,114,85,191,168,210,72,58,136,42,15,78,47,81,141,106,14,142,162,154,168,81,84,43,170,36,106,118,162,202,130,206,69,84,197,113,14,42,170,144,232,102,40,170,130,152,166,37,170,133,145,204,84,84,227,218,79,13,162,154,170,26,213,47,170,52,146,14,162,202,131,211,75,84,163,98,170,163,168,38,138,175,213,138,42,137,154,157,168,178,160,115,17,85,113,156,131,138,42,36,186,25,138,170,32,166,105,137,106,97,36,51,21,213,184,168,93,131,168,166,202,225,245,139,42,141,164,131,168,242,224,244,18,213,104,151,200,81,84,19,187,74,213,138,42,137,154,157,168,178,160,115,17,85,113,156,131,138,42,36,186,25,138,170,32,166,105,137,106,97,36,211,22,213,193,57,163,184,106,62,115,126,197,66,84,39,243,201,60,91,227,47,170,76,36,109,68,181,0,78,115,81,237,15,135,69,187,131,60,63,99,68,245,50,139,114,230,89,136,106,46,106,6,162,42,129,206,78,84,163,51,123,226,56,87,46,170,163,89,20,115,76,91,84,89,168,233,138,170,24,58,95,81,37,142,157,154,139,42,227,192,106,101,162,74,35,233,32,170,60,56,189,68,117,249,28,183,149,168,230,159,251,174,67,84,73,212,236,68,149,5,157,139,168,138,227,28,84,84,33,209,205,80,84,5,49,77,75,84,11,35,153,169,168,198,85,243,26,68,53,85,58,175,95,84,105,36,29,68,149,7,167,151,168,70,187,131,142,162,154,216,24,172,86,84,73,212,236,68,149,5,157,139,168,138,227,28,84,84,33,209,205,80,84,5,49,77,75,84,11,35,153,169,168,198,85,243,26,68,53,85,58,175,95,84,105,36,29,68,149,7,167,151,168,70,187,131,142,162,154,216,24,172,86,84,73,212,236,68,149,5,157,139,168,138,227,28,84,84,33,209,205,80,84,5,49,77,75,84,11,35,153,182,168,14,222,159,143,171,230,51,239,101,91,136,234,100,62,153,239,140,251,139,42,19,73,27,81,45,128,211,92,84,251,166,7,209,238,32,207,207,24,81,189,204,162,156,121,22,162,154,139,154,129,168,74,160,179,19,213,168,23,133,56,206,149,139,234,104,22,197,28,211,22,85,22,106,186,162,42,134,206,87,84,227,170,121,13,162,154,42,157,215,47,170,52,146,14,162,202,131,211,75,84,163,221,65,
+71,81,77,108,12,86,43,170,36,106,118,162,202,130,206,69,84,197,113,14,42,170,144,232,102,40,170,130,152,166,37,170,133,145,204,84,84,137,30,101,230,162,202,232,110,86,153,168,210,72,58,136,42,15,78,47,81,93,110,250,103,37,170,249,77,2,235,16,85,18,53,59,81,101,65,231,34,170,226,56,7,21,85,72,116,51,20,85,65,76,211,18,213,194,72,102,42,170,113,213,188,6,81,77,149,206,235,23,85,26,73,7,81,229,193,233,37,170,209,238,160,163,168,38,54,6,171,21,85,18,53,59,81,101,65,231,34,170,226,56,7,21,85,72,116,51,20,85,65,76,211,18,213,194,72,166,45,170,131,190,208,113,213,124,166,223,176,133,168,78,230,147,217,11,217,95,84,153,72,218,136,106,1,156,230,162,218,55,243,142,118,7,121,126,198,136,234,101,22,229,204,179,16,213,92,212,12,68,85,2,157,157,168,70,61,214,197,113,174,92,84,71,179,40,230,152,182,168,178,80,211,21,85,49,116,190,162,26,87,205,107,16,213,84,233,188,126,81,165,145,116,16,85,30,156,94,162,26,237,14,58,138,106,98,99,176,90,81,37,81,179,19,85,22,116,46,162,42,142,115,80,81,133,68,55,67,81,21,196,52,45,81,45,140,100,166,162,26,87,205,107,16,213,84,233,188,126,81,165,145,116,16,85,30,156,94,162,26,237,14,58,138,106,98,99,176,90,81,37,81,179,19,85,22,116,46,162,42,142,115,80,81,133,68,55,67,81,21,196,52,45,81,45,140,100,166,162,74,92,104,103,46,170,140,171,240,42,19,85,26,73,7,81,229,193,233,37,170,203,55,68,90,137,106,254,141,146,117,136,42,137,154,157,168,178,160,115,17,85,113,156,131,138,42,36,186,25,138,170,32,166,105,137,106,97,36,131,138,234,121,182,95,124,33,186,6,244,251,37,229,250,226,11,185,170,46,205,39,179,113,50,61,55,36,243,14,133,23,170,126,63,47,90,61,134,66,14,30,128,23,170,46,77,16,27,241,130,239,25,87,131,46,248,57,204,238,85,1,3,133,183,130,82,51,82,227,29,15,181,36,94,8,182,201,161,227,129,38,231,24,231,106,208,239,23,52,44,124,2,228,28,147,222,10,74,205,72,139,99,76,212,146,120,1,56,86,0,29,15,52,105,170,154,18,49,226,202,60,115,81,101,220,155,87,153,168,210,72,58,136,42,15,78,47,81,93,190,26,212,74,84,243,111,5,173,67,84,73,212,236,68,149,5,157,139,168,138,227,28,84,84,33,209,205,80,84,5,49,77,75,84,11,35,153,169,168,18,87,230,153,139,42,227,222,188,202,68,149,70,210,65,84,121,112,122,137,234,242,213,160,86,162,154,127,43,104,29,162,74,162,102,39,170,44,232,92,68,85,28,231,160,162,10,137,110,134,162,42,136,105,90,162,90,24,201,76,69,149,184,50,207,92,84,25,247,230,85,38,170,52,146,14,162,202,131,211,75,84,151,175,6,181,18,213,252,91,65,235,16,85,18,53,59,81,101,65,231,34,170,226,56,7,21,85,72,116,51,20,85,65,76,211,18,213,194,72,166,45,170,156,107,64,45,68,85,122,3,168,191,168,50,145,180,17,213,2,56,205,69,53,235,106,80,117,81,101,223,10,234,44,170,185,168,25,136,170,4,58,59,81,205,191,26,84,83,84,101,183,130,250,137,42,11,53,93,81,21,67,231,43,170,196,149,121,230,162,202,184,55,175,50,81,165,145,116,16,85,30,156,94,162,186,124,53,168,149,168,230,223,10,90,135,168,146,168,217,137,42,11,58,23,81,21,199,57,168,168,66,162,155,161,168,10,98,154,150,168,22,70,50,83,81,37,174,204,51,23,85,198,189,121,149,137,42,141,164,131,168,242,224,244,18,213,229,171,65,173,68,53,255,86,208,58,68,149,68,205,78,84,89,208,185,136,170,56,206,65,69,21,18,221,12,69,85,16,211,180,68,181,48,146,153,138,42,113,101,158,185,168,50,238,205,171,76,84,105,36,29,68,149,7,167,151,168,46,95,13,106,37,170,249,183,130,214,33,170,36,106,118,162,202,130,206,69,84,197,113,14,42,170,144,232,102,40,170,130,152,166,37,170,133,145,76,91,84,57,215,128,90,136,170,244,6,80,127,81,101,34,105,35,170,5,112,154,139,106,214,213,160,234,162,202,190,21,212,89,84,115,81,51,16,85,9,116,118,162,154,127,53,168,166,168,202,110,5,245,19,85,22,106,186,162,42,134,
+206,87,84,137,43,243,204,69,149,113,111,94,101,162,74,35,233,32,170,60,56,189,68,117,249,106,80,43,81,205,191,21,180,14,81,37,81,179,19,85,22,116,46,162,42,142,115,80,81,133,68,55,67,81,21,196,52,45,81,45,140,100,166,162,74,92,153,103,46,170,140,123,243,42,19,85,26,73,7,81,229,193,233,37,170,203,87,131,90,137,106,254,173,160,117,136,42,137,154,157,168,178,160,115,17,85,113,156,131,138,42,36,186,25,138,170,32,166,105,137,106,97,36,51,21,85,226,202,60,115,81,101,220,155,87,153,168,210,72,58,136,42,15,78,47,81,93,190,26,212,74,84,243,111,5,173,67,84,73,212,236,68,149,5,157,139,168,138,227,28,84,84,33,209,205,80,84,5,49,77,75,84,11,35,153,182,168,114,174,1,181,16,85,233,13,160,254,162,202,68,210,70,84,11,224,52,23,213,172,171,65,213,69,149,125,43,168,179,168,230,162,102,32,170,18,232,236,68,53,255,106,80,77,81,149,221,10,234,39,170,44,212,116,69,85,12,157,175,168,18,87,230,153,139,42,227,222,188,202,68,149,70,210,65,84,121,112,122,137,234,242,213,160,86,162,154,127,43,104,29,162,74,162,102,39,170,44,232,92,68,85,28,231,160,162,10,137,110,134,162,42,136,105,90,162,90,24,201,76,69,149,184,50,207,92,84,25,247,230,85,38,170,52,146,14,162,202,131,211,75,84,151,175,6,181,18,213,252,91,65,235,16,85,18,53,59,81,101,65,231,34,170,226,56,7,21,85,72,116,51,20,85,65,76,211,18,213,194,72,102,42,170,196,149,121,230,162,202,184,55,175,50,81,165,145,116,16,85,30,156,94,162,186,124,53,168,149,168,230,223,10,90,135,168,146,168,217,137,42,11,58,23,81,21,199,57,168,168,66,162,155,161,168,10,98,154,150,168,22,70,50,168,168,94,46,204,189,116,92,223,198,47,50,110,163,123,8,182,147,61,223,111,126,156,189,185,186,137,179,241,93,188,233,161,103,91,32,115,204,204,194,48,180,29,89,123,31,254,195,180,211,152,121,181,60,96,193,34,86,169,235,151,7,22,59,43,215,82,143,188,10,72,45,15,40,95,66,59,120,106,9,51,20,56,158,14,81,245,185,249,2,199,174,201,208,118,236,106,173,189,15,255,1,177,235,50,160,1,187,130,149,107,169,71,230,216,53,26,208,142,93,193,194,153,2,98,183,207,178,107,50,180,29,187,90,107,239,195,127,64,236,186,12,104,192,174,96,229,186,136,0,203,3,218,177,43,125,63,118,185,50,102,221,114,173,163,140,211,235,151,11,149,113,249,18,101,176,50,38,110,247,149,43,99,198,29,189,250,236,26,92,170,136,101,87,242,146,68,77,118,197,247,144,66,216,149,186,77,84,141,93,124,143,16,236,42,243,67,17,187,6,183,139,97,217,149,188,45,76,147,93,241,133,124,16,118,165,174,213,83,99,23,223,35,4,187,202,252,80,196,174,193,53,59,88,118,37,175,205,209,100,87,124,51,21,132,93,169,251,165,212,216,197,247,8,193,174,50,63,20,177,235,205,157,90,236,10,67,155,179,171,49,138,101,87,51,160,45,187,248,30,33,216,85,230,135,34,118,221,94,223,105,177,43,12,109,206,174,198,40,150,93,205,128,182,236,226,123,132,96,87,153,31,216,245,174,212,253,95,128,122,87,206,45,94,74,245,174,201,245,82,165,245,174,197,75,162,208,245,174,249,219,139,10,234,93,244,29,68,6,236,194,230,140,89,215,217,168,178,11,151,51,46,223,150,162,199,46,76,206,152,113,25,135,1,187,176,57,99,214,189,14,170,236,194,229,140,203,215,6,232,177,11,147,51,102,116,165,55,96,23,54,103,204,106,112,174,202,46,92,206,184,220,63,91,143,93,152,156,49,163,61,179,1,187,176,57,227,100,104,115,118,225,114,198,203,128,182,236,194,228,140,163,1,157,216,133,205,25,39,67,155,179,11,151,51,94,6,180,101,23,38,103,28,13,104,199,174,100,127,243,114,118,101,117,41,215,97,215,180,125,118,33,187,150,155,96,131,217,149,232,206,44,103,87,70,143,101,3,118,97,115,198,172,118,189,170,236,194,229,140,203,221,96,245,216,133,201,25,51,154,141,26,176,11,155,51,102,245,173,84,101,23,46,103,92,110,139,168,199,46,76,206,152,209,117,207,128,93,216,156,49,171,129,155,42,187,112,57,227,114,127,48,61,118,97,114,198,140,246,83,6,236,194,
+230,140,147,161,205,217,133,203,25,47,3,218,178,11,147,51,142,6,116,98,23,54,103,156,12,109,206,46,92,206,120,25,208,150,93,152,156,113,52,160,29,187,146,253,219,202,217,149,213,133,77,135,93,211,246,96,133,236,90,110,242,5,102,87,162,251,148,156,93,25,61,164,12,216,133,205,25,179,218,17,169,178,11,151,51,46,119,187,209,99,23,38,103,204,104,166,98,192,46,108,206,152,213,151,67,149,93,184,156,113,185,237,131,30,187,48,57,99,70,87,1,3,118,97,115,198,172,23,212,85,217,133,203,25,151,223,127,214,99,23,38,103,204,120,189,214,128,93,216,156,113,50,180,57,187,112,57,227,101,64,91,118,97,114,198,209,128,78,236,194,230,140,147,161,205,217,133,203,25,47,3,218,178,11,147,51,142,6,180,99,87,203,101,157,156,113,50,180,29,187,90,211,200,156,241,50,160,1,187,66,132,132,230,140,163,1,157,216,133,205,25,39,67,155,179,11,151,51,94,6,180,101,23,38,103,28,13,232,196,46,108,206,56,25,218,156,93,184,156,241,50,160,45,187,48,57,227,104,64,39,118,97,115,198,201,208,230,236,194,229,140,151,1,109,217,133,201,25,71,3,58,177,11,155,51,78,134,54,103,23,46,103,188,12,104,203,46,76,206,56,26,208,137,93,216,156,113,50,180,57,187,112,57,227,101,64,91,118,97,114,198,209,128,118,236,106,173,233,228,140,147,161,237,216,213,154,70,230,140,151,1,13,216,21,56,12,205,25,71,3,58,177,11,155,51,78,134,54,103,23,46,103,188,12,104,203,46,76,206,56,26,208,137,93,216,156,113,50,180,57,187,112,57,227,101,64,91,118,97,114,198,209,128,78,236,194,230,140,147,161,205,217,133,203,25,47,3,218,178,11,147,51,142,6,116,98,23,54,103,156,12,109,206,46,92,206,120,25,208,150,93,152,156,113,52,160,19,187,176,57,227,100,104,115,118,225,114,198,203,128,182,236,194,228,140,163,1,181,216,117,177,249,66,214,83,252,229,172,227,95,140,8,246,162,188,171,120,218,16,233,159,23,188,190,226,47,231,104,240,98,72,178,23,242,206,226,169,225,51,150,193,234,45,254,114,142,10,47,134,68,123,33,239,46,158,26,158,14,100,47,100,253,197,185,76,19,119,24,71,48,45,175,199,56,139,105,252,46,227,69,76,99,244,25,207,101,154,176,211,56,130,105,172,94,227,92,166,137,187,141,35,152,150,215,111,156,197,52,126,199,241,34,166,49,122,142,231,50,77,216,117,28,193,52,86,223,113,182,122,74,59,143,67,212,51,171,247,56,79,61,217,221,199,203,212,51,191,255,120,182,122,202,58,144,195,153,70,85,251,138,152,198,169,252,1,153,70,212,96,37,76,99,84,97,81,76,227,123,134,100,90,153,63,10,153,70,85,254,138,152,198,169,2,2,153,70,212,99,37,76,99,84,100,81,76,227,123,134,100,90,153,63,10,153,70,85,1,139,152,198,169,8,2,153,70,212,102,37,76,99,84,103,81,76,227,123,134,100,90,153,63,10,153,70,85,4,139,152,198,169,14,2,153,70,212,105,37,76,99,84,106,81,76,227,123,134,100,90,153,63,10,153,70,85,7,139,152,198,169,20,2,153,70,212,108,37,76,99,84,109,81,76,227,123,134,100,90,153,63,4,245,52,78,255,114,118,61,77,218,193,28,82,79,203,234,97,206,171,167,177,187,152,151,213,211,242,251,152,103,215,211,100,157,204,225,76,67,231,158,226,110,230,64,166,33,115,79,126,71,115,20,211,80,185,167,176,171,57,156,105,232,220,83,220,217,28,200,52,100,238,201,239,110,142,98,26,42,247,20,118,56,135,51,13,157,123,138,187,156,3,153,134,204,61,249,157,206,81,76,67,229,158,194,110,231,112,166,161,115,79,113,199,115,32,211,144,185,39,191,235,57,138,105,168,220,83,216,249,28,206,52,116,238,41,238,126,14,100,26,50,247,228,119,64,71,49,13,149,123,10,187,160,35,152,198,234,131,206,101,154,184,19,58,130,105,121,189,208,89,76,227,119,67,47,98,26,163,31,122,46,211,132,29,209,225,76,67,231,158,226,174,232,64,166,33,115,79,126,103,116,20,211,80,185,167,176,59,58,156,105,232,220,83,220,33,29,200,52,100,238,201,239,146,142,98,26,42,247,20,118,74,135,51,13,157,123,138,187,165,3,153,134,204,61,249,29,211,81,76,67,229,158,194,174,233,112,166,161,115,79,113,231,116,32,
+211,144,185,39,191,123,58,138,105,168,220,83,216,65,29,206,52,116,238,41,238,162,14,100,26,50,247,228,119,82,71,49,13,149,123,10,187,169,35,152,198,234,167,206,101,154,184,163,58,130,105,121,61,213,89,76,227,119,85,47,98,26,163,175,122,46,211,132,157,213,225,76,67,231,158,226,238,234,64,166,33,115,79,126,135,117,20,211,80,185,167,176,203,58,156,105,232,220,83,220,105,29,200,52,100,238,201,239,182,142,98,26,42,247,20,118,92,135,51,13,157,123,138,187,174,3,153,134,204,61,249,157,215,81,76,67,229,158,194,238,235,112,166,161,115,79,113,7,118,32,211,144,185,39,191,11,59,138,105,168,220,83,216,137,29,206,52,116,238,41,238,198,14,100,26,50,247,228,119,100,71,49,13,149,123,10,187,178,35,152,198,234,203,206,101,154,184,51,59,130,105,121,189,217,89,76,227,119,103,47,98,26,163,63,123,46,211,132,29,218,225,76,67,231,158,226,46,237,64,166,33,115,79,126,167,118,20,211,80,185,167,176,91,59,156,105,232,220,83,220,177,29,200,52,100,238,201,239,218,142,98,26,42,247,20,118,110,135,51,13,157,123,138,187,183,3,153,134,204,61,249,29,220,81,76,67,229,158,194,46,238,112,166,161,115,79,113,39,119,32,211,144,185,39,191,155,59,138,105,168,220,83,216,209,29,206,52,116,238,41,238,234,14,100,26,50,247,228,119,118,71,49,13,149,123,10,187,187,35,152,198,234,239,206,101,154,184,195,59,130,105,121,61,222,89,76,227,119,121,47,98,26,163,207,123,46,211,132,157,222,225,76,67,231,158,226,110,239,64,166,33,115,79,126,199,119,20,211,80,185,167,176,235,59,156,105,232,220,83,220,249,29,200,52,100,238,201,239,254,142,98,26,42,247,20,118,128,135,51,13,157,123,138,187,192,3,153,134,204,61,249,157,224,81,76,67,229,158,194,110,240,112,166,161,115,79,113,71,120,32,211,144,185,39,191,43,60,138,105,168,220,83,216,25,30,206,52,116,238,41,238,14,15,100,26,50,247,228,119,136,71,49,13,149,123,10,187,196,179,153,118,182,250,133,168,75,252,31,103,175,7,248,98,72,180,47,138,123,196,167,205,80,254,249,130,213,33,126,206,78,99,230,213,242,128,5,139,8,131,211,75,224,116,135,255,227,220,69,1,95,12,8,246,133,184,55,124,106,112,50,144,125,33,234,12,207,100,151,180,47,60,128,93,89,93,225,57,236,98,247,132,47,97,87,126,71,248,76,118,201,250,193,3,216,197,233,6,207,100,151,180,23,60,128,93,89,157,224,57,236,98,247,129,47,97,87,126,23,248,76,118,201,122,192,3,216,197,233,0,207,85,70,97,255,119,132,50,230,116,127,103,41,35,183,247,123,145,50,102,119,126,207,85,70,81,223,119,52,187,136,122,95,9,187,24,117,63,28,187,150,171,176,2,118,229,215,96,65,236,226,123,132,96,87,153,31,138,216,69,212,248,74,216,197,168,245,225,216,181,92,121,21,176,43,191,238,10,98,23,223,35,4,187,202,252,80,196,46,162,174,87,194,46,70,125,15,199,174,229,106,171,128,93,249,181,86,16,187,248,30,33,216,85,230,135,34,118,17,181,188,18,118,49,106,122,56,118,45,87,88,5,236,202,175,175,130,216,197,247,8,193,174,50,63,20,177,139,168,223,149,176,139,81,199,195,177,107,185,170,42,96,87,126,77,21,196,46,190,71,8,118,149,249,129,93,239,98,116,110,231,214,187,132,125,219,17,245,174,156,174,237,172,122,23,183,103,123,81,189,43,187,99,123,110,189,75,212,175,29,205,46,108,206,40,237,213,142,99,23,46,103,100,247,105,7,177,11,147,51,202,122,180,163,217,133,205,25,165,253,217,113,236,194,229,140,236,222,236,32,118,97,114,70,89,95,118,52,187,176,57,163,180,39,59,142,93,184,156,145,221,143,29,196,46,76,206,40,235,197,142,102,23,54,103,148,246,97,199,177,11,151,51,178,123,176,131,216,133,201,25,101,253,215,209,236,194,230,140,210,222,235,56,118,225,114,70,118,223,117,16,187,48,57,163,172,231,58,128,93,156,142,235,76,118,73,251,173,3,216,149,213,109,157,195,46,118,175,245,18,118,229,119,90,207,100,151,172,207,58,154,93,216,156,81,218,99,29,199,46,92,206,200,238,175,14,98,23,38,103,148,245,86,71,179,11,155,51,74,251,170,227,216,133,203,25,217,61,213,65,236,194,228,140,178,
+126,234,104,118,97,115,70,105,47,117,28,187,112,57,35,187,143,58,136,93,152,156,81,214,67,29,205,46,108,206,40,237,159,142,99,23,46,103,100,247,78,7,177,11,147,51,202,250,166,163,217,133,205,25,165,61,211,113,236,194,229,140,236,126,233,32,118,97,114,70,89,175,116,0,187,56,157,210,153,236,146,246,73,7,176,43,171,75,58,135,93,236,30,233,37,236,202,239,144,158,201,46,89,127,116,52,187,176,57,163,180,55,58,142,93,184,156,145,221,23,29,196,46,76,206,40,235,137,142,102,23,54,103,148,246,67,199,177,11,151,51,178,123,161,131,216,133,201,25,101,125,208,209,236,194,230,140,210,30,232,56,118,225,114,70,118,255,115,16,187,48,57,163,172,247,57,154,93,216,156,81,218,247,28,199,46,92,206,200,238,121,14,98,23,38,103,148,245,59,71,179,11,155,51,74,123,157,227,216,133,203,25,217,125,206,65,236,194,228,140,178,30,231,0,118,113,58,156,51,217,37,237,111,14,96,87,86,119,115,14,187,216,189,205,75,216,149,223,217,60,147,93,178,190,230,104,118,97,115,70,105,79,115,28,187,112,57,35,187,159,57,136,93,152,156,81,214,203,28,205,46,108,206,40,237,99,142,99,23,46,103,100,247,48,7,177,11,147,51,202,250,151,163,217,133,205,25,165,189,203,113,236,194,229,140,236,190,229,32,118,97,114,70,89,207,114,52,187,176,57,163,180,95,57,142,93,184,156,145,221,171,28,196,46,76,206,40,235,83,142,102,23,54,103,148,246,40,199,177,11,151,51,178,251,147,131,216,133,201,25,101,189,201,1,236,226,116,38,103,178,75,218,151,28,192,174,172,174,228,28,118,177,123,146,151,176,43,191,35,121,38,187,100,253,200,209,236,194,230,140,210,94,228,56,118,225,114,70,118,31,114,16,187,48,57,163,172,7,57,154,93,216,156,81,218,127,28,199,46,92,206,200,238,61,14,98,23,38,103,148,245,29,71,179,11,155,51,74,123,142,227,216,133,203,25,217,253,198,65,236,194,228,140,178,94,227,104,118,97,115,70,105,159,113,28,187,112,57,35,187,199,56,136,93,152,156,81,214,95,28,205,46,108,206,40,237,45,142,99,23,46,103,100,247,21,7,177,11,147,51,202,122,138,179,217,117,177,249,66,214,83,124,182,169,252,23,163,238,245,75,131,231,174,44,109,136,244,207,11,94,95,241,185,246,242,95,12,187,215,207,13,89,176,144,118,248,140,101,176,122,139,207,181,151,255,98,216,189,126,110,72,249,50,186,225,233,64,246,66,214,95,156,203,52,113,135,113,4,211,242,122,140,179,152,198,239,50,94,196,52,70,159,241,92,166,9,59,141,35,152,198,234,53,206,101,154,184,219,56,130,105,121,253,198,89,76,227,119,28,47,98,26,163,231,120,46,211,132,93,199,17,76,99,245,29,103,171,167,180,243,56,68,61,179,122,143,243,212,147,221,125,188,76,61,243,251,143,103,171,167,172,3,57,156,105,84,181,175,136,105,156,202,31,144,105,68,13,86,194,52,70,21,22,197,52,190,103,72,166,149,249,163,144,105,84,229,175,136,105,156,42,32,144,105,68,61,86,194,52,70,69,22,197,52,190,103,72,166,149,249,163,144,105,84,21,176,136,105,156,138,32,144,105,68,109,86,194,52,70,117,22,197,52,190,103,72,166,149,249,163,144,105,84,69,176,136,105,156,234,32,144,105,68,157,86,194,52,70,165,22,197,52,190,103,72,166,149,249,163,144,105,84,117,176,136,105,156,74,33,144,105,68,205,86,194,52,70,213,22,197,52,190,103,72,166,149,249,67,80,79,227,244,47,103,215,211,164,29,204,33,245,180,172,30,230,188,122,26,187,139,121,89,61,45,191,143,121,118,61,77,214,201,28,206,52,116,238,41,238,102,14,100,26,50,247,228,119,52,71,49,13,149,123,10,187,154,195,153,134,206,61,197,157,205,129,76,67,230,158,252,238,230,40,166,161,114,79,97,135,115,56,211,208,185,167,184,203,57,144,105,200,220,147,223,233,28,197,52,84,238,41,236,118,14,103,26,58,247,20,119,60,7,50,13,153,123,242,187,158,163,152,134,202,61,133,157,207,225,76,67,231,158,226,238,231,64,166,33,115,79,126,7,116,20,211,80,185,167,176,11,58,130,105,172,62,232,92,166,137,59,161,35,152,150,215,11,157,197,52,126,55,244,34,166,49,250,161,231,50,77,216,17,29,206,52,116,238,41,238,138,14,100,26,50,
+247,228,119,70,71,49,13,149,123,10,187,163,195,153,134,206,61,197,29,210,129,76,67,230,158,252,46,233,40,166,161,114,79,97,167,116,56,211,208,185,167,184,91,58,144,105,200,220,147,223,49,29,197,52,84,238,41,236,154,14,103,26,58,247,20,119,78,7,50,13,153,123,242,187,167,163,152,134,202,61,133,29,212,225,76,67,231,158,226,46,234,64,166,33,115,79,126,39,117,20,211,80,185,167,176,155,58,130,105,172,126,234,92,166,137,59,170,35,152,150,215,83,157,197,52,126,87,245,34,166,49,250,170,231,50,77,216,89,29,206,52,116,238,41,238,174,14,100,26,50,247,228,119,88,71,49,13,149,123,10,187,172,195,153,134,206,61,197,157,214,129,76,67,230,158,252,110,235,40,166,161,114,79,97,199,117,56,211,208,185,167,184,235,58,144,105,200,220,147,223,121,29,197,52,84,238,41,236,190,14,103,26,58,247,20,119,96,7,50,13,153,123,242,187,176,163,152,134,202,61,133,157,216,225,76,67,231,158,226,110,236,64,166,33,115,79,126,71,118,20,211,80,185,167,176,43,59,130,105,172,190,236,92,166,137,59,179,35,152,150,215,155,157,197,52,126,119,246,34,166,49,250,179,231,50,77,216,161,29,206,52,116,238,41,238,210,14,100,26,50,247,228,119,106,71,49,13,149,123,10,187,181,195,153,134,206,61,197,29,219,129,76,67,230,158,252,174,237,40,166,161,114,79,97,231,118,56,211,208,185,167,184,123,59,144,105,200,220,147,223,193,29,197,52,84,238,41,236,226,14,103,26,58,247,20,119,114,7,50,13,153,123,242,187,185,163,152,134,202,61,133,29,221,225,76,67,231,158,226,174,238,64,166,33,115,79,126,103,119,20,211,80,185,167,176,187,59,130,105,172,254,238,92,166,137,59,188,35,152,150,215,227,157,197,52,126,151,247,34,166,49,250,188,231,50,77,216,233,29,206,52,116,238,41,238,246,14,100,26,50,247,228,119,124,71,49,13,149,123,10,187,190,195,153,134,206,61,197,157,223,129,76,67,230,158,252,238,239,40,166,161,114,79,97,7,120,56,211,208,185,167,184,11,60,144,105,200,220,147,223,9,30,197,52,84,238,41,236,6,15,103,26,58,247,20,119,132,7,50,13,153,123,242,187,194,163,152,134,202,61,133,157,225,225,76,67,231,158,226,238,240,64,166,33,115,79,126,135,120,20,211,80,185,167,176,75,60,155,105,103,171,47,100,109,226,95,254,231,28,3,94,140,168,246,162,188,77,252,130,33,202,71,47,120,109,226,231,44,5,67,175,136,33,11,22,210,14,159,177,12,78,155,248,25,59,175,90,188,136,33,229,203,232,134,39,131,218,11,89,155,120,54,211,164,109,226,33,76,203,106,19,207,99,26,187,77,124,25,211,242,219,196,103,51,77,214,38,30,194,52,78,155,120,54,211,164,109,226,33,76,203,106,19,207,99,26,187,77,124,25,211,242,219,196,103,51,77,214,38,30,194,52,78,155,120,190,122,10,219,196,99,212,51,167,77,60,83,61,185,109,226,11,213,51,187,77,124,190,122,138,218,196,227,153,70,20,8,203,152,198,40,21,34,153,182,92,186,21,49,45,191,116,11,99,26,223,51,36,211,202,252,81,200,52,162,64,88,198,52,70,169,16,201,180,229,210,173,136,105,249,165,91,24,211,248,158,33,153,86,230,143,66,166,17,5,194,50,166,49,74,133,72,166,45,151,110,69,76,203,47,221,194,152,198,247,12,201,180,50,127,20,50,141,40,16,150,49,141,81,42,68,50,109,185,116,43,98,90,126,233,22,198,52,190,103,72,166,149,249,163,144,105,68,129,176,140,105,140,82,33,146,105,203,165,91,17,211,242,75,183,48,166,241,61,67,50,173,204,31,130,122,26,163,77,60,191,158,38,108,19,143,169,167,229,180,137,103,214,211,184,109,226,11,235,105,217,109,226,243,235,105,162,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,30,207,52,116,238,41,109,19,143,100,26,50,247,100,183,137,135,49,13,149,123,202,218,196,227,153,134,206,61,165,109,226,145,76,67,230,158,236,54,241,48,166,161,114,79,89,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,143,103,26,58,247,148,182,137,71,50,13,153,123,178,219,196,195,152,134,202,61,101,109,226,33,76,227,180,137,103,51,77,218,38,30,194,
+180,172,54,241,60,166,177,219,196,151,49,45,191,77,124,54,211,100,109,226,241,76,67,231,158,210,54,241,72,166,33,115,79,118,155,120,24,211,80,185,167,172,77,60,158,105,232,220,83,218,38,30,201,52,100,238,201,110,19,15,99,26,42,247,148,181,137,199,51,13,157,123,74,219,196,35,153,134,204,61,217,109,226,97,76,67,229,158,178,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,30,207,52,116,238,41,109,19,143,100,26,50,247,100,183,137,135,49,13,149,123,202,218,196,67,152,198,105,19,207,102,154,180,77,60,132,105,89,109,226,121,76,99,183,137,47,99,90,126,155,248,108,166,201,218,196,227,153,134,206,61,165,109,226,145,76,67,230,158,236,54,241,48,166,161,114,79,89,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,143,103,26,58,247,148,182,137,71,50,13,153,123,178,219,196,195,152,134,202,61,101,109,226,241,76,67,231,158,210,54,241,72,166,33,115,79,118,155,120,24,211,80,185,167,172,77,60,158,105,232,220,83,218,38,30,201,52,100,238,201,110,19,15,99,26,42,247,148,181,137,135,48,141,211,38,158,205,52,105,155,120,8,211,178,218,196,243,152,198,110,19,95,198,180,252,54,241,217,76,147,181,137,199,51,13,157,123,74,219,196,35,153,134,204,61,217,109,226,97,76,67,229,158,178,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,30,207,52,116,238,41,109,19,143,100,26,50,247,100,183,137,135,49,13,149,123,202,218,196,227,153,134,206,61,165,109,226,145,76,67,230,158,236,54,241,48,166,161,114,79,89,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,15,97,26,167,77,60,155,105,210,54,241,16,166,101,181,137,231,49,141,221,38,190,140,105,249,109,226,179,153,38,107,19,143,103,26,58,247,148,182,137,71,50,13,153,123,178,219,196,195,152,134,202,61,101,109,226,241,76,67,231,158,210,54,241,72,166,33,115,79,118,155,120,24,211,80,185,167,172,77,60,158,105,232,220,83,218,38,30,201,52,100,238,201,110,19,15,99,26,42,247,148,181,137,199,51,13,157,123,74,219,196,35,153,134,204,61,217,109,226,97,76,67,229,158,178,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,158,207,180,179,213,143,100,109,226,191,157,189,40,224,163,17,213,62,42,111,19,191,96,136,242,209,71,188,54,241,115,150,130,161,87,196,144,5,11,105,135,207,88,6,167,77,252,183,115,87,6,124,52,164,218,71,242,54,241,201,225,201,160,246,145,172,77,60,155,105,210,54,241,16,166,101,181,137,231,49,141,221,38,190,140,105,249,109,226,179,153,38,107,19,15,97,26,167,77,60,155,105,210,54,241,16,166,101,181,137,231,49,141,221,38,190,140,105,249,109,226,179,153,38,107,19,15,97,26,167,77,60,95,61,133,109,226,49,234,153,211,38,158,169,158,220,54,241,133,234,153,221,38,62,95,61,69,109,226,241,76,35,10,132,101,76,99,148,10,145,76,91,46,221,138,152,150,95,186,133,49,141,239,25,146,105,101,254,40,100,26,81,32,44,99,26,163,84,136,100,218,114,233,86,196,180,252,210,45,140,105,124,207,144,76,43,243,71,33,211,136,2,97,25,211,24,165,66,36,211,150,75,183,34,166,229,151,110,97,76,227,123,134,100,90,153,63,10,153,70,20,8,203,152,198,40,21,34,153,182,92,186,21,49,45,191,116,11,99,26,223,51,36,211,202,252,81,200,52,162,64,88,198,52,70,169,16,201,180,229,210,173,136,105,249,165,91,24,211,248,158,33,153,86,230,15,65,61,141,209,38,158,95,79,19,182,137,199,212,211,114,218,196,51,235,105,220,54,241,133,245,180,236,54,241,249,245,52,81,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,143,103,26,58,247,148,182,137,71,50,13,153,123,178,219,196,195,152,134,202,61,101,109,226,241,76,67,231,158,210,54,241,72,166,33,115,79,118,155,120,24,211,80,185,167,172,77,60,158,105,232,220,83,218,38,30,201,52,100,238,201,110,19,15,99,26,42,247,148,181,137,199,
+51,13,157,123,74,219,196,35,153,134,204,61,217,109,226,97,76,67,229,158,178,54,241,16,166,113,218,196,179,153,38,109,19,15,97,90,86,155,120,30,211,216,109,226,203,152,150,223,38,62,155,105,178,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,30,207,52,116,238,41,109,19,143,100,26,50,247,100,183,137,135,49,13,149,123,202,218,196,227,153,134,206,61,165,109,226,145,76,67,230,158,236,54,241,48,166,161,114,79,89,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,143,103,26,58,247,148,182,137,71,50,13,153,123,178,219,196,195,152,134,202,61,101,109,226,33,76,227,180,137,103,51,77,218,38,30,194,180,172,54,241,60,166,177,219,196,151,49,45,191,77,124,54,211,100,109,226,241,76,67,231,158,210,54,241,72,166,33,115,79,118,155,120,24,211,80,185,167,172,77,60,158,105,232,220,83,218,38,30,201,52,100,238,201,110,19,15,99,26,42,247,148,181,137,199,51,13,157,123,74,219,196,35,153,134,204,61,217,109,226,97,76,67,229,158,178,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,30,207,52,116,238,41,109,19,143,100,26,50,247,100,183,137,135,49,13,149,123,202,218,196,67,152,198,105,19,207,102,154,180,77,60,132,105,89,109,226,121,76,99,183,137,47,99,90,126,155,248,108,166,201,218,196,227,153,134,206,61,165,109,226,145,76,67,230,158,236,54,241,48,166,161,114,79,89,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,143,103,26,58,247,148,182,137,71,50,13,153,123,178,219,196,195,152,134,202,61,101,109,226,241,76,67,231,158,210,54,241,72,166,33,115,79,118,155,120,24,211,80,185,167,172,77,60,158,105,232,220,83,218,38,30,201,52,100,238,201,110,19,15,99,26,42,247,148,181,137,135,48,141,211,38,158,205,52,105,155,120,8,211,178,218,196,243,152,198,110,19,95,198,180,252,54,241,217,76,147,181,137,199,51,13,157,123,74,219,196,35,153,134,204,61,217,109,226,97,76,67,229,158,178,54,241,120,166,161,115,79,105,155,120,36,211,144,185,39,187,77,60,140,105,168,220,83,214,38,30,207,52,116,238,41,109,19,143,100,26,50,247,100,183,137,135,49,13,149,123,202,218,196,227,153,134,206,61,165,109,226,145,76,67,230,158,236,54,241,48,166,161,114,79,89,155,120,60,211,208,185,167,180,77,60,146,105,200,220,147,221,38,30,198,52,84,238,41,107,19,207,103,218,217,234,205,253,67,70,159,248,38,57,25,153,252,195,159,255,99,98,243,147,207,62,253,205,167,159,173,182,111,2,27,126,247,233,139,23,159,126,49,164,222,162,177,217,181,150,24,166,124,216,206,38,217,71,158,109,249,201,240,171,145,137,116,143,119,174,137,87,231,181,81,171,192,96,121,94,81,14,146,121,125,231,229,75,38,131,102,76,174,116,31,122,5,38,231,245,165,55,98,242,76,159,122,32,147,83,61,228,209,76,38,90,227,107,51,57,167,175,189,17,147,211,125,238,21,152,156,215,247,222,136,201,51,125,240,129,76,78,245,168,71,51,153,104,189,175,205,228,156,190,249,70,76,78,247,209,215,120,186,200,234,171,111,245,116,49,237,179,143,124,186,72,244,192,135,63,93,44,183,246,87,127,186,200,232,203,239,193,228,65,133,86,155,201,201,218,173,45,147,227,218,186,14,147,139,80,205,100,114,170,156,111,200,100,152,63,17,76,30,84,128,181,153,156,172,13,219,50,57,174,221,235,48,185,8,213,76,38,167,182,11,12,153,12,243,39,130,201,131,10,179,54,147,147,181,103,91,38,199,123,3,58,76,46,66,53,147,201,169,237,8,67,38,195,252,137,96,242,160,130,173,205,228,100,109,219,150,201,241,222,131,14,147,139,80,205,100,114,106,187,195,144,201,48,127,34,152,60,168,144,107,51,57,89,59,183,101,114,188,183,161,195,228,34,84,51,153,156,218,78,49,100,50,204,159,210,122,114,242,30,6,141,122,114,214,189,12,86,245,228,233,61,13,200,122,114,226,14,5,120,61,121,249,106,8,245,122,114,198,189,14,30,76,214,174,93,228,221,251,96,203,100,165,218,69,234,142,6,37,38,123,213,46,114,238,141,240,96,
+178,118,237,34,239,94,9,91,38,43,213,46,82,119,64,40,49,217,171,118,145,115,47,133,7,147,181,107,23,121,247,86,216,50,89,169,118,145,186,99,66,137,201,94,181,139,156,123,47,60,152,172,93,187,200,187,23,195,150,201,74,181,139,212,29,22,74,76,246,170,93,228,220,171,225,193,100,237,218,69,222,189,27,182,76,86,170,93,164,238,200,80,98,178,87,237,34,231,222,14,35,38,167,239,241,80,96,114,222,189,30,70,76,158,185,231,3,200,228,212,29,28,104,38,19,87,139,104,51,57,231,94,16,15,38,107,215,46,242,238,13,177,101,178,82,237,34,117,199,135,18,147,189,106,23,57,247,142,120,48,89,187,118,145,119,47,137,45,147,149,106,23,169,59,68,148,152,236,85,187,200,185,215,196,131,201,218,181,139,188,123,79,108,153,172,84,187,72,221,81,162,196,100,175,218,69,206,189,41,30,76,214,174,93,228,221,171,98,203,100,165,218,69,234,14,20,37,38,123,213,46,114,238,101,241,96,178,118,237,34,239,222,22,91,38,43,213,46,82,119,172,40,49,217,171,118,145,115,239,139,17,147,211,247,192,40,48,57,239,94,24,35,38,207,220,19,3,100,114,234,14,23,52,147,137,171,105,180,153,156,115,175,140,7,147,181,107,23,121,247,206,216,50,89,169,118,145,186,35,70,137,201,94,181,139,156,123,107,60,152,172,93,187,200,187,215,198,150,201,74,181,139,212,29,52,74,76,246,170,93,228,220,139,227,193,100,237,218,69,222,189,57,182,76,86,170,93,164,238,184,81,98,178,87,237,34,231,222,29,15,38,107,215,46,242,238,229,177,101,178,82,237,34,117,135,142,18,147,189,106,23,57,247,250,120,48,89,187,118,145,119,239,143,45,147,149,106,23,169,59,122,148,152,236,85,187,200,185,55,200,136,201,233,123,132,20,152,156,119,175,144,17,147,103,238,25,2,50,57,117,7,16,154,201,196,213,70,218,76,206,185,151,200,131,201,218,181,139,188,123,139,108,153,172,84,187,72,221,49,164,196,100,175,218,69,206,189,71,30,76,214,174,93,228,221,139,100,203,100,165,218,69,234,14,35,37,38,123,213,46,114,238,85,242,96,178,118,237,34,239,222,37,91,38,43,213,46,82,119,36,41,49,217,171,118,145,115,111,147,7,147,181,107,23,121,247,58,217,50,89,169,118,145,186,131,73,137,201,94,181,139,156,123,161,60,152,172,93,187,200,187,55,202,150,201,74,181,139,212,29,79,74,76,246,170,93,228,220,59,101,196,228,244,61,84,10,76,206,187,151,202,136,201,51,247,84,1,153,156,186,67,10,205,100,226,106,44,109,38,231,220,107,229,193,100,237,218,69,222,189,87,182,76,86,170,93,164,238,168,82,98,178,87,237,34,231,222,44,15,38,107,215,46,242,238,213,178,101,178,82,237,34,117,7,150,18,147,189,106,23,57,247,114,121,48,89,187,118,145,119,111,151,45,147,149,106,23,169,59,182,148,152,236,85,187,200,185,247,203,131,201,218,181,139,188,123,193,108,153,172,84,187,72,221,225,165,196,100,175,218,69,206,189,98,30,76,214,174,93,228,221,59,102,203,100,165,218,69,234,142,48,37,38,123,213,46,114,238,45,83,96,242,121,22,215,155,211,79,155,205,238,9,141,245,238,151,215,159,253,245,217,221,126,240,229,187,109,252,229,194,125,106,191,127,249,227,255,126,249,242,219,203,220,126,255,100,96,245,205,119,171,102,26,171,63,125,189,218,238,110,238,30,143,219,247,155,8,12,193,52,50,175,120,227,77,137,114,90,238,60,219,127,121,2,213,254,171,46,136,186,41,57,114,105,110,2,149,66,100,207,159,161,105,83,88,198,147,123,125,252,165,25,238,116,216,222,140,166,249,254,179,225,151,159,243,168,116,30,118,110,190,175,62,107,231,251,234,243,213,213,254,176,122,191,189,217,172,222,111,14,199,245,199,75,48,202,102,202,3,183,116,214,153,100,100,44,37,147,156,174,112,11,88,92,1,208,221,172,235,230,245,220,28,63,92,160,171,228,242,112,118,117,128,123,137,210,235,247,111,175,134,123,49,205,147,107,60,153,155,245,221,77,243,75,151,9,172,27,35,235,183,155,213,254,205,106,183,223,125,178,219,222,173,222,175,239,30,155,193,247,111,210,15,169,9,123,35,56,202,108,167,205,124,188,186,106,31,206,87,109,209,41,203,68,128,118,247,120,127,189,57,176,173,13,23,133,183,76,74,111,52,159,126,91,
+194,204,169,51,251,3,26,78,237,150,101,229,212,233,162,124,157,218,87,232,205,156,58,83,42,215,112,106,183,44,43,167,78,23,229,235,212,190,88,109,230,212,153,170,177,134,83,187,101,89,57,117,186,40,95,167,246,117,91,51,167,206,20,80,53,156,218,45,203,202,169,211,69,249,58,181,47,97,154,57,117,166,150,168,225,212,110,89,86,78,157,46,202,193,169,205,147,247,249,193,109,123,74,62,144,223,236,119,141,201,211,113,251,118,183,190,123,221,252,244,50,151,155,245,241,180,122,115,216,223,135,177,86,167,125,248,207,179,85,247,155,171,205,225,208,60,153,239,119,171,125,243,231,111,238,246,63,197,153,195,208,116,78,94,192,156,198,236,234,115,231,246,122,183,111,127,131,1,15,61,35,218,4,3,6,33,0,41,247,199,7,209,68,184,159,54,82,247,167,14,135,149,77,3,235,126,26,30,122,70,180,9,132,251,151,1,72,184,127,112,122,75,130,123,51,128,208,253,201,19,85,101,211,128,186,63,3,30,122,70,180,9,128,251,9,0,18,238,31,28,121,146,224,222,12,32,116,127,242,24,82,217,52,160,238,207,128,135,158,17,109,2,224,126,2,128,132,251,7,231,132,36,184,55,3,8,221,159,60,187,83,54,13,168,251,51,224,161,103,68,155,0,184,159,0,32,225,254,193,225,26,9,238,205,0,66,247,39,15,188,148,77,3,234,254,12,120,232,25,209,38,0,238,39,0,72,184,127,112,34,69,130,123,51,128,208,253,201,83,34,101,211,128,186,63,3,30,122,70,180,9,128,251,9,0,18,238,47,198,189,25,64,232,254,96,26,230,254,203,52,160,238,47,240,199,101,70,180,9,128,251,9,0,82,79,254,167,67,225,35,247,233,32,125,242,111,76,227,158,252,207,211,192,62,249,211,240,208,51,162,77,32,158,252,151,1,24,184,255,180,153,173,107,140,206,230,141,112,63,109,150,202,13,167,77,30,196,67,211,57,71,4,153,211,40,112,255,105,179,88,246,153,159,23,61,35,218,4,3,6,33,0,41,247,47,188,127,152,135,123,95,110,16,184,63,243,157,64,230,52,176,238,167,225,161,103,68,155,64,184,127,25,128,132,251,151,94,218,203,194,253,169,220,192,119,127,238,139,116,204,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,47,189,233,150,133,251,83,185,129,239,254,220,183,207,152,211,128,186,63,3,30,122,70,180,9,128,251,9,0,18,238,95,122,61,44,11,247,167,114,3,223,253,185,175,108,49,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,191,244,78,85,22,238,79,229,6,190,251,115,223,115,98,78,3,234,254,12,120,232,25,209,38,0,238,39,0,72,184,127,233,69,164,44,220,159,202,13,124,247,231,190,28,196,156,6,212,253,25,240,208,51,162,77,0,220,79,0,144,112,127,49,238,79,229,6,190,251,147,245,142,178,105,64,221,95,224,143,203,140,104,19,0,247,19,0,164,158,252,227,186,134,232,145,187,47,55,8,158,252,83,245,142,178,105,96,159,252,105,120,232,25,209,38,16,79,254,203,0,196,238,111,146,132,185,186,70,72,65,210,184,55,63,93,40,55,132,142,44,57,16,143,76,207,173,187,112,26,114,247,55,127,188,84,246,73,204,139,158,17,109,130,1,131,16,128,148,251,163,186,134,12,247,174,220,32,113,127,162,222,81,56,13,172,251,105,120,232,25,209,38,16,238,95,6,32,225,254,184,174,33,194,189,47,55,8,220,159,170,119,20,78,3,234,254,12,120,232,25,209,38,0,238,39,0,72,184,63,174,107,136,112,239,203,13,2,247,167,234,29,133,211,128,186,63,3,30,122,70,180,9,128,251,9,0,18,238,143,235,26,34,220,251,114,131,192,253,169,122,71,225,52,160,238,207,128,135,158,17,109,2,224,126,2,128,132,251,227,186,134,8,247,190,220,32,112,127,170,222,81,56,13,168,251,51,224,161,103,68,155,0,184,159,0,32,225,254,184,174,33,194,189,47,55,8,220,159,170,119,20,78,3,234,254,12,120,232,25,209,38,0,238,39,0,72,184,191,24,247,190,220,32,112,127,170,222,81,56,13,168,251,11,252,113,153,17,109,2,224,126,2,128,212,147,127,84,215,144,61,114,119,229,6,201,147,127,162,222,81,56,13,236,147,63,13,15,61,35,218,4,226,201,127,25,128,216,253,205,83,226,92,93,35,60,131,166,113,111,126,186,80,110,8,237,
+75,115,32,30,153,158,91,119,225,52,228,238,111,254,120,169,236,147,152,23,61,35,218,4,3,6,33,0,41,247,71,117,13,25,238,93,185,65,226,254,68,189,163,112,26,88,247,211,240,208,51,162,77,32,220,191,12,64,194,253,113,93,67,132,123,95,110,16,184,63,85,239,40,156,6,212,253,25,240,208,51,162,77,0,220,79,0,144,112,127,92,215,16,225,222,151,27,4,238,79,213,59,10,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,199,117,13,17,238,125,185,65,224,254,84,189,163,112,26,80,247,103,192,67,207,136,54,1,112,63,1,64,194,253,113,93,67,132,123,95,110,16,184,63,85,239,40,156,6,212,253,25,240,208,51,162,77,0,220,79,0,144,112,127,49,238,125,185,65,224,254,84,189,163,112,26,80,247,23,248,227,50,35,218,4,192,253,4,0,169,39,255,168,174,33,123,228,238,202,13,146,39,255,68,189,163,112,26,216,39,127,26,30,122,70,180,9,196,147,255,50,0,177,251,155,199,132,185,186,70,120,8,73,227,222,252,116,161,220,16,238,250,200,129,120,100,122,110,221,133,211,144,187,191,249,227,165,178,79,98,94,244,140,104,19,12,24,132,0,164,220,31,213,53,100,184,119,229,6,137,251,19,245,142,194,105,96,221,79,195,67,207,136,54,129,112,255,50,0,9,247,199,117,13,17,238,125,185,65,224,254,84,189,163,112,26,80,247,103,192,67,207,136,54,1,112,63,1,64,194,253,113,93,67,132,123,95,110,16,184,63,85,239,40,156,6,212,253,25,240,208,51,162,77,0,220,79,0,144,112,127,92,215,16,225,222,151,27,4,238,79,213,59,10,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,199,117,13,17,238,125,185,65,224,254,84,189,163,112,26,80,247,103,192,67,207,136,54,1,112,63,1,64,194,253,197,184,247,229,6,129,251,83,245,142,194,105,64,221,95,224,143,203,140,104,19,0,247,19,0,164,158,252,163,186,134,236,145,187,43,55,72,158,252,19,245,142,194,105,96,159,252,105,120,232,25,209,38,16,79,254,203,0,196,238,111,116,98,174,174,17,84,40,141,123,243,211,133,114,67,184,24,51,7,226,145,233,185,117,23,78,67,238,254,230,143,151,202,62,137,121,209,51,162,77,48,96,16,2,144,114,127,84,215,144,225,222,149,27,36,238,79,212,59,10,167,129,117,63,13,15,61,35,218,4,194,253,203,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,199,117,13,17,238,125,185,65,224,254,84,189,163,112,26,80,247,103,192,67,207,136,54,1,112,63,1,64,194,253,113,93,67,132,123,95,110,16,184,63,85,239,40,156,6,212,253,25,240,208,51,162,77,0,220,79,0,144,112,127,92,215,16,225,222,151,27,4,238,79,213,59,10,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,23,227,222,151,27,4,238,79,213,59,10,167,1,117,127,129,63,46,51,162,77,0,220,79,0,144,122,242,143,234,26,178,71,238,174,220,32,121,242,79,212,59,10,167,129,125,242,167,225,161,103,68,155,64,60,249,47,3,16,187,191,9,20,115,117,141,16,134,210,184,135,91,212,210,229,134,246,54,178,12,136,71,166,231,214,93,56,13,185,251,155,63,94,42,251,36,230,69,207,136,54,193,128,65,8,64,202,253,81,93,67,134,123,87,110,144,184,63,81,239,40,156,6,214,253,52,60,244,140,104,19,8,247,47,3,144,112,127,92,215,16,225,222,151,27,4,238,79,213,59,10,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,199,117,13,17,238,125,185,65,224,254,84,189,163,112,26,80,247,103,192,67,207,136,54,1,112,63,1,64,194,253,113,93,67,132,123,95,110,16,184,63,85,239,40,156,6,212,253,
+25,240,208,51,162,77,0,220,79,0,144,112,127,92,215,16,225,222,151,27,4,238,79,213,59,10,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,95,140,123,95,110,16,184,63,85,239,40,156,6,212,253,5,254,184,204,136,54,1,112,63,1,64,234,201,63,170,107,200,30,185,187,114,131,228,201,63,81,239,40,156,6,246,201,159,134,135,158,17,109,2,241,228,191,12,64,236,254,198,202,92,93,35,24,79,227,222,252,116,161,220,208,252,52,11,226,145,233,185,117,23,78,67,238,254,230,143,151,202,62,137,121,209,51,162,77,48,96,16,2,144,114,127,84,215,144,225,222,149,27,36,238,79,212,59,10,167,129,117,63,13,15,61,35,218,4,194,253,203,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,199,117,13,17,238,125,185,65,224,254,84,189,163,112,26,80,247,103,192,67,207,136,54,1,112,63,1,64,194,253,113,93,67,132,123,95,110,16,184,63,85,239,40,156,6,212,253,25,240,208,51,162,77,0,220,79,0,144,112,127,92,215,16,225,222,151,27,4,238,79,213,59,10,167,1,117,127,6,60,244,140,104,19,0,247,19,0,36,220,31,215,53,68,184,247,229,6,129,251,83,245,142,194,105,64,221,159,1,15,61,35,218,4,192,253,4,0,9,247,23,227,222,151,27,4,238,79,213,59,10,167,1,117,127,129,63,46,51,162,77,0,220,79,0,144,122,242,143,234,26,178,71,238,174,220,32,121,242,79,212,59,10,167,129,125,242,167,225,161,103,68,155,64,60,249,47,3,48,232,232,125,58,27,95,239,126,185,244,144,110,38,178,208,74,251,116,152,51,219,12,208,118,146,62,29,242,186,102,15,77,207,182,178,46,155,70,65,71,239,211,97,236,155,12,120,232,25,209,38,24,48,8,1,24,116,246,122,115,122,183,217,109,238,142,155,171,247,161,234,244,108,117,253,217,121,46,175,63,251,107,243,245,231,241,215,79,51,234,190,138,231,212,141,116,153,206,215,111,62,9,223,248,36,140,189,218,63,108,14,235,211,182,193,186,153,215,250,120,220,220,95,223,109,86,235,85,179,144,219,109,248,126,227,142,102,160,199,59,98,114,239,63,235,44,87,54,173,49,102,239,63,239,254,233,53,173,184,138,24,97,86,213,180,62,16,204,234,224,217,34,114,142,83,124,243,216,76,238,225,176,127,251,239,109,208,95,7,171,207,159,63,143,230,48,152,65,243,205,255,245,151,31,94,94,166,240,242,253,250,238,113,29,202,148,239,54,171,135,253,241,244,102,251,243,106,125,104,130,214,253,230,180,189,89,109,126,126,8,127,27,166,21,172,180,145,186,253,221,245,225,237,99,24,226,184,218,238,154,248,118,243,110,243,201,113,251,143,205,237,234,253,230,230,180,63,28,159,173,238,155,97,15,219,245,221,246,31,219,38,19,222,239,238,126,105,255,176,91,195,243,213,151,231,1,238,215,135,191,53,127,248,16,70,106,141,172,15,155,240,143,255,110,70,106,190,127,122,119,216,63,190,125,215,254,241,57,144,182,113,116,245,118,251,126,179,91,93,111,222,236,15,237,10,238,99,104,214,111,223,30,158,7,124,142,143,247,243,16,53,255,136,193,9,127,16,208,249,225,47,127,190,0,244,195,99,243,48,247,70,14,207,179,213,166,135,248,118,117,223,224,178,185,91,93,255,242,244,175,32,14,251,199,211,8,170,173,38,58,231,255,221,239,111,31,239,194,223,220,221,196,148,63,254,99,115,216,135,176,122,218,4,18,109,79,49,66,239,215,135,175,127,248,127,94,126,255,221,5,159,191,236,214,135,95,86,141,251,111,254,182,106,12,173,194,159,7,192,94,253,211,220,168,199,119,39,133,81,183,59,141,81,239,118,111,21,70,125,115,167,49,215,38,219,44,31,53,26,118,183,189,107,70,109,62,31,137,81,191,253,250,155,244,160,205,31,207,142,185,63,145,195,126,247,227,242,200,237,16,211,193,155,239,119,79,2,179,227,54,163,94,134,252,126,115,122,108,254,34,124,92,126,191,223,223,109,214,161,197,103,243,169,61,110,98,96,251,1,187,207,192,105,179,52,96,55,199,198,234,79,219,38,138,55,127,56,241,82,55,88,71,253,112,5,12,96,176,142,241,161,177,40,96,176,142,232,161,93,133,104,176,203,243,116,243,84,191,128,218,15,95,255,241,219,241,120,225,79,
+86,87,159,124,246,236,55,207,154,231,142,241,244,250,1,251,160,129,27,176,143,23,184,1,251,80,129,27,176,143,18,184,1,251,0,81,48,224,69,87,175,143,11,94,254,242,247,63,140,199,107,254,96,127,247,216,168,82,16,194,205,100,134,221,120,169,143,135,116,188,212,39,68,58,94,234,67,34,29,175,243,112,120,89,8,51,94,231,224,112,10,69,58,222,121,192,79,150,66,223,203,63,142,135,219,109,222,118,207,173,227,137,125,178,20,245,152,227,36,3,30,115,156,100,172,99,142,147,114,31,119,156,148,219,114,198,57,15,244,111,255,182,224,177,175,191,253,195,247,93,189,101,60,224,171,213,191,173,62,139,39,212,142,147,242,24,119,156,148,199,184,227,164,60,198,29,39,229,49,238,56,41,143,101,140,115,241,252,210,71,236,171,151,233,129,62,25,78,232,147,165,143,24,119,156,148,195,184,227,164,28,198,29,39,229,48,238,56,41,135,101,140,115,241,252,213,251,207,130,171,158,189,255,188,247,219,76,164,253,234,171,241,112,253,195,230,171,207,26,6,188,250,252,217,234,237,227,250,176,222,157,54,225,1,234,92,244,12,249,224,161,253,197,144,252,221,53,153,99,200,33,127,121,24,60,144,78,39,48,35,29,182,19,152,209,66,219,9,204,136,187,237,4,102,158,86,108,39,48,243,248,69,79,32,163,248,222,140,121,174,140,103,217,76,91,59,175,176,171,251,180,229,162,38,199,235,158,61,82,171,235,66,154,227,71,172,155,128,227,71,172,155,128,227,71,172,155,128,227,71,44,153,16,40,50,124,193,38,152,225,157,216,58,50,188,155,128,35,195,187,9,56,50,60,153,33,42,18,108,193,38,152,96,221,83,152,35,193,186,9,56,18,44,153,177,43,250,119,193,38,216,191,221,211,177,163,127,147,5,12,69,120,23,108,130,225,77,150,83,20,87,183,96,19,181,186,112,215,187,107,10,51,152,128,71,112,24,76,192,67,125,6,19,240,120,190,26,76,192,232,249,138,182,9,102,184,95,6,49,152,128,35,195,253,50,136,193,4,28,25,110,154,65,208,54,193,12,247,203,32,6,19,112,100,184,95,6,49,152,128,81,6,65,219,4,19,204,47,131,24,76,192,145,96,166,25,4,109,19,236,95,191,12,98,48,1,163,12,130,182,9,134,215,52,131,160,109,162,86,23,174,13,118,205,32,6,19,240,8,14,131,9,120,168,207,96,2,70,234,67,219,4,19,204,239,1,126,48,1,71,130,249,61,192,15,38,96,75,176,5,155,96,130,249,61,63,15,38,224,72,48,191,231,231,193,4,108,9,102,240,252,220,91,242,123,126,30,76,192,145,96,166,207,207,180,77,176,127,253,158,159,7,19,48,122,126,166,109,130,225,53,125,126,166,109,162,86,23,238,95,116,125,126,30,76,192,35,56,12,38,96,20,28,104,155,96,255,250,61,190,14,38,224,232,223,130,199,87,177,127,23,108,130,253,235,247,244,56,152,128,163,127,11,158,30,197,254,93,176,9,246,175,223,195,219,96,2,142,254,53,125,120,163,109,130,253,235,247,240,54,152,128,209,195,27,109,19,12,175,233,195,27,109,19,181,186,112,139,146,235,195,219,96,2,70,228,161,109,130,225,245,123,118,26,76,192,22,222,5,155,96,120,253,30,93,6,19,176,133,119,193,38,24,94,191,39,135,193,4,108,225,93,176,9,134,215,79,184,7,19,176,133,215,64,184,123,75,166,194,77,219,68,173,46,244,193,47,19,110,254,234,104,155,224,213,21,232,166,120,117,11,54,193,171,43,144,45,241,234,22,108,130,87,87,160,26,226,213,45,216,4,175,174,32,104,139,87,183,96,19,188,58,211,152,73,219,4,172,238,147,140,215,93,127,248,203,239,211,171,251,164,80,112,63,201,120,221,213,120,2,211,170,132,241,4,166,123,150,198,19,152,158,106,53,158,192,76,251,18,122,2,57,189,38,31,175,25,175,187,54,54,211,214,68,31,177,148,136,154,193,155,74,62,141,39,224,248,17,75,157,59,49,158,128,232,35,38,102,248,130,77,48,195,83,15,82,102,240,166,242,127,227,9,56,50,60,117,240,69,147,96,11,54,193,4,75,61,203,154,193,155,170,128,24,79,64,68,48,177,127,23,108,130,253,155,122,154,55,131,55,85,130,209,132,119,193,38,24,222,84,58,161,185,186,5,155,168,213,17,175,187,234,147,135,120,221,213,120,2,30,234,67,188,238,106,60,1,163,231,43,218,38,152,225,
+126,25,4,241,186,171,241,4,28,25,238,151,65,16,175,158,106,50,220,32,131,32,94,119,53,131,215,47,131,32,94,119,53,158,128,81,6,65,219,4,19,204,47,131,32,94,119,53,158,128,81,6,65,219,4,251,215,47,131,32,94,61,213,132,215,32,131,32,94,61,213,92,157,65,6,65,188,238,170,79,30,226,117,87,227,9,120,168,15,241,234,169,10,193,104,155,96,130,249,61,192,19,175,187,26,79,192,145,96,5,15,240,98,130,45,216,4,19,204,239,249,153,120,221,213,120,2,142,4,51,125,126,166,109,130,9,230,247,252,76,188,238,106,60,1,163,231,103,218,38,216,191,126,207,207,196,171,167,154,240,26,60,63,19,175,158,106,174,206,224,249,153,120,221,85,159,60,196,235,174,198,19,48,10,14,180,77,176,127,253,30,95,137,215,93,141,39,96,235,223,5,155,96,255,250,61,61,18,175,187,26,79,192,214,191,11,54,193,254,245,123,120,35,94,119,53,158,128,173,127,13,30,222,136,215,93,205,224,53,125,120,163,109,130,225,53,125,120,163,109,162,86,71,188,238,170,79,30,226,213,83,21,120,105,155,96,120,253,158,157,136,87,79,53,225,93,176,9,134,215,239,209,133,120,245,84,19,222,5,155,96,120,253,158,28,136,87,79,53,225,93,176,9,134,215,79,184,137,87,79,53,225,53,16,110,226,213,83,205,213,25,8,55,241,234,169,202,234,104,155,224,213,21,232,166,120,117,11,54,193,171,43,144,45,241,234,22,108,130,87,87,160,26,226,213,45,216,4,175,174,32,104,139,87,183,96,19,188,58,211,152,73,219,4,172,238,95,51,94,119,253,243,95,190,73,175,238,95,11,5,247,95,51,94,119,53,158,192,180,42,97,60,129,233,158,165,241,4,166,167,90,141,39,48,125,245,52,99,2,25,31,177,251,199,59,198,235,174,141,205,180,53,209,71,44,37,162,102,240,166,146,79,227,9,56,126,196,82,231,78,140,39,32,250,136,137,25,190,96,19,204,240,212,131,148,25,188,169,252,223,120,2,142,12,79,29,124,209,36,216,130,77,48,193,82,207,178,102,240,166,42,32,198,19,16,17,76,236,223,5,155,96,255,166,158,230,205,224,77,149,96,52,225,93,176,9,134,55,149,78,104,174,110,193,38,106,117,196,235,174,250,228,33,94,119,53,158,128,135,250,16,175,187,26,79,192,232,249,138,182,9,102,184,95,6,65,188,238,106,60,1,71,134,251,101,16,196,171,167,154,12,55,200,32,136,215,93,205,224,245,203,32,136,215,93,141,39,96,148,65,208,54,193,4,243,203,32,136,215,93,141,39,96,148,65,208,54,193,254,245,203,32,136,87,79,53,225,53,200,32,136,87,79,53,87,103,144,65,16,175,187,234,147,135,120,221,213,120,2,30,234,67,188,122,170,66,48,218,38,152,96,126,15,240,196,235,174,198,19,112,36,88,193,3,188,152,96,11,54,193,4,243,123,126,38,94,119,53,158,128,35,193,76,159,159,105,155,96,130,249,61,63,19,175,187,26,79,192,232,249,153,182,9,246,175,223,243,51,241,234,169,38,188,6,207,207,196,171,167,154,171,51,120,126,38,94,119,213,39,15,241,186,171,241,4,140,130,3,109,19,236,95,191,199,87,226,117,87,227,9,216,250,119,193,38,216,191,126,79,143,196,235,174,198,19,176,245,239,130,77,176,127,253,30,222,136,215,93,141,39,96,235,95,131,135,55,226,117,87,51,120,77,31,222,104,155,96,120,77,31,222,104,155,168,213,17,175,187,234,147,135,120,245,84,5,94,218,38,24,94,191,103,39,226,213,83,77,120,23,108,130,225,245,123,116,33,94,61,213,132,119,193,38,24,94,191,39,7,226,213,83,77,120,23,108,130,225,245,19,110,226,213,83,77,120,13,132,155,120,245,84,115,117,6,194,77,188,122,170,178,58,218,38,120,117,5,186,41,94,221,130,77,240,234,10,100,75,188,186,5,155,224,213,21,168,134,120,117,11,54,193,171,43,8,218,226,213,45,216,4,175,206,52,102,210,54,11,86,23,254,114,189,187,237,238,174,61,158,14,237,39,252,116,8,39,26,79,135,153,187,107,155,111,158,141,253,97,191,187,89,159,54,187,230,255,86,223,188,252,95,63,174,194,64,223,127,253,199,63,253,216,140,60,25,120,219,127,182,82,227,134,13,186,229,161,219,95,122,219,44,229,161,249,227,230,215,214,167,109,0,240,205,217,230,25,193,79,51,94,222,253,234,235,87,
+105,95,125,58,235,171,219,237,251,237,237,38,60,63,252,99,115,216,71,30,107,126,144,124,123,114,214,114,218,230,208,6,201,202,79,51,222,18,182,90,233,172,101,197,149,78,171,70,86,43,157,181,172,184,210,233,230,181,213,74,103,45,43,174,116,122,142,218,106,165,179,150,21,87,58,125,171,218,106,165,179,150,85,86,154,122,86,212,95,233,130,101,197,149,122,196,222,5,203,138,43,245,136,189,11,150,21,87,234,17,123,23,44,43,174,212,35,246,46,88,86,92,169,71,236,93,176,172,178,210,84,38,171,191,210,5,203,138,43,245,136,189,11,150,21,87,234,17,123,23,44,43,174,212,35,246,46,88,86,92,169,71,236,93,176,172,184,82,143,216,187,96,89,101,165,169,58,155,254,74,23,44,43,174,212,35,246,46,88,86,92,169,71,236,93,176,172,184,82,143,216,187,96,89,113,165,30,177,119,193,178,226,74,61,98,239,130,101,149,149,166,118,1,244,87,186,96,89,113,165,30,177,119,193,178,226,74,61,98,239,130,101,197,149,122,196,222,5,203,138,43,245,136,189,11,150,21,87,234,17,123,23,44,171,172,52,181,71,169,191,210,5,203,138,43,245,136,189,11,150,21,87,234,17,123,23,44,43,174,212,35,246,46,88,86,92,169,71,236,93,176,172,184,82,143,216,187,96,25,187,82,162,195,159,226,74,105,203,138,43,53,141,189,180,101,197,149,154,198,94,218,178,226,74,77,99,47,109,89,113,165,166,177,151,182,172,178,82,135,221,127,218,178,226,74,61,34,146,217,238,63,209,99,210,106,165,118,17,201,97,247,159,182,172,184,82,143,136,100,182,251,79,116,208,212,95,169,217,158,56,209,170,211,106,165,118,17,201,97,79,156,182,172,184,82,143,136,100,182,39,62,176,231,17,145,204,246,196,137,150,171,250,43,53,219,41,38,122,187,90,173,212,46,34,57,236,20,211,150,21,87,234,17,145,204,118,138,7,246,60,34,146,217,78,49,209,36,88,127,165,102,251,167,68,103,96,171,149,218,69,36,135,253,83,218,178,226,74,61,34,146,217,254,233,192,158,71,68,50,219,63,37,122,92,235,175,212,108,87,113,96,207,35,34,153,237,42,14,236,121,68,36,179,93,197,129,61,143,136,100,182,171,56,176,231,17,145,204,118,21,137,94,248,138,43,165,45,43,174,212,52,34,209,150,21,87,106,26,145,104,203,138,43,53,141,72,180,101,149,149,58,236,64,209,150,21,87,234,241,57,53,219,129,34,46,73,176,90,169,221,231,212,97,7,138,182,172,178,82,135,125,25,218,178,226,74,61,62,167,102,251,50,196,93,19,86,43,181,251,156,58,236,203,208,150,85,86,234,176,91,65,91,86,92,169,199,231,212,108,183,130,184,62,195,106,165,118,159,83,135,221,10,218,178,202,74,29,106,248,180,101,197,149,122,124,78,205,106,248,3,123,30,159,83,179,26,254,192,158,199,231,212,172,134,79,220,62,163,191,82,179,202,246,192,158,199,231,212,172,178,61,176,231,241,57,53,171,108,15,236,121,124,78,205,42,219,196,221,77,138,43,165,45,43,174,212,244,115,74,91,86,92,169,233,231,148,182,172,178,82,135,42,40,109,89,113,165,30,236,53,171,130,18,247,94,89,173,212,142,189,14,181,65,218,178,226,74,61,216,107,86,27,36,110,245,178,90,169,29,123,29,42,102,180,101,197,149,122,176,215,172,98,70,220,89,102,181,82,59,246,58,212,145,104,203,138,43,245,96,175,89,29,105,96,207,131,189,102,117,36,226,122,56,253,149,154,85,87,6,246,60,216,107,86,93,25,216,243,96,175,89,117,133,184,114,80,113,165,180,101,197,149,154,178,151,182,172,178,82,135,76,156,182,172,184,82,15,159,154,101,226,196,229,138,250,43,53,203,79,137,27,21,173,86,106,231,83,135,172,141,182,172,184,82,15,159,154,101,109,196,53,146,250,43,53,203,101,136,187,35,173,86,106,231,83,135,39,124,218,178,226,74,61,124,106,246,132,79,220,158,169,184,82,218,178,202,74,29,158,6,105,203,42,43,117,120,70,162,45,171,172,212,225,201,129,182,172,178,82,7,61,165,45,171,172,212,65,101,104,203,197,43,61,155,254,231,140,235,13,255,252,221,87,233,165,254,51,111,169,247,251,91,198,197,138,141,229,180,77,166,83,255,57,227,122,67,171,149,206,90,86,92,233,244,229,72,171,149,206,90,86,92,233,180,229,170,213,74,103,45,171,172,52,181,
+9,175,191,210,5,203,138,43,245,248,156,46,88,86,92,169,199,231,116,193,178,226,74,61,62,167,11,150,85,86,154,58,110,160,191,210,5,203,138,43,245,248,156,46,88,86,92,169,199,231,116,193,178,226,74,61,62,167,11,150,85,86,154,58,88,161,191,210,5,203,138,43,245,248,156,46,88,86,92,169,199,231,116,193,178,226,74,61,62,167,11,150,85,86,154,42,48,235,175,116,193,178,202,74,83,169,191,254,74,23,44,99,87,74,92,53,160,184,82,218,178,226,74,77,99,47,109,89,113,165,166,177,151,182,172,184,82,211,216,75,91,86,89,169,67,205,129,182,172,184,82,143,207,169,89,205,129,104,192,111,181,82,187,207,169,67,38,78,91,86,92,169,7,123,205,50,113,162,89,187,213,74,237,216,235,144,159,210,150,21,87,234,193,94,179,252,148,104,236,109,181,82,59,246,58,100,109,180,101,149,149,58,100,109,180,101,236,74,137,166,149,138,43,165,45,43,174,212,52,34,209,150,21,87,106,26,145,104,203,138,43,53,205,218,104,203,42,43,117,200,218,104,203,138,43,245,248,156,154,101,109,3,123,30,159,83,179,172,141,104,229,168,191,82,179,172,141,104,229,104,181,82,59,246,58,228,50,180,101,197,149,122,248,212,44,151,33,154,225,233,175,212,236,9,159,104,156,166,191,82,179,39,124,162,77,145,226,74,105,203,138,43,53,253,156,210,150,21,87,106,250,228,64,91,86,92,169,233,19,62,109,89,101,165,14,79,248,180,101,197,149,122,124,78,205,158,240,7,246,60,62,167,102,79,248,68,67,38,253,149,154,61,225,15,236,121,176,215,236,9,159,104,83,164,191,82,179,39,124,162,121,143,254,74,205,158,123,137,150,54,250,43,53,123,238,37,154,130,40,174,148,182,172,178,210,84,171,12,253,149,46,88,86,89,105,170,129,132,254,74,23,44,171,172,52,213,86,65,127,165,11,150,85,86,234,16,123,105,203,42,43,117,136,189,180,101,236,74,137,87,240,21,87,74,91,86,89,105,234,21,124,253,149,46,88,86,89,105,234,21,124,253,149,46,88,86,89,105,234,21,124,253,149,46,88,86,89,105,234,21,124,253,149,46,88,86,89,169,67,236,165,45,23,175,244,108,122,189,187,109,143,254,111,187,7,208,109,251,218,213,118,44,108,95,126,59,107,178,249,118,99,52,70,238,105,184,229,183,162,185,195,17,71,70,185,195,17,251,94,220,225,136,212,147,28,238,60,94,255,22,198,178,43,190,251,126,110,180,239,190,31,205,45,235,237,116,214,88,132,19,88,99,17,30,96,141,69,192,79,140,117,30,236,231,44,244,255,107,126,184,255,154,204,237,231,44,7,112,135,35,124,192,29,142,112,3,119,56,194,19,228,112,231,241,126,247,187,12,236,190,249,225,79,233,0,252,187,223,181,209,240,176,222,30,55,151,0,188,127,60,173,246,111,154,239,238,222,110,86,199,205,205,126,119,187,218,63,108,154,175,111,163,104,124,119,124,199,232,240,208,76,99,97,2,11,22,73,21,26,160,144,122,113,221,24,133,133,105,88,160,144,122,45,216,24,133,133,105,88,160,144,122,233,210,24,133,133,105,168,162,64,188,232,101,133,2,61,13,11,20,82,82,96,140,194,194,52,44,80,72,189,142,97,140,194,194,52,44,80,72,29,235,55,70,97,97,26,170,40,16,135,166,173,80,160,167,97,129,66,106,195,218,24,133,133,105,88,160,144,122,178,53,70,97,97,26,22,40,164,14,3,26,163,176,48,13,85,20,136,67,101,86,40,208,211,176,64,33,117,100,199,24,133,133,105,88,160,144,58,250,97,140,194,194,52,44,80,72,37,234,198,40,44,76,3,140,194,121,34,95,124,145,145,217,127,191,4,195,23,95,200,97,56,176,10,12,223,207,195,208,79,160,132,12,3,20,82,153,189,49,10,11,211,176,64,33,149,217,27,163,176,48,13,11,20,82,153,189,49,10,11,211,80,69,129,200,236,173,80,160,167,97,129,66,42,179,55,70,97,97,26,22,40,164,50,123,99,20,22,166,97,129,66,42,179,55,70,97,97,26,170,40,16,153,189,21,10,244,52,44,80,72,101,246,198,40,44,76,195,2,133,84,102,111,140,194,194,52,44,80,72,101,246,198,40,44,76,67,21,5,34,179,183,66,129,158,134,5,10,169,204,222,24,133,133,105,88,160,144,202,236,141,81,88,152,134,5,10,169,204,222,24,133,133,105,128,81,184,212,89,50,206,146,124,
+243,227,108,121,99,116,182,162,219,224,57,29,90,82,159,14,165,35,237,183,183,97,164,230,63,165,35,13,203,22,128,145,250,212,31,48,82,159,62,3,70,234,83,80,192,72,221,185,69,196,72,221,185,192,50,62,13,58,136,2,70,2,248,110,144,226,32,70,2,248,110,208,69,12,49,18,192,119,195,62,66,128,145,0,190,27,60,134,34,70,2,248,110,208,31,2,49,18,192,119,195,55,196,1,35,1,124,55,120,84,64,140,4,240,221,224,29,71,196,72,0,223,13,222,209,67,140,4,240,221,224,29,51,196,72,0,223,13,222,145,66,140,4,240,221,224,29,31,196,72,0,223,13,222,81,65,140,4,240,221,224,29,11,196,72,50,223,93,134,122,145,243,28,253,114,118,172,23,227,105,189,200,121,146,230,140,69,61,75,115,198,162,158,166,5,99,37,57,42,24,43,201,82,193,88,73,158,10,198,74,50,85,48,86,146,171,44,126,17,79,214,130,177,32,126,164,158,174,5,99,65,252,72,61,97,11,198,130,248,145,122,202,22,140,5,241,35,245,164,45,24,11,226,71,234,105,91,48,22,196,143,212,19,183,96,44,136,31,169,167,110,193,88,16,63,82,79,222,130,177,32,126,164,158,190,5,99,65,252,72,61,129,11,198,130,248,145,122,10,23,140,5,241,35,245,36,46,24,11,226,71,234,105,92,48,22,196,143,212,19,185,96,44,161,31,47,37,254,140,103,242,63,206,62,223,127,49,154,214,23,25,79,228,140,145,136,231,113,198,72,196,211,56,127,164,20,71,249,35,165,24,202,31,41,197,79,254,72,41,118,242,71,74,113,147,195,167,229,39,112,254,72,0,223,17,79,223,252,145,0,190,35,158,188,249,35,1,124,71,60,117,243,71,2,248,142,120,226,230,143,4,240,29,241,180,205,31,9,224,59,226,73,155,63,18,192,119,196,83,54,127,36,128,239,136,39,108,254,72,0,223,17,79,215,252,145,0,190,35,158,172,249,35,1,124,71,60,85,243,71,2,248,142,120,162,230,143,4,240,29,241,52,205,31,9,224,59,226,73,154,63,146,204,119,151,161,114,106,219,127,156,125,38,255,98,252,124,255,69,78,109,155,53,22,245,44,205,25,139,122,154,22,140,149,228,168,96,172,36,75,5,99,37,121,42,24,43,201,84,193,88,73,174,178,248,69,60,89,11,198,130,248,145,122,186,22,140,5,241,35,245,132,45,24,11,226,71,234,41,91,48,22,196,143,212,147,182,96,44,136,31,169,167,109,193,88,16,63,82,79,220,130,177,32,126,164,158,186,5,99,65,252,72,61,121,11,198,130,248,145,122,250,22,140,5,241,35,245,4,46,24,11,226,71,234,41,92,48,22,196,143,212,147,184,96,44,136,31,169,167,113,193,88,16,63,82,79,228,130,177,132,126,60,15,246,34,231,161,252,229,127,206,13,246,98,60,177,23,57,15,229,172,177,136,135,114,214,88,196,67,185,100,172,20,89,37,99,165,200,42,25,43,69,86,201,88,41,178,74,198,74,145,149,199,175,229,135,114,201,88,16,63,18,15,229,146,177,32,126,36,30,202,37,99,65,252,72,60,148,75,198,130,248,145,120,40,151,140,5,241,35,241,80,46,25,11,226,71,226,161,92,50,22,196,143,196,67,185,100,44,136,31,137,135,114,201,88,16,63,18,15,229,146,177,32,126,36,30,202,37,99,65,252,72,60,148,75,198,130,248,145,120,40,151,140,5,241,35,241,80,46,25,11,226,71,226,161,92,50,150,208,143,231,193,62,202,121,40,255,118,246,9,255,163,241,196,62,202,121,40,103,141,69,60,148,179,198,34,30,202,37,99,165,200,42,25,43,69,86,201,88,41,178,74,198,74,145,85,50,86,138,172,60,126,45,63,148,75,198,130,248,145,120,40,151,140,5,241,35,241,80,46,25,11,226,71,226,161,92,50,22,196,143,196,67,185,100,44,136,31,137,135,114,201,88,16,63,18,15,229,146,177,32,126,36,30,202,37,99,65,252,72,60,148,75,198,130,248,145,120,40,151,140,5,241,35,241,80,46,25,11,226,71,226,161,92,50,22,196,143,196,67,185,100,44,136,31,137,135,114,201,88,16,63,18,15,229,146,177,132,126,60,15,118,115,255,48,125,42,159,180,106,252,195,159,255,99,50,220,39,159,125,250,155,79,63,91,109,223,180,199,203,63,125,241,226,211,241,41,155,126,236,225,83,58,118,236,225,83,59,118,108,162,161,43,98,236,84,155,84,196,216,169,230,
+163,136,177,83,45,61,17,99,247,159,14,149,177,251,79,11,152,223,131,44,65,101,108,21,158,12,179,8,149,177,85,120,50,204,50,84,198,86,225,201,48,11,81,25,91,133,39,195,44,69,101,108,21,158,12,179,24,149,177,85,120,50,204,114,84,198,86,225,201,48,11,82,25,91,133,39,195,44,73,101,108,21,158,12,179,40,149,177,85,120,50,204,178,84,198,86,225,201,48,11,83,25,91,133,39,195,44,77,101,108,21,158,12,179,56,149,177,85,120,50,204,242,84,198,198,240,228,60,248,245,230,244,211,102,179,187,186,254,247,245,238,151,215,159,61,187,219,247,255,120,183,237,254,49,155,98,254,254,229,143,255,251,229,203,111,47,6,127,255,52,208,234,155,239,194,173,186,171,63,125,189,218,238,110,238,30,143,219,247,131,238,162,253,175,189,62,254,210,252,229,233,176,189,57,91,110,150,216,255,227,115,218,242,249,207,231,166,208,44,54,76,225,213,231,171,171,253,97,245,126,123,179,89,189,223,28,142,235,143,231,167,244,190,73,33,175,222,255,251,251,46,147,12,255,25,67,251,221,183,175,94,126,31,189,19,242,135,245,241,180,122,245,229,55,127,121,185,58,237,219,191,159,25,175,75,168,113,195,181,159,97,216,112,221,199,22,54,92,247,73,133,13,215,125,56,97,195,117,159,71,216,112,221,71,16,54,28,152,119,93,177,69,62,220,229,163,186,61,93,62,22,211,79,34,49,92,243,7,131,207,125,59,88,106,235,87,52,86,162,244,40,25,43,85,122,148,140,149,42,61,74,198,74,149,30,37,99,165,74,143,146,177,82,165,71,201,88,72,126,165,142,3,228,141,117,25,236,180,137,152,63,149,90,98,180,211,80,241,218,193,146,229,85,201,88,169,199,57,193,88,201,199,55,193,88,201,199,53,193,88,201,199,51,193,88,201,199,49,193,88,201,199,47,193,88,72,126,37,75,236,89,99,157,7,107,232,112,97,254,244,126,22,98,180,230,15,226,153,117,131,117,204,7,141,149,184,73,73,50,86,234,62,34,201,88,169,91,125,36,99,165,238,198,145,140,213,49,31,51,86,199,124,204,88,72,126,117,204,151,142,117,30,172,113,225,133,249,211,27,72,136,209,154,63,136,103,214,13,214,49,31,52,86,226,174,32,201,88,169,27,119,36,99,165,238,173,145,140,149,186,253,69,50,86,199,124,204,88,29,243,49,99,33,249,213,49,95,58,214,229,78,207,221,219,11,243,167,119,108,16,163,53,127,16,207,172,27,172,99,62,104,172,196,109,56,146,177,82,119,202,72,198,74,221,204,34,25,43,117,191,137,100,172,142,249,152,177,58,230,99,198,66,242,171,99,190,116,172,243,96,13,84,23,230,55,95,240,70,107,254,32,158,89,55,88,199,124,208,88,45,243,49,99,117,204,199,140,213,49,31,51,86,199,124,204,88,29,243,49,99,117,204,199,140,133,228,87,199,124,233,88,231,193,154,229,93,152,223,124,193,27,173,249,131,120,102,221,96,29,243,65,99,181,204,199,140,213,49,31,51,86,199,124,204,88,29,243,49,99,117,204,199,140,213,49,31,51,22,146,95,29,243,165,99,157,7,27,20,251,217,69,210,81,201,53,174,244,131,198,106,153,143,25,171,99,62,102,172,142,249,152,177,58,230,99,198,234,152,143,25,171,99,62,102,44,36,191,58,230,75,199,186,164,203,167,67,51,216,122,247,75,72,151,79,7,102,186,124,58,12,6,187,223,238,174,206,59,118,171,104,203,174,253,239,101,236,47,191,249,67,243,171,147,157,201,230,123,225,106,190,243,78,93,188,232,230,103,175,119,251,215,187,237,29,195,66,255,23,164,161,103,171,237,219,221,254,176,221,189,93,53,191,222,221,251,119,28,88,95,255,156,109,118,253,243,212,222,250,231,244,194,214,63,115,23,118,254,11,210,80,114,97,225,15,195,175,60,180,238,127,104,185,244,144,114,127,248,65,130,1,15,29,3,206,41,232,155,211,187,205,110,115,119,220,92,93,183,103,136,79,253,138,222,244,235,153,89,206,241,167,237,233,230,93,40,207,159,109,124,253,166,183,176,61,174,78,135,199,205,234,208,45,239,207,95,127,245,213,55,47,87,97,252,213,247,95,255,241,79,63,198,75,185,219,236,222,158,222,93,29,231,51,224,230,155,221,47,92,172,124,211,126,29,240,250,225,199,239,191,254,246,143,97,176,251,253,237,227,221,102,181,126,251,246,16,215,148,30,239,195,122,214,167,255,
+55,132,226,191,78,107,170,191,255,242,199,230,119,98,144,238,110,30,239,214,167,110,164,205,219,240,175,230,23,130,173,223,63,143,46,182,28,13,252,172,113,210,235,237,155,215,155,251,135,211,47,243,187,3,40,75,199,238,223,77,56,40,92,206,170,113,223,187,213,77,227,129,237,109,248,254,221,246,120,202,52,12,94,110,106,38,11,110,28,21,8,21,221,168,100,105,232,198,2,35,96,55,42,204,100,193,141,163,207,186,162,27,149,44,13,221,88,96,4,236,70,133,153,44,184,113,84,186,81,116,163,146,165,161,27,11,140,128,221,168,48,147,5,55,142,178,49,69,55,42,89,26,186,177,192,8,216,141,10,51,153,155,74,19,187,117,180,49,12,108,163,141,173,37,15,109,28,27,118,212,198,222,141,120,197,74,185,81,201,146,135,54,230,184,209,72,27,123,55,226,21,43,229,70,37,75,30,218,152,227,70,35,109,236,221,136,87,172,148,27,149,44,121,104,99,142,27,141,180,177,249,208,235,4,213,48,176,77,80,109,45,121,4,213,177,97,199,160,218,187,17,31,234,82,110,84,178,228,17,84,115,220,104,20,84,123,55,226,67,93,202,141,74,150,60,130,106,142,27,141,130,106,195,22,157,79,99,24,216,230,211,216,90,242,248,52,142,13,59,126,26,123,55,226,63,35,41,55,42,89,242,248,52,230,184,209,232,211,248,230,174,13,170,163,211,36,0,112,195,192,115,235,82,178,52,116,99,129,17,134,27,199,134,193,203,21,184,17,255,25,73,185,81,201,146,199,167,49,199,141,70,159,198,198,140,142,27,195,192,54,110,108,45,121,184,113,108,216,218,141,15,135,253,45,185,111,28,126,105,217,94,248,141,199,155,211,4,226,241,240,121,219,169,64,123,212,30,50,207,20,229,216,37,243,26,75,151,184,119,90,218,213,117,175,170,61,170,126,238,235,94,173,249,44,185,119,90,157,208,117,175,170,61,170,4,228,235,94,173,249,44,185,119,154,39,233,186,87,213,30,149,140,250,186,87,107,62,75,238,157,74,189,174,123,85,237,81,207,83,190,238,213,154,207,236,132,146,251,213,24,184,243,119,173,129,246,252,180,87,182,131,173,239,94,45,45,204,223,205,86,115,175,165,246,202,118,182,245,221,171,165,133,249,187,220,106,238,181,212,94,217,142,183,190,123,181,180,48,127,247,91,205,189,150,218,43,219,9,87,116,111,114,63,28,3,119,254,174,56,208,158,95,112,150,237,144,235,187,87,43,88,230,239,150,171,185,215,50,56,203,118,206,245,221,171,21,44,243,119,209,213,220,107,25,156,101,59,234,138,238,77,238,171,99,224,206,223,93,7,218,243,251,244,202,118,218,245,221,171,245,105,202,223,117,87,115,175,229,167,87,182,3,175,232,222,228,62,60,6,238,252,221,120,160,61,106,79,94,207,189,178,157,121,125,247,106,125,154,242,119,233,213,220,107,249,233,149,237,216,43,186,55,185,111,143,129,59,127,247,30,104,207,207,189,178,157,124,144,123,135,255,235,223,16,111,166,114,252,251,221,111,159,190,108,255,29,53,85,88,31,78,87,31,183,13,69,86,231,73,253,240,159,223,28,155,255,110,247,81,231,131,31,218,151,223,219,55,233,15,251,155,240,211,221,219,240,139,97,136,211,38,252,206,160,15,65,59,240,231,253,200,51,3,127,78,140,252,112,216,52,191,240,176,189,219,220,134,41,39,172,108,119,219,211,140,141,240,237,151,187,247,219,195,126,23,254,36,122,93,191,249,193,118,125,183,253,199,102,117,122,183,89,109,46,191,179,122,179,63,172,254,252,229,55,131,134,7,239,111,154,193,227,52,182,25,187,249,230,101,188,63,110,78,237,64,247,143,119,167,109,104,210,222,172,172,113,204,105,125,183,127,187,186,217,239,78,155,159,79,207,87,191,254,118,179,185,109,214,17,76,220,236,15,205,202,78,151,245,172,110,55,15,155,221,237,102,119,179,221,28,127,125,181,109,61,244,252,241,33,120,246,217,234,248,110,255,120,119,187,186,110,168,240,166,153,83,251,179,235,237,238,182,89,121,24,255,230,177,25,173,25,99,243,243,230,230,241,212,24,255,56,204,255,113,119,92,191,105,40,211,47,227,116,88,55,223,184,9,63,190,250,56,94,74,244,131,216,29,193,115,171,245,110,181,126,60,237,195,119,183,167,120,136,65,107,255,246,167,195,65,187,239,93,134,251,241,176,125,251,182,153,121,128,169,31,109,255,176,57,172,195,88,45,34,
+235,0,251,234,250,110,127,243,183,120,236,245,245,254,48,26,186,253,214,252,200,237,143,150,7,62,143,188,121,191,190,187,186,185,191,109,219,47,204,48,255,201,51,209,7,178,99,98,219,170,162,131,186,249,247,42,240,180,251,64,93,188,25,69,133,216,204,179,213,254,241,244,240,120,106,3,0,216,228,234,42,252,206,254,33,172,123,125,247,203,234,184,9,95,182,230,86,13,18,1,157,254,171,102,34,155,245,253,199,195,15,208,205,221,227,237,230,234,205,110,125,191,73,0,210,255,14,57,183,193,167,244,201,244,155,230,23,99,131,1,149,47,239,222,110,174,15,235,8,156,102,242,247,205,135,242,2,207,217,254,247,95,114,193,249,151,195,230,110,221,129,177,90,119,150,254,101,224,160,243,92,154,208,218,68,206,205,225,170,9,141,221,68,206,48,60,107,126,120,247,250,120,186,63,117,95,29,183,111,59,116,226,104,16,205,237,243,233,228,194,234,163,169,68,254,106,135,190,111,148,32,204,255,105,18,171,230,131,177,62,174,238,155,95,125,243,184,107,63,106,207,86,205,196,158,183,115,186,106,38,176,91,159,30,15,155,143,227,78,34,111,238,30,143,239,94,55,193,230,106,53,110,154,223,56,238,252,211,203,228,218,111,181,83,11,17,106,183,255,105,240,145,59,30,55,205,103,174,235,135,114,127,124,123,225,195,224,83,216,254,86,28,3,119,225,83,23,188,209,56,227,102,211,18,113,245,211,187,205,110,117,253,226,69,104,138,18,125,40,206,38,194,53,84,132,137,175,119,153,86,62,122,241,155,57,19,225,6,35,194,196,55,187,183,28,19,23,117,219,156,94,173,15,219,245,245,221,230,170,17,132,118,53,171,247,235,195,133,62,109,3,155,174,135,204,106,200,154,232,111,163,160,219,11,73,251,103,65,228,27,58,119,66,25,134,109,127,57,182,255,150,176,191,26,183,175,121,59,103,244,143,121,70,71,114,210,16,39,124,168,175,194,255,75,69,141,102,78,175,251,223,187,152,123,185,11,35,126,122,187,61,134,255,174,142,235,247,65,232,195,4,134,241,172,17,155,155,97,83,163,93,35,163,175,219,89,94,173,142,23,140,143,155,191,63,54,186,249,180,226,184,164,17,38,112,249,171,203,28,250,246,60,193,104,248,241,101,233,237,52,250,241,6,237,201,219,167,167,231,211,25,116,187,28,167,195,95,199,243,88,93,178,244,193,116,154,239,98,166,212,248,146,15,198,249,143,102,13,63,61,71,36,109,143,56,208,12,219,62,56,166,38,240,172,123,254,11,179,152,153,75,255,215,175,155,191,136,103,211,126,115,96,185,123,208,237,38,213,254,116,160,36,225,137,58,60,11,109,111,127,190,124,8,142,55,239,54,247,235,110,14,167,192,179,238,159,205,175,109,126,238,254,185,190,9,207,152,109,71,184,206,83,237,39,101,228,171,230,247,95,55,227,6,159,253,116,88,63,252,54,186,168,225,252,19,109,163,209,221,64,225,137,47,0,243,47,157,165,231,173,145,231,237,248,255,178,106,242,135,14,168,206,200,234,111,205,247,255,253,215,191,250,205,234,147,134,189,199,77,55,163,95,255,234,179,230,235,237,46,68,189,227,175,127,245,121,243,69,247,140,121,4,99,122,245,184,189,141,210,159,199,198,123,241,138,63,54,195,185,104,34,31,36,246,207,154,207,103,243,177,218,29,186,47,118,135,215,225,107,63,170,67,230,243,255,59,79,212,242,1,81,155,163,167,199,72,40,110,246,119,143,247,187,49,22,43,130,143,83,232,21,13,145,248,117,67,87,6,32,159,50,64,80,101,198,63,68,160,23,62,181,102,36,46,156,3,11,246,48,242,182,75,196,62,0,7,56,126,8,20,230,101,249,249,120,170,104,220,110,238,78,235,171,176,198,203,4,255,175,38,199,26,46,96,53,92,65,248,133,102,224,248,27,171,143,127,253,171,95,13,190,113,94,227,87,47,191,249,241,203,230,39,147,158,180,221,114,66,202,215,173,166,157,203,191,28,87,235,135,135,187,237,230,246,249,160,29,237,97,255,223,155,155,83,63,221,227,230,174,249,34,158,32,96,1,171,133,233,247,230,139,150,112,124,188,30,163,221,207,189,249,233,96,174,169,169,119,95,159,39,30,190,60,79,59,124,49,156,115,99,111,50,223,115,213,46,204,184,201,59,59,32,55,61,15,158,3,152,177,8,99,243,147,207,171,162,65,142,211,63,175,192,235,139,94,254,188,196,205,253,34,39,211,27,
+124,113,32,102,210,4,164,187,205,155,211,228,83,242,77,104,9,125,60,109,30,186,106,87,248,157,80,28,223,28,86,255,189,223,238,26,42,111,158,236,183,209,110,187,219,245,63,90,93,221,61,59,124,188,218,191,239,247,27,218,191,220,238,218,170,250,246,118,179,186,106,102,251,241,63,93,86,17,234,109,221,118,208,213,77,227,130,221,169,1,179,77,123,102,234,50,253,47,78,64,11,118,154,248,184,110,67,232,211,230,82,99,172,25,236,205,182,153,71,183,199,209,13,63,216,221,109,220,190,25,232,200,165,72,115,186,252,243,230,242,207,240,9,14,141,213,7,117,202,48,187,110,164,145,24,124,217,126,51,236,215,117,123,58,45,247,218,129,159,183,99,174,174,30,246,199,227,246,250,238,151,115,97,191,253,237,195,230,225,110,125,179,233,145,13,50,240,68,135,232,143,159,175,186,213,31,47,69,160,221,227,253,117,191,220,253,225,182,249,215,121,199,108,51,88,118,167,38,140,101,31,182,183,237,186,159,133,63,157,7,160,27,115,4,192,95,218,111,94,74,167,199,167,138,217,20,11,222,114,230,118,239,110,238,54,235,195,235,86,65,175,230,86,52,58,203,21,38,29,253,201,104,230,127,8,63,105,167,122,234,106,176,237,28,187,249,198,80,54,116,189,90,45,2,249,113,20,242,7,123,138,219,219,153,79,127,15,76,27,156,122,216,182,13,39,30,31,154,57,92,24,125,12,181,251,253,205,118,29,34,195,249,119,103,103,154,63,209,140,135,213,172,69,156,167,114,12,70,251,21,61,159,113,88,19,210,54,52,13,175,231,249,214,253,241,200,107,95,181,223,108,96,60,236,127,90,189,57,236,239,155,127,118,15,96,249,236,234,63,43,211,58,238,227,221,233,135,205,233,234,116,125,215,63,81,158,78,135,126,182,15,253,92,239,54,187,167,7,210,117,243,16,218,254,115,115,115,183,126,122,240,12,202,208,221,203,16,64,29,172,39,252,69,195,197,246,99,50,90,213,127,52,241,96,125,216,60,173,165,159,75,216,30,105,103,223,126,158,218,216,22,150,188,59,125,210,172,130,94,66,84,149,111,23,18,125,29,150,19,125,25,22,21,29,134,109,87,118,249,58,248,183,141,13,207,159,63,159,91,87,227,137,215,157,229,242,85,25,47,234,233,249,226,175,137,165,117,113,163,112,113,219,240,57,120,179,14,63,253,195,15,175,194,79,239,215,167,153,133,110,126,126,216,55,159,206,46,188,69,187,175,111,158,54,94,195,148,55,15,79,91,178,55,231,127,255,189,145,237,238,95,187,199,187,187,195,211,183,45,57,208,207,61,80,129,13,211,31,190,251,143,255,179,250,250,219,31,191,235,55,229,27,104,62,56,100,40,34,197,43,128,32,180,154,199,232,187,167,83,31,87,227,61,240,104,22,231,163,33,163,153,188,108,127,252,52,129,240,104,218,38,184,159,70,39,94,86,77,104,61,108,67,154,186,154,240,119,253,230,77,251,32,251,253,254,167,227,37,228,55,98,51,189,12,180,125,158,234,127,61,144,230,56,154,73,55,209,110,31,176,11,226,225,25,181,255,131,16,250,143,171,235,95,6,187,117,97,94,191,204,61,50,236,31,126,121,29,116,226,106,117,10,119,165,60,91,253,250,87,23,170,156,255,117,60,255,107,119,156,28,127,232,150,240,172,153,195,155,198,43,221,191,195,73,154,205,109,183,196,235,205,241,212,253,235,205,79,111,186,231,144,171,33,35,6,11,223,222,39,185,240,117,251,163,51,21,90,125,187,238,124,190,58,94,30,3,126,253,171,183,219,247,155,93,255,208,208,102,50,155,214,167,251,230,185,225,170,249,247,167,97,101,225,9,234,87,19,39,117,207,195,97,17,45,85,151,38,218,63,241,134,109,223,209,60,127,124,183,61,134,107,94,194,51,235,205,254,113,119,58,252,242,209,211,161,187,243,185,128,54,203,185,250,185,205,223,62,143,106,97,159,255,117,220,187,167,253,205,169,239,58,160,126,108,63,245,137,71,135,179,151,154,201,175,62,94,90,204,245,118,199,69,254,233,204,78,131,105,107,103,112,220,228,31,155,195,254,245,254,240,122,191,219,140,18,241,207,254,58,185,0,40,250,229,139,201,237,155,240,119,237,209,184,117,147,3,52,159,224,230,51,22,18,133,221,211,49,132,243,174,244,246,248,124,245,245,238,38,36,63,205,7,225,126,223,132,139,195,122,123,28,29,207,104,111,216,233,255,102,183,109,239,74,219,
+238,238,182,205,112,79,167,104,218,51,115,77,86,58,152,252,117,60,245,103,171,183,15,113,118,249,246,41,22,118,95,118,55,24,61,245,234,185,252,89,195,180,171,183,207,54,207,222,53,223,126,177,122,123,216,63,62,60,111,255,255,213,219,135,143,155,31,222,135,111,135,19,156,207,195,165,76,239,194,183,110,126,19,190,215,68,211,155,231,219,99,184,72,233,190,251,238,103,231,111,239,246,167,171,155,223,180,223,189,124,243,139,171,251,103,159,181,33,165,253,254,229,7,141,83,154,223,254,236,217,205,103,225,39,97,161,253,233,151,230,151,158,173,254,233,243,207,126,243,155,223,124,20,45,252,223,155,63,59,220,110,119,205,227,247,233,151,213,251,237,190,59,158,212,61,217,53,153,65,19,131,14,253,9,144,230,159,109,228,249,167,48,114,15,112,52,82,152,194,245,111,127,29,18,193,41,190,17,101,214,119,119,52,85,194,121,156,187,59,91,150,204,210,164,157,237,255,112,35,151,27,171,152,28,13,118,35,82,52,223,137,152,208,204,254,245,227,110,251,247,199,203,199,239,169,126,179,141,158,28,46,191,182,186,16,162,209,228,155,191,173,182,111,250,44,108,123,183,58,54,145,171,153,64,8,198,215,171,219,253,230,184,251,151,211,234,221,250,253,102,213,255,113,251,91,253,53,98,171,104,26,79,37,137,195,241,234,41,118,182,143,60,179,255,252,56,62,64,245,31,219,135,205,31,186,179,189,241,29,119,79,227,245,181,130,227,240,204,234,197,92,87,53,136,203,52,135,183,223,111,110,154,44,237,234,227,193,133,118,225,211,240,244,163,232,176,86,160,253,105,223,204,227,221,211,105,218,6,223,112,130,42,58,167,51,29,122,253,244,0,139,50,113,209,186,191,223,189,126,58,38,214,44,250,2,218,229,164,91,252,27,179,231,142,58,225,105,53,126,124,242,108,176,105,115,251,120,255,240,250,102,221,208,160,113,90,251,216,19,185,171,21,227,232,53,209,179,253,203,95,93,140,135,239,245,181,154,221,41,124,167,47,221,180,131,174,218,95,158,24,110,124,248,58,28,79,11,140,57,108,126,58,108,79,155,108,243,231,191,157,153,194,153,27,171,126,212,246,16,220,246,120,218,222,76,87,223,158,138,107,38,240,235,95,109,154,199,160,200,224,179,230,99,127,247,183,104,66,191,254,213,195,205,224,203,211,187,230,97,234,118,240,23,141,137,191,29,163,215,201,154,79,241,241,248,231,223,15,190,243,254,126,244,141,48,202,240,143,218,89,15,191,117,191,221,189,185,59,13,191,181,254,239,241,183,118,239,111,142,63,13,190,211,158,181,157,249,224,93,22,63,131,96,251,253,4,106,235,112,26,250,31,155,171,102,66,77,140,237,11,24,235,251,230,233,177,141,150,195,76,33,80,181,255,131,223,102,142,208,238,207,205,28,46,45,25,170,75,211,148,198,236,118,35,22,7,159,173,113,158,107,208,23,156,187,15,238,240,125,143,253,97,253,182,35,104,191,111,57,160,96,187,125,25,127,167,223,197,28,252,210,47,15,195,223,185,223,223,14,191,209,100,32,173,40,141,70,58,127,0,123,46,53,73,193,253,79,219,219,211,187,225,167,164,181,120,108,207,153,71,191,252,110,179,126,24,126,99,125,124,55,34,245,67,248,94,223,84,106,219,14,214,60,86,31,154,113,135,191,214,137,210,224,247,14,155,247,51,223,253,219,230,151,193,215,109,169,110,123,251,115,244,186,236,192,61,61,186,147,24,186,30,68,208,238,151,86,205,7,176,45,183,132,104,58,231,162,115,86,241,63,190,170,202,87,221,126,78,123,224,33,188,254,117,232,75,17,203,62,140,75,242,255,227,206,170,221,153,140,153,196,70,213,255,248,181,110,191,118,32,12,222,139,107,158,148,78,155,110,6,225,172,227,213,147,20,63,41,241,147,16,15,102,52,254,171,248,181,197,70,122,119,167,237,147,34,119,59,59,237,47,133,247,172,214,51,83,184,61,236,31,184,19,24,254,77,180,255,212,124,159,178,251,148,94,117,249,107,187,165,119,250,229,170,175,131,181,183,127,15,223,41,235,127,99,188,205,118,108,6,237,19,184,176,217,213,255,90,216,28,28,28,18,104,124,58,52,116,29,151,218,226,35,1,171,248,76,192,162,225,176,192,121,211,199,231,163,55,66,22,108,55,143,93,237,98,63,14,175,121,29,175,227,23,129,219,31,92,16,255,143,210,9,253,122,80,239,61,108,194,177,133,38,69,
+105,12,239,127,122,58,187,209,126,138,86,111,238,110,183,241,243,255,42,188,22,21,85,251,183,187,135,185,71,239,80,130,239,135,253,237,172,177,110,167,249,106,246,47,186,159,197,31,138,0,90,248,208,95,173,222,135,214,156,171,110,231,122,245,244,183,127,254,191,95,254,159,240,227,223,174,38,110,238,254,42,234,234,57,120,203,102,48,66,243,221,118,144,121,179,199,119,39,169,217,208,208,76,106,182,221,107,150,153,13,254,146,154,109,223,190,145,153,109,45,9,205,118,244,23,153,29,156,32,251,48,86,219,100,182,82,179,161,21,132,212,236,237,245,157,212,108,104,81,32,53,219,4,57,169,217,174,48,202,53,124,216,135,247,2,95,255,188,63,188,110,71,123,215,229,182,187,70,229,159,78,31,116,35,207,204,106,244,183,191,157,204,111,58,120,20,52,35,19,215,163,234,245,229,147,57,88,192,227,221,223,94,79,108,94,14,222,253,253,238,249,237,38,28,29,120,220,221,246,49,176,61,201,214,133,194,240,159,115,28,109,190,120,125,254,221,209,174,77,251,189,176,47,23,189,187,249,62,156,175,218,53,241,118,115,60,29,187,110,4,97,151,108,255,102,117,248,167,193,178,167,147,56,55,74,142,166,114,14,179,131,9,133,247,59,112,147,26,224,50,196,164,223,98,236,193,111,167,53,186,37,33,76,135,158,70,51,217,109,120,159,250,253,213,237,179,227,199,237,17,180,213,237,246,109,227,214,213,245,230,221,211,145,230,219,253,105,117,181,109,38,181,250,221,234,55,97,99,243,77,216,68,232,127,242,241,20,190,57,232,18,51,126,250,133,9,140,102,115,31,62,151,29,55,55,251,240,174,206,174,249,124,133,238,4,77,134,249,244,25,106,129,223,252,173,95,199,223,34,201,26,147,242,243,209,40,81,149,62,156,174,12,28,122,154,124,51,235,240,74,241,224,215,255,105,233,35,209,136,108,128,175,151,233,240,159,203,3,234,187,147,229,71,162,237,95,122,153,202,229,17,96,48,33,139,143,68,139,201,60,193,226,238,214,97,58,117,124,36,58,232,22,62,18,225,23,38,48,214,247,145,104,129,95,254,72,244,164,36,62,18,129,67,226,143,68,15,95,111,124,112,200,166,249,194,242,35,209,165,14,231,169,92,68,112,48,33,139,143,68,139,201,60,193,226,19,55,97,58,117,124,36,58,232,22,62,18,225,23,38,48,214,247,145,232,142,126,46,126,36,122,82,18,31,137,237,174,224,35,209,62,1,30,226,7,254,179,245,230,11,203,143,68,247,164,120,158,202,229,193,118,48,33,139,143,68,139,201,60,193,98,239,132,233,212,241,145,232,160,91,248,72,12,26,104,60,193,88,223,71,162,5,126,249,35,209,147,146,248,72,4,14,137,63,18,77,42,25,224,235,147,209,240,159,179,245,230,11,13,246,37,63,19,109,131,195,203,92,46,153,238,96,70,22,159,137,30,148,142,83,113,203,204,48,1,218,240,155,187,253,250,212,246,162,219,7,167,190,47,231,210,236,7,225,9,175,136,250,225,91,19,180,60,38,28,102,123,127,124,125,58,60,238,110,34,68,195,155,76,83,68,219,223,26,77,176,253,222,83,217,90,103,126,3,6,222,94,223,133,9,246,213,145,240,159,203,65,130,235,59,211,207,65,219,9,242,50,151,75,233,101,48,35,139,207,65,15,74,71,176,184,249,100,152,64,53,159,131,39,188,162,207,65,248,214,4,173,26,62,7,61,162,221,231,96,140,168,211,231,96,125,247,240,110,125,213,112,169,155,93,243,107,167,117,248,231,104,134,161,69,227,241,244,186,253,237,215,205,191,6,199,129,239,218,14,92,221,62,87,56,125,126,60,29,246,187,253,253,47,171,246,215,207,103,37,255,61,156,0,108,236,118,123,20,135,245,237,246,241,216,25,236,95,55,10,139,235,27,0,54,19,186,219,238,214,79,173,35,71,20,184,76,58,226,64,60,245,41,15,154,5,4,26,204,44,32,188,134,190,205,94,196,226,108,34,8,227,38,185,179,179,185,192,57,120,169,92,62,155,246,145,163,249,24,4,166,133,147,58,207,122,110,156,51,175,184,84,24,250,203,126,190,123,188,127,29,234,99,195,39,138,134,86,215,167,238,172,124,119,128,178,125,43,236,253,230,208,16,240,167,232,249,108,201,94,244,210,215,188,233,16,188,102,77,55,63,184,106,63,203,164,253,167,114,108,63,133,232,120,237,104,221,51,117,201,245,9,0,64,206,4,198,64,164,
+231,82,128,200,172,75,218,211,0,11,12,104,126,142,100,192,200,220,18,1,90,203,74,4,232,118,38,115,8,0,88,127,206,4,178,8,80,138,200,40,237,120,119,74,197,128,65,109,244,252,17,8,5,193,137,213,240,171,121,12,72,216,27,173,124,106,58,44,120,214,116,88,112,243,3,6,5,250,41,44,199,128,97,33,54,142,1,114,0,114,38,48,71,129,249,185,20,32,50,235,146,153,24,48,172,142,63,125,6,48,12,88,142,1,83,203,74,4,72,198,128,9,232,128,245,231,76,32,139,0,165,136,140,206,210,236,146,49,96,80,12,62,127,4,182,187,25,171,225,87,243,24,144,176,55,90,249,212,116,88,240,172,233,176,224,246,65,57,219,3,253,20,150,99,192,176,242,28,199,0,57,0,57,19,152,163,192,252,92,10,16,153,117,201,76,12,24,184,225,252,25,192,48,96,57,6,76,45,43,17,32,25,3,38,160,3,214,159,51,129,44,2,148,34,50,244,200,221,238,109,42,6,12,170,223,231,143,192,93,220,215,250,201,106,123,60,34,139,1,9,123,163,149,79,77,135,5,207,154,14,11,110,223,136,206,246,64,63,133,229,24,48,44,181,199,49,64,14,64,206,4,230,40,48,63,151,2,68,102,93,50,19,3,6,110,56,127,6,48,12,88,142,1,83,203,74,4,72,198,128,9,232,128,245,231,76,32,139,0,165,136,12,61,114,218,222,135,14,217,247,15,79,159,204,96,248,252,205,209,7,241,245,249,7,241,173,50,157,225,243,143,198,62,159,88,24,67,158,178,22,190,63,103,241,102,108,49,99,173,79,232,15,38,51,61,27,120,254,241,204,103,142,187,248,101,147,179,188,91,50,143,68,99,58,175,190,197,252,140,43,90,186,149,59,126,38,194,164,140,1,86,154,61,143,103,171,119,235,227,235,211,63,120,115,58,253,3,60,171,243,23,25,24,157,191,69,33,117,254,83,216,103,37,196,43,138,172,34,190,44,155,228,124,86,208,12,202,159,217,152,74,204,89,22,114,42,61,207,203,20,56,56,170,179,172,157,237,237,250,151,240,55,177,246,244,223,26,43,79,255,237,41,157,250,31,140,63,94,163,145,199,75,159,183,210,174,116,98,233,102,104,137,241,9,138,38,49,213,154,254,135,115,74,195,88,236,146,169,89,127,167,205,162,86,63,158,79,175,45,19,200,187,72,81,224,216,25,77,153,55,82,184,178,76,251,227,0,64,207,101,238,51,47,158,77,255,79,18,145,254,27,139,168,60,253,17,132,245,3,213,152,165,31,155,9,75,166,242,89,143,228,70,238,140,102,85,34,111,118,69,108,73,205,239,201,116,62,106,112,254,156,95,204,232,250,143,181,82,115,117,97,238,96,79,180,255,149,137,213,167,59,167,186,62,129,199,115,47,179,11,117,102,205,116,74,25,63,103,205,89,155,209,190,148,189,248,225,102,252,73,61,141,116,238,52,35,114,179,219,59,205,119,103,61,121,74,42,203,41,33,43,11,195,207,207,246,28,187,79,51,129,91,58,217,81,64,56,37,162,65,198,240,93,101,253,116,232,226,95,247,154,73,152,114,236,197,182,211,238,231,175,67,159,154,49,73,79,45,67,155,159,76,247,71,254,126,119,125,183,191,142,32,232,191,51,70,161,255,246,204,230,64,247,131,185,157,128,203,216,83,56,250,31,206,33,194,48,21,227,242,52,241,25,104,250,31,205,162,243,244,103,23,128,6,47,80,181,131,199,221,90,111,63,235,43,24,159,141,195,220,249,93,170,201,86,211,120,58,205,50,131,237,153,21,158,14,219,165,34,203,228,45,90,230,244,6,157,185,230,54,134,130,139,70,71,69,10,102,59,116,211,227,117,247,7,87,93,187,196,190,53,98,219,214,123,208,92,233,199,239,207,191,250,227,122,123,247,219,220,97,250,86,66,139,3,142,39,117,191,223,157,222,69,7,83,251,135,157,233,129,212,65,43,202,193,31,205,113,170,113,120,123,6,117,248,155,217,72,141,143,203,38,103,53,120,153,98,248,87,75,211,26,253,106,142,102,205,131,149,120,237,41,13,214,204,219,78,60,160,134,31,206,41,80,25,47,98,209,47,96,97,65,74,188,8,147,13,82,216,126,197,130,148,243,106,14,249,74,14,22,164,196,171,17,217,32,133,223,199,130,148,241,178,6,253,146,6,22,164,196,97,249,108,144,66,1,31,11,82,198,241,125,250,216,126,9,72,109,179,134,171,179,240,206,222,249,211,53,208,24,244,234,104,255,
+44,125,137,104,251,227,65,175,153,119,141,122,252,237,106,210,103,108,32,235,237,239,196,55,25,239,142,251,187,237,165,17,88,232,67,31,206,49,118,29,82,218,203,48,66,215,199,190,11,204,234,177,189,185,189,27,165,249,215,240,170,229,199,227,102,217,122,251,43,114,227,225,207,183,237,43,20,161,89,254,237,234,120,183,31,222,21,255,126,125,243,248,120,191,60,135,238,119,162,73,188,219,239,187,94,162,235,135,135,195,126,221,93,83,127,147,152,218,113,220,128,165,123,171,124,209,226,249,215,70,237,86,194,183,66,167,149,237,205,230,120,238,137,221,119,64,126,234,35,116,185,50,101,211,94,226,61,24,184,255,102,244,107,155,135,237,221,254,237,227,232,247,158,190,155,161,225,231,194,5,79,199,201,204,147,243,217,73,21,85,46,239,63,205,36,164,227,25,125,158,152,211,120,26,237,220,228,245,180,120,179,32,49,179,168,122,155,170,109,196,117,91,246,108,6,85,230,64,216,203,84,166,153,116,159,128,165,42,200,79,105,216,154,95,62,238,154,16,245,79,129,143,79,237,114,227,84,181,121,198,109,127,105,120,112,50,186,123,163,123,76,14,87,132,132,143,99,215,131,232,186,187,83,96,122,122,163,179,22,213,117,30,227,22,189,195,83,155,161,13,15,192,120,122,157,131,227,114,103,83,131,195,97,58,235,28,158,76,139,215,89,96,60,189,206,193,145,160,179,169,193,1,24,157,117,14,79,223,196,235,44,48,254,148,157,54,154,114,236,86,58,73,132,155,180,172,251,249,172,141,254,103,115,11,186,12,123,233,186,52,155,192,118,107,201,180,50,188,7,169,235,248,30,26,243,14,175,102,255,225,255,252,48,248,133,248,82,134,253,205,230,246,49,188,98,114,216,190,125,187,57,52,42,186,127,26,238,124,41,248,47,199,231,175,159,238,193,25,55,180,235,7,238,158,97,150,76,247,191,241,255,181,119,117,61,110,219,88,244,121,251,43,212,244,197,83,56,217,140,243,54,65,182,40,186,197,162,64,208,118,209,190,46,6,178,77,123,180,145,101,71,146,157,230,223,47,63,68,234,234,242,138,164,62,232,193,236,76,10,212,30,139,31,71,231,158,43,242,200,180,56,162,239,166,102,219,183,254,103,45,101,111,126,173,70,46,218,64,143,19,17,191,94,43,206,135,158,133,219,205,110,12,106,205,134,248,121,102,232,26,110,184,170,188,243,99,191,94,76,246,3,67,210,58,18,56,128,76,254,216,37,132,39,241,235,166,235,240,164,126,8,52,136,167,72,224,204,154,96,143,158,224,179,56,96,200,236,69,192,54,148,192,245,192,112,133,114,184,158,58,79,219,64,122,154,17,28,64,230,212,19,228,9,134,44,46,79,1,122,194,60,69,2,103,214,151,122,244,4,61,49,12,153,189,160,212,134,18,184,182,20,174,118,13,215,83,231,81,21,72,79,51,130,3,200,156,122,130,60,193,144,197,229,41,64,79,152,167,72,224,204,90,69,143,158,160,67,131,33,179,23,39,218,80,2,215,41,194,149,147,225,122,234,60,231,1,233,105,70,112,0,153,83,79,144,39,24,178,184,60,5,232,9,243,20,9,28,28,137,107,22,54,47,16,79,6,187,206,188,160,121,220,218,144,121,65,36,112,6,153,254,162,234,210,243,156,58,241,228,15,162,227,78,119,131,127,167,217,233,148,19,178,106,200,88,245,68,71,128,160,9,192,56,38,196,8,128,210,129,112,5,101,78,98,60,48,40,134,92,176,162,80,5,180,172,158,233,22,144,89,226,1,99,215,201,172,230,169,109,67,50,43,18,56,34,144,114,110,101,17,227,17,144,172,52,33,179,84,144,92,153,165,65,184,229,162,113,204,151,89,34,86,174,160,204,73,140,7,70,104,102,69,165,10,104,89,173,33,8,200,44,241,156,178,235,100,86,243,240,183,33,153,21,9,28,17,72,154,24,143,128,100,165,9,153,165,130,228,202,44,13,194,45,23,141,99,190,204,146,59,56,57,130,50,39,49,30,24,161,153,21,149,42,160,101,245,13,75,64,102,137,199,157,93,39,179,154,103,200,13,201,172,72,224,136,64,170,29,96,49,49,30,1,201,74,19,50,75,5,201,149,89,26,132,91,46,26,199,124,153,37,119,224,112,4,101,78,98,60,48,66,51,43,42,85,240,14,149,203,103,193,251,101,208,202,196,189,95,22,224,179,240,253,178,72,224,12,50,236,179,48,49,82,64,118,199,120,210,62,236,89,24,62,159,
+69,129,160,9,232,51,15,35,98,228,240,89,84,80,230,36,198,3,163,47,179,250,96,69,161,10,104,217,233,179,240,211,179,175,147,89,1,62,11,179,21,9,28,17,72,229,179,48,49,30,1,233,73,251,216,204,162,125,22,5,194,45,23,108,30,166,103,22,244,89,84,80,230,36,198,3,35,52,179,162,82,5,180,236,244,89,48,118,208,202,196,205,172,0,159,133,217,138,4,142,8,36,77,140,71,64,122,210,62,54,179,104,159,69,129,112,203,5,155,135,233,153,5,125,22,21,148,57,137,241,192,8,205,172,168,84,1,45,59,125,22,140,29,180,50,113,51,43,192,103,97,182,34,129,35,2,169,124,22,38,198,35,32,61,105,31,155,89,180,207,162,64,184,229,130,205,195,244,204,130,62,139,10,202,156,196,120,96,132,102,86,84,170,224,55,183,46,159,5,191,71,134,86,38,238,247,200,1,62,11,127,143,28,9,156,65,134,125,22,38,70,10,200,238,24,79,218,135,61,111,204,231,179,40,16,52,1,125,230,97,68,140,28,62,139,10,202,156,196,120,96,244,101,86,31,172,40,84,1,45,59,125,22,140,29,180,50,113,51,43,192,103,97,182,34,129,35,2,169,124,22,38,198,35,32,61,105,31,155,89,180,207,162,64,184,229,130,205,195,244,204,130,62,139,10,202,156,196,120,96,132,102,86,84,170,128,150,157,62,11,111,118,116,157,204,10,240,89,152,173,72,224,136,64,210,196,120,4,164,39,237,99,51,139,246,89,20,8,183,92,176,121,152,158,89,208,103,81,65,153,147,24,15,140,208,204,138,74,21,208,178,211,103,193,216,65,43,19,55,179,2,124,22,102,43,18,56,34,144,202,103,97,98,60,2,210,147,246,177,153,69,251,44,10,132,91,46,216,60,76,207,44,232,179,168,160,204,73,140,7,70,104,102,69,165,10,174,104,116,249,44,188,163,232,117,214,87,6,248,44,188,190,50,18,56,131,12,251,44,106,171,85,162,99,60,105,31,246,76,87,159,207,162,64,208,4,244,153,135,17,49,114,248,44,42,40,115,18,227,129,209,151,89,125,176,162,80,5,180,236,244,89,120,99,210,235,100,86,128,207,194,108,69,2,71,4,82,249,44,106,199,86,71,152,244,164,125,108,102,209,62,139,2,225,150,11,54,15,211,51,11,250,44,42,40,115,18,227,129,17,154,89,81,169,2,90,118,250,44,188,191,233,117,50,43,192,103,97,182,34,129,35,2,73,19,227,17,144,158,180,143,205,44,218,103,81,32,220,114,193,230,97,122,102,65,159,69,5,101,78,98,60,48,66,51,43,42,85,64,203,78,159,133,183,73,189,78,102,5,248,44,204,86,36,112,68,32,149,207,162,246,143,117,132,73,79,218,199,102,22,237,179,40,16,110,185,96,243,48,61,179,160,207,162,130,50,39,49,30,24,161,153,21,149,42,9,112,151,123,191,207,130,187,179,66,43,35,62,247,137,151,151,25,18,181,6,77,160,207,234,108,110,139,124,214,140,224,12,50,236,179,48,49,82,64,118,199,120,210,46,182,51,14,203,44,171,83,66,55,20,8,154,128,62,243,48,34,70,14,159,69,5,101,78,98,60,48,250,50,171,15,86,20,170,128,150,157,62,11,198,14,90,153,184,153,21,224,179,48,91,145,192,17,129,84,62,11,19,227,17,144,158,180,143,205,44,218,103,81,32,220,114,193,230,97,122,102,65,159,69,5,101,78,98,60,48,66,51,43,42,85,64,203,78,159,5,99,7,173,76,220,204,10,240,89,152,173,72,224,136,64,210,196,120,4,164,39,237,99,51,139,246,89,20,8,183,92,176,121,152,158,89,208,103,81,65,153,147,24,15,140,208,204,138,74,21,208,178,211,103,193,216,65,43,19,55,179,2,124,22,102,43,18,56,34,144,202,103,97,98,60,2,210,147,246,177,153,69,251,44,10,132,91,46,216,60,76,207,44,232,179,168,160,204,73,140,7,70,104,102,69,165,74,61,204,113,157,251,124,22,47,66,250,44,241,185,79,188,114,139,251,1,251,117,40,52,129,62,171,179,77,61,242,89,51,130,51,200,176,207,194,196,72,1,217,29,91,147,246,117,30,186,165,10,238,148,208,13,5,130,38,160,207,60,140,136,145,195,103,81,65,153,147,24,15,140,190,204,234,131,21,133,42,160,101,167,207,130,177,131,86,38,110,102,5,248,44,204,86,36,112,68,32,149,207,194,196,120,4,100,38,237,35,51,139,246,89,20,8,183,92,176,121,152,
+158,89,208,103,81,65,153,147,24,15,140,208,204,138,74,21,208,178,211,103,193,216,65,43,19,55,179,2,124,22,102,43,18,56,34,144,52,49,30,1,153,73,251,200,204,162,125,22,5,194,45,23,108,30,166,103,22,244,89,84,80,230,36,198,3,35,52,179,162,82,5,180,236,244,89,48,118,208,202,196,205,172,0,159,133,217,138,4,142,8,164,242,89,152,24,143,128,204,164,125,100,102,209,62,139,2,225,150,11,54,15,211,51,11,250,44,42,40,115,18,227,129,17,154,89,81,168,210,255,14,199,237,57,103,98,79,11,184,91,197,231,252,205,54,219,237,22,107,181,47,134,64,150,213,157,125,19,248,81,123,251,139,242,204,146,108,39,54,121,75,190,253,32,246,69,184,136,157,48,208,190,83,160,113,176,157,148,121,8,72,6,76,230,132,142,76,47,39,209,228,50,137,122,38,167,22,187,232,41,194,105,117,206,139,127,118,175,46,17,58,64,203,164,57,205,35,249,48,248,127,127,108,171,144,155,150,52,135,89,249,154,109,147,125,121,60,159,42,226,92,59,253,118,182,2,59,201,119,43,209,191,120,243,142,126,52,252,100,28,18,68,90,124,10,63,237,20,110,168,2,59,226,7,156,167,170,122,25,121,146,131,123,149,74,98,69,197,238,7,157,94,91,133,236,78,30,206,191,122,79,182,211,243,184,83,30,139,68,95,42,211,253,190,124,195,254,202,170,26,66,88,113,8,15,77,226,10,10,218,46,127,252,248,47,89,58,160,137,27,156,241,186,162,102,1,84,84,251,0,173,232,42,247,151,52,7,87,206,221,185,216,200,29,113,100,253,205,241,146,150,11,118,11,205,62,91,129,59,16,226,178,254,254,155,191,177,183,96,115,136,187,15,102,140,248,158,215,93,178,213,13,47,82,189,21,101,197,65,217,114,122,217,47,216,91,113,224,187,36,219,23,199,146,37,175,14,231,250,156,230,175,146,95,127,249,88,221,241,70,111,139,68,150,207,247,108,93,166,111,56,215,108,83,139,22,19,254,175,200,114,121,123,70,191,238,210,188,234,252,95,180,205,110,87,5,221,4,111,124,25,212,4,31,226,26,220,250,164,36,116,209,194,170,144,5,86,100,129,85,91,224,157,46,208,112,82,221,46,43,201,201,165,115,224,245,162,122,187,172,222,137,3,141,200,46,239,191,97,90,3,50,20,239,237,0,149,33,241,217,92,12,241,58,164,58,44,219,91,115,168,170,183,236,194,15,169,207,87,248,243,166,60,60,145,45,63,147,109,243,121,97,14,124,248,192,143,44,101,188,213,161,202,28,202,118,60,113,10,150,139,125,155,182,42,2,226,193,201,213,86,157,117,91,240,239,139,205,133,127,92,1,54,248,225,14,31,165,77,71,117,94,251,36,187,76,246,112,143,108,214,205,203,157,188,38,181,51,150,96,109,155,26,45,107,231,181,18,249,114,191,228,122,90,138,113,208,169,247,218,156,124,113,172,23,59,165,223,33,41,80,243,255,70,74,191,83,181,186,117,156,206,173,60,29,209,58,56,167,106,229,168,177,34,107,188,235,214,104,89,5,217,65,150,112,167,137,86,0,45,141,50,92,25,126,97,128,164,2,186,91,54,231,187,179,178,75,236,182,201,19,233,164,57,4,100,192,100,107,139,173,172,98,136,41,43,253,244,49,58,3,205,47,126,2,146,80,151,245,230,97,195,235,251,160,17,68,221,212,210,164,203,59,109,104,4,145,99,240,245,70,16,113,27,82,191,142,28,65,188,77,60,161,17,164,63,62,207,118,4,177,41,25,61,130,184,181,253,88,35,8,212,239,192,17,164,183,234,179,24,65,124,202,120,25,65,34,140,32,234,230,173,38,93,222,81,70,35,136,184,9,117,197,17,68,220,234,210,175,35,71,16,111,19,79,104,4,233,143,207,179,29,65,108,74,70,143,32,110,109,63,214,8,2,245,59,112,4,233,173,250,44,70,16,159,50,94,70,144,8,35,136,250,146,66,147,46,191,57,105,174,80,223,37,127,254,246,207,223,238,196,155,146,157,242,116,195,228,47,124,214,95,147,135,61,75,50,177,183,118,197,146,47,44,121,72,47,76,126,38,54,174,149,219,81,234,47,33,30,109,24,18,223,77,233,215,145,195,144,183,137,39,52,12,245,7,249,217,14,67,54,37,243,15,67,92,193,63,200,156,121,253,15,153,31,63,60,234,184,4,5,61,112,92,234,173,250,44,198,37,159,84,94,198,165,8,227,146,218,213,80,147,46,254,194,
+206,198,214,67,212,33,69,236,252,168,95,71,14,41,222,38,158,208,144,210,31,159,103,59,164,216,148,140,30,82,220,218,126,172,17,4,234,119,224,8,210,91,245,89,140,32,62,101,188,140,32,17,70,16,181,223,43,3,106,121,228,17,68,156,183,126,29,57,130,120,155,120,66,35,72,127,124,158,237,8,98,83,242,127,54,130,64,253,14,28,65,122,171,62,139,17,196,167,140,151,17,100,228,8,98,150,150,85,159,243,123,86,92,178,242,88,136,165,109,139,155,100,81,164,135,134,215,170,46,255,179,188,164,249,25,252,125,99,22,143,253,242,235,31,191,255,252,211,159,123,86,255,220,54,208,174,145,251,233,152,11,49,203,69,114,160,135,132,71,32,75,215,57,171,222,200,213,159,98,149,222,169,100,249,121,203,22,55,228,234,221,77,90,167,249,113,15,150,181,109,74,150,214,236,190,98,159,23,73,37,225,114,100,203,132,255,221,249,227,238,36,222,164,82,95,114,21,50,92,247,214,182,145,0,204,170,171,228,120,98,101,42,101,217,22,131,171,11,211,156,191,4,246,207,249,83,43,213,97,239,166,1,103,231,166,20,236,123,91,30,79,86,215,133,126,3,206,182,187,138,177,169,229,236,79,23,122,69,112,189,121,96,135,116,1,186,76,207,245,131,122,151,237,248,181,80,174,35,108,126,35,224,161,92,54,21,196,186,44,105,159,188,194,210,161,94,35,9,128,1,218,8,96,195,130,208,96,171,133,134,33,31,53,120,187,206,85,236,107,118,56,217,177,128,45,132,208,32,11,18,16,46,25,251,2,17,92,134,34,16,13,132,0,16,229,172,40,40,2,58,34,76,109,21,118,99,98,199,193,79,66,91,204,130,32,9,152,138,192,75,130,41,101,245,191,57,22,188,179,84,60,60,121,42,138,182,41,63,150,182,172,125,77,178,163,66,233,178,239,42,1,218,8,184,48,245,233,178,254,122,98,244,213,41,59,156,114,241,142,206,7,94,45,40,29,120,57,91,141,189,125,58,175,136,222,62,77,41,216,227,190,76,139,250,190,60,242,65,172,211,103,123,73,148,37,142,101,115,29,218,30,50,2,0,104,197,9,1,148,131,32,74,118,57,126,98,147,81,192,102,156,48,96,65,139,140,174,226,214,57,232,159,53,159,158,202,236,210,92,152,55,109,217,125,131,14,64,37,88,242,243,99,51,147,140,197,36,75,120,80,53,93,248,249,178,101,163,103,188,29,120,187,77,145,109,65,159,4,192,16,88,221,30,2,84,165,139,18,194,138,137,19,117,17,162,59,10,105,115,65,56,87,172,236,160,60,165,85,245,165,220,170,63,88,177,209,191,92,20,67,121,115,30,231,60,215,229,201,139,145,104,51,228,98,36,202,89,23,35,9,168,162,134,1,226,18,228,237,201,148,242,247,99,50,127,198,30,209,0,51,130,236,99,190,5,133,168,17,199,139,168,45,214,85,170,128,97,67,42,216,23,239,229,31,212,245,200,207,148,35,164,39,174,134,32,2,226,79,125,13,33,133,15,170,133,168,75,148,179,162,46,251,4,177,54,157,186,163,238,237,211,148,226,61,18,29,198,232,166,219,79,86,108,217,95,157,64,102,129,57,36,107,250,123,149,197,172,110,233,11,29,120,171,175,120,98,26,224,119,22,65,23,181,78,73,66,87,94,76,155,66,204,228,72,113,5,1,64,101,169,89,92,153,237,247,40,177,224,92,82,29,6,31,100,135,134,157,99,153,241,94,211,118,234,203,46,76,15,9,252,90,96,114,84,189,225,179,217,230,163,207,229,215,254,201,161,234,46,104,126,168,138,218,83,196,230,132,200,137,169,219,164,4,116,14,11,218,211,114,222,34,49,53,63,212,6,192,169,106,223,214,222,139,23,106,52,224,210,105,202,218,216,182,44,159,31,155,105,52,0,155,41,75,221,98,169,73,75,211,130,216,240,110,251,64,152,218,65,119,89,106,194,208,168,90,247,60,17,143,235,255,234,235,64,201,71,182,242,147,148,106,71,169,166,176,83,164,166,20,248,173,58,249,83,117,110,241,138,74,177,124,95,178,156,165,21,91,108,30,82,53,137,95,154,217,203,157,88,123,6,113,16,245,90,64,63,194,102,147,138,103,41,147,7,22,210,9,109,210,34,89,51,137,49,171,151,77,101,49,170,229,235,116,243,137,39,182,168,81,214,55,175,122,96,170,138,131,81,170,106,215,2,169,75,14,39,179,169,120,45,160,107,182,207,138,193,40,101,173,24,16,207,188,149,
+29,75,8,164,139,155,30,48,171,22,199,31,162,157,132,119,199,39,46,71,213,31,108,162,77,134,255,1,26,12,65,222,
 0};
+unsigned long mal_init_inline_len = 1322393;
 unsigned char* mal_init_inline = 0;
 
 unsigned char createdb_inline_arr[] = 
@@ -87,7 +89,7 @@ unsigned char createdb_inline_arr[] =
 168,46,155,169,3,47,117,255,183,57,220,97,103,56,4,41,167,162,148,161,146,195,110,138,22,49,201,86,229,190,230,228,16,216,54,26,159,27,188,74,49,110,56,58,214,142,3,10,160,151,186,212,31,180,181,232,129,193,157,246,153,81,50,68,57,188,248,148,169,200,230,101,160,252,170,155,81,87,235,133,88,186,80,69,229,235,32,174,244,134,237,148,195,23,215,3,233,34,4,4,35,51,128,178,250,125,209,251,212,191,0,103,124,172,43,114,153,205,69,47,23,47,233,106,27,163,240,167,129,241,220,204,66,76,177,92,12,141,129,243,204,88,151,6,102,206,6,197,75,19,182,171,61,223,55,131,63,116,186,140,46,116,181,160,191,117,181,23,253,214,31,40,53,253,54,232,106,218,190,159,157,66,190,109,150,70,192,185,79,224,112,134,70,101,38,11,164,26,100,167,81,113,220,63,186,200,192,128,86,103,106,48,120,15,205,10,52,227,225,121,251,40,213,27,232,223,208,36,240,188,107,20,232,88,1,163,60,132,84,246,172,109,84,140,140,176,0,69,224,113,151,11,3,102,43,52,125,40,154,248,128,181,224,10,198,49,67,79,93,252,141,185,130,77,173,215,230,230,82,250,50,105,57,157,210,53,120,162,15,83,171,92,133,115,170,70,182,9,205,166,229,76,236,240,141,49,19,227,42,39,62,192,252,106,205,18,23,63,44,187,129,89,60,255,72,235,199,236,165,231,211,33,239,47,225,247,88,28,36,208,132,249,160,139,223,227,39,115,163,155,232,55,68,194,63,117,255,200,14,26,252,35,176,143,172,213,96,115,55,156,186,99,249,232,21,30,31,0,115,209,57,252,126,141,159,184,207,131,152,46,204,109,32,130,208,93,192,212,219,82,208,111,113,10,204,122,0,242,27,91,114,10,91,7,120,150,104,3,166,185,52,85,125,117,64,159,88,71,119,62,204,87,97,150,106,205,96,106,204,207,142,79,108,152,136,55,144,90,68,162,190,74,227,243,222,38,59,14,104,210,110,95,91,254,212,229,179,93,152,199,195,223,59,194,72,31,99,95,221,177,254,241,167,35,113,36,5,29,94,28,213,224,215,24,36,48,38,153,141,241,88,189,97,157,104,249,29,64,97,184,241,117,0,82,158,186,49,193,143,144,59,53,2,64,52,178,26,191,105,203,206,125,83,162,79,73,189,145,149,168,57,43,6,134,236,155,209,11,152,99,90,59,112,156,39,75,204,4,2,222,11,39,155,170,126,3,213,60,84,166,170,223,82,53,197,68,93,143,95,56,175,98,187,188,13,32,184,250,139,241,189,41,49,140,201,114,28,120,212,58,96,113,192,91,71,77,113,242,47,63,95,141,68,204,110,175,93,63,245,76,224,242,64,58,97,226,214,155,52,72,28,181,184,94,61,53,248,150,174,151,76,88,75,40,96,94,4,33,222,136,146,165,19,52,44,8,81,193,214,82,203,79,190,194,5,44,188,118,155,235,40,174,13,41,180,66,240,120,168,129,23,143,249,185,0,124,12,135,56,6,62,143,96,64,239,57,68,64,48,98,115,52,175,16,130,210,227,60,64,129,59,50,21,168,132,71,50,193,215,59,165,212,169,119,210,47,165,42,75,187,166,116,171,148,119,122,117,144,243,78,69,109,178,203,75,102,179,237,188,217,111,236,127,28,119,226,249,46,59,25,227,196,15,220,22,29,82,56,198,108,149,29,54,224,23,46,42,161,243,2,128,238,233,8,93,215,201,152,2,56,120,46,124,12,211,212,203,81,247,136,189,197,18,204,69,241,72,181,119,205,156,137,103,25,153,229,97,163,128,63,141,226,241,155,46,128,148,30,116,219,10,21,236,62,84,101,38,177,48,144,253,115,249,145,45,62,207,38,227,232,42,218,106,189,221,196,148,93,83,67,247,113,226,205,98,55,211,97,151,52,50,211,47,58,149,19,253,225,48,174,250,162,189,136,83,123,10,8,69,119,211,246,173,217,29,46,59,174,25,208,59,180,142,192,114,50,84,112,246,23,90,72,134,255,37,140,36,211,162,164,157,204,32,168,36,214,84,217,138,44,115,51,49,45,5,254,91,109,44,170,25,217,9,252,167,2,249,42,83,81,45,178,86,2,45,238,105,28,100,18,32,128,241,41,76,210,198,72,59,120,39,93,1,3,194,112,175,43,240,144,139,67,179,2,13,40,141,228,136,12,73,21,207,47,201,126,12,148,231,88,247,46,13,115,200,222,103,208,112,184,67,246,107,26,240,21,37,11,89,176,87,152,62,100,
 200,56,63,103,173,195,53,214,106,136,211,144,100,35,45,159,70,142,249,217,40,221,149,119,229,28,129,154,146,187,82,1,27,151,254,204,58,180,85,96,96,170,14,205,115,176,79,255,104,43,68,84,251,71,34,204,113,91,251,125,159,254,169,55,240,158,158,223,173,165,21,217,161,183,136,255,23,229,59,119,110,204,160,202,155,81,138,133,247,241,64,166,35,141,238,252,14,146,23,178,161,243,203,209,151,148,157,241,71,236,204,90,44,92,71,67,32,83,5,212,123,5,117,168,159,31,138,135,191,234,135,57,28,135,6,18,138,235,28,240,149,134,120,101,70,119,241,52,135,230,149,137,6,249,119,244,175,127,17,115,206,207,215,251,2,45,221,42,254,64,183,90,239,19,228,13,37,198,219,145,106,17,83,53,72,5,203,214,131,165,242,136,27,143,247,194,148,30,219,203,254,126,99,11,248,217,96,9,253,59,129,127,155,69,175,107,228,224,140,113,53,210,52,103,205,224,60,244,230,152,25,253,225,222,25,41,171,184,247,73,87,162,8,79,196,29,54,84,91,60,1,43,239,202,53,240,122,137,233,139,189,164,204,116,77,105,169,25,77,30,105,10,150,149,155,231,252,20,114,195,131,67,129,208,159,13,246,87,224,249,252,87,176,16,85,126,192,255,122,243,69,136,183,107,81,137,206,224,9,33,144,226,197,211,206,207,188,160,83,60,73,177,163,145,29,106,86,220,95,128,26,67,206,191,3,73,134,132,251,216,43,91,132,110,132,103,170,65,90,112,173,193,209,225,245,130,23,132,223,112,121,93,78,185,145,93,244,57,233,133,42,98,82,94,66,73,76,240,245,106,2,68,44,189,153,11,238,222,14,28,165,42,233,90,174,46,235,53,37,211,34,165,45,175,15,30,72,91,82,81,28,151,101,199,98,216,32,18,42,242,37,39,12,216,84,20,242,127,45,138,252,133,147,8,188,84,35,247,79,180,222,10,16,206,204,87,18,129,92,48,99,111,95,231,148,41,199,185,28,211,26,69,92,201,101,188,230,178,39,234,82,106,217,140,52,197,124,17,130,241,41,245,226,12,73,223,23,227,144,26,135,104,204,151,57,111,17,141,185,248,7,227,247,221,159,49,173,17,192,156,238,138,14,212,84,196,70,12,130,18,46,97,96,112,13,124,152,107,226,78,3,254,166,157,142,123,227,231,162,75,229,230,35,104,164,232,126,163,235,83,228,191,85,227,73,195,191,203,194,167,31,255,170,31,167,7,127,160,24,150,121,208,202,18,150,121,126,168,9,73,63,120,149,163,36,253,252,117,118,4,153,231,111,86,140,36,13,246,214,0,203,172,202,190,125,171,199,148,125,244,94,119,158,121,244,238,80,41,70,174,213,187,28,47,178,16,191,230,136,206,162,127,149,149,64,14,226,32,199,152,44,196,219,44,207,115,16,175,179,226,204,65,180,86,177,55,11,248,102,133,2,228,0,223,173,16,120,14,240,253,10,201,231,0,127,93,175,2,6,124,129,167,207,186,149,18,222,62,219,36,123,92,249,69,236,205,188,248,142,175,30,130,41,207,188,40,166,125,63,220,153,58,44,12,112,61,72,175,82,210,201,239,73,124,29,209,118,25,203,243,35,118,21,196,215,116,11,47,119,1,212,66,44,53,210,94,167,136,205,113,251,206,149,75,27,136,192,131,199,249,171,103,120,163,246,80,146,143,30,146,207,57,104,95,20,100,241,250,220,121,234,221,18,199,198,139,115,237,51,183,100,38,153,155,49,157,171,49,17,88,171,179,100,197,17,169,156,130,210,252,137,98,11,239,25,118,248,170,26,249,191,26,140,89,178,205,227,43,124,240,176,86,231,139,167,208,200,11,89,152,248,47,232,200,107,90,73,203,177,1,191,95,19,107,108,53,252,45,46,145,194,154,186,113,107,192,62,157,197,187,79,151,95,41,40,144,199,210,13,227,26,61,195,70,161,125,13,221,183,96,94,204,1,113,53,143,47,233,64,114,167,81,37,97,232,250,241,24,199,15,179,9,179,184,6,154,111,166,50,224,197,238,170,213,45,112,212,255,13,124,179,15,89,181,166,21,74,205,104,65,119,61,231,161,233,184,207,125,60,196,23,143,253,204,63,191,246,240,212,209,59,128,16,191,10,96,240,120,119,8,204,251,56,203,165,95,5,48,234,232,222,253,134,113,12,113,30,110,225,1,192,194,3,109,203,63,11,131,91,27,114,187,6,227,63,138,149,209,208,131,231,11,6,54,109,253,107,131,67,0,7,113,214,252,
 3,44,60,118,125,197,37,190,44,192,166,222,210,229,222,200,129,140,241,202,138,112,155,224,220,243,113,72,22,186,22,112,98,68,2,80,142,80,150,29,39,214,140,6,23,4,49,165,226,146,37,11,232,193,195,62,98,51,233,193,39,115,235,167,55,79,230,120,38,247,221,52,12,18,168,198,55,44,136,133,214,251,33,237,6,142,243,243,114,61,60,16,223,73,108,224,101,178,8,168,211,57,185,216,79,119,252,117,13,78,19,184,147,161,179,114,231,32,230,25,157,109,40,222,64,57,94,8,146,158,193,172,21,161,52,149,147,32,68,52,184,4,2,90,112,133,167,240,90,184,210,47,199,29,145,144,174,240,192,82,60,106,222,117,154,234,8,104,62,104,217,99,122,228,208,198,253,73,174,123,170,89,200,49,209,188,234,42,125,236,58,167,113,65,67,196,38,122,139,44,71,94,171,99,171,110,140,111,195,112,90,132,175,36,98,147,4,113,26,170,53,153,88,94,24,225,69,197,110,83,81,6,120,64,25,111,168,227,137,204,55,249,174,78,227,62,88,193,238,6,61,88,4,81,228,209,189,156,234,165,5,93,61,33,128,136,245,96,69,98,163,110,196,110,93,154,118,128,57,224,41,10,216,46,0,215,130,6,133,75,232,220,145,91,224,107,145,156,153,235,79,227,235,21,55,93,236,9,162,247,178,71,91,194,92,106,103,143,187,76,243,252,74,122,102,86,240,225,165,64,96,226,102,150,81,55,140,114,246,220,108,194,145,248,250,94,138,221,29,196,112,235,57,241,181,56,72,83,176,16,92,153,134,185,118,173,69,166,6,24,6,250,163,202,11,226,32,30,46,237,90,62,157,189,41,166,219,70,79,81,64,167,245,106,160,208,93,230,234,246,18,90,23,217,51,170,104,162,14,179,116,129,169,240,32,79,197,218,130,115,57,213,179,226,147,57,13,169,240,169,102,72,65,123,78,138,136,11,134,92,48,145,120,41,41,148,8,149,101,233,57,168,161,114,146,179,94,228,44,74,29,120,255,44,255,199,150,127,25,57,128,76,159,165,242,15,151,10,164,123,207,50,122,26,25,97,240,207,196,182,92,232,183,194,43,47,166,160,41,99,127,3,35,228,4,66,51,222,115,205,15,254,167,8,73,111,152,189,56,18,14,20,175,9,154,205,130,91,158,25,88,34,7,226,76,150,249,84,136,7,163,199,30,223,83,224,194,204,69,56,87,138,201,109,21,244,41,3,98,102,10,132,126,154,82,36,228,53,164,17,128,153,16,99,218,119,29,220,98,110,2,93,255,38,181,144,55,18,103,124,167,115,170,7,83,40,165,30,123,242,136,234,180,2,237,236,224,21,11,226,184,122,135,137,187,215,144,19,9,36,25,17,192,203,249,177,110,130,203,222,41,174,73,16,163,185,72,91,160,61,100,179,115,131,2,108,45,243,20,174,183,26,26,183,126,216,179,224,10,90,65,248,115,97,118,101,27,154,132,45,105,131,144,21,165,210,42,5,138,60,35,125,76,183,241,0,191,75,19,100,76,115,233,182,8,223,117,41,53,19,10,224,254,44,173,204,123,82,155,37,59,104,60,190,92,199,199,19,252,5,198,58,221,208,137,83,18,33,104,153,230,58,127,193,236,1,55,193,224,89,228,19,74,4,40,211,244,99,207,246,22,36,6,80,90,176,14,149,214,162,62,169,164,216,84,59,129,18,41,90,98,51,204,38,16,151,152,154,106,12,73,132,135,143,175,58,95,222,208,61,47,134,180,240,202,133,145,237,238,64,133,139,206,82,93,242,149,213,82,48,214,29,152,167,128,177,240,163,213,11,129,192,113,240,108,231,123,83,170,116,3,127,115,101,166,159,66,141,121,53,42,48,254,82,154,139,5,82,218,6,190,251,78,61,152,88,51,180,252,239,77,46,58,252,165,228,72,216,132,0,241,183,114,67,69,57,23,251,142,99,73,22,14,29,9,185,106,24,177,214,53,188,219,51,76,64,229,110,73,173,236,192,7,115,168,137,63,106,156,98,144,117,186,95,133,198,88,199,9,29,88,247,142,188,200,154,183,144,127,247,38,55,162,109,115,15,157,227,30,94,233,114,195,177,136,154,58,85,129,226,3,70,89,199,234,128,17,23,150,118,232,179,178,230,30,60,6,215,221,30,226,171,14,14,189,135,215,210,236,200,231,1,77,203,57,136,198,150,2,225,121,38,71,162,104,72,65,136,148,84,34,17,132,3,4,95,5,99,38,233,30,24,229,71,73,138,64,62,134,74,196,135,183,36,
-170,39,38,32,31,97,26,74,177,71,1,202,46,212,45,181,121,164,33,254,97,255,97,47,90,245,114,114,54,188,222,71,38,93,38,90,122,132,55,53,208,173,34,18,66,170,128,112,189,31,217,190,88,229,218,71,119,198,107,63,238,163,91,219,255,176,235,250,142,190,225,72,68,8,125,255,76,126,110,111,7,56,215,139,245,42,1,182,85,161,81,76,81,231,116,129,17,247,195,55,209,2,175,193,66,7,39,92,156,177,60,32,175,185,33,151,197,151,8,146,5,60,191,162,165,1,90,18,192,145,169,169,41,57,50,198,119,237,209,29,203,244,254,133,156,136,211,148,163,144,180,135,238,143,196,11,105,198,66,253,154,46,26,223,136,70,20,6,23,51,47,70,138,193,219,115,183,183,176,66,238,247,240,195,211,226,4,77,167,52,53,223,72,200,60,117,71,158,163,238,198,144,105,153,72,53,132,35,179,145,113,59,52,62,68,0,34,18,14,125,31,73,144,219,163,152,247,33,13,196,133,104,66,28,254,146,133,137,230,192,49,124,47,154,134,131,169,93,22,50,7,244,186,0,136,211,157,134,123,95,0,119,157,76,221,28,96,235,109,1,164,186,129,102,13,82,9,171,20,23,33,193,136,56,223,56,12,252,142,107,20,123,5,175,217,191,255,13,88,178,252,91,3,12,228,21,241,104,77,139,87,135,133,12,219,113,193,235,103,7,178,227,226,155,62,11,239,99,41,124,174,31,115,27,44,82,52,153,39,215,226,69,145,154,221,178,53,58,6,89,6,195,102,255,254,143,193,71,178,50,81,73,30,0,242,117,206,90,65,221,129,160,204,155,124,144,119,123,177,214,193,225,235,3,246,47,232,248,23,118,187,150,92,200,217,137,220,43,149,160,40,106,87,145,169,125,152,31,248,47,208,189,144,237,99,188,224,99,184,82,145,45,77,169,201,71,147,218,131,117,20,202,89,4,18,169,249,232,23,204,163,114,204,204,24,42,16,2,62,69,233,52,93,249,153,174,84,150,152,170,205,85,8,11,75,213,73,107,74,85,58,174,13,73,241,44,83,9,67,204,210,34,237,43,85,13,204,200,54,13,18,220,120,153,229,43,41,62,201,250,160,217,58,52,12,64,241,154,149,100,182,25,202,30,111,109,47,59,255,220,110,190,249,136,243,75,149,190,10,158,137,236,179,107,100,159,93,157,125,118,141,236,179,171,178,79,170,197,113,166,6,88,51,1,68,70,10,85,42,85,168,27,67,79,193,106,16,42,233,25,81,93,176,70,182,208,179,30,131,6,4,50,13,73,19,39,251,64,136,174,202,129,187,102,14,220,53,114,224,174,202,129,119,119,86,39,245,172,155,81,50,125,5,176,1,186,226,26,224,148,10,126,16,243,229,100,78,59,207,68,74,35,102,189,5,89,131,71,41,130,222,39,105,233,75,70,145,6,149,113,88,201,79,111,230,33,74,46,27,72,136,252,32,22,217,144,124,231,193,243,32,143,223,0,135,190,78,168,146,92,39,197,119,32,65,50,115,104,74,150,76,145,0,249,26,201,226,43,241,181,144,62,114,241,226,132,38,186,245,28,63,120,134,108,12,121,87,51,37,59,5,104,0,93,53,18,91,29,199,165,213,11,184,83,211,42,70,15,117,81,60,151,74,69,79,101,65,62,35,203,226,79,232,167,168,215,22,198,59,84,69,217,39,78,11,249,87,31,156,49,31,249,108,138,71,92,244,246,252,94,76,138,165,7,12,52,130,240,40,222,239,174,16,58,195,23,77,11,92,92,201,178,224,249,148,144,167,126,85,40,62,150,145,99,167,213,154,165,27,146,73,232,147,72,76,204,205,162,61,119,250,62,227,154,10,17,56,205,146,215,87,22,132,9,181,34,41,158,83,132,76,221,134,184,199,95,99,25,254,63,23,90,180,175,87,53,190,55,51,67,6,112,97,73,111,231,68,183,96,100,169,242,230,144,178,242,190,114,11,63,133,0,111,11,93,0,86,38,238,226,78,209,92,180,144,41,154,221,3,107,3,87,42,85,126,244,216,61,52,88,124,53,251,91,122,195,205,33,229,122,126,246,26,5,94,131,246,57,138,143,244,212,141,188,44,193,19,237,128,246,219,130,53,102,130,213,160,250,51,40,126,125,33,90,42,141,218,79,102,51,48,11,126,246,147,8,103,50,197,204,224,48,78,128,202,172,3,166,192,4,18,79,172,80,170,7,90,171,128,205,83,236,159,183,28,243,5,26,177,127,7,130,206,4,191,121,18,171,54,146,20,241,12,151,
-26,104,141,158,94,209,83,30,129,223,27,34,76,6,141,113,235,97,113,119,114,247,68,65,111,242,89,137,222,98,241,165,233,135,156,152,4,14,45,35,209,135,68,142,11,79,2,148,207,193,242,40,228,168,115,56,228,131,21,56,240,140,53,18,1,250,75,144,195,201,31,242,232,41,207,137,26,114,125,124,142,2,85,245,168,127,7,172,134,70,97,30,86,85,223,21,187,150,41,5,162,45,219,244,109,85,103,196,212,10,28,244,93,83,155,230,244,142,55,73,36,95,31,36,75,199,137,219,93,180,95,23,117,38,134,3,134,107,120,186,38,179,157,78,106,147,129,24,120,110,208,166,245,239,31,66,27,10,98,142,123,56,34,116,159,168,54,83,55,142,196,71,170,174,179,203,207,47,0,184,255,7,247,243,114,55,
+170,39,38,32,31,97,26,74,177,71,1,202,46,212,45,181,121,164,33,254,97,255,97,47,90,245,114,114,54,188,222,71,38,93,38,90,122,132,55,53,208,173,34,18,66,170,128,112,189,31,217,190,88,229,218,71,119,198,107,63,238,163,91,219,255,176,235,250,142,190,225,72,68,8,125,255,76,126,110,111,7,56,215,139,245,42,1,182,85,161,81,76,81,231,116,129,17,247,195,55,209,2,175,193,66,7,39,92,156,177,60,32,175,185,33,151,197,151,8,146,5,60,191,162,165,1,90,18,192,145,169,169,41,57,50,198,119,237,209,29,203,244,254,133,156,136,211,148,163,144,180,135,238,143,196,11,105,198,66,253,154,46,26,223,136,70,20,6,23,51,47,70,138,193,219,115,183,183,176,66,238,247,240,195,211,226,4,77,167,52,53,223,72,200,60,117,71,158,163,238,198,144,105,153,72,53,132,35,179,145,113,59,52,62,68,0,34,18,14,125,31,73,144,219,163,152,247,33,13,196,133,104,66,28,254,146,133,137,230,192,49,124,47,154,134,131,169,93,22,50,7,244,186,0,136,211,157,134,123,95,0,119,157,76,221,28,96,235,109,1,164,186,129,102,13,82,9,171,20,23,33,193,136,56,223,56,12,252,142,107,20,123,5,175,217,191,255,13,88,178,252,91,3,12,228,21,241,104,77,139,87,135,133,12,219,113,193,235,103,7,178,227,226,155,62,11,239,99,41,124,174,31,115,27,44,82,52,153,39,215,226,69,145,154,221,178,53,58,6,89,6,195,102,255,254,143,193,71,178,50,81,73,30,0,242,117,206,90,65,221,129,160,204,155,124,144,119,123,177,214,193,225,235,3,246,47,232,248,23,118,187,150,92,200,217,137,220,43,149,160,40,106,87,145,169,125,152,31,248,47,208,189,144,237,99,188,224,99,184,82,145,45,77,169,201,71,147,218,131,117,20,202,89,4,18,169,249,232,23,204,163,114,204,204,24,42,16,2,62,69,233,52,93,249,153,174,84,150,152,170,205,85,8,11,75,213,73,107,74,85,58,174,13,73,241,44,83,9,67,204,210,34,237,43,85,13,204,200,54,13,18,220,120,153,229,43,41,62,201,250,160,217,58,52,12,64,241,154,149,100,182,25,202,30,111,109,47,59,255,220,110,190,249,136,243,75,149,190,10,158,137,236,179,107,100,159,93,157,125,118,141,236,179,171,178,79,170,197,113,166,6,88,51,1,68,70,10,85,42,85,168,27,67,79,193,106,16,42,233,25,81,93,176,70,182,208,179,30,131,6,4,50,13,73,19,39,251,64,136,174,202,129,187,102,14,220,53,114,224,174,202,129,119,119,86,39,245,172,155,81,50,125,5,176,1,186,226,26,224,148,10,126,16,243,229,100,78,59,207,68,74,35,102,189,5,89,131,71,41,130,222,39,105,233,75,70,145,6,149,113,88,201,79,111,230,33,74,46,27,72,136,252,32,22,217,144,124,231,193,243,32,143,223,0,135,190,78,168,146,92,39,197,119,32,65,50,115,104,74,150,76,145,0,249,26,201,226,43,241,181,144,62,114,241,226,132,38,186,245,28,63,120,134,108,12,121,87,51,37,59,5,104,0,93,53,18,91,29,199,165,213,11,184,83,211,42,70,15,117,81,60,151,74,69,79,101,65,62,35,203,226,79,232,167,168,215,22,198,59,84,69,217,39,78,11,249,87,31,156,49,31,249,108,138,71,92,244,246,252,94,76,138,165,7,12,52,130,240,40,222,239,174,16,58,195,23,77,11,92,92,201,178,224,249,148,144,167,126,85,40,62,150,145,99,167,213,154,165,27,146,73,232,147,72,76,204,205,162,61,119,250,62,227,154,10,17,56,205,146,215,87,22,132,9,181,34,41,158,83,132,76,221,134,184,199,95,99,25,254,63,23,90,180,175,87,53,190,55,51,67,6,112,97,73,111,231,68,183,96,100,169,242,230,144,34,222,182,160,23,122,113,237,18,27,233,117,252,52,180,230,236,42,177,111,220,152,191,200,155,7,32,71,252,158,72,127,113,4,51,39,97,171,121,158,41,36,171,89,198,177,167,170,230,246,210,140,108,179,224,54,53,156,107,160,47,85,177,137,101,43,111,99,183,240,67,15,136,37,192,64,224,25,19,55,141,167,36,82,180,76,43,154,221,3,107,3,215,97,85,246,247,216,61,52,88,124,53,251,91,122,195,173,47,229,122,126,246,137,5,62,145,118,113,138,79,16,213,125,195,44,193,243,250,128,246,219,130,21,116,130,213,160,250,35,
+47,126,57,35,90,24,141,218,79,102,51,48,11,126,178,149,8,214,50,129,206,224,48,206,183,202,172,114,166,192,4,18,79,172,191,170,7,90,171,128,205,83,236,159,183,28,243,229,39,177,59,9,188,203,4,191,232,18,107,82,146,20,241,12,23,82,232,13,4,109,64,160,44,9,191,166,68,152,12,26,227,78,199,226,238,228,222,144,130,222,228,179,18,189,197,226,59,218,15,57,49,9,28,90,70,162,15,137,28,151,213,4,40,159,97,230,81,200,81,231,112,200,7,43,112,224,9,114,36,2,140,6,32,135,147,63,228,193,90,158,19,53,228,234,255,28,5,170,234,81,255,14,88,13,141,194,60,138,171,190,43,246,100,83,130,71,27,210,233,203,177,206,136,169,245,69,232,187,166,182,4,234,253,124,146,72,190,250,73,150,142,211,210,187,104,191,46,234,76,12,7,12,87,40,117,77,102,179,160,212,38,3,49,240,220,160,77,235,223,63,132,54,20,196,28,119,168,68,232,62,81,109,166,24,59,249,39,184,174,179,203,79,103,0,184,255,7,97,108,188,106,
 0};
-unsigned char* createdb_inline = 0;
+unsigned long createdb_inline_len = 71192;
@@ -42,6 +42,7 @@ mi = mal_include("mal_init.mal")
 s = zlib.compress(mi, 9)
 outf = open(sys.argv[2], "w")
 outf.write("unsigned char mal_init_inline_arr[] = " + to_hex(s) + ";\n")
+outf.write("unsigned long mal_init_inline_len = %d;\n" % len(mi))
 outf.write("unsigned char* mal_init_inline = 0;\n")
 
 s = ""
@@ -51,7 +52,8 @@ for f in files:
     if f.endswith(".sql") and not f.startswith(blacklist):
         print(f)
         s += open(os.path.join("createdb", f)).read() + "\n"
+createdb_len = len(s)
 s = zlib.compress(s, 9)
 outf.write("\nunsigned char createdb_inline_arr[] = " + to_hex(s) + ";\n")
-outf.write("unsigned char* createdb_inline = 0;\n")
+outf.write("unsigned long createdb_inline_len = %d;\n" % createdb_len)
 
@@ -1920,6 +1920,9 @@ gdk_export int	GDK_vm_trim;		/* allow trimming */
 
 gdk_export size_t GDKmem_cursize(void);	/* RAM/swapmem that MonetDB has claimed from OS */
 gdk_export size_t GDKvm_cursize(void);	/* current MonetDB VM address space usage */
+gdk_export void GDKsetmemorybudget(size_t budget);	/* memory budget of the query run by this thread */
+gdk_export size_t GDKmemorybudget(void);
+gdk_export size_t GDKmemoryavail(void);	/* memory an operator of this thread may still use */
 
 gdk_export void *GDKmalloc(size_t size)
 	__attribute__((__malloc__))
@@ -2090,6 +2093,7 @@ gdk_export void *THRdata[THREADDATA];
 
 #define THRget_errbuf(t)	((char*)t->data[2])
 #define THRset_errbuf(t,b)	(t->data[2] = b)
+#define THRmembudget	3	/* slot of the query memory budget */
 
 #ifndef GDK_NOLINK
 
@@ -2476,6 +2480,8 @@ gdk_export void BATsetprop(BAT *b, int idx, int type, void *v);
 
 gdk_export BAT *BATselect(BAT *b, BAT *s, const void *tl, const void *th, int li, int hi, int anti);
 gdk_export BAT *BATthetaselect(BAT *b, BAT *s, const void *val, const char *op);
+gdk_export BAT *BATbloom(BAT *b, BAT *s);
+gdk_export BAT *BATbloomselect(BAT *b, BAT *s, BAT *bf);
 
 gdk_export BAT *BATconstant(oid hseq, int tt, const void *val, BUN cnt, int role);
 gdk_export gdk_return BATsubcross(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr)
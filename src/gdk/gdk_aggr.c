@@ -284,6 +284,124 @@ BATgroupaggrinit(BAT *b, BAT *g, BAT *e, BAT *s,
 		}							\
 	} while (0)
 
+/* Floating point sums go through bins, see sumbins_add in
+ * gdk_calc_private.h, so that the result does not depend on how the
+ * values were split up: mitosis sums each piece into a state with
+ * BATgroupsumbins and merges the states with BATgroupbinsum. */
+#define AGGR_SUMBINS(TYPE)						\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) values;	\
+		TYPE x;							\
+		lng *restrict st;					\
+		for (;;) {						\
+			if (cand) {					\
+				if (cand == candend)			\
+					break;				\
+				i = *cand++ - seqb;			\
+				if (i >= end)				\
+					break;				\
+			} else {					\
+				i = start++;				\
+				if (i >= end)				\
+					break;				\
+			}						\
+			if (ngrp == 1)					\
+				gid = 0;				\
+			else if (gids == NULL ||			\
+				 (gids[i] >= min && gids[i] <= max))	\
+				gid = gids ? gids[i] - min : (oid) i;	\
+			else						\
+				continue;				\
+			st = states + gid * SUMBINS_STATE;		\
+			x = vals[i];					\
+			if (is_##TYPE##_nil(x)) {			\
+				if (!skip_nils)				\
+					st[0] = -1;			\
+			} else if (isfinite(x)) {			\
+				sumbins_add(st, x);			\
+			} else if (abort_on_error) {			\
+				goto overflow;				\
+			} else {					\
+				st[0] = -1;				\
+			}						\
+		}							\
+	} while (0)
+
+/* add the flt or dbl values to the states of their groups, SUMBINS_STATE
+ * lng's per group */
+static gdk_return
+sumbins_groups(lng *restrict states, const void *restrict values, int tp,
+	       oid seqb, BUN start, BUN end, BUN ngrp,
+	       const oid *restrict cand, const oid *candend,
+	       const oid *restrict gids, oid min, oid max,
+	       bool skip_nils, bool abort_on_error, const char *func)
+{
+	BUN i;
+	oid gid;
+
+	for (i = 0; i < ngrp; i++) {
+		states[i * SUMBINS_STATE] = lng_nil;
+		memset(states + i * SUMBINS_STATE + 1, 0,
+		       (SUMBINS_STATE - 1) * sizeof(lng));
+	}
+	switch (tp) {
+	case TYPE_flt:
+		AGGR_SUMBINS(flt);
+		break;
+	case TYPE_dbl:
+		AGGR_SUMBINS(dbl);
+		break;
+	default:
+		GDKerror("%s: type (%s) not supported.\n", func, ATOMname(tp));
+		return GDK_FAIL;
+	}
+	return GDK_SUCCEED;
+
+  overflow:
+	GDKerror("22003!overflow in calculation.\n");
+	return GDK_FAIL;
+}
+
+/* the sum of a state with values as a flt or dbl, nil if a nil made it
+ * nil; BUN_NONE if it does not fit and abort_on_error is set, else the
+ * number of nils (0 or 1) */
+static BUN
+sumbins_result(const lng *restrict st, void *restrict res, int tp,
+	       bool abort_on_error)
+{
+	dbl v = st[0] == -1 ? dbl_nil : sumbins_value(st, 0);
+
+	if (!is_dbl_nil(v) &&
+	    fabs(v) > (tp == TYPE_flt ? GDK_flt_max : GDK_dbl_max)) {
+		if (abort_on_error) {
+			GDKerror("22003!overflow in calculation.\n");
+			return BUN_NONE;
+		}
+		v = dbl_nil;
+	}
+	if (tp == TYPE_flt)
+		* (flt *) res = is_dbl_nil(v) ? flt_nil : (flt) v;
+	else
+		* (dbl *) res = v;
+	return is_dbl_nil(v);
+}
+
+/* the average of a state with values, nil if a nil made it nil */
+static dbl
+sumbins_average(const lng *restrict st)
+{
+	dbl v;
+
+	if (st[0] == -1)
+		return dbl_nil;
+	v = sumbins_value(st, 0);
+	if (isinf(v)) {
+		/* the sum does not fit, the average does */
+		return ldexp(sumbins_value(st, -64) / st[SUMBINS + 1], 64);
+	}
+	return v / st[SUMBINS + 1];
+}
+
 static BUN
 dosum(const void *restrict values, bool nonil, oid seqb, BUN start, BUN end,
       void *restrict results, BUN ngrp, int tp1, int tp2,
@@ -295,6 +413,7 @@ dosum(const void *restrict values, bool nonil, oid seqb, BUN start, BUN end,
 	BUN i;
 	oid gid;
 	unsigned int *restrict seen = NULL; /* bitmask for groups that we've seen */
+	lng *restrict states = NULL; /* bins of floating point sums */
 
 	/* allocate bitmap for seen group ids */
 	seen = GDKzalloc(((ngrp + 31) / 32) * sizeof(int));
@@ -392,33 +511,34 @@ dosum(const void *restrict values, bool nonil, oid seqb, BUN start, BUN end,
 	}
 #endif
 
-	case TYPE_flt: {
-			flt *restrict sums = (flt *) results;
-			switch (tp1) {
-		case TYPE_flt:
-				AGGR_SUM(flt, flt);
-				break;
-			default:
-				goto unsupported;
-			}
-			break;
+	case TYPE_flt:
+	case TYPE_dbl:
+		if (tp1 != TYPE_flt && (tp1 != TYPE_dbl || tp2 != TYPE_dbl))
+			goto unsupported;
+		states = GDKmalloc(ngrp * SUMBINS_STATE * sizeof(lng));
+		if (states == NULL) {
+			GDKfree(seen);
+			GDKerror("%s: cannot allocate enough memory\n", func);
+			return BUN_NONE;
 		}
-		case TYPE_dbl: {
-			dbl *restrict sums = (dbl *) results;
-			switch (tp1) {
-			case TYPE_flt:
-				AGGR_SUM(flt, dbl);
-				break;
-			case TYPE_dbl:
-				AGGR_SUM(dbl, dbl);
-				break;
-			default:
-				goto unsupported;
-			}
-			break;
+		if (sumbins_groups(states, values, tp1, seqb, start, end, ngrp,
+				   cand, candend, gids, min, max,
+				   skip_nils, abort_on_error, func) != GDK_SUCCEED)
+			goto bailout;
+		for (gid = 0; gid < ngrp; gid++) {
+			const lng *st = states + gid * SUMBINS_STATE;
+			BUN n;
+
+			if (is_lng_nil(st[0]))
+				continue;
+			seen[gid >> 5] |= 1U << (gid & 0x1F);
+			n = sumbins_result(st, (char *) results + gid * ATOMsize(tp2),
+					   tp2, abort_on_error);
+			if (n == BUN_NONE)
+				goto bailout;
+			nils += n;
 		}
-
-
+		break;
 	default:
 		goto unsupported;
 	}
@@ -438,6 +558,7 @@ dosum(const void *restrict values, bool nonil, oid seqb, BUN start, BUN end,
 		}
 	}
 	GDKfree(seen);
+	GDKfree(states);
 
 	return nils;
 
@@ -451,6 +572,11 @@ dosum(const void *restrict values, bool nonil, oid seqb, BUN start, BUN end,
 	GDKfree(seen);
 	GDKerror("22003!overflow in calculation.\n");
 	return BUN_NONE;
+
+  bailout:
+	GDKfree(seen);
+	GDKfree(states);
+	return BUN_NONE;
 }
 
 /* calculate group sums with optional candidates list */
@@ -634,6 +760,168 @@ BATsum(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, int
 	return nils < BUN_NONE ? GDK_SUCCEED : GDK_FAIL;
 }
 
+/* Sum the floating point values of b per group into bins, the first
+ * step of a sum or average that is split up.  The result has
+ * SUMBINS_STATE values per group; g may be NULL for a single group. */
+BAT *
+BATgroupsumbins(BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils, int abort_on_error)
+{
+	const oid *restrict gids;
+	oid min, max;
+	BUN ngrp;
+	BUN start, end;
+	BAT *bn;
+	const oid *cand = NULL, *candend = NULL;
+	const char *err;
+
+	if ((err = BATgroupaggrinit(b, g, e, s, &min, &max, &ngrp, &start, &end,
+				    &cand, &candend)) != NULL) {
+		GDKerror("BATgroupsumbins: %s\n", err);
+		return NULL;
+	}
+	if (b->ttype != TYPE_flt && b->ttype != TYPE_dbl) {
+		GDKerror("BATgroupsumbins: type (%s) not supported.\n",
+			 ATOMname(b->ttype));
+		return NULL;
+	}
+
+	bn = COLnew(0, TYPE_lng, ngrp * SUMBINS_STATE, TRANSIENT);
+	if (bn == NULL)
+		return NULL;
+
+	if (g == NULL || BATtdense(g))
+		gids = NULL;
+	else
+		gids = (const oid *) Tloc(g, start);
+
+	if (sumbins_groups((lng *) Tloc(bn, 0), Tloc(b, 0), b->ttype,
+			   b->hseqbase, start, end, ngrp, cand, candend,
+			   gids, min, max, skip_nils, abort_on_error,
+			   "BATgroupsumbins") != GDK_SUCCEED) {
+		BBPunfix(bn->batCacheid);
+		return NULL;
+	}
+	BATsetcount(bn, ngrp * SUMBINS_STATE);
+	bn->tkey = BATcount(bn) <= 1;
+	bn->tsorted = BATcount(bn) <= 1;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tnil = false;
+	bn->tnonil = false;
+	return bn;
+}
+
+/* Merge the states that BATgroupsumbins produced per group of g (one
+ * entry of g per state; g NULL means a single group) and return their
+ * sums of type tp, or their averages if avg is set. */
+static BAT *
+dobinsum(BAT *b, BAT *g, BAT *e, int tp, bool avg, int abort_on_error,
+	 const char *func)
+{
+	oid min, max, gid;
+	BUN i, n, ngrp, nils = 0;
+	BUN start, end;
+	const oid *cand = NULL, *candend = NULL;
+	const oid *restrict gids = NULL;
+	const lng *restrict src;
+	lng *restrict states;
+	BAT *bn;
+	const char *err;
+
+	if (b->ttype != TYPE_lng || BATcount(b) % SUMBINS_STATE != 0) {
+		GDKerror("%s: b must hold sum states\n", func);
+		return NULL;
+	}
+	n = BATcount(b) / SUMBINS_STATE;
+	if (g == NULL) {
+		min = 0;
+		ngrp = 1;
+	} else if (BATcount(g) != n) {
+		GDKerror("%s: b and g must be aligned\n", func);
+		return NULL;
+	} else if ((err = BATgroupaggrinit(g, g, e, NULL, &min, &max, &ngrp,
+					   &start, &end,
+					   &cand, &candend)) != NULL) {
+		GDKerror("%s: %s\n", func, err);
+		return NULL;
+	} else if (!BATtdense(g)) {
+		gids = (const oid *) Tloc(g, 0);
+	}
+
+	states = GDKmalloc(ngrp * SUMBINS_STATE * sizeof(lng));
+	bn = COLnew(min, tp, ngrp, TRANSIENT);
+	if (states == NULL || bn == NULL) {
+		GDKfree(states);
+		if (bn)
+			BBPunfix(bn->batCacheid);
+		GDKerror("%s: cannot allocate enough memory\n", func);
+		return NULL;
+	}
+	for (i = 0; i < ngrp; i++) {
+		states[i * SUMBINS_STATE] = lng_nil;
+		memset(states + i * SUMBINS_STATE + 1, 0,
+		       (SUMBINS_STATE - 1) * sizeof(lng));
+	}
+	src = (const lng *) Tloc(b, 0);
+	for (i = 0; i < n; i++) {
+		if (g == NULL)
+			gid = 0;
+		else if (gids == NULL)
+			gid = g->tseqbase + i - min;
+		else if (!is_oid_nil(gids[i]) && gids[i] >= min && gids[i] <= max)
+			gid = gids[i] - min;
+		else
+			continue;
+		sumbins_merge(states + gid * SUMBINS_STATE,
+			      src + i * SUMBINS_STATE);
+	}
+	for (i = 0; i < ngrp; i++) {
+		const lng *st = states + i * SUMBINS_STATE;
+		void *res = Tloc(bn, i);
+
+		if (is_lng_nil(st[0])) {
+			/* empty group */
+			memcpy(res, ATOMnilptr(tp), ATOMsize(tp));
+			nils++;
+		} else if (avg) {
+			* (dbl *) res = sumbins_average(st);
+			nils += is_dbl_nil(* (dbl *) res);
+		} else {
+			BUN r = sumbins_result(st, res, tp, abort_on_error);
+			if (r == BUN_NONE) {
+				GDKfree(states);
+				BBPunfix(bn->batCacheid);
+				return NULL;
+			}
+			nils += r;
+		}
+	}
+	GDKfree(states);
+	BATsetcount(bn, ngrp);
+	bn->tkey = BATcount(bn) <= 1;
+	bn->tsorted = BATcount(bn) <= 1;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tnil = nils != 0;
+	bn->tnonil = nils == 0;
+	return bn;
+}
+
+BAT *
+BATgroupbinsum(BAT *b, BAT *g, BAT *e, int tp, int abort_on_error)
+{
+	if (tp != TYPE_flt && tp != TYPE_dbl) {
+		GDKerror("BATgroupbinsum: type (%s) not supported.\n",
+			 ATOMname(tp));
+		return NULL;
+	}
+	return dobinsum(b, g, e, tp, false, abort_on_error, "BATgroupbinsum");
+}
+
+BAT *
+BATgroupbinavg(BAT *b, BAT *g, BAT *e)
+{
+	return dobinsum(b, g, e, TYPE_dbl, true, false, "BATgroupbinavg");
+}
+
 /* ---------------------------------------------------------------------- */
 /* product */
 
@@ -1220,20 +1508,6 @@ BATprod(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, in
 		}							\
 	} while (0)
 
-#define AVERAGE_ITER_FLOAT(TYPE, x, a, n)				\
-	do {								\
-		(n)++;							\
-		if (((a) > 0) == ((x) > 0)) {				\
-			/* same sign */					\
-			(a) += ((x) - (a)) / (SBUN) (n);		\
-		} else {						\
-			/* no overflow at the cost of an */		\
-			/* extra division and slight loss of */		\
-			/* precision */					\
-			(a) = (a) - (a) / (SBUN) (n) + (x) / (SBUN) (n); \
-		}							\
-	} while (0)
-
 #define AGGR_AVG(TYPE)							\
 	do {								\
 		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
@@ -1281,48 +1555,6 @@ BATprod(void *res, int tp, BAT *b, BAT *s, int skip_nils, int abort_on_error, in
 		GDKfree(avgs);						\
 	} while (0)
 
-#define AGGR_AVG_FLOAT(TYPE)						\
-	do {								\
-		const TYPE *restrict vals = (const TYPE *) Tloc(b, 0);	\
-		for (i = 0; i < ngrp; i++)				\
-			dbls[i] = 0;					\
-		for (;;) {						\
-			if (cand) {					\
-				if (cand == candend)			\
-					break;				\
-				i = *cand++ - b->hseqbase;		\
-				if (i >= end)				\
-					break;				\
-			} else {					\
-				i = start++;				\
-				if (i == end)				\
-					break;				\
-			}						\
-			if (gids == NULL ||				\
-			    (gids[i] >= min && gids[i] <= max)) {	\
-				if (gids)				\
-					gid = gids[i] - min;		\
-				else					\
-					gid = (oid) i;			\
-				if (is_##TYPE##_nil(vals[i])) {		\
-					if (!skip_nils)			\
-						cnts[gid] = lng_nil;	\
-				} else if (!is_lng_nil(cnts[gid])) {	\
-					AVERAGE_ITER_FLOAT(TYPE, vals[i], \
-							   dbls[gid],	\
-							   cnts[gid]);	\
-				}					\
-			}						\
-		}							\
-		for (i = 0; i < ngrp; i++) {				\
-			if (cnts[i] == 0 || is_lng_nil(cnts[i])) {	\
-				dbls[i] = dbl_nil;			\
-				cnts[i] = 0;				\
-				nils++;					\
-			}						\
-		}							\
-	} while (0)
-
 /* calculate group averages with optional candidates list */
 gdk_return
 BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error)
@@ -1334,6 +1566,7 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 	BUN nils = 0;
 	BUN *restrict rems = NULL;
 	lng *restrict cnts = NULL;
+	lng *restrict states = NULL;
 	dbl *restrict dbls;
 	BAT *bn = NULL, *cn = NULL;
 	BUN start, end;
@@ -1451,10 +1684,35 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 		break;
 #endif
 	case TYPE_flt:
-		AGGR_AVG_FLOAT(flt);
-		break;
 	case TYPE_dbl:
-		AGGR_AVG_FLOAT(dbl);
+		states = GDKmalloc(ngrp * SUMBINS_STATE * sizeof(lng));
+		if (states == NULL)
+			goto alloc_fail;
+		if (sumbins_groups(states, Tloc(b, 0), b->ttype, b->hseqbase,
+				   start, end, ngrp, cand, candend, gids,
+				   min, max, skip_nils, abort_on_error,
+				   "BATgroupavg") != GDK_SUCCEED) {
+			GDKfree(states);
+			if (cn)
+				BBPreclaim(cn);
+			else
+				GDKfree(cnts);
+			BBPunfix(bn->batCacheid);
+			return GDK_FAIL;
+		}
+		for (i = 0; i < ngrp; i++) {
+			const lng *st = states + i * SUMBINS_STATE;
+
+			if (is_lng_nil(st[0]) || st[0] == -1) {
+				dbls[i] = dbl_nil;
+				cnts[i] = 0;
+				nils++;
+			} else {
+				dbls[i] = sumbins_average(st);
+				cnts[i] = st[SUMBINS + 1];
+			}
+		}
+		GDKfree(states);
 		break;
 	default:
 		GDKfree(rems);
@@ -1587,30 +1845,6 @@ BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int
 #define AVERAGE_TYPE(TYPE) AVERAGE_TYPE_LNG_HGE(TYPE,lng)
 #endif
 
-#define AVERAGE_FLOATTYPE(TYPE)					\
-	do {							\
-		double a = 0;					\
-		TYPE x;						\
-		for (;;) {					\
-			if (cand) {				\
-				if (cand == candend)		\
-					break;			\
-				i = *cand++ - b->hseqbase;	\
-				if (i >= end)			\
-					break;			\
-			} else {				\
-				i = start++;			\
-				if (i == end)			\
-					break;			\
-			}					\
-			x = ((const TYPE *) src)[i];		\
-			if (is_##TYPE##_nil(x))			\
-				continue;			\
-			AVERAGE_ITER_FLOAT(TYPE, x, a, n);	\
-		}						\
-		*avg = n > 0 ? a : dbl_nil;			\
-	} while (0)
-
 gdk_return
 BATcalcavg(BAT *b, BAT *s, dbl *avg, BUN *vals)
 {
@@ -1650,11 +1884,21 @@ BATcalcavg(BAT *b, BAT *s, dbl *avg, BUN *vals)
 		break;
 #endif
 	case TYPE_flt:
-		AVERAGE_FLOATTYPE(flt);
-		break;
-	case TYPE_dbl:
-		AVERAGE_FLOATTYPE(dbl);
+	case TYPE_dbl: {
+		lng st[SUMBINS_STATE];
+
+		if (sumbins_groups(st, src, b->ttype, b->hseqbase, start, end,
+				   1, cand, candend, NULL, 0, 0, true, false,
+				   "BATcalcavg") != GDK_SUCCEED)
+			return GDK_FAIL;
+		if (is_lng_nil(st[0]) || st[0] == -1) {
+			*avg = dbl_nil;
+		} else {
+			n = (BUN) st[SUMBINS + 1];
+			*avg = sumbins_average(st);
+		}
 		break;
+	}
 	default:
 		GDKerror("BATcalcavg: average of type %s unsupported.\n",
 			 ATOMname(b->ttype));
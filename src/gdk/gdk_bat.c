@@ -1270,6 +1270,99 @@ void_inplace(BAT *b, oid id, const void *val, bit force)
 	return BUNinplace(b, id - b->hseqbase, val, force);
 }
 
+/* Replace a batch of fixed-size values in one pass over the positions.
+ * The indices and properties are dropped once for the whole batch
+ * instead of per value, and the order properties are checked against
+ * the final values.  Later positions in p override earlier ones. */
+static gdk_return
+void_replace_fix(BAT *b, BAT *p, BAT *u, bit force)
+{
+	BATiter pi = bat_iterator(p);
+	BATiter ui = bat_iterator(u);
+	int (*cmp)(const void *, const void *) = ATOMcompare(b->ttype);
+	const void *nil = ATOMnilptr(b->ttype);
+	BUN r, s, i, cnt = BATcount(b), minp = BUN_NONE;
+	int nonil = 1;
+
+	if (!force && (b->batRestricted != BAT_WRITE || b->batSharecnt > 0)) {
+		GDKerror("void_replace_bat: access denied to %s, aborting.\n",
+			 BATgetId(b));
+		return GDK_FAIL;
+	}
+	BATloop(p, r, s) {
+		oid id = *(oid *) BUNtail(pi, r);
+
+		assert(id >= b->hseqbase && id < b->hseqbase + cnt);
+		if (id < b->hseqbase || id >= b->hseqbase + cnt) {
+			GDKerror("void_replace_bat: id out of range\n");
+			return GDK_FAIL;
+		}
+	}
+	HASHdestroy(b);
+	PROPdestroy(b->tprops);
+	b->tprops = NULL;
+	OIDXdestroy(b);
+	IMPSdestroy(b);
+
+	BATloop(p, r, s) {
+		BUN q = *(oid *) BUNtail(pi, r) - b->hseqbase;
+		const void *v = BUNtail(ui, r);
+
+		if (b->tnil && cmp(Tloc(b, q), nil) == 0 && cmp(v, nil) != 0)
+			b->tnil = 0;
+		if (nonil && cmp(v, nil) == 0)
+			nonil = 0;
+		ATOMputFIX(b->ttype, Tloc(b, q), v);
+		if (q < minp)
+			minp = q;
+		if (b->tnokey[0] == q || b->tnokey[1] == q)
+			b->tnokey[0] = b->tnokey[1] = 0;
+	}
+
+	/* compare each replaced value with its final neighbours */
+	if (BATtordered(b) || BATtrevordered(b)) {
+		BATloop(p, r, s) {
+			BUN q = *(oid *) BUNtail(pi, r) - b->hseqbase;
+			for (i = q > 0 ? q - 1 : q; i < q + 1 && i + 1 < cnt; i++) {
+				int c = cmp(Tloc(b, i), Tloc(b, i + 1));
+
+				if (c > 0 && b->tsorted) {
+					b->tsorted = FALSE;
+					b->tnosorted = i + 1;
+				}
+				if (c < 0 && b->trevsorted) {
+					b->trevsorted = FALSE;
+					b->tnorevsorted = i + 1;
+				}
+				if (b->tdense && ATOMtype(b->ttype) == TYPE_oid &&
+				    1 + *(oid *) Tloc(b, i) != *(oid *) Tloc(b, i + 1))
+					b->tdense = FALSE;
+			}
+		}
+	}
+	/* the values around each replaced one still follow each other,
+	 * but the whole sequence may have shifted */
+	if (b->tdense) {
+		if (nonil && b->tsorted && cnt > 0) {
+			b->tseqbase = *(oid *) Tloc(b, 0);
+		} else {
+			b->tdense = FALSE;
+			b->tseqbase = oid_nil;
+		}
+	}
+	if (!b->tsorted && b->tnosorted >= minp)
+		b->tnosorted = 0;
+	if (!b->trevsorted && b->tnorevsorted >= minp)
+		b->tnorevsorted = 0;
+	/* a column that is still dense is still key */
+	if (b->tkey && !b->tunique && !b->tdense && cnt > 1)
+		BATkey(b, FALSE);
+	if (b->tnonil)
+		b->tnonil = nonil;
+	b->theap.dirty = TRUE;
+	return GDK_SUCCEED;
+}
+
 gdk_return
 void_replace_bat(BAT *b, BAT *p, BAT *u, bit force)
 {
@@ -1277,6 +1370,11 @@ void_replace_bat(BAT *b, BAT *p, BAT *u, bit force)
 	BATiter uii = bat_iterator(p);
 	BATiter uvi = bat_iterator(u);
 
+	if (b->ttype != TYPE_void && !b->tvarsized && !b->tunique &&
+	    ATOMstorage(u->ttype) == ATOMstorage(b->ttype) &&
+	    BATcount(u) > 1)
+		return void_replace_fix(b, p, u, force);
+
 	BATloop(u, r, s) {
 		oid updid = *(oid *) BUNtail(uii, r);
 		const void *val = BUNtail(uvi, r);
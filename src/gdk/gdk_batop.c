@@ -1274,6 +1274,219 @@ do_sort(void *restrict h, void *restrict t, const void *restrict base, size_t n,
 	return GDK_SUCCEED;
 }
 
+/*
+ * External merge sort.  Sorting a BAT that does not fit in the memory
+ * we are allowed to use with a single quicksort or mergesort makes
+ * the OS page the (memory mapped) heaps in and out at random.
+ * Instead, we sort runs of at most runlen values in place (see
+ * external_sort_runlen), so that each run is processed in memory, and
+ * then merge the runs into temporary heaps, which are written
+ * sequentially and spill to disk when large.  During the merge each
+ * run is read in order, and we ask the OS to read ahead the next part
+ * of a run when we reach it.  Finally the merged result is copied
+ * back in place.
+ *
+ * The temporary heaps are as large as the column (and the order)
+ * being sorted, so while merging, the sort takes twice the space of
+ * its input.  Unless the database is in memory, large heaps are
+ * memory mapped files, so only the part of the temporary heaps being
+ * written and of the runs being read needs to be in memory.
+ *
+ * The runs are not written to files of their own: BATsort only sorts
+ * a private copy of the column, and a copy too large for memory lives
+ * in a memory mapped, file backed heap already.  A sorted run is
+ * therefore written out by the OS like any run file would be, and
+ * separate run files would only add one more write and read of all
+ * the data.
+ *
+ * The runs are merged through a binary heap of run indices ordered
+ * on their current value; equal values are taken from the lowest
+ * numbered run first, so the merge is stable if the runs are sorted
+ * stably.
+ */
+#define SORTREADAHEAD	((size_t) 1 << 20)	/* bytes to read ahead per run */
+
+struct sortrun {
+	BUN cur, end;		/* current and end position of the run */
+	BUN ahead;		/* position up to which we read ahead */
+};
+
+static inline int
+sortrun_cmp(BATiter *bi, int (*cmp)(const void *, const void *),
+	    const struct sortrun *runs, BUN r1, BUN r2, int reverse)
+{
+	int c = (*cmp)(BUNtail(*bi, runs[r1].cur), BUNtail(*bi, runs[r2].cur));
+
+	if (reverse)
+		c = -c;
+	return c != 0 ? c : (r1 > r2) - (r1 < r2);
+}
+
+static void
+sortrun_sift(BATiter *bi, int (*cmp)(const void *, const void *),
+	     const struct sortrun *runs, BUN *heap, BUN n, BUN i, int reverse)
+{
+	BUN r = heap[i], c;
+
+	while ((c = 2 * i + 1) < n) {
+		if (c + 1 < n &&
+		    sortrun_cmp(bi, cmp, runs, heap[c + 1], heap[c], reverse) < 0)
+			c++;
+		if (sortrun_cmp(bi, cmp, runs, r, heap[c], reverse) <= 0)
+			break;
+		heap[i] = heap[c];
+		i = c;
+	}
+	heap[i] = r;
+}
+
+static void
+sortrun_readahead(BAT *b, const oid *ords, struct sortrun *run, BUN rows)
+{
+#ifdef HAVE_POSIX_MADVISE
+	size_t pagemask = MT_pagesize() - 1;
+	BUN end = run->ahead + rows;
+	char *p, *q;
+
+	if (end > run->end)
+		end = run->end;
+	if (b->theap.storage == STORE_MMAP) {
+		p = (char *) ((uintptr_t) Tloc(b, run->ahead) & ~pagemask);
+		q = (char *) Tloc(b, end);
+		(void) posix_madvise(p, (size_t) (q - p), POSIX_MADV_WILLNEED);
+	}
+	if (ords) {
+		p = (char *) ((uintptr_t) (ords + run->ahead) & ~pagemask);
+		q = (char *) (ords + end);
+		(void) posix_madvise(p, (size_t) (q - p), POSIX_MADV_WILLNEED);
+	}
+	run->ahead = end;
+#else
+	(void) b;
+	(void) ords;
+	run->ahead += rows;
+#endif
+}
+
+static gdk_return
+do_external_sort(BAT *b, oid *restrict ords, BUN runlen, int reverse, int stable)
+{
+	BUN n = BATcount(b), nruns, nheap, i, k;
+	int ts = Tsize(b);
+	int (*cmp)(const void *, const void *) = ATOMcompare(b->ttype);
+	BATiter bi = bat_iterator(b);
+	const char *nme = BBP_physical(b->batCacheid);
+	struct sortrun *runs = NULL;
+	BUN *heap = NULL;
+	BUN ahead;
+	Heap th, oh;
+	char *restrict tv;
+	oid *restrict ov = NULL;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	/* sort the runs in place */
+	for (i = 0; i < n; i += runlen) {
+		if (do_sort(Tloc(b, i),
+			    ords ? ords + i : NULL,
+			    b->tvheap ? b->tvheap->base : NULL,
+			    MIN(runlen, n - i), ts, ords ? sizeof(oid) : 0,
+			    b->ttype, reverse, stable) != GDK_SUCCEED)
+			return GDK_FAIL;
+	}
+	nruns = (n + runlen - 1) / runlen;
+	if (nruns <= 1)
+		return GDK_SUCCEED;
+
+	memset(&th, 0, sizeof(th));
+	memset(&oh, 0, sizeof(oh));
+	runs = GDKmalloc(nruns * sizeof(struct sortrun));
+	heap = GDKmalloc(nruns * sizeof(BUN));
+	if (runs == NULL || heap == NULL)
+		goto bailout;
+	if ((th.farmid = BBPselectfarm(TRANSIENT, b->ttype, offheap)) < 0 ||
+	    snprintf(th.filename, sizeof(th.filename), "%s.tsort", nme) < 0 ||
+	    HEAPalloc(&th, n, ts) != GDK_SUCCEED) {
+		th.base = NULL;
+		goto bailout;
+	}
+	if (ords &&
+	    ((oh.farmid = BBPselectfarm(TRANSIENT, TYPE_oid, offheap)) < 0 ||
+	     snprintf(oh.filename, sizeof(oh.filename), "%s.osort", nme) < 0 ||
+	     HEAPalloc(&oh, n, sizeof(oid)) != GDK_SUCCEED)) {
+		oh.base = NULL;
+		goto bailout;
+	}
+
+	/* merge the runs */
+	ahead = MAX(SORTREADAHEAD / (ts + (ords ? sizeof(oid) : 0)), 1);
+	for (i = 0; i < nruns; i++) {
+		runs[i].cur = runs[i].ahead = i * runlen;
+		runs[i].end = MIN(n, runs[i].cur + runlen);
+		sortrun_readahead(b, ords, &runs[i], ahead);
+		heap[i] = i;
+	}
+	nheap = nruns;
+	for (i = nheap / 2; i > 0; i--)
+		sortrun_sift(&bi, cmp, runs, heap, nheap, i - 1, reverse);
+	tv = th.base;
+	if (ords)
+		ov = (oid *) oh.base;
+	for (k = 0; k < n; k++) {
+		struct sortrun *run = &runs[heap[0]];
+
+		memcpy(tv, Tloc(b, run->cur), ts);
+		tv += ts;
+		if (ords)
+			*ov++ = ords[run->cur];
+		if (++run->cur == run->end)
+			heap[0] = heap[--nheap];
+		else if (run->cur == run->ahead)
+			sortrun_readahead(b, ords, run, ahead);
+		if (nheap > 1)
+			sortrun_sift(&bi, cmp, runs, heap, nheap, 0, reverse);
+	}
+	assert(nheap == 0);
+
+	/* copy the merged result back */
+	memcpy(Tloc(b, 0), th.base, n * ts);
+	if (ords)
+		memcpy(ords, oh.base, n * sizeof(oid));
+	HEAPfree(&th, 1);
+	if (ords)
+		HEAPfree(&oh, 1);
+	GDKfree(runs);
+	GDKfree(heap);
+	ALGODEBUG fprintf(stderr, "#BATsort: external sort of " BUNFMT " values in " BUNFMT " runs (" LLFMT " usec)\n", n, nruns, GDKusec() - t0);
+	return GDK_SUCCEED;
+
+  bailout:
+	if (th.base)
+		HEAPfree(&th, 1);
+	if (oh.base)
+		HEAPfree(&oh, 1);
+	GDKfree(runs);
+	GDKfree(heap);
+	return GDK_FAIL;
+}
+
+/* Return the number of values of b per run of an external sort, or 0
+ * if the sort fits in memory.  The sort may use the percentage
+ * gdk_sort_memory (default 50) of the memory available to the
+ * query. */
+static BUN
+external_sort_runlen(BAT *b, int ordered)
+{
+	size_t width = Tsize(b) + (ordered ? sizeof(oid) : 0);
+	size_t limit = GDKmemoryavail() / 100 * GDKgetenv_int("gdk_sort_memory", 50);
+
+	if ((size_t) BATcount(b) * width + (b->tvheap ? b->tvheap->free : 0) <= limit)
+		return 0;
+	/* at least the cache size, so the runs themselves sort fast */
+	return (BUN) MAX(limit, MT_l2cachesize()) / width;
+}
+
 /* Sort the bat b according to both o and g.  The stable and reverse
  * parameters indicate whether the sort should be stable or descending
  * respectively.  The parameter b is required, o and g are optional
@@ -1570,6 +1783,7 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 		bn->trevsorted = r == 0 && reverse;
 	} else {
 		Heap *m = NULL;
+		BUN runlen;
 		/* only invest in creating an order index if the BAT
 		 * is persistent */
 		if (!reverse &&
@@ -1597,11 +1811,13 @@ BATsort(BAT **sorted, BAT **order, BAT **groups,
 		}
 		if (!(reverse ? bn->trevsorted : bn->tsorted) &&
 		    (BATmaterialize(bn) != GDK_SUCCEED ||
-		     do_sort(Tloc(bn, 0),
-			     ords,
-			     bn->tvheap ? bn->tvheap->base : NULL,
-			     BATcount(bn), Tsize(bn), ords ? sizeof(oid) : 0,
-			     bn->ttype, reverse, stable) != GDK_SUCCEED)) {
+		     ((runlen = external_sort_runlen(bn, ords != NULL)) > 0 ?
+		      do_external_sort(bn, ords, runlen, reverse, stable) :
+		      do_sort(Tloc(bn, 0),
+			      ords,
+			      bn->tvheap ? bn->tvheap->base : NULL,
+			      BATcount(bn), Tsize(bn), ords ? sizeof(oid) : 0,
+			      bn->ttype, reverse, stable)) != GDK_SUCCEED)) {
 			if (m != NULL) {
 				HEAPfree(m, 1);
 				GDKfree(m);
@@ -13085,6 +13085,531 @@ VARcalcbetween(ValPtr ret, const ValRecord *v, const ValRecord *lo,
 	return GDK_SUCCEED;
 }
 
+/* ---------------------------------------------------------------------- */
+/* fused arithmetic expressions (int, lng, flt, dbl) */
+
+/* The expression is a postfix program over a single type: FUSE_ARG
+ * pushes the next argument (a BAT or a constant), the arithmetic
+ * operators + - * replace the top two entries by their result, and
+ * one of the comparisons < l (<=) > g (>=) = ! (!=) may only appear as
+ * the last operator, in which case the result is a bit BAT.
+ * FUSE_PROJ pushes the next argument projected through the candidate
+ * list, i.e. the values of BATproject(cand, b) are gathered one vector
+ * at a time.  The program is evaluated in vectors of FUSE_VECTOR
+ * values, so only the final result is materialized in full. */
+
+#define FUSE_VECTOR	1024
+
+#define FUSE_ISCMP(c)	((c) == '<' || (c) == 'l' || (c) == '>' ||	\
+			 (c) == 'g' || (c) == '=' || (c) == '!')
+
+#define FUSE_LOOP(TYPE, OP)						\
+	do {								\
+		for (k = 0; k < n; k++) {				\
+			i = k * incr1;					\
+			j = k * incr2;					\
+			if (is_##TYPE##_nil(lft[i]) ||			\
+			    is_##TYPE##_nil(rgt[j])) {			\
+				dst[k] = TYPE##_nil;			\
+				nils++;					\
+			} else {					\
+				OP;					\
+			}						\
+		}							\
+	} while (0)
+
+#define FUSE_CMPLOOP(TYPE, OP)						\
+	do {								\
+		for (k = 0; k < n; k++) {				\
+			i = k * incr1;					\
+			j = k * incr2;					\
+			if (is_##TYPE##_nil(lft[i]) ||			\
+			    is_##TYPE##_nil(rgt[j])) {			\
+				bdst[k] = bit_nil;			\
+				nils++;					\
+			} else {					\
+				bdst[k] = (bit) (lft[i] OP rgt[j]);	\
+			}						\
+		}							\
+	} while (0)
+
+#define FUSE_MUL_int							\
+	MULI4_WITH_CHECK(int, lft[i], int, rgt[j], int, dst[k],	\
+			 GDK_int_max, lng, ON_OVERFLOW(int, int, "*"))
+#define FUSE_MUL_lng							\
+	LNGMUL_CHECK(lng, lft[i], lng, rgt[j], dst[k],			\
+		     GDK_lng_max, ON_OVERFLOW(lng, lng, "*"))
+#define FUSE_MUL_float(TYPE)						\
+	do {								\
+		/* only check for overflow, not for underflow */	\
+		dst[k] = (TYPE) (lft[i] * rgt[j]);			\
+		if (isinf(dst[k]) || ABSOLUTE(dst[k]) > GDK_##TYPE##_max) \
+			ON_OVERFLOW(TYPE, TYPE, "*");			\
+	} while (0)
+#define FUSE_MUL_flt	FUSE_MUL_float(flt)
+#define FUSE_MUL_dbl	FUSE_MUL_float(dbl)
+
+#define FUSE_TYPE(TYPE, IF)						\
+static BUN								\
+fuse_##TYPE(const char *prog, BAT **b, const ValRecord *v,		\
+	    BAT *c, void *restrict res, BUN rbase, BUN lo, BUN hi,	\
+	    TYPE *buf, int abort_on_error)				\
+{									\
+	const TYPE *stk[FUSE_MAXDEPTH];					\
+	int inc[FUSE_MAXDEPTH];						\
+	const TYPE *lft, *rgt, *src;					\
+	TYPE *dst, *gbuf = buf + FUSE_MAXDEPTH * FUSE_VECTOR;		\
+	bit *bdst;							\
+	const oid *cand = NULL;						\
+	oid o, cbase = 0;						\
+	BUN i, j, k, n, off, nils = 0, resnils = 0;			\
+	int top, arg, incr1, incr2;					\
+	const char *p;							\
+									\
+	if (c && BATtdense(c))						\
+		cbase = c->tseqbase;					\
+	else if (c && c->ttype != TYPE_void)				\
+		cand = (const oid *) Tloc(c, 0);			\
+	for (off = lo; off < hi; off += n) {				\
+		n = hi - off < FUSE_VECTOR ? hi - off : FUSE_VECTOR;	\
+		top = arg = 0;						\
+		for (p = prog; *p; p++) {				\
+			if (*p == FUSE_ARG || *p == FUSE_PROJ) {	\
+				inc[top] = 1;				\
+				if (b[arg] == NULL) {			\
+					stk[top] = (const TYPE *) VALptr(&v[arg]); \
+					inc[top] = 0;			\
+				} else if (*p == FUSE_ARG) {		\
+					stk[top] = (const TYPE *) Tloc(b[arg], 0) + off; \
+				} else if (BATtdense(c)) {		\
+					/* contiguous slice, no copy */	\
+					stk[top] = (const TYPE *) Tloc(b[arg], 0) + (cbase - b[arg]->hseqbase) + off; \
+				} else {				\
+					/* gather one vector of the projection */ \
+					src = (const TYPE *) Tloc(b[arg], 0); \
+					dst = gbuf + arg * FUSE_VECTOR;	\
+					for (k = 0; k < n; k++) {	\
+						o = cand ? cand[off + k] : oid_nil; \
+						if (is_oid_nil(o)) {	\
+							dst[k] = TYPE##_nil; \
+						} else if (o < b[arg]->hseqbase || \
+							   o >= b[arg]->hseqbase + BATcount(b[arg])) { \
+							GDKerror("BATcalcfuse: does not match always\n"); \
+							return BUN_NONE; \
+						} else {		\
+							dst[k] = src[o - b[arg]->hseqbase]; \
+						}			\
+					}				\
+					stk[top] = dst;			\
+				}					\
+				top++;					\
+				arg++;					\
+				continue;				\
+			}						\
+			rgt = stk[--top];				\
+			incr2 = inc[top];				\
+			lft = stk[--top];				\
+			incr1 = inc[top];				\
+			/* the last operator writes into the result */	\
+			if (p[1] == 0)					\
+				dst = (TYPE *) res + (off - rbase);	\
+			else						\
+				dst = buf + top * FUSE_VECTOR;		\
+			bdst = (bit *) res + (off - rbase);		\
+			nils = 0;					\
+			switch (*p) {					\
+			case '+':					\
+				FUSE_LOOP(TYPE, ADD##IF##_WITH_CHECK(TYPE, lft[i], TYPE, rgt[j], TYPE, dst[k], GDK_##TYPE##_max, ON_OVERFLOW(TYPE, TYPE, "+"))); \
+				break;					\
+			case '-':					\
+				FUSE_LOOP(TYPE, SUB##IF##_WITH_CHECK(TYPE, lft[i], TYPE, rgt[j], TYPE, dst[k], GDK_##TYPE##_max, ON_OVERFLOW(TYPE, TYPE, "-"))); \
+				break;					\
+			case '*':					\
+				FUSE_LOOP(TYPE, FUSE_MUL_##TYPE);	\
+				break;					\
+			case '<':					\
+				FUSE_CMPLOOP(TYPE, <);			\
+				break;					\
+			case 'l':					\
+				FUSE_CMPLOOP(TYPE, <=);			\
+				break;					\
+			case '>':					\
+				FUSE_CMPLOOP(TYPE, >);			\
+				break;					\
+			case 'g':					\
+				FUSE_CMPLOOP(TYPE, >=);			\
+				break;					\
+			case '=':					\
+				FUSE_CMPLOOP(TYPE, ==);			\
+				break;					\
+			default:					\
+				FUSE_CMPLOOP(TYPE, !=);			\
+				break;					\
+			}						\
+			stk[top] = dst;					\
+			inc[top] = 1;					\
+			top++;						\
+		}							\
+		resnils += nils;					\
+	}								\
+	return resnils;							\
+}
+
+FUSE_TYPE(int, I)
+FUSE_TYPE(lng, I)
+FUSE_TYPE(flt, F)
+FUSE_TYPE(dbl, F)
+
+/* Check that prog is a well-formed fused expression over nargs
+ * arguments; returns the result type, or TYPE_void if it is not. */
+static int
+fuse_check(const char *prog, int tp, int nargs)
+{
+	int depth = 0, maxdepth = 0, args = 0, ops = 0;
+	const char *p;
+
+	for (p = prog; *p; p++) {
+		if (*p == FUSE_ARG || *p == FUSE_PROJ) {
+			args++;
+			if (++depth > maxdepth)
+				maxdepth = depth;
+		} else if (*p == '+' || *p == '-' || *p == '*' ||
+			   (FUSE_ISCMP(*p) && p[1] == 0)) {
+			if (depth < 2)
+				return TYPE_void;
+			depth--;
+			ops++;
+		} else {
+			return TYPE_void;
+		}
+	}
+	if (depth != 1 || ops == 0 || args != nargs ||
+	    maxdepth > FUSE_MAXDEPTH)
+		return TYPE_void;
+	return FUSE_ISCMP(p[-1]) ? TYPE_bit : tp;
+}
+
+/* Check the arguments of a fused expression; returns the BAT the
+ * result is aligned with, or NULL on error.  The arguments marked
+ * FUSE_PROJ in prog are projected through the candidate list c, all
+ * others must be aligned with the result. */
+static BAT *
+fuse_prepare(const char *func, const char *prog, int tp, BAT **b, const ValRecord *v, int nargs, BAT *c, int *rtp)
+{
+	BAT *b1 = c;
+	int i;
+	const char *p;
+
+	if ((*rtp = fuse_check(prog, tp, nargs)) == TYPE_void) {
+		GDKerror("%s: malformed expression \"%s\".\n", func, prog);
+		return NULL;
+	}
+	for (i = 0, p = prog; i < nargs; i++, p++) {
+		while (*p != FUSE_ARG && *p != FUSE_PROJ)
+			p++;
+		if (b[i]) {
+			if (b[i]->ttype != tp) {
+				GDKerror("%s: bad input type %s.\n", func,
+					 ATOMname(b[i]->ttype));
+				return NULL;
+			}
+			if (*p == FUSE_PROJ) {
+				if (c == NULL) {
+					GDKerror("%s: projection without candidate list.\n", func);
+					return NULL;
+				}
+				if (BATtdense(c) && BATcount(c) > 0 &&
+				    (c->tseqbase < b[i]->hseqbase ||
+				     c->tseqbase + BATcount(c) > b[i]->hseqbase + BATcount(b[i]))) {
+					GDKerror("%s: does not match always\n", func);
+					return NULL;
+				}
+			} else if (b1 == NULL)
+				b1 = b[i];
+			else if (checkbats(b1, b[i], func) != GDK_SUCCEED)
+				return NULL;
+		} else if (v[i].vtype != tp) {
+			GDKerror("%s: bad input type %s.\n", func,
+				 ATOMname(v[i].vtype));
+			return NULL;
+		}
+	}
+	if (b1 == NULL) {
+		GDKerror("%s: at least one argument must be a BAT.\n", func);
+		return NULL;
+	}
+	if (tp != TYPE_int && tp != TYPE_lng && tp != TYPE_flt && tp != TYPE_dbl) {
+		GDKerror("%s: bad input type %s.\n", func, ATOMname(tp));
+		return NULL;
+	}
+	return b1;
+}
+
+/* Large inputs are evaluated morsel-driven (see GDKmorsels): every
+ * thread pulls the next FUSE_MORSEL rows and runs the whole program
+ * over them with its own evaluation buffers.  The morsels are cut
+ * from the rows that survived the selection, so a skewed selection
+ * does not unbalance the threads.  Fused sums keep a partial sum per
+ * morsel which are added up in morsel order at the end, so the result
+ * does not depend on which thread did what. */
+#define FUSE_MORSEL	(64 * FUSE_VECTOR)
+
+typedef struct {
+	const char *prog;
+	int tp;
+	BAT **b;
+	const ValRecord *v;
+	BAT *c;
+	void *res;		/* result column */
+	int nthreads;
+	size_t bufsize;
+	void **bufs;		/* evaluation buffers per thread */
+	BUN *nils;		/* nil count per thread */
+	/* fused sums: partial sum per morsel, dbl ones as the bins of
+	 * sumbins_add */
+	lng *lsums;
+	lng *dbins;
+	bit *seen;
+} fuse_morsels;
+
+static BUN
+fuse_run(fuse_morsels *f, int thr, void *res, BUN rbase, BUN lo, BUN hi)
+{
+	void *buf = f->bufs[thr];
+
+	if (buf == NULL && (buf = f->bufs[thr] = GDKmalloc(f->bufsize)) == NULL)
+		return BUN_NONE;
+	switch (f->tp) {
+	case TYPE_int:
+		return fuse_int(f->prog, f->b, f->v, f->c, res, rbase, lo, hi, buf, 1);
+	case TYPE_lng:
+		return fuse_lng(f->prog, f->b, f->v, f->c, res, rbase, lo, hi, buf, 1);
+	case TYPE_flt:
+		return fuse_flt(f->prog, f->b, f->v, f->c, res, rbase, lo, hi, buf, 1);
+	default:
+		return fuse_dbl(f->prog, f->b, f->v, f->c, res, rbase, lo, hi, buf, 1);
+	}
+}
+
+static gdk_return
+fuse_column_morsel(void *arg, int thr, BUN lo, BUN hi)
+{
+	fuse_morsels *f = arg;
+	BUN nils = fuse_run(f, thr, f->res, 0, lo, hi);
+
+	if (nils == BUN_NONE)
+		return GDK_FAIL;
+	f->nils[thr] += nils;
+	return GDK_SUCCEED;
+}
+
+#define FUSE_SUM_LNG(TYPE)						\
+	do {								\
+		const TYPE *restrict vals = (const TYPE *) vec;		\
+		for (k = 0; k < n; k++) {				\
+			if (is_##TYPE##_nil(vals[k]))			\
+				continue;				\
+			ADD_WITH_CHECK(TYPE, vals[k], lng, lsum, lng, t, \
+				       GDK_lng_max, goto overflow);	\
+			lsum = t;					\
+			seen = 1;					\
+		}							\
+	} while (0)
+
+static gdk_return
+fuse_sum_morsel(void *arg, int thr, BUN lo, BUN hi)
+{
+	fuse_morsels *f = arg;
+	BUN m = lo / FUSE_MORSEL, off, n, k;
+	lng vec[FUSE_VECTOR], lsum = 0, t;
+	lng *restrict st = NULL;
+	dbl x;
+	bit seen = 0;
+	/* for ADD_WITH_CHECK */
+	const int abort_on_error = 1;
+	BUN nils = 0;
+
+	if (f->dbins) {
+		st = f->dbins + m * SUMBINS_STATE;
+		st[0] = lng_nil;
+		memset(st + 1, 0, (SUMBINS_STATE - 1) * sizeof(lng));
+	}
+	for (off = lo; off < hi; off += n) {
+		n = hi - off < FUSE_VECTOR ? hi - off : FUSE_VECTOR;
+		if (fuse_run(f, thr, vec, off, off, off + n) == BUN_NONE)
+			return GDK_FAIL;
+		switch (f->tp) {
+		case TYPE_int:
+			FUSE_SUM_LNG(int);
+			break;
+		case TYPE_lng:
+			FUSE_SUM_LNG(lng);
+			break;
+		default:
+			/* binned, like BATsum */
+			for (k = 0; k < n; k++) {
+				x = ((const dbl *) vec)[k];
+				if (is_dbl_nil(x))
+					continue;
+				if (!isfinite(x))
+					goto overflow;
+				sumbins_add(st, x);
+				seen = 1;
+			}
+			break;
+		}
+	}
+	if (f->lsums)
+		f->lsums[m] = lsum;
+	f->seen[m] = seen;
+	return GDK_SUCCEED;
+  overflow:
+	GDKerror("22003!overflow in calculation.\n");
+	return GDK_FAIL;
+}
+
+static gdk_return
+fuse_evaluate(fuse_morsels *f, int nargs, BUN cnt,
+	      gdk_return (*work)(void *, int, BUN, BUN))
+{
+	int i, nthreads = f->nthreads = GDKnr_threads > 0 ? GDKnr_threads : 1;
+	gdk_return ret;
+
+	f->bufsize = (FUSE_MAXDEPTH + nargs) * FUSE_VECTOR * ATOMsize(f->tp);
+	f->bufs = GDKzalloc(nthreads * sizeof(void *));
+	f->nils = GDKzalloc(nthreads * sizeof(BUN));
+	if (f->bufs == NULL || f->nils == NULL) {
+		GDKfree(f->bufs);
+		GDKfree(f->nils);
+		return GDK_FAIL;
+	}
+	ret = GDKmorsels(cnt, FUSE_MORSEL, nthreads, work, f);
+	for (i = 0; i < nthreads; i++)
+		GDKfree(f->bufs[i]);
+	GDKfree(f->bufs);
+	return ret;
+}
+
+BAT *
+BATcalcfuse(const char *prog, int tp, BAT **b, const ValRecord *v, int nargs, BAT *c)
+{
+	BAT *bn, *b1;
+	BUN nils = 0, cnt;
+	int i, rtp;
+	fuse_morsels f = {0};
+
+	if ((b1 = fuse_prepare("BATcalcfuse", prog, tp, b, v, nargs, c, &rtp)) == NULL)
+		return NULL;
+	cnt = BATcount(b1);
+
+	bn = COLnew(b1->hseqbase, rtp, cnt, TRANSIENT);
+	if (bn == NULL)
+		return NULL;
+	f.prog = prog;
+	f.tp = tp;
+	f.b = b;
+	f.v = v;
+	f.c = c;
+	f.res = Tloc(bn, 0);
+	if (fuse_evaluate(&f, nargs, cnt, fuse_column_morsel) != GDK_SUCCEED) {
+		GDKfree(f.nils);
+		BBPunfix(bn->batCacheid);
+		return NULL;
+	}
+	for (i = 0; i < f.nthreads; i++)
+		nils += f.nils[i];
+	GDKfree(f.nils);
+
+	BATsetcount(bn, cnt);
+
+	bn->tsorted = cnt <= 1 || nils == cnt;
+	bn->trevsorted = cnt <= 1 || nils == cnt;
+	bn->tkey = cnt <= 1;
+	bn->tnil = nils != 0;
+	bn->tnonil = nils == 0;
+
+	return bn;
+}
+
+/* The sum of a fused arithmetic expression without materializing it.
+ * int and lng expressions are summed into a lng, dbl ones into a dbl;
+ * nils are skipped and the sum of no values is nil. */
+gdk_return
+BATcalcfusesum(ValPtr ret, const char *prog, int tp, BAT **b, const ValRecord *v, int nargs, BAT *c)
+{
+	BAT *b1;
+	BUN cnt, nmorsels, m;
+	int rtp;
+	fuse_morsels f = {0};
+	bit seen = 0;
+	lng lsum = 0, t;
+	lng dbins[SUMBINS_STATE];
+	dbl d;
+	gdk_return rc;
+	/* for ADD_WITH_CHECK */
+	const int abort_on_error = 1;
+	BUN nils = 0;
+
+	if ((b1 = fuse_prepare("BATcalcfusesum", prog, tp, b, v, nargs, c, &rtp)) == NULL)
+		return GDK_FAIL;
+	if (rtp != TYPE_int && rtp != TYPE_lng && rtp != TYPE_dbl) {
+		GDKerror("BATcalcfusesum: cannot sum %s.\n", ATOMname(rtp));
+		return GDK_FAIL;
+	}
+	cnt = BATcount(b1);
+	nmorsels = (cnt + FUSE_MORSEL - 1) / FUSE_MORSEL;
+	f.prog = prog;
+	f.tp = tp;
+	f.b = b;
+	f.v = v;
+	f.c = c;
+	f.seen = GDKzalloc(nmorsels + 1);
+	if (tp == TYPE_dbl)
+		f.dbins = GDKmalloc((nmorsels + 1) * SUMBINS_STATE * sizeof(lng));
+	else
+		f.lsums = GDKmalloc((nmorsels + 1) * sizeof(lng));
+	if (f.seen == NULL || (tp == TYPE_dbl ? f.dbins == NULL : f.lsums == NULL))
+		rc = GDK_FAIL;
+	else
+		rc = fuse_evaluate(&f, nargs, cnt, fuse_sum_morsel);
+	dbins[0] = lng_nil;
+	memset(dbins + 1, 0, (SUMBINS_STATE - 1) * sizeof(lng));
+	for (m = 0; rc == GDK_SUCCEED && m < nmorsels; m++) {
+		if (!f.seen[m])
+			continue;
+		seen = 1;
+		if (tp != TYPE_dbl) {
+			ADD_WITH_CHECK(lng, f.lsums[m], lng, lsum, lng, t,
+				       GDK_lng_max, goto overflow);
+			lsum = t;
+		} else {
+			sumbins_merge(dbins, f.dbins + m * SUMBINS_STATE);
+		}
+	}
+	if (rc != GDK_SUCCEED)
+		goto bailout;
+	if (tp == TYPE_dbl) {
+		d = seen ? sumbins_value(dbins, 0) : dbl_nil;
+		if (seen && fabs(d) > GDK_dbl_max)
+			goto overflow;
+		ret->vtype = TYPE_dbl;
+		ret->val.dval = d;
+	} else {
+		ret->vtype = TYPE_lng;
+		ret->val.lval = seen ? lsum : lng_nil;
+	}
+  bailout:
+	GDKfree(f.nils);
+	GDKfree(f.seen);
+	GDKfree(f.lsums);
+	GDKfree(f.dbins);
+	return rc;
+  overflow:
+	GDKerror("22003!overflow in calculation.\n");
+	rc = GDK_FAIL;
+	goto bailout;
+}
+
 /* ---------------------------------------------------------------------- */
 /* if-then-else (any type) */
 
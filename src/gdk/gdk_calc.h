@@ -78,6 +78,12 @@ gdk_export BAT *BATcalcne(BAT *b1, BAT *b2, BAT *s);
 gdk_export BAT *BATcalcnecst(BAT *b, const ValRecord *v, BAT *s);
 gdk_export BAT *BATcalccstne(const ValRecord *v, BAT *b, BAT *s);
 gdk_export BAT *BATcalccmp(BAT *b1, BAT *b2, BAT *s);
+/* argument markers and evaluation stack limit of BATcalcfuse programs */
+#define FUSE_ARG	'v'
+#define FUSE_PROJ	'p'
+#define FUSE_MAXDEPTH	16
+gdk_export BAT *BATcalcfuse(const char *prog, int tp, BAT **b, const ValRecord *v, int nargs, BAT *c);
+gdk_export gdk_return BATcalcfusesum(ValPtr ret, const char *prog, int tp, BAT **b, const ValRecord *v, int nargs, BAT *c);
 gdk_export BAT *BATcalccmpcst(BAT *b, const ValRecord *v, BAT *s);
 gdk_export BAT *BATcalccstcmp(const ValRecord *v, BAT *b, BAT *s);
 gdk_export BAT *BATcalcbetween(BAT *b, BAT *lo, BAT *hi, BAT *s, int sym);
@@ -121,6 +127,9 @@ gdk_export gdk_return VARconvert(ValPtr ret, const ValRecord *v, int abort_on_er
 gdk_export gdk_return BATcalcavg(BAT *b, BAT *s, dbl *avg, BUN *vals);
 
 gdk_export BAT *BATgroupsum(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
+gdk_export BAT *BATgroupsumbins(BAT *b, BAT *g, BAT *e, BAT *s, int skip_nils, int abort_on_error);
+gdk_export BAT *BATgroupbinsum(BAT *b, BAT *g, BAT *e, int tp, int abort_on_error);
+gdk_export BAT *BATgroupbinavg(BAT *b, BAT *g, BAT *e);
 gdk_export BAT *BATgroupprod(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export gdk_return BATgroupavg(BAT **bnp, BAT **cntsp, BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
 gdk_export BAT *BATgroupcount(BAT *b, BAT *g, BAT *e, BAT *s, int tp, int skip_nils, int abort_on_error);
@@ -250,3 +250,121 @@
 	} while (0)
 #endif	/* HAVE___BUILTIN_ADD_OVERFLOW */
 #endif	/* HAVE_HGE */
+
+/* Floating point sums are kept in bins on a fixed grid: bin t holds an
+ * integer multiple of 2^(SUMBINW*t-1074).  Each value is split along
+ * the grid into the bins it covers, truncating toward zero, and only
+ * the SUMBINS bins down from the highest bin reached so far are kept.
+ * The bins are integers, so adding to them is exact and a state does
+ * not depend on the order in which values were added nor on how they
+ * were split up and merged, as long as there are fewer than 2^42 of
+ * them.  A state is SUMBINS_STATE lng's: the grid index of the highest
+ * bin (nil if no value was added, -1 if a nil made the sum nil), the
+ * bins from high to low, and the number of values added. */
+#define SUMBINW		20
+#define SUMBINS		6
+#define SUMBINS_STATE	(SUMBINS + 2)
+
+/* 2^e for -1022 <= e <= 1023 */
+static inline dbl
+sumbins_pow2(int e)
+{
+	ulng u = (ulng) (e + 1023) << 52;
+	dbl d;
+
+	memcpy(&d, &u, sizeof(d));
+	return d;
+}
+
+/* make t the highest bin of the state, dropping the bins that fall off
+ * the bottom */
+static inline void
+sumbins_raise(lng *restrict st, lng t)
+{
+	int d = is_lng_nil(st[0]) || t - st[0] >= SUMBINS ? SUMBINS : (int) (t - st[0]);
+
+	memmove(st + 1 + d, st + 1, (SUMBINS - d) * sizeof(lng));
+	memset(st + 1, 0, d * sizeof(lng));
+	st[0] = t;
+}
+
+/* add the finite value x to the state */
+static inline void
+sumbins_add(lng *restrict st, dbl x)
+{
+	ulng u;
+	int t, s, i;
+	lng k;
+
+	if (st[0] == -1)
+		return;
+	memcpy(&u, &x, sizeof(u));
+	/* for e the exponent of x, |x| < 2^(e+1) <= 2^(SUMBINW*(t+1)-1074) */
+	t = ((int) (u >> 52 & 0x7FF) + 51) / SUMBINW;
+	if (is_lng_nil(st[0]) || t > st[0])
+		sumbins_raise(st, t);
+	st[SUMBINS + 1]++;
+	/* scale x so that its part in bin t is its integer part, in two
+	 * steps because the factor may not be a dbl */
+	s = 1074 - SUMBINW * t;
+	x = x * sumbins_pow2(s / 2) * sumbins_pow2(s - s / 2);
+	for (i = (int) (st[0] - t); i < SUMBINS && x != 0; i++) {
+		k = (lng) x;
+		st[1 + i] += k;
+		x = (x - k) * (1 << SUMBINW);
+	}
+}
+
+/* add state src to state dst */
+static inline void
+sumbins_merge(lng *restrict dst, const lng *restrict src)
+{
+	int i, d;
+
+	if (dst[0] == -1 || is_lng_nil(src[0]))
+		return;
+	if (src[0] == -1) {
+		dst[0] = -1;
+		return;
+	}
+	if (is_lng_nil(dst[0]) || src[0] > dst[0])
+		sumbins_raise(dst, src[0]);
+	d = (int) (dst[0] - src[0]);
+	for (i = 0; i + d < SUMBINS; i++)
+		dst[1 + i + d] += src[1 + i];
+	dst[SUMBINS + 1] += src[SUMBINS + 1];
+}
+
+/* the value of a state with values, times 2^scale; it is inf if it
+ * does not fit in a dbl */
+static inline dbl
+sumbins_value(const lng *restrict st, int scale)
+{
+	const lng r = (lng) 1 << SUMBINW;
+	lng b[SUMBINS], c;
+	int i, neg = 0;
+	dbl v = 0;
+
+	memcpy(b, st + 1, sizeof(b));
+	for (;;) {
+		/* bring all bins but the highest into [0, 2^SUMBINW),
+		 * the sign of the sum is then that of the highest */
+		for (i = SUMBINS - 1; i > 0; i--) {
+			c = b[i] / r;
+			if (b[i] - c * r < 0)
+				c--;
+			b[i] -= c * r;
+			b[i - 1] += c;
+		}
+		if (b[0] >= 0)
+			break;
+		/* negate, so the value is a sum of non-negative terms */
+		for (i = 0; i < SUMBINS; i++)
+			b[i] = -b[i];
+		neg = 1;
+	}
+	for (i = SUMBINS - 1; i >= 0; i--)
+		if (b[i] != 0 && st[0] - i >= 0)
+			v += ldexp((dbl) b[i], (int) (SUMBINW * (st[0] - i)) - 1074 + scale);
+	return neg ? -v : v;
+}
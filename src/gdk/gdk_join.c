@@ -3928,6 +3928,201 @@ BATthetajoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int op, int
 	return thetajoin(r1, r2, l, r, sl, sr, opcode, maxsize, t0);
 }
 
+/* Grace hash join.  When the hash table on the inner side of a join
+ * does not fit in the memory budget of the query, it ends up memory
+ * mapped and the random probes into it thrash the disk.  Instead, we
+ * partition both sides on the hash value of the join attribute into
+ * lists of oids, which are transient BATs and so spill to disk when
+ * large, and join the partitions one at a time with an in-memory
+ * hash on the inner side.  The partitions are ascending lists of
+ * oids, so fetching their values is a sequential scan of the input.
+ * The result contains the same pairs as the plain hash join.  Per
+ * partition they come in the same order, by outer oid and per outer
+ * oid in the order of the hash chain, so a stable sort on the outer
+ * oids puts the whole result in the order of the plain hash join.
+ *
+ * The partition number is taken from the high bits of the hash
+ * value multiplied by a large odd constant: the hash tables on the
+ * partitions use the low bits of the same hash values. */
+#define GRACE_MAXPARTS	4096
+#define GRACE_MIX	((uint64_t) 0x9E3779B97F4A7C15)
+
+static void
+gracefree(BAT **parts, int nparts)
+{
+	int i;
+
+	if (parts == NULL)
+		return;
+	for (i = 0; i < nparts; i++)
+		BBPreclaim(parts[i]);
+	GDKfree(parts);
+}
+
+static BAT **
+gracepartition(BAT *b, BAT *s, int nparts, int shift, bool nil_matches)
+{
+	BUN start, end, cnt, p;
+	const oid *cand, *candend;
+	int tpe = ATOMtype(b->ttype);
+	const void *nil = ATOMnilptr(tpe);
+	int (*cmp)(const void *, const void *) = ATOMcompare(tpe);
+	BATiter bi = bat_iterator(b);
+	BAT **parts, *bn;
+	const void *v;
+	oid o;
+	int i;
+
+	CANDINIT(b, s, start, end, cnt, cand, candend);
+	cnt = cand ? (BUN) (candend - cand) : end - start;
+	if ((parts = GDKzalloc(nparts * sizeof(BAT *))) == NULL)
+		return NULL;
+	for (i = 0; i < nparts; i++) {
+		if ((parts[i] = COLnew(0, TYPE_oid, cnt / nparts + 1, TRANSIENT)) == NULL) {
+			gracefree(parts, nparts);
+			return NULL;
+		}
+	}
+	for (;;) {
+		if (cand) {
+			if (cand == candend)
+				break;
+			o = *cand++;
+			p = o - b->hseqbase;
+		} else {
+			if (start == end)
+				break;
+			p = start++;
+			o = p + b->hseqbase;
+		}
+		v = BUNtail(bi, p);
+		if (!nil_matches && (*cmp)(v, nil) == 0)
+			continue;
+		bn = parts[((uint64_t) ATOMhash(tpe, v) * GRACE_MIX) >> shift];
+		if (BATcount(bn) == BATcapacity(bn) &&
+		    BATextend(bn, BATgrows(bn)) != GDK_SUCCEED) {
+			gracefree(parts, nparts);
+			return NULL;
+		}
+		APPEND(bn, o);
+	}
+	for (i = 0; i < nparts; i++) {
+		bn = parts[i];
+		BATsetcount(bn, BATcount(bn));
+		bn->tsorted = true;
+		bn->trevsorted = BATcount(bn) <= 1;
+		bn->tkey = true;
+		bn->tdense = false;
+		bn->tnil = false;
+		bn->tnonil = true;
+	}
+	return parts;
+}
+
+static gdk_return
+gracejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
+	  bool nil_matches, size_t footprint, size_t avail, lng t0,
+	  bool swapped)
+{
+	BAT **lparts = NULL, **rparts = NULL;
+	BAT *lv = NULL, *rv = NULL, *p1 = NULL, *p2 = NULL;
+	BAT *o1 = NULL, *o2 = NULL;
+	BUN maxsize;
+	int nparts, shift, i;
+
+	/* leave room for the values of a partition besides its hash */
+	for (nparts = 2, shift = 63;
+	     nparts < GRACE_MAXPARTS && footprint / nparts > avail / 2;
+	     nparts <<= 1, shift--)
+		;
+	ALGODEBUG fprintf(stderr, "#gracejoin(l=%s#" BUNFMT ",r=%s#" BUNFMT
+			  ",footprint=" SZFMT ",avail=" SZFMT ",nparts=%d)%s\n",
+			  BATgetId(l), BATcount(l), BATgetId(r), BATcount(r),
+			  footprint, avail, nparts, swapped ? " swapped" : "");
+
+	if ((lparts = gracepartition(l, sl, nparts, shift, nil_matches)) == NULL ||
+	    (rparts = gracepartition(r, sr, nparts, shift, nil_matches)) == NULL)
+		goto bailout;
+	for (i = 0; i < nparts; i++) {
+		if (BATcount(lparts[i]) > 0 && BATcount(rparts[i]) > 0) {
+			if ((lv = BATproject(lparts[i], l)) == NULL ||
+			    (rv = BATproject(rparts[i], r)) == NULL ||
+			    (BATtvoid(rv) && BATmaterialize(rv) != GDK_SUCCEED))
+				goto bailout;
+			maxsize = joininitresults(&p1, &p2, BATcount(lv), BATcount(rv),
+						  l->tkey, r->tkey, false, false,
+						  false, BUN_NONE);
+			if (maxsize == BUN_NONE)
+				goto bailout;
+			if (maxsize > 0 &&
+			    hashjoin(p1, p2, lv, rv, NULL, NULL, nil_matches,
+				     false, false, false, maxsize, t0, swapped,
+				     "grace partition") != GDK_SUCCEED) {
+				/* hashjoin got rid of the results */
+				p1 = p2 = NULL;
+				goto bailout;
+			}
+			BBPunfix(lv->batCacheid);
+			BBPunfix(rv->batCacheid);
+			lv = rv = NULL;
+			/* translate positions in the partitions to oids */
+			if ((o1 = BATproject(p1, lparts[i])) == NULL ||
+			    (o2 = BATproject(p2, rparts[i])) == NULL ||
+			    BATappend(r1, o1, NULL, FALSE) != GDK_SUCCEED ||
+			    BATappend(r2, o2, NULL, FALSE) != GDK_SUCCEED)
+				goto bailout;
+			BBPunfix(o1->batCacheid);
+			BBPunfix(o2->batCacheid);
+			BBPunfix(p1->batCacheid);
+			BBPunfix(p2->batCacheid);
+			o1 = o2 = p1 = p2 = NULL;
+		}
+		/* done with this partition */
+		BBPunfix(lparts[i]->batCacheid);
+		BBPunfix(rparts[i]->batCacheid);
+		lparts[i] = rparts[i] = NULL;
+	}
+	gracefree(lparts, nparts);
+	gracefree(rparts, nparts);
+	lparts = rparts = NULL;
+	if (BATcount(r1) > 1 && !r1->tsorted) {
+		/* restore the order of the plain hash join */
+		if (BATsort(&o1, &p1, NULL, r1, NULL, NULL, 0, 1) != GDK_SUCCEED ||
+		    (o2 = BATproject(p1, r2)) == NULL)
+			goto bailout;
+		memcpy(Tloc(r1, 0), Tloc(o1, 0), BATcount(r1) * sizeof(oid));
+		memcpy(Tloc(r2, 0), Tloc(o2, 0), BATcount(r2) * sizeof(oid));
+		r1->tsorted = true;
+		r1->trevsorted = false;
+		r1->tnosorted = r1->tnorevsorted = 0;
+		r2->tsorted = r2->trevsorted = false;
+		r2->tnosorted = r2->tnorevsorted = 0;
+		r2->tdense = false;
+		BBPunfix(o1->batCacheid);
+		BBPunfix(o2->batCacheid);
+		BBPunfix(p1->batCacheid);
+	}
+	ALGODEBUG fprintf(stderr, "#gracejoin(l=%s,r=%s)=(%s#" BUNFMT ",%s#" BUNFMT ") " LLFMT "us\n",
+			  BATgetId(l), BATgetId(r),
+			  BATgetId(r1), BATcount(r1),
+			  BATgetId(r2), BATcount(r2),
+			  GDKusec() - t0);
+	return GDK_SUCCEED;
+
+  bailout:
+	BBPreclaim(lv);
+	BBPreclaim(rv);
+	BBPreclaim(p1);
+	BBPreclaim(p2);
+	BBPreclaim(o1);
+	BBPreclaim(o2);
+	gracefree(lparts, nparts);
+	gracefree(rparts, nparts);
+	BBPreclaim(r1);
+	BBPreclaim(r2);
+	return GDK_FAIL;
+}
+
 gdk_return
 BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches, BUN estimate)
 {
@@ -3940,7 +4135,8 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 	bat lparent, rparent;
 #endif
 	bool swap;
-	size_t mem_size;
+	size_t mem_size, footprint, avail;
+	BAT *inner;
 	lng t0 = 0;
 	const char *reason = "";
 
@@ -4083,6 +4279,14 @@ BATjoin(BAT **r1p, BAT **r2p, BAT *l, BAT *r, BAT *sl, BAT *sr, int nil_matches,
 		swap = true;
 		reason = "left is smaller";
 	}
+	/* if the hash we would build does not fit, partition first */
+	inner = swap ? l : r;
+	if (!(swap ? lhash : rhash) &&
+	    (footprint = (size_t) (swap ? lcount : rcount) * (Tsize(inner) + 2 * sizeof(BUN)) + (inner->tvheap ? inner->tvheap->free : 0)) > (avail = GDKmemoryavail())) {
+		if (swap)
+			return gracejoin(r2, r1, r, l, sr, sl, nil_matches, footprint, avail, t0, true);
+		return gracejoin(r1, r2, l, r, sl, sr, nil_matches, footprint, avail, t0, false);
+	}
 	if (swap) {
 		return hashjoin(r2, r1, r, l, sr, sl, nil_matches, false, false, false, maxsize, t0, true, reason);
 	} else {
@@ -76,6 +76,8 @@
 #define LOG_USE		8
 #define LOG_CLEAR	9
 #define LOG_SEQ		10
+#define LOG_INSERT_LZ	11
+#define LOG_UPDATE_LZ	12
 
 #ifdef HAVE_EMBEDDED
 #define printf(fmt,...) ((void) 0)
@@ -103,6 +105,8 @@ static char *log_commands[] = {
 	"LOG_USE",
 	"LOG_CLEAR",
 	"LOG_SEQ",
+	"LOG_INSERT_LZ",
+	"LOG_UPDATE_LZ",
 };
 
 typedef struct logformat_t {
@@ -236,6 +240,233 @@ log_write_string(logger *l, const char *n)
 	return GDK_SUCCEED;
 }
 
+/*
+ * Bulk inserts and updates of fixed width columns can be written in
+ * compressed form (LOG_INSERT_LZ and LOG_UPDATE_LZ records).  A column
+ * is cut into blocks of at most LOG_BLOCK bytes.  The bytes of the
+ * values in a block are first transposed, so that e.g. all high order
+ * bytes of an integer column end up next to each other, and the result
+ * is compressed with a simple LZ77 scheme in the style of LZ4.  Each
+ * block is preceded by its compressed length; a length of 0 means the
+ * block did not compress and is stored as is.
+ */
+#define LOG_BLOCK	(64 * 1024)
+#define LOG_COMPRESS_MIN 4096	/* don't bother for fewer bytes */
+#define LZ_HASHLOG	12
+#define LZ_MINMATCH	4
+#define LZ_LASTLITERALS	5
+#define LZ_MAXOFFSET	65535
+
+/* encode a sequence length that did not fit in its 4 bit token field */
+static unsigned char *
+lz_length(unsigned char *op, size_t len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = (unsigned char) len;
+	return op;
+}
+
+/* emit nlit literals starting at lit followed by a match of mlen
+ * bytes at distance off (no match if mlen == 0); returns NULL if the
+ * output does not fit before oend */
+static unsigned char *
+lz_sequence(unsigned char *op, unsigned char *oend, const unsigned char *lit, size_t nlit, size_t off, size_t mlen)
+{
+	unsigned char *token;
+
+	if (op + nlit + nlit / 255 + mlen / 255 + 5 > oend)
+		return NULL;
+	token = op++;
+	if (nlit >= 15) {
+		*token = 15 << 4;
+		op = lz_length(op, nlit - 15);
+	} else
+		*token = (unsigned char) (nlit << 4);
+	memcpy(op, lit, nlit);
+	op += nlit;
+	if (mlen > 0) {
+		*op++ = (unsigned char) off;
+		*op++ = (unsigned char) (off >> 8);
+		mlen -= LZ_MINMATCH;
+		if (mlen >= 15) {
+			*token |= 15;
+			op = lz_length(op, mlen - 15);
+		} else
+			*token |= (unsigned char) mlen;
+	}
+	return op;
+}
+
+/* compress len bytes at src into at most cap bytes at dst; returns the
+ * compressed size, or 0 if it does not fit */
+static size_t
+lz_compress(const unsigned char *src, size_t len, unsigned char *dst, size_t cap)
+{
+	unsigned int hash[1 << LZ_HASHLOG];
+	const unsigned char *ip = src, *anchor = src, *ref;
+	const unsigned char *end = src + len, *mlimit = end - LZ_LASTLITERALS;
+	unsigned char *op = dst, *oend = dst + cap;
+	unsigned int seq, h;
+	size_t mlen;
+
+	memset(hash, 0, sizeof(hash));
+	if (len > LZ_MINMATCH + LZ_LASTLITERALS) {
+		while (ip + LZ_MINMATCH <= mlimit) {
+			memcpy(&seq, ip, sizeof(seq));
+			h = (seq * 2654435761U) >> (32 - LZ_HASHLOG);
+			ref = src + hash[h];
+			hash[h] = (unsigned int) (ip - src);
+			if (ref >= ip || ip - ref > LZ_MAXOFFSET ||
+			    memcmp(ref, ip, LZ_MINMATCH) != 0) {
+				/* skip faster through incompressible data */
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+			for (mlen = LZ_MINMATCH; ip + mlen < mlimit && ref[mlen] == ip[mlen]; mlen++)
+				;
+			op = lz_sequence(op, oend, anchor, (size_t) (ip - anchor), (size_t) (ip - ref), mlen);
+			if (op == NULL)
+				return 0;
+			ip += mlen;
+			anchor = ip;
+		}
+	}
+	op = lz_sequence(op, oend, anchor, (size_t) (end - anchor), 0, 0);
+	if (op == NULL)
+		return 0;
+	return (size_t) (op - dst);
+}
+
+/* decompress slen bytes at src into exactly dlen bytes at dst;
+ * returns -1 if the input is corrupt */
+static int
+lz_decompress(const unsigned char *src, size_t slen, unsigned char *dst, size_t dlen)
+{
+	const unsigned char *ip = src, *iend = src + slen, *ref;
+	unsigned char *op = dst, *oend = dst + dlen;
+	size_t len, off;
+	unsigned char token;
+
+	while (ip < iend) {
+		token = *ip++;
+		len = token >> 4;
+		if (len == 15) {
+			do {
+				if (ip >= iend)
+					return -1;
+				len += *ip;
+			} while (*ip++ == 255);
+		}
+		if (len > (size_t) (iend - ip) || len > (size_t) (oend - op))
+			return -1;
+		memcpy(op, ip, len);
+		ip += len;
+		op += len;
+		if (ip == iend)
+			break;	/* the last sequence has no match */
+		if (iend - ip < 2)
+			return -1;
+		off = ip[0] | ((size_t) ip[1] << 8);
+		ip += 2;
+		len = token & 15;
+		if (len == 15) {
+			do {
+				if (ip >= iend)
+					return -1;
+				len += *ip;
+			} while (*ip++ == 255);
+		}
+		len += LZ_MINMATCH;
+		if (off == 0 || off > (size_t) (op - dst) || len > (size_t) (oend - op))
+			return -1;
+		ref = op - off;
+		if (off >= len) {
+			memcpy(op, ref, len);
+			op += len;
+		} else {
+			/* overlapping match repeats the last off bytes */
+			while (len-- > 0)
+				*op++ = *ref++;
+		}
+	}
+	return op == oend ? 0 : -1;
+}
+
+/* write cnt values of width bytes at src as a sequence of compressed
+ * blocks */
+static gdk_return
+log_write_compressed(logger *lg, const char *src, size_t cnt, size_t width)
+{
+	size_t blk = LOG_BLOCK / width * width, len = cnt * width;
+	size_t off, n, nvals, clen, i, j;
+	unsigned char *buf, *tmp;
+
+	if ((buf = GDKmalloc(2 * LOG_BLOCK)) == NULL)
+		return GDK_FAIL;
+	tmp = buf + LOG_BLOCK;
+	for (off = 0; off < len; off += n) {
+		const unsigned char *s = (const unsigned char *) src + off;
+
+		n = len - off < blk ? len - off : blk;
+		nvals = n / width;
+		if (width > 1) {
+			for (i = 0; i < nvals; i++)
+				for (j = 0; j < width; j++)
+					buf[j * nvals + i] = s[i * width + j];
+			s = buf;
+		}
+		/* a block has to shrink by at least 1/32 to be worth it */
+		clen = lz_compress(s, n, tmp, n - n / 32);
+		if (!mnstr_writeInt(lg->log, (int) clen) ||
+		    (clen == 0 ?
+		     mnstr_write(lg->log, src + off, 1, n) != (ssize_t) n :
+		     mnstr_write(lg->log, tmp, 1, clen) != (ssize_t) clen)) {
+			GDKfree(buf);
+			return GDK_FAIL;
+		}
+	}
+	GDKfree(buf);
+	return GDK_SUCCEED;
+}
+
+/* read cnt values of width bytes written by log_write_compressed
+ * into dst */
+static log_return
+log_read_compressed(logger *lg, char *dst, size_t cnt, size_t width)
+{
+	size_t blk = LOG_BLOCK / width * width, len = cnt * width;
+	size_t off, n, nvals, i, j;
+	unsigned char *buf, *tmp;
+	log_return res = LOG_OK;
+	int clen;
+
+	if ((buf = GDKmalloc(2 * LOG_BLOCK)) == NULL)
+		return LOG_ERR;
+	tmp = buf + LOG_BLOCK;
+	for (off = 0; res == LOG_OK && off < len; off += n) {
+		unsigned char *d = (unsigned char *) dst + off;
+
+		n = len - off < blk ? len - off : blk;
+		nvals = n / width;
+		if (mnstr_readInt(lg->log, &clen) != 1 || clen < 0 || (size_t) clen >= n) {
+			res = LOG_EOF;
+		} else if (clen == 0) {
+			if (mnstr_read(lg->log, d, 1, n) != (ssize_t) n)
+				res = LOG_EOF;
+		} else if (mnstr_read(lg->log, tmp, 1, clen) != (ssize_t) clen ||
+			   lz_decompress(tmp, (size_t) clen, width > 1 ? buf : d, n) < 0) {
+			res = LOG_EOF;
+		} else if (width > 1) {
+			for (i = 0; i < nvals; i++)
+				for (j = 0; j < width; j++)
+					d[i * width + j] = buf[j * nvals + i];
+		}
+	}
+	GDKfree(buf);
+	return res;
+}
+
 static log_return
 log_read_clear(logger *lg, trans *tr, char *name)
 {
@@ -365,10 +596,14 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 	log_bid bid = logger_find_bat(lg, name);
 	BAT *b = BATdescriptor(bid);
 	log_return res = LOG_OK;
-	int ht = -1, tt = -1, tseq = 0;
+	int ht = -1, tt = -1, tseq = 0, compressed = 0;
 
+	if (l->flag == LOG_INSERT_LZ || l->flag == LOG_UPDATE_LZ) {
+		compressed = 1;
+		l->flag = l->flag == LOG_INSERT_LZ ? LOG_INSERT : LOG_UPDATE;
+	}
 	if (lg->debug & 1)
-		fprintf(stderr, "#logger found log_read_updates %s %s " LLFMT "\n", name, l->flag == LOG_INSERT ? "insert" : "update", l->nr);
+		fprintf(stderr, "#logger found log_read_updates %s %s%s " LLFMT "\n", name, l->flag == LOG_INSERT ? "insert" : "update", compressed ? " compressed" : "", l->nr);
 
 	if (b) {
 		ht = TYPE_void;
@@ -416,7 +651,7 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 
 		assert(l->nr <= (lng) BUN_MAX);
 		if (l->flag == LOG_UPDATE) {
-			uid = COLnew(0, ht, (BUN) l->nr, PERSISTENT);
+			uid = COLnew(0, compressed ? TYPE_oid : ht, (BUN) l->nr, PERSISTENT);
 			if (uid == NULL) {
 				logbat_destroy(b);
 				return LOG_ERR;
@@ -434,7 +669,26 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 		if (tseq)
 			BATtseqbase(r, 0);
 
-		if (ht == TYPE_void && l->flag == LOG_INSERT) {
+		if (compressed) {
+			/* only fixed width columns are written compressed */
+			if (tt == TYPE_void || ATOMvarsized(tt))
+				res = LOG_ERR;
+			if (res == LOG_OK && uid)
+				res = log_read_compressed(lg, Tloc(uid, 0), (size_t) l->nr, sizeof(oid));
+			if (res == LOG_OK)
+				res = log_read_compressed(lg, Tloc(r, 0), (size_t) l->nr, ATOMsize(tt));
+			if (res == LOG_OK) {
+				if (uid) {
+					uid->tsorted = uid->trevsorted = uid->tkey = 0;
+					uid->tnonil = 0;
+					BATsetcount(uid, (BUN) l->nr);
+				}
+				r->tsorted = r->trevsorted = r->tkey = 0;
+				r->tnonil = 0;
+				BATsetcount(r, (BUN) l->nr);
+				l->nr = 0;
+			}
+		} else if (ht == TYPE_void && l->flag == LOG_INSERT) {
 			for (; res == LOG_OK && l->nr > 0; l->nr--) {
 				void *t = rt(tv, lg->log, 1);
 
@@ -510,27 +764,13 @@ log_read_updates(logger *lg, trans *tr, logformat *l, char *name)
 	return res;
 }
 
+/* apply the inserts or updates of la to b */
 static gdk_return
-la_bat_updates(logger *lg, logaction *la)
+la_bat_apply(BAT *b, logaction *la)
 {
-	log_bid bid = logger_find_bat(lg, la->name);
-	BAT *b;
-
-	if (bid == 0)
-		return GDK_SUCCEED; /* ignore bats no longer in the catalog */
-
-	/* do we need to skip these old updates */
-	if (avoid_snapshot(lg, bid))
-		return GDK_SUCCEED;
-
-	b = BATdescriptor(bid);
-	if (b == NULL)
-		return GDK_FAIL;
 	if (la->type == LOG_INSERT) {
-		if (BATappend(b, la->b, NULL, TRUE) != GDK_SUCCEED) {
-			logbat_destroy(b);
+		if (BATappend(b, la->b, NULL, TRUE) != GDK_SUCCEED)
 			return GDK_FAIL;
-		}
 	} else if (la->type == LOG_UPDATE) {
 		BATiter vi = bat_iterator(la->b);
 		BATiter ii = bat_iterator(la->uid);
@@ -550,28 +790,43 @@ la_bat_updates(logger *lg, logaction *la)
 					const void *tv = ATOMnilptr(b->ttype);
 
 					while (b->hseqbase + b->batCount < h) {
-						if (BUNappend(b, tv, TRUE) != GDK_SUCCEED) {
-							logbat_destroy(b);
+						if (BUNappend(b, tv, TRUE) != GDK_SUCCEED)
 							return GDK_FAIL;
-						}
 					}
 				}
-				if (BUNappend(b, t, TRUE) != GDK_SUCCEED) {
-					logbat_destroy(b);
+				if (BUNappend(b, t, TRUE) != GDK_SUCCEED)
 					return GDK_FAIL;
-				}
 			} else {
-				if (BUNreplace(b, h, t, TRUE) != GDK_SUCCEED) {
-					logbat_destroy(b);
+				if (BUNreplace(b, h, t, TRUE) != GDK_SUCCEED)
 					return GDK_FAIL;
-				}
 			}
 		}
 	}
-	logbat_destroy(b);
 	return GDK_SUCCEED;
 }
 
+static gdk_return
+la_bat_updates(logger *lg, logaction *la)
+{
+	log_bid bid = logger_find_bat(lg, la->name);
+	BAT *b;
+	gdk_return ret;
+
+	if (bid == 0)
+		return GDK_SUCCEED; /* ignore bats no longer in the catalog */
+
+	/* do we need to skip these old updates */
+	if (avoid_snapshot(lg, bid))
+		return GDK_SUCCEED;
+
+	b = BATdescriptor(bid);
+	if (b == NULL)
+		return GDK_FAIL;
+	ret = la_bat_apply(b, la);
+	logbat_destroy(b);
+	return ret;
+}
+
 static log_return
 log_read_destroy(logger *lg, trans *tr, char *name)
 {
@@ -816,8 +1071,11 @@ la_destroy(logaction *c)
 {
 	if (c->name)
 		GDKfree(c->name);
-	if (c->b)
-		logbat_destroy(c->b);
+	logbat_destroy(c->b);
+	logbat_destroy(c->uid);
+	c->name = NULL;
+	c->b = NULL;
+	c->uid = NULL;
 }
 
 static gdk_return
@@ -834,6 +1092,7 @@ tr_grow(trans *tr)
 	/* cleanup the next */
 	tr->changes[tr->nr].name = NULL;
 	tr->changes[tr->nr].b = NULL;
+	tr->changes[tr->nr].uid = NULL;
 	return GDK_SUCCEED;
 }
 
@@ -860,8 +1119,161 @@ tr_abort(logger *lg, trans *tr)
 	return tr_destroy(tr);
 }
 
+/*
+ * During recovery the inserts and updates of committed transactions
+ * are not applied right away.  They are collected until the next
+ * change to the logger catalog, or until enough rows are pending, and
+ * are then replayed per BAT, with different BATs updated in parallel.
+ * Whether a BAT still needs its updates depends on the transaction
+ * being replayed, so that is decided when they are collected.
+ */
+#define REPLAY_MAXROWS	((BUN) 1 << 22)
+
+typedef struct replay {
+	logaction *changes;	/* pending actions in log order */
+	int nr;
+	int sz;
+	BUN rows;		/* number of pending rows */
+	struct replay_ord {
+		bat bid;
+		int nr;
+	} *order;		/* pending actions sorted on BAT */
+	int next;		/* first action not handed out yet */
+	int failed;
+	MT_Lock lock;
+} replay;
+
+static int
+replay_cmp(const void *a, const void *b)
+{
+	const struct replay_ord *x = a, *y = b;
+
+	if (x->bid != y->bid)
+		return x->bid < y->bid ? -1 : 1;
+	return x->nr < y->nr ? -1 : x->nr > y->nr;
+}
+
+/* apply the pending actions, one BAT at a time */
+static void
+replay_worker(void *arg)
+{
+	replay *rp = arg;
+	int i, j;
+	BAT *b;
+
+	for (;;) {
+		MT_lock_set(&rp->lock);
+		i = rp->next;
+		for (j = i; j < rp->nr && rp->order[j].bid == rp->order[i].bid; j++)
+			;
+		rp->next = j;
+		if (rp->failed)
+			i = j;
+		MT_lock_unset(&rp->lock);
+		if (i == j)
+			break;
+		if ((b = BATdescriptor(rp->order[i].bid)) == NULL)
+			j = i;
+		for (; i < j; i++)
+			if (la_bat_apply(b, &rp->changes[rp->order[i].nr]) != GDK_SUCCEED)
+				break;
+		logbat_destroy(b);
+		if (i < j || b == NULL) {
+			MT_lock_set(&rp->lock);
+			rp->failed = 1;
+			MT_lock_unset(&rp->lock);
+		}
+	}
+}
+
+static gdk_return
+replay_flush(logger *lg, replay *rp)
+{
+	int i, ngroups, nthreads;
+	MT_Id *tids = NULL;
+
+	if (rp->nr == 0)
+		return GDK_SUCCEED;
+	rp->order = GDKmalloc(rp->nr * sizeof(struct replay_ord));
+	if (rp->order == NULL) {
+		rp->failed = 1;
+		goto cleanup;
+	}
+	for (i = 0; i < rp->nr; i++) {
+		rp->order[i].bid = (bat) rp->changes[i].id;
+		rp->order[i].nr = i;
+	}
+	qsort(rp->order, rp->nr, sizeof(struct replay_ord), replay_cmp);
+	for (ngroups = 1, i = 1; i < rp->nr; i++)
+		ngroups += rp->order[i].bid != rp->order[i - 1].bid;
+	nthreads = GDKnr_threads < ngroups ? GDKnr_threads : ngroups;
+	if (lg->debug & 1)
+		fprintf(stderr, "#replay_flush %d actions on %d bats using %d threads\n", rp->nr, ngroups, nthreads);
+
+	rp->next = 0;
+	rp->failed = 0;
+	if (nthreads > 1)
+		tids = GDKzalloc((nthreads - 1) * sizeof(MT_Id));
+	if (tids) {
+		for (i = 0; i < nthreads - 1; i++)
+			if (MT_create_thread(&tids[i], replay_worker, rp, MT_THR_JOINABLE) < 0)
+				tids[i] = 0;
+	}
+	replay_worker(rp);
+	if (tids) {
+		for (i = 0; i < nthreads - 1; i++)
+			if (tids[i])
+				MT_join_thread(tids[i]);
+		GDKfree(tids);
+	}
+	if (!rp->failed)
+		lg->changes += rp->nr;
+
+  cleanup:
+	for (i = 0; i < rp->nr; i++)
+		la_destroy(&rp->changes[i]);
+	GDKfree(rp->order);
+	rp->order = NULL;
+	rp->nr = 0;
+	rp->rows = 0;
+	return rp->failed ? GDK_FAIL : GDK_SUCCEED;
+}
+
+/* queue the inserts or updates of c for replay */
+static gdk_return
+replay_add(logger *lg, replay *rp, logaction *c)
+{
+	log_bid bid = logger_find_bat(lg, c->name);
+
+	/* ignore bats no longer in the catalog and old updates */
+	if (bid == 0 || avoid_snapshot(lg, bid)) {
+		lg->changes++;
+		la_destroy(c);
+		return GDK_SUCCEED;
+	}
+	if (rp->nr == rp->sz) {
+		int sz = rp->sz ? rp->sz << 1 : TR_SIZE;
+		logaction *changes = GDKrealloc(rp->changes, sz * sizeof(logaction));
+
+		if (changes == NULL)
+			return GDK_FAIL;
+		rp->changes = changes;
+		rp->sz = sz;
+	}
+	c->id = bid;
+	rp->rows += BATcount(c->b);
+	rp->changes[rp->nr++] = *c;
+	/* the pending action owns the name and bats now */
+	c->name = NULL;
+	c->b = NULL;
+	c->uid = NULL;
+	if (rp->rows >= REPLAY_MAXROWS)
+		return replay_flush(lg, rp);
+	return GDK_SUCCEED;
+}
+
 static trans *
-tr_commit(logger *lg, trans *tr)
+tr_commit(logger *lg, trans *tr, replay *rp)
 {
 	int i;
 
@@ -869,13 +1281,24 @@ tr_commit(logger *lg, trans *tr)
 		fprintf(stderr, "#tr_commit\n");
 
 	for (i = 0; i < tr->nr; i++) {
-		if (la_apply(lg, &tr->changes[i]) != GDK_SUCCEED) {
-			do {
-				tr = tr_abort(lg, tr);
-			} while (tr != NULL);
-			return (trans *) -1;
+		logaction *c = &tr->changes[i];
+
+		if (c->type == LOG_INSERT || c->type == LOG_UPDATE) {
+			if (replay_add(lg, rp, c) != GDK_SUCCEED)
+				break;
+			continue;
 		}
-		la_destroy(&tr->changes[i]);
+		/* catalog changes are applied in log order */
+		if (replay_flush(lg, rp) != GDK_SUCCEED ||
+		    la_apply(lg, c) != GDK_SUCCEED)
+			break;
+		la_destroy(c);
+	}
+	if (i < tr->nr) {
+		do {
+			tr = tr_abort(lg, tr);
+		} while (tr != NULL);
+		return (trans *) -1;
 	}
 	return tr_destroy(tr);
 }
@@ -940,7 +1363,9 @@ logger_open(logger *lg)
 	snprintf(id, sizeof(id), LLFMT, lg->id);
 	filename = GDKfilepath(BBPselectfarm(lg->dbfarm_role, 0, offheap), lg->dir, LOGFILE, id);
 
+	MT_lock_set(&lg->sync_lock);
 	lg->log = open_wstream(filename);
+	MT_lock_unset(&lg->sync_lock);
 	lg->end = 0;
 
 	if (lg->log == NULL || mnstr_errnr(lg->log) || log_sequence_nrs(lg) != GDK_SUCCEED) {
@@ -979,8 +1404,15 @@ logger_open(logger *lg)
 static void
 logger_close(logger *lg)
 {
+	/* transactions still waiting for a group commit are synced here */
+	MT_lock_set(&lg->sync_lock);
+	if (lg->log && lg->synced < lg->flushed &&
+	    !(GDKdebug & NOSYNCMASK) && mnstr_fsync(lg->log))
+		fprintf(stderr, "!ERROR: logger_close: sync failed\n");
 	close_stream(lg->log);
 	lg->log = NULL;
+	lg->synced = lg->flushed;
+	MT_lock_unset(&lg->sync_lock);
 }
 
 static gdk_return
@@ -993,6 +1425,7 @@ logger_readlog(logger *lg, char *filename)
 	struct stat sb;
 	int dbg = GDKdebug;
 	int fd;
+	replay rp;
 
 	GDKdebug &= ~(CHECKMASK|PROPMASK);
 
@@ -1018,6 +1451,12 @@ logger_readlog(logger *lg, char *filename)
 		 * something weird is going on */
 		return GDK_FAIL;
 	}
+	rp.changes = NULL;
+	rp.nr = rp.sz = 0;
+	rp.rows = 0;
+	rp.order = NULL;
+	rp.failed = 0;
+	MT_lock_init(&rp.lock, "logger_replay");
 	t0 = time(NULL);
 	if (lg->debug & 1) {
 		printf("# Start reading the write-ahead log '%s'\n", filename);
@@ -1090,13 +1529,15 @@ logger_readlog(logger *lg, char *filename)
 			else if (l.tid != l.nr)	/* abort record */
 				tr = tr_abort(lg, tr);
 			else
-				tr = tr_commit(lg, tr);
+				tr = tr_commit(lg, tr, &rp);
 			break;
 		case LOG_SEQ:
 			err = log_read_seq(lg, &l);
 			break;
 		case LOG_INSERT:
 		case LOG_UPDATE:
+		case LOG_INSERT_LZ:
+		case LOG_UPDATE_LZ:
 			if (name == NULL || tr == NULL)
 				err = LOG_EOF;
 			else
@@ -1142,6 +1583,15 @@ logger_readlog(logger *lg, char *filename)
 	/* remaining transactions are not committed, ie abort */
 	while (tr)
 		tr = tr_abort(lg, tr);
+	/* replay what the committed transactions left pending */
+	if (err == LOG_ERR) {
+		while (rp.nr > 0)
+			la_destroy(&rp.changes[--rp.nr]);
+	} else if (replay_flush(lg, &rp) != GDK_SUCCEED) {
+		err = LOG_ERR;
+	}
+	GDKfree(rp.changes);
+	MT_lock_destroy(&rp.lock);
 	t0 = time(NULL);
 	if (lg->debug & 1) {
 		printf("# Finished reading the write-ahead log '%s'\n", filename);
@@ -1989,6 +2439,8 @@ logger_load(int debug, const char *fn, char filename[FILENAME_MAX], logger *lg)
 	GDKfree(lg->dir);
 	GDKfree(lg->local_dir);
 	GDKfree(lg->buf);
+	MT_lock_destroy(&lg->lock);
+	MT_lock_destroy(&lg->sync_lock);
 	GDKfree(lg);
 	return GDK_FAIL;
 }
@@ -2016,6 +2468,7 @@ logger_new(int debug, const char *fn, const char *logdir, int version, preversio
 	lg->id = 1;
 
 	lg->tid = 0;
+	lg->compress = GDKgetenv_int("gdk_log_compress", 1);
 #ifdef GDKLIBRARY_NIL_NAN
 	lg->convert_nil_nan = 0;
 #endif
@@ -2094,6 +2547,10 @@ logger_new(int debug, const char *fn, const char *logdir, int version, preversio
 	lg->seqs_id = NULL;
 	lg->seqs_val = NULL;
 	lg->dseqs = NULL;
+	MT_lock_init(&lg->lock, "logger_lock");
+	MT_lock_init(&lg->sync_lock, "logger_sync_lock");
+	lg->flushed = 0;
+	lg->synced = 0;
 
 	if (logger_load(debug, fn, filename, lg) == GDK_SUCCEED) {
 		return lg;
@@ -2193,6 +2650,8 @@ logger_destroy(logger *lg)
 	GDKfree(lg->fn);
 	GDKfree(lg->dir);
 	logger_close(lg);
+	MT_lock_destroy(&lg->lock);
+	MT_lock_destroy(&lg->sync_lock);
 	GDKfree(lg);
 }
 
@@ -2602,13 +3061,22 @@ log_delta(logger *lg, BAT *uid, BAT *uval, const char *name)
 		BATiter vi = bat_iterator(uval);
 		gdk_return (*wh) (const void *, stream *, size_t) = BATatoms[TYPE_oid].atomWrite;
 		gdk_return (*wt) (const void *, stream *, size_t) = BATatoms[uval->ttype].atomWrite;
+		int compress = lg->compress &&
+			uid->ttype == TYPE_oid && !isVIEW(uid) &&
+			uval->ttype != TYPE_void && !ATOMvarsized(uval->ttype) && !isVIEW(uval) &&
+			(size_t) l.nr * ATOMsize(uval->ttype) >= LOG_COMPRESS_MIN;
 
-		l.flag = LOG_UPDATE;
+		l.flag = compress ? LOG_UPDATE_LZ : LOG_UPDATE;
 		if (log_write_format(lg, &l) != GDK_SUCCEED ||
 		    log_write_string(lg, name) != GDK_SUCCEED)
 			return GDK_FAIL;
 
-		for (p = 0; p < BUNlast(uid) && ok == GDK_SUCCEED; p++) {
+		if (compress) {
+			ok = log_write_compressed(lg, Tloc(uid, 0), (size_t) l.nr, sizeof(oid));
+			if (ok == GDK_SUCCEED)
+				ok = log_write_compressed(lg, Tloc(uval, 0), (size_t) l.nr, ATOMsize(uval->ttype));
+		}
+		for (p = compress ? BUNlast(uid) : 0; p < BUNlast(uid) && ok == GDK_SUCCEED; p++) {
 			const void *id = BUNtail(ii, p);
 			const void *val = BUNtail(vi, p);
 
@@ -2644,13 +3112,18 @@ log_bat(logger *lg, BAT *b, const char *name)
 	if (l.nr) {
 		BATiter bi = bat_iterator(b);
 		gdk_return (*wt) (const void *, stream *, size_t) = BATatoms[b->ttype].atomWrite;
+		int compress = lg->compress &&
+			b->ttype != TYPE_void && !ATOMvarsized(b->ttype) && !isVIEW(b) &&
+			(size_t) l.nr * ATOMsize(b->ttype) >= LOG_COMPRESS_MIN;
 
-		l.flag = LOG_INSERT;
+		l.flag = compress ? LOG_INSERT_LZ : LOG_INSERT;
 		if (log_write_format(lg, &l) != GDK_SUCCEED ||
 		    log_write_string(lg, name) != GDK_SUCCEED)
 			return GDK_FAIL;
 
-		if (b->ttype > TYPE_void &&
+		if (compress) {
+			ok = log_write_compressed(lg, Tloc(b, b->batInserted), (size_t) l.nr, ATOMsize(b->ttype));
+		} else if (b->ttype > TYPE_void &&
 		    b->ttype < TYPE_str &&
 		    !isVIEW(b)) {
 			const void *t = BUNtail(bi, b->batInserted);
@@ -2780,14 +3253,53 @@ log_tend(logger *lg)
 	if (res != GDK_SUCCEED ||
 	    log_write_format(lg, &l) != GDK_SUCCEED ||
 	    mnstr_flush(lg->log) ||
-	    (!(GDKdebug & NOSYNCMASK) && mnstr_fsync(lg->log)) ||
 	    pre_allocate(lg) != GDK_SUCCEED) {
 		fprintf(stderr, "!ERROR: log_tend: write failed\n");
 		return GDK_FAIL;
 	}
+	MT_lock_set(&lg->lock);
+	lg->flushed = lg->tid;
+	MT_lock_unset(&lg->lock);
 	return GDK_SUCCEED;
 }
 
+/* Make the transactions written by log_tend durable.  This is done
+ * outside the store lock, so committers that arrive while another
+ * one syncs the log queue up on sync_lock.  By the time they get it
+ * their transactions are usually covered already, so a single sync
+ * serves the whole group.  The thread that does have to sync waits
+ * delay ms first to let more transactions join. */
+gdk_return
+log_tsync(logger *lg, int delay)
+{
+	gdk_return res = GDK_SUCCEED;
+	int tid;
+
+	MT_lock_set(&lg->lock);
+	tid = lg->flushed;
+	MT_lock_unset(&lg->lock);
+
+	MT_lock_set(&lg->sync_lock);
+	if (lg->synced < tid) {
+		if (delay > 0)
+			MT_sleep_ms(delay);
+		MT_lock_set(&lg->lock);
+		tid = lg->flushed;
+		MT_lock_unset(&lg->lock);
+		if (lg->debug & 1)
+			fprintf(stderr, "#log_tsync %d..%d\n", lg->synced + 1, tid);
+		if (lg->log == NULL ||
+		    (!(GDKdebug & NOSYNCMASK) && mnstr_fsync(lg->log))) {
+			fprintf(stderr, "!ERROR: log_tsync: sync failed\n");
+			res = GDK_FAIL;
+		} else {
+			lg->synced = tid;
+		}
+	}
+	MT_lock_unset(&lg->sync_lock);
+	return res;
+}
+
 gdk_return
 log_abort(logger *lg)
 {
@@ -57,6 +57,11 @@ typedef struct logger {
 	postversionfix_fptr postfuncp;
 	stream *log;
 	lng end;		/* end of pre-allocated blocks for faster f(data)sync */
+	int compress;		/* write bulk inserts and updates compressed */
+	MT_Lock lock;		/* protects flushed */
+	MT_Lock sync_lock;	/* held while the log is being synced */
+	int flushed;		/* last transaction written to the log */
+	int synced;		/* last transaction known to be on disk */
 	/* Store log_bids (int) to circumvent trouble with reference counting */
 	BAT *catalog_bid;	/* int bid column */
 	BAT *catalog_nme;	/* str name column */
@@ -84,6 +89,7 @@ typedef struct logger_settings {
 	char *shared_logdir;	/* shared write-ahead log directory */
 	int	shared_drift_threshold; /* shared write-ahead log drift threshold */
 	int keep_persisted_log_files; 	/* a flag if old WAL files should be preserved */
+	int group_commit_delay;	/* ms a group commit waits for more transactions */
 } logger_settings;
 
 #define BATSIZE 0
@@ -127,6 +133,7 @@ gdk_export gdk_return log_delta(logger *lg, BAT *uid, BAT *uval, const char *n);
 
 gdk_export gdk_return log_tstart(logger *lg);	/* TODO return transaction id */
 gdk_export gdk_return log_tend(logger *lg);
+gdk_export gdk_return log_tsync(logger *lg, int delay);
 gdk_export gdk_return log_abort(logger *lg);
 
 gdk_export gdk_return log_sequence(logger *lg, int seq, lng id);
@@ -16,6 +16,24 @@
  * OIDs in the tail of the left input.
  */
 
+/* Can a projection of b share the string heap of b instead of
+ * copying it?  That is the case if b is read-only, or if b borrowed
+ * its string heap from a read-only BAT (e.g. b is itself the result
+ * of a projection of a persistent column): b cannot add to a heap it
+ * doesn't own without unsharing it first. */
+static bool
+strheap_shareable(BAT *b)
+{
+	BAT *p;
+
+	if (b->batRestricted == BAT_READ)
+		return true;
+	if (b->tvheap == NULL || b->tvheap->parentid == b->batCacheid)
+		return false;
+	p = BBPquickdesc(b->tvheap->parentid, 0);
+	return p != NULL && p->batRestricted == BAT_READ;
+}
+
 #define project_loop(TYPE)						\
 static gdk_return							\
 project_##TYPE(BAT *bn, BAT *l, BAT *r, bool nilcheck)			\
@@ -256,13 +274,13 @@ BATproject(BAT *l, BAT *r)
 	    l->tnonil &&
 	    (rcount == 0 ||
 	     lcount > (rcount >> 3) ||
-	     r->batRestricted == BAT_READ)) {
+	     strheap_shareable(r))) {
 		/* insert strings as ints, we need to copy the string
 		 * heap whole sale; we can't do this if there are nils
 		 * in the left column, and we won't do it if the left
-		 * is much smaller than the right and the right is
-		 * writable (meaning we have to actually copy the
-		 * right string heap) */
+		 * is much smaller than the right and the string heap
+		 * of the right cannot be shared (meaning we have to
+		 * actually copy the right string heap) */
 		tpe = r->twidth == 1 ? TYPE_bte : (r->twidth == 2 ? TYPE_sht : (r->twidth == 4 ? TYPE_int : TYPE_lng));
 		/* int's nil representation is a valid offset, so
 		 * don't check for nils */
@@ -347,7 +365,7 @@ BATproject(BAT *l, BAT *r)
 
 	/* handle string trick */
 	if (stringtrick) {
-		if (r->batRestricted == BAT_READ) {
+		if (strheap_shareable(r)) {
 			/* really share string heap */
 			assert(r->tvheap->parentid > 0);
 			BBPshare(r->tvheap->parentid);
@@ -554,7 +572,7 @@ BATprojectchain(BAT **bats)
 	if (nonil &&
 	    cnt > 0 &&
 	    ATOMstorage(b->ttype) == TYPE_str &&
-	    b->batRestricted == BAT_READ) {
+	    strheap_shareable(b)) {
 		stringtrick = true;
 		tpe = b->twidth == 1 ? TYPE_bte : (b->twidth == 2 ? TYPE_sht : (b->twidth == 4 ? TYPE_int : TYPE_lng));
 	}
@@ -1891,6 +1891,185 @@ BATthetaselect(BAT *b, BAT *s, const void *val, const char *op)
 	return NULL;
 }
 
+/* Bloom filters, used to push the keys of one side of a join into a
+ * select on the other side (sideways information passing).
+ *
+ * BATbloom builds a filter over the non-nil values of b (restricted
+ * to the candidates in s).  The filter is a BAT of lng: the first
+ * value is the type of the values, the others hold a power of two
+ * bits, at least BLOOM_BITS per value, of which BLOOM_K are set for
+ * each value.  With 8 bits and 3 probes, about 3% of the values that
+ * are not in the set pass the filter.
+ *
+ * BATbloomselect returns the candidates of b (restricted to s) whose
+ * value may be in the set summarized by the filter.  Nils never
+ * pass. */
+#define BLOOM_BITS	8
+#define BLOOM_K		3
+#define BLOOM_MIX	((uint64_t) 0x9E3779B97F4A7C15)
+
+static inline uint64_t
+bloom_hash(int tpe, const void *v)
+{
+	switch (ATOMstorage(tpe)) {
+	case TYPE_int:
+		return (uint64_t) (unsigned int) *(const int *) v * BLOOM_MIX;
+	case TYPE_lng:
+		return (uint64_t) *(const lng *) v * BLOOM_MIX;
+	default:
+		return (uint64_t) ATOMhash(tpe, v) * BLOOM_MIX;
+	}
+}
+
+static inline void
+bloom_set(uint64_t *restrict bits, uint64_t mask, uint64_t h)
+{
+	uint64_t a = h >> 32, d = (h & 0xFFFFFFFF) | 1;
+	int i;
+
+	for (i = 0; i < BLOOM_K; i++, a += d)
+		bits[(a & mask) >> 6] |= (uint64_t) 1 << (a & 63);
+}
+
+static inline int
+bloom_test(const uint64_t *restrict bits, uint64_t mask, uint64_t h)
+{
+	uint64_t a = h >> 32, d = (h & 0xFFFFFFFF) | 1;
+	int i;
+
+	for (i = 0; i < BLOOM_K; i++, a += d)
+		if ((bits[(a & mask) >> 6] & ((uint64_t) 1 << (a & 63))) == 0)
+			return 0;
+	return 1;
+}
+
+BAT *
+BATbloom(BAT *b, BAT *s)
+{
+	BUN start, end, cnt, p, nwords;
+	const oid *cand, *candend;
+	int tpe;
+	const void *nil, *v;
+	int (*cmp)(const void *, const void *);
+	BATiter bi;
+	uint64_t *bits, mask;
+	BAT *bn;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	BATcheck(b, "BATbloom", NULL);
+	tpe = ATOMtype(b->ttype);
+	nil = ATOMnilptr(tpe);
+	cmp = ATOMcompare(tpe);
+	bi = bat_iterator(b);
+	CANDINIT(b, s, start, end, cnt, cand, candend);
+	cnt = cand ? (BUN) (candend - cand) : end - start;
+
+	for (nwords = 8; nwords * 64 < cnt * BLOOM_BITS; nwords <<= 1)
+		;
+	mask = (uint64_t) nwords * 64 - 1;
+	if ((bn = COLnew(0, TYPE_lng, nwords + 1, TRANSIENT)) == NULL)
+		return NULL;
+	*(lng *) Tloc(bn, 0) = tpe;
+	bits = (uint64_t *) Tloc(bn, 1);
+	memset(bits, 0, nwords * sizeof(uint64_t));
+	for (;;) {
+		if (cand) {
+			if (cand == candend)
+				break;
+			p = *cand++ - b->hseqbase;
+		} else {
+			if (start == end)
+				break;
+			p = start++;
+		}
+		v = BUNtail(bi, p);
+		if ((*cmp)(v, nil) != 0)
+			bloom_set(bits, mask, bloom_hash(tpe, v));
+	}
+	BATsetcount(bn, nwords + 1);
+	bn->tsorted = bn->trevsorted = false;
+	bn->tkey = false;
+	bn->tnil = false;
+	bn->tnonil = true;
+	ALGODEBUG fprintf(stderr, "#BATbloom(b=%s#" BUNFMT ",s=%s%s)=%s#" BUNFMT " (" LLFMT " usec)\n",
+			  BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "",
+			  BATgetId(bn), nwords * 64, GDKusec() - t0);
+	return bn;
+}
+
+BAT *
+BATbloomselect(BAT *b, BAT *s, BAT *bf)
+{
+	BUN start, end, cnt, p;
+	const oid *cand, *candend;
+	int tpe;
+	const void *nil, *v;
+	int (*cmp)(const void *, const void *);
+	BATiter bi;
+	const uint64_t *bits;
+	uint64_t mask;
+	oid o, *restrict dst;
+	BAT *bn;
+	lng t0 = 0;
+
+	ALGODEBUG t0 = GDKusec();
+
+	BATcheck(b, "BATbloomselect", NULL);
+	BATcheck(bf, "BATbloomselect", NULL);
+	tpe = ATOMtype(b->ttype);
+	if (bf->ttype != TYPE_lng || BATcount(bf) < 2 ||
+	    *(const lng *) Tloc(bf, 0) != tpe) {
+		GDKerror("BATbloomselect: filter does not match the type of b.\n");
+		return NULL;
+	}
+	nil = ATOMnilptr(tpe);
+	cmp = ATOMcompare(tpe);
+	bi = bat_iterator(b);
+	bits = (const uint64_t *) Tloc(bf, 1);
+	mask = (uint64_t) (BATcount(bf) - 1) * 64 - 1;
+	CANDINIT(b, s, start, end, cnt, cand, candend);
+	cnt = cand ? (BUN) (candend - cand) : end - start;
+
+	if ((bn = COLnew(0, TYPE_oid, cnt, TRANSIENT)) == NULL)
+		return NULL;
+	dst = (oid *) Tloc(bn, 0);
+	for (;;) {
+		if (cand) {
+			if (cand == candend)
+				break;
+			o = *cand++;
+			p = o - b->hseqbase;
+		} else {
+			if (start == end)
+				break;
+			p = start++;
+			o = p + b->hseqbase;
+		}
+		v = BUNtail(bi, p);
+		if ((*cmp)(v, nil) != 0 &&
+		    bloom_test(bits, mask, bloom_hash(tpe, v)))
+			*dst++ = o;
+	}
+	BATsetcount(bn, (BUN) (dst - (oid *) Tloc(bn, 0)));
+	bn->tsorted = true;
+	bn->trevsorted = BATcount(bn) <= 1;
+	bn->tkey = true;
+	bn->tnil = false;
+	bn->tnonil = true;
+	virtualize(bn);
+	ALGODEBUG fprintf(stderr, "#BATbloomselect(b=%s#" BUNFMT ",s=%s%s,bf=%s)=%s#" BUNFMT " (" LLFMT " usec)\n",
+			  BATgetId(b), BATcount(b),
+			  s ? BATgetId(s) : "NULL",
+			  s && BATtdense(s) ? "(dense)" : "",
+			  BATgetId(bf),
+			  BATgetId(bn), BATcount(bn), GDKusec() - t0);
+	return bn;
+}
+
 #define VALUE(s, x)	(s##vars ?					\
 			 s##vars + VarHeapVal(s##vals, (x), s##width) : \
 			 s##vals + ((x) * s##width))
@@ -252,16 +252,73 @@ static MT_Lock GDKstoppedLock MT_LOCK_INITIALIZER("GDKstoppedLock");
 
 size_t _MT_pagesize = 0;	/* variable holding page size */
 size_t _MT_npages = 0;		/* variable holding memory size in pages */
+size_t _MT_l2cachesize = 0;	/* variable holding the L2 cache size */
+size_t _MT_l3cachesize = 0;	/* variable holding the last level cache size */
+
+#define MT_L2CACHE_DEFAULT	((size_t) 256 << 10)
+#define MT_L3CACHE_DEFAULT	((size_t) 8 << 20)
 
 void
 MT_init(void)
 {
 #ifdef NATIVE_WIN32
+	MEMORYSTATUSEX memStatEx;
+
 	_MT_pagesize = 0x1000;
+	memStatEx.dwLength = sizeof(memStatEx);
+	if (GlobalMemoryStatusEx(&memStatEx))
+		_MT_npages = (size_t) (memStatEx.ullTotalPhys / _MT_pagesize);
 #else
+	long n;
+
 	_MT_pagesize = sysconf(_SC_PAGESIZE);
+#ifdef _SC_PHYS_PAGES
+	if ((n = sysconf(_SC_PHYS_PAGES)) > 0)
+		_MT_npages = (size_t) n;
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+	if ((n = sysconf(_SC_LEVEL2_CACHE_SIZE)) > 0)
+		_MT_l2cachesize = (size_t) n;
+#endif
+#ifdef _SC_LEVEL3_CACHE_SIZE
+	if ((n = sysconf(_SC_LEVEL3_CACHE_SIZE)) > 0)
+		_MT_l3cachesize = (size_t) n;
+#endif
+#endif
+#ifdef __linux__
+	/* inside a container the cgroup memory limit, not the physical
+	 * memory, is what we can use before the process is killed */
+	{
+		static const char *limits[] = {
+			"/sys/fs/cgroup/memory.max",			/* cgroup v2 */
+			"/sys/fs/cgroup/memory/memory.limit_in_bytes",	/* cgroup v1 */
+			NULL,
+		};
+		unsigned long long limit;
+		FILE *fp;
+		int i;
+
+		for (i = 0; limits[i]; i++) {
+			if ((fp = fopen(limits[i], "r")) == NULL)
+				continue;
+			/* "max" (v2) fails to parse and a huge number (v1)
+			 * exceeds physical memory: both mean no limit */
+			if (fscanf(fp, "%llu", &limit) == 1 &&
+			    limit / _MT_pagesize > 0 &&
+			    (_MT_npages == 0 || limit / _MT_pagesize < _MT_npages))
+				_MT_npages = (size_t) (limit / _MT_pagesize);
+			fclose(fp);
+			break;
+		}
+	}
 #endif
-	_MT_npages = 42;
+	/* fall back on a modest machine if the system does not tell */
+	if (_MT_npages == 0)
+		_MT_npages = ((size_t) 1 << 30) / _MT_pagesize;
+	if (_MT_l2cachesize == 0)
+		_MT_l2cachesize = MT_L2CACHE_DEFAULT;
+	if (_MT_l3cachesize < _MT_l2cachesize)
+		_MT_l3cachesize = _MT_l2cachesize > MT_L3CACHE_DEFAULT ? _MT_l2cachesize : MT_L3CACHE_DEFAULT;
 }
 
 /*
@@ -370,7 +427,9 @@ GDKinit(str dbpath)
 	GDK_mmap_minsize_persistent = MMAP_MINSIZE_PERSISTENT;
 	GDK_mmap_minsize_transient = 1024 * 1024 * 10; // 10 MB, have param here?
 	GDK_mmap_pagesize = MMAP_PAGESIZE;
-	GDK_mem_maxsize = GDK_VM_MAXSIZE;
+	/* stay well within the physical (or container) memory, so
+	 * concurrent queries spill instead of swapping */
+	GDK_mem_maxsize = (size_t) ((double) MT_npages() * (double) MT_pagesize() * 0.815);
 	GDK_vm_maxsize = GDK_VM_MAXSIZE;
 
 	GDKkey = COLnew(0, TYPE_str, 100, TRANSIENT);
@@ -603,6 +662,8 @@ GDKreset(int status, int exit)
 		GDK_vm_cursize = 0;
 		_MT_pagesize = 0;
 		_MT_npages = 0;
+		_MT_l2cachesize = 0;
+		_MT_l3cachesize = 0;
 
 		GDKnr_threads = 0;
 		GDKnrofthreads = 0;
@@ -1129,6 +1190,154 @@ THRhighwater(void)
 	return rc;
 }
 
+/*
+ * Morsel-driven execution.  A bulk operation over cnt rows is cut
+ * into morsels of a fixed number of rows, which the calling thread and
+ * its helpers pull from a shared counter until none are left, so an
+ * uneven cost per morsel does not leave any of them idle.  Helpers are
+ * only started for cores that have nothing else to do: the dataflow
+ * workers announce the instructions they run with GDKthreadbusy, and
+ * helpers count as busy while they run.
+ *
+ * The work function gets the number of the thread (0 for the caller)
+ * and must be idempotent per morsel: when a helper fails, the caller
+ * runs that morsel again, so that the error ends up in its own buffer.
+ */
+static volatile ATOMIC_TYPE GDKbusythreads = 0;
+#ifdef ATOMIC_LOCK
+static MT_Lock GDKbusyLock MT_LOCK_INITIALIZER("GDKbusyLock");
+static MT_Lock GDKmorselLock MT_LOCK_INITIALIZER("GDKmorselLock");
+#endif
+
+void
+GDKthreadbusy(int delta)
+{
+	if (delta > 0)
+		(void) ATOMIC_ADD(GDKbusythreads, delta, GDKbusyLock);
+	else if (delta < 0)
+		(void) ATOMIC_SUB(GDKbusythreads, -delta, GDKbusyLock);
+}
+
+/* claim up to n of the cores nobody is using */
+static int
+GDKclaimthreads(int n)
+{
+	ATOMIC_TYPE busy;
+
+	if (n <= 0)
+		return 0;
+	busy = ATOMIC_ADD(GDKbusythreads, n, GDKbusyLock);
+	if (busy + n > (ATOMIC_TYPE) GDKnr_threads) {
+		int excess = busy >= (ATOMIC_TYPE) GDKnr_threads ? n : (int) (busy + n - GDKnr_threads);
+
+		(void) ATOMIC_SUB(GDKbusythreads, excess, GDKbusyLock);
+		n -= excess;
+	}
+	return n;
+}
+
+typedef struct {
+	gdk_return (*work)(void *arg, int thr, BUN lo, BUN hi);
+	void *arg;
+	BUN cnt, size, nmorsels;
+	volatile ATOMIC_TYPE next;
+	volatile ATOMIC_TYPE stop;
+} morsel_dispenser;
+
+typedef struct {
+	morsel_dispenser *d;
+	int thr;
+	MT_Id tid;
+	BUN failed;		/* morsel that failed, or BUN_NONE */
+} morsel_task;
+
+static void
+morsel_run(morsel_task *t)
+{
+	morsel_dispenser *d = t->d;
+	BUN m, lo, hi;
+
+	while (!ATOMIC_GET(d->stop, GDKmorselLock) &&
+	       (m = (BUN) ATOMIC_INC(d->next, GDKmorselLock) - 1) < d->nmorsels) {
+		lo = m * d->size;
+		hi = lo + d->size < d->cnt ? lo + d->size : d->cnt;
+		if ((*d->work)(d->arg, t->thr, lo, hi) != GDK_SUCCEED) {
+			t->failed = m;
+			ATOMIC_SET(d->stop, 1, GDKmorselLock);
+			break;
+		}
+	}
+}
+
+static void
+morsel_helper(void *arg)
+{
+	morsel_task *t = arg;
+	Thread thr = THRnew("GDKmorsels");
+
+	if (thr)
+		GDKsetbuf(GDKzalloc(GDKMAXERRLEN));
+	morsel_run(t);
+	if (thr) {
+		GDKfree(GDKerrbuf);
+		GDKsetbuf(0);
+		THRdel(thr);
+	}
+	GDKthreadbusy(-1);
+}
+
+/* Run work over the rows [0,cnt) in morsels of size rows, using at
+ * most maxthreads threads including the caller */
+gdk_return
+GDKmorsels(BUN cnt, BUN size, int maxthreads,
+	   gdk_return (*work)(void *arg, int thr, BUN lo, BUN hi), void *arg)
+{
+	morsel_dispenser d;
+	morsel_task tasks[THREADS];
+	int i, nhelpers;
+	gdk_return ret = GDK_SUCCEED;
+
+	assert(size > 0);
+	d.work = work;
+	d.arg = arg;
+	d.cnt = cnt;
+	d.size = size;
+	d.nmorsels = (cnt + size - 1) / size;
+	d.next = 0;
+	d.stop = 0;
+	if (maxthreads > THREADS)
+		maxthreads = THREADS;
+	nhelpers = (int) MIN((BUN) maxthreads, d.nmorsels) - 1;
+	nhelpers = GDKclaimthreads(nhelpers);
+	for (i = 0; i <= nhelpers; i++) {
+		tasks[i].d = &d;
+		tasks[i].thr = i;
+		tasks[i].tid = 0;
+		tasks[i].failed = BUN_NONE;
+		if (i > 0 &&
+		    MT_create_thread(&tasks[i].tid, morsel_helper, &tasks[i], MT_THR_JOINABLE) < 0) {
+			/* the others will do its share */
+			tasks[i].tid = 0;
+			GDKthreadbusy(-1);
+		}
+	}
+	morsel_run(&tasks[0]);
+	for (i = 1; i <= nhelpers; i++)
+		if (tasks[i].tid)
+			MT_join_thread(tasks[i].tid);
+	for (i = 0; i <= nhelpers && ret == GDK_SUCCEED; i++) {
+		if (tasks[i].failed == BUN_NONE)
+			continue;
+		ret = GDK_FAIL;
+		if (i > 0) {
+			BUN lo = tasks[i].failed * size;
+
+			(void) (*work)(arg, 0, lo, lo + size < cnt ? lo + size : cnt);
+		}
+	}
+	return ret;
+}
+
 /*
  * I/O is organized per thread, because users may gain access through
  * the network.  The code below should be improved to gain speed.
@@ -1173,6 +1382,47 @@ THRgetdata(int n)
 	return d;
 }
 
+/*
+ * Each query runs with a memory budget, a share of GDK_mem_maxsize
+ * handed out by the MAL layer to every thread that works on it.
+ * Operators that build large intermediate structures (hash tables,
+ * sort runs) ask GDKmemoryavail() whether these fit, and otherwise
+ * fall back on a partitioned algorithm that spills to temporary
+ * heaps.  The budget is kept in a thread data slot; zero means the
+ * thread only has the global limit.
+ *
+ * A dataflow worker sets its budget around every instruction, so this
+ * does without GDKthreadLock: the entry holding the caller's id was
+ * claimed by the caller itself in THRnew and is not handed to another
+ * thread while the caller runs.
+ */
+void
+GDKsetmemorybudget(size_t budget)
+{
+	Thread s = GDK_find_thread(MT_getpid());
+
+	if (s)
+		s->data[THRmembudget] = (ptr) (uintptr_t) budget;
+}
+
+size_t
+GDKmemorybudget(void)
+{
+	return (size_t) (uintptr_t) THRgetdata(THRmembudget);
+}
+
+size_t
+GDKmemoryavail(void)
+{
+	size_t budget = GDKmemorybudget();
+	size_t used = GDKmem_cursize();
+	size_t avail = used < GDK_mem_maxsize ? GDK_mem_maxsize - used : 0;
+
+	if (budget > 0 && budget < avail)
+		avail = budget;
+	return avail;
+}
+
 int
 THRgettid(void)
 {
@@ -1282,9 +1532,12 @@ GDKextractParentAndLastDirFromPath(const char *path, char *last_dir_parent, char
 size_t
 GDKmem_cursize(void)
 {
-	/* RAM/swapmem that Monet is really using now */
-	//return (size_t) ATOMIC_GET(GDK_mallocedbytes_estimate, mbyteslock);
-	return 0;
+	/* RAM/swapmem that Monet is really using now; memory allocated
+	 * before a restart of the embedded server and freed after it
+	 * can make the estimate dip below zero */
+	ssize_t size = (ssize_t) ATOMIC_GET(GDK_mallocedbytes_estimate, mbyteslock);
+
+	return size > 0 ? (size_t) size : 0;
 }
 
 size_t
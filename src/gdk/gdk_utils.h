@@ -68,9 +68,13 @@ gdk_export gdk_return GDKsetenv(const char *name, const char *value);
 /* virtual memory defines */
 gdk_export size_t _MT_npages;
 gdk_export size_t _MT_pagesize;
+gdk_export size_t _MT_l2cachesize;
+gdk_export size_t _MT_l3cachesize;
 
 #define MT_pagesize()	_MT_pagesize
 #define MT_npages()	_MT_npages
+#define MT_l2cachesize()	_MT_l2cachesize
+#define MT_l3cachesize()	_MT_l3cachesize
 
 gdk_export void MT_init(void);	/*  init the package. */
 gdk_export int GDKinit(str dbpath);
@@ -84,6 +88,9 @@ gdk_export void GDKsetmallocsuccesscount(lng count);
  * takes care of this.
  */
 gdk_export int GDKnr_threads;
+gdk_export void GDKthreadbusy(int delta);
+gdk_export gdk_return GDKmorsels(BUN cnt, BUN size, int maxthreads,
+				 gdk_return (*work)(void *arg, int thr, BUN lo, BUN hi), void *arg);
 #ifndef HAVE_EMBEDDED
 __declspec(noreturn) gdk_export void GDKexit(int status)
 	__attribute__((__noreturn__));
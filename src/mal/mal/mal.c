@@ -12,6 +12,8 @@
 
 char 	monet_cwd[FILENAME_MAX] = { 0 };
 size_t 	monet_memory = 0;
+lng 	memorypool = 0;
+int 	memoryclaims = 0;
 char 	monet_characteristics[4096];
 int		mal_trace;		/* enable profile events on console */
 str     mal_session_uuid;   /* unique marker for the session */
@@ -149,6 +151,8 @@ void mserver_reset(int exit)
 
 	memset((char*) monet_cwd, 0, sizeof(monet_cwd));
 	monet_memory = 0;
+	memorypool = 0;
+	memoryclaims = 0;
 	memset((char*) monet_characteristics, 0, sizeof(monet_characteristics));
 	mal_trace = 0;
 	mal_namespace_reset();
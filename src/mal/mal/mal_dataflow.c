@@ -32,6 +32,11 @@
 #include "mal_interpreter.h"
 
 
+/* delay instructions that would push the concurrent memory claims
+ * beyond what the process may use */
+#define USE_MAL_ADMISSION
+#define DELAYUNIT 2		/* ms to wait before a delayed instruction is retried */
+
 #define DFLOWpending 0		/* runnable */
 #define DFLOWrunning 1		/* currently in progress */
 #define DFLOWwrapup  2		/* done! */
@@ -76,6 +81,7 @@ typedef struct DATAFLOW {
 	int *edges;         /* dependency graph */
 	MT_Lock flowlock;   /* lock to protect the above */
 	Queue *done;        /* instructions handled */
+	size_t membudget;   /* memory budget of the query */
 } *DataFlow, DataFlowRec;
 
 static struct worker {
@@ -108,6 +114,66 @@ mal_dataflow_reset(void)
 	exiting = 0;
 }
 
+/*
+ * Admission control.  A running instruction claims the memory
+ * footprint of its arguments from a pool sized after the memory the
+ * process may use.  An instruction that does not fit is put back in
+ * the queue until others have released their claims; when nothing
+ * else holds a claim it is always admitted, so we make progress.
+ * Operators that still do not fit their query's budget spill to disk
+ * themselves (see GDKmemoryavail).
+ */
+static MT_Lock admissionLock MT_LOCK_INITIALIZER("admissionLock");
+
+static lng
+getMemoryClaim(MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, int i, int flag)
+{
+	lng total = 0;
+	bat bid;
+	BAT *b;
+
+	(void) mb;
+	if (stk->stk[getArg(pci, i)].vtype != TYPE_bat)
+		return 0;
+	bid = stk->stk[getArg(pci, i)].val.bval;
+	if (is_bat_nil(bid) || (b = BBPquickdesc(bid < 0 ? -bid : bid, FALSE)) == NULL)
+		return 0;
+	if (flag && isVIEW(b))
+		return 0;
+	total += (lng) BATcount(b) << b->tshift;
+	if (b->tvheap)
+		total += (lng) b->tvheap->free;
+	return total > (lng) MEMORY_THRESHOLD ? (lng) MEMORY_THRESHOLD : total;
+}
+
+static int
+MALadmission(lng argclaim, lng hotclaim)
+{
+	if (argclaim == 0)
+		return 0;
+
+	MT_lock_set(&admissionLock);
+	if (memoryclaims < 0)
+		memoryclaims = 0;
+	if (memoryclaims == 0)
+		memorypool = (lng) MEMORY_THRESHOLD;
+	if (argclaim > 0) {
+		if (memoryclaims == 0 || memorypool > argclaim + hotclaim) {
+			memorypool -= argclaim + hotclaim;
+			memoryclaims++;
+			MT_lock_unset(&admissionLock);
+			return 0;
+		}
+		MT_lock_unset(&admissionLock);
+		return -1;
+	}
+	/* release memory claimed before */
+	memorypool -= argclaim + hotclaim;
+	memoryclaims--;
+	MT_lock_unset(&admissionLock);
+	return 0;
+}
+
 /*
  * Calculate the size of the dataflow dependency graph.
  */
@@ -388,7 +454,7 @@ DFLOWworker(void *T)
 		MT_lock_unset(&flow->flowlock);
 
 #ifdef USE_MAL_ADMISSION
-		if (MALrunningThreads() > 2 && MALadmission(fe->argclaim, fe->hotclaim)) {
+		if (MALadmission(fe->argclaim, fe->hotclaim)) {
 			// never block on deblockdataflow()
 			p= getInstrPtr(flow->mb,fe->pc);
 			if( p->fcn != (MALfcn) deblockdataflow){
@@ -401,7 +467,12 @@ DFLOWworker(void *T)
 			}
 		}
 #endif
+		/* while we run, GDKmorsels will not count on this core */
+		GDKthreadbusy(1);
+		GDKsetmemorybudget(flow->membudget);
 		error = runMALsequence(flow->cntxt, flow->mb, fe->pc, fe->pc + 1, flow->stk, 0, 0);
+		GDKsetmemorybudget(0);
+		GDKthreadbusy(-1);
 		PARDEBUG fprintf(stderr, "#executed pc= %d wrk= %d claim= " LLFMT "," LLFMT "," LLFMT " %s\n",
 						 fe->pc, id, fe->argclaim, fe->hotclaim, fe->maxclaim, error ? error : "");
 #ifdef USE_MAL_ADMISSION
@@ -669,9 +740,6 @@ DFLOWinitBlk(DataFlow flow, MalBlkPtr mb, int size)
 			fprintf(stderr, "\n");
 		}
 	}
-#ifdef USE_MAL_ADMISSION
-	memorypool = memoryclaims = 0;
-#endif
 	return MAL_SUCCEED;
 }
 
@@ -730,7 +798,7 @@ DFLOWscheduler(DataFlow flow, struct worker *w)
 				throw(MAL, "dataflow", "DFLOWscheduler(): getInstrPtr(flow->mb,fe[i].pc) returned NULL");
 			}
 			for (j = p->retc; j < p->argc; j++)
-				fe[i].argclaim = getMemoryClaim(fe[0].flow->mb, fe[0].flow->stk, p, j, FALSE);
+				fe[i].argclaim += getMemoryClaim(fe[0].flow->mb, fe[0].flow->stk, p, j, FALSE);
 #endif
 			q_enqueue(todo, flow->status + i);
 			flow->status[i].state = DFLOWrunning;
@@ -903,6 +971,7 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 	flow->mb = mb;
 	flow->stk = stk;
 	flow->error = 0;
+	flow->membudget = GDKmemorybudget();
 
 	/* keep real block count, exclude brackets */
 	flow->start = startpc + 1;
@@ -963,6 +1032,26 @@ runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stoppc, MalStkPtr st
 	return msg;
 }
 
+/*
+ * The number of instructions waiting for a worker, summed over all
+ * clients.  The optimizers use it as a hint of how busy the workers
+ * already are.
+ */
+int
+pendingMALdataflow(void)
+{
+	int n = 0;
+
+	MT_lock_set(&dataflowLock);
+	if (todo) {
+		MT_lock_set(&todo->l);
+		n = todo->last;
+		MT_lock_unset(&todo->l);
+	}
+	MT_lock_unset(&dataflowLock);
+	return n;
+}
+
 str
 deblockdataflow( Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 {
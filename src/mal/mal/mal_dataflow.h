@@ -16,5 +16,6 @@ mal_export str runMALdataflow(Client cntxt, MalBlkPtr mb, int startpc, int stopp
 mal_export str deblockdataflow(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
 mal_export void stopMALdataflow(void);
 mal_export void mal_dataflow_reset(void);
+mal_export int pendingMALdataflow(void);
 
 #endif /*  _MAL_DATAFLOW_H*/
@@ -286,6 +286,19 @@ prepareMALstack(MalBlkPtr mb, int size)
 	return stk;
 }
 
+/*
+ * Each query gets an equal share of the memory the process may use
+ * as its budget; it is passed on to the dataflow workers, and
+ * operators consult it to decide whether to spill to disk.
+ */
+static void
+setQueryMemoryBudget(void)
+{
+	int n = MCactiveClients() - 1;	/* don't count the admin */
+
+	GDKsetmemorybudget(GDK_mem_maxsize / (n > 1 ? n : 1));
+}
+
 str runMAL(Client cntxt, MalBlkPtr mb, MalBlkPtr mbcaller, MalStkPtr env)
 {
 	MalStkPtr stk = NULL;
@@ -294,6 +307,7 @@ str runMAL(Client cntxt, MalBlkPtr mb, MalBlkPtr mbcaller, MalStkPtr env)
 	str ret;
 	(void) mbcaller;
 
+	setQueryMemoryBudget();
 	/* Prepare a new interpreter call. This involves two steps, (1)
 	 * allocate the minimum amount of stack space needed, some slack
 	 * resources are included to permit code optimizers to add a few
@@ -401,6 +415,7 @@ callMAL(Client cntxt, MalBlkPtr mb, MalStkPtr *env, ValPtr argv[], char debug)
 	InstrPtr pci = getInstrPtr(mb, 0);
 
 	cntxt->lastcmd= time(0);
+	setQueryMemoryBudget();
 #ifdef DEBUG_CALLMAL
 	fprintf(stderr, "callMAL\n");
 	fprintInstruction(stderr, mb, 0, pci, LIST_MAL_ALL);
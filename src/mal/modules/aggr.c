@@ -871,3 +871,124 @@ AGGRsubquantilecand(bat *retval, const bat *bid, const bat *quantile, const bat
 					   0, TYPE_any, NULL, NULL, BATgroupquantile,
 					   quantile, "aggr.subquantile");
 }
+
+/* Floating point sums and averages that mitosis split up: each piece
+ * is summed into bins with (sub)sumbins, the optimizer packs those and
+ * merges them with (sub)binsum or (sub)binavg, see BATgroupsumbins. */
+static str
+AGGRbins(bat *retval, ValPtr ret, const bat *bid, const bat *gid, const bat *eid,
+		 int skip_nils, int abort_on_error, int tp, const char *malfunc)
+{
+	BAT *b, *g, *e, *bn;
+
+	b = BATdescriptor(*bid);
+	g = gid ? BATdescriptor(*gid) : NULL;
+	e = eid ? BATdescriptor(*eid) : NULL;
+	if (b == NULL || (gid != NULL && g == NULL) || (eid != NULL && e == NULL)) {
+		if (b)
+			BBPunfix(b->batCacheid);
+		if (g)
+			BBPunfix(g->batCacheid);
+		if (e)
+			BBPunfix(e->batCacheid);
+		throw(MAL, malfunc, SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+	}
+	if (tp == TYPE_lng)
+		bn = BATgroupsumbins(b, g, e, NULL, skip_nils, abort_on_error);
+	else if (tp == TYPE_void)
+		bn = BATgroupbinavg(b, g, e);
+	else
+		bn = BATgroupbinsum(b, g, e, tp, abort_on_error);
+	BBPunfix(b->batCacheid);
+	if (g)
+		BBPunfix(g->batCacheid);
+	if (e)
+		BBPunfix(e->batCacheid);
+	if (bn == NULL)
+		throw(MAL, malfunc, GDK_EXCEPTION);
+	if (ret) {
+		/* ungrouped merge: a single value */
+		assert(BATcount(bn) == 1);
+		VALinit(ret, bn->ttype, Tloc(bn, 0));
+		BBPunfix(bn->batCacheid);
+		return MAL_SUCCEED;
+	}
+	*retval = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str AGGRsumbins(bat *retval, const bat *bid);
+str
+AGGRsumbins(bat *retval, const bat *bid)
+{
+	return AGGRbins(retval, NULL, bid, NULL, NULL, 1, 1, TYPE_lng, "aggr.sumbins");
+}
+
+mal_export str AGGRsubsumbins(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubsumbins(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRbins(retval, NULL, bid, gid, eid, *skip_nils,
+					*abort_on_error, TYPE_lng, "aggr.subsumbins");
+}
+
+mal_export str AGGRbinsum_flt(flt *ret, const bat *bid);
+str
+AGGRbinsum_flt(flt *ret, const bat *bid)
+{
+	ValRecord v;
+	str msg = AGGRbins(NULL, &v, bid, NULL, NULL, 1, 1, TYPE_flt, "aggr.binsum");
+
+	if (msg == MAL_SUCCEED)
+		*ret = v.val.fval;
+	return msg;
+}
+
+mal_export str AGGRbinsum_dbl(dbl *ret, const bat *bid);
+str
+AGGRbinsum_dbl(dbl *ret, const bat *bid)
+{
+	ValRecord v;
+	str msg = AGGRbins(NULL, &v, bid, NULL, NULL, 1, 1, TYPE_dbl, "aggr.binsum");
+
+	if (msg == MAL_SUCCEED)
+		*ret = v.val.dval;
+	return msg;
+}
+
+mal_export str AGGRsubbinsum_flt(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubbinsum_flt(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRbins(retval, NULL, bid, gid, eid, *skip_nils,
+					*abort_on_error, TYPE_flt, "aggr.subbinsum");
+}
+
+mal_export str AGGRsubbinsum_dbl(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubbinsum_dbl(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRbins(retval, NULL, bid, gid, eid, *skip_nils,
+					*abort_on_error, TYPE_dbl, "aggr.subbinsum");
+}
+
+mal_export str AGGRbinavg(dbl *ret, const bat *bid);
+str
+AGGRbinavg(dbl *ret, const bat *bid)
+{
+	ValRecord v;
+	str msg = AGGRbins(NULL, &v, bid, NULL, NULL, 1, 0, TYPE_void, "aggr.binavg");
+
+	if (msg == MAL_SUCCEED)
+		*ret = v.val.dval;
+	return msg;
+}
+
+mal_export str AGGRsubbinavg(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error);
+str
+AGGRsubbinavg(bat *retval, const bat *bid, const bat *gid, const bat *eid, const bit *skip_nils, const bit *abort_on_error)
+{
+	return AGGRbins(retval, NULL, bid, gid, eid, *skip_nils,
+					*abort_on_error, TYPE_void, "aggr.subbinavg");
+}
@@ -300,6 +300,59 @@ ALGthetaselect1(bat *result, const bat *bid, const void *val, const char **op)
 	return ALGthetaselect2(result, bid, NULL, val, op);
 }
 
+str
+ALGbloom(bat *result, const bat *bid, const bat *sid)
+{
+	BAT *b, *s = NULL, *bn;
+
+	if ((b = BATdescriptor(*bid)) == NULL) {
+		throw(MAL, "algebra.bloom", SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+	}
+	if (sid && !is_bat_nil(*sid) && (s = BATdescriptor(*sid)) == NULL) {
+		BBPunfix(b->batCacheid);
+		throw(MAL, "algebra.bloom", SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATbloom(b, s);
+	BBPunfix(b->batCacheid);
+	if (s)
+		BBPunfix(s->batCacheid);
+	if (bn == NULL)
+		throw(MAL, "algebra.bloom", GDK_EXCEPTION);
+	*result = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+str
+ALGbloomselect(bat *result, const bat *bid, const bat *sid, const bat *fid)
+{
+	BAT *b, *s = NULL, *f, *bn;
+
+	if ((b = BATdescriptor(*bid)) == NULL) {
+		throw(MAL, "algebra.bloomselect", SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+	}
+	if (sid && !is_bat_nil(*sid) && (s = BATdescriptor(*sid)) == NULL) {
+		BBPunfix(b->batCacheid);
+		throw(MAL, "algebra.bloomselect", SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+	}
+	if ((f = BATdescriptor(*fid)) == NULL) {
+		BBPunfix(b->batCacheid);
+		if (s)
+			BBPunfix(s->batCacheid);
+		throw(MAL, "algebra.bloomselect", SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+	}
+	bn = BATbloomselect(b, s, f);
+	BBPunfix(b->batCacheid);
+	if (s)
+		BBPunfix(s->batCacheid);
+	BBPunfix(f->batCacheid);
+	if (bn == NULL)
+		throw(MAL, "algebra.bloomselect", GDK_EXCEPTION);
+	*result = bn->batCacheid;
+	BBPkeepref(bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
 str
 ALGselectNotNil(bat *result, const bat *bid)
 {
@@ -26,6 +26,8 @@ mal_export str ALGselect1(bat *result, const bat *bid, const void *low, const vo
 mal_export str ALGselect2(bat *result, const bat *bid, const bat *sid, const void *low, const void *high, const bit *li, const bit *hi, const bit *anti);
 mal_export str ALGthetaselect1(bat *result, const bat *bid, const void *val, const char **op);
 mal_export str ALGthetaselect2(bat *result, const bat *bid, const bat *sid, const void *val, const char **op);
+mal_export str ALGbloom(bat *result, const bat *bid, const bat *sid);
+mal_export str ALGbloomselect(bat *result, const bat *bid, const bat *sid, const bat *fid);
 
 mal_export str ALGjoin(bat *r1, bat *r2, const bat *l, const bat *r, const bat *sl, const bat *sr, const bit *nil_matches, const lng *estimate);
 mal_export str ALGleftjoin(bat *r1, bat *r2, const bat *l, const bat *r, const bat *sl, const bat *sr, const bit *nil_matches, const lng *estimate);
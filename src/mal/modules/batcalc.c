@@ -1347,3 +1347,120 @@ CMDifthen(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 	BBPkeepref(*ret = bn->batCacheid);
 	return MAL_SUCCEED;
 }
+
+/* Collect the arguments of a fused expression starting at argument
+ * first; if the program projects arguments, the candidate list
+ * precedes them */
+static str
+fuse_arguments(MalBlkPtr mb, MalStkPtr stk, InstrPtr pci, int first, const char *func,
+			   BAT ***bp, ValRecord **vp, int *nargsp, int *tpp, BAT **cp)
+{
+	const char *prog = *getArgReference_str(stk, pci, first - 1);
+	int i, nargs, tp = TYPE_any;
+	BAT **b, *c = NULL;
+	ValRecord *v;
+
+	if (strchr(prog, FUSE_PROJ) != NULL) {
+		if ((c = BATdescriptor(*getArgReference_bat(stk, pci, first))) == NULL)
+			throw(MAL, func, SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+		first++;
+	}
+	nargs = pci->argc - first;
+	b = GDKzalloc(nargs * sizeof(BAT *));
+	v = GDKzalloc(nargs * sizeof(ValRecord));
+	if (b == NULL || v == NULL) {
+		GDKfree(b);
+		GDKfree(v);
+		if (c)
+			BBPunfix(c->batCacheid);
+		throw(MAL, func, SQLSTATE(HY001) MAL_MALLOC_FAIL);
+	}
+	for (i = 0; i < nargs; i++) {
+		if (isaBatType(getArgType(mb, pci, i + first))) {
+			if ((b[i] = BATdescriptor(*getArgReference_bat(stk, pci, i + first))) == NULL) {
+				while (--i >= 0)
+					if (b[i])
+						BBPunfix(b[i]->batCacheid);
+				GDKfree(b);
+				GDKfree(v);
+				if (c)
+					BBPunfix(c->batCacheid);
+				throw(MAL, func, SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
+			}
+			if (tp == TYPE_any)
+				tp = b[i]->ttype;
+		} else {
+			v[i] = stk->stk[getArg(pci, i + first)];
+			if (tp == TYPE_any)
+				tp = v[i].vtype;
+		}
+	}
+	*bp = b;
+	*vp = v;
+	*nargsp = nargs;
+	*tpp = tp;
+	*cp = c;
+	return MAL_SUCCEED;
+}
+
+static void
+fuse_release(BAT **b, ValRecord *v, int nargs, BAT *c)
+{
+	int i;
+
+	for (i = 0; i < nargs; i++)
+		if (b[i])
+			BBPunfix(b[i]->batCacheid);
+	GDKfree(b);
+	GDKfree(v);
+	if (c)
+		BBPunfix(c->batCacheid);
+}
+
+mal_export str CMDbatFUSE(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
+
+str
+CMDbatFUSE(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	bat *ret = getArgReference_bat(stk, pci, 0);
+	const char *prog = *getArgReference_str(stk, pci, 1);
+	int nargs, tp;
+	BAT **b, *bn, *c;
+	ValRecord *v;
+	str msg;
+
+	(void) cntxt;
+
+	if ((msg = fuse_arguments(mb, stk, pci, 2, "batcalc.fuse", &b, &v, &nargs, &tp, &c)) != MAL_SUCCEED)
+		return msg;
+	bn = BATcalcfuse(prog, tp, b, v, nargs, c);
+	fuse_release(b, v, nargs, c);
+	if (bn == NULL)
+		return mythrow(MAL, "batcalc.fuse", OPERATION_FAILED);
+	BBPkeepref(*ret = bn->batCacheid);
+	return MAL_SUCCEED;
+}
+
+mal_export str CMDaggrFUSESUM(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci);
+
+str
+CMDaggrFUSESUM(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	ValPtr ret = &stk->stk[getArg(pci, 0)];
+	const char *prog = *getArgReference_str(stk, pci, 1);
+	int nargs, tp;
+	BAT **b, *c;
+	ValRecord *v;
+	gdk_return rc;
+	str msg;
+
+	(void) cntxt;
+
+	if ((msg = fuse_arguments(mb, stk, pci, 2, "aggr.fusesum", &b, &v, &nargs, &tp, &c)) != MAL_SUCCEED)
+		return msg;
+	rc = BATcalcfusesum(ret, prog, tp, b, v, nargs, c);
+	fuse_release(b, v, nargs, c);
+	if (rc != GDK_SUCCEED)
+		return mythrow(MAL, "aggr.fusesum", OPERATION_FAILED);
+	return MAL_SUCCEED;
+}
@@ -30,6 +30,32 @@
 #include "monetdb_config.h"
 #include "mat.h"
 
+/*
+ * Mitosis cuts a column into slices that are views on consecutive
+ * ranges of the same parent.  Packing such slices again only has to
+ * widen the view, instead of copying the whole column.
+ * Return a view on the parent covering both b and bb if bb directly
+ * follows b, or NULL.
+ */
+static BAT *
+MATpackview(BAT *b, BAT *bb)
+{
+	bat tp = VIEWtparent(b);
+	BAT *p;
+	BUN lo;
+
+	if (tp == 0 || b->ttype != bb->ttype ||
+	    bb->hseqbase != b->hseqbase + BATcount(b) ||
+	    (BATcount(bb) > 0 &&
+	     (VIEWtparent(bb) != tp || Tloc(bb, 0) != Tloc(b, BATcount(b)))) ||
+	    (p = BBP_cache(tp)) == NULL || p->batRestricted != BAT_READ)
+		return NULL;
+	lo = (BUN) (Tloc(b, 0) - Tloc(p, 0)) >> b->tshift;
+	if (b->hseqbase != p->hseqbase + lo)
+		return NULL;
+	return BATslice(p, lo, lo + BATcount(b) + BATcount(bb));
+}
+
 /*
  * The pack is an ordinary multi BAT insert. Oid synchronistion
  * between pieces should be ensured by the code generators.
@@ -67,6 +93,29 @@ MATpackInternal(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		return MAL_SUCCEED;
 	}
 
+	/* consecutive slices of one column become a view again */
+	bn = NULL;
+	for (i = 1; i < p->argc; i++) {
+		BAT *vn;
+
+		if (is_bat_nil(stk->stk[getArg(p,i)].val.bval) ||
+		    (b = BATdescriptor(stk->stk[getArg(p,i)].val.bval)) == NULL)
+			continue;
+		if (bn == NULL)
+			vn = VIEWtparent(b) ? BATslice(b, 0, BATcount(b)) : NULL;
+		else
+			vn = MATpackview(bn, b);
+		BBPunfix(b->batCacheid);
+		if (bn)
+			BBPunfix(bn->batCacheid);
+		if ((bn = vn) == NULL)
+			break;
+	}
+	if (bn) {
+		BBPkeepref(*ret = bn->batCacheid);
+		return MAL_SUCCEED;
+	}
+
 	bn = COLnew(0, tt, cap, TRANSIENT);
 	if (bn == NULL)
 		throw(MAL, "mat.pack", SQLSTATE(HY001) MAL_MALLOC_FAIL);
@@ -109,9 +158,17 @@ MATpackIncrement(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		throw(MAL, "mat.pack", SQLSTATE(HY002) RUNTIME_OBJECT_MISSING);
 
 	if ( getArgType(mb,p,2) == TYPE_int){
-		/* first step, estimate with some slack */
 		pieces = stk->stk[getArg(p,2)].val.ival;
-		bn = COLnew(b->hseqbase, ATOMtype(b->ttype), (BUN)(1.2 * BATcount(b) * pieces), TRANSIENT);
+		if (VIEWtparent(b) && (bn = BATslice(b, 0, BATcount(b))) != NULL) {
+			/* a slice, which may be widened by the next pieces */
+			bn->S.unused = (pieces-1);
+			BBPkeepref(*ret = bn->batCacheid);
+			BBPunfix(b->batCacheid);
+			return MAL_SUCCEED;
+		}
+		/* first step, estimate with some slack; dense pieces
+		 * that follow each other stay dense */
+		bn = COLnew(b->hseqbase, b->ttype == TYPE_void ? TYPE_void : ATOMtype(b->ttype), (BUN)(1.2 * BATcount(b) * pieces), TRANSIENT);
 		if (bn == NULL) {
 			BBPunfix(b->batCacheid);
 			throw(MAL, "mat.pack", SQLSTATE(HY001) MAL_MALLOC_FAIL);
@@ -139,7 +196,29 @@ MATpackIncrement(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	} else {
 		/* remaining steps */
 		bb = BATdescriptor(stk->stk[getArg(p,2)].val.ival);
-		if ( bb ){
+		if (bb && isVIEW(b)) {
+			/* the packed slices so far are a view */
+			if ((bn = MATpackview(b, bb)) == NULL) {
+				bn = COLnew(b->hseqbase, ATOMtype(b->ttype), (BUN) (1.2 * (BATcount(b) + BATcount(bb) * b->S.unused)), TRANSIENT);
+				if (bn == NULL) {
+					BBPunfix(bb->batCacheid);
+					BBPunfix(b->batCacheid);
+					throw(MAL, "mat.pack", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+				}
+				BATtseqbase(bn, b->tseqbase);
+				if (BATappend(bn, b, NULL, FALSE) != GDK_SUCCEED ||
+				    BATappend(bn, bb, NULL, FALSE) != GDK_SUCCEED) {
+					BBPunfix(bn->batCacheid);
+					BBPunfix(bb->batCacheid);
+					BBPunfix(b->batCacheid);
+					throw(MAL, "mat.pack", GDK_EXCEPTION);
+				}
+			}
+			bn->S.unused = b->S.unused;
+			BBPunfix(bb->batCacheid);
+			BBPunfix(b->batCacheid);
+			b = bn;
+		} else if ( bb ){
 			if (BATcount(b) == 0) {
 				BAThseqbase(b, bb->hseqbase);
 				BATtseqbase(b, bb->tseqbase);
@@ -240,9 +240,6 @@ static int LEAPDAYS[13] = {
 static int CUMDAYS[13] = {
 	0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365
 };
-static int CUMLEAPDAYS[13] = {
-	0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366
-};
 
 static date DATE_MAX, DATE_MIN;		/* often used dates; computed once */
 
@@ -312,10 +309,37 @@ todate(int day, int month, int year)
 	return n;
 }
 
+/* Month and day of the month indexed by the day of a year that
+ * starts on March 1st, so that the leap day is the last day of the
+ * year and the same table serves leap and non-leap years.  Filled in
+ * by MTIMEprelude. */
+static unsigned char DOY_MONTH[366], DOY_DAY[366];
+
+/* Convert a day number into the (internal, i.e. including year 0)
+ * year and the day in that year counted from March 1st.  This is the
+ * usual civil-from-days computation on 400-year eras of 146097 days;
+ * day 0 is January 1st of year 0, which is 60 days before March 1st
+ * of year 0 (a leap year).  Note that for January and February the
+ * returned year is one too low. */
+static inline int
+civilfromdays(date n, int *doy)
+{
+	int z = n - 60;
+	int era = (z >= 0 ? z : z - 146096) / 146097;
+	int doe = z - era * 146097;			/* [0, 146096] */
+	int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; /* [0, 399] */
+
+	*doy = doe - (365 * yoe + yoe / 4 - yoe / 100); /* [0, 365] */
+	return era * 400 + yoe;
+}
+
+/* HACK: hide year 0 */
+#define CIVIL_YEAR(y, doy)	((y) + (DOY_MONTH[doy] <= 2) - ((y) + (DOY_MONTH[doy] <= 2) <= 0))
+
 static void
 fromdate(date n, int *d, int *m, int *y)
 {
-	int day, month, year;
+	int doy, year;
 
 	if (date_isnil(n)) {
 		if (d)
@@ -326,55 +350,13 @@ fromdate(date n, int *d, int *m, int *y)
 			*y = int_nil;
 		return;
 	}
-	year = n / 365;
-	day = (n - year * 365) - leapyears(year >= 0 ? year - 1 : year);
-	if (n < 0) {
-		year--;
-		while (day >= 0) {
-			year++;
-			day -= YEARDAYS(year);
-		}
-		day = YEARDAYS(year) + day;
-	} else {
-		while (day < 0) {
-			year--;
-			day += YEARDAYS(year);
-		}
-	}
-	if (d == 0 && m == 0) {
-		if (y)
-			*y = (year <= 0) ? year - 1 : year;	/* HACK: hide year 0 */
-		return;
-	}
-
-	day++;
-	if (leapyear(year)) {
-		for (month = day / 31 == 0 ? 1 : day / 31; month <= 12; month++)
-			if (day > CUMLEAPDAYS[month - 1] && day <= CUMLEAPDAYS[month]) {
-				if (m)
-					*m = month;
-				if (d == 0)
-					return;
-				break;
-			}
-		day -= CUMLEAPDAYS[month - 1];
-	} else {
-		for (month = day / 31 == 0 ? 1 : day / 31; month <= 12; month++)
-			if (day > CUMDAYS[month - 1] && day <= CUMDAYS[month]) {
-				if (m)
-					*m = month;
-				if (d == 0)
-					return;
-				break;
-			}
-		day -= CUMDAYS[month - 1];
-	}
+	year = civilfromdays(n, &doy);
 	if (d)
-		*d = day;
+		*d = DOY_DAY[doy];
 	if (m)
-		*m = month;
+		*m = DOY_MONTH[doy];
 	if (y)
-		*y = (year <= 0) ? year - 1 : year;	/* HACK: hide year 0 */
+		*y = CIVIL_YEAR(year, doy);
 }
 
 static daytime
@@ -1398,7 +1380,7 @@ MTIMEprelude(void *ret)
 	const char *msg = NULL;
 	char *err;
 	ValRecord vr;
-	int ticks;
+	int ticks, doy;
 	union lng_tzone ltz;
 	rule RULE_MAR, RULE_OCT;
 	const char *s1 = "first sunday from end of march@02:00";
@@ -1423,6 +1405,12 @@ MTIMEprelude(void *ret)
 	MONTHS[0] = (str) str_nil;
 	DAYS[0] = (str) str_nil;
 	LEAPDAYS[0] = int_nil;
+	for (doy = 0; doy < 366; doy++) {
+		int mp = (5 * doy + 2) / 153;	/* months since March */
+
+		DOY_MONTH[doy] = (unsigned char) (mp < 10 ? mp + 3 : mp - 9);
+		DOY_DAY[doy] = (unsigned char) (doy - (153 * mp + 2) / 5 + 1);
+	}
 	DATE_MAX = todate(31, 12, YEAR_MAX);
 	DATE_MIN = todate(1, 1, YEAR_MIN);
 	tzone_local.dst = 0;
@@ -3195,93 +3183,139 @@ MTIMEmsec(lng *r)
 	return MAL_SUCCEED;
 }
 
-str
-MTIMEdate_extract_year_bulk(bat *ret, const bat *bid)
-{
-	BAT *b, *bn;
-	BUN i,n;
-	int *y;
-	const date *t;
+/*
+ * The bulk date extraction functions share one kernel.  It converts
+ * the day numbers with civilfromdays and looks the month and day up
+ * in the DOY tables, so the inner loops contain no data dependent
+ * branches apart from the nil check.  Large inputs are cut into
+ * pieces that are converted by separate threads.
+ */
+typedef enum {
+	EXTRACT_YEAR,
+	EXTRACT_QUARTER,
+	EXTRACT_MONTH,
+	EXTRACT_DAY,
+} date_field;
+
+/* minimum number of values per thread */
+#define EXTRACT_PIECE	((BUN) 1 << 18)
+
+typedef struct {
+	MT_Id tid;
+	const void *src;	/* date or timestamp values */
+	int *dst;
+	BUN cnt;
+	int tpe;		/* TYPE_date or TYPE_timestamp */
+	date_field fld;
+	BUN nils;
+} extract_task;
+
+#define EXTRACT_LOOP(TPE, GETDATE, EXPR)						\
+	do {															\
+		const TPE *restrict src = (const TPE *) t->src;			\
+		for (i = 0; i < t->cnt; i++) {								\
+			date n;												\
+			GETDATE;												\
+			if (date_isnil(n)) {									\
+				dst[i] = int_nil;									\
+				nils++;											\
+			} else {												\
+				int doy, year = civilfromdays(n, &doy);			\
+				(void) year;										\
+				dst[i] = (EXPR);									\
+			}														\
+		}															\
+	} while (0)
 
-	if ((b = BATdescriptor(*bid)) == NULL)
-		throw(MAL, "batmtime.year", SQLSTATE(HY005) "Cannot access column descriptor");
-	n = BATcount(b);
+#define EXTRACT_FIELD(TPE, GETDATE)										\
+	do {																\
+		switch (t->fld) {												\
+		case EXTRACT_YEAR:												\
+			EXTRACT_LOOP(TPE, GETDATE, CIVIL_YEAR(year, doy));			\
+			break;														\
+		case EXTRACT_QUARTER:											\
+			EXTRACT_LOOP(TPE, GETDATE, (DOY_MONTH[doy] + 2) / 3);		\
+			break;														\
+		case EXTRACT_MONTH:											\
+			EXTRACT_LOOP(TPE, GETDATE, DOY_MONTH[doy]);					\
+			break;														\
+		case EXTRACT_DAY:												\
+			EXTRACT_LOOP(TPE, GETDATE, DOY_DAY[doy]);					\
+			break;														\
+		}																\
+	} while (0)
 
-	bn = COLnew(b->hseqbase, TYPE_int, n, TRANSIENT);
-	if (bn == NULL) {
-		BBPunfix(b->batCacheid);
-		throw(MAL, "batmtime.year", SQLSTATE(HY001) MAL_MALLOC_FAIL);
-	}
-	bn->tnonil = 1;
-	bn->tnil = 0;
+static void
+date_extract_piece(void *arg)
+{
+	extract_task *t = arg;
+	int *restrict dst = t->dst;
+	BUN i, nils = 0;
 
-	t = (const date *) Tloc(b, 0);
-	y = (int *) Tloc(bn, 0);
-	for (i = 0; i < n; i++) {
-		if (date_isnil(*t)) {
-			*y = int_nil;
-			bn->tnil = 1;
-		} else {
-			MTIMEdate_extract_year(y, t);
-			if (is_int_nil(*y)) {
-				bn->tnil = 1;
-			}
-		}
-		y++;
-		t++;
+	if (t->tpe == TYPE_date) {
+		EXTRACT_FIELD(date, n = src[i]);
+	} else {
+		EXTRACT_FIELD(timestamp,
+			MTIMEtimestamp_extract_date(&n, &src[i], &tzone_local));
 	}
-
-	BATsetcount(bn, (BUN) (y - (int *) Tloc(bn, 0)));
-
-	bn->tnonil = !bn->tnil;
-	bn->tsorted = BATcount(bn) < 2;
-	bn->trevsorted = BATcount(bn) < 2;
-
-	BBPkeepref(*ret = bn->batCacheid);
-	BBPunfix(b->batCacheid);
-	return MAL_SUCCEED;
+	t->nils = nils;
 }
 
-str
-MTIMEdate_extract_quarter_bulk(bat *ret, const bat *bid)
+static str
+date_extract_bulk(bat *ret, const bat *bid, int tpe, date_field fld, const char *malfunc)
 {
 	BAT *b, *bn;
-	BUN i,n;
-	int *q;
-	const date *t;
+	BUN n, nils = 0, piece;
+	extract_task *tasks;
+	int i, nthreads = 1;
 
 	if ((b = BATdescriptor(*bid)) == NULL)
-		throw(MAL, "batmtime.quarter", "Cannot access descriptor");
+		throw(MAL, malfunc, SQLSTATE(HY005) "Cannot access column descriptor");
 	n = BATcount(b);
 
 	bn = COLnew(b->hseqbase, TYPE_int, n, TRANSIENT);
 	if (bn == NULL) {
 		BBPunfix(b->batCacheid);
-		throw(MAL, "batmtime.quarter", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+		throw(MAL, malfunc, SQLSTATE(HY001) MAL_MALLOC_FAIL);
 	}
-	bn->tnonil = 1;
-	bn->tnil = 0;
-
-	t = (const date *) Tloc(b, 0);
-	q = (int *) Tloc(bn, 0);
-	for (i = 0; i < n; i++) {
-		if (date_isnil(*t)) {
-			*q = int_nil;
-			bn->tnil = 1;
-		} else {
-			MTIMEdate_extract_quarter(q, t);
-			if (is_int_nil(*q)) {
-				bn->tnil = 1;
-			}
-		}
-		q++;
-		t++;
-	}
-	BATsetcount(bn, (BUN) (q - (int *) Tloc(bn, 0)));
-
-	bn->tnonil = !bn->tnil;
-	bn->tsorted = BATcount(bn) < 2;
-	bn->trevsorted = BATcount(bn) < 2;
+	if (GDKnr_threads > 1 && n >= 2 * EXTRACT_PIECE)
+		nthreads = n / EXTRACT_PIECE < (BUN) GDKnr_threads ? (int) (n / EXTRACT_PIECE) : GDKnr_threads;
+	tasks = GDKzalloc(nthreads * sizeof(extract_task));
+	if (tasks == NULL) {
+		BBPunfix(b->batCacheid);
+		BBPreclaim(bn);
+		throw(MAL, malfunc, SQLSTATE(HY001) MAL_MALLOC_FAIL);
+	}
+	piece = (n + nthreads - 1) / nthreads;
+	for (i = 0; i < nthreads; i++) {
+		BUN off = (BUN) i * piece;
+
+		tasks[i].src = Tloc(b, off);
+		tasks[i].dst = (int *) Tloc(bn, off);
+		tasks[i].cnt = off + piece > n ? n - off : piece;
+		tasks[i].tpe = tpe;
+		tasks[i].fld = fld;
+		if (i > 0 &&
+			MT_create_thread(&tasks[i].tid, date_extract_piece, &tasks[i], MT_THR_JOINABLE) < 0) {
+			/* do it ourselves */
+			tasks[i].tid = 0;
+			date_extract_piece(&tasks[i]);
+		}
+	}
+	date_extract_piece(&tasks[0]);
+	for (i = 0; i < nthreads; i++) {
+		if (tasks[i].tid)
+			MT_join_thread(tasks[i].tid);
+		nils += tasks[i].nils;
+	}
+	GDKfree(tasks);
+
+	BATsetcount(bn, n);
+	bn->tnil = nils > 0;
+	bn->tnonil = nils == 0;
+	/* the year is a monotonous function of the date */
+	bn->tsorted = n < 2 || (fld == EXTRACT_YEAR && tpe == TYPE_date && b->tsorted);
+	bn->trevsorted = n < 2 || (fld == EXTRACT_YEAR && tpe == TYPE_date && b->trevsorted);
 
 	BBPkeepref(*ret = bn->batCacheid);
 	BBPunfix(b->batCacheid);
@@ -3289,96 +3323,51 @@ MTIMEdate_extract_quarter_bulk(bat *ret, const bat *bid)
 }
 
 str
-MTIMEdate_extract_month_bulk(bat *ret, const bat *bid)
+MTIMEdate_extract_year_bulk(bat *ret, const bat *bid)
 {
-	BAT *b, *bn;
-	BUN i,n;
-	int *m;
-	const date *t;
-
-	if ((b = BATdescriptor(*bid)) == NULL)
-		throw(MAL, "batmtime.year", SQLSTATE(HY005) "Cannot access column descriptor");
-	n = BATcount(b);
-
-	bn = COLnew(b->hseqbase, TYPE_int, n, TRANSIENT);
-	if (bn == NULL) {
-		BBPunfix(b->batCacheid);
-		throw(MAL, "batmtime.month", SQLSTATE(HY001) MAL_MALLOC_FAIL);
-	}
-	bn->tnonil = 1;
-	bn->tnil = 0;
-
-	t = (const date *) Tloc(b, 0);
-	m = (int *) Tloc(bn, 0);
-	for (i = 0; i < n; i++) {
-		if (date_isnil(*t)) {
-			*m = int_nil;
-			bn->tnil = 1;
-		} else {
-			MTIMEdate_extract_month(m, t);
-			if (is_int_nil(*m)) {
-				bn->tnil = 1;
-			}
-		}
-		m++;
-		t++;
-	}
-	BATsetcount(bn, (BUN) (m - (int *) Tloc(bn, 0)));
+	return date_extract_bulk(ret, bid, TYPE_date, EXTRACT_YEAR, "batmtime.year");
+}
 
-	bn->tnonil = !bn->tnil;
-	bn->tsorted = BATcount(bn) < 2;
-	bn->trevsorted = BATcount(bn) < 2;
+str
+MTIMEdate_extract_quarter_bulk(bat *ret, const bat *bid)
+{
+	return date_extract_bulk(ret, bid, TYPE_date, EXTRACT_QUARTER, "batmtime.quarter");
+}
 
-	BBPkeepref(*ret = bn->batCacheid);
-	BBPunfix(b->batCacheid);
-	return MAL_SUCCEED;
+str
+MTIMEdate_extract_month_bulk(bat *ret, const bat *bid)
+{
+	return date_extract_bulk(ret, bid, TYPE_date, EXTRACT_MONTH, "batmtime.month");
 }
 
 str
 MTIMEdate_extract_day_bulk(bat *ret, const bat *bid)
 {
-	BAT *b, *bn;
-	BUN i,n;
-	int *d;
-	const date *t;
-
-	if ((b = BATdescriptor(*bid)) == NULL)
-		throw(MAL, "batmtime.day", SQLSTATE(HY005) "Cannot access column descriptor");
-	n = BATcount(b);
-
-	bn = COLnew(b->hseqbase, TYPE_int, n, TRANSIENT);
-	if (bn == NULL) {
-		BBPunfix(b->batCacheid);
-		throw(MAL, "batmtime.day", SQLSTATE(HY001) MAL_MALLOC_FAIL);
-	}
-	bn->tnonil = 1;
-	bn->tnil = 0;
+	return date_extract_bulk(ret, bid, TYPE_date, EXTRACT_DAY, "batmtime.day");
+}
 
-	t = (const date *) Tloc(b, 0);
-	d = (int *) Tloc(bn, 0);
-	for (i = 0; i < n; i++) {
-		if (date_isnil(*t)) {
-			*d = int_nil;
-			bn->tnil = 1;
-		} else {
-			MTIMEdate_extract_day(d, t);
-			if (is_int_nil(*d)) {
-				bn->tnil = 1;
-			}
-		}
-		d++;
-		t++;
-	}
+str
+MTIMEtimestamp_year_bulk(bat *ret, const bat *bid)
+{
+	return date_extract_bulk(ret, bid, TYPE_timestamp, EXTRACT_YEAR, "batmtime.year");
+}
 
-	BATsetcount(bn, (BUN) (d - (int *) Tloc(bn, 0)));
+str
+MTIMEtimestamp_quarter_bulk(bat *ret, const bat *bid)
+{
+	return date_extract_bulk(ret, bid, TYPE_timestamp, EXTRACT_QUARTER, "batmtime.quarter");
+}
 
-	bn->tnonil = !bn->tnil;
-	bn->tsorted = BATcount(bn) < 2;
-	bn->trevsorted = BATcount(bn) < 2;
+str
+MTIMEtimestamp_month_bulk(bat *ret, const bat *bid)
+{
+	return date_extract_bulk(ret, bid, TYPE_timestamp, EXTRACT_MONTH, "batmtime.month");
+}
 
-	BBPkeepref(*ret = bn->batCacheid);
-	BBPunfix(b->batCacheid);
-	return MAL_SUCCEED;
+str
+MTIMEtimestamp_day_bulk(bat *ret, const bat *bid)
+{
+	return date_extract_bulk(ret, bid, TYPE_timestamp, EXTRACT_DAY, "batmtime.day");
 }
 
 str
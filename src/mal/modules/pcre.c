@@ -577,6 +577,202 @@ PCRElikeselect5(bat *ret, const bat *bid, const bat *sid, const str *pat, const
 #define APPEND(b, o)	(((oid *) b->theap.base)[b->batCount++] = (o))
 #define VALUE(s, x)		(s##vars + VarHeapVal(s##vals, (x), s##width))
 
+/* minimum number of pattern/value combinations before we bother to
+ * start worker threads for the join */
+#define LIKEJOIN_PARALLEL_MIN	((BUN) 1 << 16)
+
+/* Note that STRlike does not (yet) interpret the escape character, so
+ * neither do the fast paths below: a pattern without any '%' or '_'
+ * is a plain string comparison and a pattern that consists of a
+ * literal followed by only '%' characters is a prefix comparison. */
+typedef enum {
+	LIKE_NIL,		/* nil pattern, never matches */
+	LIKE_GENERIC,		/* needs STRlike */
+	LIKE_EXACT,		/* no wildcards at all */
+	LIKE_PREFIX,		/* literal followed by '%'s */
+} likepat_kind;
+
+typedef struct {
+	const char *pat;	/* the pattern (value in r) */
+	likepat_kind kind;
+	size_t len;		/* length of the literal prefix */
+	oid *matches;		/* matching oids of l in ascending order */
+	BUN nmatches;
+	BUN maxmatches;
+} likepat;
+
+typedef struct {
+	MT_Id tid;
+	BAT *l;
+	BUN lstart, lend;
+	const oid *lcand, *lcandend;
+	likepat *pats;
+	BUN npats;
+	BUN first, step;	/* process pats[first], pats[first+step], ... */
+	int caseignore;
+	char esc;
+	bool usehash;		/* l has a hash table we can use */
+	bool failed;
+} likejoin_task;
+
+static void
+likepat_classify(likepat *p, int caseignore)
+{
+	const char *s;
+
+	p->kind = LIKE_GENERIC;
+	if (caseignore)
+		return;
+	for (s = p->pat; *s && *s != '%' && *s != '_'; s++)
+		;
+	p->len = (size_t) (s - p->pat);
+	if (*s == 0) {
+		p->kind = LIKE_EXACT;
+		return;
+	}
+	while (*s == '%')
+		s++;
+	if (*s == 0)
+		p->kind = LIKE_PREFIX;
+}
+
+static bool
+likejoin_incand(const likejoin_task *t, BUN pos)
+{
+	const oid *lo, *hi;
+	oid o;
+
+	if (pos < t->lstart || pos >= t->lend)
+		return false;
+	if (t->lcand == NULL)
+		return true;
+	o = (oid) pos + t->l->hseqbase;
+	lo = t->lcand;
+	hi = t->lcandend;
+	while (lo < hi) {
+		const oid *mid = lo + (hi - lo) / 2;
+		if (*mid == o)
+			return true;
+		if (*mid < o)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return false;
+}
+
+static gdk_return
+likepat_append(likepat *p, oid o)
+{
+	if (p->nmatches == p->maxmatches) {
+		BUN newmax = p->maxmatches ? p->maxmatches * 2 : 64;
+		oid *m = GDKrealloc(p->matches, newmax * sizeof(oid));
+
+		if (m == NULL)
+			return GDK_FAIL;
+		p->matches = m;
+		p->maxmatches = newmax;
+	}
+	p->matches[p->nmatches++] = o;
+	return GDK_SUCCEED;
+}
+
+/* collect the oids of all values in l that match pattern p */
+static gdk_return
+likepat_match(const likejoin_task *t, likepat *p)
+{
+	BAT *l = t->l;
+	const char *lvals = (const char *) Tloc(l, 0);
+	const char *lvars = l->tvheap->base;
+	int lwidth = l->twidth;
+	const oid *lcand = t->lcand;
+	const char *vl;
+	BUN n;
+	oid lo;
+	int match;
+
+	if (p->kind == LIKE_EXACT && t->usehash) {
+		BATiter li = bat_iterator(l);
+		BUN hb;
+
+		HASHloop_str(li, l->thash, hb, p->pat) {
+			if (likejoin_incand(t, hb) &&
+			    likepat_append(p, (oid) hb + l->hseqbase) != GDK_SUCCEED)
+				return GDK_FAIL;
+		}
+		if (p->nmatches > 1)
+			GDKqsort(p->matches, NULL, NULL, (size_t) p->nmatches,
+				 (int) sizeof(oid), 0, TYPE_oid);
+		return GDK_SUCCEED;
+	}
+	if (l->tsorted && p->kind != LIKE_GENERIC && p->len > 0) {
+		/* all values that start with the literal part of the
+		 * pattern are consecutive in a sorted column */
+		char *lit = GDKstrndup(p->pat, p->len);
+
+		if (lit == NULL)
+			return GDK_FAIL;
+		n = SORTfndfirst(l, lit);
+		GDKfree(lit);
+		for (; n < t->lend; n++) {
+			vl = VALUE(l, n);
+			if (strncmp(vl, p->pat, p->len) != 0 ||
+			    (p->kind == LIKE_EXACT && vl[p->len] != 0))
+				break;
+			if (likejoin_incand(t, n) &&
+			    likepat_append(p, (oid) n + l->hseqbase) != GDK_SUCCEED)
+				return GDK_FAIL;
+		}
+		return GDK_SUCCEED;
+	}
+
+	n = t->lstart;
+	for (;;) {
+		if (lcand) {
+			if (lcand == t->lcandend)
+				break;
+			lo = *lcand++;
+			vl = VALUE(l, lo - l->hseqbase);
+		} else {
+			if (n == t->lend)
+				break;
+			vl = VALUE(l, n);
+			lo = n++ + l->hseqbase;
+		}
+		if (strcmp(vl, str_nil) == 0)
+			continue;
+		switch (p->kind) {
+		case LIKE_EXACT:
+			match = strcmp(vl, p->pat) == 0;
+			break;
+		case LIKE_PREFIX:
+			match = strncmp(vl, p->pat, p->len) == 0;
+			break;
+		default:
+			match = STRlike(p->pat, vl, t->caseignore, t->esc);
+			break;
+		}
+		if (match && likepat_append(p, lo) != GDK_SUCCEED)
+			return GDK_FAIL;
+	}
+	return GDK_SUCCEED;
+}
+
+static void
+likejoin_worker(void *arg)
+{
+	likejoin_task *t = arg;
+	BUN g;
+
+	for (g = t->first; g < t->npats; g += t->step) {
+		if (t->pats[g].kind != LIKE_NIL &&
+		    likepat_match(t, &t->pats[g]) != GDK_SUCCEED) {
+			t->failed = true;
+			return;
+		}
+	}
+}
+
 static char *
 pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 			const char *esc, int caseignore)
@@ -585,16 +781,19 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 	const oid *lcand = NULL, *lcandend = NULL;
 	BUN rstart, rend, rcnt;
 	const oid *rcand = NULL, *rcandend = NULL;
-	const char *lvals, *rvals;
-	const char *lvars, *rvars;
-	int lwidth, rwidth;
-	const char *vl, *vr;
-	const oid *p;
+	const char *rvals;
+	const char *rvars;
+	int rwidth;
+	const oid *p, *grps, *exts;
 	oid lastl = 0;		/* last value inserted into r1 */
-	BUN n, nl;
-	BUN newcap;
+	BUN nl, k, npats, nexact = 0, total = 0;
 	oid lo, ro;
 	int rskipped = 0;	/* whether we skipped values in r */
+	int nthreads = 1, i;
+	bool usehash = false;
+	BAT *gn = NULL, *en = NULL;
+	likepat *pats = NULL;
+	likejoin_task *tasks = NULL;
 	char *msg = MAL_SUCCEED;
 
 	ALGODEBUG fprintf(stderr, "#pcrejoin(l=%s#" BUNFMT "[%s]%s%s,"
@@ -621,12 +820,9 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 	CANDINIT(l, sl, lstart, lend, lcnt, lcand, lcandend);
 	CANDINIT(r, sr, rstart, rend, rcnt, rcand, rcandend);
 
-	lvals = (const char *) Tloc(l, 0);
 	rvals = (const char *) Tloc(r, 0);
 	assert(r->tvarsized && r->ttype);
-	lvars = l->tvheap->base;
 	rvars = r->tvheap->base;
-	lwidth = l->twidth;
 	rwidth = r->twidth;
 
 	r1->tkey = 1;
@@ -636,57 +832,109 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 	r2->tsorted = 1;
 	r2->trevsorted = 1;
 
-	/* nested loop implementation for PCRE join */
-	for (;;) {
+	if (rcand ? rcand == rcandend : rstart == rend)
+		goto finish;
+
+	/* identical patterns only need to be evaluated once: group
+	 * the right hand side and work on the distinct patterns */
+	if (BATgroup(&gn, &en, NULL, r, sr, NULL, NULL, NULL) != GDK_SUCCEED) {
+		msg = createException(MAL, "pcre.join", OPERATION_FAILED);
+		goto bailout;
+	}
+	npats = BATcount(en);
+	grps = (const oid *) Tloc(gn, 0);
+	exts = (const oid *) Tloc(en, 0);
+	pats = GDKzalloc(npats * sizeof(likepat));
+	if (pats == NULL) {
+		msg = createException(MAL, "pcre.join", MAL_MALLOC_FAIL);
+		goto bailout;
+	}
+	for (k = 0; k < npats; k++) {
+		pats[k].pat = VALUE(r, exts[k] - r->hseqbase);
+		if (strcmp(pats[k].pat, str_nil) == 0) {
+			pats[k].kind = LIKE_NIL;
+			continue;
+		}
+		likepat_classify(&pats[k], caseignore);
+		nexact += pats[k].kind == LIKE_EXACT;
+	}
+	/* a hash on l pays off for repeated exact lookups on an
+	 * unsorted column; build it once, before any worker starts */
+	if (nexact > 1 && !l->tsorted) {
+		usehash = BAThash(l, 0) == GDK_SUCCEED;
+		if (!usehash)
+			GDKclrerr();	/* fall back to scanning */
+	}
+
+	/* when there are enough patterns, the combined work is spread
+	 * over a number of threads, each handling a subset of the
+	 * distinct patterns */
+	if (GDKnr_threads > 1 && npats > 1 &&
+	    npats * (lcand ? (BUN) (lcandend - lcand) : lend - lstart) >= LIKEJOIN_PARALLEL_MIN)
+		nthreads = npats < (BUN) GDKnr_threads ? (int) npats : GDKnr_threads;
+	tasks = GDKzalloc(nthreads * sizeof(likejoin_task));
+	if (tasks == NULL) {
+		msg = createException(MAL, "pcre.join", MAL_MALLOC_FAIL);
+		goto bailout;
+	}
+	for (i = 0; i < nthreads; i++) {
+		tasks[i].l = l;
+		tasks[i].lstart = lstart;
+		tasks[i].lend = lend;
+		tasks[i].lcand = lcand;
+		tasks[i].lcandend = lcandend;
+		tasks[i].pats = pats;
+		tasks[i].npats = npats;
+		tasks[i].first = (BUN) i;
+		tasks[i].step = (BUN) nthreads;
+		tasks[i].caseignore = caseignore;
+		tasks[i].esc = *esc;
+		tasks[i].usehash = usehash;
+	}
+	for (i = 1; i < nthreads; i++) {
+		if (MT_create_thread(&tasks[i].tid, likejoin_worker, &tasks[i], MT_THR_JOINABLE) < 0) {
+			/* do the work ourselves */
+			tasks[i].tid = 0;
+			likejoin_worker(&tasks[i]);
+		}
+	}
+	likejoin_worker(&tasks[0]);
+	for (i = 1; i < nthreads; i++) {
+		if (tasks[i].tid)
+			MT_join_thread(tasks[i].tid);
+	}
+	for (i = 0; i < nthreads; i++) {
+		if (tasks[i].failed) {
+			msg = createException(MAL, "pcre.join", MAL_MALLOC_FAIL);
+			goto bailout;
+		}
+	}
+
+	/* produce the result in the order of the right hand side */
+	for (k = 0; k < BATcount(gn); k++)
+		total += pats[grps[k]].nmatches;
+	if (total > BATcapacity(r1) &&
+		(BATextend(r1, total) != GDK_SUCCEED ||
+		 BATextend(r2, total) != GDK_SUCCEED)) {
+		msg = createException(MAL, "pcre.join", MAL_MALLOC_FAIL);
+		goto bailout;
+	}
+	for (k = 0; ; k++) {
+		likepat *pt;
 
 		if (rcand) {
 			if (rcand == rcandend)
 				break;
 			ro = *rcand++;
-			vr = VALUE(r, ro - r->hseqbase);
 		} else {
 			if (rstart == rend)
 				break;
-			vr = VALUE(r, rstart);
 			ro = rstart++ + r->hseqbase;
 		}
-		if (strcmp(vr, str_nil) == 0)
-			continue;
-		nl = 0;
-		p = lcand;
-		n = lstart;
-		for (;;) {
-			int retval;
-			if (lcand) {
-				if (p == lcandend)
-					break;
-				lo = *p++;
-				vl = VALUE(l, lo - l->hseqbase);
-			} else {
-				if (n == lend)
-					break;
-				vl = VALUE(l, n);
-				lo = n++ + l->hseqbase;
-			}
-			if (strcmp(vl, str_nil) == 0)
-				continue;
-
-
-			retval = STRlike(vr, vl, caseignore, *esc);
-			if (retval == 0) {
-				continue;
-			}
-			if (BUNlast(r1) == BATcapacity(r1)) {
-				newcap = BATgrows(r1);
-				BATsetcount(r1, BATcount(r1));
-				BATsetcount(r2, BATcount(r2));
-				if (BATextend(r1, newcap) != GDK_SUCCEED ||
-					BATextend(r2, newcap) != GDK_SUCCEED) {
-					msg = createException(MAL, "pcre.join", MAL_MALLOC_FAIL);
-					goto bailout;
-				}
-				assert(BATcapacity(r1) == BATcapacity(r2));
-			}
+		assert(k < BATcount(gn));
+		pt = &pats[grps[k]];
+		for (nl = 0, p = pt->matches; nl < pt->nmatches; nl++) {
+			lo = *p++;
 			if (BATcount(r1) > 0) {
 				if (lastl + 1 != lo)
 					r1->tdense = 0;
@@ -705,7 +953,6 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 			APPEND(r1, lo);
 			APPEND(r2, ro);
 			lastl = lo;
-			nl++;
 		}
 		if (nl > 1) {
 			r2->tkey = 0;
@@ -718,6 +965,7 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 		}
 	}
 	assert(BATcount(r1) == BATcount(r2));
+  finish:
 	/* also set other bits of heap to correct value to indicate size */
 	BATsetcount(r1, BATcount(r1));
 	BATsetcount(r2, BATcount(r2));
@@ -735,11 +983,19 @@ pcrejoin(BAT *r1, BAT *r2, BAT *l, BAT *r, BAT *sl, BAT *sr,
 					  BATgetId(r2), BATcount(r2),
 					  r2->tsorted ? "-sorted" : "",
 					  r2->trevsorted ? "-revsorted" : "");
-	return MAL_SUCCEED;
+	msg = MAL_SUCCEED;
 
   bailout:
-
-	assert(msg != MAL_SUCCEED);
+	if (pats) {
+		for (k = 0; k < BATcount(en); k++)
+			GDKfree(pats[k].matches);
+		GDKfree(pats);
+	}
+	GDKfree(tasks);
+	if (gn)
+		BBPunfix(gn->batCacheid);
+	if (en)
+		BBPunfix(en->batCacheid);
 	return msg;
 }
 
@@ -0,0 +1,331 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0.  If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Copyright 1997 - July 2008 CWI, August 2008 - 2018 MonetDB B.V.
+ */
+
+/*
+ * Arithmetic expressions are compiled into chains of batcalc calls,
+ * each of which materializes a full intermediate column.  This
+ * optimizer collapses a tree of such calls over a single numeric type
+ * into one batcalc.fuse call, whose postfix program is evaluated in
+ * cache-sized vectors.  A call is only folded into its consumer if its
+ * result is not used anywhere else.  Likewise, leaves produced by an
+ * algebra.projection over a common candidate list are gathered by the
+ * fused operator one vector at a time, so the projected columns between
+ * a select and the expression are never materialized.  If the only use
+ * of the expression is an ungrouped sum, the sum is folded in as well
+ * and aggr.fusesum never materializes the expression at all.  Both are
+ * evaluated morsel-driven by the idle cores.
+ */
+#include "monetdb_config.h"
+#include "opt_fuse.h"
+
+#define FUSE_MAXPROG 128
+
+typedef struct {
+	char prog[FUSE_MAXPROG];
+	int len;
+	int args[FUSE_MAXPROG];	/* leaves in program order */
+	int nargs;
+	int cand;				/* candidate list of the projected leaves */
+	int proj[FUSE_MAXPROG];	/* projections folded into the tree */
+	int nproj;
+} FuseTree;
+
+/* Return the operator code of a fusable batcalc instruction, or 0 */
+static char
+fuseOperator(InstrPtr p)
+{
+	const char *f = getFunctionId(p);
+
+	if (getModuleId(p) != batcalcRef || p->retc != 1 || p->argc != 3 || p->barrier)
+		return 0;
+	if (f == plusRef)
+		return '+';
+	if (f == minusRef)
+		return '-';
+	if (f == mulRef)
+		return '*';
+	if (f == eqRef)
+		return '=';
+	if (strcmp(f, "<") == 0)
+		return '<';
+	if (strcmp(f, "<=") == 0)
+		return 'l';
+	if (strcmp(f, ">") == 0)
+		return '>';
+	if (strcmp(f, ">=") == 0)
+		return 'g';
+	if (strcmp(f, "!=") == 0)
+		return '!';
+	return 0;
+}
+
+/* Return the operand type of a fusable instruction, or TYPE_any */
+static int
+fuseType(MalBlkPtr mb, InstrPtr p, char op)
+{
+	int tpe = getArgType(mb, p, 1), k;
+
+	if (isaBatType(tpe))
+		tpe = getBatType(tpe);
+	if (tpe != TYPE_int && tpe != TYPE_lng && tpe != TYPE_flt && tpe != TYPE_dbl)
+		return TYPE_any;
+	for (k = 1; k < 3; k++)
+		if (getArgType(mb, p, k) != tpe && getArgType(mb, p, k) != newBatType(tpe))
+			return TYPE_any;
+	if (getArgType(mb, p, 0) != newBatType(op == '+' || op == '-' || op == '*' ? tpe : TYPE_bit))
+		return TYPE_any;
+	return tpe;
+}
+
+/* Can the aggregate p consume the fused expression of type tpe */
+static int
+fuseSummable(MalBlkPtr mb, InstrPtr p, int tpe)
+{
+	if (p == NULL)
+		return 0;
+	switch (tpe) {
+	case TYPE_int:
+	case TYPE_lng:
+		return getArgType(mb, p, 0) == TYPE_lng;
+	case TYPE_dbl:
+		return getArgType(mb, p, 0) == TYPE_dbl;
+	default:
+		return 0;
+	}
+}
+
+/* Append the postfix program of the tree rooted at instruction i to
+ * t; returns the evaluation stack depth needed, or -1 if the program
+ * does not fit */
+static int
+fuseEmit(InstrPtr *old, int *used, int *defined, int *projected, int *consumer,
+		 char *ops, int i, int base, FuseTree *t)
+{
+	InstrPtr p = old[i];
+	int k, a, d, depth, maxdepth = 0;
+
+	for (k = 1; k < 3; k++) {
+		a = getArg(p, k);
+		d = defined[a];
+		if (d >= 0 && consumer[d] == i) {
+			depth = fuseEmit(old, used, defined, projected, consumer, ops, d, base + k - 1, t);
+			if (depth < 0)
+				return -1;
+		} else {
+			if (t->len >= FUSE_MAXPROG - 1)
+				return -1;
+			d = projected[a];
+			if (d >= 0 && used[a] == 1 && (t->cand < 0 || t->cand == getArg(old[d], 1))) {
+				t->cand = getArg(old[d], 1);
+				t->proj[t->nproj++] = d;
+				t->prog[t->len++] = FUSE_PROJ;
+				t->args[t->nargs++] = getArg(old[d], 2);
+			} else {
+				t->prog[t->len++] = FUSE_ARG;
+				t->args[t->nargs++] = a;
+			}
+			depth = base + k;
+		}
+		if (depth > maxdepth)
+			maxdepth = depth;
+	}
+	if (t->len >= FUSE_MAXPROG - 1)
+		return -1;
+	t->prog[t->len++] = ops[i];
+	return maxdepth;
+}
+
+/* Mark the instructions folded into the tree rooted at instruction i */
+static int
+fuseRemove(InstrPtr *old, int *defined, int *consumer, char *removed, int i)
+{
+	int k, d, cnt = 0;
+
+	for (k = 1; k < 3; k++) {
+		d = defined[getArg(old[i], k)];
+		if (d >= 0 && consumer[d] == i) {
+			removed[d] = 1;
+			cnt += 1 + fuseRemove(old, defined, consumer, removed, d);
+		}
+	}
+	return cnt;
+}
+
+str
+OPTfuseImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
+{
+	InstrPtr p, q, *old = mb->stmt, *fused = NULL;
+	int i, k, d, s, depth, limit = mb->stop, slimit = mb->ssize, actions = 0;
+	int *used = NULL, *defined = NULL, *projected = NULL, *summed = NULL, *consumer = NULL, *tpe = NULL;
+	char *ops = NULL, *removed = NULL;
+	FuseTree t;
+	char buf[256];
+	lng usec = GDKusec();
+	str msg = MAL_SUCCEED;
+
+	(void) stk;
+	(void) pci;
+
+	/* only straight-line plans are considered */
+	for (i = 0; i < limit; i++)
+		if (old[i]->barrier)
+			goto wrapup;
+
+	used = (int *) GDKzalloc(mb->vtop * sizeof(int));
+	defined = (int *) GDKmalloc(mb->vtop * sizeof(int));
+	projected = (int *) GDKmalloc(mb->vtop * sizeof(int));
+	summed = (int *) GDKmalloc(mb->vtop * sizeof(int));
+	consumer = (int *) GDKmalloc(limit * sizeof(int));
+	tpe = (int *) GDKzalloc(limit * sizeof(int));
+	ops = (char *) GDKzalloc(limit);
+	removed = (char *) GDKzalloc(limit);
+	fused = (InstrPtr *) GDKzalloc(limit * sizeof(InstrPtr));
+	if (used == NULL || defined == NULL || projected == NULL || summed == NULL || consumer == NULL || tpe == NULL ||
+		ops == NULL || removed == NULL || fused == NULL) {
+		msg = createException(MAL, "optimizer.fuse", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+		goto wrapup;
+	}
+
+	for (i = 0; i < mb->vtop; i++)
+		defined[i] = projected[i] = summed[i] = -1;
+	for (i = 0; i < limit; i++) {
+		p = old[i];
+		consumer[i] = -1;
+		for (k = p->retc; k < p->argc; k++)
+			used[getArg(p, k)]++;
+		if ((ops[i] = fuseOperator(p)) != 0 &&
+			(tpe[i] = fuseType(mb, p, ops[i])) != TYPE_any &&
+			(ops[i] == '+' || ops[i] == '-' || ops[i] == '*')) {
+			if (defined[getArg(p, 0)] != -1)
+				defined[getArg(p, 0)] = -2;	/* assigned more than once */
+			else
+				defined[getArg(p, 0)] = i;
+		}
+		if (tpe[i] == TYPE_any)
+			ops[i] = 0;
+		if (getModuleId(p) == algebraRef && getFunctionId(p) == projectionRef &&
+			p->retc == 1 && p->argc == 3 && !p->barrier &&
+			getArgType(mb, p, 1) == newBatType(TYPE_oid) &&
+			isaBatType(getArgType(mb, p, 2))) {
+			if (projected[getArg(p, 0)] != -1)
+				projected[getArg(p, 0)] = -2;
+			else
+				projected[getArg(p, 0)] = i;
+		}
+		if (getModuleId(p) == aggrRef && getFunctionId(p) == sumRef &&
+			p->retc == 1 && p->argc == 2 && !p->barrier)
+			summed[getArg(p, 1)] = i;
+	}
+
+	/* an arithmetic operation folds into its only consumer of the same type */
+	for (i = 0; i < limit; i++) {
+		if (ops[i] == 0)
+			continue;
+		for (k = 1; k < 3; k++) {
+			d = defined[getArg(old[i], k)];
+			if (d >= 0 && used[getArg(old[i], k)] == 1 && tpe[d] == tpe[i])
+				consumer[d] = i;
+		}
+	}
+
+	/* replace the roots of trees with at least two operations or a
+	 * projected leaf */
+	for (i = 0; i < limit; i++) {
+		if (ops[i] == 0 || consumer[i] >= 0)
+			continue;
+		t.len = t.nargs = t.nproj = 0;
+		t.cand = -1;
+		depth = fuseEmit(old, used, defined, projected, consumer, ops, i, 0, &t);
+		/* an expression only summed up is worth fusing by itself */
+		s = summed[getArg(old[i], 0)];
+		if (s < 0 || used[getArg(old[i], 0)] != 1 ||
+			(ops[i] != '+' && ops[i] != '-' && ops[i] != '*') ||
+			!fuseSummable(mb, old[s], tpe[i]))
+			s = -1;
+		if (depth < 0 || depth > FUSE_MAXDEPTH || (t.len == 3 && t.nproj == 0 && s < 0))
+			continue;
+		t.prog[t.len] = 0;
+		if (s >= 0) {
+			q = newInstruction(mb, aggrRef, fusesumRef);
+			if (q == NULL)
+				break;
+			getArg(q, 0) = getArg(old[s], 0);
+		} else {
+			q = newInstruction(mb, batcalcRef, fuseRef);
+			if (q == NULL)
+				break;
+			getArg(q, 0) = getArg(old[i], 0);
+		}
+		q = pushStr(mb, q, t.prog);
+		if (t.nproj > 0)
+			q = pushArgument(mb, q, t.cand);
+		for (k = 0; k < t.nargs; k++)
+			q = pushArgument(mb, q, t.args[k]);
+		typeChecker(cntxt->usermodule, mb, q, TRUE);
+		if (q->typechk == TYPE_UNKNOWN) {
+			freeInstruction(q);
+			continue;
+		}
+		if (s >= 0) {
+			fused[s] = q;
+			removed[i] = 1;
+			actions++;
+		} else
+			fused[i] = q;
+		actions += fuseRemove(old, defined, consumer, removed, i);
+		for (k = 0; k < t.nproj; k++)
+			removed[t.proj[k]] = 1;
+		actions += t.nproj;
+	}
+	if (actions == 0)
+		goto wrapup;
+
+	if (i < limit || newMalBlkStmt(mb, mb->ssize) < 0) {
+		msg = createException(MAL, "optimizer.fuse", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+		for (i = 0; i < limit; i++)
+			if (fused[i])
+				freeInstruction(fused[i]);
+		goto wrapup;
+	}
+	for (i = 0; i < limit; i++) {
+		if (removed[i]) {
+			freeInstruction(old[i]);
+		} else if (fused[i]) {
+			pushInstruction(mb, fused[i]);
+			freeInstruction(old[i]);
+		} else
+			pushInstruction(mb, old[i]);
+	}
+	for (; i < slimit; i++)
+		if (old[i])
+			freeInstruction(old[i]);
+	GDKfree(old);
+
+	/* Defense line against incorrect plans */
+	chkTypes(cntxt->usermodule, mb, FALSE);
+	chkFlow(mb);
+	chkDeclarations(mb);
+
+  wrapup:
+	GDKfree(used);
+	GDKfree(defined);
+	GDKfree(projected);
+	GDKfree(summed);
+	GDKfree(consumer);
+	GDKfree(tpe);
+	GDKfree(ops);
+	GDKfree(removed);
+	GDKfree(fused);
+	/* keep all actions taken as a post block comment */
+	usec = GDKusec() - usec;
+	snprintf(buf, 256, "%-20s actions=%2d time=" LLFMT " usec", "fuse", actions, usec);
+	newComment(mb, buf);
+	if (actions >= 0)
+		addtoMalBlkHistory(mb);
+	return msg;
+}
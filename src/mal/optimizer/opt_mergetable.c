@@ -987,6 +987,40 @@ aggr_phase2(char *aggr)
 	return aggr;
 }
 
+/* Floating point sums and averages are summed per partition into bins
+ * whose merge does not depend on the partitioning, see sumbins_add. */
+static int
+isFloatAggr(MalBlkPtr mb, InstrPtr p)
+{
+	int tp = getArgType(mb, p, p->retc);
+
+	return isaBatType(tp) &&
+		(getBatType(tp) == TYPE_flt || getBatType(tp) == TYPE_dbl);
+}
+
+static void
+mat_aggr_bins(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
+{
+	int k;
+	InstrPtr q, r, s;
+
+	r = newInstruction(mb, matRef, packRef);
+	getArg(r,0) = newTmpVariable(mb, newBatType(TYPE_lng));
+	for(k=1; k< mat[m].mi->argc; k++) {
+		q = newInstruction(mb, aggrRef, sumbinsRef);
+		getArg(q,0) = newTmpVariable(mb, newBatType(TYPE_lng));
+		q = pushArgument(mb,q,getArg(mat[m].mi,k));
+		pushInstruction(mb,q);
+		r = pushArgument(mb,r,getArg(q,0));
+	}
+	pushInstruction(mb,r);
+
+	s = newInstruction(mb, aggrRef, getFunctionId(p) == avgRef ? binavgRef : binsumRef);
+	getArg(s,0) = getArg(p,0);
+	s = pushArgument(mb, s, getArg(r,0));
+	pushInstruction(mb, s);
+}
+
 static void
 mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 {
@@ -995,6 +1029,11 @@ mat_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int m)
 	int isAvg = (getFunctionId(p) == avgRef);
 	InstrPtr r = NULL, s = NULL, q = NULL, u = NULL;
 
+	if ((getFunctionId(p) == sumRef || isAvg) && isFloatAggr(mb, p)) {
+		mat_aggr_bins(mb, p, mat, m);
+		return;
+	}
+
 	/* we pack the partitial result */
 	r = newInstruction(mb, matRef, packRef);
 	getArg(r,0) = newTmpVariable(mb, battp);
@@ -1170,6 +1209,43 @@ mat_group_project(MalBlkPtr mb, InstrPtr p, matlist_t *ml, int e, int a)
 	return 0;
 }
 
+static int
+mat_group_aggr_bins(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
+{
+	int k, tp = newBatType(TYPE_lng);
+	InstrPtr ai1 = newInstruction(mb, matRef, packRef), ai2;
+
+	if(!ai1)
+		return -1;
+	getArg(ai1,0) = newTmpVariable(mb, tp);
+
+	for(k=1; k<mat[b].mi->argc; k++) {
+		InstrPtr q = copyInstruction(p);
+		if(!q) {
+			freeInstruction(ai1);
+			return -1;
+		}
+		setFunctionId(q, subsumbinsRef);
+		getArg(q,0) = newTmpVariable(mb, tp);
+		getArg(q,1) = getArg(mat[b].mi,k);
+		getArg(q,2) = getArg(mat[g].mi,k);
+		getArg(q,3) = getArg(mat[e].mi,k);
+		pushInstruction(mb,q);
+		ai1 = pushArgument(mb,ai1,getArg(q,0));
+	}
+	pushInstruction(mb, ai1);
+
+	ai2 = newInstruction(mb, aggrRef, getFunctionId(p) == subavgRef ? subbinavgRef : subbinsumRef);
+	getArg(ai2,0) = getArg(p,0);
+	ai2 = pushArgument(mb, ai2, getArg(ai1, 0));
+	ai2 = pushArgument(mb, ai2, mat[g].mv);
+	ai2 = pushArgument(mb, ai2, mat[e].mv);
+	ai2 = pushArgument(mb, ai2, getArg(p,4)); /* skip nils */
+	ai2 = pushArgument(mb, ai2, getArg(p,5));
+	pushInstruction(mb, ai2);
+	return 0;
+}
+
 /* Per partition aggregates are merged and aggregated together. For 
  * most (handled) aggregates thats relatively simple. AVG is somewhat
  * more complex. */
@@ -1179,8 +1255,13 @@ mat_group_aggr(MalBlkPtr mb, InstrPtr p, mat_t *mat, int b, int g, int e)
 	int tp = getArgType(mb,p,0), k, tp2 = 0;
 	char *aggr2 = aggr_phase2(getFunctionId(p));
 	int isAvg = (getFunctionId(p) == subavgRef);
-	InstrPtr ai1 = newInstruction(mb, matRef, packRef), ai10 = NULL, ai2;
+	InstrPtr ai1, ai10 = NULL, ai2;
+
+	if ((getFunctionId(p) == subsumRef || isAvg) &&
+	    p->retc == 1 && p->argc == 6 && isFloatAggr(mb, p))
+		return mat_group_aggr_bins(mb, p, mat, b, g, e);
 
+	ai1 = newInstruction(mb, matRef, packRef);
 	if(!ai1)
 		return -1;
 
@@ -2176,6 +2257,27 @@ OPTmergetableImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr
 			continue;
 		}
 
+		/* Bloom filter select without candidates, each piece is
+		 * selected through the same filter */
+		if (match == 1 && fm == 1 && getModuleId(p) == algebraRef &&
+		    getFunctionId(p) == bloomselectRef && p->retc == 1 && p->argc == 4 &&
+		   (m=is_a_mat(getArg(p,fm), &ml)) >= 0 &&
+		    isVarConstant(mb,getArg(p,2)) &&
+		    (getArgType(mb,p,2) == TYPE_bat || isaBatType(getArgType(mb,p,2))) &&
+		    is_bat_nil(getVarConstant(mb,getArg(p,2)).val.bval)) {
+			if ((r = mat_apply1(mb, p, &ml, m, fm)) != NULL) {
+				if(mat_add(&ml, r, mat_type(ml.v, m), getFunctionId(p))) {
+					msg = createException(MAL,"optimizer.mergetable",SQLSTATE(HY001) MAL_MALLOC_FAIL);
+					goto cleanup;
+				}
+			} else {
+				msg = createException(MAL,"optimizer.mergetable",SQLSTATE(HY001) MAL_MALLOC_FAIL);
+				goto cleanup;
+			}
+			actions++;
+			continue;
+		}
+
 
 		if (match == 3 && bats == 3 && (isFragmentGroup(p) || isFragmentGroup2(p) || isMapOp(p)) &&  p->retc != 2 &&
 		   (m=is_a_mat(getArg(p,fm), &ml)) >= 0 &&
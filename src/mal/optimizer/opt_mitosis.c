@@ -9,6 +9,7 @@
 #include "monetdb_config.h"
 #include "opt_mitosis.h"
 #include "mal_interpreter.h"
+#include "mal_dataflow.h"
 #include "gdk_utils.h"
 
 static int
@@ -35,11 +36,11 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	int i, j, limit, slimit, estimate = 0, pieces = 1, mito_parts = 0, mito_size = 0, row_size = 0, mt = -1;
 	str schema = 0, table = 0;
 	BUN r = 0, rowcnt = 0;    /* table should be sizeable to consider parallel execution*/
+	BUN minrows, maxrows;
 	InstrPtr q, *old, target = 0;
-	size_t argsize = 6 * sizeof(lng), m = 0;
-	/*     per op:   6 = (2+1)*2   <=  2 args + 1 res, each with head & tail */
+	size_t argsize, m = 0, mem;
 	int threads = GDKnr_threads ? GDKnr_threads : 1;
-	int activeClients;
+	int activeClients, par;
 	char buf[256];
 	lng usec = GDKusec();
 	str msg = MAL_SUCCEED;
@@ -74,18 +75,9 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		    	getFunctionId(p) != prodRef)
 			return 0;
 
-		/* do not split up floating point bat that is being summed */
-		if (p->retc == 1 &&
-			(((p->argc == 6 || p->argc == 7) &&
-			  getModuleId(p) == aggrRef &&
-			  getFunctionId(p) == subsumRef) ||
-			 (p->argc == 4 &&
-			  getModuleId(p) == aggrRef &&
-			  getFunctionId(p) == sumRef)) &&
-			isaBatType(getArgType(mb, p, p->retc)) &&
-			(getBatType(getArgType(mb, p, p->retc)) == TYPE_flt ||
-			 getBatType(getArgType(mb, p, p->retc)) == TYPE_dbl))
-			return 0;
+		/* floating point sums and averages are split up as well:
+		 * mergetable sums the pieces into bins, which merge to the
+		 * same result however the input is split */
 
 		if (p->argc > 2 && (getModuleId(p) == capiRef || getModuleId(p) == rapiRef || getModuleId(p) == pyapiRef || getModuleId(p) == pyapi3Ref) && 
 		        getFunctionId(p) == subeval_aggrRef)
@@ -110,8 +102,6 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		 */
 		r = getRowCnt(mb, getArg(p, 0));
 		if (r >= rowcnt) {
-			/* the rowsize depends on the column types, assume void-headed */
-			row_size = ATOMsize(getBatType(getArgType(mb,p,0)));
 			rowcnt = r;
 			target = p;
 			estimate++;
@@ -120,38 +110,72 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	}
 	if (target == 0)
 		return 0;
+	/* the rowsize is the width of all columns of the target that the
+	 * plan reads, assuming void-headed bats; the update deltas are
+	 * small compared to the column itself */
+	schema = getVarConstant(mb, getArg(target, 2)).val.sval;
+	table = getVarConstant(mb, getArg(target, 3)).val.sval;
+	for (i = 1; i < mb->stop; i++) {
+		InstrPtr p = old[i];
+
+		if (getModuleId(p) != sqlRef || (getFunctionId(p) != bindRef && getFunctionId(p) != bindidxRef) ||
+			p->retc != 1 || p->argc != 6 ||
+			getVarConstant(mb, getArg(p, 5)).val.ival != 0 ||
+			strcmp(schema, getVarConstant(mb, getArg(p, 2)).val.sval) ||
+			strcmp(table, getVarConstant(mb, getArg(p, 3)).val.sval))
+			continue;
+		row_size += ATOMsize(getBatType(getArgType(mb, p, 0)));
+	}
+	if (row_size == 0)
+		row_size = ATOMsize(getBatType(getArgType(mb, target, 0)));
 	/*
 	 * The number of pieces should be based on the footprint of the
 	 * queryplan, such that preferrably it can be handled without
-	 * swapping intermediates.  For the time being we just go for pieces
-	 * that fit into memory in isolation.  A fictive rowcount is derived
-	 * based on argument types, such that all pieces would fit into
-	 * memory conveniently for processing. We attempt to use not more
-	 * threads than strictly needed.
-	 * Experience shows that the pieces should not be too small.
-	 * If we should limit to |threads| is still an open issue.
+	 * swapping intermediates.  Each operator reads about the columns of
+	 * a piece and produces intermediates of similar size, which gives a
+	 * fictive rowcount of pieces that fit into the available memory
+	 * together.
 	 *
-	 * Take into account the number of client connections, 
-	 * because all user together are responsible for resource contentions
+	 * Within that limit the pieces follow the parallelism at hand: the
+	 * threads divided over the active clients, and fewer still when
+	 * the dataflow queue already holds more work than the workers can
+	 * take.  Splitting beyond that only pays off once a piece no longer
+	 * fits its share of the last level cache, in which case the pieces
+	 * are made a multiple of the parallelism to keep all workers busy
+	 * until the end.  A piece that does not even fill the L2 cache is
+	 * mostly interpretation overhead.
 	 */
-	m = monet_memory / argsize;
-	/* if data exceeds memory size,
-	 * i.e., (rowcnt*argsize > monet_memory),
-	 * i.e., (rowcnt > monet_memory/argsize = m) */
 	assert(threads > 0);
 	assert(activeClients > 0);
+	argsize = 2 * (size_t) row_size + sizeof(oid);
+	mem = MIN(monet_memory, GDK_mem_maxsize);
+	if (GDKmem_cursize() < mem / 2)
+		mem -= GDKmem_cursize();
+	else
+		mem /= 2;
+	m = mem / argsize;
+	par = threads / (activeClients + pendingMALdataflow() / threads);
+	if (par < 1)
+		par = 1;
+	minrows = MAX((BUN) MINPARTCNT, (BUN) (MT_l2cachesize() / row_size));
+	maxrows = MAX(minrows, (BUN) (MT_l3cachesize() / par / row_size));
+
+	/* if data exceeds memory size,
+	 * i.e., (rowcnt*argsize > mem),
+	 * i.e., (rowcnt > mem/argsize = m) */
 	if (rowcnt > m && m / threads / activeClients > 0) {
 		/* create |pieces| > |threads| partitions such that
 		 * |threads| partitions at a time fit in memory,
 		 * i.e., (threads*(rowcnt/pieces) <= m),
 		 * i.e., (rowcnt/pieces <= m/threads),
-		 * i.e., (pieces => rowcnt/(m/threads))
-		 * (assuming that (m > threads*MINPARTCNT)) */
+		 * i.e., (pieces => rowcnt/(m/threads)) */
 		pieces = (int) (rowcnt / (m / threads / activeClients)) + 1;
-	} else if (rowcnt > MINPARTCNT) {
-	/* exploit parallelism, but ensure minimal partition size to
-	 * limit overhead */
-		pieces = (int) MIN(rowcnt / MINPARTCNT, (BUN) threads);
+	} else if (rowcnt > minrows) {
+		/* exploit parallelism, but ensure minimal partition size to
+		 * limit overhead */
+		pieces = (int) MIN(rowcnt / minrows, (BUN) par);
+		if (rowcnt / pieces > maxrows)
+			pieces = (int) ((rowcnt / maxrows + par) / par * par);
 	}
 	/* when testing, always aim for full parallelism, but avoid
 	 * empty pieces */
@@ -159,8 +183,8 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 	if (pieces < threads)
 		pieces = (int) MIN((BUN) threads, rowcnt);
 	/* prevent plan explosion */
-	if (pieces > MAXSLICES)
-		pieces = MAXSLICES;
+	if (pieces > MAX(MAXSLICES, 2 * threads))
+		pieces = MAX(MAXSLICES, 2 * threads);
 	/* to enable experimentation we introduce the option to set
 	 * the number of parts required and/or the size of each chunk (in K)
 	 */
@@ -174,7 +198,7 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 #ifdef DEBUG_OPT_MITOSIS
 	fprintf(stderr, "#opt_mitosis: target is %s.%s "
 							   " with " BUNFMT " rows of size %d into %"PRIu64""
-								" rows/piece %d threads %d pieces"
+								" rows in memory %d threads %d pieces"
 								" fixed parts %d fixed size %d\n",
 				 getVarConstant(mb, getArg(target, 2)).val.sval,
 				 getVarConstant(mb, getArg(target, 3)).val.sval,
@@ -189,8 +213,6 @@ OPTmitosisImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr p)
 		throw(MAL,"optimizer.mitosis", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 	estimate = 0;
 
-	schema = getVarConstant(mb, getArg(target, 2)).val.sval;
-	table = getVarConstant(mb, getArg(target, 3)).val.sval;
 	for (i = 0; i < limit; i++) {
 		int upd = 0, qtpe, rtpe = 0, qv, rv;
 		InstrPtr matq, matr = NULL;
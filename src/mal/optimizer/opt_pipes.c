@@ -80,6 +80,7 @@ static struct PIPELINES {
 	 "optimizer.commonTerms();"
 	 "optimizer.projectionpath();"
 	 "optimizer.deadcode();"
+	 "optimizer.fuse();"
 	 "optimizer.reorder();"
 //	 "optimizer.reduce();" deprecated
 	 "optimizer.matpack();"
@@ -116,6 +117,7 @@ static struct PIPELINES {
 	 "optimizer.commonTerms();"
 	 "optimizer.projectionpath();"
 	 "optimizer.deadcode();"
+	 "optimizer.fuse();"
 	 "optimizer.reorder();"
 //	 "optimizer.reduce();" deprecated
 	 "optimizer.matpack();"
@@ -158,6 +160,7 @@ static struct PIPELINES {
 	 "optimizer.constants();"
 	 "optimizer.commonTerms();"
 	 "optimizer.projectionpath();"
+	 "optimizer.fuse();"
 	 "optimizer.reorder();"
 	 "optimizer.deadcode();"
 //	 "optimizer.reduce();" deprecated
@@ -200,6 +203,7 @@ static struct PIPELINES {
 	 "optimizer.constants();"
 	 "optimizer.commonTerms();"
 	 "optimizer.projectionpath();"
+	 "optimizer.fuse();"
 	 "optimizer.reorder();"
 	 "optimizer.deadcode();"
 //	 "optimizer.reduce();" deprecated
@@ -517,7 +521,9 @@ addOptimizerPipe(Client cntxt, MalBlkPtr mb, const char *name)
 			}
 			for (k = 0; k < p->argc; k++)
 				getArg(p, k) = cloneVariable(mb, pipes[i].mb, getArg(p, k));
-			typeChecker(cntxt->usermodule, mb, p, FALSE);
+			/* the precompiled pipeline was resolved once, reuse its binding */
+			if (p->typechk != TYPE_RESOLVED || p->fcn == NULL)
+				typeChecker(cntxt->usermodule, mb, p, FALSE);
 			pushInstruction(mb, p);
 		}
 	}
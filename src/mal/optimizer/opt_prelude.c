@@ -60,10 +60,14 @@ str batxmlRef;
 str bbpRef;
 str betweenRef;
 str betweensymmetricRef;
+str binavgRef;
 str binddbatRef;
 str bindidxRef;
 str bindRef;
+str binsumRef;
 str blockRef;
+str bloomRef;
+str bloomselectRef;
 str bpmRef;
 str bstreamRef;
 str calcRef;
@@ -125,6 +129,8 @@ str export_tableRef;
 str findRef;
 str finishRef;
 str firstnRef;
+str fuseRef;
+str fusesumRef;
 str generatorRef;
 str getRef;
 str getTraceRef;
@@ -266,6 +272,8 @@ str stoptraceRef;
 str streamsRef;
 str strRef;
 str subavgRef;
+str subbinavgRef;
+str subbinsumRef;
 str subcountRef;
 str subdeltaRef;
 str subdiffRef;
@@ -279,8 +287,10 @@ str subminRef;
 str subprodRef;
 str subsliceRef;
 str subsumRef;
+str subsumbinsRef;
 str subuniformRef;
 str sumRef;
+str sumbinsRef;
 str takeRef;
 str thetajoinRef;
 str thetaselectRef;
@@ -345,6 +355,8 @@ void optimizerInit(void)
 	betweenRef = putName("between");
 	betweensymmetricRef = putName("betweensymmetric");
 	blockRef = putName("block");
+	bloomRef = putName("bloom");
+	bloomselectRef = putName("bloomselect");
 	bbpRef = putName("bbp");
 	tidRef = putName("tid");
 	deltaRef = putName("delta");
@@ -419,6 +431,8 @@ void optimizerInit(void)
 	firstnRef = putName("firstn");
 	getRef = putName("get");
 	getTraceRef = putName("getTrace");
+	fuseRef = putName("fuse");
+	fusesumRef = putName("fusesum");
 	generatorRef = putName("generator");
 	grantRef = putName("grant");
 	grant_rolesRef = putName("grant_roles");
@@ -566,6 +580,12 @@ void optimizerInit(void)
 	sumRef = putName("sum");
 	subsumRef = putName("subsum");
 	subavgRef = putName("subavg");
+	sumbinsRef = putName("sumbins");
+	subsumbinsRef = putName("subsumbins");
+	binsumRef = putName("binsum");
+	subbinsumRef = putName("subbinsum");
+	binavgRef = putName("binavg");
+	subbinavgRef = putName("subbinavg");
 	sortRef = putName("sort");
 	takeRef= putName("take");
 	transactionRef= putName("transaction");
@@ -58,10 +58,14 @@ mal_export  str batxmlRef;
 mal_export  str bbpRef;
 mal_export  str betweenRef;
 mal_export  str betweensymmetricRef;
+mal_export  str binavgRef;
 mal_export  str binddbatRef;
 mal_export  str bindidxRef;
 mal_export  str bindRef;
+mal_export  str binsumRef;
 mal_export  str blockRef;
+mal_export  str bloomRef;
+mal_export  str bloomselectRef;
 mal_export  str bpmRef;
 mal_export  str bstreamRef;
 mal_export  str calcRef;
@@ -123,6 +127,8 @@ mal_export  str export_tableRef;
 mal_export  str findRef;
 mal_export  str finishRef;
 mal_export  str firstnRef;
+mal_export  str fuseRef;
+mal_export  str fusesumRef;
 mal_export  str generatorRef;
 mal_export  str getRef;
 mal_export  str getTraceRef;
@@ -274,6 +280,8 @@ mal_export  str stoptraceRef;
 mal_export  str streamsRef;
 mal_export  str strRef;
 mal_export  str subavgRef;
+mal_export  str subbinavgRef;
+mal_export  str subbinsumRef;
 mal_export  str subcountRef;
 mal_export  str subdeltaRef;
 mal_export  str subdiffRef;
@@ -287,8 +295,10 @@ mal_export  str subminRef;
 mal_export  str subprodRef;
 mal_export  str subsliceRef;
 mal_export  str subsumRef;
+mal_export  str subsumbinsRef;
 mal_export  str subuniformRef;
 mal_export  str sumRef;
+mal_export  str sumbinsRef;
 mal_export  str takeRef;
 mal_export  str thetajoinRef;
 mal_export  str thetaselectRef;
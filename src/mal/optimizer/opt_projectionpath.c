@@ -166,7 +166,11 @@ OPTprojectionpathImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, Instr
 	InstrPtr q,r;
 	InstrPtr *old=0;
 	int *varcnt= 0;		/* use count */
-	int limit,slimit;
+	int *projcnt= 0;	/* use count as projected column */
+	InstrPtr *late= 0;	/* string fetches moved to their projection */
+	InstrPtr d;
+	int y = 0;
+	int limit,slimit,vlimit;
 	char buf[256];
 	lng usec = GDKusec();
 	str msg = MAL_SUCCEED;
@@ -189,9 +193,12 @@ OPTprojectionpathImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, Instr
 		throw(MAL,"optimizer.projectionpath", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 
 	/* beware, new variables and instructions are introduced */
+	vlimit = mb->vtop * 2;
 	pc= (int*) GDKzalloc(sizeof(int)* mb->vtop * 2); /* to find last assignment */
 	varcnt= (int*) GDKzalloc(sizeof(int)* mb->vtop * 2); 
-	if (pc == NULL || varcnt == NULL ){
+	projcnt= (int*) GDKzalloc(sizeof(int)* mb->vtop * 2); 
+	late= (InstrPtr*) GDKzalloc(sizeof(InstrPtr)* mb->vtop * 2); 
+	if (pc == NULL || varcnt == NULL || projcnt == NULL || late == NULL){
 		msg = createException(MAL,"optimizer.projectionpath", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 		goto wrapupall;
 	}
@@ -205,6 +212,8 @@ OPTprojectionpathImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, Instr
 		for(j=p->retc; j<p->argc; j++)
 		if( ! (getModuleId(p) == languageRef && getFunctionId(p)== passRef))
 			varcnt[getArg(p,j)]++;
+		if( getModuleId(p)== algebraRef && getFunctionId(p) == projectionRef && p->argc == 3)
+			projcnt[getArg(p,2)]++;
 	}
 
 	/* assume a single pass over the plan, and only consider projection sequences 
@@ -213,6 +222,38 @@ OPTprojectionpathImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, Instr
  	 */
 	for (i = 0; i<limit; i++){
 		p= old[i];
+		d = 0;
+		/*
+		 * A string column fetched for a candidate list, which is only
+		 * projected once, is fetched after that projection instead.
+		 * The candidate list is projected in its place, which folds into
+		 * the paths below that carry the oids through the joins, sorts
+		 * and selections, and only the surviving strings are fetched.
+		 */
+		if( getModuleId(p)== sqlRef && getFunctionId(p) == projectdeltaRef &&
+			p->retc == 1 && (p->argc == 5 || p->argc == 6) &&
+			ATOMvarsized(getBatType(getArgType(mb,p,0))) &&
+			varcnt[getArg(p,0)] == 1 && projcnt[getArg(p,0)] == 1){
+			late[getArg(p,0)] = p;
+			continue;
+		}
+		if( getModuleId(p)== algebraRef && getFunctionId(p) == projectionRef && p->argc == 3 &&
+			late[getArg(p,2)]){
+			d = late[getArg(p,2)];
+			late[getArg(p,2)] = 0;
+			if( mb->vtop >= vlimit){
+				/* no room for the oids, fetch the strings here */
+				pushInstruction(mb,d);
+				d = 0;
+			} else {
+				/* y := projection(x, s) becomes t := projection(x, cand)
+				 * followed by y := projectdelta(t, col, ...) */
+				y = getArg(p,0);
+				getArg(p,0) = newTmpVariable(mb, newBatType(TYPE_oid));
+				getArg(p,2) = getArg(d,1);
+				actions++;
+			}
+		}
 		if( getModuleId(p)== algebraRef && getFunctionId(p) == projectionRef && p->argc == 3){
 			/*
 			 * Try to expand its argument list with what we have found so far.
@@ -231,7 +272,13 @@ OPTprojectionpathImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, Instr
 					r = getInstrPtr(mb,pc[getArg(p,j)]);
 				else 
 					r = 0;
-				if (r && varcnt[getArg(p,j)] > 1 )
+				/* A shared intermediate is kept, unless it is a string
+				 * column only used to be projected further. Then each
+				 * use projects straight from the source column and the
+				 * strings are never materialized in between. */
+				if (r && varcnt[getArg(p,j)] > 1 &&
+					!(j == p->argc - 1 && projcnt[getArg(p,j)] == varcnt[getArg(p,j)] &&
+					  ATOMvarsized(getBatType(getArgType(mb,p,j)))))
 					r = 0;
 				
 				/* inject the complete sub-path */
@@ -290,6 +337,21 @@ OPTprojectionpathImplementation(Client cntxt, MalBlkPtr mb, MalStkPtr stk, Instr
 			fprintInstruction(stderr,mb, 0, p, LIST_MAL_ALL);
 #endif
 		}
+		if( d){
+			if((q = copyInstruction(d)) == NULL) {
+				freeInstruction(d);
+				msg = createException(MAL,"optimizer.projectionpath", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+				goto wrapupall;
+			}
+			freeInstruction(d);
+			getArg(q,0) = y;
+			getArg(q,1) = getArg(p,0);
+			/* it may move down once more */
+			if( varcnt[y] == 1 && projcnt[y] == 1)
+				late[y] = q;
+			else
+				pushInstruction(mb,q);
+		}
 	}
 #ifdef DEBUG_OPT_PROJECTIONPATH
 		fprintf(stderr,"#projection path prefixlength %d\n",maxprefixlength);
@@ -337,6 +399,8 @@ wrapupall:
 		addtoMalBlkHistory(mb);
 	if (pc ) GDKfree(pc);
 	if (varcnt ) GDKfree(varcnt);
+	if (projcnt ) GDKfree(projcnt);
+	if (late ) GDKfree(late);
 	if(old) GDKfree(old);
 
 	return msg;
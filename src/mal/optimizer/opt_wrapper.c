@@ -31,6 +31,7 @@
 #include "opt_emptybind.h"
 #include "opt_evaluate.h"
 #include "opt_garbageCollector.h"
+#include "opt_fuse.h"
 #include "opt_generator.h"
 #include "opt_inline.h"
 #include "opt_projectionpath.h"
@@ -60,6 +61,7 @@ struct{
 	{"emptybind", &OPTemptybindImplementation,0,0},
 	{"evaluate", &OPTevaluateImplementation,0,0},
 	{"garbageCollector", &OPTgarbageCollectorImplementation,0,0},
+	{"fuse", &OPTfuseImplementation,0,0},
 	{"generator", &OPTgeneratorImplementation,0,0},
 	{"inline", &OPTinlineImplementation,0,0},
 	{"matpack", &OPTmatpackImplementation,0,0},
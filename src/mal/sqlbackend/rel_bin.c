@@ -1707,6 +1707,7 @@ rel2bin_join(backend *be, sql_rel *rel, list *refs)
 	node *en = NULL, *n;
 	stmt *left = NULL, *right = NULL, *join = NULL, *jl, *jr;
 	stmt *ld = NULL, *rd = NULL;
+	prop *bloom;
 	int need_left = (rel->flag == LEFT_JOIN);
 
 	if (rel->l) /* first construct the left sub relation */
@@ -1827,8 +1828,36 @@ rel2bin_join(backend *be, sql_rel *rel, list *refs)
 		stmt *r = bin_first_column(be, right);
 		join = stmt_join(be, l, r, 0, cmp_all); 
 	}
-	jl = stmt_result(be, join, 0);
-	jr = stmt_result(be, join, 1);
+	if (rel->op == op_join && !en && list_length(rel->exps) == 1 &&
+	    join->type == st_join && join->flag == cmp_equal &&
+	    (bloom = find_prop(((sql_exp *) rel->exps->h->data)->p, PROP_BLOOM)) != NULL) {
+		/* only join the fact rows that pass the filter of the
+		 * dimension keys */
+		int fact_left = rel_find_exp(rel->l, bloom->value) != NULL;
+		stmt *fact = fact_left ? join->op1 : join->op2;
+		stmt *dim = fact_left ? join->op2 : join->op1;
+		stmt *cand = stmt_bloomselect(be, fact, dim);
+
+		if (!cand || !(fact = stmt_project(be, cand, fact)))
+			return NULL;
+		if (fact_left)
+			join = stmt_join(be, fact, dim, 0, cmp_equal);
+		else
+			join = stmt_join(be, dim, fact, 0, cmp_equal);
+		if (!join)
+			return NULL;
+		jl = stmt_result(be, join, 0);
+		jr = stmt_result(be, join, 1);
+		if (fact_left)
+			jl = stmt_project(be, jl, cand);
+		else
+			jr = stmt_project(be, jr, cand);
+		if (!jl || !jr)
+			return NULL;
+	} else {
+		jl = stmt_result(be, join, 0);
+		jr = stmt_result(be, join, 1);
+	}
 	if (en) {
 		stmt *sub, *sel = NULL;
 		list *nl;
@@ -147,6 +147,16 @@ sqlcleanup(mvc *c, int err)
 			sql_trans_begin(c->session);
 		}
 		store_unlock();
+		/* the load is only done once its log records are on disk.
+		 * As in mvc_commit the sync comes after the store lock is
+		 * released, but here that exposes nothing: the logger
+		 * restart in store_apply_deltas already synced the log
+		 * while the lock was held.  This covers a failed restart. */
+		if (!err && store_sync_log() != LOG_OK) {
+			char *msg = sql_message(SQLSTATE(40000) "COMMIT: transaction commit failed (perhaps your disk is full?) exiting (kernel error: %s)", GDKerrbuf);
+			GDKfatal("%s", msg);
+			_DELETE(msg);
+		}
 		c->emod = 0;
 	}
 	/* some statements dynamically disable caching */
@@ -1686,58 +1696,43 @@ DELTAproject(bat *result, const bat *sub, const bat *col, const bat *uid, const
 	}
 
 	if (BATcount(u_val)) {
-		BAT *o, *nu_id, *nu_val;
-		/* create subsets of u_id and u_val where the tail
-		 * values of u_id are also in s, and where those tail
-		 * values occur as head value in res */
-		if (BATsemijoin(&o, NULL, u_id, s, NULL, NULL, 0, BUN_NONE) != GDK_SUCCEED) {
+		BAT *o, *p, *nu_val;
+		/* find the positions in s of the updated row ids and
+		 * the positions of their new values in u_val; s need
+		 * not be dense nor sorted, and may hold a row id more
+		 * than once */
+		if (BATjoin(&p, &o, s, u_id, NULL, NULL, 0, BUN_NONE) != GDK_SUCCEED) {
 			BBPunfix(s->batCacheid);
 			BBPunfix(res->batCacheid);
 			BBPunfix(u_id->batCacheid);
 			BBPunfix(u_val->batCacheid);
 			throw(MAL, "sql.delta", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 		}
-		nu_id = BATproject(o, u_id);
 		nu_val = BATproject(o, u_val);
-		BBPunfix(u_id->batCacheid);
-		BBPunfix(u_val->batCacheid);
 		BBPunfix(o->batCacheid);
-		tres = BATdense(res->hseqbase, res->hseqbase, BATcount(res));
-		if (nu_id == NULL ||
-		    nu_val == NULL ||
-		    tres == NULL ||
-		    BATsemijoin(&o, NULL, nu_id, tres, NULL, NULL, 0, BUN_NONE) != GDK_SUCCEED) {
+		if (nu_val == NULL) {
 			BBPunfix(s->batCacheid);
 			BBPunfix(res->batCacheid);
-			BBPreclaim(nu_id);
-			BBPreclaim(nu_val);
-			BBPreclaim(tres);
-			throw(MAL, "sql.delta", SQLSTATE(HY001) MAL_MALLOC_FAIL);
-		}
-		BBPunfix(tres->batCacheid);
-		u_id = BATproject(o, nu_id);
-		u_val = BATproject(o, nu_val);
-		BBPunfix(nu_id->batCacheid);
-		BBPunfix(nu_val->batCacheid);
-		BBPunfix(o->batCacheid);
-		if (u_id == NULL || u_val == NULL) {
-			BBPunfix(s->batCacheid);
-			BBPunfix(res->batCacheid);
-			BBPreclaim(u_id);
-			BBPreclaim(u_val);
+			BBPunfix(u_id->batCacheid);
+			BBPunfix(u_val->batCacheid);
+			BBPunfix(p->batCacheid);
 			throw(MAL, "sql.delta", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 		}
-		/* now update res with the subset of u_id and u_val we
-		 * calculated */
+		/* now update res at those positions, the head of res
+		 * is the head of s */
 		if ((res = setwritable(res)) == NULL ||
-		    BATreplace(res, u_id, u_val, 0) != GDK_SUCCEED) {
+		    BATreplace(res, p, nu_val, 0) != GDK_SUCCEED) {
 			if (res)
 				BBPunfix(res->batCacheid);
 			BBPunfix(s->batCacheid);
 			BBPunfix(u_id->batCacheid);
 			BBPunfix(u_val->batCacheid);
+			BBPunfix(p->batCacheid);
+			BBPunfix(nu_val->batCacheid);
 			throw(MAL, "sql.delta", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 		}
+		BBPunfix(p->batCacheid);
+		BBPunfix(nu_val->batCacheid);
 	}
 	BBPunfix(s->batCacheid);
 	BBPunfix(u_id->batCacheid);
@@ -38,6 +38,9 @@
 #include "opt_prelude.h"
 #include "opt_pipes.h"
 #include "opt_mitosis.h"
+#ifdef HAVE_EMBEDDED
+#include "embedded.h"
+#endif
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
@@ -387,10 +390,6 @@ SQLtrans(mvc *m)
 	}
 }
 
-#ifdef HAVE_EMBEDDED
-extern char* createdb_inline;
-#endif
-
 str
 SQLinitClient(Client c)
 {
@@ -516,20 +515,28 @@ SQLinitClient(Client c)
 		SQLnewcatalog = 0;
 		maybeupgrade = 0;
 		{
-			size_t createdb_len = strlen(createdb_inline);
+			char* createdb_inline = embedded_createdb_script();
+			size_t createdb_len;
 			buffer* createdb_buf;
 			stream* createdb_stream;
 			bstream* createdb_bstream;
-			if ((createdb_buf = GDKmalloc(sizeof(buffer))) == NULL)
+			if (createdb_inline == NULL)
+				throw(MAL, "createdb", SQLSTATE(42000) "Could not load inlined createdb script");
+			createdb_len = strlen(createdb_inline);
+			if ((createdb_buf = GDKmalloc(sizeof(buffer))) == NULL) {
+				GDKfree(createdb_inline);
 				throw(MAL, "createdb", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+			}
 			buffer_init(createdb_buf, createdb_inline, createdb_len);
 			if ((createdb_stream = buffer_rastream(createdb_buf, "createdb.sql")) == NULL) {
 				GDKfree(createdb_buf);
+				GDKfree(createdb_inline);
 				throw(MAL, "createdb", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 			}
 			if ((createdb_bstream = bstream_create(createdb_stream, createdb_len)) == NULL) {
 				mnstr_destroy(createdb_stream);
 				GDKfree(createdb_buf);
+				GDKfree(createdb_inline);
 				throw(MAL, "createdb", SQLSTATE(HY001) MAL_MALLOC_FAIL);
 			}
 			if (bstream_next(createdb_bstream) >= 0)
@@ -543,6 +550,7 @@ SQLinitClient(Client c)
 			m->sa = NULL;
 			m->sqs = NULL;
 			GDKfree(createdb_buf);
+			GDKfree(createdb_inline);
 		}
 
 #else
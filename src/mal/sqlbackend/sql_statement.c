@@ -1741,6 +1741,41 @@ stmt_tinter(backend *be, stmt *op1, stmt *op2)
 	return NULL;
 }
 
+/* Candidates of op1 whose value may occur in keys, found through a
+ * Bloom filter built over keys. */
+stmt *
+stmt_bloomselect(backend *be, stmt *op1, stmt *keys)
+{
+	InstrPtr q = NULL, f = NULL;
+	MalBlkPtr mb = be->mb;
+
+	if (op1->nr < 0 || keys->nr < 0)
+		return NULL;
+	f = newStmt(mb, algebraRef, bloomRef);
+	f = pushArgument(mb, f, keys->nr);
+	f = pushNil(mb, f, TYPE_bat);
+	if (f == NULL)
+		return NULL;
+	q = newStmt(mb, algebraRef, bloomselectRef);
+	q = pushArgument(mb, q, op1->nr);
+	q = pushNil(mb, q, TYPE_bat);
+	q = pushArgument(mb, q, getDestVar(f));
+
+	if (q) {
+		stmt *s = stmt_create(be->mvc->sa, st_bloom);
+
+		s->op1 = op1;
+		s->op2 = keys;
+		s->nrcols = op1->nrcols;
+		s->key = op1->key;
+		s->aggr = op1->aggr;
+		s->nr = getDestVar(q);
+		s->q = q;
+		return s;
+	}
+	return NULL;
+}
+
 stmt *
 stmt_join(backend *be, stmt *op1, stmt *op2, int anti, comp_type cmptype)
 {
@@ -3074,6 +3109,7 @@ tail_type(stmt *st)
 		case st_tunion:
 		case st_tdiff:
 		case st_tinter:
+		case st_bloom:
 		case st_append:
 		case st_alias:
 		case st_gen_group:
@@ -3236,6 +3272,7 @@ _column_name(sql_allocator *sa, stmt *st)
 	case st_tunion:
 	case st_tdiff:
 	case st_tinter:
+	case st_bloom:
 	case st_convert:
 		return column_name(sa, st->op1);
 	case st_Nop:
@@ -3306,6 +3343,7 @@ _table_name(sql_allocator *sa, stmt *st)
 	case st_tunion:
 	case st_tdiff:
 	case st_tinter:
+	case st_bloom:
 	case st_aggr:
 		return table_name(sa, st->op1);
 
@@ -3361,6 +3399,7 @@ schema_name(sql_allocator *sa, stmt *st)
 	case st_tunion:
 	case st_tdiff:
 	case st_tinter:
+	case st_bloom:
 	case st_convert:
 	case st_Nop:
 	case st_aggr:
@@ -52,6 +52,226 @@ strToStrSQuote(char **dst, size_t *len, const void *src)
 	return l;
 }
 
+#define HISTOGRAM_BUCKETS	32	/* equi-height buckets per column */
+#define HISTOGRAM_MCV		16	/* most common values per column */
+#define HISTOGRAM_SAMPLE	65536	/* values sorted for the histogram */
+#define HLL_BITS		12	/* 4096 HyperLogLog registers */
+
+static inline uint64_t
+hll_mix(uint64_t h)
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+/* HyperLogLog estimate of the number of distinct non-nil values,
+ * computed in a single scan over the whole column */
+static lng
+statistics_ndv(BAT *b)
+{
+	BATiter bi = bat_iterator(b);
+	int (*cmp)(const void *, const void *) = ATOMcompare(b->ttype);
+	const void *nil = ATOMnilptr(b->ttype);
+	unsigned char reg[1 << HLL_BITS];
+	int i, r, zeros = 0;
+	dbl sum = 0, m = 1 << HLL_BITS, est;
+	BUN p, q;
+
+	if (b->ttype == TYPE_void)
+		return (lng) BATcount(b);
+	memset(reg, 0, sizeof(reg));
+	BATloop(b, p, q) {
+		const void *v = BUNtail(bi, p);
+		uint64_t h;
+
+		if ((*cmp)(v, nil) == 0)
+			continue;
+		h = hll_mix((uint64_t) ATOMhash(b->ttype, v));
+		i = (int) (h >> (64 - HLL_BITS));
+		h <<= HLL_BITS;
+		for (r = 1; r <= 64 - HLL_BITS && !(h & ((uint64_t) 1 << 63)); r++)
+			h <<= 1;
+		if (r > reg[i])
+			reg[i] = (unsigned char) r;
+	}
+	for (i = 0; i < 1 << HLL_BITS; i++) {
+		sum += 1.0 / ((uint64_t) 1 << reg[i]);
+		zeros += reg[i] == 0;
+	}
+	est = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+	if (est <= 2.5 * m && zeros > 0)
+		est = m * log(m / zeros);	/* linear counting for small sets */
+	if (est > (dbl) BATcount(b))
+		est = (dbl) BATcount(b);
+	return (lng) (est + 0.5);
+}
+
+/* append one row of sys.histogram to the insert statement in *buf */
+static int
+histogram_row(char **buf, size_t *len, size_t *pos, ssize_t (*tostr)(str*,size_t*,const void*),
+	      char **val, size_t *vallen, int colid, int bucket, int mcv,
+	      const void *low, const void *high, lng cnt, lng ndv)
+{
+	size_t need;
+	char *lowval;
+
+	if (tostr(val, vallen, low) < 0 || (lowval = GDKstrdup(*val)) == NULL)
+		return -1;
+	if (tostr(val, vallen, high) < 0) {
+		GDKfree(lowval);
+		return -1;
+	}
+	need = *pos + strlen(lowval) + strlen(*val) + 128;
+	if (need > *len) {
+		char *nbuf = GDKrealloc(*buf, need * 2);
+		if (nbuf == NULL) {
+			GDKfree(lowval);
+			return -1;
+		}
+		*buf = nbuf;
+		*len = need * 2;
+	}
+	*pos += snprintf(*buf + *pos, *len - *pos, "%s(%d,%d,%s,'%s','%s'," LLFMT "," LLFMT ")",
+			 *pos > 0 && (*buf)[*pos - 1] == ')' ? "," : "",
+			 colid, bucket, mcv ? "true" : "false", lowval, *val, cnt, ndv);
+	GDKfree(lowval);
+	return 0;
+}
+
+/* Replace the histogram of column c by equi-height buckets and the most
+ * common values of a sorted sample of bn */
+static str
+statistics_histogram(Client cntxt, sql_column *c, BAT *bn, BAT *bsample, lng sz, lng ndv,
+		     ssize_t (*tostr)(str*,size_t*,const void*), int minmax)
+{
+	char dquery[96], *query = NULL, *val = NULL;
+	size_t len = 0, pos, vallen = 0;
+	BAT *s = NULL, *v, *sorted;
+	BATiter si;
+	BUN n, i, j, start, end, first, runs[HISTOGRAM_MCV], runlen[HISTOGRAM_MCV];
+	int k, nmcv = 0, nb, bucket = 0, tpe = bn->ttype;
+	lng sdistinct = 0, bdistinct[HISTOGRAM_BUCKETS];
+	BUN bstart[HISTOGRAM_BUCKETS], bend[HISTOGRAM_BUCKETS];
+	const void *nil = ATOMnilptr(tpe);
+	dbl scale, ratio;
+	str msg;
+
+	snprintf(dquery, sizeof(dquery), "delete from sys.histogram where \"column_id\" = %d;", c->base.id);
+	query = dquery;
+	if ((msg = SQLstatementIntern(cntxt, &query, "SQLanalyze", TRUE, FALSE, NULL)) != NULL)
+		return msg;
+	if (minmax || tostr == NULL || !ATOMlinear(tpe) || tpe == TYPE_void || sz == 0)
+		return MAL_SUCCEED;
+
+	if (bsample) {
+		v = BATproject(bsample, bn);
+	} else if (sz > HISTOGRAM_SAMPLE) {
+		if ((s = BATsample(bn, HISTOGRAM_SAMPLE)) == NULL)
+			throw(SQL, "analyze", GDK_EXCEPTION);
+		v = BATproject(s, bn);
+		BBPunfix(s->batCacheid);
+	} else {
+		v = bn;
+		BBPfix(bn->batCacheid);
+	}
+	if (v == NULL)
+		throw(SQL, "analyze", GDK_EXCEPTION);
+	if (BATsort(&sorted, NULL, NULL, v, NULL, NULL, 0, 0) != GDK_SUCCEED) {
+		BBPunfix(v->batCacheid);
+		throw(SQL, "analyze", GDK_EXCEPTION);
+	}
+	BBPunfix(v->batCacheid);
+	si = bat_iterator(sorted);
+	n = BATcount(sorted);
+	/* nils sort first */
+	for (first = 0; first < n && ATOMcmp(tpe, BUNtail(si, first), nil) == 0; first++)
+		;
+	if (first == n) {
+		BBPunfix(sorted->batCacheid);
+		return MAL_SUCCEED;
+	}
+	scale = (dbl) sz / n;
+
+	/* split the sorted values in buckets of about equal height,
+	 * without splitting runs of equal values, and keep the longest
+	 * runs as the most common values */
+	nb = n - first < HISTOGRAM_BUCKETS ? (int) (n - first) : HISTOGRAM_BUCKETS;
+	for (start = first, k = 0; start < n; k++) {
+		end = first + (BUN) (k + 1) * (n - first) / nb;
+		if (end <= start)
+			continue;
+		while (end < n && ATOMcmp(tpe, BUNtail(si, end - 1), BUNtail(si, end)) == 0)
+			end++;
+		bstart[bucket] = start;
+		bend[bucket] = end;
+		bdistinct[bucket] = 0;
+		for (i = start; i < end; i = j) {
+			for (j = i + 1; j < end && ATOMcmp(tpe, BUNtail(si, i), BUNtail(si, j)) == 0; j++)
+				;
+			bdistinct[bucket]++;
+			if (j - i >= 2 && (j - i) * 2 * HISTOGRAM_BUCKETS >= n - first &&
+			    (nmcv < HISTOGRAM_MCV || j - i > runlen[nmcv - 1])) {
+				int m = nmcv < HISTOGRAM_MCV ? nmcv++ : nmcv - 1;
+
+				for (; m > 0 && runlen[m - 1] < j - i; m--) {
+					runs[m] = runs[m - 1];
+					runlen[m] = runlen[m - 1];
+				}
+				runs[m] = i;
+				runlen[m] = j - i;
+			}
+		}
+		sdistinct += bdistinct[bucket];
+		bucket++;
+		start = end;
+	}
+	/* the sample misses distinct values, spread the column's estimate */
+	ratio = ndv > sdistinct ? (dbl) ndv / sdistinct : 1.0;
+
+	if ((query = GDKmalloc(len = 1024)) == NULL) {
+		BBPunfix(sorted->batCacheid);
+		throw(SQL, "analyze", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+	}
+	pos = snprintf(query, len, "insert into sys.histogram values ");
+	for (k = 0; k < bucket; k++) {
+		lng cnt = (lng) ((bend[k] - bstart[k]) * scale + 0.5);
+		lng d = (lng) (bdistinct[k] * ratio + 0.5);
+
+		if (histogram_row(&query, &len, &pos, tostr, &val, &vallen, c->base.id, k, 0,
+				  BUNtail(si, bstart[k]), BUNtail(si, bend[k] - 1),
+				  cnt, d < cnt ? d : cnt) < 0)
+			goto bailout;
+	}
+	for (k = 0; k < nmcv; k++) {
+		if (histogram_row(&query, &len, &pos, tostr, &val, &vallen, c->base.id, k, 1,
+				  BUNtail(si, runs[k]), BUNtail(si, runs[k]),
+				  (lng) (runlen[k] * scale + 0.5), 1) < 0)
+			goto bailout;
+	}
+	BBPunfix(sorted->batCacheid);
+	GDKfree(val);
+	if (pos + 2 > len || snprintf(query + pos, len - pos, ";") < 0) {
+		GDKfree(query);
+		throw(SQL, "analyze", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+	}
+#ifdef DEBUG_SQL_STATISTICS
+	fprintf(stderr, "%s\n", query);
+#endif
+	msg = SQLstatementIntern(cntxt, &query, "SQLanalyze", TRUE, FALSE, NULL);
+	GDKfree(query);
+	return msg;
+
+  bailout:
+	BBPunfix(sorted->batCacheid);
+	GDKfree(val);
+	GDKfree(query);
+	throw(SQL, "analyze", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+}
+
 str
 sql_analyze(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 {
@@ -136,6 +356,8 @@ sql_analyze(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 							c->min = NULL;
 						if (c->max)
 							c->max = NULL;
+						c->hist = NULL;
+						c->dcount = 0;
 
 						if ((bn = store_funcs.bind_col(tr, c, RDONLY)) == NULL) {
 							/* XXX throw error instead? */
@@ -163,22 +385,19 @@ sql_analyze(Client cntxt, MalBlkPtr mb, MalStkPtr stk, InstrPtr pci)
 						BBPunfix(br->batCacheid);
 						if (bn->tkey)
 							uniq = sz;
-						else if (!minmax) {
-							BAT *en;
-							if (bsample)
-								br = BATproject(bsample, bn);
-							else
-								br = bn;
-							if (br && (en = BATunique(br, NULL)) != NULL) {
-								uniq = BATcount(en);
-								BBPunfix(en->batCacheid);
-							} else
-								uniq = 0;
-							if (bsample && br)
-								BBPunfix(br->batCacheid);
-						}
+						else if (!minmax)
+							uniq = statistics_ndv(bn);
+						msg = statistics_histogram(cntxt, c, bn, bsample, sz, uniq, tostr, minmax);
 						if (bsample)
 							BBPunfix(bsample->batCacheid);
+						if (msg) {
+							BBPunfix(bn->batCacheid);
+							GDKfree(dquery);
+							GDKfree(query);
+							GDKfree(maxval);
+							GDKfree(minval);
+							return msg;
+						}
 						/* use BATordered(_rev)
 						 * and not
 						 * BATt(rev)ordered
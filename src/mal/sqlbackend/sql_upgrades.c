@@ -1365,6 +1365,39 @@ sql_replace_Mar2018_ids_view(Client c, mvc *sql)
 	return err;		/* usually MAL_SUCCEED */
 }
 
+static str
+sql_update_histogram(Client c, mvc *sql)
+{
+	size_t bufsize = 1000, pos = 0;
+	char *buf = GDKmalloc(bufsize), *err = NULL;
+	char *schema = stack_get_string(sql, "current_schema");
+
+	if (buf == NULL)
+		throw(SQL, "sql_update_histogram", SQLSTATE(HY001) MAL_MALLOC_FAIL);
+
+	/* 80_statistics.sql */
+	pos += snprintf(buf + pos, bufsize - pos,
+			"set schema \"sys\";\n"
+			"create table sys.histogram(\n"
+			"\t\"column_id\" integer,\n"
+			"\t\"bucket\" integer,\n"
+			"\t\"mcv\" boolean,\n"
+			"\tlowval string,\n"
+			"\thighval string,\n"
+			"\t\"count\" bigint,\n"
+			"\t\"unique\" bigint);\n"
+			"update sys._tables set system = true where name = 'histogram' and schema_id = (select id from sys.schemas where name = 'sys');\n");
+	if (schema)
+		pos += snprintf(buf + pos, bufsize - pos, "set schema \"%s\";\n", schema);
+	pos += snprintf(buf + pos, bufsize - pos, "commit;\n");
+	assert(pos < bufsize);
+
+	printf("Running database upgrade commands:\n%s\n", buf);
+	err = SQLstatementIntern(c, &buf, "update", 1, 0, NULL);
+	GDKfree(buf);
+	return err;		/* usually MAL_SUCCEED */
+}
+
 void
 SQLupgrades(Client c, mvc *m)
 {
@@ -1472,4 +1505,10 @@ SQLupgrades(Client c, mvc *m)
 			res_tables_destroy(output);
 	}
 
+	if (mvc_bind_table(m, s, "histogram") == NULL) {
+		if ((err = sql_update_histogram(c, m)) != NULL) {
+			fprintf(stderr, "!%s\n", err);
+			freeException(err);
+		}
+	}
 }
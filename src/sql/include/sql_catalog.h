@@ -209,6 +209,7 @@ typedef struct sql_trans {
 	int rtime;
 	int wtime;
 	int schema_number;	/* schema timestamp */
+	int commit_number;	/* global commit number at the last reset */
 	int schema_updates;	/* set on schema changes */
 	int status;		/* status of the last query */
 	list *dropped;  	/* protection against recursive cascade action*/
@@ -453,6 +454,23 @@ typedef enum sql_histype {
        X_EQUI_HEIGHT
 } sql_histype;
 
+/* equi-height histogram and most common values of a column, as
+ * collected by ANALYZE in sys.histogram */
+typedef struct sql_histogram {
+	int type;		/* GDK type of the values */
+	int nbuckets;
+	int nmcv;
+	lng count;		/* non-nil values when analyzed */
+	lng nils;
+	lng ndv;		/* estimated number of distinct values */
+	void **low;		/* bucket bounds, ascending */
+	void **high;
+	lng *bcount;		/* values per bucket */
+	lng *bndv;		/* distinct values per bucket */
+	void **mcv;		/* most common values */
+	lng *mcvcount;
+} sql_histogram;
+
 typedef struct sql_column {
 	sql_base base;
 	sql_subtype type;
@@ -466,6 +484,7 @@ typedef struct sql_column {
 	size_t dcount;
 	char *min;
 	char *max;
+	sql_histogram *hist;
 
 	struct sql_table *t;
 	struct sql_column *po;	/* the outer transactions column */
@@ -518,6 +537,7 @@ typedef struct sql_table {
 	int drop_action;	/* only needed for alter drop table */
 
 	int cleared;		/* cleared in the current transaction */
+	int compacted;		/* number of compactions, which renumber the rows */
 	void *data;
 	struct sql_schema *s;
 	struct sql_table *p;	/* The table is part of this merge table */
@@ -23,6 +23,16 @@ CREATE TABLE sys.statistics(
 	sorted boolean,
 	revsorted boolean);
 
+-- equi-height histogram buckets and most common values per column
+CREATE TABLE sys.histogram(
+	"column_id" integer,
+	"bucket" integer,
+	"mcv" boolean,
+	lowval string,
+	highval string,
+	"count" bigint,
+	"unique" bigint);
+
 create procedure sys.analyze(minmax int, "sample" bigint)
 external name sql.analyze;
 
@@ -597,27 +597,193 @@ exps_count(list *exps)
 	return cnt;
 }
 
+/* The estimates below use the histograms collected by ANALYZE; without
+ * these the join expressions keep their heuristic order. */
+static atom *
+exp_est_atom(mvc *sql, sql_exp *e, sql_histogram *h)
+{
+	atom *a;
+
+	if (!e || e->type != e_atom)
+		return NULL;
+	a = exp_value(sql, e, sql->args, sql->argc);
+	if (!a || a->isnull || a->data.vtype != h->type)
+		return NULL;
+	return a;
+}
+
+static sql_histogram *
+exp_est_histogram(mvc *sql, sql_rel *rel, sql_exp *e)
+{
+	sql_rel *bt = NULL;
+	sql_column *c;
+
+	if (e->type != e_column || !e->r || ((char *) e->r)[0] == '%')
+		return NULL;
+	c = name_find_column(rel, e->l, e->r, -1, &bt);
+	if (!c || !bt || !bt->l)
+		return NULL;
+	return sql_trans_histogram(sql->session->tr, c);
+}
+
+/* fraction of the rows of rel that pass selection e */
+static dbl
+exp_est_selectivity(mvc *sql, sql_rel *rel, sql_exp *e, int *stats)
+{
+	sql_histogram *h;
+	atom *lo, *hi;
+	dbl sel;
+
+	if (e->type != e_cmp || is_complex_exp(e->flag))
+		return 0.5;
+	if ((h = exp_est_histogram(sql, rel, e->l)) == NULL) {
+		if (e->f)
+			return 0.25;
+		return get_cmp(e) == cmp_equal ? 0.1 : 0.5;
+	}
+	*stats = 1;
+	lo = exp_est_atom(sql, e->r, h);
+	if (e->f) {
+		hi = exp_est_atom(sql, e->f, h);
+		if (!lo || !hi)
+			return 0.25;
+		sel = sql_histogram_below(h, VALptr(&hi->data), range2rcompare(e->flag) == cmp_lte) -
+			sql_histogram_below(h, VALptr(&lo->data), range2lcompare(e->flag) == cmp_gt);
+	} else {
+		switch (get_cmp(e)) {
+		case cmp_equal:
+		case cmp_notequal:
+			sel = lo ? sql_histogram_equal(h, VALptr(&lo->data)) : 1.0 / h->ndv;
+			if (get_cmp(e) == cmp_notequal)
+				sel = 1 - sel;
+			break;
+		case cmp_lt:
+		case cmp_lte:
+			sel = lo ? sql_histogram_below(h, VALptr(&lo->data), get_cmp(e) == cmp_lte) : 0.5;
+			break;
+		case cmp_gt:
+		case cmp_gte:
+			sel = lo ? 1 - sql_histogram_below(h, VALptr(&lo->data), get_cmp(e) == cmp_gt) : 0.5;
+			break;
+		default:
+			sel = 0.5;
+		}
+	}
+	if (is_anti(e))
+		sel = 1 - sel;
+	/* nils never qualify */
+	sel *= (dbl) h->count / (h->count + h->nils);
+	return sel < 1.0 / (h->count + h->nils) ? 1.0 / (h->count + h->nils) : sel;
+}
+
+/* number of rows of a (selection on a) base table in the join list,
+ * -1 if unknown */
+static dbl
+rel_est_card(mvc *sql, sql_rel *rel, int *stats)
+{
+	dbl card;
+	node *n;
+
+	switch (rel->op) {
+	case op_basetable: {
+		sql_table *t = rel->l;
+
+		if (!t || !isTable(t) || !t->columns.set->h)
+			return -1;
+		return (dbl) store_funcs.count_col(sql->session->tr, t->columns.set->h->data, 1);
+	}
+	case op_project:
+		return rel->l ? rel_est_card(sql, rel->l, stats) : 1;
+	case op_select:
+		if (!rel->l || (card = rel_est_card(sql, rel->l, stats)) < 0)
+			return -1;
+		if (rel->exps)
+			for (n = rel->exps->h; n; n = n->next)
+				card *= exp_est_selectivity(sql, rel->l, n->data, stats);
+		return card;
+	default:
+		return -1;
+	}
+}
+
+/* number of distinct values of join column e of rel, -1 if unknown */
+static dbl
+exp_est_ndv(mvc *sql, sql_rel *rel, sql_exp *e, dbl card, int *stats)
+{
+	sql_histogram *h;
+
+	if (e->type != e_column || !e->r)
+		return -1;
+	if (((char *) e->r)[0] == '%')	/* join index and tid are keys */
+		return card;
+	if ((h = exp_est_histogram(sql, rel, e)) == NULL)
+		return -1;
+	*stats = 1;
+	return (dbl) h->ndv < card ? (dbl) h->ndv : card;
+}
+
+/* selectivity of join expression e between l and r, -1 if the number
+ * of distinct values is unknown on both sides */
+static dbl
+exp_est_join_sel(mvc *sql, sql_exp *e, sql_rel *l, sql_rel *r, dbl lc, dbl rc, int *stats)
+{
+	dbl ln, rn;
+
+	if (e->f || get_cmp(e) != cmp_equal)
+		return 1.0 / 3;
+	ln = exp_est_ndv(sql, l, e->l, lc, stats);
+	rn = exp_est_ndv(sql, r, e->r, rc, stats);
+	if (ln < 0 && rn < 0)
+		return -1;
+	if (rn > ln)
+		ln = rn;
+	return 1 / (ln > 1 ? ln : 1);
+}
+
+/* size of the result of join expression e on its two relations */
+static dbl
+exp_est_join(mvc *sql, sql_exp *e, list *rels, int *stats)
+{
+	sql_rel *l, *r;
+	dbl lc, rc, sel;
+
+	if (e->type != e_cmp || is_complex_exp(e->flag))
+		return -1;
+	l = find_rel(rels, e->l);
+	r = find_rel(rels, e->r);
+	if (!l || !r || (lc = rel_est_card(sql, l, stats)) < 0 || (rc = rel_est_card(sql, r, stats)) < 0)
+		return -1;
+	if ((sel = exp_est_join_sel(sql, e, l, r, lc, rc, stats)) < 0)
+		return -1;
+	return lc * rc * sel;
+}
+
 static list *
 order_join_expressions(mvc *sql, list *dje, list *rels)
 {
 	list *res;
 	node *n = NULL;
-	int i, j, *keys, *pos, cnt = list_length(dje);
+	int i, j, *keys, *pos, cnt = list_length(dje), known = 1, stats = 0;
 	int debug = mvc_debug_on(sql, 16);
+	dbl *est;
 
 	keys = (int*)malloc(cnt*sizeof(int));
 	pos = (int*)malloc(cnt*sizeof(int));
-	if (keys == NULL || pos == NULL) {
+	est = (dbl*)malloc(cnt*sizeof(dbl));
+	if (keys == NULL || pos == NULL || est == NULL) {
 		if (keys)
 			free(keys);
 		if (pos)
 			free(pos);
+		if (est)
+			free(est);
 		return NULL;
 	}
 	res = sa_list(sql->sa);
 	if (res == NULL) {
 		free(keys);
 		free(pos);
+		free(est);
 		return NULL;
 	}
 	for (n = dje->h, i = 0; n; n = n->next, i++) {
@@ -635,10 +801,23 @@ order_join_expressions(mvc *sql, list *dje, list *rels)
 				keys[i] += list_length(r->exps)*10 + exps_count(r->exps)*debug;
 		}
 		pos[i] = i;
+		if (known && (est[i] = exp_est_join(sql, e, rels, &stats)) < 0)
+			known = 0;
 	}
-	/* sort descending */
-	if (cnt > 1) 
+	if (cnt > 1 && known && stats) {
+		/* with statistics, start with the smallest join result */
+		for (i = 1; i < cnt; i++) {
+			int p = pos[i];
+
+			for (j = i; j > 0 && (est[pos[j-1]] > est[p] ||
+			     (est[pos[j-1]] == est[p] && keys[pos[j-1]] < keys[p])); j--)
+				pos[j] = pos[j-1];
+			pos[j] = p;
+		}
+	} else if (cnt > 1) {
+		/* sort descending */
 		GDKqsort_rev(keys, pos, NULL, cnt, sizeof(int), sizeof(int), TYPE_int);
+	}
 	for(j=0; j<cnt; j++) {
 		for(n = dje->h, i = 0; i != pos[j]; n = n->next, i++) 
 			;
@@ -646,6 +825,7 @@ order_join_expressions(mvc *sql, list *dje, list *rels)
 	}
 	free(keys);
 	free(pos);
+	free(est);
 	return res;
 }
 
@@ -812,6 +992,168 @@ find_fk( mvc *sql, list *rels, list *exps)
 	return sdje;
 }
 
+/*
+ * Join ordering by dynamic programming over the connected subsets of
+ * the join graph.  Every subset gets the cheapest plan that joins two
+ * of its connected, disjoint parts (which may be bushy), where the cost
+ * of a plan is the sum of the estimated sizes of its intermediates.
+ * Cross products are never considered; above DP_MAX_RELS relations or
+ * without statistics from ANALYZE the greedy order_joins is used instead.
+ */
+#define DP_MAX_RELS 12
+
+typedef struct dp_plan {
+	dbl card;
+	dbl cost;		/* < 0 if the subset is not connected */
+	unsigned int left;	/* best split */
+} dp_plan;
+
+static sql_rel *
+dp_build(mvc *sql, dp_plan *plan, sql_rel **rels, list *exps, unsigned int *emask, char *used, unsigned int s)
+{
+	unsigned int s1, s2;
+	sql_rel *l, *r, *top;
+	node *n;
+	int k;
+
+	if ((s & (s - 1)) == 0) {
+		for (k = 0; !(s & (1U << k)); k++)
+			;
+		return rels[k];
+	}
+	s1 = plan[s].left;
+	s2 = s ^ s1;
+	l = dp_build(sql, plan, rels, exps, emask, used, s1);
+	r = dp_build(sql, plan, rels, exps, emask, used, s2);
+	/* the larger input goes left */
+	if (plan[s2].card > plan[s1].card) {
+		sql_rel *t = l;
+		l = r;
+		r = t;
+	}
+	top = rel_crossproduct(sql->sa, l, r, op_join);
+	for (n = exps->h, k = 0; n; n = n->next, k++) {
+		if (!used[k] && emask[k] && (emask[k] & ~s) == 0) {
+			rel_join_add_exp(sql->sa, top, n->data);
+			used[k] = 1;
+		}
+	}
+	return top;
+}
+
+static sql_rel *
+order_joins_dp(mvc *sql, list *rels, list *exps)
+{
+	int nr = list_length(rels), ne = list_length(exps), i, k, stats = 0;
+	unsigned int full = (1U << nr) - 1, s, s1, s2, *emask, adj[DP_MAX_RELS];
+	sql_rel *rel[DP_MAX_RELS], *top;
+	dbl card[DP_MAX_RELS], *esel;
+	dp_plan *plan;
+	char *used;
+	node *n;
+
+	if (nr < 3 || nr > DP_MAX_RELS)
+		return NULL;
+	for (n = rels->h, i = 0; n; n = n->next, i++) {
+		rel[i] = n->data;
+		if ((card[i] = rel_est_card(sql, rel[i], &stats)) < 0)
+			return NULL;
+		if (card[i] < 1)
+			card[i] = 1;
+		adj[i] = 0;
+	}
+
+	/* the join graph: an edge for each expression on two relations */
+	emask = SA_NEW_ARRAY(sql->sa, unsigned int, ne);
+	esel = SA_NEW_ARRAY(sql->sa, dbl, ne);
+	used = SA_NEW_ARRAY(sql->sa, char, ne);
+	plan = SA_NEW_ARRAY(sql->sa, dp_plan, full + 1);
+	if (!emask || !esel || !used || !plan)
+		return NULL;
+	for (n = exps->h, k = 0; n; n = n->next, k++) {
+		sql_exp *e = n->data;
+		sql_rel *l = NULL, *r = NULL;
+		int li, ri;
+
+		emask[k] = 0;
+		used[k] = 0;
+		if (e->type != e_cmp || is_complex_exp(e->flag))
+			continue;
+		l = find_one_rel(rels, e->l);
+		r = find_one_rel(rels, e->r);
+		if (!l || !r || l == r || (e->f && find_one_rel(rels, e->f) != r))
+			continue;
+		li = list_position(rels, l);
+		ri = list_position(rels, r);
+		if ((esel[k] = exp_est_join_sel(sql, e, l, r, card[li], card[ri], &stats)) < 0)
+			/* no distinct counts, assume a key on the larger side */
+			esel[k] = 1 / (card[li] > card[ri] ? card[li] : card[ri]);
+		emask[k] = (1U << li) | (1U << ri);
+		adj[li] |= 1U << ri;
+		adj[ri] |= 1U << li;
+	}
+	/* without statistics the estimates are guesses, keep the key
+	 * aware greedy ordering */
+	if (!stats)
+		return NULL;
+
+	/* the size of a subset does not depend on its plan, derive it
+	 * from the subset without its first relation */
+	for (s = 1; s <= full; s++) {
+		for (i = 0; !(s & (1U << i)); i++)
+			;
+		plan[s].cost = -1;
+		plan[s].left = 0;
+		if (s == (1U << i)) {
+			plan[s].card = card[i];
+			plan[s].cost = 0;
+			continue;
+		}
+		plan[s].card = plan[s ^ (1U << i)].card * card[i];
+		for (k = 0; k < ne; k++)
+			if ((emask[k] & (1U << i)) && (emask[k] & ~s) == 0)
+				plan[s].card *= esel[k];
+		if (plan[s].card < 1)
+			plan[s].card = 1;
+	}
+	/* subsets are visited after all of their parts */
+	for (s = 1; s <= full; s++) {
+		if ((s & (s - 1)) == 0)
+			continue;
+		for (s1 = (s - 1) & s; s1; s1 = (s1 - 1) & s) {
+			dbl cost;
+
+			s2 = s ^ s1;
+			if (s1 < s2 || plan[s1].cost < 0 || plan[s2].cost < 0)
+				continue;
+			for (i = 0; i < nr; i++)
+				if ((s1 & (1U << i)) && (adj[i] & s2))
+					break;
+			if (i == nr)
+				continue;
+			cost = plan[s1].cost + plan[s2].cost + plan[s].card;
+			if (plan[s].cost < 0 || cost < plan[s].cost) {
+				plan[s].cost = cost;
+				plan[s].left = s1;
+			}
+		}
+	}
+	if (plan[full].cost < 0)	/* the join graph is not connected */
+		return NULL;
+
+	top = dp_build(sql, plan, rel, exps, emask, used, full);
+	for (i = 0; i < nr; i++)
+		list_remove_data(rels, rel[i]);
+	for (n = exps->h, k = 0; n; k++) {
+		node *nxt = n->next;
+
+		if (used[k])
+			list_remove_node(exps, n);
+		n = nxt;
+	}
+	return top;
+}
+
 static sql_rel *
 order_joins(mvc *sql, list *rels, list *exps)
 {
@@ -833,9 +1175,11 @@ order_joins(mvc *sql, list *rels, list *exps)
 		return top;
 	}
 
+	top = order_joins_dp(sql, rels, exps);
+
 	/* open problem, some expressions use more than 2 relations */
 	/* For example a.x = b.y * c.z; */
-	if (list_length(rels) >= 2 && sdje->h) {
+	if (!top && list_length(rels) >= 2 && sdje->h) {
 		/* get the first expression */
 		cje = sdje->h->data;
 
@@ -6744,6 +7088,77 @@ rel_use_index(int *changes, mvc *sql, sql_rel *rel)
 	return rel;
 }
 
+/* A selective equi-join of a large (fact) relation with a filtered
+ * (dimension) relation first reduces the fact side to the rows whose
+ * key passes a Bloom filter built over the surviving dimension keys,
+ * so the join and the projections after it only see the fact rows
+ * that may match.  This only pays off if probing the hash of the
+ * dimension column misses the cache.  The join expression is marked
+ * with PROP_BLOOM; its value is the column expression of the fact
+ * side.  The estimates must come from statistics gathered by
+ * ANALYZE. */
+#define BLOOM_MINROWS	100000
+
+/* number of rows of the relation below the selection on rel, -1 if
+ * rel is not a selection */
+static dbl
+rel_est_unfiltered(mvc *sql, sql_rel *rel, int *stats)
+{
+	while (rel && rel->op == op_project)
+		rel = rel->l;
+	if (!rel || rel->op != op_select || list_empty(rel->exps) || !rel->l)
+		return -1;
+	return rel_est_card(sql, rel->l, stats);
+}
+
+static sql_rel *
+rel_bloom_join(int *changes, mvc *sql, sql_rel *rel)
+{
+	sql_exp *e, *fe;
+	sql_rel *fact, *dim;
+	prop *p;
+	dbl lc, rc, dc, t;
+	int stats = 0;
+
+	(void)changes;
+	if (rel->op != op_join || !rel->l || !rel->r || list_length(rel->exps) != 1)
+		return rel;
+	e = rel->exps->h->data;
+	if (e->type != e_cmp || get_cmp(e) != cmp_equal || e->f || is_anti(e) ||
+	    ((sql_exp *) e->l)->type != e_column || ((sql_exp *) e->r)->type != e_column ||
+	    find_prop(e->p, PROP_HASHCOL) || find_prop(e->p, PROP_JOINIDX) ||
+	    find_prop(e->p, PROP_BLOOM))
+		return rel;
+	if ((lc = rel_est_card(sql, rel->l, &stats)) < 0 ||
+	    (rc = rel_est_card(sql, rel->r, &stats)) < 0)
+		return rel;
+	if (lc >= rc) {
+		fact = rel->l;
+		dim = rel->r;
+	} else {
+		fact = rel->r;
+		dim = rel->l;
+		t = lc;
+		lc = rc;
+		rc = t;
+	}
+	/* without statistics the selectivity of the dimension filter is
+	 * a guess */
+	if (!stats || lc < BLOOM_MINROWS || rc * 4 > lc ||
+	    (dc = rel_est_unfiltered(sql, dim, &stats)) < 0 ||
+	    dc * 2 * sizeof(BUN) < MT_l2cachesize())
+		return rel;
+	if (rel_find_exp(fact, e->l))
+		fe = e->l;
+	else if (rel_find_exp(fact, e->r))
+		fe = e->r;
+	else
+		return rel;
+	e->p = p = prop_create(sql->sa, PROP_BLOOM, e->p);
+	p->value = fe;
+	return rel;
+}
+
 /* TODO CSE */
 #if 0
 static list *
@@ -9301,6 +9716,9 @@ optimize_rel(mvc *sql, sql_rel *rel, int *g_changes, int level, int value_based_
 		rel = rewrite(sql, rel, &rel_remove_empty_select, &e_changes); 
 	}
 
+	if (gp.cnt[op_join])
+		rel = rewrite(sql, rel, &rel_bloom_join, &changes);
+
 	if (!changes && gp.cnt[op_topn]) {
 		rel = rewrite_topdown(sql, rel, &rel_push_topn_down, &changes); 
 		changes = 0;
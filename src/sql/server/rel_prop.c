@@ -72,6 +72,7 @@ propkind2string( prop *p)
 		PT(HASHCOL);
 		PT(FETCH);
 		PT(REMOTE);
+		PT(BLOOM);
 		PT(USED);
 	}
 	return "UNKNOWN";
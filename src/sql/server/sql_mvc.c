@@ -62,10 +62,16 @@ mvc_init(int debug, store_type store, int ro, int su, backend_stack stk)
 	 * 0 by default - keeps only the current WAL file. */
 	log_settings.keep_persisted_log_files = GDKgetenv_int("gdk_keep_persisted_log_files", 0);
 
+	/* Get and pass on how many ms a group commit waits for more
+	 * transactions before syncing the WAL. 0 by default - transactions
+	 * only share a sync when they commit while another one is syncing. */
+	log_settings.group_commit_delay = GDKgetenv_int("gdk_group_commit_delay", 0);
+
 	mvc_debug = debug&4;
 	if (mvc_debug) {
 		fprintf(stderr, "#mvc_init logdir %s\n", log_settings.logdir);
 		fprintf(stderr, "#mvc_init keep_persisted_log_files %d\n", log_settings.keep_persisted_log_files);
+		fprintf(stderr, "#mvc_init group_commit_delay %d\n", log_settings.group_commit_delay);
 		if (log_settings.shared_logdir != NULL) {
 			fprintf(stderr, "#mvc_init shared_logdir %s\n", log_settings.shared_logdir);
 		}
@@ -269,7 +275,11 @@ mvc_trans(mvc *m)
 	assert(!m->session->active);	/* can only start a new transaction */
 
 	store_lock();
+	store_checkpoint_wait();
 	schema_changed = sql_trans_begin(m->session);
+	store_unlock();
+
+	/* the query cache is private to the client */
 	if (m->qc && (schema_changed || m->qc->nr > m->cache || err)){
 		if (schema_changed || err) {
 			int seqnr = m->qc->id;
@@ -277,6 +287,7 @@ mvc_trans(mvc *m)
 				qc_destroy(m->qc);
 			m->qc = qc_create(m->clientid, seqnr);
 			if (!m->qc) {
+				store_lock();
 				sql_trans_end(m->session);
 				store_unlock();
 				return -1;
@@ -285,7 +296,6 @@ mvc_trans(mvc *m)
 			qc_clean(m->qc);
 		}
 	}
-	store_unlock();
 	return 0;
 }
 
@@ -395,18 +405,19 @@ build up the hash (not copied in the trans dup)) */
 	cur -> parent = tr;
 	tr = cur;
 
-	store_lock();
-	/* if there is nothing to commit reuse the current transaction */
+	/* if there is nothing to commit reuse the current transaction,
+	 * which ends without taking the store lock */
 	if (tr->wtime == 0) {
 		if (!chain) 
-			sql_trans_end(m->session);
+			sql_trans_retire(m->session);
 		m->type = Q_TRANS;
-		store_unlock();
 		if (mvc_debug)
 			fprintf(stderr, "#mvc_commit %s done\n", (name) ? name : "");
 		return 0;
 	}
 
+	store_lock();
+
 	/*
 	while (tr->schema_updates && store_nr_active > 1) {
 		store_unlock();
@@ -437,6 +448,18 @@ build up the hash (not copied in the trans dup)) */
 	if (chain) 
 		sql_trans_begin(m->session);
 	store_unlock();
+	/* the commit is only done once its log records are on disk.  The
+	 * sync happens after the store lock is released, so that commits
+	 * arriving meanwhile share it (group commit).  The price is that
+	 * other sessions can see this commit before it is durable: a
+	 * session that only reads it may see data that a crash loses.  A
+	 * session that commits on top of it is safe, the log is written in
+	 * order and its own sync covers this commit as well. */
+	if (store_sync_log() != LOG_OK) {
+		char *msg = sql_message(SQLSTATE(40000) "COMMIT: transaction commit failed (perhaps your disk is full?) exiting (kernel error: %s)", GDKerrbuf);
+		GDKfatal("%s", msg);
+		_DELETE(msg);
+	}
 	m->type = Q_TRANS;
 	if (mvc_debug)
 		fprintf(stderr, "#mvc_commit %s done\n", (name) ? name : "");
@@ -220,7 +220,11 @@ bl_destroy(void)
 	logger *l = bat_logger;
 	bat_logger = NULL;
 	if (l) {
+		if (log_tsync(l, 0) != GDK_SUCCEED)
+			fprintf(stderr, "!ERROR: bl_destroy: sync of the log failed\n");
 		close_stream(l->log);
+		MT_lock_destroy(&l->lock);
+		MT_lock_destroy(&l->sync_lock);
 		GDKfree(l->fn);
 		GDKfree(l->dir);
 		GDKfree(l->local_dir);
@@ -329,6 +333,12 @@ bl_tend(void)
 	return log_tend(bat_logger) == GDK_SUCCEED ? LOG_OK : LOG_ERR;
 }
 
+static int 
+bl_tsync(int delay)
+{
+	return log_tsync(bat_logger, delay) == GDK_SUCCEED ? LOG_OK : LOG_ERR;
+}
+
 static int 
 bl_sequence(int seq, lng id)
 {
@@ -359,6 +369,7 @@ bat_logger_init( logger_functions *lf )
 	lf->log_isnew = bl_log_isnew;
 	lf->log_tstart = bl_tstart;
 	lf->log_tend = bl_tend;
+	lf->log_tsync = bl_tsync;
 	lf->log_sequence = bl_sequence;
 	lf->log_isdestroyed = bl_isdestroyed;
 }
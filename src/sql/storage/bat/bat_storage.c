@@ -15,6 +15,36 @@
 
 #define SNAPSHOT_MINSIZE ((BUN) 1024*128)
 
+/* A large load into an empty column bypasses the log: its insert bat
+ * is made persistent and committed along with the log record, which
+ * only names the bat.  With other transactions active this is limited
+ * to tables that were not cleared, as those still need the old bats. */
+static int
+bypass_log(sql_delta *bat, int cleared)
+{
+	return !bat->ibase && bat->cnt > SNAPSHOT_MINSIZE &&
+		(store_nr_active == 1 || !cleared);
+}
+
+/* The insert bat of a delta that bypassed the log is known to the
+ * logger under the column's name, hence it becomes the main bat. */
+static int
+swap_delta(sql_delta *bat, int unique)
+{
+	BAT *ins = temp_descriptor(bat->ibid);
+
+	if (ins == NULL)
+		return LOG_ERR;
+	if (unique)
+		BATkey(ins, TRUE);
+	temp_destroy(bat->bid);
+	bat->bid = bat->ibid;
+	bat->ibase = bat->cnt;
+	bat->ibid = e_bat(ins->ttype);
+	bat_destroy(ins);
+	return bat->ibid == BID_NIL ? LOG_ERR : LOG_OK;
+}
+
 static sql_trans *
 oldest_active_transaction(void)
 {
@@ -1970,8 +2000,8 @@ empty_col(sql_column *c)
 	assert(c->data && c->base.allocated && bat->bid == 0);
 	bat->bid = bat->ibid;
 	bat->ibid = e_bat(type);
-	bat->ibase = 0;
 	bat->cnt = BATcount(BBPquickdesc(bat->bid, 0));
+	bat->ibase = bat->cnt;
 	bat->ucnt = 0;
 
 	if (bat->ibid == BID_NIL)
@@ -2022,8 +2052,8 @@ empty_idx(sql_idx *i)
 	assert(i->data && i->base.allocated && bat->bid == 0);
 	bat->bid = bat->ibid;
 	bat->ibid = e_bat(type);
-	bat->ibase = 0;
 	bat->cnt = BATcount(BBPquickdesc(bat->bid, 0));
+	bat->ibase = bat->cnt;
 	bat->ucnt = 0;
 
 	if (bat->ibid == BID_NIL)
@@ -2060,6 +2090,35 @@ empty_idx(sql_idx *i)
 	return LOG_OK;
 }
 
+/* the deletions of a cleared table replace the central deletions,
+ * which older transactions still use */
+static int
+empty_dbat(sql_dbat *bat)
+{
+	BAT *b = temp_descriptor(bat->dbid);
+
+	if (b == NULL)
+		return LOG_ERR;
+	if (isEbat(b) || b->batRole != PERSISTENT) {
+		temp_destroy(bat->dbid);
+		bat->dbid = temp_copy(b->batCacheid, FALSE);
+		bat_destroy(b);
+		if (bat->dbid == BID_NIL)
+			return LOG_ERR;
+		b = temp_descriptor(bat->dbid);
+		if (b == NULL)
+			return LOG_ERR;
+	}
+	bat_set_access(b, BAT_READ);
+	if (BATmode(b, PERSISTENT) != GDK_SUCCEED ||
+	    logger_add_bat(bat_logger, b, bat->dname) != GDK_SUCCEED) {
+		bat_destroy(b);
+		return LOG_ERR;
+	}
+	bat_destroy(b);
+	return LOG_OK;
+}
+
 static BUN
 clear_dbat(sql_trans *tr, sql_dbat *bat)
 {
@@ -2698,6 +2757,8 @@ update_table(sql_trans *tr, sql_table *ft, sql_table *tt)
 				for (n = tt->idxs.set->h; n; n = n->next) 
 					(void)store_funcs.clear_idx(tr->parent, n->data);
 		} else {
+			if (ft->data && empty_dbat(ft->data) != LOG_OK)
+				return LOG_ERR;
 			for (n = ft->columns.set->h; n; n = n->next) 
 				empty_col(n->data);
 			if (ft->idxs.set) 
@@ -2725,7 +2786,7 @@ update_table(sql_trans *tr, sql_table *ft, sql_table *tt)
 				destroy_dbat(tr, b->next);
 				b->next = NULL;
 			}
-			if (store_nr_active > 1 && tr->parent == gtrans) {
+			if (store_nr_active > 1 && tr->parent == gtrans && !ft->cleared) {
 				b = tt->data;
 				/* The central (as known to the logger) and 
 				 * transaction local bats need to be swapped */
@@ -2764,6 +2825,8 @@ update_table(sql_trans *tr, sql_table *ft, sql_table *tt)
 					bat_destroy(b->cached);
 					b->cached = NULL;
 				}
+				if (tr->parent == gtrans && bypass_log(b, ft->cleared))
+					ok = swap_delta(b, cc->unique == 1);
 				while (b && b->wtime >= oldest->stime) 
 					b = b->next;
 				if (0 && b && b->wtime < oldest->stime) {
@@ -2829,6 +2892,8 @@ update_table(sql_trans *tr, sql_table *ft, sql_table *tt)
 						bat_destroy(b->cached);
 						b->cached = NULL;
 					}
+					if (tr->parent == gtrans && bypass_log(b, ft->cleared))
+						ok = swap_delta(b, 0);
 					while (b && b->wtime >= oldest->stime) 
 						b = b->next;
 					if (0 && b && b->wtime < oldest->stime) {
@@ -2896,12 +2961,9 @@ tr_log_delta( sql_trans *tr, sql_delta *cbat, int cleared)
 	if (BUNlast(ins) > 0) {
 		assert(store_nr_active>0);
 		if (BUNlast(ins) > ins->batInserted &&
-		    (store_nr_active != 1 ||
-		     cbat->ibase ||
-		     BATcount(ins) <= SNAPSHOT_MINSIZE))
+		    !bypass_log(cbat, cleared))
 			ok = log_bat(bat_logger, ins, cbat->name);
-		if (ok == GDK_SUCCEED && store_nr_active == 1 &&
-		    !cbat->ibase && BATcount(ins) > SNAPSHOT_MINSIZE) {
+		if (ok == GDK_SUCCEED && bypass_log(cbat, cleared)) {
 			/* log new snapshot */
 			if ((ok = logger_add_bat(bat_logger, ins, cbat->name)) == GDK_SUCCEED)
 				ok = log_bat_persists(bat_logger, ins, cbat->name);
@@ -2984,7 +3046,7 @@ log_table(sql_trans *tr, sql_table *ft)
 }
 
 static int 
-tr_snapshot_bat( sql_trans *tr, sql_delta *cbat)
+tr_snapshot_bat( sql_trans *tr, sql_delta *cbat, int cleared)
 {
 	int ok = LOG_OK;
 
@@ -2992,7 +3054,7 @@ tr_snapshot_bat( sql_trans *tr, sql_delta *cbat)
 	assert(store_nr_active>0);
 
 	(void)tr;
-	if (store_nr_active == 1 && !cbat->ibase && cbat->cnt > SNAPSHOT_MINSIZE) {
+	if (bypass_log(cbat, cleared)) {
 		BAT *ins = temp_descriptor(cbat->ibid);
 		if(ins) {
 			/* any inserts */
@@ -3021,7 +3083,7 @@ snapshot_table(sql_trans *tr, sql_table *ft)
 
 		if (!cc->base.wtime || !cc->base.allocated) 
 			continue;
-		tr_snapshot_bat(tr, cc->data);
+		tr_snapshot_bat(tr, cc->data, ft->cleared);
 	}
 	if (ok == LOG_OK && ft->idxs.set) {
 		for (n = ft->idxs.set->h; ok == LOG_OK && n; n = n->next) {
@@ -3031,7 +3093,7 @@ snapshot_table(sql_trans *tr, sql_table *ft)
 			if (!ci->data || !ci->base.wtime || !ci->base.allocated)
 				continue;
 
-			tr_snapshot_bat(tr, ci->data);
+			tr_snapshot_bat(tr, ci->data, ft->cleared);
 		}
 	}
 	return ok;
@@ -610,7 +610,9 @@ table_vacuum(sql_trans *tr, sql_table *t)
 	}
 	for (n = t->columns.set->h; n; n = n->next) {
 		sql_column *c = n->data;
-		BAT *v = store_funcs.bind_col(tr, c, RDONLY);
+		/* the live rows include the inserts and updates that
+		 * are not merged into the column yet */
+		BAT *v = full_column(tr, c);
 
 		if (v == NULL ||
 		    (cols[c->colnr] = BATproject(tids, v)) == NULL) {
@@ -620,14 +622,16 @@ table_vacuum(sql_trans *tr, sql_table *t)
 					break;
 				bat_destroy(cols[((sql_column *) n->data)->colnr]);
 			}
-			bat_destroy(v);
+			if (v)
+				full_destroy(c, v);
 			_DELETE(cols);
 			return SQL_ERR;
 		}
-		BBPunfix(v->batCacheid);
+		full_destroy(c, v);
 	}
 	BBPunfix(tids->batCacheid);
 	sql_trans_clear_table(tr, t);
+	t->compacted++;
 	for (n = t->columns.set->h; n; n = n->next) {
 		sql_column *c = n->data;
 		int ok;
@@ -78,6 +78,13 @@ nl_tend(void)
 	return LOG_OK;
 }
 
+static int 
+nl_tsync(int delay)
+{
+	(void) delay;
+	return LOG_OK;
+}
+
 static int 
 nl_sequence(int seq, lng id)
 {
@@ -106,6 +113,7 @@ nop_logger_init( logger_functions *lf )
 	lf->log_isnew = nl_log_isnew;
 	lf->log_tstart = nl_tstart;
 	lf->log_tend = nl_tend;
+	lf->log_tsync = nl_tsync;
 	lf->log_sequence = nl_sequence;
 	lf->log_isdestroyed = nl_isdestroyed;
 }
@@ -290,6 +290,7 @@ typedef int (*logger_reload_fptr) (void);
 typedef int (*log_isnew_fptr)(void);
 typedef int (*log_tstart_fptr) (void);
 typedef int (*log_tend_fptr) (void);
+typedef int (*log_tsync_fptr) (int delay);
 typedef int (*log_sequence_fptr) (int seq, lng id);
 typedef int (*log_isdestroyed_fptr)(void);
 
@@ -311,6 +312,7 @@ typedef struct logger_functions {
 	log_isnew_fptr log_isnew;
 	log_tstart_fptr log_tstart;
 	log_tend_fptr log_tend;
+	log_tsync_fptr log_tsync;
 	log_sequence_fptr log_sequence;
 	log_isdestroyed_fptr log_isdestroyed;
 
@@ -334,6 +336,9 @@ extern void store_exit(void);
 
 extern void store_apply_deltas(void);
 extern void store_flush_log(void);
+extern int store_sync_log(void);
+extern int store_vacuum_table(const char *sname, const char *tname);
+extern void store_checkpoint_wait(void);
 extern void store_manager(void);
 extern void idle_manager(void);
 
@@ -378,6 +383,9 @@ extern sql_column *sql_trans_alter_storage(sql_trans *tr, sql_column *col, char
 extern int sql_trans_is_sorted(sql_trans *tr, sql_column *col);
 extern size_t sql_trans_dist_count(sql_trans *tr, sql_column *col);
 extern int sql_trans_ranges(sql_trans *tr, sql_column *col, void **min, void **max);
+extern sql_histogram *sql_trans_histogram(sql_trans *tr, sql_column *col);
+extern dbl sql_histogram_below(sql_histogram *h, const void *v, int inclusive);
+extern dbl sql_histogram_equal(sql_histogram *h, const void *v);
 
 extern sql_key *sql_trans_create_ukey(sql_trans *tr, sql_table *t, const char *name, key_type kt);
 extern sql_key * sql_trans_key_done(sql_trans *tr, sql_key *k);
@@ -406,6 +414,7 @@ extern void sql_session_destroy(sql_session *s);
 extern int sql_session_reset(sql_session *s, int autocommit);
 extern int sql_trans_begin(sql_session *s);
 extern void sql_trans_end(sql_session *s);
+extern void sql_trans_retire(sql_session *s);
 
 extern list* sql_trans_schema_user_dependencies(sql_trans *tr, int schema_id);
 extern void sql_trans_create_dependency(sql_trans *tr, int id, int depend_id, short depend_type);
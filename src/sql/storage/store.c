@@ -31,6 +31,11 @@ static int transactions = 0;
 sql_trans *gtrans = NULL;
 list *active_sessions = NULL;
 int store_nr_active = 0;
+#ifdef ATOMIC_LOCK
+static MT_Lock retiredLock MT_LOCK_INITIALIZER("retiredLock");
+#endif
+/* sessions whose read-only transaction ended without bs_lock */
+static volatile ATOMIC_TYPE store_nr_retired = 0;
 store_type active_store_type = store_bat;
 int store_readonly = 0;
 int store_singleuser = 0;
@@ -39,6 +44,7 @@ int store_initialized = 0;
 static int keep_persisted_log_files = 0;
 static int create_shared_logger = 0;
 static int shared_drift_threshold = -1;
+static int group_commit_delay = 0;
 
 backend_stack backend_stk;
 
@@ -49,12 +55,18 @@ logger_functions shared_logger_funcs;
 
 static int schema_number = 0; /* each committed schema change triggers a new
 				 schema number (session wise unique number) */
+static int commit_number = 0; /* each change of the global transaction
+				 triggers a new commit number */
 static int bs_debug = 0;
 static int logger_debug = 0;
 
+/* Transactions of ended sessions are kept as spares, a new session
+ * resets one instead of copying the whole catalog.  The pool is not
+ * capped, so it never holds more than the peak number of sessions. */
 #define MAX_SPARES 32
-static sql_trans *spare_trans[MAX_SPARES];
+static sql_trans **spare_trans = NULL;
 static int spares = 0;
+static int max_spares = 0;
 
 static int
 key_cmp(sql_key *k, sqlid *id)
@@ -196,6 +208,31 @@ trans_drop_tmp(sql_trans *tr)
 
 /*#define STORE_DEBUG 1*/
 
+static void
+trans_destroy(sql_trans *t)
+{
+	if (t->name) 
+		t->name = NULL;
+
+	cs_destroy(&t->schemas);
+	sa_destroy(t->sa);
+	_DELETE(t);
+	transactions--;
+}
+
+static int
+spare_trans_extend(void)
+{
+	int size = max_spares ? max_spares * 2 : MAX_SPARES;
+	sql_trans **n = RENEW_ARRAY(sql_trans*, spare_trans, size);
+
+	if (!n)
+		return 0;
+	spare_trans = n;
+	max_spares = size;
+	return 1;
+}
+
 sql_trans *
 sql_trans_destroy(sql_trans *t)
 {
@@ -205,7 +242,8 @@ sql_trans_destroy(sql_trans *t)
 	fprintf(stderr, "#destroy trans (%p)\n", t);
 #endif
 
-	if (res == gtrans && spares < MAX_SPARES && !t->name) {
+	if (res == gtrans && !t->name &&
+	    (spares < max_spares || spare_trans_extend())) {
 #ifdef STORE_DEBUG
 		fprintf(stderr, "#spared (%d) trans (%p)\n", spares, t);
 #endif
@@ -214,26 +252,20 @@ sql_trans_destroy(sql_trans *t)
 		return res;
 	}
 
-	if (t->name) 
-		t->name = NULL;
-
-	cs_destroy(&t->schemas);
-	sa_destroy(t->sa);
-	_DELETE(t);
-	transactions--;
+	trans_destroy(t);
 	return res;
 }
 
 static void
 destroy_spare_transactions(void) 
 {
-	int i, s = spares;
+	int i;
 
-	spares = MAX_SPARES; /* ie now there not spared anymore */
-	for (i = 0; i < s; i++) {
-		sql_trans_destroy(spare_trans[i]);
-	}
+	for (i = 0; i < spares; i++)
+		trans_destroy(spare_trans[i]);
 	spares = 0;
+	_DELETE(spare_trans);
+	max_spares = 0;
 }
 
 static int
@@ -616,6 +648,7 @@ load_table(sql_trans *tr, sql_schema *s, sqlid tid, subrids *nrs)
 	if (isRemote(t))
 		t->persistence = SQL_REMOTE;
 	t->cleared = 0;
+	t->compacted = 0;
 	v = table_funcs.column_find_value(tr, find_sql_column(tables, "access"),rid);
 	t->access = *(sht*)v;	_DELETE(v);
 
@@ -1303,6 +1336,7 @@ create_sql_table_with_id(sql_allocator *sa, int id, const char *name, sht type,
 	t->pkey = NULL;
 	t->sz = COLSIZE;
 	t->cleared = 0;
+	t->compacted = 0;
 	t->s = NULL;
 	return t;
 }
@@ -1606,7 +1640,8 @@ store_load(void) {
 		insert_aggrs(tr, funcs, args);
 		insert_schemas(tr);
 
-		if (sql_trans_commit(tr) != SQL_OK) {
+		if (sql_trans_commit(tr) != SQL_OK ||
+		    logger_funcs.log_tsync(0) != LOG_OK) {
 			fprintf(stderr, "cannot commit initial transaction\n");
 		}
 		sql_trans_destroy(tr);
@@ -1644,9 +1679,12 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 	/* get the set keep_persisted_log_files
 	 * we will need it later when calling logger_cleanup */
 	keep_persisted_log_files = log_settings->keep_persisted_log_files;
+	/* how long a group commit waits for more transactions */
+	group_commit_delay = log_settings->group_commit_delay;
 
 #ifdef NEED_MT_LOCK_INIT
 	MT_lock_init(&bs_lock, "SQL_bs_lock");
+	ATOMIC_INIT(retiredLock);
 #endif
 	MT_lock_set(&bs_lock);
 
@@ -1656,6 +1694,7 @@ store_init(int debug, store_type store, int readonly, int singleuser, logger_set
 	}
 
 	active_sessions = list_create(NULL);
+	ATOMIC_SET(store_nr_retired, 0, retiredLock);
 
 	/* initialize empty bats */
 	if (store == store_bat) {
@@ -1712,7 +1751,7 @@ store_exit(void)
 		sequences_exit();
 		MT_lock_set(&bs_lock);
 	}
-	if (spares > 0)
+	if (spare_trans)
 		destroy_spare_transactions();
 
 	logger_funcs.destroy();
@@ -1756,6 +1795,7 @@ store_apply_deltas(void)
 	logging = 1;
 	/* make sure we reset all transactions on re-activation */
 	gtrans->wstime = timestamp();
+	commit_number++;
 	if (store_funcs.gtrans_update)
 		store_funcs.gtrans_update(gtrans);
 	res = logger_funcs.restart();
@@ -1764,14 +1804,86 @@ store_apply_deltas(void)
 	logging = 0;
 }
 
+/* Remove the sessions whose read-only transaction was retired by
+ * sql_trans_retire from the active ones; called with bs_lock held */
+static void
+store_retire(void)
+{
+	node *n;
+
+	if (ATOMIC_GET(store_nr_retired, retiredLock) == 0)
+		return;
+	for (n = active_sessions->h; n; ) {
+		sql_session *s = n->data;
+
+		if (!s->active) {
+			node *p = list_remove_node(active_sessions, n);
+
+			n = p ? p->next : active_sessions->h;
+			store_nr_active --;
+			(void) ATOMIC_DEC(store_nr_retired, retiredLock);
+		} else {
+			n = n->next;
+		}
+	}
+}
+
 static int need_flush = 0;
 
+/* While a checkpoint waits for the active transactions to finish, new
+ * ones are held back, so a steady stream of short queries cannot
+ * starve it.  The hold lasts at most CHECKPOINT_DRAIN ms, after which
+ * the checkpoint gives up and retries later.  A retry does not hold
+ * back new transactions again as long as the oldest transaction that
+ * made it give up is still running, since draining cannot succeed
+ * before that one ends. */
+#define CHECKPOINT_DRAIN	20
+#define CHECKPOINT_RETRY	5000
+static int checkpoint_pending = 0;
+static sql_trans *checkpoint_blocker = NULL;
+static int checkpoint_blocker_stime = 0;
+
+/* Called with the store lock held before a new transaction starts */
+void
+store_checkpoint_wait(void)
+{
+	int t;
+
+	for (t = CHECKPOINT_DRAIN; checkpoint_pending && t > 0 && !GDKexiting(); t--) {
+		MT_lock_unset(&bs_lock);
+		MT_sleep_ms(1);
+		MT_lock_set(&bs_lock);
+	}
+}
+
+/* Is the transaction that made the last checkpoint attempt give up
+ * still running?  Called with bs_lock held. */
+static int
+store_checkpoint_blocked(void)
+{
+	sql_session *s;
+
+	if (!checkpoint_blocker || !active_sessions->h)
+		return 0;
+	s = active_sessions->h->data;
+	return s->active && s->tr == checkpoint_blocker &&
+		s->tr->stime == checkpoint_blocker_stime;
+}
+
 void
 store_flush_log(void)
 {
 	need_flush = 1;
 }
 
+/* Wait until the transactions committed so far are on disk.  Called
+ * without holding the store lock, so concurrent commits share a sync. */
+int
+store_sync_log(void)
+{
+	return logger_funcs.log_tsync(group_commit_delay);
+}
+
 static int
 store_needs_vacuum( sql_trans *tr )
 {
@@ -1817,6 +1929,163 @@ store_vacuum( sql_trans *tr )
 	return 0;
 }
 
+/* User tables are compacted while other transactions run, once at
+ * least 1/VACUUM_FRACTION of their rows and at least sql_vacuum_min_dels
+ * rows (default VACUUM_MIN_DELS, 0 turns the compaction off) are
+ * deleted; store_vacuum_table compacts a table on request.  The live rows are
+ * copied into new columns by an ordinary transaction, so readers keep
+ * their snapshot.  A concurrent writer of the table either aborts the
+ * compaction or, as its row ids predate the compaction (see
+ * sql_table.compacted), gets a conflict at its own commit.  A table whose
+ * compaction was aborted is skipped for a doubling number of rounds,
+ * so steady writers do not make every round copy it again. */
+#define VACUUM_MIN_DELS		1024
+#define VACUUM_FRACTION		4
+#define VACUUM_FAILED		8
+#define VACUUM_MAX_SKIP		64
+
+static struct {
+	int id;
+	int skip;
+	int rounds;
+} vacuum_failed[VACUUM_FAILED];
+
+static int
+store_vacuum_skip(int id)
+{
+	int i;
+
+	for (i = 0; i < VACUUM_FAILED; i++)
+		if (vacuum_failed[i].id == id && vacuum_failed[i].skip > 0) {
+			vacuum_failed[i].skip--;
+			return 1;
+		}
+	return 0;
+}
+
+static void
+store_vacuum_done(int id, int ok)
+{
+	int i, e = -1;
+
+	for (i = 0; i < VACUUM_FAILED; i++) {
+		if (vacuum_failed[i].id == id)
+			break;
+		if (e < 0 && vacuum_failed[i].id == 0)
+			e = i;
+	}
+	if (ok) {
+		if (i < VACUUM_FAILED)
+			vacuum_failed[i].id = 0;
+		return;
+	}
+	if (i == VACUUM_FAILED) {
+		if (e < 0)	/* forget the first entry */
+			e = 0;
+		i = e;
+		vacuum_failed[i].id = id;
+		vacuum_failed[i].rounds = 0;
+	}
+	if (vacuum_failed[i].rounds < VACUUM_MAX_SKIP)
+		vacuum_failed[i].rounds = vacuum_failed[i].rounds ? vacuum_failed[i].rounds * 2 : 1;
+	vacuum_failed[i].skip = vacuum_failed[i].rounds;
+}
+
+/* the index columns are not rebuilt */
+static int
+store_vacuum_allowed( sql_table *t )
+{
+	return isTable(t) && !t->system && !isTempTable(t) && t->data &&
+		list_empty(t->idxs.set) && list_empty(t->keys.set);
+}
+
+static sql_table *
+store_vacuum_candidate( sql_trans *tr )
+{
+	int min_dels = GDKgetenv_int("sql_vacuum_min_dels", VACUUM_MIN_DELS);
+	node *m, *n;
+
+	if (min_dels <= 0)
+		return NULL;
+	for (m = tr->schemas.set->h; m; m = m->next) {
+		sql_schema *s = m->data;
+
+		if (isTempSchema(s) || !s->tables.set)
+			continue;
+		for (n = s->tables.set->h; n; n = n->next) {
+			sql_table *t = n->data;
+			size_t dels;
+
+			if (!store_vacuum_allowed(t))
+				continue;
+			dels = store_funcs.count_del(tr, t);
+			if (dels >= (size_t) min_dels &&
+			    dels * VACUUM_FRACTION >= store_funcs.count_col(tr, t->columns.set->h->data, 1) &&
+			    !store_vacuum_skip(t->base.id))
+				return t;
+		}
+	}
+	return NULL;
+}
+
+/* Called with the store lock held, which is released while the live
+ * rows are copied; returns whether the table was compacted */
+static int
+store_vacuum_online( sql_table *ot )
+{
+	sql_session *s = sql_session_create(gtrans->stk, 0);
+	sql_schema *ss;
+	sql_table *t = NULL;
+	int id = ot->base.id;	/* ot may be freed while the lock is released */
+	int ok;
+
+	if (s == NULL)
+		return 0;
+	sql_trans_begin(s);
+	if ((ss = find_sql_schema(s->tr, ot->s->base.name)) != NULL)
+		t = find_sql_table(ss, ot->base.name);
+	MT_lock_unset(&bs_lock);
+
+	ok = t && table_funcs.table_vacuum(s->tr, t) == SQL_OK;
+
+	MT_lock_set(&bs_lock);
+	ok = ok && sql_trans_validate(s->tr);
+	if (ok && sql_trans_commit(s->tr) != SQL_OK) {
+		GDKerror("store_vacuum_online: commit of the compaction of table %d failed\n", id);
+		ok = 0;
+	}
+	/* make sure the changed data is not reused */
+	if (!ok && s->tr->wtime)
+		s->tr->status = 1;
+	store_vacuum_done(id, ok);
+	sql_trans_end(s);
+	sql_session_destroy(s);
+	MT_lock_unset(&bs_lock);
+	if (ok)
+		(void) store_sync_log();
+	MT_lock_set(&bs_lock);
+	return ok;
+}
+
+/* Compact table sname.tname now, whatever its number of deleted rows;
+ * returns whether it was compacted, which fails if a writer of the
+ * table commits meanwhile */
+int
+store_vacuum_table(const char *sname, const char *tname)
+{
+	sql_schema *s;
+	sql_table *t = NULL;
+	int ok = 0;
+
+	MT_lock_set(&bs_lock);
+	if ((s = find_sql_schema(gtrans, sname)) != NULL)
+		t = find_sql_table(s, tname);
+	if (t && store_vacuum_allowed(t))
+		ok = store_vacuum_online(t);
+	MT_lock_unset(&bs_lock);
+	return ok;
+}
+
 void
 store_manager(void)
 {
@@ -1846,21 +2115,44 @@ store_manager(void)
 		}
 
 		MT_lock_set(&bs_lock);
-
+		store_retire();
 
 		if ((!need_flush && logger_funcs.changes() < 1000000 && shared_transactions_drift < shared_drift_threshold)) {
 			MT_lock_unset(&bs_lock);
 			continue;
 		}
-		need_flush = 0;
-		while (store_nr_active) { /* find a moment to flush */
+		if (store_nr_active && store_checkpoint_blocked()) {
 			MT_lock_unset(&bs_lock);
-
-			if (GDKexiting())
-				return;
-			MT_sleep_ms(sleeptime);
+			MT_sleep_ms(CHECKPOINT_RETRY);
+			continue;
+		}
+		/* find a moment to flush, holding back new transactions */
+		checkpoint_pending = 1;
+		for (t = CHECKPOINT_DRAIN; store_nr_active && t > 0; t--) {
+			MT_lock_unset(&bs_lock);
+			MT_sleep_ms(1);
 			MT_lock_set(&bs_lock);
+			if (GDKexiting()) {
+				checkpoint_pending = 0;
+				MT_lock_unset(&bs_lock);
+				return;
+			}
+			store_retire();
+		}
+		if (store_nr_active) {
+			/* long running transactions, let the others
+			 * continue and try again later */
+			sql_session *s = active_sessions->h->data;
+
+			checkpoint_pending = 0;
+			checkpoint_blocker = s->tr;
+			checkpoint_blocker_stime = s->tr->stime;
+			MT_lock_unset(&bs_lock);
+			MT_sleep_ms(CHECKPOINT_RETRY);
+			continue;
 		}
+		checkpoint_blocker = NULL;
+		need_flush = 0;
 
 		if (create_shared_logger) {
 			/* (re)load data from shared write-ahead log */
@@ -1887,15 +2179,19 @@ store_manager(void)
 
 		/* make sure we reset all transactions on re-activation */
 		if (gtrans == NULL) { // means store_exit was called
+			checkpoint_pending = 0;
 			MT_lock_unset(&bs_lock);
 			return;
 		}
 		logging = 1;
 		gtrans->wstime = timestamp();
+		commit_number++;
 		if (store_funcs.gtrans_update) {
 			store_funcs.gtrans_update(gtrans);
 		}
 		res = logger_funcs.restart();
+		/* the old log files are removed while new transactions run */
+		checkpoint_pending = 0;
 
 		MT_lock_unset(&bs_lock);
 		if (logging && res == LOG_OK) {
@@ -1928,15 +2224,25 @@ idle_manager(void)
 				return;
 		}
 		MT_lock_set(&bs_lock);
-		if (store_nr_active || GDKexiting() || !store_needs_vacuum(gtrans)) {
+		store_retire();
+		if (GDKexiting() || checkpoint_pending || gtrans == NULL) {
+			MT_lock_unset(&bs_lock);
+			continue;
+		}
+		if (store_nr_active || !store_needs_vacuum(gtrans)) {
+			sql_table *t = store_vacuum_candidate(gtrans);
+
+			if (t)
+				(void) store_vacuum_online(t);
 			MT_lock_unset(&bs_lock);
 			continue;
 		}
 
 		s = sql_session_create(gtrans->stk, 0);
 		sql_trans_begin(s);
-		if (store_vacuum( s->tr ) == 0)
-			sql_trans_commit(s->tr);
+		if (store_vacuum( s->tr ) == 0 &&
+		    sql_trans_commit(s->tr) == SQL_OK)
+			(void) logger_funcs.log_tsync(0);
 		sql_trans_end(s);
 		sql_session_destroy(s);
 
@@ -1949,6 +2255,7 @@ void
 store_lock(void)
 {
 	MT_lock_set(&bs_lock);
+	store_retire();
 #ifdef STORE_DEBUG
 	fprintf(stderr, "#locked\n");
 #endif
@@ -2450,6 +2757,7 @@ table_dup(sql_trans *tr, int flag, sql_table *ot, sql_schema *s)
 	t->s = s;
 	t->sz = ot->sz;
 	t->cleared = 0;
+	t->compacted = ot->compacted;
 
 	if (ot->columns.set) {
 		for (n = ot->columns.set->h; n; n = n->next) {
@@ -2665,6 +2973,7 @@ trans_dup(backend_stack stk, sql_trans *ot, const char *newname)
 		return NULL;
 	}
 	t = trans_init(t, stk, ot);
+	t->commit_number = commit_number;
 
 	cs_new(&t->schemas, t->sa, (fdestroy) &schema_destroy);
 
@@ -3142,6 +3451,7 @@ rollforward_update_table(sql_trans *tr, sql_table *ft, sql_table *tt, int mode)
 			if (bs_debug) 
 				fprintf(stderr, "#update table %s\n", tt->base.name);
 			ok = store_funcs.update_table(tr, ft, tt);
+			tt->compacted = ft->compacted;
 			ft->cleared = 0;
 			ft->base.rtime = ft->base.wtime = 0;
 			tt->access = ft->access;
@@ -3251,6 +3561,7 @@ rollforward_trans(sql_trans *tr, int mode)
 			
 			if (tr->schema_updates) 
 				schema_number++;
+			commit_number++;
 		}
 		//tr->wtime = tr->rtime = 0;
 	//	assert(gtrans->wstime == gtrans->wtime);
@@ -3273,6 +3584,9 @@ validate_tables(sql_schema *s, sql_schema *os)
 
  			ot = find_sql_table(os, t->base.name);
 			if (ot && isKindOfTable(ot) && isKindOfTable(t)) {
+				/* the rows were renumbered after t's snapshot */
+				if (t->compacted < ot->compacted)
+					return 0;
 				if ((t->base.wtime && (t->base.wtime < ot->base.rtime || t->base.wtime < ot->base.wtime)) ||
 				    (t->base.rtime && (t->base.rtime < ot->base.wtime))) 
 					return 0;
@@ -3450,6 +3764,7 @@ reset_table(sql_trans *tr, sql_table *ft, sql_table *pft)
 
 		ft->base.wtime = ft->base.rtime = 0;
 		ft->cleared = 0;
+		ft->compacted = pft->compacted;
 		ft->access = pft->access;
 		ok = reset_changeset( tr, &ft->columns, &pft->columns, &ft->base, (resetf) &reset_column, (dupfunc) &column_dup);
 		if (ok == LOG_OK)
@@ -3525,6 +3840,7 @@ reset_trans(sql_trans *tr, sql_trans *ptr)
 	fprintf(stderr,"#reset trans %d\n", tr->wtime);
 #endif
 	tr->wtime = tr->rtime = 0;
+	tr->commit_number = commit_number;
 	return res;
 }
 
@@ -3867,6 +4183,22 @@ sys_drop_sequence(sql_trans *tr, sql_sequence * seq, int drop_action)
 
 }
 
+static void
+sys_drop_histogram(sql_trans *tr, sql_column *col)
+{
+	sql_schema *syss = find_sql_schema(tr, "sys"); 
+	sql_table *syshist = find_sql_table(syss, "histogram");
+	rids *rs;
+	oid rid;
+
+	if (!syshist)
+		return ;
+	rs = table_funcs.rids_select(tr, find_sql_column(syshist, "column_id"), &col->base.id, &col->base.id, NULL);
+	for (rid = table_funcs.rids_next(rs); !is_oid_nil(rid); rid = table_funcs.rids_next(rs))
+		table_funcs.table_delete(tr, syshist, rid);
+	table_funcs.rids_destroy(rs);
+}
+
 static void
 sys_drop_statistics(sql_trans *tr, sql_column *col)
 {
@@ -3876,10 +4208,13 @@ sys_drop_statistics(sql_trans *tr, sql_column *col)
 
 		oid rid = table_funcs.column_find_row(tr, find_sql_column(sysstats, "column_id"), &col->base.id, NULL);
 
-		if (is_oid_nil(rid))
+		if (is_oid_nil(rid)) {
+			sys_drop_histogram(tr, col);
 			return ;
+		}
 
 		table_funcs.table_delete(tr, sysstats, rid);
+		sys_drop_histogram(tr, col);
 	}
 }
 
@@ -4944,6 +5279,208 @@ sql_trans_ranges( sql_trans *tr, sql_column *col, void **min, void **max )
 	return 0;
 }
 
+static void *
+histogram_value(sql_allocator *sa, int tpe, const char *s)
+{
+	void *p = NULL, *v;
+	size_t len = 0;
+
+	if (ATOMfromstr(tpe, &p, &len, s) < 0 || p == NULL ||
+	    ATOMcmp(tpe, p, ATOMnilptr(tpe)) == 0) {
+		GDKfree(p);
+		return NULL;
+	}
+	len = ATOMlen(tpe, p);
+	if ((v = sa_alloc(sa, len)) != NULL)
+		memcpy(v, p, len);
+	GDKfree(p);
+	return v;
+}
+
+/* Load the histogram of col from sys.histogram, or NULL if ANALYZE
+ * did not collect one */
+sql_histogram *
+sql_trans_histogram(sql_trans *tr, sql_column *col)
+{
+	sql_schema *sys;
+	sql_table *stats, *hist;
+	sql_column *hist_bucket, *hist_mcv;
+	sql_histogram *h;
+	rids *rs;
+	oid rid;
+	void *v;
+	int i;
+
+	if (!col || !isTable(col->t))
+		return NULL;
+	if (col->hist)
+		return col->hist;
+	sys = find_sql_schema(tr, "sys");
+	stats = find_sql_table(sys, "statistics");
+	hist = find_sql_table(sys, "histogram");
+	if (!stats || !hist)
+		return NULL;
+	rid = table_funcs.column_find_row(tr, find_sql_column(stats, "column_id"), &col->base.id, NULL);
+	if (is_oid_nil(rid))
+		return NULL;
+	h = SA_ZNEW(tr->sa, sql_histogram);
+	h->type = col->type.type->localtype;
+	v = table_funcs.column_find_value(tr, find_sql_column(stats, "unique"), rid);
+	h->ndv = *(lng *) v;
+	_DELETE(v);
+	v = table_funcs.column_find_value(tr, find_sql_column(stats, "nils"), rid);
+	h->nils = *(lng *) v;
+	_DELETE(v);
+
+	/* first find the number of buckets and common values */
+	hist_bucket = find_sql_column(hist, "bucket");
+	hist_mcv = find_sql_column(hist, "mcv");
+	rs = table_funcs.rids_select(tr, find_sql_column(hist, "column_id"), &col->base.id, &col->base.id, NULL);
+	for (rid = table_funcs.rids_next(rs); !is_oid_nil(rid); rid = table_funcs.rids_next(rs)) {
+		bit *m = table_funcs.column_find_value(tr, hist_mcv, rid);
+		int *b = table_funcs.column_find_value(tr, hist_bucket, rid);
+
+		if (*m && *b >= h->nmcv)
+			h->nmcv = *b + 1;
+		else if (!*m && *b >= h->nbuckets)
+			h->nbuckets = *b + 1;
+		_DELETE(m);
+		_DELETE(b);
+	}
+	table_funcs.rids_destroy(rs);
+	if (h->nbuckets == 0)
+		return NULL;
+	h->low = SA_ZNEW_ARRAY(tr->sa, void *, h->nbuckets);
+	h->high = SA_ZNEW_ARRAY(tr->sa, void *, h->nbuckets);
+	h->bcount = SA_ZNEW_ARRAY(tr->sa, lng, h->nbuckets);
+	h->bndv = SA_ZNEW_ARRAY(tr->sa, lng, h->nbuckets);
+	h->mcv = SA_ZNEW_ARRAY(tr->sa, void *, h->nmcv + 1);
+	h->mcvcount = SA_ZNEW_ARRAY(tr->sa, lng, h->nmcv + 1);
+
+	rs = table_funcs.rids_select(tr, find_sql_column(hist, "column_id"), &col->base.id, &col->base.id, NULL);
+	for (rid = table_funcs.rids_next(rs); !is_oid_nil(rid); rid = table_funcs.rids_next(rs)) {
+		bit *m = table_funcs.column_find_value(tr, hist_mcv, rid);
+		int *b = table_funcs.column_find_value(tr, hist_bucket, rid);
+		char *low = table_funcs.column_find_value(tr, find_sql_column(hist, "lowval"), rid);
+		char *high = table_funcs.column_find_value(tr, find_sql_column(hist, "highval"), rid);
+		lng *cnt = table_funcs.column_find_value(tr, find_sql_column(hist, "count"), rid);
+		lng *ndv = table_funcs.column_find_value(tr, find_sql_column(hist, "unique"), rid);
+
+		if (*b >= 0 && *m) {
+			h->mcv[*b] = histogram_value(tr->sa, h->type, low);
+			h->mcvcount[*b] = *cnt;
+		} else if (*b >= 0) {
+			h->low[*b] = histogram_value(tr->sa, h->type, low);
+			h->high[*b] = histogram_value(tr->sa, h->type, high);
+			h->bcount[*b] = *cnt;
+			h->bndv[*b] = *ndv > 0 ? *ndv : 1;
+		}
+		_DELETE(m);
+		_DELETE(b);
+		_DELETE(low);
+		_DELETE(high);
+		_DELETE(cnt);
+		_DELETE(ndv);
+	}
+	table_funcs.rids_destroy(rs);
+	for (i = 0; i < h->nbuckets; i++) {
+		if (!h->low[i] || !h->high[i])
+			return NULL;
+		h->count += h->bcount[i];
+	}
+	for (i = 0; i < h->nmcv; i++)
+		if (!h->mcv[i])
+			h->mcvcount[i] = 0;
+	if (h->count <= 0)
+		return NULL;
+	if (h->ndv <= 0)
+		h->ndv = 1;
+	col->hist = h;
+	return h;
+}
+
+/* position of v between lo and hi for the numeric types, 0.5 if the
+ * type has no useful distance */
+static dbl
+histogram_interpolate(int tpe, const void *lo, const void *hi, const void *v)
+{
+	dbl l, h, x;
+
+	switch (ATOMstorage(tpe)) {
+	case TYPE_bte:
+		l = *(const bte *) lo; h = *(const bte *) hi; x = *(const bte *) v;
+		break;
+	case TYPE_sht:
+		l = *(const sht *) lo; h = *(const sht *) hi; x = *(const sht *) v;
+		break;
+	case TYPE_int:
+		l = *(const int *) lo; h = *(const int *) hi; x = *(const int *) v;
+		break;
+	case TYPE_lng:
+		l = (dbl) *(const lng *) lo; h = (dbl) *(const lng *) hi; x = (dbl) *(const lng *) v;
+		break;
+#ifdef HAVE_HGE
+	case TYPE_hge:
+		l = (dbl) *(const hge *) lo; h = (dbl) *(const hge *) hi; x = (dbl) *(const hge *) v;
+		break;
+#endif
+	case TYPE_flt:
+		l = *(const flt *) lo; h = *(const flt *) hi; x = *(const flt *) v;
+		break;
+	case TYPE_dbl:
+		l = *(const dbl *) lo; h = *(const dbl *) hi; x = *(const dbl *) v;
+		break;
+	default:
+		return 0.5;
+	}
+	if (h <= l)
+		return 0.5;
+	return (x - l) / (h - l);
+}
+
+/* Fraction of the non-nil values of the histogram below v (or not
+ * above v if inclusive) */
+dbl
+sql_histogram_below(sql_histogram *h, const void *v, int inclusive)
+{
+	lng below = 0;
+	dbl frac = 0;
+	int i, c;
+
+	for (i = 0; i < h->nbuckets; i++) {
+		c = ATOMcmp(h->type, v, h->high[i]);
+		if (c > 0 || (c == 0 && inclusive)) {
+			below += h->bcount[i];
+			continue;
+		}
+		c = ATOMcmp(h->type, v, h->low[i]);
+		if (c > 0 || (c == 0 && inclusive))
+			frac = h->bcount[i] * histogram_interpolate(h->type, h->low[i], h->high[i], v);
+		break;
+	}
+	return (below + frac) / h->count;
+}
+
+/* Fraction of the non-nil values of the histogram equal to v */
+dbl
+sql_histogram_equal(sql_histogram *h, const void *v)
+{
+	int i;
+
+	for (i = 0; i < h->nmcv; i++)
+		if (h->mcv[i] && ATOMcmp(h->type, v, h->mcv[i]) == 0)
+			return (dbl) h->mcvcount[i] / h->count;
+	for (i = 0; i < h->nbuckets; i++) {
+		if (ATOMcmp(h->type, v, h->high[i]) > 0)
+			continue;
+		if (ATOMcmp(h->type, v, h->low[i]) < 0)
+			break;
+		return (dbl) h->bcount[i] / h->bndv[i] / h->count;
+	}
+	/* outside the analyzed range, assume it is rare */
+	return 1.0 / h->count;
+}
+
 
 sql_key *
 sql_trans_create_ukey(sql_trans *tr, sql_table *t, const char *name, key_type kt)
@@ -5648,8 +6185,10 @@ sql_trans_begin(sql_session *s)
 #ifdef STORE_DEBUG
 	fprintf(stderr,"#sql trans begin %d\n", snr);
 #endif
-	if (tr->stime < gtrans->wstime || tr->wtime || 
-			store_schema_number() != snr) 
+	/* an idle copy already reset against the current global
+	 * transaction is still valid */
+	if ((tr->stime < gtrans->wstime && tr->commit_number != commit_number) ||
+			tr->wtime || store_schema_number() != snr) 
 		reset_trans(tr, gtrans);
 	tr = trans_init(tr, tr->stk, tr->parent);
 	s->active = 1;
@@ -5677,6 +6216,20 @@ sql_trans_end(sql_session *s)
 	assert(list_length(active_sessions) == store_nr_active);
 }
 
+/* End a read-only transaction without taking the store lock.  The
+ * session stays on the active list, and thus keeps holding back
+ * in-place merges, until the next holder of bs_lock retires it. */
+void
+sql_trans_retire(sql_session *s)
+{
+#ifdef STORE_DEBUG
+	fprintf(stderr,"#sql trans retire (%d)\n", s->tr->schema_number);
+#endif
+	s->auto_commit = s->ac_on_commit;
+	s->active = 0;
+	(void) ATOMIC_INC(store_nr_retired, retiredLock);
+}
+
 void
 sql_trans_drop_any_comment(sql_trans *tr, int id) {
 	sql_schema *sys;
@@ -0,0 +1,101 @@
+/*
+ * A join of a large fact table with a filtered dimension first selects
+ * the fact rows that pass a Bloom filter of the dimension keys.  When
+ * mitosis splits the fact table, the filter must be applied to each
+ * piece and each piece joined on its own, rather than the pieces
+ * packed into one column first.
+ */
+#include "regress.h"
+
+/* from gdk_utils.h, to set the number of mitosis pieces; returns 0
+ * (GDK_FAIL) on failure */
+extern int GDKsetenv(const char *name, const char *value);
+
+#define QUERY "SELECT COUNT(*), SUM(f.v) FROM f, d WHERE f.k = d.k AND d.c < 1000"
+
+/* the output of q as one string */
+static char *
+query_text(monetdb_connection conn, const char *q)
+{
+	monetdb_result *res = NULL;
+	monetdb_column_str *c;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL), *text;
+	size_t r, len = 1;
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res == NULL || res->ncols != 1 || monetdb_result_fetch(res, 0)->type != monetdb_str)
+		error("%s: no text", q);
+	c = (monetdb_column_str *) monetdb_result_fetch(res, 0);
+	for (r = 0; r < res->nrows; r++)
+		len += strlen(c->data[r]) + 1;
+	if ((text = malloc(len)) == NULL)
+		error("out of memory");
+	text[0] = 0;
+	for (r = 0; r < res->nrows; r++) {
+		strcat(text, c->data[r]);
+		strcat(text, "\n");
+	}
+	monetdb_cleanup_result(conn, res);
+	return text;
+}
+
+/* number of occurrences of s in text */
+static int
+occurrences(const char *text, const char *s)
+{
+	int n = 0;
+
+	while ((text = strstr(text, s)) != NULL) {
+		text += strlen(s);
+		n++;
+	}
+	return n;
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err, *plan;
+	monetdb_connection conn;
+	int i;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "bloom_join");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+
+	/* the dimension is too large for its hash to stay in the cache,
+	 * each of its keys occurs 8 times in the fact table */
+	regress_query(conn, "CREATE TABLE g (x INT)");
+	regress_query(conn, "INSERT INTO g VALUES (0)");
+	for (i = 0; i < 21; i++)
+		regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+	regress_query(conn, "CREATE TABLE f (k INT, v INT)");
+	regress_query(conn, "CREATE TABLE d (k INT, c INT)");
+	regress_query(conn, "INSERT INTO f SELECT x % 262144, x FROM g");
+	regress_query(conn, "INSERT INTO d SELECT x, x FROM g WHERE x < 262144");
+	regress_query(conn, "DROP TABLE g");
+	if (GDKsetenv("mito_parts", "4") == 0)
+		error("cannot set mito_parts");
+
+	/* without statistics the selectivity of d.c < 1000 is unknown */
+	plan = query_text(conn, "EXPLAIN " QUERY);
+	if (occurrences(plan, "algebra.bloomselect(") != 0)
+		error("Bloom filter without statistics:\n%s", plan);
+	free(plan);
+
+	regress_query(conn, "ANALYZE sys");
+	plan = query_text(conn, "EXPLAIN " QUERY);
+	if (occurrences(plan, "algebra.bloomselect(") < 2 ||
+	    occurrences(plan, "algebra.join(") < 2)
+		error("the Bloom filter is not applied to each piece:\n%s", plan);
+	free(plan);
+	if (regress_value(conn, QUERY, 0, 0) != 8000 ||
+	    regress_value(conn, QUERY, 0, 1) != 7344028000.0)
+		error("wrong result of the join through a Bloom filter");
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
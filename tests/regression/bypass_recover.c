@@ -0,0 +1,135 @@
+/*
+ * A large load into an empty table skips the log even while another
+ * transaction is active: the loaded bat is made persistent and the log
+ * only names it.  A process commits such a load next to a reader,
+ * changes the loaded rows through the log, loads a table it cleared
+ * (which has to go through the log), checkpoints, changes the rows
+ * once more and ends without a shutdown.  After a restart every
+ * committed change is there.
+ */
+#include "regress.h"	/* before gdk.h, see regress_fail */
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_logger.h"
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* more than SNAPSHOT_MINSIZE in bat_storage.c */
+#define NROWS	(1 << 18)
+
+/* from bat_logger.h, the logger of the SQL store */
+extern logger *bat_logger;
+/* from sql_storage.h */
+extern void store_lock(void);
+extern void store_unlock(void);
+extern void store_apply_deltas(void);
+
+/* bytes written to the log by q */
+static long long
+logged(monetdb_connection conn, const char *q)
+{
+	long long pos = (long long) ftello(getFile(bat_logger->log));
+
+	regress_query(conn, q);
+	return (long long) ftello(getFile(bat_logger->log)) - pos;
+}
+
+static void
+check(monetdb_connection conn, const char *what, const char *q, long long expected)
+{
+	long long v = regress_int(conn, q);
+
+	if (v != expected)
+		error("%s: %lld expected, %lld found", what, expected, v);
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn, reader;
+	pid_t pid;
+	long long n, id;
+	int i, status;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "bypass_recover");
+
+	pid = fork();
+	if (pid < 0)
+		error("fork failed");
+	if (pid == 0) {
+		if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+			error("%s", err);
+		conn = monetdb_connect();
+		reader = monetdb_connect();
+		regress_query(conn, "CREATE TABLE g (x INT)");
+		regress_query(conn, "INSERT INTO g VALUES (1)");
+		for (i = 0; i < 18; i++)
+			regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+		regress_query(conn, "CREATE TABLE t (a INT, b BIGINT)");
+		regress_query(conn, "CREATE TABLE c (a INT)");
+		regress_query(conn, "INSERT INTO c SELECT -x FROM g WHERE x <= 1000");
+		id = bat_logger->id;
+
+		regress_query(reader, "START TRANSACTION");
+		check(reader, "rows of t before the load", "SELECT COUNT(*) FROM t", 0);
+		n = logged(conn, "INSERT INTO t SELECT x, 3 * x FROM g");
+		if (n >= 4096)
+			error("load of t logged in %lld bytes", n);
+		check(reader, "rows of t seen by the reader", "SELECT COUNT(*) FROM t", 0);
+		check(conn, "rows of t after the load", "SELECT COUNT(*) FROM t", NROWS);
+
+		/* changes on top of the load do go through the log */
+		regress_query(conn, "UPDATE t SET b = -b WHERE a % 1000 = 0");
+		regress_query(conn, "DELETE FROM t WHERE a = 5");
+		regress_query(conn, "INSERT INTO t VALUES (0, 0)");
+
+		/* a table cleared by the loading transaction still has
+		 * readers of its old rows */
+		regress_query(conn, "START TRANSACTION");
+		regress_query(conn, "DELETE FROM c");
+		regress_query(conn, "INSERT INTO c SELECT x FROM g");
+		regress_query(conn, "COMMIT");
+		check(reader, "rows of c seen by the reader", "SELECT COUNT(*) FROM c", 1000);
+		regress_query(reader, "COMMIT");
+
+		if (bat_logger->id != id)
+			error("the log was checkpointed");
+
+		/* the checkpoint writes the columns as the store has them in
+		 * memory, the loaded rows included */
+		store_lock();
+		store_apply_deltas();
+		store_unlock();
+		if (bat_logger->id == id)
+			error("the log was not checkpointed");
+		regress_query(conn, "UPDATE t SET b = b + 1 WHERE a = 7");
+		regress_query(conn, "INSERT INTO c VALUES (0)");
+		/* end without a shutdown, as if the process crashed */
+		_exit(0);
+	}
+	if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		error("loading process failed");
+
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+	check(conn, "rows of t", "SELECT COUNT(*) FROM t", NROWS);
+	check(conn, "distinct a of t", "SELECT COUNT(DISTINCT a) FROM t WHERE a BETWEEN 0 AND 262144", NROWS);
+	check(conn, "deleted row of t", "SELECT COUNT(*) FROM t WHERE a = 5", 0);
+	check(conn, "inserted row of t", "SELECT COUNT(*) FROM t WHERE a = 0 AND b = 0", 1);
+	check(conn, "updated rows of t", "SELECT COUNT(*) FROM t WHERE b < 0", NROWS / 1000);
+	check(conn, "wrong b in t",
+	      "SELECT COUNT(*) FROM t WHERE b <> CASE WHEN a % 1000 = 0 THEN -3 * a WHEN a = 7 THEN 22 ELSE 3 * a END", 0);
+	check(conn, "rows of c", "SELECT COUNT(*) FROM c", NROWS + 1);
+	check(conn, "sum of c", "SELECT SUM(CAST(a AS BIGINT)) FROM c", (long long) NROWS * (NROWS + 1) / 2);
+
+	/* the recovered table takes new rows */
+	regress_query(conn, "INSERT INTO t VALUES (-1, -1)");
+	check(conn, "rows of t after an insert", "SELECT COUNT(*) FROM t", NROWS + 1);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * A COPY INTO ... LOCKED load is durable once it is acknowledged: the
+ * log is synced up to the load's transaction before the COPY returns,
+ * and a process that ends right after the load, without shutting down,
+ * does not lose it.
+ */
+#include "regress.h"	/* before gdk.h, see regress_fail */
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_logger.h"
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define NROWS 100000
+
+/* from bat_logger.h, the logger of the SQL store */
+extern logger *bat_logger;
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	char csv[BUFSIZ], q[BUFSIZ * 2];
+	monetdb_connection conn;
+	FILE *f;
+	pid_t pid;
+	int i, status, synced;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "copy_locked");
+	snprintf(csv, sizeof(csv), "%s/copy_locked.csv", argv[1]);
+	if ((f = fopen(csv, "w")) == NULL)
+		error("cannot write %s", csv);
+	for (i = 0; i < NROWS; i++)
+		fprintf(f, "%d|%d\n", i, i % 7);
+	fclose(f);
+
+	pid = fork();
+	if (pid < 0)
+		error("fork failed");
+	if (pid == 0) {
+		if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+			error("%s", err);
+		conn = monetdb_connect();
+		regress_query(conn, "CREATE TABLE t (a INT, b INT)");
+		synced = bat_logger->synced;
+		snprintf(q, sizeof(q), "COPY INTO t FROM '%s' USING DELIMITERS '|', '\\n' LOCKED", csv);
+		regress_query(conn, q);
+		/* log_tsync and the logger restart of the load's
+		 * checkpoint mark the transactions they synced */
+		if (bat_logger->synced <= synced ||
+		    bat_logger->synced != bat_logger->flushed)
+			error("load acknowledged before the log was synced "
+			      "(synced %d, was %d, flushed %d)",
+			      bat_logger->synced, synced, bat_logger->flushed);
+		/* end without a shutdown, as if the process crashed */
+		_exit(0);
+	}
+	if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		error("loading process failed");
+
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+	if (regress_int(conn, "SELECT COUNT(*) FROM t") != NROWS)
+		error("load lost after restart");
+	if (regress_int(conn, "SELECT SUM(b) FROM t") != 299995)
+		error("load damaged after restart");
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Columns with pending updates and inserts are projected through
+ * candidate lists that are not dense, because rows were deleted or
+ * selected, and through the results of joins and top-N, which fetch
+ * string columns late.  Every value must come from the row it belongs
+ * to, with the updates of the transaction applied.
+ */
+#include "regress.h"
+
+#define N	1000	/* rows before the transaction */
+#define NINS	100	/* rows inserted in the transaction */
+#define MAXROWS	(N + NINS)
+
+/* rows k % 7 = 3 are deleted, then in the transaction rows k % 5 = 0
+ * are updated and rows N up to N + NINS inserted */
+static int
+present(int k)
+{
+	return k < N ? k % 7 != 3 : k < N + NINS;
+}
+
+static int
+updated(int k)
+{
+	return k < N && k % 5 == 0;
+}
+
+/* run q, whose columns are k, i, b, d, s and, if named, a name from
+ * table n, and check that it returns the rows ks in that order */
+static void
+check(monetdb_connection conn, const char *q, const int *ks, size_t n, int named)
+{
+	monetdb_result *res = NULL;
+	monetdb_column_int32_t *ck, *ci;
+	monetdb_column_int64_t *cb;
+	monetdb_column_double *cd;
+	monetdb_column_str *cs, *cn = NULL;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL);
+	char buf[32];
+	size_t r;
+	int k, sign;
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res == NULL || res->ncols != (size_t) (named ? 6 : 5))
+		error("%s: wrong number of columns", q);
+	if (res->nrows != n)
+		error("%s: %zu rows instead of %zu", q, res->nrows, n);
+	ck = (monetdb_column_int32_t *) monetdb_result_fetch(res, 0);
+	ci = (monetdb_column_int32_t *) monetdb_result_fetch(res, 1);
+	cb = (monetdb_column_int64_t *) monetdb_result_fetch(res, 2);
+	cd = (monetdb_column_double *) monetdb_result_fetch(res, 3);
+	cs = (monetdb_column_str *) monetdb_result_fetch(res, 4);
+	if (named)
+		cn = (monetdb_column_str *) monetdb_result_fetch(res, 5);
+	for (r = 0; r < n; r++) {
+		k = ks[r];
+		sign = updated(k) ? -1 : 1;
+		if (ck->data[r] != k)
+			error("%s, row %zu: k is %d instead of %d", q, r, ck->data[r], k);
+		if (ci->data[r] != sign * k)
+			error("%s, k %d: i is %d", q, k, ci->data[r]);
+		if (cb->data[r] != sign * (int64_t) k * 1000000007)
+			error("%s, k %d: b is %lld", q, k, (long long) cb->data[r]);
+		if (cd->data[r] != sign * (k + 0.25))
+			error("%s, k %d: d is %g", q, k, cd->data[r]);
+		snprintf(buf, sizeof(buf), "%c%d", updated(k) ? 'u' : 'v', k);
+		if (strcmp(cs->data[r], buf) != 0)
+			error("%s, k %d: s is %s", q, k, cs->data[r]);
+		snprintf(buf, sizeof(buf), "n%d", k);
+		if (named && strcmp(cn->data[r], buf) != 0)
+			error("%s, k %d: name is %s", q, k, cn->data[r]);
+	}
+	monetdb_cleanup_result(conn, res);
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn;
+	int ks[MAXROWS];
+	size_t n;
+	int i, k;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "delta_project");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+
+	regress_query(conn, "CREATE TABLE g (x INT)");
+	regress_query(conn, "INSERT INTO g VALUES (0)");
+	for (i = 0; i < 11; i++)
+		regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+	regress_query(conn, "CREATE TABLE t (k INT, i INT, b BIGINT, d DOUBLE, s STRING)");
+	regress_query(conn, "INSERT INTO t SELECT x, x, CAST(x AS BIGINT) * 1000000007, x + 0.25, 'v' || CAST(x AS STRING) FROM g WHERE x < 1000");
+	regress_query(conn, "CREATE TABLE n (k INT, name STRING)");
+	regress_query(conn, "INSERT INTO n SELECT x, 'n' || CAST(x AS STRING) FROM g WHERE x < 1100 AND x % 10 = 0");
+	regress_query(conn, "DELETE FROM t WHERE k % 7 = 3");
+
+	regress_query(conn, "START TRANSACTION");
+	regress_query(conn, "UPDATE t SET i = -i, b = -b, d = -d, s = 'u' || CAST(k AS STRING) WHERE k % 5 = 0");
+	regress_query(conn, "INSERT INTO t SELECT x, x, CAST(x AS BIGINT) * 1000000007, x + 0.25, 'v' || CAST(x AS STRING) FROM g WHERE x >= 1000 AND x < 1100");
+
+	for (n = 0, k = 0; k < MAXROWS; k++)
+		if (present(k))
+			ks[n++] = k;
+	check(conn, "SELECT k, i, b, d, s FROM t ORDER BY k", ks, n, 0);
+
+	for (n = 0, k = 0; k < MAXROWS; k++)
+		if (present(k) && k % 3 == 0)
+			ks[n++] = k;
+	check(conn, "SELECT k, i, b, d, s FROM t WHERE k % 3 = 0 ORDER BY k", ks, n, 0);
+
+	for (n = 0, k = 0; k < MAXROWS; k++)
+		if (present(k) && k % 10 == 0)
+			ks[n++] = k;
+	check(conn, "SELECT t.k, i, b, d, s, name FROM t, n WHERE t.k = n.k ORDER BY t.k", ks, n, 1);
+
+	for (n = 0, k = MAXROWS - 1; n < 20; k--)
+		if (present(k))
+			ks[n++] = k;
+	check(conn, "SELECT k, i, b, d, s FROM t ORDER BY k DESC LIMIT 20", ks, n, 0);
+
+	for (n = 0, k = MAXROWS - 1; n < 5; k--)
+		if (present(k) && k % 10 == 0)
+			ks[n++] = k;
+	check(conn, "SELECT t.k, i, b, d, s, name FROM t, n WHERE t.k = n.k ORDER BY t.k DESC LIMIT 5", ks, n, 1);
+
+	regress_query(conn, "ROLLBACK");
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
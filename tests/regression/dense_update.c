@@ -0,0 +1,49 @@
+/*
+ * Updating every value of a dense oid column shifts the sequence; the
+ * column must not keep claiming the old start, or selections and
+ * joins on it return the wrong rows.
+ */
+#include "regress.h"
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "dense_update");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+
+	/* the constants are cast, so the selections run on the oid column
+	 * itself; updates are applied in place to a table created in this
+	 * transaction */
+	regress_query(conn, "START TRANSACTION");
+	regress_query(conn, "CREATE TABLE t (o OID, i INT)");
+	regress_query(conn, "INSERT INTO t VALUES (5, 0), (6, 1), (7, 2)");
+	regress_query(conn, "UPDATE t SET o = o - 1");
+	if (regress_int(conn, "SELECT COUNT(*) FROM t WHERE o = CAST(4 AS OID)") != 1)
+		error("in place: o = 4 is not found");
+	if (regress_int(conn, "SELECT COUNT(*) FROM t WHERE o = CAST(7 AS OID)") != 0)
+		error("in place: o = 7 is still found");
+	if (regress_int(conn, "SELECT i FROM t WHERE o = CAST(5 AS OID)") != 1)
+		error("in place: o = 5 finds the wrong row");
+	regress_query(conn, "COMMIT");
+
+	/* updates merged into the committed column */
+	regress_query(conn, "UPDATE t SET o = o - 1");
+	regress_query(conn, "UPDATE t SET i = i + 10 WHERE i > 100");
+	if (regress_int(conn, "SELECT COUNT(*) FROM t WHERE o = CAST(3 AS OID)") != 1)
+		error("merged: o = 3 is not found");
+	if (regress_int(conn, "SELECT COUNT(*) FROM t WHERE o BETWEEN CAST(6 AS OID) AND CAST(7 AS OID)") != 0)
+		error("merged: o = 6 is still found");
+	if (regress_int(conn, "SELECT i FROM t WHERE o = CAST(4 AS OID)") != 1)
+		error("merged: o = 4 finds the wrong row");
+	if (regress_int(conn, "SELECT COUNT(*) FROM t a, t b WHERE a.o = b.o + 1") != 2)
+		error("merged: the self join finds the wrong rows");
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * A sort that does not fit in gdk_sort_memory is done as an external
+ * merge sort.  Setting gdk_sort_memory to 0 forces it, and the sorted
+ * values and their order must then be the same as those of the sort in
+ * memory, including the order of equal values in a stable sort.
+ */
+#include "regress.h"	/* before gdk.h, see regress_fail */
+#include "monetdb_config.h"
+#include "gdk.h"
+
+#define NINTS	((BUN) 1 << 22)
+#define NSTRS	((BUN) 1 << 20)
+
+/* a column of n values with many duplicates and some nils, in an order
+ * that is far from sorted */
+static BAT *
+make_bat(int tpe, BUN n)
+{
+	BAT *b = COLnew(0, tpe, n, TRANSIENT);
+	char buf[32];
+	BUN i;
+
+	if (b == NULL)
+		error("cannot create a bat of " BUNFMT " values", n);
+	for (i = 0; i < n; i++) {
+		int v = (int) ((i * 7919) % 1009);
+
+		if (tpe == TYPE_int) {
+			((int *) Tloc(b, 0))[i] = v == 0 ? int_nil : v;
+		} else {
+			snprintf(buf, sizeof(buf), "v%d", v);
+			if (BUNappend(b, v == 0 ? str_nil : buf, FALSE) != GDK_SUCCEED)
+				error("cannot append to a bat");
+		}
+	}
+	BATsetcount(b, n);
+	b->tsorted = b->trevsorted = 0;
+	b->tnosorted = b->tnorevsorted = 0;
+	b->tkey = 0;
+	b->tnil = 1;
+	b->tnonil = 0;
+	return b;
+}
+
+/* sort a newly made column with the given gdk_sort_memory, so
+ * that no order index of an earlier sort is reused */
+static void
+sort(int tpe, BUN n, const char *mem, int reverse, BAT **s, BAT **o)
+{
+	BAT *b = make_bat(tpe, n);
+
+	if (GDKsetenv("gdk_sort_memory", mem) != GDK_SUCCEED)
+		error("cannot set gdk_sort_memory");
+	if (BATsort(s, o, NULL, b, NULL, NULL, reverse, 1) != GDK_SUCCEED)
+		error("sort with gdk_sort_memory %s failed", mem);
+	BBPunfix(b->batCacheid);
+}
+
+static void
+check(int tpe, BUN n, int reverse)
+{
+	BAT *s1, *o1, *s2, *o2;
+	BATiter si;
+	const oid *ords;
+	BUN i;
+	int c;
+
+	sort(tpe, n, "50", reverse, &s1, &o1);
+	sort(tpe, n, "0", reverse, &s2, &o2);
+	if (BATcount(s2) != n || BATcount(o2) != n)
+		error("external sort: " BUNFMT " values instead of " BUNFMT, BATcount(s2), n);
+	si = bat_iterator(s2);
+	ords = (const oid *) Tloc(o2, 0);
+	for (i = 0; i + 1 < n; i++) {
+		c = ATOMcmp(tpe, BUNtail(si, i), BUNtail(si, i + 1));
+		if (reverse ? c < 0 : c > 0)
+			error("external sort%s of %s: not sorted at " BUNFMT,
+			      reverse ? " (reverse)" : "", ATOMname(tpe), i);
+		if (c == 0 && ords[i] >= ords[i + 1])
+			error("external sort%s of %s: not stable at " BUNFMT,
+			      reverse ? " (reverse)" : "", ATOMname(tpe), i);
+	}
+	if (memcmp(Tloc(o1, 0), ords, n * sizeof(oid)) != 0)
+		error("external sort%s of %s: order differs from the sort in memory",
+		      reverse ? " (reverse)" : "", ATOMname(tpe));
+	BBPunfix(s1->batCacheid);
+	BBPunfix(o1->batCacheid);
+	BBPunfix(s2->batCacheid);
+	BBPunfix(o2->batCacheid);
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "external_sort");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+
+	check(TYPE_int, NINTS, 0);
+	check(TYPE_int, NINTS, 1);
+	check(TYPE_str, NSTRS, 0);
+	check(TYPE_str, NSTRS, 1);
+
+	monetdb_shutdown();
+	return 0;
+}
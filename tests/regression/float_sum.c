@@ -0,0 +1,119 @@
+/*
+ * Summing or averaging a floating point column must give the same
+ * result however mitosis splits the column.  The values are chosen so
+ * that the order in which they are added matters, and the plans are
+ * checked to really sum the column in pieces.
+ */
+#include "regress.h"
+
+/* from gdk_utils.h, to set the number of mitosis pieces; returns 0
+ * (GDK_FAIL) on failure */
+extern int GDKsetenv(const char *name, const char *value);
+
+static const char *queries[] = {
+	"SELECT SUM(d) AS %s FROM f",
+	"SELECT AVG(d) AS %s FROM f",
+	"SELECT CAST(SUM(CAST(d AS REAL)) AS DOUBLE) AS %s FROM f",
+	"SELECT g, SUM(d) AS %s FROM f GROUP BY g ORDER BY g",
+	"SELECT g, AVG(d) AS %s FROM f GROUP BY g ORDER BY g",
+};
+
+/* EXPLAIN output as one string */
+static char *
+query_text(monetdb_connection conn, const char *q)
+{
+	monetdb_result *res = NULL;
+	monetdb_column_str *c;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL), *text;
+	size_t r, len = 1;
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res == NULL || res->ncols != 1 || monetdb_result_fetch(res, 0)->type != monetdb_str)
+		error("%s: no text", q);
+	c = (monetdb_column_str *) monetdb_result_fetch(res, 0);
+	for (r = 0; r < res->nrows; r++)
+		len += strlen(c->data[r]) + 1;
+	if ((text = malloc(len)) == NULL)
+		error("out of memory");
+	text[0] = 0;
+	for (r = 0; r < res->nrows; r++) {
+		strcat(text, c->data[r]);
+		strcat(text, "\n");
+	}
+	monetdb_cleanup_result(conn, res);
+	return text;
+}
+
+/* number of occurrences of s in text */
+static int
+occurrences(const char *text, const char *s)
+{
+	int n = 0;
+
+	while ((text = strstr(text, s)) != NULL) {
+		text += strlen(s);
+		n++;
+	}
+	return n;
+}
+
+/* run query nr with mito_parts set to parts, the alias keeps the plan
+ * from being reused */
+static double
+run(monetdb_connection conn, int nr, const char *parts, size_t row)
+{
+	char q[BUFSIZ], alias[32];
+
+	if (GDKsetenv("mito_parts", parts) == 0)
+		error("cannot set mito_parts");
+	snprintf(alias, sizeof(alias), "p%s_%zu", parts, row);
+	snprintf(q, sizeof(q), queries[nr], alias);
+	return regress_value(conn, q, row, nr < 3 ? 0 : 1);
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn;
+	char sql[BUFSIZ], q[BUFSIZ + 8], *plan;
+	double one, four;
+	size_t row;
+	int i;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "float_sum");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+
+	regress_query(conn, "CREATE TABLE g (x INT)");
+	regress_query(conn, "INSERT INTO g VALUES (1)");
+	for (i = 0; i < 22; i++)
+		regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+	regress_query(conn, "CREATE TABLE f (g INT, d DOUBLE)");
+	regress_query(conn, "INSERT INTO f SELECT x % 7, CASE WHEN x % 1000 = 0 THEN 1e17 WHEN x % 1000 = 500 THEN -1e17 ELSE 1.0 / x END FROM g");
+	regress_query(conn, "DROP TABLE g");
+
+	for (i = 0; i < (int) (sizeof(queries) / sizeof(queries[0])); i++) {
+		if (GDKsetenv("mito_parts", "4") == 0)
+			error("cannot set mito_parts");
+		snprintf(sql, sizeof(sql), queries[i], "plan");
+		snprintf(q, sizeof(q), "EXPLAIN %s", sql);
+		plan = query_text(conn, q);
+		if (occurrences(plan, i < 3 ? "aggr.sumbins(" : "aggr.subsumbins(") != 4)
+			error("%s is not summed in four pieces:\n%s", queries[i], plan);
+		free(plan);
+		for (row = 0; row < (i < 3 ? 1 : 7); row++) {
+			one = run(conn, i, "1", row);
+			four = run(conn, i, "4", row);
+			if (one != four)
+				error("%s, row %zu: %.17g in one piece, %.17g in four",
+				      queries[i], row, one, four);
+		}
+	}
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * A join whose hash table does not fit in the memory budget is done as
+ * a grace hash join.  Setting a small budget forces it, and the result
+ * pairs and their order must then be the same as those of the hash
+ * join in memory, with and without candidate lists and whether or not
+ * nils match.
+ */
+#include "regress.h"	/* before gdk.h, see regress_fail */
+#include "monetdb_config.h"
+#include "gdk.h"
+
+#define NOUTER	((BUN) 1 << 20)
+#define NINNER	((BUN) 1 << 17)
+
+/* a column of n values from a domain of dom values, some of them nil,
+ * in an order that is far from sorted */
+static BAT *
+make_bat(int tpe, BUN n, int dom, int mul)
+{
+	BAT *b = COLnew(0, tpe, n, TRANSIENT);
+	char buf[32];
+	BUN i;
+
+	if (b == NULL)
+		error("cannot create a bat of " BUNFMT " values", n);
+	for (i = 0; i < n; i++) {
+		int v = (int) ((i * mul) % dom);
+
+		if (tpe == TYPE_int) {
+			((int *) Tloc(b, 0))[i] = v % 5000 == 0 ? int_nil : v;
+		} else {
+			snprintf(buf, sizeof(buf), "v%d", v);
+			if (BUNappend(b, v % 5000 == 0 ? str_nil : buf, FALSE) != GDK_SUCCEED)
+				error("cannot append to a bat");
+		}
+	}
+	BATsetcount(b, n);
+	b->tsorted = b->trevsorted = 0;
+	b->tnosorted = b->tnorevsorted = 0;
+	b->tkey = 0;
+	b->tnil = 1;
+	b->tnonil = 0;
+	return b;
+}
+
+/* candidate list of the oids below n that are not a multiple of step */
+static BAT *
+make_cand(BUN n, BUN step)
+{
+	BAT *s = COLnew(0, TYPE_oid, n, TRANSIENT);
+	oid *o;
+	BUN i;
+
+	if (s == NULL)
+		error("cannot create a candidate list");
+	o = (oid *) Tloc(s, 0);
+	for (i = 0; i < n; i++)
+		if (i % step != 0)
+			*o++ = i;
+	BATsetcount(s, o - (oid *) Tloc(s, 0));
+	s->tsorted = 1;
+	s->trevsorted = BATcount(s) <= 1;
+	s->tkey = 1;
+	s->tdense = 0;
+	s->tnil = 0;
+	s->tnonil = 1;
+	return s;
+}
+
+/* join newly made columns, so that no hash of an earlier join is
+ * reused, within the given memory budget (0 for no budget) */
+static void
+join(int tpe, int swap, int cands, int nil_matches, size_t budget,
+     BAT **r1, BAT **r2)
+{
+	BAT *l = make_bat(tpe, NOUTER, 50000, 7919);
+	BAT *r = make_bat(tpe, NINNER, 60000, 104729);
+	BAT *sl = cands ? make_cand(NOUTER, 3) : NULL;
+	BAT *sr = cands ? make_cand(NINNER, 5) : NULL;
+	gdk_return ret;
+
+	GDKsetmemorybudget(budget);
+	if (GDKmemorybudget() != budget)
+		error("cannot set the memory budget");
+	if (swap)
+		ret = BATjoin(r1, r2, r, l, sr, sl, nil_matches, BUN_NONE);
+	else
+		ret = BATjoin(r1, r2, l, r, sl, sr, nil_matches, BUN_NONE);
+	GDKsetmemorybudget(0);
+	if (ret != GDK_SUCCEED)
+		error("join with a memory budget of %zu failed", budget);
+	BBPunfix(l->batCacheid);
+	BBPunfix(r->batCacheid);
+	if (cands) {
+		BBPunfix(sl->batCacheid);
+		BBPunfix(sr->batCacheid);
+	}
+}
+
+static void
+check(int tpe, int swap, int cands, int nil_matches)
+{
+	BAT *h1, *h2, *g1, *g2;
+
+	join(tpe, swap, cands, nil_matches, 0, &h1, &h2);
+	join(tpe, swap, cands, nil_matches, 1 << 16, &g1, &g2);
+	if (BATcount(h1) == 0)
+		error("join of %s: no result", ATOMname(tpe));
+	if (BATcount(g1) != BATcount(h1) || BATcount(g2) != BATcount(h2) ||
+	    memcmp(Tloc(g1, 0), Tloc(h1, 0), BATcount(h1) * sizeof(oid)) != 0 ||
+	    memcmp(Tloc(g2, 0), Tloc(h2, 0), BATcount(h2) * sizeof(oid)) != 0)
+		error("join of %s%s%s%s: grace join differs from the hash join",
+		      ATOMname(tpe), swap ? ", swapped" : "",
+		      cands ? ", with candidates" : "",
+		      nil_matches ? ", nils match" : "");
+	BBPunfix(h1->batCacheid);
+	BBPunfix(h2->batCacheid);
+	BBPunfix(g1->batCacheid);
+	BBPunfix(g2->batCacheid);
+}
+
+int main(int argc, char **argv) {
+	static const int types[] = { TYPE_int, TYPE_str };
+	char *farm, *err;
+	int t, swap, cands, nil_matches;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "grace_join");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+
+	for (t = 0; t < (int) (sizeof(types) / sizeof(types[0])); t++)
+		for (swap = 0; swap < 2; swap++)
+			for (cands = 0; cands < 2; cands++)
+				for (nil_matches = 0; nil_matches < 2; nil_matches++)
+					check(types[t], swap, cands, nil_matches);
+
+	monetdb_shutdown();
+	return 0;
+}
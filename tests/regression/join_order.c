@@ -0,0 +1,105 @@
+/*
+ * Joins are ordered by dynamic programming only when ANALYZE collected
+ * statistics.  In the chain a - b - c - d both a = b and c = d are
+ * small, while b = c multiplies the rows by 10000.  With statistics
+ * the plan joins a with b and c with d first, where the greedy left
+ * deep order goes through a large a, b, c intermediate.
+ */
+#include "regress.h"
+
+#define QUERY "SELECT COUNT(*) FROM a, b, c, d WHERE a.a = b.a AND b.b = c.b AND c.c = d.c"
+
+/* the relational plan of q as one string */
+static char *
+query_plan(monetdb_connection conn, const char *q)
+{
+	monetdb_result *res = NULL;
+	monetdb_column_str *c;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL), *plan;
+	size_t r, len = 1;
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res == NULL || res->ncols != 1 || monetdb_result_fetch(res, 0)->type != monetdb_str)
+		error("%s: no plan", q);
+	c = (monetdb_column_str *) monetdb_result_fetch(res, 0);
+	for (r = 0; r < res->nrows; r++)
+		len += strlen(c->data[r]) + 1;
+	if ((plan = malloc(len)) == NULL)
+		error("out of memory");
+	plan[0] = 0;
+	for (r = 0; r < res->nrows; r++) {
+		strcat(plan, c->data[r]);
+		strcat(plan, "\n");
+	}
+	monetdb_cleanup_result(conn, res);
+	return plan;
+}
+
+/* number of joins directly below the outermost join */
+static int
+joins_below_top(const char *plan)
+{
+	const char *s, *e, *j;
+	size_t depth = 0;
+	int n = 0;
+
+	for (s = plan; *s; s = *e ? e + 1 : e) {
+		if ((e = strchr(s, '\n')) == NULL)
+			e = s + strlen(s);
+		if ((j = strstr(s, "join (")) == NULL || j > e)
+			continue;
+		if (depth == 0)
+			depth = j - s;
+		else if ((size_t) (j - s) == depth + 2)
+			n++;
+	}
+	return n;
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err, *plan;
+	monetdb_connection conn;
+	int i;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "join_order");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+
+	regress_query(conn, "CREATE TABLE g (x INT)");
+	regress_query(conn, "INSERT INTO g VALUES (0)");
+	for (i = 0; i < 17; i++)
+		regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+	regress_query(conn, "CREATE TABLE a (a INT)");
+	regress_query(conn, "CREATE TABLE b (a INT, b INT)");
+	regress_query(conn, "CREATE TABLE c (b INT, c INT)");
+	regress_query(conn, "CREATE TABLE d (c INT)");
+	regress_query(conn, "INSERT INTO a SELECT x * 1000 FROM g WHERE x < 100");
+	regress_query(conn, "INSERT INTO b SELECT x, x % 10 FROM g");
+	regress_query(conn, "INSERT INTO c SELECT x % 10, x FROM g");
+	regress_query(conn, "INSERT INTO d SELECT x * 1000 FROM g WHERE x < 100");
+	regress_query(conn, "DROP TABLE g");
+
+	/* without statistics the greedy order is kept */
+	plan = query_plan(conn, "PLAN " QUERY);
+	if (joins_below_top(plan) != 1 || strncmp(strstr(plan, "table("), "table(sys.a)", 12) != 0)
+		error("without statistics the plan is not the greedy one:\n%s", plan);
+	free(plan);
+	if (regress_int(conn, QUERY) != 10000)
+		error("greedy plan: wrong count");
+
+	regress_query(conn, "ANALYZE sys");
+	plan = query_plan(conn, "PLAN " QUERY);
+	if (joins_below_top(plan) != 2)
+		error("with statistics the plan is not bushy:\n%s", plan);
+	free(plan);
+	if (regress_int(conn, QUERY) != 10000)
+		error("bushy plan: wrong count");
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * Packing the slices mitosis cut from a column gives a view on the
+ * column again when the slices follow each other, and a copy
+ * otherwise.  Queries that pack slices must give the same result as
+ * without mitosis, also after the column was changed.  mat.pack and
+ * mat.packIncrement are then called directly on slices that do not
+ * follow each other: with a gap, out of order, of two columns, and
+ * with oids that do not match their place in the column.
+ */
+#include "regress.h"	/* before gdk.h, see regress_fail */
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "mal_instruction.h"
+#include "mal_stack.h"
+#include "mat.h"
+
+#define NROWS	1000
+
+static const char *queries[] = {
+	"SELECT SUM(d) AS %s FROM f WHERE a > 100",
+	"SELECT SUM(d) AS %s FROM f WHERE a BETWEEN 1000 AND 3000",
+	"SELECT MAX(d) - MIN(d) AS %s FROM f WHERE a < 900000",
+};
+
+/* EXPLAIN output as one string */
+static char *
+query_text(monetdb_connection conn, const char *q)
+{
+	monetdb_result *res = NULL;
+	monetdb_column_str *c;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL), *text;
+	size_t r, len = 1;
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res == NULL || res->ncols != 1 || monetdb_result_fetch(res, 0)->type != monetdb_str)
+		error("%s: no text", q);
+	c = (monetdb_column_str *) monetdb_result_fetch(res, 0);
+	for (r = 0; r < res->nrows; r++)
+		len += strlen(c->data[r]) + 1;
+	if ((text = malloc(len)) == NULL)
+		error("out of memory");
+	text[0] = 0;
+	for (r = 0; r < res->nrows; r++) {
+		strcat(text, c->data[r]);
+		strcat(text, "\n");
+	}
+	monetdb_cleanup_result(conn, res);
+	return text;
+}
+
+/* run query nr with mito_parts set to parts, the alias keeps the plan
+ * from being reused */
+static double
+run(monetdb_connection conn, int nr, const char *parts, int round)
+{
+	char q[BUFSIZ], alias[32];
+
+	if (GDKsetenv("mito_parts", parts) != GDK_SUCCEED)
+		error("cannot set mito_parts");
+	snprintf(alias, sizeof(alias), "p%s_%d", parts, round);
+	snprintf(q, sizeof(q), queries[nr], alias);
+	return regress_value(conn, q, 0, 0);
+}
+
+static void
+compare(monetdb_connection conn, int round)
+{
+	char sql[BUFSIZ], q[BUFSIZ + 8], *plan;
+	double one, four;
+	int i;
+
+	for (i = 0; i < (int) (sizeof(queries) / sizeof(queries[0])); i++) {
+		if (GDKsetenv("mito_parts", "4") != GDK_SUCCEED)
+			error("cannot set mito_parts");
+		snprintf(sql, sizeof(sql), queries[i], "plan");
+		snprintf(q, sizeof(q), "EXPLAIN %s", sql);
+		plan = query_text(conn, q);
+		/* the pieces of d are bound and packed again */
+		if (strstr(plan, "\"d\", 0:int, 3:int, 4:int)") == NULL ||
+		    strstr(plan, ":bat[:lng] := mat.packIncrement(") == NULL)
+			error("%s does not pack the pieces of d:\n%s", queries[i], plan);
+		free(plan);
+		one = run(conn, i, "1", round);
+		four = run(conn, i, "4", round);
+		if (one != four)
+			error("%s, round %d: %.17g in one piece, %.17g in four",
+			      queries[i], round, one, four);
+	}
+}
+
+/* pack the slices, with mat.packIncrement if incremental and with
+ * mat.pack otherwise, and return the result */
+static BAT *
+pack(int incremental, BAT **s, int n)
+{
+	MalBlkPtr mb = newMalBlk(2 * n + 2);
+	MalStkPtr stk;
+	InstrPtr p;
+	int ret, pieces, arg[8], i;
+	bat acc = 0;
+	str msg;
+	BAT *bn;
+
+	if (mb == NULL || n > 8)
+		error("cannot make a MAL block");
+	ret = newTmpVariable(mb, newBatType(TYPE_int));
+	pieces = newTmpVariable(mb, TYPE_int);
+	for (i = 0; i < n; i++)
+		arg[i] = newTmpVariable(mb, newBatType(TYPE_int));
+	if ((stk = newGlobalStack(mb->vtop)) == NULL)
+		error("cannot make a MAL stack");
+	stk->stktop = mb->vtop;
+	stk->stk[pieces].vtype = TYPE_int;
+	stk->stk[pieces].val.ival = n;
+	for (i = 0; i < n; i++) {
+		stk->stk[arg[i]].vtype = TYPE_bat;
+		stk->stk[arg[i]].val.bval = s[i]->batCacheid;
+	}
+	stk->stk[ret].vtype = TYPE_bat;
+
+	if (!incremental) {
+		if ((p = newInstruction(mb, "mat", "pack")) == NULL)
+			error("cannot make an instruction");
+		p->argv[0] = ret;
+		for (i = 0; i < n; i++)
+			p = pushArgument(mb, p, arg[i]);
+		if ((msg = MATpack(NULL, mb, stk, p)) != MAL_SUCCEED)
+			error("mat.pack: %s", msg);
+		acc = stk->stk[ret].val.bval;
+		freeInstruction(p);
+	}
+	for (i = 0; incremental && i < n; i++) {
+		if ((p = newInstruction(mb, "mat", "packIncrement")) == NULL)
+			error("cannot make an instruction");
+		p->argv[0] = ret;
+		if (i == 0) {
+			p = pushArgument(mb, p, arg[0]);
+			p = pushArgument(mb, p, pieces);
+		} else {
+			/* the packed pieces so far come in as the first argument */
+			stk->stk[arg[0]].val.bval = acc;
+			p = pushArgument(mb, p, arg[0]);
+			p = pushArgument(mb, p, arg[i]);
+		}
+		if ((msg = MATpackIncrement(NULL, mb, stk, p)) != MAL_SUCCEED)
+			error("mat.packIncrement: %s", msg);
+		if (i > 0)
+			BBPrelease(acc);
+		acc = stk->stk[ret].val.bval;
+		freeInstruction(p);
+	}
+	/* freeing the stack would release the bats on it, the references
+	 * are handled here */
+	for (i = 0; i < mb->vtop; i++)
+		stk->stk[i].vtype = TYPE_void;
+	freeStack(stk);
+	freeMalBlk(mb);
+	if ((bn = BATdescriptor(acc)) == NULL)
+		error("no packed bat");
+	BBPrelease(acc);
+	return bn;
+}
+
+/* pack the slices both ways and check the values, the head and whether
+ * the result is a view on parent */
+static void
+check(const char *what, BAT **s, int n, BAT *parent)
+{
+	int incremental, i;
+	BUN cnt, j;
+	const int *v;
+	BAT *bn;
+
+	for (incremental = 0; incremental < 2; incremental++) {
+		bn = pack(incremental, s, n);
+		cnt = 0;
+		v = (const int *) Tloc(bn, 0);
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < BATcount(s[i]); j++)
+				if (cnt + j >= BATcount(bn) ||
+				    v[cnt + j] != ((const int *) Tloc(s[i], 0))[j])
+					error("%s, %s: row %zu differs", what,
+					      incremental ? "packIncrement" : "pack",
+					      (size_t) (cnt + j));
+			cnt += BATcount(s[i]);
+		}
+		if (BATcount(bn) != cnt)
+			error("%s, %s: %zu rows expected, %zu found", what,
+			      incremental ? "packIncrement" : "pack",
+			      (size_t) cnt, (size_t) BATcount(bn));
+		if (bn->hseqbase != s[0]->hseqbase)
+			error("%s, %s: head starts at %zu instead of %zu", what,
+			      incremental ? "packIncrement" : "pack",
+			      (size_t) bn->hseqbase, (size_t) s[0]->hseqbase);
+		if ((parent != NULL) != (VIEWtparent(bn) != 0) ||
+		    (parent && VIEWtparent(bn) != parent->batCacheid))
+			error("%s, %s: %s", what,
+			      incremental ? "packIncrement" : "pack",
+			      parent ? "not a view on the column" : "a view");
+		BBPunfix(bn->batCacheid);
+	}
+}
+
+/* a column that cannot change, so that it can be sliced */
+static BAT *
+column(int factor)
+{
+	BAT *b = COLnew(0, TYPE_int, NROWS, TRANSIENT);
+	int i;
+
+	if (b == NULL)
+		error("cannot make a column");
+	for (i = 0; i < NROWS; i++)
+		if (BUNappend(b, &(int){factor * i}, FALSE) != GDK_SUCCEED)
+			error("cannot fill a column");
+	if (BATsetaccess(b, BAT_READ) != GDK_SUCCEED)
+		error("cannot set the access of a column");
+	return b;
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn;
+	BAT *b, *c, *s[10];
+	int i;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "mat_packview");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+
+	regress_query(conn, "CREATE TABLE g (x INT)");
+	regress_query(conn, "INSERT INTO g VALUES (1)");
+	for (i = 0; i < 20; i++)
+		regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+	regress_query(conn, "CREATE TABLE f (a INT, d BIGINT)");
+	regress_query(conn, "INSERT INTO f SELECT x, x % 97 FROM g");
+	regress_query(conn, "DROP TABLE g");
+	compare(conn, 0);
+	/* the pieces of changed columns are not plain slices */
+	regress_query(conn, "DELETE FROM f WHERE a % 10 = 0");
+	regress_query(conn, "UPDATE f SET d = -d WHERE a % 7 = 0");
+	regress_query(conn, "INSERT INTO f VALUES (2000, 5), (-1, 3)");
+	compare(conn, 1);
+	monetdb_disconnect(conn);
+
+	b = column(3);
+	c = column(5);
+	for (i = 0; i < 4; i++)
+		if ((s[i] = BATslice(b, i * NROWS / 4, (i + 1) * NROWS / 4)) == NULL)
+			error("cannot slice");
+	if ((s[4] = BATslice(b, NROWS / 2, NROWS / 2)) == NULL ||
+	    (s[5] = BATslice(c, NROWS / 2, 3 * NROWS / 4)) == NULL)
+		error("cannot slice");
+	/* slices whose rows follow each other in the column but whose
+	 * oids do not, and the other way around */
+	if ((s[6] = BATslice(b, NROWS / 4, NROWS / 2)) == NULL ||
+	    (s[7] = BATslice(b, NROWS / 2, 3 * NROWS / 4)) == NULL ||
+	    (s[8] = BATslice(b, 0, NROWS / 4)) == NULL ||
+	    (s[9] = BATslice(b, NROWS / 4, NROWS / 2)) == NULL)
+		error("cannot slice");
+	BAThseqbase(s[6], 2 * NROWS);
+	BAThseqbase(s[7], NROWS / 4);
+	BAThseqbase(s[8], 2 * NROWS);
+	BAThseqbase(s[9], 2 * NROWS + NROWS / 4);
+
+	check("consecutive slices", s, 4, b);
+	check("consecutive slices around an empty one",
+	      (BAT *[]){s[0], s[1], s[4], s[2], s[3]}, 5, b);
+	check("slices with a gap", (BAT *[]){s[0], s[2], s[3]}, 3, NULL);
+	check("slices out of order", (BAT *[]){s[0], s[2], s[1], s[3]}, 4, NULL);
+	check("slices of two columns", (BAT *[]){s[0], s[1], s[5], s[3]}, 4, NULL);
+	check("slices with a gap in the oids", (BAT *[]){s[0], s[6]}, 2, NULL);
+	check("slices with a gap in the column", (BAT *[]){s[0], s[7]}, 2, NULL);
+	check("slices with other oids than the column", (BAT *[]){s[8], s[9]}, 2, NULL);
+
+	for (i = 0; i < 10; i++)
+		BBPunfix(s[i]->batCacheid);
+	BBPunfix(b->batCacheid);
+	BBPunfix(c->batCacheid);
+	monetdb_shutdown();
+	return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Helpers shared by the regression tests.  Every test gets a scratch
+ * directory as its first argument, exits with 0 when it passes and
+ * prints a "Failure:" line otherwise.
+ */
+#ifndef _REGRESS_H_
+#define _REGRESS_H_
+
+#include "embedded.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Report a failure and exit.  This is a function rather than a macro
+ * so that tests calling GDK directly can include this file before
+ * monetdb_config.h, which defines exit away and sends stderr to the
+ * null device. */
+static void
+regress_fail(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "Failure: ");
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+/* the abort, never reached, tells the compiler error does not return */
+#define error(...) do {				\
+		regress_fail(__VA_ARGS__);	\
+		abort();			\
+	} while (0)
+
+/* remove and return the dbfarm "dir/name" */
+static char *
+regress_dbfarm(const char *dir, const char *name)
+{
+	static char farm[BUFSIZ];
+	char cmd[BUFSIZ + 10];
+
+	snprintf(farm, sizeof(farm), "%s/%s", dir, name);
+	snprintf(cmd, sizeof(cmd), "rm -rf %s", farm);
+	if (system(cmd) != 0)
+		error("cannot remove %s", farm);
+	return farm;
+}
+
+static void
+regress_query(monetdb_connection conn, const char *q)
+{
+	monetdb_result *res = NULL;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL);
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res)
+		monetdb_cleanup_result(conn, res);
+}
+
+/* run q, return NULL on success or the error message */
+static char *
+regress_try(monetdb_connection conn, const char *q)
+{
+	monetdb_result *res = NULL;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL);
+
+	if (res)
+		monetdb_cleanup_result(conn, res);
+	return err;
+}
+
+/* value in column col of row row of the result of q, as a double */
+static double
+regress_value(monetdb_connection conn, const char *q, size_t row, size_t col)
+{
+	monetdb_result *res = NULL;
+	monetdb_column *c;
+	double v = 0;
+	char *err = monetdb_query(conn, (char *) q, 1, &res, NULL, NULL);
+
+	if (err)
+		error("%s: %s", q, err);
+	if (res == NULL || res->nrows <= row || res->ncols <= col)
+		error("%s: no value at row %zu column %zu", q, row, col);
+	c = monetdb_result_fetch(res, col);
+	switch (c->type) {
+	case monetdb_int8_t:
+		v = ((monetdb_column_int8_t *) c)->data[row];
+		break;
+	case monetdb_int16_t:
+		v = ((monetdb_column_int16_t *) c)->data[row];
+		break;
+	case monetdb_int32_t:
+		v = ((monetdb_column_int32_t *) c)->data[row];
+		break;
+	case monetdb_int64_t:
+		v = (double) ((monetdb_column_int64_t *) c)->data[row];
+		break;
+	case monetdb_double:
+		v = ((monetdb_column_double *) c)->data[row];
+		break;
+	default:
+		error("%s: unexpected result type", q);
+	}
+	monetdb_cleanup_result(conn, res);
+	return v;
+}
+
+static long long
+regress_int(monetdb_connection conn, const char *q)
+{
+	return (long long) regress_value(conn, q, 0, 0);
+}
+
+#endif /* _REGRESS_H_ */
@@ -0,0 +1,194 @@
+/*
+ * Tables with many deleted rows are compacted while other transactions
+ * run.  A writer that keeps inserting, deleting and updating rows of
+ * such a table must not lose any committed change to a compaction that
+ * copied the rows before the change, and a writer whose row ids were
+ * renumbered by a compaction must not commit.  The background
+ * compaction is turned off, the test compacts the tables itself.
+ */
+#include "regress.h"
+
+#include <pthread.h>
+
+#define TRANSACTIONS	200
+#define WRITERS		3
+#define STALE_WRITERS	8
+
+/* from gdk_utils.h, returns 0 (GDK_FAIL) on failure */
+extern int GDKsetenv(const char *name, const char *value);
+/* from sql_storage.h, returns whether the table was compacted */
+extern int store_vacuum_table(const char *sname, const char *tname);
+
+static pthread_mutex_t counts = PTHREAD_MUTEX_INITIALIZER;
+static long long inserted, deleted, updated;
+static int running = WRITERS;
+
+struct writer {
+	monetdb_connection conn;
+	int nr;
+};
+
+/* each transaction touches rows of its own, so writers only conflict
+ * with the compaction */
+static void *
+writer(void *arg)
+{
+	struct writer *w = arg;
+	char q[BUFSIZ];
+	long long k;
+	int i;
+
+	for (i = 0, k = w->nr + 1; i < TRANSACTIONS; i++, k += WRITERS) {
+		regress_query(w->conn, "START TRANSACTION");
+		snprintf(q, sizeof(q), "INSERT INTO v VALUES (%lld, 0)", -k);
+		regress_query(w->conn, q);
+		snprintf(q, sizeof(q), "DELETE FROM v WHERE a = %lld", 8 * k);
+		regress_query(w->conn, q);
+		snprintf(q, sizeof(q), "UPDATE v SET b = -1 WHERE a = %lld", 8 * k + 4);
+		regress_query(w->conn, q);
+		if (regress_try(w->conn, "COMMIT") == NULL) {
+			pthread_mutex_lock(&counts);
+			inserted++;
+			deleted++;
+			updated++;
+			pthread_mutex_unlock(&counts);
+		}
+	}
+	pthread_mutex_lock(&counts);
+	running--;
+	pthread_mutex_unlock(&counts);
+	return NULL;
+}
+
+/* number of rows stored for table t, deleted ones included */
+static long long
+physical(monetdb_connection conn, const char *t)
+{
+	char q[BUFSIZ];
+
+	snprintf(q, sizeof(q), "SELECT \"count\" FROM sys.storage('sys', '%s') WHERE \"column\" = 'a'", t);
+	return regress_int(conn, q);
+}
+
+static void
+check_v(monetdb_connection conn, long long rows)
+{
+	if (regress_int(conn, "SELECT COUNT(*) FROM v WHERE a < 0") != inserted)
+		error("%lld rows inserted, %lld found", inserted,
+		      regress_int(conn, "SELECT COUNT(*) FROM v WHERE a < 0"));
+	if (regress_int(conn, "SELECT COUNT(*) FROM v") != rows + inserted - deleted)
+		error("%lld rows expected, %lld found", rows + inserted - deleted,
+		      regress_int(conn, "SELECT COUNT(*) FROM v"));
+	if (regress_int(conn, "SELECT COUNT(*) FROM v WHERE b = -1") != updated)
+		error("%lld rows updated, %lld found", updated,
+		      regress_int(conn, "SELECT COUNT(*) FROM v WHERE b = -1"));
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn, fresh;
+	struct writer w[WRITERS];
+	pthread_t tid[WRITERS];
+	monetdb_connection stale[STALE_WRITERS];
+	char q[BUFSIZ];
+	long long rows, phys;
+	int i, busy;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "vacuum_writer");
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	if (GDKsetenv("sql_vacuum_min_dels", "0") == 0)
+		error("cannot set sql_vacuum_min_dels");
+	conn = monetdb_connect();
+
+	regress_query(conn, "CREATE TABLE g (x INT)");
+	regress_query(conn, "INSERT INTO g VALUES (1)");
+	for (i = 0; i < 18; i++)
+		regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+	regress_query(conn, "CREATE TABLE v (a INT, b INT)");
+	regress_query(conn, "INSERT INTO v SELECT x, x % 1000 FROM g");
+	regress_query(conn, "DROP TABLE g");
+	/* leave every fourth row */
+	regress_query(conn, "DELETE FROM v WHERE a % 4 <> 0");
+	rows = regress_int(conn, "SELECT COUNT(*) FROM v");
+
+	/* compact v over and over while the writers commit; whether a
+	 * compaction or a writer gives way depends on the interleaving,
+	 * but no committed change may be lost */
+	for (i = 0; i < WRITERS; i++) {
+		w[i].conn = monetdb_connect();
+		w[i].nr = i;
+		if (pthread_create(&tid[i], NULL, writer, &w[i]) != 0)
+			error("cannot start writer %d", i);
+	}
+	do {
+		(void) store_vacuum_table("sys", "v");
+		pthread_mutex_lock(&counts);
+		busy = running > 0;
+		pthread_mutex_unlock(&counts);
+	} while (busy);
+	for (i = 0; i < WRITERS; i++) {
+		pthread_join(tid[i], NULL);
+		monetdb_disconnect(w[i].conn);
+	}
+	check_v(conn, rows);
+
+	/* without writers the compaction goes through and keeps just the
+	 * live rows */
+	if (!store_vacuum_table("sys", "v"))
+		error("v was not compacted");
+	if (physical(conn, "v") != rows + inserted - deleted)
+		error("%lld rows stored after compacting v, %lld live",
+		      physical(conn, "v"), rows + inserted - deleted);
+	check_v(conn, rows);
+
+	/* writers of w that started before it is compacted, each after an
+	 * unrelated commit, hold row ids that the compaction renumbers;
+	 * none of them may commit */
+	regress_query(conn, "CREATE TABLE u (x INT)");
+	regress_query(conn, "CREATE TABLE w (a INT, s STRING)");
+	regress_query(conn, "INSERT INTO w VALUES (0, 'row 0')");
+	for (i = 0; i < 18; i++)
+		regress_query(conn, "INSERT INTO w SELECT a + (SELECT COUNT(*) FROM w), 'row ' || a FROM w");
+	regress_query(conn, "DELETE FROM w WHERE a % 4 = 1");
+	rows = regress_int(conn, "SELECT COUNT(*) FROM w");
+	phys = physical(conn, "w");
+	for (i = 0; i < STALE_WRITERS; i++) {
+		regress_query(conn, "INSERT INTO u VALUES (1)");
+		stale[i] = monetdb_connect();
+		regress_query(stale[i], "START TRANSACTION");
+		snprintf(q, sizeof(q), "DELETE FROM w WHERE a = %d", 4000 * (i + 1));
+		regress_query(stale[i], q);
+	}
+	if (!store_vacuum_table("sys", "w"))
+		error("w was not compacted");
+	if (physical(conn, "w") >= phys || physical(conn, "w") != rows)
+		error("%lld rows stored after compacting w, %lld live, %lld before",
+		      physical(conn, "w"), rows, phys);
+	for (i = 0; i < STALE_WRITERS; i++) {
+		if (regress_try(stale[i], "COMMIT") == NULL)
+			error("writer %d committed row ids from before the compaction", i);
+		monetdb_disconnect(stale[i]);
+		snprintf(q, sizeof(q), "SELECT COUNT(*) FROM w WHERE a = %d", 4000 * (i + 1));
+		if (regress_int(conn, q) != 1)
+			error("the deletion of aborted writer %d is applied", i);
+	}
+
+	/* a writer that starts after the compaction commits */
+	fresh = monetdb_connect();
+	regress_query(fresh, "START TRANSACTION");
+	regress_query(fresh, "DELETE FROM w WHERE a = 8");
+	if ((err = regress_try(fresh, "COMMIT")) != NULL)
+		error("writer after the compaction failed: %s", err);
+	monetdb_disconnect(fresh);
+	if (regress_int(conn, "SELECT COUNT(*) FROM w") != rows - 1 ||
+	    regress_int(conn, "SELECT COUNT(*) FROM w WHERE a = 8") != 0)
+		error("%lld rows expected in w, %lld found", rows - 1,
+		      regress_int(conn, "SELECT COUNT(*) FROM w"));
+
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}
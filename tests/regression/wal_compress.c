@@ -0,0 +1,117 @@
+/*
+ * Bulk inserts and updates of fixed width columns are written to the
+ * log compressed.  A process writes such records and ends without a
+ * shutdown; after a restart the replayed tables hold exactly what was
+ * committed.  The columns are cut into blocks that compress, blocks
+ * that are stored as is, and a last block holding a single value,
+ * which is too short to contain a match.
+ */
+#include "regress.h"	/* before gdk.h, see regress_fail */
+#include "monetdb_config.h"
+#include "gdk.h"
+#include "gdk_logger.h"
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* 3 log blocks of INT, 6 of BIGINT, and one value more */
+#define NROWS		(3 * 16384 + 1)
+
+/* pseudo random values that do not compress */
+#define HASH_INT	"CAST(CAST(x AS BIGINT) * x % 2147483647 * x % 2147483647 AS INT)"
+#define HASH_LNG	"(CAST(x AS BIGINT) * x % 2147483647 * x % 2147483647 * 4294967296 + CAST(x AS BIGINT) * x % 2147483629 * x % 2147483629 * 2 + x % 2)"
+
+/* from bat_logger.h, the logger of the SQL store */
+extern logger *bat_logger;
+
+/* bytes written to the log by q */
+static long long
+logged(monetdb_connection conn, const char *q)
+{
+	long long pos = (long long) ftello(getFile(bat_logger->log));
+
+	regress_query(conn, q);
+	return (long long) ftello(getFile(bat_logger->log)) - pos;
+}
+
+static void
+check(monetdb_connection conn, const char *what, const char *q, long long expected)
+{
+	long long v = regress_int(conn, q);
+
+	if (v != expected)
+		error("%s: %lld expected, %lld found", what, expected, v);
+}
+
+int main(int argc, char **argv) {
+	char *farm, *err;
+	monetdb_connection conn;
+	pid_t pid;
+	long long n;
+	int i, status;
+
+	if (argc < 2)
+		error("usage: %s scratchdir", argv[0]);
+	farm = regress_dbfarm(argv[1], "wal_compress");
+
+	pid = fork();
+	if (pid < 0)
+		error("fork failed");
+	if (pid == 0) {
+		if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+			error("%s", err);
+		if (!bat_logger->compress)
+			error("the log is not compressed");
+		conn = monetdb_connect();
+		regress_query(conn, "CREATE TABLE g (x INT)");
+		regress_query(conn, "INSERT INTO g VALUES (1)");
+		for (i = 0; i < 16; i++)
+			regress_query(conn, "INSERT INTO g SELECT x + (SELECT COUNT(*) FROM g) FROM g");
+		regress_query(conn, "CREATE TABLE c (a INT, b BIGINT)");
+		regress_query(conn, "CREATE TABLE r (a INT, h INT, l BIGINT)");
+
+		/* 12 bytes a row uncompressed */
+		n = logged(conn, "INSERT INTO c SELECT x, x % 10 FROM g WHERE x <= 49153");
+		if (n >= NROWS * 12 / 4)
+			error("insert of c logged in %lld bytes", n);
+		/* only a compresses */
+		n = logged(conn, "INSERT INTO r SELECT x, " HASH_INT ", " HASH_LNG " FROM g WHERE x <= 49153");
+		if (n < NROWS * 12)
+			error("insert of r logged in %lld bytes", n);
+		/* the oids and the values of 16385 rows, 20 bytes a row
+		 * uncompressed */
+		n = logged(conn, "UPDATE c SET b = b + 1 WHERE a % 3 = 0 OR a = 1");
+		if (n >= 16385 * 20 / 2)
+			error("update of c logged in %lld bytes", n);
+		regress_query(conn, "UPDATE r SET h = -h, l = -l WHERE a % 2 = 0");
+
+		/* the changes are still in the log only */
+		if (bat_logger->changes < 4 * NROWS)
+			error("the log was checkpointed");
+		/* end without a shutdown, as if the process crashed */
+		_exit(0);
+	}
+	if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		error("writing process failed");
+
+	if ((err = monetdb_startup(farm, 1, 0)) != NULL)
+		error("%s", err);
+	conn = monetdb_connect();
+	check(conn, "rows of c", "SELECT COUNT(*) FROM c", NROWS);
+	check(conn, "distinct a of c", "SELECT COUNT(DISTINCT a) FROM c WHERE a BETWEEN 1 AND 49153", NROWS);
+	check(conn, "wrong b in c",
+	      "SELECT COUNT(*) FROM c WHERE b <> a % 10 + CASE WHEN a % 3 = 0 OR a = 1 THEN 1 ELSE 0 END", 0);
+	check(conn, "last row of c", "SELECT b FROM c WHERE a = 49153", 49153 % 10);
+	check(conn, "rows of r", "SELECT COUNT(*) FROM r", NROWS);
+	check(conn, "distinct a of r", "SELECT COUNT(DISTINCT a) FROM r WHERE a BETWEEN 1 AND 49153", NROWS);
+	check(conn, "wrong h in r",
+	      "SELECT COUNT(*) FROM r, g WHERE r.a = g.x AND "
+	      "h <> CASE WHEN a % 2 = 0 THEN -" HASH_INT " ELSE " HASH_INT " END", 0);
+	check(conn, "wrong l in r",
+	      "SELECT COUNT(*) FROM r, g WHERE r.a = g.x AND "
+	      "l <> CASE WHEN a % 2 = 0 THEN -" HASH_LNG " ELSE " HASH_LNG " END", 0);
+	monetdb_disconnect(conn);
+	monetdb_shutdown();
+	return 0;
+}